@@ -109,6 +109,10 @@
 	\defgroup highlevelil High Level IL
 	\ingroup coreapi
 */
+/*!
+	\defgroup instrumentation Instrumentation
+	\ingroup coreapi
+*/
 /*!
 	\defgroup interaction Interaction
 	\ingroup coreapi
@@ -1,10 +1,85 @@
 #include "binaryninjaapi.h"
+#include <chrono>
 #include <string>
+#include <thread>
+#ifndef WIN32
+	#include <time.h>
+#endif
 
 using namespace BinaryNinja;
 using namespace std;
 
 
+struct Activity::Counters
+{
+	string name;
+	atomic<uint64_t> invocations {0};
+	atomic<uint64_t> failures {0};
+	atomic<uint64_t> wallTimeNs {0};
+	atomic<uint64_t> cpuTimeNs {0};
+	atomic<uint64_t> maxWallTimeNs {0};
+	Instrumentation::Histogram* histogram;
+};
+
+
+namespace
+{
+	struct ActivityTraceEvent
+	{
+		shared_ptr<const string> name;
+		uint64_t function;
+		bool hasFunction;
+		size_t threadId;
+		uint64_t startUs;
+		uint64_t durationUs;
+	};
+
+	// Counters are shared by every Activity object with the same name and live for the whole process
+	mutex g_activityCountersMutex;
+	map<string, shared_ptr<Activity::Counters>> g_activityCounters;
+
+	atomic<bool> g_activityTracing {false};
+	mutex g_activityTraceMutex;
+	vector<ActivityTraceEvent> g_activityTrace;
+	size_t g_activityTraceLimit = 0;
+	chrono::steady_clock::time_point g_activityTraceStart;
+	map<string, shared_ptr<const string>> g_activityTraceNames;
+}
+
+
+static uint64_t GetThreadCpuTimeNs()
+{
+#ifdef WIN32
+	FILETIME creation, exit, kernel, user;
+	if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+		return 0;
+	uint64_t kernelTime = ((uint64_t)kernel.dwHighDateTime << 32) | kernel.dwLowDateTime;
+	uint64_t userTime = ((uint64_t)user.dwHighDateTime << 32) | user.dwLowDateTime;
+	// FILETIME counts 100ns intervals
+	return (kernelTime + userTime) * 100;
+#else
+	timespec ts;
+	if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+		return 0;
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+
+static shared_ptr<Activity::Counters> GetActivityCounters(const string& name)
+{
+	unique_lock<mutex> lock(g_activityCountersMutex);
+	auto& counters = g_activityCounters[name];
+	if (!counters)
+	{
+		counters = make_shared<Activity::Counters>();
+		counters->name = name;
+		counters->histogram = Instrumentation::GetHistogram("activity." + name);
+	}
+	return counters;
+}
+
+
 Activity::Activity(const string& configuration, const std::function<void(Ref<AnalysisContext> analysisContext)>& action,
 	const std::function<bool(Ref<Activity>, Ref<AnalysisContext>)>& eligibility) : m_action(action), m_eligibility(eligibility)
 {
@@ -13,6 +88,7 @@ Activity::Activity(const string& configuration, const std::function<void(Ref<Ana
 		m_object = BNCreateActivityWithEligibility(configuration.c_str(), this, RunAction, CheckEligibility);
 	else
 		m_object = BNCreateActivity(configuration.c_str(), this, RunAction);
+	m_counters = GetActivityCounters(GetName());
 }
 
 
@@ -34,7 +110,58 @@ void Activity::RunAction(void* ctxt, BNAnalysisContext* analysisContext)
 	// LogError("API-Side Activity RunAction!");
 	auto boundActivity = static_cast<Activity*>(ctxt);
 	Ref<AnalysisContext> ac = new AnalysisContext(BNNewAnalysisContextReference(analysisContext));
-	boundActivity->m_action(ac);
+	Counters& counters = *boundActivity->m_counters;
+
+	auto wallStart = chrono::steady_clock::now();
+	uint64_t cpuStart = GetThreadCpuTimeNs();
+	try
+	{
+		boundActivity->m_action(ac);
+	}
+	catch (std::exception& e)
+	{
+		// Letting this unwind into the core would take the whole process down
+		counters.failures++;
+		LogError("Activity '%s' failed: %s", counters.name.c_str(), e.what());
+	}
+	uint64_t cpuTime = GetThreadCpuTimeNs() - cpuStart;
+	auto wallEnd = chrono::steady_clock::now();
+	uint64_t wallTime = chrono::duration_cast<chrono::nanoseconds>(wallEnd - wallStart).count();
+
+	counters.invocations++;
+	counters.wallTimeNs += wallTime;
+	counters.cpuTimeNs += cpuTime;
+	uint64_t maxWallTime = counters.maxWallTimeNs.load();
+	while (wallTime > maxWallTime && !counters.maxWallTimeNs.compare_exchange_weak(maxWallTime, wallTime))
+		;
+
+	if (Instrumentation::IsEnabled())
+	{
+		Instrumentation::RecordHistogram(counters.histogram, wallTime);
+		if (Instrumentation::IsTracingEnabled())
+			Instrumentation::RecordTraceEvent(counters.histogram, wallStart, wallTime);
+	}
+
+	if (g_activityTracing)
+	{
+		Ref<Function> func = ac->GetFunction();
+		ActivityTraceEvent event;
+		event.hasFunction = func;
+		event.function = func ? func->GetStart() : 0;
+		event.threadId = hash<thread::id>{}(this_thread::get_id());
+
+		unique_lock<mutex> lock(g_activityTraceMutex);
+		if (g_activityTrace.size() < g_activityTraceLimit && wallStart >= g_activityTraceStart)
+		{
+			auto& name = g_activityTraceNames[counters.name];
+			if (!name)
+				name = make_shared<const string>(counters.name);
+			event.name = name;
+			event.startUs = chrono::duration_cast<chrono::microseconds>(wallStart - g_activityTraceStart).count();
+			event.durationUs = wallTime / 1000;
+			g_activityTrace.push_back(std::move(event));
+		}
+	}
 }
 
 
@@ -55,3 +182,81 @@ string Activity::GetName() const
 	BNFreeString(name);
 	return result;
 }
+
+
+vector<ActivityStatistics> Workflow::GetActivityStatistics()
+{
+	unique_lock<mutex> lock(g_activityCountersMutex);
+	vector<ActivityStatistics> result;
+	for (auto& [name, counters] : g_activityCounters)
+	{
+		ActivityStatistics stats;
+		stats.name = name;
+		stats.invocations = counters->invocations;
+		if (stats.invocations == 0)
+			continue;
+		stats.failures = counters->failures;
+		stats.wallTimeNs = counters->wallTimeNs;
+		stats.cpuTimeNs = counters->cpuTimeNs;
+		stats.maxWallTimeNs = counters->maxWallTimeNs;
+		result.push_back(std::move(stats));
+	}
+	return result;
+}
+
+
+void Workflow::ResetActivityStatistics()
+{
+	unique_lock<mutex> lock(g_activityCountersMutex);
+	for (auto& [name, counters] : g_activityCounters)
+	{
+		counters->invocations = 0;
+		counters->failures = 0;
+		counters->wallTimeNs = 0;
+		counters->cpuTimeNs = 0;
+		counters->maxWallTimeNs = 0;
+	}
+}
+
+
+void Workflow::SetActivityTracingEnabled(bool enabled, size_t maxEvents)
+{
+	unique_lock<mutex> lock(g_activityTraceMutex);
+	if (enabled)
+	{
+		g_activityTrace.clear();
+		g_activityTraceLimit = maxEvents;
+		g_activityTraceStart = chrono::steady_clock::now();
+	}
+	g_activityTracing = enabled;
+}
+
+
+string Workflow::GetActivityTraceJson()
+{
+	Json::Value events(Json::arrayValue);
+	{
+		unique_lock<mutex> lock(g_activityTraceMutex);
+		for (auto& event : g_activityTrace)
+		{
+			Json::Value entry(Json::objectValue);
+			entry["name"] = *event.name;
+			entry["cat"] = "activity";
+			entry["ph"] = "X";
+			entry["pid"] = 0;
+			entry["tid"] = (Json::UInt64)event.threadId;
+			entry["ts"] = (Json::UInt64)event.startUs;
+			entry["dur"] = (Json::UInt64)event.durationUs;
+			if (event.hasFunction)
+				entry["args"]["function"] = fmt::format("{:#x}", event.function);
+			events.append(std::move(entry));
+		}
+	}
+
+	Json::Value trace(Json::objectValue);
+	trace["traceEvents"] = std::move(events);
+	trace["displayTimeUnit"] = "ms";
+	Json::StreamWriterBuilder builder;
+	builder["indentation"] = "";
+	return Json::writeString(builder, trace);
+}
@@ -10,6 +10,7 @@
 
 #include "arm64dis.h"
 #include "binaryninjaapi.h"
+#include "decodecache.h"
 #include "il.h"
 #include "lowlevelilinstruction.h"
 #include "neon_intrinsics.h"
@@ -277,9 +278,12 @@ class Arm64Architecture : public Architecture
 		if (m_onlyDisassembleOnAlignedAddresses && (addr % 4 != 0))
 			return false;
 
-		if (aarch64_decompose(*(uint32_t*)data, &result, addr) != 0)
-			return false;
-		return true;
+		// Info, text and IL for an instruction are requested separately, so the same word is decoded
+		// several times in a row
+		return DecodeCache<Instruction, 4>::Lookup(this, addr, 0, data, 4, result, [&](Instruction& instr) {
+			memset(&instr, 0, sizeof(instr));
+			return aarch64_decompose(*(uint32_t*)data, &instr, addr) == 0;
+		});
 	}
 
 
@@ -719,6 +723,7 @@ class Arm64Architecture : public Architecture
 		Ref<Settings> settings = Settings::Instance();
 		m_onlyDisassembleOnAlignedAddresses = settings->Get<bool>("arch.aarch64.disassembly.alignRequired") ? 1 : 0;
 		m_preferIntrinsics = settings->Get<bool>("arch.aarch64.disassembly.preferIntrinsics") ? 1 : 0;
+		SetLowLevelILTemplateCacheEnabled(settings->Get<bool>("arch.aarch64.lifting.templateCache"));
 	}
 
 	bool CanAssemble() override { return true; }
@@ -3557,6 +3562,13 @@ static void InitAarch64Settings()
 			"default" : true,
 			"description" : "Prefer generating calls to intrinsics (where one is available) to lifting vector operations as unrolled loops (where available). Note that not all vector operations are currently lifted as either intrinsics or unrolled loops."
 			})");
+	settings->RegisterSetting("arch.aarch64.lifting.templateCache",
+			R"({
+			"title" : "AARCH64 Reuse Lifted IL for Repeated Instructions",
+			"type" : "boolean",
+			"default" : true,
+			"description" : "Replay the IL of previously lifted instructions with the same encoding instead of lifting them again. Disable this when debugging the lifter. Takes effect on restart."
+			})");
 }
 
 
@@ -1171,10 +1171,7 @@ bool GetLowLevelILForInstruction(
 
 	auto preferIntrinsics = [&]() -> bool {
 		if (_preferIntrinsics())
-		{
-			NeonGetLowLevelILForInstruction(arch, addr, il, instr, addrSize);
-			return (il.GetInstructionCount() > n_instrs_before);
-		}
+			return NeonGetLowLevelILForInstruction(arch, addr, il, instr, addrSize);
 		return false;
 	};
 
@@ -3151,8 +3148,7 @@ bool GetLowLevelILForInstruction(
 	if (il.GetInstructionCount() > n_instrs_before)
 		return true;
 
-	NeonGetLowLevelILForInstruction(arch, addr, il, instr, addrSize);
-	if (il.GetInstructionCount() > n_instrs_before)
+	if (NeonGetLowLevelILForInstruction(arch, addr, il, instr, addrSize))
 		return true;
 
 	il.AddInstruction(il.Unimplemented());
@@ -7935,7 +7935,7 @@ string NeonGetIntrinsicName(uint32_t intrinsic)
 	}
 }
 
-vector<NameAndType> NeonGetIntrinsicInputs(uint32_t intrinsic)
+static vector<NameAndType> BuildNeonIntrinsicInputs(uint32_t intrinsic)
 {
 	switch (intrinsic)
 	{
@@ -11205,7 +11205,7 @@ vector<NameAndType> NeonGetIntrinsicInputs(uint32_t intrinsic)
 	}
 }
 
-vector<Confidence<Ref<Type>>> NeonGetIntrinsicOutputs(uint32_t intrinsic)
+static vector<Confidence<Ref<Type>>> BuildNeonIntrinsicOutputs(uint32_t intrinsic)
 {
 	switch (intrinsic)
 	{
@@ -14382,6 +14382,38 @@ vector<Confidence<Ref<Type>>> NeonGetIntrinsicOutputs(uint32_t intrinsic)
 	}
 }
 
+// Signatures never change, so each one is built once, on first use, into tables indexed by intrinsic. Lookups
+// during type propagation then copy a vector instead of creating every type again through the core.
+vector<NameAndType> NeonGetIntrinsicInputs(uint32_t intrinsic)
+{
+	static const vector<vector<NameAndType>> signatures = []() {
+		vector<vector<NameAndType>> result;
+		result.reserve(ARM64_INTRIN_NEON_END - ARM64_INTRIN_NORMAL_END);
+		for (uint32_t i = ARM64_INTRIN_NORMAL_END; i < ARM64_INTRIN_NEON_END; i++)
+			result.push_back(BuildNeonIntrinsicInputs(i));
+		return result;
+	}();
+
+	if ((intrinsic < ARM64_INTRIN_NORMAL_END) || (intrinsic >= ARM64_INTRIN_NEON_END))
+		return vector<NameAndType>();
+	return signatures[intrinsic - ARM64_INTRIN_NORMAL_END];
+}
+
+vector<Confidence<Ref<Type>>> NeonGetIntrinsicOutputs(uint32_t intrinsic)
+{
+	static const vector<vector<Confidence<Ref<Type>>>> signatures = []() {
+		vector<vector<Confidence<Ref<Type>>>> result;
+		result.reserve(ARM64_INTRIN_NEON_END - ARM64_INTRIN_NORMAL_END);
+		for (uint32_t i = ARM64_INTRIN_NORMAL_END; i < ARM64_INTRIN_NEON_END; i++)
+			result.push_back(BuildNeonIntrinsicOutputs(i));
+		return result;
+	}();
+
+	if ((intrinsic < ARM64_INTRIN_NORMAL_END) || (intrinsic >= ARM64_INTRIN_NEON_END))
+		return vector<Confidence<Ref<Type>>>();
+	return signatures[intrinsic - ARM64_INTRIN_NORMAL_END];
+}
+
 static void add_input_reg(
     vector<ExprId>& inputs, LowLevelILFunction& il, InstructionOperand& operand)
 {
@@ -14414,8 +14446,11 @@ bool NeonGetLowLevelILForInstruction(
     Architecture* arch, uint64_t addr, LowLevelILFunction& il, Instruction& instr, size_t addrSize)
 {
 	NeonIntrinsic intrin_id = (NeonIntrinsic)ARM64_INTRIN_INVALID;
-	vector<RegisterOrFlag> outputs;
-	vector<ExprId> inputs;
+	// Reused across calls so lifting SIMD heavy code doesn't allocate operand lists per instruction
+	thread_local vector<RegisterOrFlag> outputs;
+	thread_local vector<ExprId> inputs;
+	outputs.clear();
+	inputs.clear();
 
 	// printf("%s() operation:%d encoding:%d\n", __func__, instr.operation, instr.encoding);
 
@@ -24789,8 +24824,9 @@ bool NeonGetLowLevelILForInstruction(
 		break;
 	}
 
-	if (intrin_id != (NeonIntrinsic)ARM64_INTRIN_INVALID)
-		il.AddInstruction(il.Intrinsic(outputs, intrin_id, inputs));
+	if (intrin_id == (NeonIntrinsic)ARM64_INTRIN_INVALID)
+		return false;
 
+	il.AddInstruction(il.Intrinsic(outputs, intrin_id, inputs));
 	return true;
 }
@@ -3989,5 +3989,6 @@ enum NeonIntrinsic : uint32_t
 string NeonGetIntrinsicName(uint32_t intrinsic);
 vector<NameAndType> NeonGetIntrinsicInputs(uint32_t intrinsic);
 vector<Confidence<Ref<Type>>> NeonGetIntrinsicOutputs(uint32_t intrinsic);
+// Lifts instr as its NEON intrinsic; returns whether an instruction was added to il
 bool NeonGetLowLevelILForInstruction(
     Architecture* arch, uint64_t addr, LowLevelILFunction& il, Instruction& instr, size_t addrSize);
@@ -7,6 +7,7 @@
 #include <exception>
 
 #include "binaryninjaapi.h"
+#include "decodecache.h"
 #include "lowlevelilinstruction.h"
 #include "arch_armv7.h"
 #include "il.h"
@@ -673,12 +674,11 @@ protected:
 
 	virtual bool Disassemble(const uint8_t* data, uint64_t addr, size_t maxLen, Instruction& result)
 	{
-		(void)addr;
 		(void)maxLen;
-		memset(&result, 0, sizeof(result));
-		if (armv7_decompose(*(uint32_t*)data, &result, (uint32_t)addr, (uint32_t)(m_endian == BigEndian)) != 0)
-			return false;
-		return true;
+		return DecodeCache<Instruction, 4>::Lookup(this, addr, 0, data, 4, result, [&](Instruction& instr) {
+			memset(&instr, 0, sizeof(instr));
+			return armv7_decompose(*(uint32_t*)data, &instr, (uint32_t)addr, (uint32_t)(m_endian == BigEndian)) == 0;
+		});
 	}
 
 	void SetInstructionInfoForInstruction(uint64_t addr, const Instruction& instr, InstructionInfo& result)
@@ -42,6 +42,8 @@ uint32_t armv7_two_register_scalar(uint32_t instructionValue, Instruction* restr
 uint32_t armv7_unconditional(uint32_t instructionValue, Instruction* restrict instruction, uint32_t address);
 typedef uint32_t (*armv7_decompose_instruction)(uint32_t instructionValue, Instruction* restrict instruction, uint32_t address);
 
+#include "armv7_dispatch.h"
+
 static Register regMap[2] = {REG_D0, REG_Q0};
 
 
@@ -1022,29 +1024,11 @@ uint32_t armv7_decompose(uint32_t instructionValue,
 	else
 		decode.value = instructionValue;
 
-	//Decompose the instructionValue into its various groups
-	static armv7_decompose_instruction group[2][8][2] = {
-		{
-			{armv7_data_processing_and_misc, armv7_data_processing_and_misc},
-			{armv7_data_processing_and_misc, armv7_data_processing_and_misc},
-			{armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte},
-			{armv7_load_store_word_and_unsigned_byte, armv7_media_instructions},
-			{armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer},
-			{armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer},
-			{armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call},
-			{armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call}
-		},{
-			{armv7_unconditional, armv7_unconditional},
-			{armv7_unconditional, armv7_unconditional},
-			{armv7_unconditional, armv7_unconditional},
-			{armv7_unconditional, armv7_unconditional},
-			{armv7_unconditional, armv7_unconditional},
-			{armv7_unconditional, armv7_unconditional},
-			{armv7_unconditional, armv7_unconditional},
-			{armv7_unconditional, armv7_unconditional},
-		}
-	};
-	return group[decode.cond == 15][decode.op1][decode.op](decode.value, instruction, address);
+	if (decode.cond == 15)
+		return armv7_unconditional(decode.value, instruction, address);
+
+	// Skips the group decoders of A5.1 and A5.2, see gen_dispatch.py
+	return armv7_dispatch[ARMV7_DISPATCH_INDEX(decode.value)](decode.value, instruction, address);
 }
 
 uint32_t armv7_data_processing_and_misc(uint32_t instructionValue, Instruction* restrict instruction, uint32_t address)
@@ -0,0 +1,1030 @@
+/* Generated by gen_dispatch.py, do not edit */
+
+#define ARMV7_DISPATCH_INDEX(x) ((((x) >> 16) & 0xff0) | (((x) >> 4) & 0xf))
+
+static const armv7_decompose_instruction armv7_dispatch[4096] = {
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_multiply_and_accumulate, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_multiply_and_accumulate, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_multiply_and_accumulate, armv7_data_processing_reg, armv7_extra_load_store_unprivilaged,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_multiply_and_accumulate, armv7_data_processing_reg, armv7_extra_load_store_unprivilaged,
+	armv7_data_processing_reg, armv7_extra_load_store_unprivilaged, armv7_data_processing_reg, armv7_extra_load_store_unprivilaged,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_multiply_and_accumulate, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_multiply_and_accumulate, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_multiply_and_accumulate, armv7_data_processing_reg, armv7_extra_load_store_unprivilaged,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_multiply_and_accumulate, armv7_data_processing_reg, armv7_extra_load_store_unprivilaged,
+	armv7_data_processing_reg, armv7_extra_load_store_unprivilaged, armv7_data_processing_reg, armv7_extra_load_store_unprivilaged,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_multiply_and_accumulate, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_multiply_and_accumulate, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_multiply_and_accumulate, armv7_data_processing_reg, armv7_extra_load_store_unprivilaged,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_multiply_and_accumulate, armv7_data_processing_reg, armv7_extra_load_store_unprivilaged,
+	armv7_data_processing_reg, armv7_extra_load_store_unprivilaged, armv7_data_processing_reg, armv7_extra_load_store_unprivilaged,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_multiply_and_accumulate, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_multiply_and_accumulate, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_multiply_and_accumulate, armv7_data_processing_reg, armv7_extra_load_store_unprivilaged,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_multiply_and_accumulate, armv7_data_processing_reg, armv7_extra_load_store_unprivilaged,
+	armv7_data_processing_reg, armv7_extra_load_store_unprivilaged, armv7_data_processing_reg, armv7_extra_load_store_unprivilaged,
+	armv7_miscellaneous, armv7_miscellaneous, armv7_miscellaneous, armv7_miscellaneous,
+	armv7_miscellaneous, armv7_miscellaneous, armv7_miscellaneous, armv7_miscellaneous,
+	armv7_halfword_multiply_and_accumulate, armv7_synchronization_primitives, armv7_halfword_multiply_and_accumulate, armv7_extra_load_store,
+	armv7_halfword_multiply_and_accumulate, armv7_extra_load_store, armv7_halfword_multiply_and_accumulate, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_synchronization_primitives, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_miscellaneous, armv7_miscellaneous, armv7_miscellaneous, armv7_miscellaneous,
+	armv7_miscellaneous, armv7_miscellaneous, armv7_miscellaneous, armv7_miscellaneous,
+	armv7_halfword_multiply_and_accumulate, armv7_synchronization_primitives, armv7_halfword_multiply_and_accumulate, armv7_extra_load_store,
+	armv7_halfword_multiply_and_accumulate, armv7_extra_load_store, armv7_halfword_multiply_and_accumulate, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_synchronization_primitives, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_miscellaneous, armv7_miscellaneous, armv7_miscellaneous, armv7_miscellaneous,
+	armv7_miscellaneous, armv7_miscellaneous, armv7_miscellaneous, armv7_miscellaneous,
+	armv7_halfword_multiply_and_accumulate, armv7_synchronization_primitives, armv7_halfword_multiply_and_accumulate, armv7_extra_load_store,
+	armv7_halfword_multiply_and_accumulate, armv7_extra_load_store, armv7_halfword_multiply_and_accumulate, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_synchronization_primitives, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_miscellaneous, armv7_miscellaneous, armv7_miscellaneous, armv7_miscellaneous,
+	armv7_miscellaneous, armv7_miscellaneous, armv7_miscellaneous, armv7_miscellaneous,
+	armv7_halfword_multiply_and_accumulate, armv7_synchronization_primitives, armv7_halfword_multiply_and_accumulate, armv7_extra_load_store,
+	armv7_halfword_multiply_and_accumulate, armv7_extra_load_store, armv7_halfword_multiply_and_accumulate, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_synchronization_primitives, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_synchronization_primitives, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_synchronization_primitives, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_synchronization_primitives, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_synchronization_primitives, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_synchronization_primitives, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_synchronization_primitives, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_synchronization_primitives, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg, armv7_data_processing_reg, armv7_data_processing_reg_shifted_reg,
+	armv7_data_processing_reg, armv7_synchronization_primitives, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_reg, armv7_extra_load_store, armv7_data_processing_reg, armv7_extra_load_store,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_and_misc, armv7_data_processing_and_misc, armv7_data_processing_and_misc, armv7_data_processing_and_misc,
+	armv7_data_processing_and_misc, armv7_data_processing_and_misc, armv7_data_processing_and_misc, armv7_data_processing_and_misc,
+	armv7_data_processing_and_misc, armv7_data_processing_and_misc, armv7_data_processing_and_misc, armv7_data_processing_and_misc,
+	armv7_data_processing_and_misc, armv7_data_processing_and_misc, armv7_data_processing_and_misc, armv7_data_processing_and_misc,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_msr_imm_and_hints, armv7_msr_imm_and_hints, armv7_msr_imm_and_hints, armv7_msr_imm_and_hints,
+	armv7_msr_imm_and_hints, armv7_msr_imm_and_hints, armv7_msr_imm_and_hints, armv7_msr_imm_and_hints,
+	armv7_msr_imm_and_hints, armv7_msr_imm_and_hints, armv7_msr_imm_and_hints, armv7_msr_imm_and_hints,
+	armv7_msr_imm_and_hints, armv7_msr_imm_and_hints, armv7_msr_imm_and_hints, armv7_msr_imm_and_hints,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_and_misc, armv7_data_processing_and_misc, armv7_data_processing_and_misc, armv7_data_processing_and_misc,
+	armv7_data_processing_and_misc, armv7_data_processing_and_misc, armv7_data_processing_and_misc, armv7_data_processing_and_misc,
+	armv7_data_processing_and_misc, armv7_data_processing_and_misc, armv7_data_processing_and_misc, armv7_data_processing_and_misc,
+	armv7_data_processing_and_misc, armv7_data_processing_and_misc, armv7_data_processing_and_misc, armv7_data_processing_and_misc,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_msr_imm_and_hints, armv7_msr_imm_and_hints, armv7_msr_imm_and_hints, armv7_msr_imm_and_hints,
+	armv7_msr_imm_and_hints, armv7_msr_imm_and_hints, armv7_msr_imm_and_hints, armv7_msr_imm_and_hints,
+	armv7_msr_imm_and_hints, armv7_msr_imm_and_hints, armv7_msr_imm_and_hints, armv7_msr_imm_and_hints,
+	armv7_msr_imm_and_hints, armv7_msr_imm_and_hints, armv7_msr_imm_and_hints, armv7_msr_imm_and_hints,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm, armv7_data_processing_imm,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte, armv7_load_store_word_and_unsigned_byte,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_load_store_word_and_unsigned_byte, armv7_media_instructions, armv7_load_store_word_and_unsigned_byte, armv7_media_instructions,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer, armv7_branch_and_block_data_transfer,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+	armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call, armv7_coprocessor_instruction_and_supervisor_call,
+};
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+
+# Generates armv7_dispatch.h, the table armv7_decompose uses to go straight to the decoder of an instruction:
+#   python3 gen_dispatch.py > armv7_dispatch.h
+#
+# The table is indexed by bits 27:20 and 7:4 of a conditional instruction, which are all of the bits the
+# group decoders of A5.1 and A5.2 look at before handing the instruction to a leaf decoder. Entries that A5.2
+# decodes itself (MOVW, MOVT and the undefined encodings) still point at armv7_data_processing_and_misc.
+# classify() has to follow the checks in armv7.c, so change both together.
+
+
+def data_processing_and_misc(op, op1, op2):
+	"""A5.2 Data-processing and miscellaneous instructions"""
+	if op == 1:
+		if (op1 & 0x19) != 0x10:
+			return "armv7_data_processing_imm"
+		if op1 in (0x12, 0x16):
+			return "armv7_msr_imm_and_hints"
+		return "armv7_data_processing_and_misc"
+
+	if (op1 & 0x19) == 0x10:
+		if (op2 & 8) == 0:
+			return "armv7_miscellaneous"
+		if (op2 & 9) == 8:
+			return "armv7_halfword_multiply_and_accumulate"
+	else:
+		if (op2 & 1) == 0:
+			return "armv7_data_processing_reg"
+		if (op2 & 9) == 1:
+			return "armv7_data_processing_reg_shifted_reg"
+
+	if (op1 & 0x10) == 0 and op2 == 9:
+		return "armv7_multiply_and_accumulate"
+	if (op1 & 0x10) == 0x10 and op2 == 9:
+		return "armv7_synchronization_primitives"
+
+	if (op1 & 0x12) == 2:
+		if op2 == 11:
+			return "armv7_extra_load_store_unprivilaged"
+	elif op2 == 11 or (op2 & 13) == 13:
+		return "armv7_extra_load_store"
+
+	if (op1 & 0x13) == 2 and (op2 & 13) == 13:
+		return "armv7_extra_load_store"
+	if (op1 & 0x13) == 3 and (op2 & 13) == 13:
+		return "armv7_extra_load_store_unprivilaged"
+	return "armv7_data_processing_and_misc"
+
+
+def classify(index):
+	"""A5.1 ARM instruction set encoding, for index = bits 27:20 << 4 | bits 7:4"""
+	bits27_20 = index >> 4
+	bits7_4 = index & 15
+	group = bits27_20 >> 5
+	if group < 2:
+		return data_processing_and_misc(group, bits27_20 & 0x1f, bits7_4)
+	if group == 2 or (group == 3 and (bits7_4 & 1) == 0):
+		return "armv7_load_store_word_and_unsigned_byte"
+	if group == 3:
+		return "armv7_media_instructions"
+	if group < 6:
+		return "armv7_branch_and_block_data_transfer"
+	return "armv7_coprocessor_instruction_and_supervisor_call"
+
+
+def main():
+	print("/* Generated by gen_dispatch.py, do not edit */")
+	print("")
+	print("#define ARMV7_DISPATCH_INDEX(x) ((((x) >> 16) & 0xff0) | (((x) >> 4) & 0xf))")
+	print("")
+	print("static const armv7_decompose_instruction armv7_dispatch[4096] = {")
+	for row in range(0, 4096, 4):
+		print("\t" + " ".join(classify(i) + "," for i in range(row, row + 4)))
+	print("};")
+
+
+if __name__ == "__main__":
+	main()
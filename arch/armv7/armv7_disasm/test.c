@@ -3,14 +3,62 @@
 // b armv7_decompose
 // b armv7_disassemble
 //
+// Decode throughput over a raw ARM32 image, eg. the .text of a firmware dump:
+// gcc -O2 test.c armv7.c -o test
+// ./test -bench firmware.bin [passes]
 
 #include <stdio.h>
 #include <stdio.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 #include "armv7.h"
 
+static int bench(const char* path, int passes)
+{
+	FILE* f = fopen(path, "rb");
+	if (!f) {
+		printf("ERROR: can't open %s\n", path);
+		return -1;
+	}
+	fseek(f, 0, SEEK_END);
+	long size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	size_t count = size / 4;
+	uint32_t* words = malloc(count * 4 + 1);
+	if (!words || fread(words, 4, count, f) != count) {
+		printf("ERROR: can't read %s\n", path);
+		fclose(f);
+		free(words);
+		return -1;
+	}
+	fclose(f);
+
+	Instruction instr;
+	size_t valid = 0;
+	clock_t start = clock();
+	for (int pass = 0; pass < passes; pass++) {
+		for (size_t i = 0; i < count; i++) {
+			memset(&instr, 0, sizeof(instr));
+			if (armv7_decompose(words[i], &instr, (uint32_t)(i * 4), 0) == 0)
+				valid++;
+		}
+	}
+	double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	free(words);
+
+	double total = (double)count * passes;
+	printf("%zu words x %d passes, %.1f%% valid: %.3fs, %.1f M instructions/s\n", count, passes,
+	    total ? 100.0 * valid / total : 0.0, seconds, seconds > 0 ? total / seconds / 1e6 : 0.0);
+	return 0;
+}
+
 int main(int ac, char **av)
 {
+	if (ac > 2 && !strcmp(av[1], "-bench"))
+		return bench(av[2], ac > 3 ? atoi(av[3]) : 10);
+
 	uint32_t insword = strtoul(av[1], NULL, 16);
 	uint32_t address = 0;
 	uint32_t endian = 0;
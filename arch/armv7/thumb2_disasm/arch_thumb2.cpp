@@ -5,6 +5,7 @@
 #include <string.h>
 
 #include "binaryninjaapi.h"
+#include "decodecache.h"
 
 // registers, etc.
 #include "arch_armv7.h"
@@ -58,6 +59,21 @@ protected:
 		req->addr = (uint32_t)addr;
 	}
 
+	/* the core asks for the info, text and IL of each instruction separately, so
+	   reuse the last decode of the same request instead of walking the decoder again */
+	int Decompose(decomp_request *req, decomp_result *res)
+	{
+		uint8_t words[8] = {0};
+		memcpy(words, &req->instr_word32, sizeof(req->instr_word32));
+		memcpy(words + 4, &req->instr_word16, sizeof(req->instr_word16));
+		uint64_t context = req->arch | (req->instrSet << 8) | (req->inIfThen << 16) |
+			(req->inIfThenLast << 24) | ((uint64_t)req->carry_in << 32);
+
+		bool ok = DecodeCache<decomp_result, 8>::Lookup(this, req->addr, context, words, sizeof(words), *res,
+			[&](decomp_result& decomp) { return thumb_decompose(req, &decomp) == STATUS_OK; });
+		return ok ? STATUS_OK : -1;
+	}
+
 	virtual bool Disassemble(const uint8_t* data, uint64_t addr, size_t maxLen, decomp_result& result)
 	{
 		(void)addr;
@@ -66,7 +82,7 @@ protected:
 		populateDecomposeRequest(&request, data, maxLen, addr, IFTHEN_UNKNOWN, IFTHENLAST_UNKNOWN);
 
 		memset(&result, 0, sizeof(result));
-		if (thumb_decompose(&request, &result) != STATUS_OK)
+		if (Decompose(&request, &result) != STATUS_OK)
 			return false;
 		return true;
 	}
@@ -112,7 +128,7 @@ public:
 
 		populateDecomposeRequest(&request, data, maxLen, addr, IFTHEN_UNKNOWN, IFTHENLAST_UNKNOWN);
 
-		if (thumb_decompose(&request, &decomp) != STATUS_OK)
+		if (Decompose(&request, &decomp) != STATUS_OK)
 			return false;
 		if ((decomp.instrSize / 8) > maxLen)
 			return false;
@@ -284,7 +300,7 @@ public:
 
 		populateDecomposeRequest(&request, data, len, addr, IFTHEN_UNKNOWN, IFTHENLAST_UNKNOWN);
 
-		if (thumb_decompose(&request, &decomp) != STATUS_OK)
+		if (Decompose(&request, &decomp) != STATUS_OK)
 			return false;
 
 		if (decomp.status & STATUS_UNDEFINED) {
@@ -1464,7 +1480,7 @@ public:
 
 		populateDecomposeRequest(&request, data, len, addr, IFTHEN_NO, IFTHENLAST_NO);
 
-		if (thumb_decompose(&request, &decomp) != STATUS_OK)
+		if (Decompose(&request, &decomp) != STATUS_OK)
 			return false;
 		if ((decomp.instrSize / 8) > len)
 			return false;
@@ -1500,7 +1516,7 @@ public:
 				populateDecomposeRequest(&request, data+offset, len-offset, addr+offset,
 					IFTHEN_YES, ((i + 1) >= instrCount) ? IFTHENLAST_YES : IFTHENLAST_NO);
 
-				if (thumb_decompose(&request, &decomp) != STATUS_OK)
+				if (Decompose(&request, &decomp) != STATUS_OK)
 					return false;
 				if ((offset + (decomp.instrSize / 8)) > len)
 					return false;
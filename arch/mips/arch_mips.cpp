@@ -6,6 +6,7 @@
 #include <string.h>
 
 #include "binaryninjaapi.h"
+#include "decodecache.h"
 #include "lowlevelilinstruction.h"
 #include "mips.h"
 #include "il.h"
@@ -185,10 +186,13 @@ protected:
 
 	virtual bool Disassemble(const uint8_t* data, uint64_t addr, size_t maxLen, Instruction& result)
 	{
-		memset(&result, 0, sizeof(result));
-		if (mips_decompose((uint32_t*)data, maxLen,  &result, m_bits == 64 ? MIPS_64 : MIPS_32, addr, m_endian, m_decomposeFlags) != 0)
-			return false;
-		return true;
+		// The decoder looks at the following word too, for pseudo-ops
+		return DecodeCache<Instruction, 8>::Lookup(this, addr, m_decomposeFlags, data, maxLen, result,
+			[&](Instruction& instr) {
+				memset(&instr, 0, sizeof(instr));
+				return mips_decompose((uint32_t*)data, maxLen, &instr, m_bits == 64 ? MIPS_64 : MIPS_32, addr, m_endian,
+					m_decomposeFlags) == 0;
+			});
 	}
 
 	virtual size_t GetAddressSize() const override
@@ -300,6 +304,32 @@ protected:
 		}
 	}
 
+	struct DecodedPair
+	{
+		Instruction instr;
+		Instruction delaySlot;
+		bool delaySlotDecoded;
+	};
+
+	// Decodes a branch together with its delay slot, so lifting the branch only needs one cache lookup and
+	// the delay slot's own info and text requests find it already decoded
+	bool DisassembleWithDelaySlot(const uint8_t* data, uint64_t addr, size_t maxLen, DecodedPair& result)
+	{
+		// The delay slot's pseudo-op lookahead reads the word after it
+		return DecodeCache<DecodedPair, 12, 512>::Lookup(this, addr, m_decomposeFlags, data, maxLen, result,
+			[&](DecodedPair& pair) {
+				pair.delaySlotDecoded = false;
+				if (!Disassemble(data, addr, maxLen, pair.instr))
+					return false;
+				if (InstructionHasBranchDelay(pair.instr) && maxLen >= pair.instr.size + 4)
+				{
+					pair.delaySlotDecoded = Disassemble(data + pair.instr.size, addr + pair.instr.size,
+						maxLen - pair.instr.size, pair.delaySlot);
+				}
+				return true;
+			});
+	}
+
 	void SetInstructionInfoForInstruction(uint64_t addr, const Instruction& instr, InstructionInfo& result)
 	{
 		result.length = 4;
@@ -492,12 +522,14 @@ public:
 
 	virtual bool GetInstructionLowLevelIL(const uint8_t* data, uint64_t addr, size_t& len, LowLevelILFunction& il) override
 	{
-		Instruction instr, secondInstr;
-		if (!Disassemble(data, addr, len, instr))
+		DecodedPair pair;
+		if (!DisassembleWithDelaySlot(data, addr, len, pair))
 		{
 			il.AddInstruction(il.Undefined());
 			return false;
 		}
+		Instruction& instr = pair.instr;
+		Instruction& secondInstr = pair.delaySlot;
 
 		if (InstructionHasBranchDelay(instr) == 1)
 		{
@@ -507,7 +539,7 @@ public:
 				return false;
 			}
 
-			if (!Disassemble(data + instr.size, addr + instr.size, len - instr.size, secondInstr))
+			if (!pair.delaySlotDecoded)
 			{
 				il.AddInstruction(il.Undefined());
 				return false;
@@ -14,7 +14,9 @@
 
 /* c++ stuff */
 #include <map>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 using namespace std;
 
@@ -2162,10 +2164,11 @@ const char *cs_err_to_string(cs_err e)
 int disasm_capstone(uint8_t *data, uint32_t addr, string& result, string& err)
 {
 	int rc = -1;
-	static bool init = false;
+	/* per thread, since a capstone handle can't be used by two threads at once */
+	static thread_local bool init = false;
 
 	/* capstone vars */
-	static csh handle;
+	static thread_local csh handle;
 	cs_insn *insn = NULL;
 	size_t count = 0;
 
@@ -2785,12 +2788,13 @@ int assemble_single(string src, uint32_t addr, uint8_t *result, string& err,
 
 	MYLOG("src:%s has signature:%s\n", src.c_str(), sig_src.c_str());
 
-	if(lookup.find(sig_src) == lookup.end()) {
+	auto found = lookup.find(sig_src);
+	if(found == lookup.end()) {
 		err = "invalid syntax in " + sig_src;
 		return -1;
 	}
 
-	auto info = lookup[sig_src];
+	auto info = found->second;
 	uint32_t vary_mask = info.mask;
 
 	/* for relative branches, shift the target address to 0 */
@@ -2800,6 +2804,35 @@ int assemble_single(string src, uint32_t addr, uint8_t *result, string& err,
 		addr = 0;
 	}
 
+	/* unconditional branches have a single operand field, encode them directly instead of searching */
+	if((sig_src == "b NUM" || sig_src == "bl NUM" || sig_src == "ba NUM" || sig_src == "bla NUM") &&
+	  !(toks_src[1].ival & 3) && ((int32_t)toks_src[1].ival >= -0x2000000 && (int32_t)toks_src[1].ival < 0x2000000)) {
+		uint32_t insword = info.seed | (toks_src[1].ival & 0x03FFFFFC);
+		memcpy(result, &insword, 4);
+		failures = 0;
+		return 0;
+	}
+
+	/* with branch targets made relative, the encoding only depends on the tokens, so an instruction that was
+	   already searched for (and patches repeat the same few a lot) is looked up instead of searched again */
+	string cache_key = sig_src;
+	for(auto& tok : toks_src) {
+		char buf[16];
+		snprintf(buf, sizeof(buf), ":%X", tok.ival);
+		cache_key += buf + tok.sval;
+	}
+	static mutex cache_mutex;
+	static unordered_map<string, uint32_t> cache;
+	{
+		lock_guard<mutex> lock(cache_mutex);
+		auto cached = cache.find(cache_key);
+		if(cached != cache.end()) {
+			memcpy(result, &cached->second, 4);
+			failures = 0;
+			return 0;
+		}
+	}
+
 	/* start with the parent */
 	uint32_t parent = info.seed;
 	float init_score, top_score;
@@ -2826,6 +2859,8 @@ int assemble_single(string src, uint32_t addr, uint8_t *result, string& err,
 		if(top_score > 99.99) {
 			MYLOG("%08X wins!\n", parent);
 			memcpy(result, &parent, 4);
+			lock_guard<mutex> lock(cache_mutex);
+			cache[cache_key] = parent;
 			break;
 		}
 
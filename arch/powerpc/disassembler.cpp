@@ -19,6 +19,11 @@ architecture plugin picture.
 thread_local csh handle_lil = 0;
 thread_local csh handle_big = 0;
 
+/* instruction buffers for cs_disasm_iter(), allocated once per handle so that
+	decoding doesn't hit the heap for every instruction */
+thread_local cs_insn *insn_lil = 0;
+thread_local cs_insn *insn_big = 0;
+
 int DoesQualifyForLocalDisassembly(const uint8_t *data, bool bigendian)
 {
 	uint32_t insword = *(uint32_t *)data;
@@ -188,6 +193,14 @@ powerpc_init(int cs_mode_arg)
 	cs_option(handle_big, CS_OPT_DETAIL, CS_OPT_ON);
 	cs_option(handle_lil, CS_OPT_DETAIL, CS_OPT_ON);
 
+	/* must come after CS_OPT_DETAIL so the detail struct is allocated too */
+	insn_big = cs_malloc(handle_big);
+	insn_lil = cs_malloc(handle_lil);
+	if(!insn_big || !insn_lil) {
+		MYLOG("ERROR: cs_malloc()\n");
+		goto cleanup;
+	}
+
 	rc = 0;
 	cleanup:
 	if(rc) {
@@ -200,6 +213,16 @@ powerpc_init(int cs_mode_arg)
 extern "C" void
 powerpc_release(void)
 {
+	if(insn_lil) {
+		cs_free(insn_lil, 1);
+		insn_lil = 0;
+	}
+
+	if(insn_big) {
+		cs_free(insn_big, 1);
+		insn_big = 0;
+	}
+
 	if(handle_lil) {
 		cs_close(&handle_lil);
 		handle_lil = 0;
@@ -265,23 +288,34 @@ powerpc_decompose(const uint8_t *data, int size, uint64_t addr, bool lil_end,
 
 	csh handle;
 	struct cs_struct *hand_tmp = 0;
-	cs_insn *insn = 0; /* instruction information
-					cs_disasm() will allocate array of cs_insn here */
+	cs_insn *insn = 0; /* instruction information, preallocated per handle */
+	const uint8_t *code = data;
+	size_t code_size = size;
+	uint64_t code_addr = addr;
+
+	if(!insn_lil) {
+		MYLOG("ERROR: not initialized\n");
+		return rc;
+	}
 
 	/* which handle to use?
 		BIG end or LITTLE end? */
 	handle = handle_big;
-	if(lil_end) handle = handle_lil;
+	insn = insn_big;
+	if(lil_end) {
+		handle = handle_lil;
+		insn = insn_lil;
+	}
 	res->handle = handle;
 
 	hand_tmp = (struct cs_struct *)handle;
-	hand_tmp->mode = (cs_mode)((int)hand_tmp->mode | cs_mode_arg);
+	if(((int)hand_tmp->mode | cs_mode_arg) != (int)hand_tmp->mode)
+		hand_tmp->mode = (cs_mode)((int)hand_tmp->mode | cs_mode_arg);
 
 	/* call */
-	size_t n = cs_disasm(handle, data, size, addr, 1, &insn);
-	if(n != 1) {
-		MYLOG("ERROR: cs_disasm() returned %" PRIdPTR " (cs_errno:%d)\n", n, cs_errno(handle));
-		goto cleanup;
+	if(!cs_disasm_iter(handle, &code, &code_size, &code_addr, insn)) {
+		MYLOG("ERROR: cs_disasm_iter() failed (cs_errno:%d)\n", cs_errno(handle));
+		return rc;
 	}
 
 	/* set the status */
@@ -291,13 +325,7 @@ powerpc_decompose(const uint8_t *data, int size, uint64_t addr, bool lil_end,
 	memcpy(&(res->insn), insn, sizeof(cs_insn));
 	memcpy(&(res->detail), insn->detail, sizeof(cs_detail));
 
-	rc = 0;
-	cleanup:
-	if(insn) {
-		cs_free(insn, 1);
-		insn = 0;
-	}
-	return rc;
+	return 0;
 }
 
 extern "C" int
@@ -0,0 +1,74 @@
+//! Measures the RISC-V plugin through the core, so it exercises whichever build of the plugin the core loads.
+//! Install the build being measured as described in the README before running.
+
+use binaryninja::architecture::{Architecture, CoreArchitecture};
+use binaryninja::headless::Session;
+use binaryninja::low_level_il::MutableLiftedILFunction;
+use criterion::{black_box, criterion_group, criterion_main, Criterion, Throughput};
+
+/// Deterministic instruction stream with a mix of standard and compressed encodings.
+fn corpus(count: usize) -> Vec<u8> {
+    let mut state = 0x9e3779b97f4a7c15u64;
+    let mut bytes = Vec::with_capacity(count * 4);
+    for _ in 0..count {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        let word = state as u32;
+        if word & 0x10 == 0 {
+            bytes.extend_from_slice(&(word | 0b11).to_le_bytes());
+        } else {
+            bytes.extend_from_slice(&((word as u16) & !0b11 | 0b01).to_le_bytes());
+        }
+    }
+    bytes
+}
+
+/// Walks `bytes` the way analysis does, calling `f` at the start of every instruction.
+fn for_each_addr(arch: &CoreArchitecture, bytes: &[u8], mut f: impl FnMut(u64, &[u8])) {
+    let mut offset = 0;
+    while offset + 4 <= bytes.len() {
+        let addr = 0x1000 + offset as u64;
+        let data = &bytes[offset..];
+        f(addr, data);
+        offset += arch
+            .instruction_info(data, addr)
+            .map_or(2, |info| info.length);
+    }
+}
+
+pub fn arch_benchmark(c: &mut Criterion) {
+    let _session = Session::new().expect("Failed to initialize session");
+    let arch = CoreArchitecture::by_name("rv64gc").expect("rv64gc architecture not loaded");
+    let bytes = corpus(0x4000);
+
+    let mut group = c.benchmark_group("rv64gc core");
+    group.throughput(Throughput::Bytes(bytes.len() as u64));
+
+    group.bench_function("info", |b| {
+        b.iter(|| for_each_addr(&arch, black_box(&bytes), |_, _| {}))
+    });
+
+    group.bench_function("info and text", |b| {
+        b.iter(|| {
+            for_each_addr(&arch, black_box(&bytes), |addr, data| {
+                black_box(arch.instruction_text(data, addr));
+            })
+        })
+    });
+
+    group.bench_function("info, text and lift", |b| {
+        b.iter(|| {
+            let mut il = MutableLiftedILFunction::new(arch, None);
+            for_each_addr(&arch, black_box(&bytes), |addr, data| {
+                black_box(arch.instruction_text(data, addr));
+                black_box(arch.instruction_llil(data, addr, &mut *il));
+            });
+        })
+    });
+
+    group.finish();
+}
+
+criterion_group!(benches, arch_benchmark);
+criterion_main!(benches);
@@ -0,0 +1,65 @@
+use criterion::{black_box, criterion_group, criterion_main, Criterion, Throughput};
+use riscv_dis::{Instr, RiscVDisassembler, RiscVIMACDisassembler, Rv64GRegs};
+
+type Rv64Disassembler = RiscVIMACDisassembler<Rv64GRegs>;
+
+/// Deterministic instruction stream with a mix of standard and compressed encodings.
+fn corpus(count: usize) -> Vec<u8> {
+    let mut state = 0x9e3779b97f4a7c15u64;
+    let mut bytes = Vec::with_capacity(count * 4);
+    for _ in 0..count {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        let word = state as u32;
+        if word & 0x10 == 0 {
+            // Low bits 0b11 select a 32-bit encoding
+            bytes.extend_from_slice(&(word | 0b11).to_le_bytes());
+        } else {
+            bytes.extend_from_slice(&((word as u16) & !0b11 | 0b01).to_le_bytes());
+        }
+    }
+    bytes
+}
+
+/// Calls `f` for every instruction in `bytes`, skipping 2 bytes past undecodable ones.
+fn for_each_instr(bytes: &[u8], mut f: impl FnMut(u64, &Instr<Rv64Disassembler>)) {
+    let mut offset = 0;
+    while offset + 4 <= bytes.len() {
+        let addr = 0x1000 + offset as u64;
+        offset += match Rv64Disassembler::decode(addr, &bytes[offset..]) {
+            Ok(instr) => {
+                f(addr, &instr);
+                match instr {
+                    Instr::Rv16(_) => 2,
+                    Instr::Rv32(_) => 4,
+                }
+            }
+            Err(_) => 2,
+        };
+    }
+}
+
+pub fn decode_benchmark(c: &mut Criterion) {
+    let bytes = corpus(0x10000);
+    let mut group = c.benchmark_group("rv64gc");
+    group.throughput(Throughput::Bytes(bytes.len() as u64));
+
+    group.bench_function("decode", |b| {
+        b.iter(|| for_each_instr(black_box(&bytes), |_, instr| {
+            black_box(instr);
+        }))
+    });
+
+    group.bench_function("format", |b| {
+        b.iter(|| for_each_instr(black_box(&bytes), |_, instr| {
+            black_box(format!("{}", instr.mnem()));
+            black_box(instr.operands());
+        }))
+    });
+
+    group.finish();
+}
+
+criterion_group!(benches, decode_benchmark);
+criterion_main!(benches);
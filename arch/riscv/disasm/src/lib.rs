@@ -1769,6 +1769,7 @@ impl Instr16 {
     }
 }
 
+#[derive(Copy, Clone, Debug)]
 pub enum Instr<D: RiscVDisassembler> {
     Rv16(Op<D>),
     Rv32(Op<D>),
@@ -33,6 +33,7 @@ use std::borrow::Cow;
 use std::fmt;
 use std::hash::Hash;
 use std::marker::PhantomData;
+use std::sync::Mutex;
 
 use binaryninja::architecture::{BranchKind, IntrinsicId, RegisterId};
 use binaryninja::confidence::{Conf, MAX_CONFIDENCE, MIN_CONFIDENCE};
@@ -47,7 +48,7 @@ use binaryninja::low_level_il::{
     MutableLiftedILExpr, MutableLiftedILFunction, RegularLowLevelILFunction,
 };
 use riscv_dis::{
-    FloatReg, FloatRegType, Instr, IntRegType, Op, RegFile, Register as RiscVRegister,
+    DisResult, FloatReg, FloatRegType, Instr, IntRegType, Op, RegFile, Register as RiscVRegister,
     RiscVDisassembler, RoundMode,
 };
 
@@ -636,9 +637,59 @@ impl<D: RiscVDisassembler> architecture::Intrinsic for RiscVIntrinsic<D> {
     }
 }
 
+/// Recently decoded instructions, shared by `instruction_info`, `instruction_text` and `instruction_llil`
+/// since the core asks for each of them separately at the same address. Slots are picked by address, and a
+/// slot another thread is using is skipped rather than waited on.
+struct DecodeCache<D: RiscVDisassembler> {
+    slots: Box<[Mutex<Option<DecodedInstr<D>>>]>,
+}
+
+struct DecodedInstr<D: RiscVDisassembler> {
+    addr: u64,
+    // The decoder never reads past the first 4 bytes
+    bytes: [u8; 4],
+    len: usize,
+    result: DisResult<Instr<D>>,
+}
+
+impl<D: RiscVDisassembler> DecodeCache<D> {
+    const SLOTS: usize = 1024;
+
+    fn new() -> Self {
+        Self {
+            slots: (0..Self::SLOTS).map(|_| Mutex::new(None)).collect(),
+        }
+    }
+
+    fn decode(&self, addr: u64, data: &[u8]) -> DisResult<Instr<D>> {
+        let len = data.len().min(4);
+        let mut bytes = [0u8; 4];
+        bytes[..len].copy_from_slice(&data[..len]);
+
+        let Ok(mut slot) = self.slots[(addr >> 1) as usize & (Self::SLOTS - 1)].try_lock() else {
+            return D::decode(addr, data);
+        };
+        if let Some(entry) = slot.as_ref() {
+            if entry.addr == addr && entry.len == len && entry.bytes == bytes {
+                return entry.result;
+            }
+        }
+
+        let result = D::decode(addr, data);
+        *slot = Some(DecodedInstr {
+            addr,
+            bytes,
+            len,
+            result,
+        });
+        result
+    }
+}
+
 struct RiscVArch<D: 'static + RiscVDisassembler + Send + Sync> {
     handle: CoreArchitecture,
     custom_handle: CustomArchitectureHandle<RiscVArch<D>>,
+    decode_cache: DecodeCache<D>,
     _dis: PhantomData<D>,
 }
 
@@ -692,7 +743,7 @@ impl<D: 'static + RiscVDisassembler + Send + Sync> architecture::Architecture fo
     }
 
     fn instruction_info(&self, data: &[u8], addr: u64) -> Option<InstructionInfo> {
-        let (inst_len, op) = match D::decode(addr, data) {
+        let (inst_len, op) = match self.decode_cache.decode(addr, data) {
             Ok(Instr::Rv16(op)) => (2, op),
             Ok(Instr::Rv32(op)) => (4, op),
             _ => return None,
@@ -757,7 +808,7 @@ impl<D: 'static + RiscVDisassembler + Send + Sync> architecture::Architecture fo
         use riscv_dis::Operand;
         use InstructionTextTokenKind::*;
 
-        let inst = match D::decode(addr, data) {
+        let inst = match self.decode_cache.decode(addr, data) {
             Ok(i) => i,
             _ => return None,
         };
@@ -1072,7 +1123,7 @@ impl<D: 'static + RiscVDisassembler + Send + Sync> architecture::Architecture fo
     ) -> Option<(usize, bool)> {
         let max_width = self.default_integer_size();
 
-        let (inst_len, op) = match D::decode(addr, data) {
+        let (inst_len, op) = match self.decode_cache.decode(addr, data) {
             Ok(Instr::Rv16(op)) => (2, op),
             Ok(Instr::Rv32(op)) => (4, op),
             _ => return None,
@@ -2964,6 +3015,7 @@ pub extern "C" fn CorePluginInit() -> bool {
         > {
             handle: core_arch,
             custom_handle,
+            decode_cache: DecodeCache::new(),
             _dis: PhantomData,
         });
     let arch64 =
@@ -2972,6 +3024,7 @@ pub extern "C" fn CorePluginInit() -> bool {
         > {
             handle: core_arch,
             custom_handle,
+            decode_cache: DecodeCache::new(),
             _dis: PhantomData,
         });
 
@@ -1,9 +1,13 @@
 #define _CRT_SECURE_NO_WARNINGS
+#include <ctype.h>
 #include <inttypes.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sstream>
+#include <mutex>
 #include "binaryninjaapi.h"
+#include "decodecache.h"
 #include "il.h"
 extern "C" {
     #include "xed-interface.h"
@@ -413,21 +417,26 @@ static const char* GetRelocationString(Machox64RelocationType relocType)
 
 bool X86CommonArchitecture::Decode(const uint8_t* data, size_t len, xed_decoded_inst_t* xedd)
 {
-	// Zero out structure data, and keep the current destructuring mode (32/64/etc)
-	xed_decoded_inst_zero_keep_mode(xedd);
-
-	xed3_operand_set_cet(xedd, 1);
-	xed3_operand_set_mpxmode(xedd, 1);
-
-	// Decode the data and check for errors
-	xed_error_enum_t xed_error = xed_decode(xedd, data, (unsigned)len);
-	switch(xed_error)
-	{
-	case XED_ERROR_NONE:
-		return true;
-	default:
-		return false;
-	}
+	// The decode doesn't depend on the address, and the mode is fixed per architecture
+	bool decoded = DecodeCache<xed_decoded_inst_t, XED_MAX_INSTRUCTION_BYTES>::Lookup(this, 0, 0, data, len, *xedd,
+		[&](xed_decoded_inst_t& inst) {
+			// The tables are only built once something is decoded, a cache hit means this already happened
+			static std::once_flag tablesInitialized;
+			std::call_once(tablesInitialized, xed_tables_init);
+
+			// Zero out structure data, and keep the current destructuring mode (32/64/etc)
+			xed_decoded_inst_zero_keep_mode(&inst);
+
+			xed3_operand_set_cet(&inst, 1);
+			xed3_operand_set_mpxmode(&inst, 1);
+
+			// Decode the data and check for errors
+			return xed_decode(&inst, data, (unsigned)len) == XED_ERROR_NONE;
+		});
+
+	// A cached decode still points at the bytes it was decoded from
+	xedd->_byte_array._dec = data;
+	return decoded;
 }
 
 size_t X86CommonArchitecture::GetAddressSizeBits()  const
@@ -545,6 +554,73 @@ BNRegisterInfo X86CommonArchitecture::RegisterInfo(xed_reg_enum_t fullWidthReg,
 	return result;
 }
 
+// Register and mnemonic spellings for every flavor and case, built once from XED's name tables so that
+// rendering an instruction doesn't have to format and case convert each name again
+struct X86TokenNameTables
+{
+	// Indexed by [AT&T prefix][lower case][register]; x87 stack registers are spelled ST0-ST7
+	vector<string> registers[2][2];
+	// Indexed by [lower case][iform] for Intel and AT&T, and [lower case][iclass] for XED
+	vector<string> intelMnemonics[2];
+	vector<string> attMnemonics[2];
+	vector<string> xedMnemonics[2];
+
+	static string ToCase(string str, bool lowerCase)
+	{
+		for (char& c : str)
+			c = lowerCase ? tolower(c) : toupper(c);
+		return str;
+	}
+
+	X86TokenNameTables()
+	{
+		for (size_t lowerCase = 0; lowerCase < 2; lowerCase++)
+		{
+			for (size_t att = 0; att < 2; att++)
+			{
+				registers[att][lowerCase].reserve(XED_REG_LAST);
+				for (uint32_t reg = 0; reg < XED_REG_LAST; reg++)
+				{
+					string name = att ? "%" : "";
+					if ((reg >= XED_REG_X87_FIRST) && (reg <= XED_REG_X87_LAST))
+						name += "ST" + to_string(reg - XED_REG_X87_FIRST);
+					else
+						name += xed_reg_enum_t2str((xed_reg_enum_t)reg);
+					// Register names keep XED's case unless lower case was asked for
+					if (lowerCase)
+						name = ToCase(name, true);
+					registers[att][lowerCase].push_back(std::move(name));
+				}
+			}
+
+			intelMnemonics[lowerCase].reserve(XED_IFORM_LAST);
+			attMnemonics[lowerCase].reserve(XED_IFORM_LAST);
+			for (uint32_t iform = 0; iform < XED_IFORM_LAST; iform++)
+			{
+				intelMnemonics[lowerCase].push_back(
+					ToCase(xed_iform_to_iclass_string_intel((xed_iform_enum_t)iform), lowerCase));
+				attMnemonics[lowerCase].push_back(
+					ToCase(xed_iform_to_iclass_string_att((xed_iform_enum_t)iform), lowerCase));
+			}
+
+			xedMnemonics[lowerCase].reserve(XED_ICLASS_LAST);
+			for (uint32_t iclass = 0; iclass < XED_ICLASS_LAST; iclass++)
+				xedMnemonics[lowerCase].push_back(ToCase(xed_iclass_enum_t2str((xed_iclass_enum_t)iclass), lowerCase));
+		}
+	}
+};
+
+static const X86TokenNameTables& GetTokenNameTables()
+{
+	static const X86TokenNameTables tables;
+	return tables;
+}
+
+static const string& GetRegisterText(xed_reg_enum_t reg, bool lowerCase, bool att = false)
+{
+	return GetTokenNameTables().registers[att][lowerCase][(reg < XED_REG_LAST) ? reg : XED_REG_INVALID];
+}
+
 void X86CommonArchitecture::GetAddressSizeToken(const short bytes, vector<InstructionTextToken>& result, const bool lowerCase)
 {
 	// Size
@@ -627,10 +703,14 @@ unsigned short X86CommonArchitecture::GetInstructionOpcode(const xed_decoded_ins
 	else if (xed_operand_values_branch_taken_hint(ov))
 		opcode += "HINT-TAKEN ";
 
+	const X86TokenNameTables& names = GetTokenNameTables();
+	const bool lowerCase = m_disassembly_options.lowerCase;
+	const xed_iform_enum_t iform = xed_decoded_inst_get_iform_enum(xedd);
+	const string* mnemonic = nullptr;
 	switch (m_disassembly_options.df)
 	{
 	case DF_INTEL:
-		opcode += string(xed_iform_to_iclass_string_intel(xed_decoded_inst_get_iform_enum(xedd)));
+		mnemonic = &names.intelMnemonics[lowerCase][iform];
 		break;
 	case DF_BN_INTEL:
 		// To match asmx86 disassembly
@@ -715,20 +795,29 @@ unsigned short X86CommonArchitecture::GetInstructionOpcode(const xed_decoded_ins
 			break;
 
 		default:
-			opcode += string(xed_iform_to_iclass_string_intel(xed_decoded_inst_get_iform_enum(xedd)));
+			mnemonic = &names.intelMnemonics[lowerCase][iform];
 		}
 		break;
 	case DF_ATT:
-		opcode += string(xed_iform_to_iclass_string_att(xed_decoded_inst_get_iform_enum(xedd)));
+		mnemonic = &names.attMnemonics[lowerCase][iform];
 		break;
 	case DF_XED:
-		opcode += string(xed_iclass_enum_t2str(xed_decoded_inst_get_iclass(xedd)));
+		mnemonic = &names.xedMnemonics[lowerCase][xed_decoded_inst_get_iclass(xedd)];
 		break;
 	default:
 		LogError("Invalid Disassembly Flavor");
 	}
 
-	if (m_disassembly_options.lowerCase)
+	// Without prefixes or a renamed mnemonic the table entry is already the finished token
+	if (mnemonic && opcode.empty())
+	{
+		result.emplace_back(InstructionToken, *mnemonic);
+		return (unsigned short)mnemonic->length();
+	}
+	if (mnemonic)
+		opcode += *mnemonic;
+
+	if (lowerCase)
 		for (char& c : opcode)
 			c = tolower(c);
 	else
@@ -785,22 +874,8 @@ void X86CommonArchitecture::GetOperandTextIntel(const xed_decoded_inst_t* const
 		case XED_OPERAND_REG7:
 		case XED_OPERAND_REG8:
 		{
-			string reg = "";
-
 			const xed_reg_enum_t xedReg = xed_decoded_inst_get_reg(xedd, op_name);
-			if ((xedReg >= XED_REG_X87_FIRST) && (xedReg <=  XED_REG_X87_LAST))
-			{
-				reg += "ST";
-				reg += ('0' + (xedReg-XED_REG_X87_FIRST));
-			}
-			else
-			{
-				reg += xed_reg_enum_t2str(xedReg);
-			}
-			if (m_disassembly_options.lowerCase)
-				for (char& c : reg)
-					c = tolower(c);
-			result.emplace_back(RegisterToken, reg);
+			result.emplace_back(RegisterToken, GetRegisterText(xedReg, m_disassembly_options.lowerCase));
 			break;
 		}
 		case XED_OPERAND_AGEN:
@@ -819,11 +894,7 @@ void X86CommonArchitecture::GetOperandTextIntel(const xed_decoded_inst_t* const
 			const bool validSegment = (seg != XED_REG_INVALID && !xed_operand_values_using_default_segment(ov, 0));
 			if (validSegment)
 			{
-				string seg_str(xed_reg_enum_t2str(seg));
-				if (m_disassembly_options.lowerCase)
-					for (char& c : seg_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, seg_str);
+				result.emplace_back(RegisterToken, GetRegisterText(seg, m_disassembly_options.lowerCase));
 				result.emplace_back(OperationToken, ":");
 			}
 
@@ -834,11 +905,7 @@ void X86CommonArchitecture::GetOperandTextIntel(const xed_decoded_inst_t* const
 
 			if ((base != XED_REG_INVALID) && !((base == XED_REG_RIP) || (base == XED_REG_EIP) || (base == XED_REG_IP)))
 			{
-				string base_str(xed_reg_enum_t2str(base));
-				if (m_disassembly_options.lowerCase)
-					for (char& c : base_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, base_str);
+				result.emplace_back(RegisterToken, GetRegisterText(base, m_disassembly_options.lowerCase));
 				started = true;
 			}
 			else if ((base == XED_REG_RIP) || (base == XED_REG_EIP) || (base == XED_REG_IP))
@@ -876,12 +943,7 @@ void X86CommonArchitecture::GetOperandTextIntel(const xed_decoded_inst_t* const
 						result.emplace_back(OperationToken, "+");
 					started = true;
 
-					string index_str(xed_reg_enum_t2str(index));
-					if (m_disassembly_options.lowerCase)
-						for (char& c : index_str)
-							c = tolower(c);
-
-					result.emplace_back(RegisterToken, index_str);
+					result.emplace_back(RegisterToken, GetRegisterText(index, m_disassembly_options.lowerCase));
 
 					const unsigned int scale = xed_decoded_inst_get_scale(xedd, 0);
 					if (scale != 1)
@@ -959,11 +1021,7 @@ void X86CommonArchitecture::GetOperandTextIntel(const xed_decoded_inst_t* const
 			const xed_reg_enum_t seg = xed_decoded_inst_get_seg_reg(xedd, 1);
 			if (seg != XED_REG_INVALID && !xed_operand_values_using_default_segment(ov, 1))
 			{
-				string seg_str(xed_reg_enum_t2str(seg));
-				if (m_disassembly_options.lowerCase)
-					for (char& c : seg_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, seg_str);
+				result.emplace_back(RegisterToken, GetRegisterText(seg, m_disassembly_options.lowerCase));
 
 				result.emplace_back(OperationToken, ":");
 			}
@@ -972,11 +1030,7 @@ void X86CommonArchitecture::GetOperandTextIntel(const xed_decoded_inst_t* const
 			const xed_reg_enum_t base = xed_decoded_inst_get_base_reg(xedd, 1);
 			if (base != XED_REG_INVALID)
 			{
-				string base_str(xed_reg_enum_t2str(base));
-				if (m_disassembly_options.lowerCase)
-					for (char& c : base_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, base_str);
+				result.emplace_back(RegisterToken, GetRegisterText(base, m_disassembly_options.lowerCase));
 			}
 			result.emplace_back(EndMemoryOperandToken, "");
 			result.emplace_back(BraceToken, "]");
@@ -1093,11 +1147,7 @@ void X86CommonArchitecture::GetOperandTextIntel(const xed_decoded_inst_t* const
 	if (extra_index_operand != XED_REG_INVALID)
 	{
 		result.emplace_back(OperandSeparatorToken, m_disassembly_options.separator);
-		string reg = xed_reg_enum_t2str(extra_index_operand);
-		if (m_disassembly_options.lowerCase)
-			for (char& c : reg)
-				c = tolower(c);
-		result.emplace_back(RegisterToken, reg);
+		result.emplace_back(RegisterToken, GetRegisterText(extra_index_operand, m_disassembly_options.lowerCase));
 	}
 }
 
@@ -1191,11 +1241,7 @@ void X86CommonArchitecture::GetOperandTextBNIntel(const xed_decoded_inst_t* cons
 			const bool validSegment = (seg != XED_REG_INVALID && !xed_operand_values_using_default_segment(ov, 0));
 			if (validSegment)
 			{
-				string seg_str(xed_reg_enum_t2str(seg));
-				if (m_disassembly_options.lowerCase)
-					for (char& c : seg_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, seg_str);
+				result.emplace_back(RegisterToken, GetRegisterText(seg, m_disassembly_options.lowerCase));
 				result.emplace_back(OperationToken, ":");
 			}
 
@@ -1206,11 +1252,7 @@ void X86CommonArchitecture::GetOperandTextBNIntel(const xed_decoded_inst_t* cons
 
 			if ((base != XED_REG_INVALID) && !((base == XED_REG_RIP) || (base == XED_REG_EIP) || (base == XED_REG_IP)))
 			{
-				string base_str(xed_reg_enum_t2str(base));
-				if (m_disassembly_options.lowerCase)
-					for (char& c : base_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, base_str);
+				result.emplace_back(RegisterToken, GetRegisterText(base, m_disassembly_options.lowerCase));
 				started = true;
 			}
 			else if ((base == XED_REG_RIP) || (base == XED_REG_EIP) || (base == XED_REG_IP))
@@ -1253,12 +1295,7 @@ void X86CommonArchitecture::GetOperandTextBNIntel(const xed_decoded_inst_t* cons
 						result.emplace_back(OperationToken, "+");
 					started = true;
 
-					string index_str(xed_reg_enum_t2str(index));
-					if (m_disassembly_options.lowerCase)
-						for (char& c : index_str)
-							c = tolower(c);
-
-					result.emplace_back(RegisterToken, index_str);
+					result.emplace_back(RegisterToken, GetRegisterText(index, m_disassembly_options.lowerCase));
 
 					const unsigned int scale = xed_decoded_inst_get_scale(xedd, 0);
 					if (scale != 1)
@@ -1332,11 +1369,7 @@ void X86CommonArchitecture::GetOperandTextBNIntel(const xed_decoded_inst_t* cons
 			const xed_reg_enum_t seg = xed_decoded_inst_get_seg_reg(xedd, 1);
 			if (seg != XED_REG_INVALID && !xed_operand_values_using_default_segment(ov, 1))
 			{
-				string seg_str(xed_reg_enum_t2str(seg));
-				if (m_disassembly_options.lowerCase)
-					for (char& c : seg_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, seg_str);
+				result.emplace_back(RegisterToken, GetRegisterText(seg, m_disassembly_options.lowerCase));
 
 				result.emplace_back(OperationToken, ":");
 			}
@@ -1345,11 +1378,7 @@ void X86CommonArchitecture::GetOperandTextBNIntel(const xed_decoded_inst_t* cons
 			const xed_reg_enum_t base = xed_decoded_inst_get_base_reg(xedd, 1);
 			if (base != XED_REG_INVALID)
 			{
-				string base_str(xed_reg_enum_t2str(base));
-				if (m_disassembly_options.lowerCase)
-					for (char& c : base_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, base_str);
+				result.emplace_back(RegisterToken, GetRegisterText(base, m_disassembly_options.lowerCase));
 			}
 			result.emplace_back(EndMemoryOperandToken, "");
 			result.emplace_back(BraceToken, "]");
@@ -1476,11 +1505,7 @@ void X86CommonArchitecture::GetOperandTextBNIntel(const xed_decoded_inst_t* cons
 	if (extra_index_operand != XED_REG_INVALID)
 	{
 		result.emplace_back(OperandSeparatorToken, m_disassembly_options.separator);
-		string reg = xed_reg_enum_t2str(extra_index_operand);
-		if (m_disassembly_options.lowerCase)
-			for (char& c : reg)
-				c = tolower(c);
-		result.emplace_back(RegisterToken, reg);
+		result.emplace_back(RegisterToken, GetRegisterText(extra_index_operand, m_disassembly_options.lowerCase));
 	}
 }
 
@@ -1542,22 +1567,8 @@ void X86CommonArchitecture::GetOperandTextATT(const xed_decoded_inst_t* const xe
 		case XED_OPERAND_REG7:
 		case XED_OPERAND_REG8:
 		{
-			string reg = "%";
-
 			const xed_reg_enum_t xedReg = xed_decoded_inst_get_reg(xedd, op_name);
-			if ((xedReg >= XED_REG_X87_FIRST) && (xedReg <=  XED_REG_X87_LAST))
-			{
-				reg += "ST";
-				reg += ('0' + (xedReg-XED_REG_X87_FIRST));
-			}
-			else
-			{
-				reg += xed_reg_enum_t2str(xedReg);
-			}
-			if (m_disassembly_options.lowerCase)
-				for (char& c : reg)
-					c = tolower(c);
-			result.emplace_back(RegisterToken, reg);
+			result.emplace_back(RegisterToken, GetRegisterText(xedReg, m_disassembly_options.lowerCase, true));
 			break;
 		}
 		case XED_OPERAND_AGEN:
@@ -1576,12 +1587,7 @@ void X86CommonArchitecture::GetOperandTextATT(const xed_decoded_inst_t* const xe
 			const bool validSegment = (seg != XED_REG_INVALID && !xed_operand_values_using_default_segment(ov, 0));
 			if (validSegment)
 			{
-				string seg_str(xed_reg_enum_t2str(seg));
-				seg_str = "%" + seg_str;
-				if (m_disassembly_options.lowerCase)
-					for (char& c : seg_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, seg_str);
+				result.emplace_back(RegisterToken, GetRegisterText(seg, m_disassembly_options.lowerCase, true));
 				result.emplace_back(OperationToken, ":");
 			}
 
@@ -1592,12 +1598,7 @@ void X86CommonArchitecture::GetOperandTextATT(const xed_decoded_inst_t* const xe
 
 			if ((base != XED_REG_INVALID) && !((base == XED_REG_RIP) || (base == XED_REG_EIP) || (base == XED_REG_IP)))
 			{
-				string base_str(xed_reg_enum_t2str(base));
-				base_str = "%" + base_str;
-				if (m_disassembly_options.lowerCase)
-					for (char& c : base_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, base_str);
+				result.emplace_back(RegisterToken, GetRegisterText(base, m_disassembly_options.lowerCase, true));
 				started = true;
 			}
 			else if ((base == XED_REG_RIP) || (base == XED_REG_EIP) || (base == XED_REG_IP))
@@ -1627,13 +1628,7 @@ void X86CommonArchitecture::GetOperandTextATT(const xed_decoded_inst_t* const xe
 					result.emplace_back(OperationToken, "+");
 				started = true;
 
-				string index_str(xed_reg_enum_t2str(index));
-				index_str = "%" + index_str;
-				if (m_disassembly_options.lowerCase)
-					for (char& c : index_str)
-						c = tolower(c);
-
-				result.emplace_back(RegisterToken, index_str);
+				result.emplace_back(RegisterToken, GetRegisterText(index, m_disassembly_options.lowerCase, true));
 
 				const unsigned int scale = xed_decoded_inst_get_scale(xedd, 0);
 				if (scale != 1)
@@ -1711,12 +1706,7 @@ void X86CommonArchitecture::GetOperandTextATT(const xed_decoded_inst_t* const xe
 			const xed_reg_enum_t seg = xed_decoded_inst_get_seg_reg(xedd, 1);
 			if (seg != XED_REG_INVALID && !xed_operand_values_using_default_segment(ov, 1))
 			{
-				string seg_str(xed_reg_enum_t2str(seg));
-				seg_str = "%" + seg_str;
-				if (m_disassembly_options.lowerCase)
-					for (char& c : seg_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, seg_str);
+				result.emplace_back(RegisterToken, GetRegisterText(seg, m_disassembly_options.lowerCase, true));
 
 				result.emplace_back(OperationToken, ":");
 			}
@@ -1725,12 +1715,7 @@ void X86CommonArchitecture::GetOperandTextATT(const xed_decoded_inst_t* const xe
 			const xed_reg_enum_t base = xed_decoded_inst_get_base_reg(xedd, 1);
 			if (base != XED_REG_INVALID)
 			{
-				string base_str(xed_reg_enum_t2str(base));
-				base_str = "%" + base_str;
-				if (m_disassembly_options.lowerCase)
-					for (char& c : base_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, base_str);
+				result.emplace_back(RegisterToken, GetRegisterText(base, m_disassembly_options.lowerCase, true));
 			}
 			result.emplace_back(EndMemoryOperandToken, "");
 			result.emplace_back(BraceToken, "]");
@@ -2182,6 +2167,9 @@ size_t X86CommonArchitecture::GetSemanticFlagGroupLowLevelIL(uint32_t semGroup,
 
 string X86CommonArchitecture::GetRegisterName(uint32_t reg)
 {
+	if (reg < XED_REG_LAST)
+		return GetRegisterText((xed_reg_enum_t)reg, m_disassembly_options.lowerCase, m_disassembly_options.df == DF_ATT);
+
 	string reg_str = "";
 	if (m_disassembly_options.df == DF_ATT)
 		reg_str += "%";
@@ -2589,8 +2577,225 @@ bool X86CommonArchitecture::CanAssemble()
 	return true;
 }
 
+static bool ParseAssemblerNumber(const string& text, int64_t& value)
+{
+	size_t start = (!text.empty() && text[0] == '-') ? 1 : 0;
+	if (start >= text.size())
+		return false;
+
+	string digits = text.substr(start);
+	int base = 10;
+	if (digits.size() > 2 && digits[0] == '0' && digits[1] == 'x')
+	{
+		digits = digits.substr(2);
+		base = 16;
+	}
+	else if (digits.size() > 1 && digits.back() == 'h' && isdigit((unsigned char)digits[0]))
+	{
+		digits.pop_back();
+		base = 16;
+	}
+
+	if (digits.empty() || digits.size() > 16)
+		return false;
+	for (char c : digits)
+	{
+		if (base == 16 ? !isxdigit((unsigned char)c) : !isdigit((unsigned char)c))
+			return false;
+	}
+	uint64_t magnitude = strtoull(digits.c_str(), nullptr, base);
+	if (start && magnitude > (uint64_t)INT64_MAX)
+		return false;
+	value = start ? -(int64_t)magnitude : (int64_t)magnitude;
+	return true;
+}
+
+
+static bool ParseGeneralRegister(const string& name, size_t bits, uint8_t& reg, size_t& size)
+{
+	static const char* const legacy32[] = {"eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi"};
+	static const char* const legacy64[] = {"rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi"};
+	for (uint8_t i = 0; i < 8; i++)
+	{
+		if (name == legacy32[i])
+		{
+			reg = i;
+			size = 4;
+			return true;
+		}
+		if (bits == 64 && name == legacy64[i])
+		{
+			reg = i;
+			size = 8;
+			return true;
+		}
+	}
+
+	if (bits != 64 || name.size() < 2 || name[0] != 'r' || !isdigit((unsigned char)name[1]))
+		return false;
+	size_t end = 1;
+	while (end < name.size() && isdigit((unsigned char)name[end]))
+		end++;
+	unsigned long index = strtoul(name.substr(1, end - 1).c_str(), nullptr, 10);
+	if (index < 8 || index > 15)
+		return false;
+	string suffix = name.substr(end);
+	if (suffix.empty())
+		size = 8;
+	else if (suffix == "d")
+		size = 4;
+	else
+		return false;
+	reg = (uint8_t)index;
+	return true;
+}
+
+
+static void AppendLittleEndian(vector<uint8_t>& out, uint64_t value, size_t size)
+{
+	for (size_t i = 0; i < size; i++)
+		out.push_back((uint8_t)(value >> (i * 8)));
+}
+
+
+// Encode code made of only the instructions patches are usually built from without starting yasm, which dominates
+// the time taken to assemble short snippets. The encodings are the ones yasm picks for the same text, and
+// anything else (labels, memory operands, immediates yasm could encode more than one way) returns false so that
+// the caller assembles it with yasm.
+static bool AssembleSimpleInstructions(const string& code, uint64_t addr, size_t bits, DataBuffer& result)
+{
+	if (bits != 32 && bits != 64)
+		return false;
+
+	vector<uint8_t> out;
+	istringstream lines(code);
+	string line;
+	while (getline(lines, line))
+	{
+		line = line.substr(0, line.find(';'));
+		string text;
+		for (char c : line)
+			text += (char)tolower((unsigned char)c);
+
+		// Split into the mnemonic and its comma separated operands
+		size_t mnemonicStart = text.find_first_not_of(" \t\r");
+		if (mnemonicStart == string::npos)
+			continue;
+		size_t mnemonicEnd = text.find_first_of(" \t\r", mnemonicStart);
+		string mnemonic = text.substr(mnemonicStart, mnemonicEnd - mnemonicStart);
+		vector<string> operands;
+		if (mnemonicEnd != string::npos)
+		{
+			string rest = text.substr(mnemonicEnd);
+			size_t start = 0;
+			while (true)
+			{
+				size_t comma = rest.find(',', start);
+				string operand = rest.substr(start, comma - start);
+				size_t first = operand.find_first_not_of(" \t\r");
+				if (first != string::npos)
+					operands.push_back(operand.substr(first, operand.find_last_not_of(" \t\r") - first + 1));
+				else if (comma != string::npos || !operands.empty())
+					return false;
+				if (comma == string::npos)
+					break;
+				start = comma + 1;
+			}
+		}
+
+		uint64_t current = addr + out.size();
+		if (operands.empty())
+		{
+			if (mnemonic == "nop")
+				out.push_back(0x90);
+			else if (mnemonic == "ret")
+				out.push_back(0xc3);
+			else if (mnemonic == "int3")
+				out.push_back(0xcc);
+			else if (mnemonic == "leave")
+				out.push_back(0xc9);
+			else
+				return false;
+		}
+		else if ((mnemonic == "jmp" || mnemonic == "call") && operands.size() == 1)
+		{
+			int64_t target;
+			if (!ParseAssemblerNumber(operands[0], target) || target < 0)
+				return false;
+			if (bits == 32 && (uint64_t)target > 0xffffffff)
+				return false;
+
+			// yasm relaxes jumps to the short form whenever the target is in range
+			int64_t shortOffset = target - (int64_t)(current + 2);
+			int64_t nearOffset = target - (int64_t)(current + 5);
+			if (bits == 32)
+				nearOffset = (int32_t)(uint32_t)nearOffset;
+			if (mnemonic == "jmp" && shortOffset >= INT8_MIN && shortOffset <= INT8_MAX)
+			{
+				out.push_back(0xeb);
+				out.push_back((uint8_t)shortOffset);
+				continue;
+			}
+			if (nearOffset < INT32_MIN || nearOffset > INT32_MAX)
+				return false;
+			out.push_back(mnemonic == "jmp" ? 0xe9 : 0xe8);
+			AppendLittleEndian(out, (uint64_t)nearOffset, 4);
+		}
+		else if (mnemonic == "mov" && operands.size() == 2)
+		{
+			uint8_t reg;
+			size_t size;
+			int64_t value;
+			if (!ParseGeneralRegister(operands[0], bits, reg, size) || !ParseAssemblerNumber(operands[1], value))
+				return false;
+
+			uint8_t rex = (reg >= 8 ? 0x41 : 0) | (size == 8 ? 0x48 : 0);
+			if (size == 4)
+			{
+				if (value < INT32_MIN || value > (int64_t)UINT32_MAX)
+					return false;
+				if (rex)
+					out.push_back(rex);
+				out.push_back(0xb8 + (reg & 7));
+				AppendLittleEndian(out, (uint64_t)value, 4);
+			}
+			else if (value >= INT32_MIN && value <= INT32_MAX)
+			{
+				out.push_back(rex);
+				out.push_back(0xc7);
+				out.push_back(0xc0 + (reg & 7));
+				AppendLittleEndian(out, (uint64_t)value, 4);
+			}
+			else if (value >= 0 && value <= (int64_t)UINT32_MAX)
+			{
+				// Could be encoded with or without the REX.W prefix, leave the choice to yasm
+				return false;
+			}
+			else
+			{
+				out.push_back(rex);
+				out.push_back(0xb8 + (reg & 7));
+				AppendLittleEndian(out, (uint64_t)value, 8);
+			}
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	if (out.empty())
+		return false;
+	result = DataBuffer(out.data(), out.size());
+	return true;
+}
+
+
 bool X86CommonArchitecture::Assemble(const string& code, uint64_t addr, DataBuffer& result, string& errors)
 {
+	if (AssembleSimpleInstructions(code, addr, GetAddressSizeBits(), result))
+		return true;
+
 	string finalCode;
 
 	if (GetAddressSizeBits() == 32)
@@ -2618,10 +2823,11 @@ bool X86CommonArchitecture::Assemble(const string& code, uint64_t addr, DataBuff
 		return false;
 	}
 
+	// The bundled plugin directory doesn't move, so look yasm up once instead of on every snippet
 	#ifdef WIN32
-		string yasmPath = GetPathRelativeToBundledPluginDirectory("yasm.exe");
+		static const string yasmPath = GetPathRelativeToBundledPluginDirectory("yasm.exe");
 	#else
-		string yasmPath = GetPathRelativeToBundledPluginDirectory("yasm");
+		static const string yasmPath = GetPathRelativeToBundledPluginDirectory("yasm");
 	#endif
 
 	string inputPath = inputFile->GetPath();
@@ -4818,9 +5024,7 @@ extern "C"
 	{
 		InitX86Settings();
 
-		// XED Setup
-		xed_tables_init();
-		X86CommonArchitecture::InitializeCachedTypes();
+		// The XED tables and intrinsic types are built on first use, so loading the plugin doesn't pay for them
 
 		// Register the architectures in the global list of available architectures
 		Architecture* x16 = new X16Architecture();
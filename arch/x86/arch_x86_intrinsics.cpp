@@ -3,6 +3,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <sstream>
+#include <mutex>
 #include "binaryninjaapi.h"
 #include "il.h"
 extern "C" {
@@ -5122,8 +5123,34 @@ vector<uint32_t> X86CommonArchitecture::GetAllIntrinsics()
     return allIntrinsics;
 }
 
+// Slot in cached_input_types/cached_output_types for every XED iform intrinsic, indexed directly by
+// intrinsic - INTRINSIC_XED_IFORM_INVALID so lookups don't go through an 8000 case switch
+static constexpr uint16_t NoCachedType = 0xffff;
+static constexpr size_t XedIntrinsicCount = INTRINSIC_XED_IFORM_LAST - INTRINSIC_XED_IFORM_INVALID;
+
+static constexpr uint16_t g_inputTypeTable[] = {
+#include "x86_intrinsic_input_type.include"
+};
+static_assert(sizeof(g_inputTypeTable) / sizeof(g_inputTypeTable[0]) == XedIntrinsicCount,
+    "x86_intrinsic_input_type.include is out of date with il.h");
+
+static constexpr uint16_t g_outputTypeTable[] = {
+#include "x86_intrinsic_output_type.include"
+};
+static_assert(sizeof(g_outputTypeTable) / sizeof(g_outputTypeTable[0]) == XedIntrinsicCount,
+    "x86_intrinsic_output_type.include is out of date with il.h");
+
 vector<NameAndType> X86CommonArchitecture::GetIntrinsicInputs(uint32_t intrinsic)
 {
+    if ((intrinsic >= INTRINSIC_XED_IFORM_INVALID) && (intrinsic < INTRINSIC_XED_IFORM_LAST))
+    {
+        uint16_t index = g_inputTypeTable[intrinsic - INTRINSIC_XED_IFORM_INVALID];
+        if (index == NoCachedType)
+            return vector<NameAndType>();
+        X86CommonArchitecture::InitializeCachedTypes();
+        return X86CommonArchitecture::cached_input_types[index];
+    }
+
     switch (intrinsic)
     {
     case INTRINSIC_F2XM1:
@@ -5166,8 +5193,6 @@ vector<NameAndType> X86CommonArchitecture::GetIntrinsicInputs(uint32_t intrinsic
     case INTRINSIC_XED_IFORM_POPCNT_GPR16_GPRMEM16:
         return vector<NameAndType> { NameAndType(Type::IntegerType(2, false)) };
 
-    #include "x86_intrinsic_input_type.include"
-
     default:
         return vector<NameAndType>();
     }
@@ -5175,6 +5200,15 @@ vector<NameAndType> X86CommonArchitecture::GetIntrinsicInputs(uint32_t intrinsic
 
 vector<Confidence<Ref<Type>>> X86CommonArchitecture::GetIntrinsicOutputs(uint32_t intrinsic)
 {
+    if ((intrinsic >= INTRINSIC_XED_IFORM_INVALID) && (intrinsic < INTRINSIC_XED_IFORM_LAST))
+    {
+        uint16_t index = g_outputTypeTable[intrinsic - INTRINSIC_XED_IFORM_INVALID];
+        if (index == NoCachedType)
+            return vector<Confidence<Ref<Type>>>();
+        X86CommonArchitecture::InitializeCachedTypes();
+        return X86CommonArchitecture::cached_output_types[index];
+    }
+
     switch (intrinsic)
     {
     case INTRINSIC_F2XM1:
@@ -5221,8 +5255,6 @@ vector<Confidence<Ref<Type>>> X86CommonArchitecture::GetIntrinsicOutputs(uint32_
     case INTRINSIC_XED_IFORM_POPCNT_GPR16_GPRMEM16:
         return vector<Confidence<Ref<Type>>> { Type::IntegerType(2, false)};
 
-    #include "x86_intrinsic_output_type.include"
-
     default:
         return vector<Confidence<Ref<Type>>>();
     }
@@ -5253,8 +5285,12 @@ void X86CommonArchitecture::InitializeCachedOutputTypes()
 }
 
 
+// Creating the few thousand types takes a noticeable part of startup, so it waits for the first lookup
 void X86CommonArchitecture::InitializeCachedTypes()
 {
-    X86CommonArchitecture::InitializeCachedInputTypes();
-    X86CommonArchitecture::InitializeCachedOutputTypes();
+    static std::once_flag typesInitialized;
+    std::call_once(typesInitialized, []() {
+        X86CommonArchitecture::InitializeCachedInputTypes();
+        X86CommonArchitecture::InitializeCachedOutputTypes();
+    });
 }
@@ -16,14 +16,12 @@ class TypeCacher():
         self.cached_types = []
         self.name = name
     
-    def get_cached_type_str(self, type_str):
+    def get_cached_type_index(self, type_str):
         try:
-            cached_type_str = 'X86CommonArchitecture::cached_%s_types[%d]' % (self.name, self.cached_types.index(type_str))
-        except:
+            return self.cached_types.index(type_str)
+        except ValueError:
             self.cached_types.append(type_str)
-            cached_type_str = 'X86CommonArchitecture::cached_%s_types[%d]' % (self.name, len(self.cached_types) - 1)
-
-        return cached_type_str
+            return len(self.cached_types) - 1
     
     def dump_to_file(self, decl_path):
         with open(decl_path, 'w') as output:
@@ -37,8 +35,8 @@ class TypeCacher():
 class CodeGenerator():
     
     def __init__(self, path, vector_element_name, enclose_element_with, name, rw):
-        self.file = open(path, 'w')
-        self.write_header()
+        self.path = path
+        self.type_indices = {}
         self.vector_element_name = vector_element_name
         self.enclose_element_with = enclose_element_with
         self.rw = rw
@@ -61,19 +59,22 @@ class CodeGenerator():
             'INTRINSIC_XED_IFORM_XRSTORS64_MEMmxsave',
         ]
 
-    def clean_up(self):
-        self.file.close()
-
-    def write_header(self):
-        self.file.write('// Generated file, please do not edit directly\n\n')
+    def write_table(self, iforms):
+        # One entry per intrinsic, in enum order, so the C++ side can index the table directly
+        with open(self.path, 'w') as output:
+            output.write('// Generated file, please do not edit directly\n\n')
+            for iform in iforms:
+                index = self.type_indices.get(iform)
+                if index is None:
+                    output.write('NoCachedType, // %s\n' % iform)
+                else:
+                    output.write('%d, // %s\n' % (index, iform))
 
     def generate_intrinsic(self, ins):
 
         if ins.iform in self.excluded_intrinsics:
             return
 
-        s = 'case %s:' % ins.iform
-        s += '\n\treturn '
         return_str = 'vector<%s> ' % self.vector_element_name
         return_str += '{ '
         for operand in ins.operands:
@@ -91,10 +92,7 @@ class CodeGenerator():
             return_str = return_str[:-2]
 
         return_str += ' }'
-        return_str = self.type_cacher.get_cached_type_str(return_str)
-        s += return_str
-        s += ';\n'
-        self.file.write(s)
+        self.type_indices[ins.iform] = self.type_cacher.get_cached_type_index(return_str)
     
     def dump_cached_types(self):
         self.type_cacher.dump_to_file(f'../x86_intrinsic_cached_{self.name}_types.include')
@@ -432,6 +430,21 @@ class Operand():
 
         return s
 
+def read_xed_iforms(path):
+    # The XED iform intrinsics in the order they are declared in il.h, from INTRINSIC_XED_IFORM_INVALID up to
+    # but not including INTRINSIC_XED_IFORM_LAST
+    iforms = []
+    with open(path, 'r') as f:
+        for line in f:
+            name = line.strip().split(' ')[0].rstrip(',')
+            if name == 'INTRINSIC_XED_IFORM_INVALID':
+                iforms.append(name)
+            elif name == 'INTRINSIC_XED_IFORM_LAST':
+                break
+            elif iforms and name.startswith('INTRINSIC_XED_IFORM_'):
+                iforms.append(name)
+    return iforms
+
 def main():
     intrinsic_input = CodeGenerator('../x86_intrinsic_input_type.include', 'NameAndType', 'NameAndType', 'input', 'r')
     intrinsic_output = CodeGenerator('../x86_intrinsic_output_type.include', 'Confidence<Ref<Type>>', '', 'output', 'w')
@@ -459,8 +472,9 @@ def main():
     intrinsic_input.dump_cached_types()
     intrinsic_output.dump_cached_types()
 
-    intrinsic_input.clean_up()
-    intrinsic_output.clean_up()
+    iforms = read_xed_iforms('../il.h')
+    intrinsic_input.write_table(iforms)
+    intrinsic_output.write_table(iforms)
 
 if __name__ == '__main__':
     main()
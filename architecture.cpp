@@ -20,8 +20,11 @@
 
 #define _CRT_SECURE_NO_WARNINGS
 #include <cstdio>
+#include <cstring>
 #include <cstdint>
 #include <inttypes.h>
+#include <atomic>
+#include <thread>
 #include <vector>
 #include "binaryninjaapi.h"
 
@@ -254,6 +257,8 @@ BNArchitecture* Architecture::GetAssociatedArchitectureByAddressCallback(void* c
 bool Architecture::GetInstructionInfoCallback(
     void* ctxt, const uint8_t* data, uint64_t addr, size_t maxLen, BNInstructionInfo* result)
 {
+	static InstrumentationHistogram histogram("arch.get_instruction_info");
+	InstrumentationScope scope(histogram);
 	CallbackRef<Architecture> arch(ctxt);
 
 	InstructionInfo info;
@@ -264,9 +269,101 @@ bool Architecture::GetInstructionInfoCallback(
 }
 
 
+static std::string_view GetTokenText(const InstructionTextToken& token)
+{
+	return token.text;
+}
+
+
+static size_t GetTokenNameCount(const InstructionTextToken& token)
+{
+	return token.typeNames.size();
+}
+
+
+static std::string_view GetTokenName(const InstructionTextToken& token, size_t i)
+{
+	return token.typeNames[i];
+}
+
+
+static std::string_view GetTokenText(const BNInstructionTextToken& token)
+{
+	return token.text ? token.text : "";
+}
+
+
+static size_t GetTokenNameCount(const BNInstructionTextToken& token)
+{
+	return token.namesCount;
+}
+
+
+static std::string_view GetTokenName(const BNInstructionTextToken& token, size_t i)
+{
+	return token.typeNames[i];
+}
+
+
+// Builds a token list for the core in a single allocation, laid out as the token array, then every token's
+// typeNames array, then the string data. Only FreeInstructionTextCallback may release the result. Token is
+// either InstructionTextToken or BNInstructionTextToken, read through the overloads above.
+template <typename Token>
+static BNInstructionTextToken* CreatePooledInstructionTextTokenList(const Token* tokens, size_t count)
+{
+	static_assert(sizeof(BNInstructionTextToken) % alignof(char*) == 0, "name arrays must stay aligned");
+
+	size_t nameCount = 0;
+	size_t stringBytes = 0;
+	for (size_t i = 0; i < count; i++)
+	{
+		stringBytes += GetTokenText(tokens[i]).size() + 1;
+		nameCount += GetTokenNameCount(tokens[i]);
+		for (size_t j = 0; j < GetTokenNameCount(tokens[i]); j++)
+			stringBytes += GetTokenName(tokens[i], j).size() + 1;
+	}
+
+	char* block = new char[(sizeof(BNInstructionTextToken) * count) + (sizeof(char*) * nameCount) + stringBytes];
+	BNInstructionTextToken* result = reinterpret_cast<BNInstructionTextToken*>(block);
+	char** names = reinterpret_cast<char**>(block + (sizeof(BNInstructionTextToken) * count));
+	char* strings = reinterpret_cast<char*>(names + nameCount);
+
+	auto copyString = [&](std::string_view str) {
+		char* dest = strings;
+		memcpy(dest, str.data(), str.size());
+		dest[str.size()] = 0;
+		strings += str.size() + 1;
+		return dest;
+	};
+
+	for (size_t i = 0; i < count; i++)
+	{
+		const Token& token = tokens[i];
+		BNInstructionTextToken& out = result[i];
+		out.type = token.type;
+		out.text = copyString(GetTokenText(token));
+		out.value = token.value;
+		out.width = token.width;
+		out.size = token.size;
+		out.operand = token.operand;
+		out.context = token.context;
+		out.confidence = token.confidence;
+		out.address = token.address;
+		out.typeNames = names;
+		for (size_t j = 0; j < GetTokenNameCount(token); j++)
+			*names++ = copyString(GetTokenName(token, j));
+		out.namesCount = GetTokenNameCount(token);
+		out.exprIndex = token.exprIndex;
+	}
+	return result;
+}
+
+
 bool Architecture::GetInstructionTextCallback(
     void* ctxt, const uint8_t* data, uint64_t addr, size_t* len, BNInstructionTextToken** result, size_t* count)
 {
+	static InstrumentationHistogram histogram("arch.get_instruction_text");
+	InstrumentationScope scope(histogram);
 	CallbackRef<Architecture> arch(ctxt);
 
 	vector<InstructionTextToken> tokens;
@@ -279,29 +376,27 @@ bool Architecture::GetInstructionTextCallback(
 	}
 
 	*count = tokens.size();
-	*result = InstructionTextToken::CreateInstructionTextTokenList(tokens);
+	*result = CreatePooledInstructionTextTokenList(tokens.data(), tokens.size());
 	return true;
 }
 
 
-void Architecture::FreeInstructionTextCallback(BNInstructionTextToken* tokens, size_t count)
+void Architecture::FreeInstructionTextCallback(BNInstructionTextToken* tokens, size_t)
 {
-	for (size_t i = 0; i < count; i++)
-	{
-		BNFreeString(tokens[i].text);
-		for (size_t j = 0; j < tokens[j].namesCount; j++)
-			BNFreeString(tokens[i].typeNames[j]);
-		delete[] tokens[i].typeNames;
-	}
-	delete[] tokens;
+	// Tokens, name arrays and strings all live in the one block from CreatePooledInstructionTextTokenList
+	delete[] reinterpret_cast<char*>(tokens);
 }
 
 
 bool Architecture::GetInstructionLowLevelILCallback(
     void* ctxt, const uint8_t* data, uint64_t addr, size_t* len, BNLowLevelILFunction* il)
 {
+	static InstrumentationHistogram histogram("arch.get_instruction_low_level_il");
+	InstrumentationScope scope(histogram);
 	CallbackRef<Architecture> arch(ctxt);
 	Ref<LowLevelILFunction> func(new LowLevelILFunction(BNNewLowLevelILFunctionReference(il)));
+	if (arch->m_lowLevelILTemplateCacheEnabled)
+		return func->LiftInstructionWithTemplateCache(arch, data, addr, *len);
 	return arch->GetInstructionLowLevelIL(data, addr, *len, *func);
 }
 
@@ -698,6 +793,8 @@ bool Architecture::CanAssembleCallback(void* ctxt)
 
 bool Architecture::AssembleCallback(void* ctxt, const char* code, uint64_t addr, BNDataBuffer* result, char** errors)
 {
+	static InstrumentationHistogram histogram("arch.assemble");
+	InstrumentationScope scope(histogram);
 	CallbackRef<Architecture> arch(ctxt);
 	DataBuffer buf;
 	string errorStr;
@@ -917,6 +1014,27 @@ Ref<Architecture> Architecture::GetAssociatedArchitectureByAddress(uint64_t&)
 }
 
 
+size_t Architecture::GetInstructionInfoBatch(
+    const uint8_t* data, uint64_t addr, size_t maxLen, InstructionInfo* results, size_t maxCount)
+{
+	size_t count = 0;
+	size_t offset = 0;
+	while (count < maxCount && offset < maxLen)
+	{
+		InstructionInfo& info = results[count];
+		info = InstructionInfo();
+		if (!GetInstructionInfo(data + offset, addr + offset, maxLen - offset, info) || info.length == 0)
+			break;
+		count++;
+		offset += info.length;
+		// Control flow (and any delay slots) ends the straight-line run; the caller resumes at the targets
+		if (info.branchCount != 0 || info.delaySlots != 0)
+			break;
+	}
+	return count;
+}
+
+
 bool Architecture::GetInstructionLowLevelIL(const uint8_t*, uint64_t, size_t&, LowLevelILFunction& il)
 {
 	il.AddInstruction(il.Undefined());
@@ -924,6 +1042,18 @@ bool Architecture::GetInstructionLowLevelIL(const uint8_t*, uint64_t, size_t&, L
 }
 
 
+void Architecture::SetLowLevelILTemplateCacheEnabled(bool enabled)
+{
+	m_lowLevelILTemplateCacheEnabled = enabled;
+}
+
+
+bool Architecture::IsLowLevelILTemplateCacheEnabled() const
+{
+	return m_lowLevelILTemplateCacheEnabled;
+}
+
+
 string Architecture::GetRegisterName(uint32_t reg)
 {
 	return fmt::format("r{}", reg);
@@ -1204,6 +1334,41 @@ bool Architecture::Assemble(const std::string&, uint64_t, DataBuffer&, std::stri
 }
 
 
+bool Architecture::AssembleBatch(const vector<pair<string, uint64_t>>& snippets, vector<DataBuffer>& results,
+	vector<string>& errors)
+{
+	results.assign(snippets.size(), DataBuffer());
+	errors.assign(snippets.size(), string());
+
+	atomic<size_t> next(0);
+	atomic<bool> ok(true);
+	auto worker = [&]() {
+		for (size_t i = next++; i < snippets.size(); i = next++)
+		{
+			if (!Assemble(snippets[i].first, snippets[i].second, results[i], errors[i]))
+			{
+				if (errors[i].empty())
+					errors[i] = "Failed to assemble\n";
+				ok = false;
+			}
+			else
+			{
+				errors[i].clear();
+			}
+		}
+	};
+
+	size_t threadCount = min<size_t>(max(thread::hardware_concurrency(), 1u), snippets.size());
+	vector<thread> threads;
+	for (size_t i = 1; i < threadCount; i++)
+		threads.emplace_back(worker);
+	worker();
+	for (auto& t : threads)
+		t.join();
+	return ok;
+}
+
+
 bool Architecture::IsNeverBranchPatchAvailable(const uint8_t*, uint64_t, size_t)
 {
 	return false;
@@ -1924,6 +2089,8 @@ ArchitectureExtension::ArchitectureExtension(const string& name, Architecture* b
 void ArchitectureExtension::Register(BNCustomArchitecture* callbacks)
 {
 	AddRefForRegistration();
+	m_instructionDispatch.base = m_base->GetObject();
+	m_instructionDispatch.Install(callbacks, this);
 	BNRegisterArchitectureExtension(m_nameForRegister.c_str(), m_base->GetObject(), callbacks);
 }
 
@@ -2292,11 +2459,81 @@ ArchitectureHook::ArchitectureHook(Architecture* base) : CoreArchitecture(nullpt
 void ArchitectureHook::Register(BNCustomArchitecture* callbacks)
 {
 	AddRefForRegistration();
+	m_instructionDispatch.Install(callbacks, this);
 	m_object = BNRegisterArchitectureHook(m_base->GetObject(), callbacks);
+	// The hook's own object is the implementation it replaced, which is where unhooked instructions go
+	m_instructionDispatch.base = m_object;
 	BNFinalizeArchitectureHook(m_base->GetObject());
 }
 
 
+void ArchitectureInstructionDispatch::Install(BNCustomArchitecture* archCallbacks, Architecture* arch)
+{
+	callbacks = *archCallbacks;
+	arch->m_instructionDispatch = this;
+
+	if (!(hookedMethods & HookedGetInstructionInfo) || filter)
+		archCallbacks->getInstructionInfo = GetInstructionInfoCallback;
+	if (!(hookedMethods & HookedGetInstructionText))
+	{
+		// Every token list then comes from the base architecture, so the core's free function releases them
+		archCallbacks->getInstructionText = GetInstructionTextCallback;
+		archCallbacks->freeInstructionText = BNFreeInstructionText;
+	}
+	else if (filter)
+	{
+		archCallbacks->getInstructionText = GetInstructionTextCallback;
+	}
+	if (!(hookedMethods & HookedGetInstructionLowLevelIL) || filter)
+		archCallbacks->getInstructionLowLevelIL = GetInstructionLowLevelILCallback;
+}
+
+
+bool ArchitectureInstructionDispatch::GetInstructionInfoCallback(
+    void* ctxt, const uint8_t* data, uint64_t addr, size_t maxLen, BNInstructionInfo* result)
+{
+	ArchitectureInstructionDispatch& dispatch = *static_cast<Architecture*>(ctxt)->m_instructionDispatch;
+	if ((dispatch.hookedMethods & HookedGetInstructionInfo) && dispatch.filter(data, addr, maxLen))
+		return dispatch.callbacks.getInstructionInfo(ctxt, data, addr, maxLen, result);
+	return BNGetInstructionInfo(dispatch.base, data, addr, maxLen, result);
+}
+
+
+bool ArchitectureInstructionDispatch::GetInstructionTextCallback(
+    void* ctxt, const uint8_t* data, uint64_t addr, size_t* len, BNInstructionTextToken** result, size_t* count)
+{
+	ArchitectureInstructionDispatch& dispatch = *static_cast<Architecture*>(ctxt)->m_instructionDispatch;
+	if (!(dispatch.hookedMethods & HookedGetInstructionText))
+		return BNGetInstructionText(dispatch.base, data, addr, len, result, count);
+	if (dispatch.filter(data, addr, *len))
+		return dispatch.callbacks.getInstructionText(ctxt, data, addr, len, result, count);
+
+	// The extension's own free callback releases whatever is returned from here, so hand back a pooled copy
+	BNInstructionTextToken* tokens = nullptr;
+	size_t tokenCount = 0;
+	if (!BNGetInstructionText(dispatch.base, data, addr, len, &tokens, &tokenCount))
+	{
+		*result = nullptr;
+		*count = 0;
+		return false;
+	}
+	*result = CreatePooledInstructionTextTokenList(tokens, tokenCount);
+	*count = tokenCount;
+	BNFreeInstructionText(tokens, tokenCount);
+	return true;
+}
+
+
+bool ArchitectureInstructionDispatch::GetInstructionLowLevelILCallback(
+    void* ctxt, const uint8_t* data, uint64_t addr, size_t* len, BNLowLevelILFunction* il)
+{
+	ArchitectureInstructionDispatch& dispatch = *static_cast<Architecture*>(ctxt)->m_instructionDispatch;
+	if ((dispatch.hookedMethods & HookedGetInstructionLowLevelIL) && dispatch.filter(data, addr, *len))
+		return dispatch.callbacks.getInstructionLowLevelIL(ctxt, data, addr, len, il);
+	return BNGetInstructionLowLevelIL(dispatch.base, data, addr, len, il);
+}
+
+
 string DisassemblyTextRenderer::GetDisplayStringForInteger(
     Ref<BinaryView> binaryView, BNIntegerDisplayType type, uint64_t value, size_t inputWidth, bool isSigned)
 {
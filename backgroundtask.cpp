@@ -13,6 +13,7 @@ BackgroundTask::BackgroundTask(BNBackgroundTask* task)
 BackgroundTask::BackgroundTask(const string& initialText, bool canCancel)
 {
 	m_object = BNBeginBackgroundTask(initialText.c_str(), canCancel);
+	m_progressDescription = make_shared<const string>(initialText);
 }
 
 
@@ -67,6 +68,47 @@ void BackgroundTask::SetProgressText(const string& text)
 }
 
 
+void BackgroundTask::SetProgressDescription(const string& description)
+{
+	atomic_store(&m_progressDescription, make_shared<const string>(description));
+	// Shown with the next counts rather than waiting for the interval
+	m_nextProgressUpdate.store(0, memory_order_relaxed);
+}
+
+
+void BackgroundTask::SetProgress(uint64_t current, uint64_t total)
+{
+	m_progressCurrent.store(current, memory_order_relaxed);
+	m_progressTotal.store(total, memory_order_relaxed);
+	PublishProgress();
+}
+
+
+void BackgroundTask::AddProgress(uint64_t count)
+{
+	m_progressCurrent.fetch_add(count, memory_order_relaxed);
+	PublishProgress();
+}
+
+
+void BackgroundTask::PublishProgress()
+{
+	int64_t now = chrono::steady_clock::now().time_since_epoch().count();
+	int64_t next = m_nextProgressUpdate.load(memory_order_relaxed);
+	if (now < next)
+		return;
+	// Only the thread that moves the deadline on sends the text, the others carry on
+	int64_t deadline = now + chrono::duration_cast<chrono::steady_clock::duration>(ProgressUpdateInterval).count();
+	if (!m_nextProgressUpdate.compare_exchange_strong(next, deadline, memory_order_relaxed))
+		return;
+
+	shared_ptr<const string> description = atomic_load(&m_progressDescription);
+	string text = fmt::format("{}({}/{})", description ? *description + " " : string(),
+		m_progressCurrent.load(memory_order_relaxed), m_progressTotal.load(memory_order_relaxed));
+	BNSetBackgroundTaskProgressText(m_object, text.c_str());
+}
+
+
 vector<Ref<BackgroundTask>> BackgroundTask::GetRunningTasks()
 {
 	size_t count;
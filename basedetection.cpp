@@ -18,6 +18,8 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <future>
+#include <thread>
 #include "binaryninjaapi.h"
 
 using namespace BinaryNinja;
@@ -52,6 +54,27 @@ bool BaseAddressDetection::DetectBaseAddress(BaseAddressDetectionSettings& setti
 }
 
 
+bool BaseAddressDetection::DetectBaseAddress(BaseAddressDetectionSettings& settings, const ScoresCallback& callback,
+    std::chrono::milliseconds pollInterval)
+{
+    std::promise<bool> promise;
+    std::future<bool> detected = promise.get_future();
+    std::thread worker([&]() { promise.set_value(DetectBaseAddress(settings)); });
+
+    while (detected.wait_for(pollInterval) != std::future_status::ready)
+    {
+        BNBaseAddressDetectionConfidence confidence = NoConfidence;
+        uint64_t lastTestedBaseAddress = 0;
+        auto scores = GetScores(&confidence, &lastTestedBaseAddress);
+        if (!IsAborted() && !callback(scores, confidence, lastTestedBaseAddress))
+            Abort();
+    }
+
+    worker.join();
+    return detected.get();
+}
+
+
 void BaseAddressDetection::Abort()
 {
     return BNAbortBaseAddressDetection(m_object);
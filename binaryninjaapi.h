@@ -30,12 +30,14 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <list>
 #include <unordered_map>
 #include <unordered_set>
 #include <exception>
 #include <functional>
 #include <set>
 #include <mutex>
+#include <shared_mutex>
 #include <atomic>
 #include <memory>
 #include <cstdint>
@@ -45,6 +47,8 @@
 #include <optional>
 #include <memory>
 #include <any>
+#include <tuple>
+#include <chrono>
 #include "binaryninjacore.h"
 #include "exceptions.h"
 #include "json/json.h"
@@ -156,6 +160,8 @@ namespace BinaryNinja {
 			return obj->GetObject();
 		}
 
+		static T* NewObjectReference(T* obj) { return AddObjectReference(obj); }
+
 		// This is needed by code like
 		// bool operator==(const T* obj) const { return T::GetObject(m_obj) == T::GetObject(obj); }
 		static T* GetObject(const CoreRefCountObject* obj)
@@ -268,7 +274,9 @@ namespace BinaryNinja {
 			}
 		}
 
-		Ref(Ref<T>&& other) : m_obj(other.m_obj)
+		// Moves must be noexcept, or containers of Ref copy their elements when they grow, which costs
+		// a core reference round trip per element
+		Ref(Ref<T>&& other) noexcept : m_obj(other.m_obj)
 		{
 			other.m_obj = 0;
 #ifdef BN_REF_COUNT_DEBUG
@@ -304,8 +312,10 @@ namespace BinaryNinja {
 			return *this;
 		}
 
-		Ref<T>& operator=(Ref<T>&& other)
+		Ref<T>& operator=(Ref<T>&& other) noexcept
 		{
+			if (this == &other)
+				return *this;
 			if (m_obj)
 			{
 #ifdef BN_REF_COUNT_DEBUG
@@ -384,6 +394,54 @@ namespace BinaryNinja {
 		T* GetPtr() const { return m_obj; }
 	};
 
+	/*! A list of objects returned by the core, left in the core's array and freed in one call
+
+	    Nothing is allocated per element until an element is wrapped with operator[], so callers that only
+	    look at some of the elements, or only need their core handles, don't pay for wrapping the rest. Use
+	    the vector returning APIs for lists that need to be kept around.
+
+	    \ingroup refcount
+	*/
+	template <class T>
+	class BorrowedList
+	{
+	public:
+		using Handle = decltype(T::GetObject((T*)nullptr));
+		using FreeFunction = void (*)(Handle*, size_t);
+
+	private:
+		Handle* m_objects;
+		size_t m_count;
+		FreeFunction m_free;
+
+	public:
+		BorrowedList(Handle* objects, size_t count, FreeFunction freeList) :
+		    m_objects(objects), m_count(count), m_free(freeList)
+		{}
+		BorrowedList(const BorrowedList&) = delete;
+		BorrowedList& operator=(const BorrowedList&) = delete;
+		BorrowedList(BorrowedList&& other) noexcept :
+		    m_objects(other.m_objects), m_count(other.m_count), m_free(other.m_free)
+		{
+			other.m_objects = nullptr;
+			other.m_count = 0;
+		}
+		~BorrowedList()
+		{
+			if (m_objects)
+				m_free(m_objects, m_count);
+		}
+
+		size_t size() const { return m_count; }
+		bool empty() const { return m_count == 0; }
+
+		/*! Core handle of an element, valid for the lifetime of the list */
+		Handle GetObject(size_t i) const { return m_objects[i]; }
+
+		/*! Wraps an element in a reference that can outlive the list */
+		Ref<T> operator[](size_t i) const { return new T(T::NewObjectReference(m_objects[i])); }
+	};
+
 	/*!
 		\ingroup confidence
 	*/
@@ -564,6 +622,65 @@ namespace BinaryNinja {
 		virtual BNLogLevel GetLogLevel() { return WarningLog; }
 	};
 
+	struct LogMessageEntry
+	{
+		size_t session;
+		BNLogLevel level;
+		std::string message;
+		std::string loggerName;
+		size_t threadId;
+	};
+
+	/*! A LogListener that receives messages in batches on its own thread
+
+		LogMessage only copies the message into a fixed size queue owned by the calling thread, which needs no
+		locks, so a slow listener can't stall the threads that log. A dispatcher thread collects the queued
+		messages from every thread and passes them to LogMessagesBatch, sorted into the order they were logged.
+
+		When a thread logs faster than the dispatcher keeps up and its queue is full, new messages from that
+		thread are dropped rather than waiting. The number dropped is passed to the next batch and counted by
+		GetDroppedMessageCount.
+
+		Subclasses must call Stop in their destructor, before they are destroyed, so no batch is delivered
+		to a partly destroyed listener.
+
+		\ingroup logging
+	*/
+	class AsyncLogListener : public LogListener
+	{
+		struct State;
+		std::shared_ptr<State> m_state;
+
+	  public:
+		/*!
+			\param queueCapacity Number of messages each logging thread can have waiting for delivery
+			\param batchIntervalMs Longest time a message waits before it is delivered
+		*/
+		AsyncLogListener(size_t queueCapacity = 1024, uint32_t batchIntervalMs = 50);
+		virtual ~AsyncLogListener();
+
+		void LogMessage(size_t session, BNLogLevel level, const std::string& msg, const std::string& logger_name = "",
+		    size_t tid = 0) override;
+
+		/*! Called on the dispatcher thread with messages in the order they were logged
+
+			\param messages Messages logged since the previous batch
+			\param dropped Number of messages dropped since the previous batch because a queue was full
+		*/
+		virtual void LogMessagesBatch(const std::vector<LogMessageEntry>& messages, uint64_t dropped) = 0;
+
+		/*! Block until every message logged before the call has been delivered */
+		void Flush();
+
+		/*! Deliver any remaining messages and stop the dispatcher thread
+
+			Messages logged after this returns are dropped. Calling it again has no effect.
+		*/
+		void Stop();
+
+		uint64_t GetDroppedMessageCount() const;
+	};
+
 	class Architecture;
 	class BackgroundTask;
 	class Platform;
@@ -840,6 +957,9 @@ namespace BinaryNinja {
 	{
 			size_t GetThreadId() const;
 			std::unordered_map<BNLogLevel, std::string> m_iterBuffer;
+			// Neither can change after creation, so they're read once instead of on every message
+			std::string m_name;
+			size_t m_sessionId;
 			friend struct Iterator;
 
 			void LogFV(BNLogLevel level, fmt::string_view format, fmt::format_args args);
@@ -1460,6 +1580,140 @@ namespace BinaryNinja {
 		bool IsKeyValueStore() const;
 	};
 
+	/*! MetadataBuilder encodes a tree of values into one compact buffer that is stored as a single raw Metadata
+		object, instead of creating a core object for every node. Use it for large structures that are only ever
+		read back as a whole, and read them with MetadataBlob.
+
+		Values are appended in order. Arrays and key-value stores are opened with BeginArray / BeginKeyValueStore
+		and closed with EndArray / EndKeyValueStore; inside a key-value store every value is preceded by Key.
+
+		\code{.cpp}
+		MetadataBuilder builder;
+		builder.BeginKeyValueStore();
+		builder.Key("name").String("libobjc.dylib");
+		builder.Key("addresses").BeginArray();
+		for (uint64_t address : addresses)
+			builder.UnsignedInteger(address);
+		builder.EndArray();
+		builder.EndKeyValueStore();
+		view->StoreMetadata("example", builder.Finalize());
+		\endcode
+
+		\ingroup binaryview
+	*/
+	class MetadataBuilder
+	{
+		struct OpenContainer
+		{
+			MetadataType type;
+			size_t header;
+			uint32_t count;
+			bool hasKey;
+		};
+
+		std::vector<uint8_t> m_data;
+		std::vector<OpenContainer> m_open;
+
+		void BeginValue(MetadataType type);
+		void AppendInteger(uint64_t value, size_t size);
+		void AppendLength(uint64_t length);
+		void AppendBytes(const void* data, size_t len);
+		void BeginContainer(MetadataType type);
+		void EndContainer(MetadataType type);
+
+	  public:
+		MetadataBuilder();
+
+		MetadataBuilder& Boolean(bool value);
+		MetadataBuilder& String(std::string_view value);
+		MetadataBuilder& UnsignedInteger(uint64_t value);
+		MetadataBuilder& SignedInteger(int64_t value);
+		MetadataBuilder& Double(double value);
+		MetadataBuilder& Raw(const void* data, size_t len);
+
+		MetadataBuilder& BeginArray();
+		MetadataBuilder& EndArray();
+		MetadataBuilder& BeginKeyValueStore();
+		MetadataBuilder& Key(std::string_view key);
+		MetadataBuilder& EndKeyValueStore();
+
+		/*! The encoded buffer, valid once every array and key-value store has been closed */
+		const std::vector<uint8_t>& GetEncoded() const { return m_data; }
+
+		/*! Create the raw Metadata object holding the encoded buffer
+
+			\throws std::logic_error if an array or key-value store is still open
+		*/
+		Ref<Metadata> Finalize() const;
+	};
+
+	/*! A value inside a buffer written by MetadataBuilder. It points into the buffer, which has to outlive it, and
+		reading it copies nothing. Reading a value as the wrong type returns a default value, like Metadata does.
+
+		\ingroup binaryview
+	*/
+	class MetadataBlobValue
+	{
+		const uint8_t* m_data = nullptr;
+		size_t m_length = 0;
+
+		friend class MetadataBlob;
+		MetadataBlobValue(const uint8_t* data, size_t length) : m_data(data), m_length(length) {}
+
+		// Container header: item count and size in bytes of the items that follow
+		bool GetContainer(MetadataType type, uint32_t& count, const uint8_t*& items, const uint8_t*& end) const;
+
+	  public:
+		MetadataBlobValue() = default;
+
+		bool IsValid() const { return m_data != nullptr; }
+		MetadataType GetType() const;
+
+		bool GetBoolean() const;
+		std::string_view GetString() const;
+		uint64_t GetUnsignedInteger() const;
+		int64_t GetSignedInteger() const;
+		double GetDouble() const;
+		std::string_view GetRaw() const;
+
+		/*! Number of items of an array or key-value store */
+		size_t GetSize() const;
+
+		/*! Call func on every item of an array, stopping early if it returns false */
+		void ForEach(const std::function<bool(const MetadataBlobValue&)>& func) const;
+
+		/*! Call func on every entry of a key-value store, stopping early if it returns false */
+		void ForEach(const std::function<bool(std::string_view, const MetadataBlobValue&)>& func) const;
+
+		/*! The value stored under key in a key-value store, invalid if there isn't one. This is a linear search,
+			use ForEach to read every entry.
+		*/
+		MetadataBlobValue Get(std::string_view key) const;
+	};
+
+	/*! Reads a buffer written by MetadataBuilder out of a raw Metadata object. The bytes are taken from the core
+		once and all values read from it refer to them.
+
+		\ingroup binaryview
+	*/
+	class MetadataBlob
+	{
+		uint8_t* m_data = nullptr;
+		size_t m_length = 0;
+
+	  public:
+		explicit MetadataBlob(Ref<Metadata> metadata);
+		~MetadataBlob();
+		MetadataBlob(const MetadataBlob&) = delete;
+		MetadataBlob& operator=(const MetadataBlob&) = delete;
+
+		/*! Whether metadata held a buffer written by MetadataBuilder */
+		bool IsValid() const;
+
+		/*! The root value; invalid if IsValid is false */
+		MetadataBlobValue GetRoot() const;
+	};
+
 	class BinaryView;
 	class ProjectFile;
 
@@ -1557,6 +1811,36 @@ namespace BinaryNinja {
 	*/
 	Ref<BinaryView> Load(const std::string& filename, bool updateAnalysis, std::function<bool(size_t, size_t)> progress, Ref<Metadata> options = new Metadata(MetadataType::KeyValueDataType));
 
+	/*!
+		One object file of a Universal archive, as loaded by LoadUniversalSlices
+	*/
+	struct UniversalSlice
+	{
+		std::string architecture;
+		uint64_t offset = 0;
+		uint64_t size = 0;
+		// Null if the slice failed to load or loading was cancelled
+		Ref<BinaryView> view;
+	};
+
+	/*! Open every object file of a Universal archive at once
+
+		Each slice is loaded, and analyzed when \c updateAnalysis is set, on its own thread and in its own
+		session, as Load would with `files.universal.architecturePreference` set to that slice. Type libraries
+		and other core-wide state are shared between them as for any other views.
+
+		\warn Call GetFile()->Close() on every returned view when you are finished with it.
+
+	    \param filename Path to the Universal archive
+	    \param updateAnalysis If true, analysis of every slice is waited for
+	    \param options A Json string of settings applied to every slice
+	    \param progress Optional function called with the combined progress of all slices. If it returns
+	                    false, every load is cancelled.
+	    \return The slices in archive order, or an empty list if \c filename is not a Universal archive
+	*/
+	std::vector<UniversalSlice> LoadUniversalSlices(const std::string& filename, bool updateAnalysis = true,
+	    const std::string& options = "{}", std::function<bool(size_t, size_t)> progress = {});
+
 	/*!
 		Deprecated. Use non-metadata version.
 	*/
@@ -1713,6 +1997,21 @@ namespace BinaryNinja {
 	*/
 	void ExecuteOnMainThreadAndWait(const std::function<void()>& action);
 
+	/*! Run an action on the main thread, batched with other coalesced actions
+
+		Actions queued before the main thread gets to them all run from a single main thread callback, in the
+		order they were queued. When \c key is not empty and an action with the same key is still waiting, that
+		action is replaced by this one and keeps its place, so repeated refresh requests run once with the most
+		recent state.
+
+		@threadsafe
+		\ingroup mainthread
+
+		\param action Action to run
+		\param key Optional key identifying actions that supersede each other
+	*/
+	void ExecuteOnMainThreadCoalesced(const std::function<void()>& action, const std::string& key = "");
+
 	/*!
 		@threadsafe
 		\ingroup mainthread
@@ -2245,6 +2544,43 @@ namespace BinaryNinja {
 		bool XzDecompress(DataBuffer& output) const;
 	};
 
+	/*! ViewBuffer is a read-only, reference-counted range of bytes read from a BinaryView
+
+		Copies of a ViewBuffer and slices taken with Slice share the same storage, so a loader can read a large
+		region (a string table, \c __LINKEDIT) once and hand out sub-ranges without copying. The pointer returned by
+		GetData stays valid for as long as any ViewBuffer referring to the storage is alive.
+
+	 	\ingroup databuffer
+	*/
+	class ViewBuffer
+	{
+		std::shared_ptr<const DataBuffer> m_storage;
+		const uint8_t* m_data = nullptr;
+		size_t m_length = 0;
+
+	  public:
+		ViewBuffer() = default;
+		ViewBuffer(DataBuffer&& buffer);
+
+		const uint8_t* GetData() const { return m_data; }
+		const uint8_t* GetDataAt(size_t offset) const { return m_data + offset; }
+		size_t GetLength() const { return m_length; }
+		bool IsEmpty() const { return m_length == 0; }
+
+		const uint8_t* begin() const { return m_data; }
+		const uint8_t* end() const { return m_data + m_length; }
+
+		/*! Get a sub-range of this buffer that shares its storage
+
+			The range is clamped to the end of this buffer.
+
+			\param offset Offset of the sub-range within this buffer
+			\param len Length of the sub-range
+			\return ViewBuffer referring to the sub-range
+		*/
+		ViewBuffer Slice(size_t offset, size_t len) const;
+	};
+
 	/*! TemporaryFile is used for creating temporary files, stored (temporarily) in the system's default temporary file
 	 		directory.
 
@@ -2442,8 +2778,35 @@ namespace BinaryNinja {
 		DataBuffer GetValueHash(const std::string& name) const;
 		DataBuffer GetBuffer(const std::string& name) const;
 		void SetValue(const std::string& name, const Json::Value& value);
+
+		/*! Store a value that is already serialized as JSON, without parsing it into a Json::Value first. Callers
+			that produce their values with another JSON library can write them directly, and read them back
+			without a Json::Value with GetBuffer, whose contents are the same JSON text.
+
+			\param name Key to store the value under
+			\param json Value as a JSON document
+		*/
+		void SetSerializedValue(const std::string& name, const std::string& json);
 		void SetBuffer(const std::string& name, const DataBuffer& value);
 
+		/*! Store a buffer compressed, for large values that are read back one key at a time. The value stays
+			compressed in the store, in memory and in the database, and only the key that is read with
+			GetDecompressedBuffer is inflated. Values that don't get smaller are stored as they are.
+
+			\param name Key to store the value under
+			\param value Uncompressed value
+		*/
+		void SetCompressedBuffer(const std::string& name, const DataBuffer& value);
+
+		/*! Read a buffer stored with SetCompressedBuffer, decompressing only this key. Values stored with SetBuffer
+			are returned unchanged, so readers don't need to know how a key was written.
+
+			\param name Key of the value
+			\return Uncompressed value
+			\throws DatabaseException if the key doesn't exist or its value can't be decompressed
+		*/
+		DataBuffer GetDecompressedBuffer(const std::string& name) const;
+
 		DataBuffer GetSerializedData() const;
 
 		void BeginNamespace(const std::string& name);
@@ -2522,6 +2885,87 @@ namespace BinaryNinja {
 
 		Ref<KeyValueStore> ReadAnalysisCache() const;
 		void WriteAnalysisCache(Ref<KeyValueStore> val);
+
+		/*! Store \c data for a snapshot, split into content-defined chunks that are shared across snapshots.
+
+			Chunk boundaries depend only on nearby content, so an edit only changes the chunks around it and
+			a new snapshot of mostly unchanged data writes little more than a list of chunk hashes.
+
+			\param snapshotId Snapshot the data belongs to, as returned by WriteSnapshotData
+			\param key Name of the data within the snapshot
+			\param data Data to store
+			\return Number of bytes in chunks that weren't already stored
+		*/
+		uint64_t WriteChunkedData(int64_t snapshotId, const std::string& key, const DataBuffer& data);
+		DataBuffer ReadChunkedData(int64_t snapshotId, const std::string& key) const;
+		bool HasChunkedData(int64_t snapshotId, const std::string& key) const;
+
+		/*! Release chunks no longer referenced by any snapshot that still has data.
+
+			Run after TrimSnapshot or RemoveSnapshot. Released chunks are emptied; space is returned to the
+			file on the next vacuum.
+
+			\return Number of bytes released
+		*/
+		uint64_t CompactChunkedData();
+
+		/*! Run CompactChunkedData on a worker thread
+
+			\param completion Called on the worker thread with the number of bytes released
+		*/
+		void CompactChunkedDataInBackground(const std::function<void(uint64_t)>& completion = {});
+	};
+
+	class Function;
+
+	/*! Keyed binary data kept in a database and read only when first asked for.
+
+		Data stored with BinaryView::StoreMetadata is deserialized in full when a database is opened.
+		For per-function state that analysts rarely look at all of, such as cached plugin results or
+		annotations, this keeps each key in its own database global and loads only a small index up front.
+		Values are read on first Get and cached; Set and Remove take effect in memory until Flush.
+
+		\note Globals are not part of snapshots, so values aren't affected by undo or by opening an older
+		snapshot.
+
+		\ingroup database
+	*/
+	class LazyDatabaseStore
+	{
+		Ref<Database> m_database;
+		std::string m_prefix;
+
+		mutable std::mutex m_mutex;
+		std::set<std::string> m_keys;
+		std::unordered_map<std::string, DataBuffer> m_loaded;
+		std::set<std::string> m_dirty;
+		bool m_indexDirty = false;
+
+		std::string GetIndexKey() const;
+
+	  public:
+		/*!
+			\param database Database to keep the data in
+			\param name Namespace for the data, usually the plugin name
+		*/
+		LazyDatabaseStore(Ref<Database> database, const std::string& name);
+
+		/*! Key identifying a function, stable across sessions */
+		static std::string GetFunctionKey(Function* func);
+
+		std::vector<std::string> GetKeys() const;
+		bool Has(const std::string& key) const;
+
+		/*! Value of \c key, read from the database the first time it is needed */
+		std::optional<DataBuffer> Get(const std::string& key);
+		void Set(const std::string& key, const DataBuffer& value);
+		void Remove(const std::string& key);
+
+		/*! Write changed values and the index to the database */
+		void Flush();
+
+		/*! Number of values currently held in memory */
+		size_t GetLoadedCount() const;
 	};
 
 
@@ -2773,6 +3217,18 @@ namespace BinaryNinja {
 	};
 
 
+	/*! One file for Project::CreateFilesFromPaths
+
+		\ingroup project
+	*/
+	struct ProjectFileImport
+	{
+		std::string path;
+		Ref<ProjectFolder> folder;
+		std::string name;
+		std::string description;
+	};
+
 	/*!
 
 		\ingroup project
@@ -2813,6 +3269,15 @@ namespace BinaryNinja {
 		Ref<ProjectFile> CreateFileFromPathUnsafe(const std::string& path, Ref<ProjectFolder> folder, const std::string& name, const std::string& description, const std::string& id, int64_t creationTimestamp, const std::function<bool(size_t progress, size_t total)>& progressCallback = {});
 		Ref<ProjectFile> CreateFile_(const std::vector<uint8_t>& contents, Ref<ProjectFolder> folder, const std::string& name, const std::string& description, const std::function<bool(size_t progress, size_t total)>& progressCallback = {});
 		Ref<ProjectFile> CreateFileUnsafe(const std::vector<uint8_t>& contents, Ref<ProjectFolder> folder, const std::string& name, const std::string& description, const std::string& id, int64_t creationTimestamp, const std::function<bool(size_t progress, size_t total)>& progressCallback = {});
+		/*! Import many files at once. Files are read and hashed on \c threads worker threads (0 for one per core)
+			while the calling thread registers them inside a single bulk operation. Files with identical contents
+			are only added once.
+
+			\return One entry per import, in order: the new file, the earlier file with the same contents, or
+				nullptr if the file could not be read or added (or the import was cancelled)
+		*/
+		std::vector<Ref<ProjectFile>> CreateFilesFromPaths(const std::vector<ProjectFileImport>& imports,
+			const std::function<bool(size_t progress, size_t total)>& progressCallback = {}, size_t threads = 0);
 		std::vector<Ref<ProjectFile>> GetFiles() const;
 		Ref<ProjectFile> GetFileById(const std::string& id) const;
 		Ref<ProjectFile> GetFileByPathOnDisk(const std::string& path);
@@ -2826,6 +3291,61 @@ namespace BinaryNinja {
 		void EndBulkOperation();
 	};
 
+	/*! Exported symbols of the files of a project, for resolving ExternalLocations by name without opening the
+		library they point at.
+
+		The exports of a file are read by loading it without analysis the first time they are needed, and are
+		stored in the project metadata under \c "exportIndex.<file id>" along with the size and modification time
+		of the file on disk, so other sessions reuse them until the file changes. Lookups after that are a hash
+		probe.
+
+		@threadsafe
+
+		\ingroup project
+	*/
+	class ProjectExportIndex
+	{
+	  public:
+		using Exports = std::unordered_map<std::string, uint64_t>;
+
+	  private:
+		struct Entry
+		{
+			uint64_t size;
+			int64_t modified;
+			std::shared_ptr<const Exports> exports;
+		};
+
+		Ref<Project> m_project;
+		std::mutex m_mutex;
+		std::unordered_map<std::string, Entry> m_entries;  // By file id
+
+		static std::shared_ptr<const Exports> ReadExports(ProjectFile* file);
+
+	  public:
+		ProjectExportIndex(Project* project);
+
+		/*! The index shared by every caller for \c project, created on first use */
+		static std::shared_ptr<ProjectExportIndex> GetForProject(Project* project);
+
+		/*! Exported symbols of \c file by raw name, built or reloaded if the file has changed
+
+			\return The exports, or nullptr if the file can't be loaded
+		*/
+		std::shared_ptr<const Exports> GetExports(ProjectFile* file);
+
+		/*! Address of the export named \c name of \c file */
+		std::optional<uint64_t> Lookup(ProjectFile* file, const std::string& name);
+
+		/*! Address that \c location points at in the backing file of its library: the target address if it
+			has one, else the address of its target symbol
+		*/
+		std::optional<uint64_t> Resolve(ExternalLocation* location);
+
+		/*! Drop the exports of \c file, here and in the project metadata, so they are read again */
+		void Invalidate(ProjectFile* file);
+	};
+
 	/*!
 
 		\ingroup undo
@@ -3146,6 +3666,65 @@ namespace BinaryNinja {
 		void SetProjectFile(Ref<ProjectFile> projectFile);
 	};
 
+	/*! Records a scripted bulk edit as one undo entry instead of one per change.
+
+		Call Add as items are changed so the batch can enforce maxItems. Once that many items have been recorded the
+		batch stops keeping undo state: what was recorded is forgotten and the rest of the batch is recorded and
+		forgotten in chunks of maxItems, so a script renaming hundreds of thousands of variables doesn't grow the
+		undo history, and the database, without bound. The changes themselves are always kept.
+
+		The batch is committed when it goes out of scope. If it is destroyed by an exception and is still fully
+		recorded, the changes are reverted instead.
+
+		\code{.cpp}
+		UndoBatch batch(view->GetFile(), 10000);
+		for (auto& func : view->GetAnalysisFunctionList())
+		{
+			func->SetComment(func->GetStart(), "reviewed");
+			batch.Add();
+		}
+		\endcode
+
+		\ingroup undo
+	*/
+	class UndoBatch
+	{
+		Ref<FileMetadata> m_file;
+		std::string m_id;
+		size_t m_maxItems;
+		size_t m_items = 0;
+		size_t m_chunkItems = 0;
+		int m_uncaughtExceptions;
+		bool m_recording = true;
+		bool m_finished = false;
+
+	  public:
+		/*!
+			\param file File to record the changes of
+			\param maxItems Number of items after which undo state is no longer kept, 0 keeps all of it
+		*/
+		UndoBatch(FileMetadata* file, size_t maxItems = 0);
+		~UndoBatch();
+		UndoBatch(const UndoBatch&) = delete;
+		UndoBatch& operator=(const UndoBatch&) = delete;
+
+		/*! Count items changed since the last call */
+		void Add(size_t count = 1);
+
+		/*! Whether the whole batch can still be undone, false once maxItems has been exceeded */
+		bool IsRecording() const { return m_recording; }
+		size_t GetItemCount() const { return m_items; }
+
+		/*! End the batch, keeping its changes */
+		void Commit();
+
+		/*! End the batch and undo its changes
+
+			\throws std::logic_error if undo state has already been dropped because of maxItems
+		*/
+		void Revert();
+	};
+
 	class Function;
 	struct DataVariable;
 	class Tag;
@@ -3727,27 +4306,185 @@ namespace BinaryNinja {
 	};
 
 	/*!
-		\ingroup fileaccessor
+		\ingroup binaryview
 	*/
-	class FileAccessor
+	struct FunctionInvalidation
 	{
-	  protected:
-		BNFileAccessor m_callbacks;
+		Ref<Function> function;
+		// The most recent edit seen before the function was first marked for update, or empty if none was
+		std::string reason;
+		size_t updateRequests;
+		size_t updates;
+	};
 
-	  private:
-		static uint64_t GetLengthCallback(void* ctxt);
-		static size_t ReadCallback(void* ctxt, void* dest, uint64_t offset, size_t len);
-		static size_t WriteCallback(void* ctxt, uint64_t offset, const void* src, size_t len);
+	/*! Records which functions are marked for re-analysis while it exists, and the edit that preceded them
 
-	  public:
-		FileAccessor();
-		FileAccessor(BNFileAccessor* accessor);
-		virtual ~FileAccessor() {}
+		Register one before making an edit, run the analysis update, then inspect GetInvalidatedFunctions to see
+		how far the edit propagated:
 
-		BNFileAccessor* GetCallbacks() { return &m_callbacks; }
+		\code{.cpp}
+		AnalysisUpdateRecorder recorder(view);
+		view->DefineUserType(name, type);
+		view->UpdateAnalysisAndWait();
+		for (auto& entry : recorder.GetInvalidatedFunctions())
+			LogInfo("0x%" PRIx64 ": %s", entry.function->GetStart(), entry.reason.c_str());
+		\endcode
 
-		virtual bool IsValid() const = 0;
-		virtual uint64_t GetLength() const = 0;
+		The reason is attributed from notification order: it is the last type, symbol, data or data variable
+		change posted before the function's first update request, not a cause reported by the core.
+
+		\ingroup binaryview
+	*/
+	class AnalysisUpdateRecorder : public BinaryDataNotification
+	{
+		Ref<BinaryView> m_view;
+		std::mutex m_mutex;
+		std::string m_lastEdit;
+		std::vector<FunctionInvalidation> m_functions;
+		std::unordered_map<BNFunction*, size_t> m_functionIndex;
+
+		void NoteEdit(std::string description);
+		FunctionInvalidation& GetEntry(Function* func);
+
+	  public:
+		AnalysisUpdateRecorder(BinaryView* view);
+		virtual ~AnalysisUpdateRecorder();
+
+		/*! Functions marked for update since construction or the last Reset, in the order first marked */
+		std::vector<FunctionInvalidation> GetInvalidatedFunctions();
+		void Reset();
+
+		void OnBinaryDataWritten(BinaryView* view, uint64_t offset, size_t len) override;
+		void OnAnalysisFunctionUpdated(BinaryView* view, Function* func) override;
+		void OnAnalysisFunctionUpdateRequested(BinaryView* view, Function* func) override;
+		void OnDataVariableAdded(BinaryView* view, const DataVariable& var) override;
+		void OnDataVariableRemoved(BinaryView* view, const DataVariable& var) override;
+		void OnDataVariableUpdated(BinaryView* view, const DataVariable& var) override;
+		void OnSymbolAdded(BinaryView* view, Symbol* sym) override;
+		void OnSymbolRemoved(BinaryView* view, Symbol* sym) override;
+		void OnSymbolUpdated(BinaryView* view, Symbol* sym) override;
+		void OnTypeDefined(BinaryView* data, const QualifiedName& name, Type* type) override;
+		void OnTypeUndefined(BinaryView* data, const QualifiedName& name, Type* type) override;
+		void OnTypeReferenceChanged(BinaryView* data, const QualifiedName& name, Type* type) override;
+		void OnTypeFieldReferenceChanged(BinaryView* data, const QualifiedName& name, uint64_t offset) override;
+	};
+
+	/*! A BinaryDataNotification that delivers function, data variable and symbol changes in batches
+
+		The types passed as \c batched are collected as they are posted and handed to the batch callbacks
+		(OnAnalysisFunctionsAdded and so on) from the next notification barrier. The barrier is deferred by
+		\c intervalMs while changes keep arriving. Within a batch each object appears once:
+		- Repeated updates are merged.
+		- An object added and removed in the same batch is not reported.
+		- An object removed and added again is reported as updated.
+
+		Types passed as \c immediate are delivered through the usual per-object callbacks. For batched types,
+		override the batch callback rather than the per-object one, which this class uses to collect changes.
+		Like the per-object callbacks, batch callbacks run while analysis waits for them, so hand expensive
+		work off to another thread. Subclasses that override OnNotificationBarrier must call this class's
+		implementation and use its return value.
+
+		\ingroup binaryview
+	*/
+	class BatchedBinaryDataNotification : public BinaryDataNotification
+	{
+		struct State;
+		std::unique_ptr<State> m_state;
+		NotificationTypes m_batched;
+
+	  public:
+		/*!
+			\param batched Types to batch, any of FunctionAdded, FunctionRemoved, FunctionUpdated,
+				DataVariableAdded, DataVariableRemoved, DataVariableUpdated, SymbolAdded, SymbolRemoved and SymbolUpdated
+			\param immediate Other types to receive through the per-object callbacks
+			\param intervalMs Time between batches while changes keep arriving
+		*/
+		BatchedBinaryDataNotification(NotificationTypes batched, NotificationTypes immediate = 0, uint32_t intervalMs = 100);
+		virtual ~BatchedBinaryDataNotification();
+
+		/*! Deliver everything collected for \c view so far, e.g. before unregistering */
+		void Flush(BinaryView* view);
+
+		virtual void OnAnalysisFunctionsAdded(BinaryView* view, const std::vector<Ref<Function>>& funcs)
+		{
+			(void)view;
+			(void)funcs;
+		}
+		virtual void OnAnalysisFunctionsRemoved(BinaryView* view, const std::vector<Ref<Function>>& funcs)
+		{
+			(void)view;
+			(void)funcs;
+		}
+		virtual void OnAnalysisFunctionsUpdated(BinaryView* view, const std::vector<Ref<Function>>& funcs)
+		{
+			(void)view;
+			(void)funcs;
+		}
+		virtual void OnDataVariablesAdded(BinaryView* view, const std::vector<DataVariable>& vars)
+		{
+			(void)view;
+			(void)vars;
+		}
+		virtual void OnDataVariablesRemoved(BinaryView* view, const std::vector<DataVariable>& vars)
+		{
+			(void)view;
+			(void)vars;
+		}
+		virtual void OnDataVariablesUpdated(BinaryView* view, const std::vector<DataVariable>& vars)
+		{
+			(void)view;
+			(void)vars;
+		}
+		virtual void OnSymbolsAdded(BinaryView* view, const std::vector<Ref<Symbol>>& syms)
+		{
+			(void)view;
+			(void)syms;
+		}
+		virtual void OnSymbolsRemoved(BinaryView* view, const std::vector<Ref<Symbol>>& syms)
+		{
+			(void)view;
+			(void)syms;
+		}
+		virtual void OnSymbolsUpdated(BinaryView* view, const std::vector<Ref<Symbol>>& syms)
+		{
+			(void)view;
+			(void)syms;
+		}
+
+		uint64_t OnNotificationBarrier(BinaryView* view) override;
+		void OnAnalysisFunctionAdded(BinaryView* view, Function* func) override;
+		void OnAnalysisFunctionRemoved(BinaryView* view, Function* func) override;
+		void OnAnalysisFunctionUpdated(BinaryView* view, Function* func) override;
+		void OnDataVariableAdded(BinaryView* view, const DataVariable& var) override;
+		void OnDataVariableRemoved(BinaryView* view, const DataVariable& var) override;
+		void OnDataVariableUpdated(BinaryView* view, const DataVariable& var) override;
+		void OnSymbolAdded(BinaryView* view, Symbol* sym) override;
+		void OnSymbolRemoved(BinaryView* view, Symbol* sym) override;
+		void OnSymbolUpdated(BinaryView* view, Symbol* sym) override;
+	};
+
+	/*!
+		\ingroup fileaccessor
+	*/
+	class FileAccessor
+	{
+	  protected:
+		BNFileAccessor m_callbacks;
+
+	  private:
+		static uint64_t GetLengthCallback(void* ctxt);
+		static size_t ReadCallback(void* ctxt, void* dest, uint64_t offset, size_t len);
+		static size_t WriteCallback(void* ctxt, uint64_t offset, const void* src, size_t len);
+
+	  public:
+		FileAccessor();
+		FileAccessor(BNFileAccessor* accessor);
+		virtual ~FileAccessor() {}
+
+		BNFileAccessor* GetCallbacks() { return &m_callbacks; }
+
+		virtual bool IsValid() const = 0;
+		virtual uint64_t GetLength() const = 0;
 		virtual size_t Read(void* dest, uint64_t offset, size_t len) = 0;
 		virtual size_t Write(uint64_t offset, const void* src, size_t len) = 0;
 	};
@@ -3767,6 +4504,85 @@ namespace BinaryNinja {
 		virtual size_t Write(uint64_t offset, const void* src, size_t len) override;
 	};
 
+	/*!
+		How a PrefetchingFileAccessor should expect to be read
+
+		\ingroup fileaccessor
+	*/
+	enum FileAccessPattern
+	{
+		NormalFileAccess,      // Read ahead once a read starts where the previous one ended
+		SequentialFileAccess,  // Always read ahead of every read
+		RandomFileAccess       // Never read ahead, only fetch what is read or prefetched
+	};
+
+	/*!
+		Block cache over another FileAccessor with read-ahead and prefetching on worker threads
+
+		Reads of an accessor backed by remote storage or a debugger are slow and block the analysis thread that
+		makes them. Wrapping the accessor in a PrefetchingFileAccessor keeps recently read blocks, reads ahead of
+		sequential reads and lets callers queue the ranges they are about to need with Prefetch, so several reads
+		of the underlying accessor are outstanding at once and later reads are served from memory. Use it in
+		place of the underlying accessor, for example with BinaryView::AddRemoteMemoryRegion.
+
+		The underlying accessor must outlive this object and its Read must be safe to call from several threads
+		at once when threadCount is more than one. Writes go straight to the underlying accessor and drop the
+		blocks they overlap.
+
+		\ingroup fileaccessor
+	*/
+	class PrefetchingFileAccessor : public FileAccessor
+	{
+		struct State;
+		std::unique_ptr<State> m_state;
+
+	  public:
+		PrefetchingFileAccessor(FileAccessor* accessor, size_t threadCount = 4, size_t blockSize = 0x10000,
+		    size_t maxCachedBlocks = 1024);
+		virtual ~PrefetchingFileAccessor();
+
+		void SetAccessPattern(FileAccessPattern pattern);
+
+		/*! Set how many blocks past the end of a sequential read are fetched in the background
+
+			\param blocks Number of blocks to read ahead, 0 to disable read-ahead
+		*/
+		void SetReadAhead(size_t blocks);
+
+		/*! Queue a range to be fetched in the background
+
+			\param offset Start of the range
+			\param len Length of the range
+		*/
+		void Prefetch(uint64_t offset, size_t len);
+
+		/*! Queue a list of ranges to be fetched in the background, in the order given
+
+			\param ranges Ranges to fetch, as start and end offsets
+		*/
+		void Prefetch(const std::vector<BNAddressRange>& ranges);
+
+		/*! Read a range on a worker thread
+
+			\param offset Start of the range
+			\param len Length of the range
+			\param callback Called on a worker thread with the data, which is shorter than len at the end of the file.
+				Reads still queued when this accessor is destroyed complete before its destructor returns.
+		*/
+		void ReadAsync(uint64_t offset, size_t len, const std::function<void(DataBuffer)>& callback);
+
+		/*! Wait for all queued prefetches and asynchronous reads to complete */
+		void WaitForPendingReads();
+
+		/*! Drop every cached block, for when the underlying data changed without going through Write */
+		void Invalidate();
+
+		virtual bool IsValid() const override;
+		virtual uint64_t GetLength() const override;
+		virtual size_t Read(void* dest, uint64_t offset, size_t len) override;
+		virtual size_t Write(uint64_t offset, const void* src, size_t len) override;
+	};
+
 	class Function;
 	class BasicBlock;
 
@@ -3885,6 +4701,19 @@ namespace BinaryNinja {
 		static NameSpace FromAPIObject(const BNNameSpace* name);
 	};
 
+	/*! Plain description of a symbol for BinaryView::DefineAutoSymbols
+
+		\ingroup types
+	*/
+	struct SymbolSpec
+	{
+		BNSymbolType type;
+		std::string name;
+		uint64_t address;
+		BNSymbolBinding binding = NoBinding;
+		uint64_t ordinal = 0;
+	};
+
 	/*!
 		\ingroup types
 	*/
@@ -4012,6 +4841,61 @@ namespace BinaryNinja {
 		uint64_t addr;
 	};
 
+	/*! References to many addresses, stored in compressed sparse row form
+
+		The references to the i-th queried address are \c sources[offsets[i]] up to, but not including,
+		\c sources[offsets[i + 1]]. \c offsets has one more entry than the number of queried addresses.
+	*/
+	template <typename T>
+	struct ReferenceTable
+	{
+		std::vector<T> sources;
+		std::vector<size_t> offsets;
+
+		size_t GetTargetCount() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+		const T* begin(size_t target) const { return sources.data() + offsets[target]; }
+		const T* end(size_t target) const { return sources.data() + offsets[target + 1]; }
+	};
+
+	/*! Pages through the code references to an address or range, wrapping only the pages that are read
+
+		The core's list of references is taken when the cursor is created, so GetCount is known right away
+		without creating a Function and Architecture object for each reference. Functions and architectures
+		that appear in several references share one wrapper object.
+
+		\ingroup binaryview
+	*/
+	class CodeReferenceCursor
+	{
+		BNReferenceSource* m_refs = nullptr;
+		size_t m_count = 0;
+		size_t m_position = 0;
+		std::unordered_map<BNFunction*, Ref<Function>> m_functions;
+		std::unordered_map<BNArchitecture*, Ref<Architecture>> m_architectures;
+
+	  public:
+		CodeReferenceCursor(BinaryView* view, uint64_t addr);
+		CodeReferenceCursor(BinaryView* view, uint64_t addr, uint64_t len);
+		CodeReferenceCursor(CodeReferenceCursor&& other);
+		CodeReferenceCursor& operator=(CodeReferenceCursor&& other);
+		CodeReferenceCursor(const CodeReferenceCursor&) = delete;
+		CodeReferenceCursor& operator=(const CodeReferenceCursor&) = delete;
+		~CodeReferenceCursor();
+
+		/*! Total number of references, including those not read yet */
+		size_t GetCount() const { return m_count; }
+		size_t GetPosition() const { return m_position; }
+		bool IsAtEnd() const { return m_position >= m_count; }
+		void Seek(size_t position) { m_position = std::min(position, m_count); }
+
+		/*! Read the next references and advance past them
+
+			\param pageSize Maximum number of references to return
+			\return Up to \c pageSize references, empty once the cursor is at the end
+		*/
+		std::vector<ReferenceSource> Next(size_t pageSize = 256);
+	};
+
 	struct TypeFieldReference
 	{
 		Ref<Function> func;
@@ -4145,6 +5029,24 @@ namespace BinaryNinja {
 		std::vector<ActiveAnalysisInfo> activeInfo;
 	};
 
+	/*! How many functions currently have each IL form generated, see BinaryView::GetILResidency
+
+		\ingroup binaryview
+	*/
+	struct ILResidency
+	{
+		size_t functions;
+		size_t liftedIL;
+		size_t lowLevelIL;
+		size_t mediumLevelIL;
+		size_t highLevelIL;
+		// Instruction totals across the resident functions, as a rough measure of their memory use
+		uint64_t liftedILInstructions;
+		uint64_t lowLevelILInstructions;
+		uint64_t mediumLevelILInstructions;
+		uint64_t highLevelILInstructions;
+	};
+
 	/*!
 		\ingroup binaryview
 	*/
@@ -4378,6 +5280,7 @@ namespace BinaryNinja {
 	class TypeArchive;
 	class MemoryMap;
 	struct HighLevelILInstruction;
+	struct CallGraphSnapshot;
 
 	class QueryMetadataException : public ExceptionWithStackTrace
 	{
@@ -4746,6 +5649,32 @@ namespace BinaryNinja {
 		bool SaveAutoSnapshot(const std::function<bool(size_t progress, size_t total)>& progressCallback,
 		    Ref<SaveSettings> settings = new SaveSettings());
 
+		/*! Write the database (.bndb) to \c path on a background thread, like CreateDatabase.
+
+			Progress is reported through the returned BackgroundTask, and cancelling it aborts the save.
+			Analysis and the UI keep running while the database is written; the core takes the locks it
+			needs as it serializes each part of the analysis.
+
+			\param path path and filename to write the bndb to. Should have ".bndb" appended to it.
+			\param completion Called on the background thread with whether the save succeeded
+			\param settings Special save options
+			\return Task tracking the save, or nullptr if a save of this file is already running
+		*/
+		Ref<BackgroundTask> CreateDatabaseAsync(const std::string& path,
+		    const std::function<void(bool success)>& completion = {}, Ref<SaveSettings> settings = new SaveSettings());
+
+		/*! Save an auto snapshot on a background thread, like SaveAutoSnapshot.
+
+			\param completion Called on the background thread with whether the save succeeded
+			\param settings Special save options
+			\return Task tracking the save, or nullptr if a save of this file is already running
+		*/
+		Ref<BackgroundTask> SaveAutoSnapshotAsync(
+		    const std::function<void(bool success)>& completion = {}, Ref<SaveSettings> settings = new SaveSettings());
+
+		/*! Whether a CreateDatabaseAsync or SaveAutoSnapshotAsync of this view's file is still running */
+		bool IsAsyncSaveInProgress() const;
+
 		/*! Run a function in a context in which any changes made to analysis will be added to an undo state.
 			If the function returns false or throws an exception, any changes made within will be reverted.
 
@@ -4839,6 +5768,18 @@ namespace BinaryNinja {
 		*/
 		DataBuffer ReadBuffer(uint64_t offset, size_t len);
 
+		/*! MapBuffer reads len bytes from a virtual address into a shared, read-only ViewBuffer
+
+			The core does not expose its file mappings, so the bytes are read once out of the view. Afterwards the
+			buffer and every Slice of it share that single copy. The returned buffer is shorter than len if the
+			range is not fully readable.
+
+		    \param offset virtual address to read from
+		    \param len number of bytes to read
+		    \return ViewBuffer containing the read bytes
+		*/
+		ViewBuffer MapBuffer(uint64_t offset, size_t len);
+
 		/*! Write writes `len` bytes data at address `dest` to virtual address `offset`
 
 			\param offset virtual address to write to
@@ -4881,6 +5822,16 @@ namespace BinaryNinja {
 		*/
 		size_t Remove(uint64_t offset, uint64_t len);
 
+		/*! Computes the Shannon entropy of each block in a range, scaled to [0, 1]
+
+			All blocks are computed by a single core call, so callers should request as many blocks at once
+			as they can rather than one block per call.
+
+			\param offset Virtual address to start at
+			\param len Number of bytes to cover
+			\param blockSize Size of each block, or 0 for a single block covering the range
+			\return Entropy of each block that could be read
+		*/
 		std::vector<float> GetEntropy(uint64_t offset, size_t len, size_t blockSize);
 
 		/*! GetModification checks whether the virtual address `offset` is modified.
@@ -5165,6 +6116,44 @@ namespace BinaryNinja {
 		*/
 		void AbortAnalysis();
 
+		/*! Generate IL for a set of functions on the worker pool and return immediately
+
+			Each function's IL of the requested form is generated ahead of time, so later calls such as
+			Function::GetMediumLevelIL return without blocking. \c onReady is called from a worker thread as
+			soon as a function's IL is available, in no particular order, and \c onComplete is called once
+			after every function has been processed.
+
+			Each job blocks a worker thread while its IL is generated. Leave some workers free for analysis
+			itself, which the default of half the worker pool does.
+
+			\param functions Functions to generate IL for
+			\param level IL form to generate, e.g. MediumLevelILFunctionGraph or HighLevelILSSAFormFunctionGraph
+			\param threads Maximum number of worker jobs to use, or 0 for half of GetWorkerThreadCount()
+			\param onReady Optional callback for each function whose IL is available
+			\param onComplete Optional callback once all functions are done
+		*/
+		void PrefetchIL(const std::vector<Ref<Function>>& functions, BNFunctionGraphType level, size_t threads = 0,
+		    const std::function<void(Function*)>& onReady = {}, const std::function<void()>& onComplete = {});
+
+		/*! Start analysis, and analyze the given functions first, highest priority first, on the worker pool
+
+			Functions with equal priority keep their order in \c functions. With \c includeCallees, the functions
+			each one calls directly (as far as its call sites are already known) are analyzed just before it, so
+			their return and type information is available when it is. The rest of the view is analyzed by the
+			regular analysis update that this starts.
+
+			\param functions Functions and their priorities
+			\param includeCallees Whether to also analyze each function's direct callees ahead of it
+			\param level IL form that must be available for a function to count as analyzed
+			\param threads Maximum number of worker jobs to use, or 0 for half of GetWorkerThreadCount()
+			\param progress Optional callback with the number of prioritized functions done and the total,
+				called from a worker thread as each one finishes
+			\param onComplete Optional callback once every prioritized function is done
+		*/
+		void PrioritizeAnalysis(const std::vector<std::pair<Ref<Function>, int>>& functions, bool includeCallees = true,
+		    BNFunctionGraphType level = HighLevelILFunctionGraph, size_t threads = 0,
+		    const std::function<void(size_t, size_t)>& progress = {}, const std::function<void()>& onComplete = {});
+
 		/*! Define a DataVariable at a given address with a set type
 
 		    \param addr virtual address to define the DataVariable at
@@ -5207,12 +6196,31 @@ namespace BinaryNinja {
 		*/
 		bool GetDataVariableAtAddress(uint64_t addr, DataVariable& var);
 
+		/*! Visit the DataVariables starting in a range, in address order, without building the full list
+
+		    Each variable is fetched from the core when the iteration reaches it, so the cost of stopping early
+		    is proportional to the number of variables visited.
+
+		    \param start Virtual address to start at
+		    \param end Virtual address to stop before
+		    \param callback Called for each DataVariable. Return false to stop iterating.
+		    \return False if the callback stopped the iteration, true otherwise
+		*/
+		bool IterateDataVariables(
+			uint64_t start, uint64_t end, const std::function<bool(const DataVariable&)>& callback);
+
 		/*! Get a list of functions within this BinaryView
 
 		    \return vector of Functions within the BinaryView
 		*/
 		std::vector<Ref<Function>> GetAnalysisFunctionList();
 
+		/*! Get the list of functions within this BinaryView without wrapping each one
+
+		    \return Functions within the BinaryView, wrapped on access
+		*/
+		BorrowedList<Function> BorrowAnalysisFunctionList();
+
 		/*! Check whether the BinaryView has any functions defined
 
 		    \return Whether the BinaryView has any functions defined
@@ -5297,6 +6305,30 @@ namespace BinaryNinja {
 		*/
 		std::vector<ReferenceSource> GetCodeReferences(uint64_t addr, uint64_t len);
 
+		/*! Get the references made from code to each of many virtual addresses
+
+			Functions and architectures that appear in several references share one wrapper object.
+
+		    \param addrs Addresses to check
+		    \return References to each address, in the order of \c addrs
+		*/
+		ReferenceTable<ReferenceSource> GetCodeReferencesForAddresses(const std::vector<uint64_t>& addrs);
+
+		/*! Get a cursor over the references from code to a virtual address, to read them a page at a time
+
+		    \param addr Address to check
+		    \return Cursor positioned at the first reference
+		*/
+		CodeReferenceCursor GetCodeReferencesCursor(uint64_t addr);
+
+		/*! Get a cursor over the references from code to a range of addresses, to read them a page at a time
+
+		    \param addr Address to check
+		    \param len Length of query
+		    \return Cursor positioned at the first reference
+		*/
+		CodeReferenceCursor GetCodeReferencesCursor(uint64_t addr, uint64_t len);
+
 		/*! Get code references made by a particular "ReferenceSource"
 
 			A ReferenceSource contains a given function, architecture of that function, and an address within it.
@@ -5333,6 +6365,13 @@ namespace BinaryNinja {
 		*/
 		std::vector<uint64_t> GetDataReferences(uint64_t addr, uint64_t len);
 
+		/*! Get the references made by data to each of many virtual addresses
+
+		    \param addrs Addresses to check
+		    \return Addresses referencing each address, in the order of \c addrs
+		*/
+		ReferenceTable<uint64_t> GetDataReferencesForAddresses(const std::vector<uint64_t>& addrs);
+
 		/*! Get references made by data ('DataVariables') located at a virtual address.
 
 		    \param src reference source
@@ -5531,6 +6570,15 @@ namespace BinaryNinja {
 		*/
 		std::vector<ReferenceSource> GetCallers(uint64_t addr);
 
+		/*! The call graph of every function of the view
+
+			This uses the ViewCallGraph of the view, so while one is held elsewhere this only reads the functions
+			that changed since the last snapshot; otherwise every function is read.
+
+			\return The call graph
+		*/
+		std::shared_ptr<const CallGraphSnapshot> GetCallGraph();
+
 		/*! Returns the Symbol at the provided virtual address
 
 			\param addr Virtual address to query for symbol
@@ -5555,6 +6603,14 @@ namespace BinaryNinja {
 		*/
 		std::vector<Ref<Symbol>> GetSymbolsByName(const std::string& name, const NameSpace& nameSpace = NameSpace());
 
+		/*! Retrieves the symbols with a given name without wrapping each one
+
+			\param name Name to search for
+			\param nameSpace The optional namespace of the symbols to retrieve
+			\return Symbols with that name, wrapped on access
+		*/
+		BorrowedList<Symbol> BorrowSymbolsByName(const std::string& name, const NameSpace& nameSpace = NameSpace());
+
 		/*! Retrieves the list of all Symbol objects with a given raw name
 
 			\param name RawName to search for
@@ -5579,6 +6635,21 @@ namespace BinaryNinja {
 		*/
 		std::vector<Ref<Symbol>> GetSymbols(uint64_t start, uint64_t len, const NameSpace& nameSpace = NameSpace());
 
+		/*! Visits the symbols in a range, in address order, one address window at a time
+
+			Only one window of symbols is fetched from the core at once, and a Symbol object is only created
+			for the symbol currently being visited.
+
+			\param start Virtual address start of the range
+			\param end Virtual address to stop before
+			\param callback Called for each symbol. Return false to stop iterating.
+			\param nameSpace The optional namespace of the symbols to visit
+			\param windowSize Size of the address window fetched at a time
+			\return False if the callback stopped the iteration, true otherwise
+		*/
+		bool IterateSymbols(uint64_t start, uint64_t end, const std::function<bool(Symbol*)>& callback,
+			const NameSpace& nameSpace = NameSpace(), uint64_t windowSize = 0x100000);
+
 		/*! Retrieves a list of all Symbol objects of the provided symbol type
 
 			\param type The symbol type
@@ -5613,6 +6684,18 @@ namespace BinaryNinja {
 		*/
 		void DefineAutoSymbol(Ref<Symbol> sym);
 
+		/*! Adds a batch of automatically discovered symbols in a given namespace
+
+			The symbols are created and defined directly through the core inside a single bulk symbol
+			modification, without constructing a Symbol object for each entry. This is intended for loaders
+			that define large numbers of untyped symbols.
+
+			\param symbols Symbols to define, in order
+			\param nameSpace Namespace the symbols are defined in
+		*/
+		void DefineAutoSymbols(const std::vector<SymbolSpec>& symbols,
+			const NameSpace& nameSpace = NameSpace(DEFAULT_INTERNAL_NAMESPACE));
+
 		/*! Defines an "Auto" symbol, and a Variable/Function alongside it
 
 			\param platform Platform for the Type being defined
@@ -5660,6 +6743,16 @@ namespace BinaryNinja {
 		*/
 		void ApplyDebugInfo(Ref<DebugInfo> newDebugInfo);
 
+		/*! Apply the output of several parsers, e.g. from DebugInfoParser::ParseConcurrently, in one pass
+
+			Conflicting functions and data variables are resolved with DebugInfo::ResolveConflicts first, then every
+			container is applied in order with symbol updates batched across all of them. The last container
+			becomes the debug info of the view.
+
+			\param debugInfos Containers in order of priority, null entries are skipped
+		*/
+		void ApplyDebugInfo(const std::vector<Ref<DebugInfo>>& debugInfos);
+
 		/*! Sets the debug info for the current binary view
 
 			\param newDebugInfo Sets the debug info for the current binary view
@@ -5789,6 +6882,16 @@ namespace BinaryNinja {
 		void RemoveUserDataTagsOfType(uint64_t addr, Ref<TagType> tagType);
 		void RemoveTagReference(const TagReference& ref);
 
+		/*! Add many data tags at once, as a single undo action for the user variant
+
+			\param tags Address and tag of each tag to add
+		*/
+		void AddAutoDataTags(const std::vector<std::pair<uint64_t, Ref<Tag>>>& tags);
+		void AddUserDataTags(const std::vector<std::pair<uint64_t, Ref<Tag>>>& tags);
+
+		/*! Remove many tag references at once, as a single undo action */
+		void RemoveTagReferences(const std::vector<TagReference>& refs);
+
 		Ref<Tag> CreateAutoDataTag(
 		    uint64_t addr, const std::string& tagTypeName, const std::string& data, bool unique = false);
 		Ref<Tag> CreateUserDataTag(
@@ -6018,6 +7121,20 @@ namespace BinaryNinja {
 		*/
 		std::vector<BNStringReference> GetStrings(uint64_t start, uint64_t len);
 
+		/*! Visits the strings starting within a range, in address order, one address window at a time
+
+			Only one window of strings is copied out of the core at once. To keep a list current without
+			refetching everything, combine this with the OnStringFound and OnStringRemoved notifications.
+
+			\param start Starting virtual address of the range
+			\param end Virtual address to stop before
+			\param callback Called for each string. Return false to stop iterating.
+			\param windowSize Size of the address window fetched at a time
+			\return False if the callback stopped the iteration, true otherwise
+		*/
+		bool IterateStrings(uint64_t start, uint64_t end, const std::function<bool(const BNStringReference&)>& callback,
+			uint64_t windowSize = 0x100000);
+
 		/*! Sets up a call back function to be called when analysis has been completed.
 
 			This is helpful when using `UpdateAnalysis` which does not wait for analysis completion before returning.
@@ -6030,6 +7147,15 @@ namespace BinaryNinja {
 		Ref<AnalysisCompletionEvent> AddAnalysisCompletionEvent(const std::function<void()>& callback);
 
 		AnalysisInfo GetAnalysisInfo();
+
+		/*! Count the functions whose IL forms are currently generated, without generating any
+
+			Useful for watching how IL storage grows during analysis. This visits every function, so avoid
+			calling it in a tight loop on large views.
+
+			\return Residency counts for each IL form
+		*/
+		ILResidency GetILResidency();
 		BNAnalysisProgress GetAnalysisProgress();
 		Ref<BackgroundTask> GetBackgroundAnalysisTask();
 
@@ -6396,6 +7522,17 @@ namespace BinaryNinja {
 			\return True if successful
 		 */
 		bool PushTypeArchiveTypes(const std::string& archiveId, const std::unordered_set<std::string>& typeIds, std::unordered_map<std::string, std::string>& updatedTypes);
+		/*! Pull the associated types of an archive that have changed since the last call for that archive
+
+			The archive's current snapshot is stored in the view's metadata, and the next call only pulls the
+			associated types that TypeArchive::DiffSnapshots reports as changed since it. The first call for an
+			archive pulls every associated type.
+
+			\param[in] archiveId Id of archive
+			\param[out] updatedTypes List of types that were updated
+			\return True if successful
+		 */
+		bool PullTypeArchiveChanges(const std::string& archiveId, std::unordered_map<std::string, std::string>& updatedTypes);
 
 		bool FindNextData(
 		    uint64_t start, const DataBuffer& data, uint64_t& result, BNFindFlag flags = FindCaseSensitive);
@@ -6425,6 +7562,24 @@ namespace BinaryNinja {
 			const FunctionViewType& viewType, const std::function<bool(size_t current, size_t total)>& progress,
 		    const std::function<bool(uint64_t addr, const LinearDisassemblyLine& line)>& matchCallback);
 
+		/*! Searches for every occurrence of any of several byte patterns in a single pass over the data
+
+			The patterns are matched together with an Aho-Corasick automaton, so the cost doesn't grow with the
+			number of patterns. The ranges are split into chunks that are searched on several threads. Matches are
+			reported as they are found, which is not in address order. The callbacks are never called concurrently.
+
+			\param patterns Byte patterns to search for. Empty patterns never match.
+			\param ranges Address ranges to search, or empty to search all backed ranges of the view
+			\param flags Whether the search ignores ASCII case
+			\param progress Called with the number of bytes searched so far. Return false to cancel.
+			\param matchCallback Called with the index of the pattern and the address of each match. Return false to stop.
+			\param threads Number of threads to search on, or 0 for the worker pool size
+			\return False if the search was stopped by a callback, true otherwise
+		*/
+		bool FindAllDataMulti(const std::vector<DataBuffer>& patterns, const std::vector<BNAddressRange>& ranges,
+			BNFindFlag flags, const std::function<bool(size_t current, size_t total)>& progress,
+			const std::function<bool(size_t pattern, uint64_t addr)>& matchCallback, size_t threads = 0);
+
 		bool Search(const std::string& query, const std::function<bool(uint64_t offset, const DataBuffer& buffer)>& otherCallback);
 
 		void Reanalyze();
@@ -6594,6 +7749,14 @@ namespace BinaryNinja {
 		*/
 		std::vector<Ref<Segment>> GetSegments();
 
+		/*! Get the Segments overlapping a range, without creating objects for the rest
+
+			\param start Start of the range
+			\param len Length of the range
+			\return Segments overlapping the range, in the order GetSegments returns them
+		*/
+		std::vector<Ref<Segment>> GetSegmentsInRange(uint64_t start, uint64_t len);
+
 		/*! Gets the Segment a given virtual address is located in
 
 			\param addr A virtual address
@@ -6678,6 +7841,14 @@ namespace BinaryNinja {
 		*/
 		std::vector<Ref<Section>> GetSectionsAt(uint64_t addr);
 
+		/*! Get the sections overlapping a range, without creating objects for the rest
+
+			\param start Start of the range
+			\param len Length of the range
+			\return Sections overlapping the range, in the order GetSections returns them
+		*/
+		std::vector<Ref<Section>> GetSectionsInRange(uint64_t start, uint64_t len);
+
 		/*! Get a Section by name
 
 			\param name Name of the Section
@@ -7255,18 +8426,438 @@ namespace BinaryNinja {
 		ReadException() : ExceptionWithStackTrace("read out of bounds") {}
 	};
 
-	/*! BinaryReader is a convenience class for reading binary data
+	/*! Page cache in front of a view's reads, for widgets that read the same visible bytes on every repaint.
+
+		Reading from views backed by a transform, a remote file or a debugger can be slow, so bytes are fetched a
+		page at a time and the least recently used pages are dropped once \c maxPages are held. Writes drop the
+		pages they touch; inserts, removals and segment changes drop every page they can move.
+
+		Use GetForView to share one cache between all the widgets showing a view.
+
 		\ingroup binaryview
 	*/
-	class BinaryReader
+	class ViewPageCache : public BinaryDataNotification
 	{
+		struct Page
+		{
+			std::shared_ptr<const std::vector<uint8_t>> data;  // Shorter than a page if the view ends or has a gap
+			std::list<uint64_t>::iterator lruEntry;
+		};
+
 		Ref<BinaryView> m_view;
-		BNBinaryReader* m_stream;
+		size_t m_maxPages;
+		std::mutex m_mutex;
+		std::unordered_map<uint64_t, Page> m_pages;
+		std::list<uint64_t> m_lru;  // Page addresses, most recently used first
+		uint64_t m_generation = 0;  // Bumped on invalidation, so reads that raced one aren't cached
+		uint64_t m_hits = 0, m_misses = 0;
+
+		std::shared_ptr<const std::vector<uint8_t>> GetPage(uint64_t pageStart);
+		void InvalidateFrom(uint64_t start, uint64_t end);
 
 	  public:
-		/*! Create a BinaryReader instance given a BinaryView and endianness.
+		static constexpr uint64_t PageSize = 0x1000;
 
-			\param data BinaryView to read from
+		/*!
+			\param view View to read from, watched for changes
+			\param maxPages Number of pages to keep
+		*/
+		ViewPageCache(BinaryView* view, size_t maxPages = 1024);
+		virtual ~ViewPageCache();
+
+		/*! The cache shared by every caller for \c view, created on first use */
+		static std::shared_ptr<ViewPageCache> GetForView(BinaryView* view);
+
+		/*! Read up to \c len bytes at \c offset, as BinaryView::Read would
+
+			\return Number of bytes read, which stops at the first byte that can't be read
+		*/
+		size_t Read(void* dest, uint64_t offset, size_t len);
+
+		/*! Read up to \c len bytes at \c offset into a buffer, as BinaryView::ReadBuffer would */
+		DataBuffer ReadBuffer(uint64_t offset, size_t len);
+
+		/*! Drop every cached page */
+		void Invalidate();
+
+		void GetStats(uint64_t& hits, uint64_t& misses);
+
+		void OnBinaryDataWritten(BinaryView* view, uint64_t offset, size_t len) override;
+		void OnBinaryDataInserted(BinaryView* view, uint64_t offset, size_t len) override;
+		void OnBinaryDataRemoved(BinaryView* view, uint64_t offset, uint64_t len) override;
+		void OnSegmentAdded(BinaryView* data, Segment* segment) override;
+		void OnSegmentRemoved(BinaryView* data, Segment* segment) override;
+		void OnSegmentUpdated(BinaryView* data, Segment* segment) override;
+	};
+
+	/*! Per-bucket coverage of a view's functions, data variables and strings, for drawing a feature map.
+
+		The view's backed address ranges are laid end to end and split into \c bucketCount equal buckets. The
+		bytes each kind of feature covers in every bucket are counted once on a worker thread and then kept up to
+		date from the view's notifications, so analysis updates only touch the buckets of what changed. When
+		anything has changed, the worker calls \c render with the dominant feature of each bucket, at most once
+		per \c interval.
+
+		\ingroup binaryview
+	*/
+	class FeatureMapCounts : public BinaryDataNotification
+	{
+		struct State;
+		std::shared_ptr<State> m_state;
+		Ref<BinaryView> m_view;
+
+	  public:
+		enum Feature : uint8_t
+		{
+			NoFeature = 0,
+			FunctionFeature,
+			DataVariableFeature,
+			StringFeature,
+			FeatureCount
+		};
+
+		/*! Called on the worker thread with a Feature for every bucket. The destructor waits for it to return, so
+			it must not wait on the thread destroying the counts.
+		*/
+		using RenderCallback = std::function<void(const std::vector<uint8_t>& features)>;
+
+		/*!
+			\param view View to count the features of, watched for changes
+			\param bucketCount Number of buckets, usually the number of pixels in the map
+			\param render Called with the features of every bucket after they change
+			\param interval Minimum time between calls to \c render
+		*/
+		FeatureMapCounts(BinaryView* view, size_t bucketCount, const RenderCallback& render,
+			std::chrono::milliseconds interval = std::chrono::milliseconds(100));
+		virtual ~FeatureMapCounts();
+
+		/*! Change the number of buckets, recounting from the features already known */
+		void SetBucketCount(size_t bucketCount);
+		size_t GetBucketCount() const;
+
+		/*! Bucket containing \c addr
+
+			\return False if \c addr isn't in a backed address range
+		*/
+		bool GetBucketForAddress(uint64_t addr, size_t& bucket) const;
+
+		void OnAnalysisFunctionAdded(BinaryView* view, Function* func) override;
+		void OnAnalysisFunctionRemoved(BinaryView* view, Function* func) override;
+		void OnAnalysisFunctionUpdated(BinaryView* view, Function* func) override;
+		void OnDataVariableAdded(BinaryView* view, const DataVariable& var) override;
+		void OnDataVariableRemoved(BinaryView* view, const DataVariable& var) override;
+		void OnDataVariableUpdated(BinaryView* view, const DataVariable& var) override;
+		void OnStringFound(BinaryView* data, BNStringType type, uint64_t offset, size_t len) override;
+		void OnStringRemoved(BinaryView* data, BNStringType type, uint64_t offset, size_t len) override;
+		void OnSegmentAdded(BinaryView* data, Segment* segment) override;
+		void OnSegmentRemoved(BinaryView* data, Segment* segment) override;
+		void OnSegmentUpdated(BinaryView* data, Segment* segment) override;
+	};
+
+	/*! Segments and sections of a view sorted by start address, for models that show one row per region.
+
+		Changes the view reports are queued and only applied by Update, which reports every row it inserts,
+		removes or changes so that a model only updates those rows. Batches larger than \c maxRowChanges, such as
+		loading an image from a shared cache, are merged in at once and reported as a reset.
+
+		Queries and Update aren't synchronized with each other, so call them all from one thread.
+
+		\ingroup binaryview
+	*/
+	class MemoryMapIndex : public BinaryDataNotification
+	{
+		struct State;
+		std::unique_ptr<State> m_state;
+		Ref<BinaryView> m_view;
+
+	  public:
+		struct Change
+		{
+			enum Kind
+			{
+				RowInserted,
+				RowRemoved,
+				RowChanged,
+				Reset
+			} kind;
+			bool sections;  // Whether the row is in the sections rather than the segments
+			size_t row;
+		};
+
+		/*! Called with every change, with \c applied false just before the rows change and true just after */
+		using ChangeCallback = std::function<void(const Change& change, bool applied)>;
+
+		/*!
+			\param view View to index, watched for changes
+			\param maxRowChanges Number of changes per Update above which a reset is reported instead
+		*/
+		MemoryMapIndex(BinaryView* view, size_t maxRowChanges = 64);
+		virtual ~MemoryMapIndex();
+
+		/*! Apply the changes reported since the last call
+
+			\param callback Called around each change to the rows
+			\return Whether there was anything to apply
+		*/
+		bool Update(const ChangeCallback& callback);
+
+		size_t GetSegmentCount() const;
+		size_t GetSectionCount() const;
+
+		/*! Up to \c count rows starting at \c firstRow */
+		std::vector<Ref<Segment>> GetSegments(size_t firstRow, size_t count) const;
+		std::vector<Ref<Section>> GetSections(size_t firstRow, size_t count) const;
+
+		/*! Rows overlapping the range, in row order */
+		std::vector<Ref<Segment>> GetSegmentsInRange(uint64_t start, uint64_t len) const;
+		std::vector<Ref<Section>> GetSectionsInRange(uint64_t start, uint64_t len) const;
+
+		/*! Row of the last region starting at or before \c addr, or 0 if there is none */
+		size_t GetSegmentRowForAddress(uint64_t addr) const;
+		size_t GetSectionRowForAddress(uint64_t addr) const;
+
+		void OnSegmentAdded(BinaryView* data, Segment* segment) override;
+		void OnSegmentRemoved(BinaryView* data, Segment* segment) override;
+		void OnSegmentUpdated(BinaryView* data, Segment* segment) override;
+		void OnSectionAdded(BinaryView* data, Section* section) override;
+		void OnSectionRemoved(BinaryView* data, Section* section) override;
+		void OnSectionUpdated(BinaryView* data, Section* section) override;
+	};
+
+	/*! An immutable copy of a view's segments and sections, for address lookups that don't call into the core.
+
+		GetSegmentAt and GetSectionsAt on the snapshot are O(log n) and return pointers that stay valid for as long
+		as the snapshot does, so scans that look up every candidate pointer only pay for the copy once. The
+		snapshot doesn't change when the view does; use ViewSegmentMap to get one that is kept current.
+
+		\ingroup binaryview
+	*/
+	class SegmentMapSnapshot
+	{
+		struct Index;
+
+		uint64_t m_version;
+		std::vector<Ref<Segment>> m_segments;
+		std::vector<Ref<Section>> m_sections;
+		std::unique_ptr<const Index> m_index;
+
+	  public:
+		/*!
+			\param view View to copy the segments and sections of
+			\param version Version reported by GetVersion
+		*/
+		SegmentMapSnapshot(BinaryView* view, uint64_t version = 0);
+		~SegmentMapSnapshot();
+
+		SegmentMapSnapshot(const SegmentMapSnapshot&) = delete;
+		SegmentMapSnapshot& operator=(const SegmentMapSnapshot&) = delete;
+
+		uint64_t GetVersion() const { return m_version; }
+
+		/*! Segments sorted by start address */
+		const std::vector<Ref<Segment>>& GetSegments() const { return m_segments; }
+
+		/*! Sections sorted by start address */
+		const std::vector<Ref<Section>>& GetSections() const { return m_sections; }
+
+		/*! The segment containing \c addr, or the one with the greatest start if segments overlap there
+
+			\return The segment, or nullptr if \c addr isn't in a segment
+		*/
+		Segment* GetSegmentAt(uint64_t addr) const;
+
+		/*! The section containing \c addr with the greatest start, which is the innermost one if sections nest
+
+			\return The section, or nullptr if \c addr isn't in a section
+		*/
+		Section* GetSectionAt(uint64_t addr) const;
+
+		/*! Every section containing \c addr, sorted by start address */
+		std::vector<Section*> GetSectionsAt(uint64_t addr) const;
+	};
+
+	/*! Keeps a SegmentMapSnapshot of a view current.
+
+		Segment and section notifications bump the version, and the next GetSnapshot copies the view again.
+		Snapshots already handed out are left as they were, so a caller can keep using one for a whole pass and
+		compare versions to find out whether the view has changed since.
+
+		Use GetForView to share one map between all the callers for a view.
+
+		\ingroup binaryview
+	*/
+	class ViewSegmentMap : public BinaryDataNotification
+	{
+		Ref<BinaryView> m_view;
+		std::mutex m_mutex;
+		std::shared_ptr<const SegmentMapSnapshot> m_snapshot;
+		std::atomic<uint64_t> m_version = 1;
+
+		void Invalidate() { m_version++; }
+
+	  public:
+		ViewSegmentMap(BinaryView* view);
+		virtual ~ViewSegmentMap();
+
+		/*! The map shared by every caller for \c view, created on first use */
+		static std::shared_ptr<ViewSegmentMap> GetForView(BinaryView* view);
+
+		/*! A snapshot of the view's current segments and sections */
+		std::shared_ptr<const SegmentMapSnapshot> GetSnapshot();
+
+		uint64_t GetVersion() const { return m_version; }
+
+		void OnSegmentAdded(BinaryView*, Segment*) override { Invalidate(); }
+		void OnSegmentRemoved(BinaryView*, Segment*) override { Invalidate(); }
+		void OnSegmentUpdated(BinaryView*, Segment*) override { Invalidate(); }
+		void OnSectionAdded(BinaryView*, Section*) override { Invalidate(); }
+		void OnSectionRemoved(BinaryView*, Section*) override { Invalidate(); }
+		void OnSectionUpdated(BinaryView*, Section*) override { Invalidate(); }
+	};
+
+	/*! A view's call graph in compressed sparse row form.
+
+		Functions are numbered in order of their start address, and functions of different platforms that share a
+		start are merged into one. The call sites of function \c i are
+		<tt>[callSiteStarts[i], callSiteStarts[i + 1])</tt> in the call site arrays, and the callees of call site
+		\c j are <tt>[calleeStarts[j], calleeStarts[j + 1])</tt> in the callee arrays.
+
+		\ingroup binaryview
+	*/
+	struct CallGraphSnapshot
+	{
+		static constexpr uint32_t NotAFunction = UINT32_MAX;
+
+		uint64_t version = 0;
+		std::vector<uint64_t> functionStarts;
+		std::vector<size_t> callSiteStarts;  // One more than there are functions
+		std::vector<uint64_t> callSiteAddresses;
+		std::vector<uint8_t> callSiteIndirect;  // Whether the call site has other than exactly one known target
+		std::vector<size_t> calleeStarts;  // One more than there are call sites
+		std::vector<uint64_t> calleeAddresses;
+		std::vector<uint32_t> callees;  // Index of the function at each callee address, or NotAFunction
+
+		size_t GetFunctionCount() const { return functionStarts.size(); }
+
+		/*! Index of the function starting at \c addr, or NotAFunction if there is none */
+		uint32_t GetFunctionIndex(uint64_t addr) const;
+	};
+
+	/*! Keeps a CallGraphSnapshot of a view current.
+
+		The call sites of every function are read once, and after that only the functions that analysis adds,
+		updates or removes are read again. GetSnapshot rebuilds the arrays from the cached call sites when
+		anything has changed since the last one, which doesn't call into the core for the functions that haven't.
+
+		Use GetForView to share one call graph between all the callers for a view.
+
+		\ingroup binaryview
+	*/
+	class ViewCallGraph : public BinaryDataNotification
+	{
+		struct State;
+		std::unique_ptr<State> m_state;
+		Ref<BinaryView> m_view;
+
+		void MarkChanged(Function* func);
+
+	  public:
+		ViewCallGraph(BinaryView* view);
+		virtual ~ViewCallGraph();
+
+		/*! The call graph shared by every caller for \c view, created on first use */
+		static std::shared_ptr<ViewCallGraph> GetForView(BinaryView* view);
+
+		/*! A snapshot of the current call graph, which is the previous one if nothing has changed since */
+		std::shared_ptr<const CallGraphSnapshot> GetSnapshot();
+
+		/*! Bumped by every change to the functions, so GetSnapshot will return a new snapshot if this differs
+			from the version of the last one
+		*/
+		uint64_t GetVersion() const;
+
+		void OnAnalysisFunctionAdded(BinaryView* view, Function* func) override;
+		void OnAnalysisFunctionRemoved(BinaryView* view, Function* func) override;
+		void OnAnalysisFunctionUpdated(BinaryView* view, Function* func) override;
+	};
+
+	/*! Tag references of a view indexed by tag type and address, for tag lists that stay open while tags change.
+
+		The references are read once when the index is created and then kept up to date from the view's tag
+		notifications, so counts are available without asking the core and a range only visits the tags inside
+		it. Function tags are indexed at the start of their function.
+
+		All methods may be called from any thread.
+
+		\ingroup binaryview
+	*/
+	class TagIndex : public BinaryDataNotification
+	{
+		struct State;
+		std::unique_ptr<State> m_state;
+		Ref<BinaryView> m_view;
+
+	  public:
+		/*!
+			\param view View to index, watched for changes
+		*/
+		TagIndex(BinaryView* view);
+		virtual ~TagIndex();
+
+		/*! Number of tag references of every type */
+		size_t GetCount() const;
+
+		/*! Number of tag references of \c tagType */
+		size_t GetCount(TagType* tagType) const;
+
+		/*! Number of tag references of each type that has any, as BinaryView::GetAllTagReferenceTypeCounts */
+		std::map<Ref<TagType>, size_t> GetTypeCounts() const;
+
+		/*! Tag references of \c tagType, in address order */
+		std::vector<TagReference> GetTagReferencesOfType(TagType* tagType) const;
+
+		/*! Tag references in [start, end), in address order
+
+			\param tagType Only return references of this type, or nullptr for every type
+		*/
+		std::vector<TagReference> GetTagReferencesInRange(
+		    uint64_t start, uint64_t end, TagType* tagType = nullptr) const;
+
+		void OnTagAdded(BinaryView* view, const TagReference& tagRef) override;
+		void OnTagRemoved(BinaryView* view, const TagReference& tagRef) override;
+	};
+
+	/*! BinaryReader is a convenience class for reading binary data
+		\ingroup binaryview
+	*/
+	class BinaryReader
+	{
+		Ref<BinaryView> m_view;
+		BNBinaryReader* m_stream;
+		BNEndianness m_endian;
+		uint64_t m_virtualBase = 0;
+
+		// Cursor and read-ahead window of a buffered reader; the core's cursor is only updated when it is used
+		bool m_buffered = false;
+		size_t m_addressSize = 0;
+		uint64_t m_position = 0;
+		std::vector<uint8_t> m_window;
+		uint64_t m_windowStart = 0;
+		size_t m_windowLength = 0;
+		// Set from the view's notifications when its data changes, while buffered
+		struct WindowInvalidator;
+		std::shared_ptr<WindowInvalidator> m_invalidator;
+
+		bool ReadFromWindow(void* dest, size_t len);
+		bool BufferedRead(void* dest, size_t len);
+		template <typename T>
+		bool BufferedReadValue(T& result, BNEndianness endian);
+		bool BufferedReadPointer(uint64_t& result, BNEndianness endian);
+
+	  public:
+		/*! Create a BinaryReader instance given a BinaryView and endianness.
+
+			\param data BinaryView to read from
 			\param endian Byte order to read with. One of LittleEndian, BigEndian
 		*/
 		BinaryReader(BinaryView* data, BNEndianness endian = LittleEndian);
@@ -7284,6 +8875,24 @@ namespace BinaryNinja {
 		*/
 		void SetEndianness(BNEndianness endian);
 
+		/*! Whether reads are served from a client-side read-ahead window.
+
+			\return Whether this reader is buffered
+		*/
+		bool IsBuffered() const;
+
+		/*! Serve reads from a client-side read-ahead window instead of calling into the core for every value.
+
+			Reads behave exactly as they do unbuffered, including failures at the end of readable memory. The
+			window is dropped whenever buffering is turned on or off and when the view notifies that its data or
+			segments have changed. As those notifications can arrive after a write returns, call
+			SetBuffered(true) again to drop it immediately after writing to the view. The address size is fixed
+			when buffering is enabled. Readers with a virtual base always read through the core.
+
+			\param buffered Whether to buffer reads
+		*/
+		void SetBuffered(bool buffered);
+
 		/*! Read from the current cursor position into buffer `dest`
 
 		    \throws ReadException
@@ -7587,6 +9196,16 @@ namespace BinaryNinja {
 	{
 		Ref<BinaryView> m_view;
 		BNBinaryWriter* m_stream;
+		BNEndianness m_endian;
+
+		// Cursor and pending writes of a batch, as disjoint runs of bytes keyed by their address
+		bool m_batching = false;
+		uint64_t m_position = 0;
+		std::map<uint64_t, std::vector<uint8_t>> m_batch;
+
+		bool BatchWrite(const void* src, size_t len);
+		template <typename T>
+		bool BatchWriteValue(T val, BNEndianness endian);
 
 	  public:
 
@@ -7611,6 +9230,35 @@ namespace BinaryNinja {
 		*/
 		void SetEndianness(BNEndianness endian);
 
+		/*! Whether writes are being collected by BeginBatch.
+
+			\return Whether a batch is open
+		*/
+		bool IsBatching() const;
+
+		/*! Collect all following writes client-side until CommitBatch or DiscardBatch is called.
+
+			Overlapping and adjacent writes are merged, with later writes taking precedence. Writes can't fail
+			while batching; out of bounds writes are instead reported by CommitBatch. A batch that is never
+			committed is discarded.
+		*/
+		void BeginBatch();
+
+		/*! Apply the writes collected since BeginBatch as a single undo action.
+
+			The view sees one write per contiguous range that was touched. If any of them fails, the whole
+			batch is reverted.
+
+			\throws WriteException if part of the batch could not be written
+		*/
+		void CommitBatch();
+
+		/*! Drop the writes collected since BeginBatch without applying them.
+
+			The cursor keeps the position it had reached in the batch.
+		*/
+		void DiscardBatch();
+
 		/*! Write bytes from an address to the current cursor position
 
 		 	\throws WriteException on out of bounds write
@@ -7851,6 +9499,35 @@ namespace BinaryNinja {
 		    const std::map<std::string, DataBuffer>& params = std::map<std::string, DataBuffer>());
 		virtual bool Encode(const DataBuffer& input, DataBuffer& output,
 		    const std::map<std::string, DataBuffer>& params = std::map<std::string, DataBuffer>());
+
+		/*! Fills \c data with up to \c len bytes of input and returns how many were written, 0 at the end of the input
+		*/
+		typedef std::function<size_t(uint8_t* data, size_t len)> StreamInput;
+
+		/*! Receives the next \c len bytes of output; returning false stops the transform, which then fails
+		*/
+		typedef std::function<bool(const uint8_t* data, size_t len)> StreamOutput;
+
+		/*! Decode input pulled from \c input, pushing the result to \c output as it is produced
+
+			Transforms that can work on a piece of their input at a time should override this so that large
+			inputs never need to be in memory all at once. The default implementation collects the whole input,
+			calls Decode and then hands the output over in chunks.
+
+			\param input Source of the encoded data
+			\param output Destination of the decoded data
+			\param params Transform parameters
+			\return Whether decoding succeeded
+		*/
+		virtual bool DecodeStream(const StreamInput& input, const StreamOutput& output,
+		    const std::map<std::string, DataBuffer>& params = std::map<std::string, DataBuffer>());
+
+		/*! Encode input pulled from \c input, pushing the result to \c output as it is produced
+
+			\see DecodeStream
+		*/
+		virtual bool EncodeStream(const StreamInput& input, const StreamOutput& output,
+		    const std::map<std::string, DataBuffer>& params = std::map<std::string, DataBuffer>());
 	};
 
 	/*!
@@ -7892,6 +9569,7 @@ namespace BinaryNinja {
 	class FunctionRecognizer;
 	class CallingConvention;
 	class RelocationHandler;
+	struct ArchitectureInstructionDispatch;
 
 	typedef size_t ExprId;
 
@@ -7902,8 +9580,13 @@ namespace BinaryNinja {
 	*/
 	class Architecture : public StaticCoreRefCountObject<BNArchitecture>
 	{
+		friend struct ArchitectureInstructionDispatch;
+
 	  protected:
 		std::string m_nameForRegister;
+		bool m_lowLevelILTemplateCacheEnabled = false;
+		// Set by extensions and hooks that register with an ArchitectureInstructionDispatch
+		ArchitectureInstructionDispatch* m_instructionDispatch = nullptr;
 
 		Architecture(BNArchitecture* arch);
 
@@ -8070,6 +9753,23 @@ namespace BinaryNinja {
 		*/
 		virtual bool GetInstructionInfo(const uint8_t* data, uint64_t addr, size_t maxLen, InstructionInfo& result) = 0;
 
+		/*! Retrieves InstructionInfo for a straight-line run of instructions starting at \c addr
+
+			Decoding stops after the first instruction that has branches or delay slots, at the first instruction
+			that fails to decode, or when \c maxLen bytes or \c maxCount instructions have been consumed. The
+			default implementation calls GetInstructionInfo for each instruction; architectures with a cheaper way
+			to decode consecutive instructions can override it.
+
+			\param[in] data pointer to the instruction data to retrieve info for
+			\param[in] addr address of the first instruction
+			\param[in] maxLen Maximum length of the instruction data to read
+			\param[out] results Array of at least \c maxCount entries to write the retrieved info to
+			\param[in] maxCount Maximum number of instructions to decode
+			\return Number of entries of \c results that were filled in
+		*/
+		virtual size_t GetInstructionInfoBatch(
+		    const uint8_t* data, uint64_t addr, size_t maxLen, InstructionInfo* results, size_t maxCount);
+
 		/*! Retrieves a list of InstructionTextTokens
 
 			\param[in] data pointer to the instruction data to retrieve text for
@@ -8092,6 +9792,18 @@ namespace BinaryNinja {
 		*/
 		virtual bool GetInstructionLowLevelIL(const uint8_t* data, uint64_t addr, size_t& len, LowLevelILFunction& il);
 
+		/*! Route lifting requests from the core through a per-thread cache of lifted instructions.
+
+			Once an encoding has lifted to the same IL at two unrelated addresses, later lifts of it replay the
+			recorded IL instead of calling GetInstructionLowLevelIL. Lifts that use labels, query the owning
+			function or depend on the address are never replayed. Only enable this for lifters whose output depends
+			on nothing but the instruction bytes and address. Disabled by default.
+
+			\param enabled Whether to use the cache
+		*/
+		void SetLowLevelILTemplateCacheEnabled(bool enabled);
+		bool IsLowLevelILTemplateCacheEnabled() const;
+
 		/*! Gets a register name from a register index.
 
 			\param reg Register index
@@ -8267,6 +9979,18 @@ namespace BinaryNinja {
 		*/
 		virtual bool Assemble(const std::string& code, uint64_t addr, DataBuffer& result, std::string& errors);
 
+		/*! Assembles many independent snippets, spread over a thread per core. Tools that rewrite a binary
+			assemble far too many small snippets to wait for each one in turn, and the assemblers spend most of
+			that time waiting on their own setup rather than the CPU.
+
+			\param[in] snippets Code and address of each snippet
+			\param[out] results Compiled bytes of each snippet, in the same order as \c snippets
+			\param[out] errors Errors of each snippet, empty for the ones that were assembled
+			\return Whether every snippet was assembled
+		*/
+		bool AssembleBatch(const std::vector<std::pair<std::string, uint64_t>>& snippets,
+			std::vector<DataBuffer>& results, std::vector<std::string>& errors);
+
 		/*! Returns true if the instruction at \c addr can be patched to never branch.
 
 		    \note This is used in the UI to determine if "never branch" should be displayed in the right-click context
@@ -8542,6 +10266,56 @@ namespace BinaryNinja {
 		virtual bool SkipAndReturnValue(uint8_t* data, uint64_t addr, size_t len, uint64_t value) override;
 	};
 
+	/*! Instruction methods of an ArchitectureExtension or ArchitectureHook, see
+		ArchitectureInstructionDispatch::hookedMethods
+
+		\ingroup architectures
+	*/
+	enum HookedInstructionMethod
+	{
+		HookedGetInstructionInfo = 1,
+		HookedGetInstructionText = 2,
+		HookedGetInstructionLowLevelIL = 4,
+		HookedAllInstructionMethods = 7
+	};
+
+	/*! How the core reaches the instruction methods of an ArchitectureExtension or ArchitectureHook
+
+		By default every instruction goes through the extension's GetInstructionInfo, GetInstructionText and
+		GetInstructionLowLevelIL, and the ones it doesn't handle itself are passed on to the base architecture,
+		converting the results to and from the C++ types on the way. Extensions that only change a few
+		instructions can avoid that:
+
+		- Methods left out of hookedMethods are never called on the extension; the core's requests for them go
+		  straight to the base architecture.
+		- With a filter, the hooked methods are only called for the instructions the filter accepts, and every
+		  other instruction goes straight to the base architecture. The filter gets the same bytes, address and
+		  length as the method would, and should be cheap, such as a check of the opcode bytes.
+
+		Both must be set before the architecture is registered.
+
+		\ingroup architectures
+	*/
+	struct ArchitectureInstructionDispatch
+	{
+		uint32_t hookedMethods = HookedAllInstructionMethods;
+		std::function<bool(const uint8_t* data, uint64_t addr, size_t len)> filter;
+
+		// Set on registration: the callbacks of the extension itself and the architecture to forward to
+		BNCustomArchitecture callbacks;
+		BNArchitecture* base = nullptr;
+
+		void Install(BNCustomArchitecture* archCallbacks, Architecture* arch);
+
+	  private:
+		static bool GetInstructionInfoCallback(
+		    void* ctxt, const uint8_t* data, uint64_t addr, size_t maxLen, BNInstructionInfo* result);
+		static bool GetInstructionTextCallback(void* ctxt, const uint8_t* data, uint64_t addr, size_t* len,
+		    BNInstructionTextToken** result, size_t* count);
+		static bool GetInstructionLowLevelILCallback(
+		    void* ctxt, const uint8_t* data, uint64_t addr, size_t* len, BNLowLevelILFunction* il);
+	};
+
 	/*!
 
 		\ingroup architectures
@@ -8550,6 +10324,7 @@ namespace BinaryNinja {
 	{
 	  protected:
 		Ref<Architecture> m_base;
+		ArchitectureInstructionDispatch m_instructionDispatch;
 
 		virtual void Register(BNCustomArchitecture* callbacks) override;
 
@@ -8558,6 +10333,20 @@ namespace BinaryNinja {
 
 		Ref<Architecture> GetBaseArchitecture() const { return m_base; }
 
+		/*! Select the instruction methods this extension overrides; see ArchitectureInstructionDispatch
+
+			\param methods Combination of HookedInstructionMethod values
+		*/
+		void SetHookedInstructionMethods(uint32_t methods) { m_instructionDispatch.hookedMethods = methods; }
+
+		/*! Only call the overridden instruction methods for instructions accepted by filter; see
+			ArchitectureInstructionDispatch
+		*/
+		void SetInstructionFilter(const std::function<bool(const uint8_t* data, uint64_t addr, size_t len)>& filter)
+		{
+			m_instructionDispatch.filter = filter;
+		}
+
 		virtual BNEndianness GetEndianness() const override;
 		virtual size_t GetAddressSize() const override;
 		virtual size_t GetDefaultIntegerSize() const override;
@@ -8634,11 +10423,26 @@ namespace BinaryNinja {
 	{
 	  protected:
 		Ref<Architecture> m_base;
+		ArchitectureInstructionDispatch m_instructionDispatch;
 
 		virtual void Register(BNCustomArchitecture* callbacks) override;
 
 	  public:
 		ArchitectureHook(Architecture* base);
+
+		/*! Select the instruction methods this hook overrides; see ArchitectureInstructionDispatch
+
+			\param methods Combination of HookedInstructionMethod values
+		*/
+		void SetHookedInstructionMethods(uint32_t methods) { m_instructionDispatch.hookedMethods = methods; }
+
+		/*! Only call the overridden instruction methods for instructions accepted by filter; see
+			ArchitectureInstructionDispatch
+		*/
+		void SetInstructionFilter(const std::function<bool(const uint8_t* data, uint64_t addr, size_t len)>& filter)
+		{
+			m_instructionDispatch.filter = filter;
+		}
 	};
 
 	class Structure;
@@ -8783,6 +10587,16 @@ namespace BinaryNinja {
 		bool operator==(const Type& other);
 		bool operator!=(const Type& other);
 
+		/*! Compute a hash of the shape of this Type
+
+			Types that compare equal always hash equal, so the hash can be used to bucket types before comparing
+			them with \c operator==. It is computed from the type class, width, alignment, signedness, element
+			count and the hashes of pointer, array and return types; structure members and function parameters
+			other than their count are not included.
+
+			\return The structural hash
+		*/
+		uint64_t GetStructuralHash() const;
 
 		/*! Retrieve the Type Class for this Structure
 
@@ -9245,6 +11059,53 @@ namespace BinaryNinja {
 		static std::string GetSizeSuffix(size_t size);
 	};
 
+	/*! Deduplicates structurally equal types for code that creates many of them, such as debug info and type
+		library importers
+
+		Intern returns the first equal type it was given instead of a new copy, so equal types share one core
+		object. The IntegerType, PointerType and ArrayType helpers remember the arguments they were called with
+		and skip the core entirely when the same type is requested again; pass them interned child types so
+		repeated pointers and arrays are recognized by their arguments alone.
+
+		Interned types are kept alive until the interner is cleared or destroyed. All methods are thread safe.
+
+		\ingroup types
+	*/
+	class TypeInterner
+	{
+		std::mutex m_mutex;
+		std::unordered_map<uint64_t, std::vector<Ref<Type>>> m_types;
+		std::map<std::tuple<size_t, bool, uint8_t, std::string>, Ref<Type>> m_integerTypes;
+		// Child types are held alongside each entry so the child pointer in the key can't be reused
+		std::map<std::tuple<BNType*, uint8_t, BNArchitecture*, size_t, bool, uint8_t, bool, uint8_t, BNReferenceType>,
+		    std::pair<Ref<Type>, Ref<Type>>>
+		    m_pointerTypes;
+		std::map<std::tuple<BNType*, uint8_t, uint64_t>, std::pair<Ref<Type>, Ref<Type>>> m_arrayTypes;
+
+		Ref<Type> InternLocked(Type* type, uint64_t hash);
+
+	  public:
+		/*! Return the interned type equal to \c type, interning \c type itself if there is none yet
+
+			\param type Type to intern
+			\return An equal type owned by this interner
+		*/
+		Ref<Type> Intern(Type* type);
+
+		Ref<Type> IntegerType(size_t width, const Confidence<bool>& sign, const std::string& altName = "");
+		Ref<Type> PointerType(Architecture* arch, const Confidence<Ref<Type>>& type,
+		    const Confidence<bool>& cnst = Confidence<bool>(false, 0),
+		    const Confidence<bool>& vltl = Confidence<bool>(false, 0), BNReferenceType refType = PointerReferenceType);
+		Ref<Type> PointerType(size_t width, const Confidence<Ref<Type>>& type,
+		    const Confidence<bool>& cnst = Confidence<bool>(false, 0),
+		    const Confidence<bool>& vltl = Confidence<bool>(false, 0), BNReferenceType refType = PointerReferenceType);
+		Ref<Type> ArrayType(const Confidence<Ref<Type>>& type, uint64_t elem);
+
+		/*! Number of distinct types interned so far */
+		size_t GetCount();
+		void Clear();
+	};
+
 	class EnumerationBuilder;
 	class StructureBuilder;
 	class NamedTypeReferenceBuilder;
@@ -9944,11 +11805,328 @@ namespace BinaryNinja {
 #endif
 	};
 
+	/*! Concurrent storage for state that workflow activities keep per view or per function
+
+		Entries are immutable snapshots: Get returns a shared pointer that stays valid while the entry is
+		replaced, and Update publishes a modified copy. Keys are spread over independent shards, and readers
+		only take a shared lock on one of them, so activities running on different analysis threads don't
+		serialize on the store.
+
+		Entries are keyed by the view's core object, so call RemoveView when a view is closed.
+
+		\code{.cpp}
+		AnalysisDataStore<std::set<uint64_t>> g_callSites;
+
+		// In a plugin command
+		g_callSites.Update(view, func->GetStart(), [&](std::set<uint64_t>& sites) { sites.insert(addr); });
+
+		// In the activity
+		if (auto sites = g_callSites.Get(analysisContext))
+			for (uint64_t addr : *sites) ...
+		\endcode
+
+		\ingroup workflow
+	*/
+	template <typename T, size_t ShardCount = 64>
+	class AnalysisDataStore
+	{
+		// The flag separates view-wide entries from the function starting at the same address
+		using Key = std::tuple<BNBinaryView*, uint64_t, bool>;
+
+		struct KeyHash
+		{
+			size_t operator()(const Key& key) const
+			{
+				uint64_t hash = (uint64_t)(uintptr_t)std::get<0>(key) ^ (std::get<1>(key) * 0x9e3779b97f4a7c15);
+				return (size_t)(hash ^ (hash >> 29) ^ std::get<2>(key));
+			}
+		};
+
+		struct Shard
+		{
+			mutable std::shared_mutex mutex;
+			std::unordered_map<Key, std::shared_ptr<const T>, KeyHash> values;
+		};
+
+		Shard m_shards[ShardCount];
+
+		Shard& GetShard(const Key& key) { return m_shards[KeyHash()(key) % ShardCount]; }
+		const Shard& GetShard(const Key& key) const { return m_shards[KeyHash()(key) % ShardCount]; }
+
+		std::shared_ptr<const T> Get(const Key& key) const
+		{
+			const Shard& shard = GetShard(key);
+			std::shared_lock<std::shared_mutex> lock(shard.mutex);
+			auto i = shard.values.find(key);
+			if (i == shard.values.end())
+				return nullptr;
+			return i->second;
+		}
+
+		template <typename F>
+		void Update(const Key& key, F&& update)
+		{
+			Shard& shard = GetShard(key);
+			std::unique_lock<std::shared_mutex> lock(shard.mutex);
+			auto& entry = shard.values[key];
+			auto value = entry ? std::make_shared<T>(*entry) : std::make_shared<T>();
+			update(*value);
+			entry = std::move(value);
+		}
+
+	  public:
+		/*! Get the entry for a function, or nullptr if there is none */
+		std::shared_ptr<const T> Get(BinaryView* view, uint64_t function) const
+		{
+			return Get(Key(view->GetObject(), function, false));
+		}
+
+		/*! Get the view-wide entry, or nullptr if there is none */
+		std::shared_ptr<const T> Get(BinaryView* view) const { return Get(Key(view->GetObject(), 0, true)); }
+
+		/*! Get the entry for the function being analyzed, or nullptr if there is none */
+		std::shared_ptr<const T> Get(AnalysisContext* context) const;
+
+		void Set(BinaryView* view, uint64_t function, T value)
+		{
+			Update(view, function, [&](T& current) { current = std::move(value); });
+		}
+
+		void Set(BinaryView* view, T value)
+		{
+			Update(view, [&](T& current) { current = std::move(value); });
+		}
+
+		/*! Replace a function's entry with a copy that \c update has modified
+
+			A default constructed value is passed if there is no entry yet. Concurrent updates to the same
+			entry are applied one at a time.
+		*/
+		template <typename F>
+		void Update(BinaryView* view, uint64_t function, F&& update)
+		{
+			Update(Key(view->GetObject(), function, false), std::forward<F>(update));
+		}
+
+		template <typename F>
+		void Update(BinaryView* view, F&& update)
+		{
+			Update(Key(view->GetObject(), 0, true), std::forward<F>(update));
+		}
+
+		void Remove(BinaryView* view, uint64_t function)
+		{
+			Key key(view->GetObject(), function, false);
+			Shard& shard = GetShard(key);
+			std::unique_lock<std::shared_mutex> lock(shard.mutex);
+			shard.values.erase(key);
+		}
+
+		/*! Remove the view-wide entry and every function entry of a view */
+		void RemoveView(BinaryView* view)
+		{
+			for (auto& shard : m_shards)
+			{
+				std::unique_lock<std::shared_mutex> lock(shard.mutex);
+				for (auto i = shard.values.begin(); i != shard.values.end();)
+				{
+					if (std::get<0>(i->first) == view->GetObject())
+						i = shard.values.erase(i);
+					else
+						++i;
+				}
+			}
+		}
+	};
+
+	/*! Aggregated values of an InstrumentationHistogram, see Instrumentation::GetSnapshot
+
+		\ingroup instrumentation
+	*/
+	struct InstrumentationHistogramSnapshot
+	{
+		std::string name;
+		uint64_t count;
+		uint64_t sum;
+		uint64_t min;
+		uint64_t max;
+		// buckets[i] counts the values v with 2^(i-1) <= v < 2^i; buckets[0] counts zeroes
+		std::vector<uint64_t> buckets;
+	};
+
+	/*!
+		\ingroup instrumentation
+	*/
+	struct InstrumentationSnapshot
+	{
+		std::map<std::string, int64_t> counters;
+		std::vector<InstrumentationHistogramSnapshot> histograms;
+	};
+
+	/*!
+		Named counters, histograms and scoped timers for the hot paths of plugins built on this API
+
+		Instruments are declared once, usually as function local statics, and record nothing until
+		Instrumentation::SetEnabled is called or the BN_API_INSTRUMENTATION environment variable is set, so the
+		cost of an instrument on a hot path is a single relaxed load while it is disabled:
+
+		\code{.cpp}
+		static InstrumentationHistogram decodeTime("arch.x86.decode");
+		InstrumentationScope scope(decodeTime);
+		\endcode
+
+		Names are dotted, with the first component used as the trace category. Instruments with the same name
+		share their values. Every plugin linking the API has its own set of instruments.
+
+		\ingroup instrumentation
+	*/
+	class Instrumentation
+	{
+		static std::atomic<bool> s_enabled;
+		static std::atomic<bool> s_tracing;
+
+	  public:
+		// Storage of a histogram, defined in instrumentation.cpp
+		struct Histogram;
+
+		static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+		static void SetEnabled(bool enabled);
+		static bool IsTracingEnabled() { return s_tracing.load(std::memory_order_relaxed); }
+
+		/*! Record every InstrumentationScope as a trace event, see GetTraceJson
+
+			\param enabled Whether to record; enabling discards any previously recorded events and enables
+			       instrumentation if needed
+			\param maxEvents Events beyond this count are not recorded
+		*/
+		static void SetTracingEnabled(bool enabled, size_t maxEvents = 1000000);
+
+		static InstrumentationSnapshot GetSnapshot();
+
+		/*! Get the snapshot as JSON, for handing to Python or Rust tooling
+
+			\return Object with "counters" mapping names to values and "histograms" mapping names to objects with
+			        "count", "sum", "min", "max" and "buckets"
+		*/
+		static std::string GetSnapshotJson();
+
+		/*! Get the recorded trace events in the Chrome trace event format
+
+			The result can be loaded in chrome://tracing or Perfetto, and merged with the traces written by the
+			Python and Rust instrumentation modules by concatenating their "traceEvents" arrays.
+
+			\return Trace JSON
+		*/
+		static std::string GetTraceJson();
+
+		/*! Zero every counter and histogram and discard recorded trace events */
+		static void Reset();
+
+		static std::atomic<int64_t>* GetCounter(const std::string& name);
+		static Histogram* GetHistogram(const std::string& name);
+		static void RecordHistogram(Histogram* histogram, uint64_t value);
+		static void RecordTraceEvent(
+		    Histogram* histogram, std::chrono::steady_clock::time_point start, uint64_t durationNs);
+	};
+
+	/*!
+		\ingroup instrumentation
+	*/
+	class InstrumentationCounter
+	{
+		std::atomic<int64_t>* m_value;
+
+	  public:
+		InstrumentationCounter(const std::string& name) : m_value(Instrumentation::GetCounter(name)) {}
+
+		void Add(int64_t value)
+		{
+			if (Instrumentation::IsEnabled())
+				m_value->fetch_add(value, std::memory_order_relaxed);
+		}
+		void Increment() { Add(1); }
+		int64_t GetValue() const { return m_value->load(std::memory_order_relaxed); }
+	};
+
+	/*!
+		Distribution of values, such as sizes or durations, in power of two buckets
+
+		\ingroup instrumentation
+	*/
+	class InstrumentationHistogram
+	{
+		Instrumentation::Histogram* m_histogram;
+
+	  public:
+		InstrumentationHistogram(const std::string& name) : m_histogram(Instrumentation::GetHistogram(name)) {}
+
+		void Record(uint64_t value)
+		{
+			if (Instrumentation::IsEnabled())
+				Instrumentation::RecordHistogram(m_histogram, value);
+		}
+		Instrumentation::Histogram* GetObject() const { return m_histogram; }
+	};
+
+	/*!
+		Records the time until the end of the scope, in nanoseconds, in a histogram and as a trace event
+
+		\ingroup instrumentation
+	*/
+	class InstrumentationScope
+	{
+		Instrumentation::Histogram* m_histogram;
+		std::chrono::steady_clock::time_point m_start;
+
+	  public:
+		InstrumentationScope(const InstrumentationHistogram& histogram) :
+		    m_histogram(Instrumentation::IsEnabled() ? histogram.GetObject() : nullptr)
+		{
+			if (m_histogram)
+				m_start = std::chrono::steady_clock::now();
+		}
+		InstrumentationScope(const InstrumentationScope&) = delete;
+		InstrumentationScope& operator=(const InstrumentationScope&) = delete;
+
+		~InstrumentationScope()
+		{
+			if (!m_histogram)
+				return;
+			uint64_t duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			    std::chrono::steady_clock::now() - m_start).count();
+			Instrumentation::RecordHistogram(m_histogram, duration);
+			if (Instrumentation::IsTracingEnabled())
+				Instrumentation::RecordTraceEvent(m_histogram, m_start, duration);
+		}
+	};
+
+	/*! Aggregate timings for an Activity action, see Workflow::GetActivityStatistics
+
+		\ingroup workflow
+	*/
+	struct ActivityStatistics
+	{
+		std::string name;
+		uint64_t invocations;
+		// Invocations whose action threw an exception
+		uint64_t failures;
+		uint64_t wallTimeNs;
+		uint64_t cpuTimeNs;
+		uint64_t maxWallTimeNs;
+	};
+
 	/*!
 		\ingroup workflow
 	*/
 	class Activity : public CoreRefCountObject<BNActivity, BNNewActivityReference, BNFreeActivity>
 	{
+	  public:
+		// Timing counters shared by activities with the same name, defined in activity.cpp
+		struct Counters;
+
+	  private:
+		std::shared_ptr<Counters> m_counters;
+
 	  protected:
 		std::function<void(Ref<AnalysisContext> analysisContext)> m_action;
 		std::function<bool(Ref<Activity>, Ref<AnalysisContext>)> m_eligibility;
@@ -10029,6 +12207,32 @@ namespace BinaryNinja {
 		*/
 		static bool RegisterWorkflow(Ref<Workflow> workflow, const std::string& description = "");
 
+		/*! Get timings for every Activity action created through this API, cumulative since the last reset
+
+			Only actions implemented with the C++ Activity class are measured; core and Python activities are
+			not included. See Function::GetAnalysisPerformanceInfo for the core's own per-function timings.
+
+			\return Statistics for each activity name that has run
+		*/
+		static std::vector<ActivityStatistics> GetActivityStatistics();
+		static void ResetActivityStatistics();
+
+		/*! Record each Activity action invocation for export as a trace
+
+			\param enabled Whether to record; enabling discards any previously recorded events
+			\param maxEvents Events beyond this count are not recorded
+		*/
+		static void SetActivityTracingEnabled(bool enabled, size_t maxEvents = 1000000);
+
+		/*! Get the recorded Activity invocations in the Chrome trace event format
+
+			The result can be loaded in chrome://tracing or Perfetto. Each event carries the start address of
+			the function that was analyzed, if any.
+
+			\return Trace JSON
+		*/
+		static std::string GetActivityTraceJson();
+
 		/*! Clone a workflow, copying all Activities and the execution strategy
 
 			\param name Name for the new Workflow
@@ -10583,12 +12787,44 @@ namespace BinaryNinja {
 	class Component;
 	struct SSAVariable;
 
+	/*! Dominator tree of a function's basic blocks, with blocks identified by BasicBlock::GetIndex.
+
+		\ingroup function
+	*/
+	struct DominatorTree
+	{
+		static constexpr size_t NoBlock = (size_t)-1;
+
+		std::vector<Ref<BasicBlock>> blocks;  //!< Basic blocks of the function, by index
+		std::vector<size_t> immediateDominators;  //!< Immediate dominator of each block, or NoBlock for roots
+
+		//! Dominance frontiers in compressed sparse row form, when requested. The frontier of block \c i is
+		//! \c frontier[frontierOffsets[i]] up to \c frontier[frontierOffsets[i + 1]].
+		std::vector<size_t> frontierOffsets;
+		std::vector<size_t> frontier;
+		bool hasFrontiers = false;
+	};
+
 	/*!
 		\ingroup function
 	*/
 	class Function : public CoreRefCountObject<BNFunction, BNNewFunctionReference, BNFreeFunction>
 	{
 		int m_advancedAnalysisRequests;
+		mutable std::mutex m_dominatorTreeMutex;
+		mutable std::shared_ptr<const DominatorTree> m_dominatorTrees[2];
+
+		struct VariableListCache
+		{
+			std::shared_ptr<const std::vector<VariableNameAndType>> variables;
+			std::vector<size_t> positions;  // Index in variables of each entry, in the order the core returned them
+		};
+		std::mutex m_variableCacheMutex;
+		VariableListCache m_variableCache;
+		VariableListCache m_stackLayoutCache;
+
+		std::shared_ptr<const std::vector<VariableNameAndType>> GetCachedVariableList(
+			BNVariableNameAndType* vars, size_t count, VariableListCache& cache, bool byStackOffset);
 
 		bool IsRegionCollapsed(uint64_t hash) const;
 
@@ -10668,6 +12904,22 @@ namespace BinaryNinja {
 		*/
 		std::vector<Ref<BasicBlock>> GetBasicBlocks() const;
 
+		/*! Get the Basic Blocks for this function without wrapping each one
+
+			\return Basic blocks of this function, wrapped on access
+		*/
+		BorrowedList<BasicBlock> BorrowBasicBlocks() const;
+
+		/*! Get the dominator or post-dominator tree of every basic block in this function at once
+
+			The tree is kept on this object and reused until the function's basic blocks are regenerated.
+
+			\param post Whether to get the post-dominator tree
+			\param frontiers Whether to also get the dominance frontier of every block
+			\return The dominator tree
+		*/
+		std::shared_ptr<const DominatorTree> GetDominatorTree(bool post = false, bool frontiers = false) const;
+
 		/*! Get the basic block an address is located in
 
 			\param arch Architecture for the basic block
@@ -10819,6 +13071,30 @@ namespace BinaryNinja {
 
 		RegisterValue GetRegisterValueAtInstruction(Architecture* arch, uint64_t addr, uint32_t reg);
 		RegisterValue GetRegisterValueAfterInstruction(Architecture* arch, uint64_t addr, uint32_t reg);
+
+		/*! Get the values of many registers at once
+
+			\param arch Architecture of the instructions
+			\param queries (address, register) pairs to query
+			\param after Whether to get the values after the instructions instead of before
+			\return The value of each query, in the same order
+		*/
+		std::vector<RegisterValue> GetRegisterValuesAtInstructions(Architecture* arch,
+			const std::vector<std::pair<uint64_t, uint32_t>>& queries, bool after = false);
+
+		/*! Get the values of the same registers at each of several instructions
+
+			Pass Architecture::GetFullWidthRegisters to get every register.
+
+			\param arch Architecture of the instructions
+			\param addrs Addresses of the instructions
+			\param regs Registers to query at every address
+			\param after Whether to get the values after the instructions instead of before
+			\return The values by address, then register: the value of \c regs[j] at \c addrs[i] is at
+				\c i * regs.size() + j
+		*/
+		std::vector<RegisterValue> GetRegisterValuesAtInstructions(Architecture* arch, const std::vector<uint64_t>& addrs,
+			const std::vector<uint32_t>& regs, bool after = false);
 		RegisterValue GetStackContentsAtInstruction(Architecture* arch, uint64_t addr, int64_t offset, size_t size);
 		RegisterValue GetStackContentsAfterInstruction(Architecture* arch, uint64_t addr, int64_t offset, size_t size);
 		RegisterValue GetParameterValueAtInstruction(Architecture* arch, uint64_t addr, Type* functionType, size_t i);
@@ -10951,6 +13227,15 @@ namespace BinaryNinja {
 		Ref<FlowGraph> CreateFunctionGraph(const FunctionViewType& type, DisassemblySettings* settings = nullptr);
 
 		std::map<int64_t, std::vector<VariableNameAndType>> GetStackLayout();
+
+		/*! Get the stack layout as a flat list sorted by stack offset
+
+			The list is kept on this object and returned again for as long as the layout is unchanged, so
+			repeated queries don't rebuild names and types.
+
+			\return Stack variables, in the order GetStackLayout would list them
+		*/
+		std::shared_ptr<const std::vector<VariableNameAndType>> GetStackLayoutSnapshot();
 		void CreateAutoStackVariable(int64_t offset, const Confidence<Ref<Type>>& type, const std::string& name);
 		void CreateUserStackVariable(int64_t offset, const Confidence<Ref<Type>>& type, const std::string& name);
 		void DeleteAutoStackVariable(int64_t offset);
@@ -10962,6 +13247,15 @@ namespace BinaryNinja {
 			\return List of Function Variables
 		*/
 		std::map<Variable, VariableNameAndType> GetVariables();
+
+		/*! Get the function's variables as a flat list sorted by Variable
+
+			The list is kept on this object and returned again for as long as the variables are unchanged, so
+			repeated queries don't rebuild names and types.
+
+			\return Function variables, in the order GetVariables would list them
+		*/
+		std::shared_ptr<const std::vector<VariableNameAndType>> GetVariablesSnapshot();
 		std::set<Variable> GetMediumLevelILVariables();
 		std::set<Variable> GetMediumLevelILAliasedVariables();
 		std::set<SSAVariable> GetMediumLevelILSSAVariables();
@@ -11195,6 +13489,16 @@ namespace BinaryNinja {
 		void ExpandAll();
 	};
 
+	// Defined here as it needs the complete Function
+	template <typename T, size_t ShardCount>
+	std::shared_ptr<const T> AnalysisDataStore<T, ShardCount>::Get(AnalysisContext* context) const
+	{
+		Ref<Function> func = context->GetFunction();
+		if (!func)
+			return nullptr;
+		return Get(func->GetView(), func->GetStart());
+	}
+
 	/*!
 		\ingroup function
 	*/
@@ -11345,6 +13649,13 @@ namespace BinaryNinja {
 		bool IsValidForGraph(FlowGraph* graph) const;
 
 		void SetVisibilityRegion(int x, int y, int w, int h);
+
+		/*! Set the points of an outgoing edge, for use by a FlowGraphLayout
+
+			\param edgeNum Index of the edge in GetOutgoingEdges
+			\param points Points of the edge, from source to target
+		*/
+		void SetOutgoingEdgePoints(size_t edgeNum, const std::vector<BNPoint>& points);
 	};
 
 	/*!
@@ -11368,6 +13679,17 @@ namespace BinaryNinja {
 		void Abort();
 	};
 
+	/*! Position, size and highlight of a flow graph node, without its text.
+
+		\ingroup flowgraph
+	*/
+	struct FlowGraphNodeBounds
+	{
+		Ref<FlowGraphNode> node;
+		int x, y, width, height;
+		BNHighlightColor highlight;
+	};
+
 	/*! FlowGraph implements a directed flow graph to be shown in the UI. This class allows plugins to
 			create custom flow graphs and render them in the UI using the flow graph report API.
 
@@ -11507,6 +13829,22 @@ namespace BinaryNinja {
 
 		std::vector<Ref<FlowGraphNode>> GetNodesInRegion(int left, int top, int right, int bottom);
 
+		/*! Get the bounds of the nodes in or near a region of a laid out graph, without fetching any node text.
+
+			Meant for renderers of very large graphs: everything needed to draw a node as a collapsed box,
+			or to draw a minimap, comes from the bounds. FlowGraphNode::GetLines then only needs to be called
+			for the nodes that are drawn with text.
+
+			\param left Left edge of the region
+			\param top Top edge of the region
+			\param right Right edge of the region
+			\param bottom Bottom edge of the region
+			\param margin Distance to extend the region by on every side, so nodes about to scroll into view
+			are included
+			\return Bounds of the nodes intersecting the extended region
+		*/
+		std::vector<FlowGraphNodeBounds> GetNodeBoundsInRegion(int left, int top, int right, int bottom, int margin = 0);
+
 		/*! Whether this graph is representing IL.
 
 			\return Whether this graph is representing IL.
@@ -11614,8 +13952,37 @@ namespace BinaryNinja {
 		virtual Ref<FlowGraph> Update() override;
 	};
 
+	/*! Layout results a FlowGraphLayout keeps between runs on the same graph.
+
+		Graphs are rebuilt from scratch on every refresh, so nodes are identified by a key derived from
+		their basic block (or position in the node list when they have none) rather than by object.
+
+		\ingroup flowgraph
+	*/
+	struct FlowGraphLayoutState
+	{
+		struct NodeState
+		{
+			// Layer and position within the layer, the expensive part of a layered layout
+			size_t layer;
+			size_t order;
+			// Connected component the node was laid out in, and a hash of its outgoing edge targets
+			size_t component;
+			uint64_t edgeSignature;
+		};
+
+		std::unordered_map<uint64_t, NodeState> nodes;
+		std::vector<size_t> componentSizes;
+	};
+
+	/*!
+		\ingroup flowgraph
+	*/
 	class FlowGraphLayout : public StaticCoreRefCountObject<BNFlowGraphLayout>
 	{
+		std::mutex m_stateMutex;
+		std::map<std::tuple<BNFunction*, uint64_t, int>, FlowGraphLayoutState> m_states;
+
 	  protected:
 		FlowGraphLayout(BNFlowGraphLayout* layout);
 
@@ -11632,6 +13999,19 @@ namespace BinaryNinja {
 
 		std::string GetName() const;
 		virtual bool Layout(Ref<FlowGraph> graph, std::vector<Ref<FlowGraphNode>>& nodes);
+
+		/*! Lay out \c nodes with access to what the previous layout of the same graph left behind.
+
+			Registered layouts are called through this overload. \c state holds whatever the last call for
+			this function and IL form stored in it, and is kept for the next call once this one returns.
+			The default implementation ignores it and calls the two argument Layout.
+
+			\param graph Graph being laid out
+			\param nodes Nodes of the graph
+			\param state State from the previous layout of this graph, to be updated
+			\return Whether the layout succeeded
+		*/
+		virtual bool Layout(Ref<FlowGraph> graph, std::vector<Ref<FlowGraphNode>>& nodes, FlowGraphLayoutState& state);
 	};
 
 	class CoreFlowGraphLayout : public FlowGraphLayout
@@ -11639,9 +14019,37 @@ namespace BinaryNinja {
 	  public:
 		CoreFlowGraphLayout(BNFlowGraphLayout* layout);
 
+		using FlowGraphLayout::Layout;
 		virtual bool Layout(Ref<FlowGraph> graph, std::vector<Ref<FlowGraphNode>>& nodes) override;
 	};
 
+	/*! Layered layout that reuses the previous layout of a graph where its structure hasn't changed.
+
+		Nodes are split into connected components, which are laid out in parallel and placed side by side.
+		Assigning layers and ordering nodes within them is the costly part. A component whose nodes and edges
+		all match the previous layout keeps that assignment and only has coordinates recomputed, so edits that
+		change node contents or highlights (patches, comments, highlighting) stay cheap on very large graphs.
+
+		Register an instance with FlowGraphLayout::Register to make it available by name.
+
+		\ingroup flowgraph
+	*/
+	class IncrementalFlowGraphLayout : public FlowGraphLayout
+	{
+		size_t m_threads;
+
+	  public:
+		/*!
+			\param name Name to register the layout under
+			\param threads Threads to lay out components on, or 0 to use the worker thread count
+		*/
+		IncrementalFlowGraphLayout(const std::string& name = "incremental", size_t threads = 0);
+
+		using FlowGraphLayout::Layout;
+		virtual bool Layout(Ref<FlowGraph> graph, std::vector<Ref<FlowGraphNode>>& nodes,
+		    FlowGraphLayoutState& state) override;
+	};
+
 	/*!
 		\ingroup lowlevelil
 	*/
@@ -11673,6 +14081,265 @@ namespace BinaryNinja {
 		{}
 	};
 
+	/*! Read-only snapshot of the expressions of an IL function, copied out of the core in one pass.
+
+		An arena attached to an IL function object serves that object's expression and instruction lookups
+		without calling into the core. It reflects the function at the time it was taken.
+
+		\ingroup lowlevelil
+	*/
+	template <typename T>
+	struct ILExprArena
+	{
+		std::vector<T> exprs;
+		std::vector<size_t> instructionForExpr;
+		std::vector<size_t> exprForInstruction;
+	};
+
+	typedef ILExprArena<BNLowLevelILInstruction> LowLevelILExprArena;
+	typedef ILExprArena<BNMediumLevelILInstruction> MediumLevelILExprArena;
+
+	/*!
+		\ingroup highlevelil
+	*/
+	struct HighLevelILExprArena : public ILExprArena<BNHighLevelILInstruction>
+	{
+		// `exprs` holds the full AST form of each expression, this holds the non-AST form
+		std::vector<BNHighLevelILInstruction> nonASTExprs;
+	};
+
+	/*! Def-use information for every SSA variable (or register) of an IL function, in flattened form.
+
+		\c variables is sorted. For the variable at index \c i, \c definitions[i] is its defining instruction and
+		its uses are the sorted instruction indices in \c uses[useOffsets[i]] up to \c uses[useOffsets[i + 1]].
+
+		\ingroup mediumlevelil
+	*/
+	template <typename T>
+	struct SSADefUseTable
+	{
+		std::vector<T> variables;
+		std::vector<size_t> definitions;
+		std::vector<size_t> useOffsets;
+		std::vector<size_t> uses;
+
+		//! Index of \c var in \c variables, or \c variables.size() if it is not in the table
+		size_t GetIndex(const T& var) const
+		{
+			auto i = std::lower_bound(variables.begin(), variables.end(), var);
+			if (i == variables.end() || !(*i == var))
+				return variables.size();
+			return i - variables.begin();
+		}
+
+		size_t GetDefinition(size_t index) const { return definitions[index]; }
+		const size_t* UsesBegin(size_t index) const { return uses.data() + useOffsets[index]; }
+		const size_t* UsesEnd(size_t index) const { return uses.data() + useOffsets[index + 1]; }
+		size_t GetUseCount(size_t index) const { return useOffsets[index + 1] - useOffsets[index]; }
+	};
+
+	/*! Structural hashes of every expression of an IL function.
+
+		An expression's hash covers its operation, size and operands, with subexpressions contributing their own
+		structural hash in place of their index. Addresses and expression indices are not included, so equal
+		subtrees hash equally within and across functions. \c buckets groups the expression indices sharing
+		each hash; equal hashes are candidates for structural equality rather than a proof of it.
+
+		\ingroup highlevelil
+	*/
+	struct ILStructuralHashTable
+	{
+		struct Component
+		{
+			bool isExpr;
+			uint64_t value;
+		};
+
+		std::vector<uint64_t> hashes;
+		std::unordered_map<uint64_t, std::vector<size_t>> buckets;
+
+		static uint64_t Mix(uint64_t hash, uint64_t value)
+		{
+			hash ^= value + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+			hash ^= hash >> 33;
+			hash *= 0xff51afd7ed558ccd;
+			return hash ^ (hash >> 33);
+		}
+
+		/*! Hash expressions 0 to \c exprCount - 1 bottom up.
+
+			\c getComponents(expr, out) appends the components of expression \c expr in operand order; components
+			marked \c isExpr are subexpression indices. Traversal uses an explicit stack, so deep trees are fine.
+		*/
+		template <typename GetComponents>
+		static std::shared_ptr<ILStructuralHashTable> Build(size_t exprCount, GetComponents&& getComponents)
+		{
+			struct Frame
+			{
+				size_t expr;
+				size_t next;
+				std::vector<Component> components;
+			};
+
+			auto table = std::make_shared<ILStructuralHashTable>();
+			table->hashes.resize(exprCount);
+			// 0 = not visited, 1 = on the stack, 2 = hashed
+			std::vector<uint8_t> state(exprCount, 0);
+			std::vector<Frame> stack;
+			for (size_t root = 0; root < exprCount; root++)
+			{
+				if (state[root] != 0)
+					continue;
+				state[root] = 1;
+				stack.push_back({root, 0, {}});
+				getComponents(root, stack.back().components);
+				while (!stack.empty())
+				{
+					Frame& frame = stack.back();
+					while (frame.next < frame.components.size())
+					{
+						const Component& component = frame.components[frame.next];
+						if (component.isExpr && component.value < exprCount && state[component.value] == 0)
+							break;
+						frame.next++;
+					}
+					if (frame.next < frame.components.size())
+					{
+						size_t child = (size_t)frame.components[frame.next].value;
+						state[child] = 1;
+						// May reallocate the stack, so `frame` must not be used past this point
+						stack.push_back({child, 0, {}});
+						getComponents(child, stack.back().components);
+						continue;
+					}
+
+					uint64_t hash = 0xcbf29ce484222325;
+					for (const Component& component : frame.components)
+					{
+						// A subexpression that is out of range or still on the stack can't be expanded, so
+						// only its presence is hashed
+						if (!component.isExpr)
+							hash = Mix(hash, component.value);
+						else if (component.value < exprCount && state[component.value] == 2)
+							hash = Mix(hash, table->hashes[component.value]);
+						else
+							hash = Mix(hash, 0x6a09e667f3bcc909);
+					}
+					table->hashes[frame.expr] = hash;
+					state[frame.expr] = 2;
+					stack.pop_back();
+				}
+			}
+
+			for (size_t i = 0; i < exprCount; i++)
+				table->buckets[table->hashes[i]].push_back(i);
+			return table;
+		}
+
+		/*! Append the components of IL instruction \c instr for \c Build: its operation, its size and the type
+			and value of each operand.
+
+			\c Kinds maps the operand kinds shared by MLIL and HLIL (\c Integer, \c ConstantData, \c Index,
+			\c Intrinsic, \c Expr, \c Variable, \c SSAVariable, \c IndexList, \c SSAVariableList and \c ExprList)
+			to the operand type enumerators of the instruction's IL. Operands of any other type are passed to
+			\c appendOther.
+		*/
+		template <typename Kinds, typename Instruction, typename AppendOther>
+		static void AppendInstruction(
+		    const Instruction& instr, std::vector<Component>& out, AppendOther&& appendOther)
+		{
+			out.push_back({false, (uint64_t)instr.operation});
+			out.push_back({false, (uint64_t)instr.size});
+			for (auto operand : instr.GetOperands())
+			{
+				out.push_back({false, (uint64_t)operand.GetType()});
+				switch (operand.GetType())
+				{
+				case Kinds::Integer:
+					out.push_back({false, operand.GetInteger()});
+					break;
+				case Kinds::ConstantData:
+				{
+					ConstantData data = operand.GetConstantData();
+					out.push_back({false, (uint64_t)data.state});
+					out.push_back({false, (uint64_t)data.value});
+					break;
+				}
+				case Kinds::Index:
+					out.push_back({false, operand.GetIndex()});
+					break;
+				case Kinds::Intrinsic:
+					out.push_back({false, operand.GetIntrinsic()});
+					break;
+				case Kinds::Expr:
+					out.push_back({true, operand.GetExpr().exprIndex});
+					break;
+				case Kinds::Variable:
+					out.push_back({false, operand.GetVariable().ToIdentifier()});
+					break;
+				case Kinds::SSAVariable:
+				{
+					auto var = operand.GetSSAVariable();
+					out.push_back({false, var.var.ToIdentifier()});
+					out.push_back({false, var.version});
+					break;
+				}
+				case Kinds::IndexList:
+					for (size_t i : operand.GetIndexList())
+						out.push_back({false, i});
+					break;
+				case Kinds::SSAVariableList:
+					for (const auto& var : operand.GetSSAVariableList())
+					{
+						out.push_back({false, var.var.ToIdentifier()});
+						out.push_back({false, var.version});
+					}
+					break;
+				case Kinds::ExprList:
+					for (auto i : operand.GetExprList())
+						out.push_back({true, i.exprIndex});
+					break;
+				default:
+					appendOther(operand, out);
+					break;
+				}
+			}
+		}
+	};
+
+	/*! CRTP base for IL expression visitors.
+
+		\c Derived hides \c VisitExpr to handle each expression, typically switching on \c expr.operation for
+		the opcodes it cares about. Returning false skips the subexpressions of that expression. Dispatch is
+		resolved at compile time, so no virtual or \c std::function call is made per expression.
+
+		\code{.cpp}
+		struct CallCounter : ILVisitor<CallCounter, MediumLevelILInstruction>
+		{
+			size_t calls = 0;
+			bool VisitExpr(const MediumLevelILInstruction& expr)
+			{
+				if (expr.operation == MLIL_CALL)
+					calls++;
+				return true;
+			}
+		};
+		\endcode
+
+		\ingroup lowlevelil
+	*/
+	template <typename Derived, typename Instruction>
+	class ILVisitor
+	{
+	  public:
+		void Visit(const Instruction& root)
+		{
+			root.VisitExprs([this](const Instruction& expr) { return static_cast<Derived*>(this)->VisitExpr(expr); });
+		}
+
+		bool VisitExpr(const Instruction&) { return true; }
+	};
+
 	struct LowLevelILInstruction;
 	struct RegisterOrFlag;
 	struct SSARegister;
@@ -11680,6 +14347,11 @@ namespace BinaryNinja {
 	struct SSAFlag;
 	struct SSARegisterOrFlag;
 
+	typedef SSADefUseTable<SSARegister> LowLevelILSSARegisterDefUseTable;
+	typedef SSADefUseTable<SSAVariable> MediumLevelILSSAVariableDefUseTable;
+
+	struct LowLevelILLiftingTemplate;
+
 	/*!
 		\ingroup lowlevelil
 	*/
@@ -11713,6 +14385,17 @@ namespace BinaryNinja {
 		void ClearIndirectBranches();
 		void SetIndirectBranches(const std::vector<ArchAndAddr>& branches);
 
+		/*! Lift one instruction into this function, replaying an earlier lift of the same encoding when possible.
+			See Architecture::SetLowLevelILTemplateCacheEnabled.
+
+			\param arch Architecture to lift with
+			\param data Instruction bytes
+			\param addr Address of the instruction
+			\param[in,out] len Number of bytes available at \c data, then the length of the lifted instruction
+			\return The value Architecture::GetInstructionLowLevelIL returned for this instruction
+		*/
+		bool LiftInstructionWithTemplateCache(Architecture* arch, const uint8_t* data, uint64_t addr, size_t& len);
+
 		/*! Get a list of registers used in the LLIL function
 
 			\see Architecture::GetAllRegisters, Architecture::GetRegisterName, Architecture::GetRegisterInfo
@@ -12974,11 +15657,31 @@ namespace BinaryNinja {
 		LowLevelILInstruction operator[](size_t i);
 		LowLevelILInstruction GetInstruction(size_t i);
 		LowLevelILInstruction GetExpr(size_t i);
+		/*! Append up to \c count instructions (or expressions) starting at index \c start to \c result.
+
+			Cheaper than calling GetInstruction or GetExpr in a loop, and served entirely from the expression
+			arena when one is attached (see GetExprArena).
+
+			\return The number of entries appended, which is less than \c count at the end of the function
+		*/
+		size_t GetInstructions(size_t start, size_t count, std::vector<LowLevelILInstruction>& result);
+		size_t GetExprs(size_t start, size_t count, std::vector<LowLevelILInstruction>& result);
 		size_t GetIndexForInstruction(size_t i) const;
 		size_t GetInstructionForExpr(size_t expr) const;
 		size_t GetInstructionCount() const;
 		size_t GetExprCount() const;
 
+		/*! Snapshot every expression of this function into an arena and attach it to this object.
+
+			While attached, expression and instruction lookups through this object read from the arena
+			instead of calling into the core. Modifying the function through this object releases it.
+			Attaching or releasing must not race with other uses of this object.
+
+			\return The attached arena
+		*/
+		std::shared_ptr<const LowLevelILExprArena> GetExprArena();
+		void ReleaseExprArena();
+
 		void UpdateInstructionOperand(size_t i, size_t operandIndex, ExprId value);
 		void ReplaceExpr(size_t expr, size_t newExpr);
 		void SetExprAttributes(size_t expr, uint32_t attributes);
@@ -13045,6 +15748,12 @@ namespace BinaryNinja {
 		std::set<size_t> GetSSAFlagUses(const SSAFlag& flag) const;
 		std::set<size_t> GetSSAMemoryUses(size_t version) const;
 
+		/*! Definition and uses of every SSA register of this SSA form function, queried once and cached on
+			this object. Cheaper than GetSSARegisterDefinition and GetSSARegisterUses per register when most of
+			them are needed. The cache is dropped when the function is modified through this object.
+		*/
+		std::shared_ptr<const LowLevelILSSARegisterDefUseTable> GetSSARegisterDefUseTable();
+
 		RegisterValue GetSSARegisterValue(const SSARegister& reg);
 		RegisterValue GetSSAFlagValue(const SSAFlag& flag);
 
@@ -13088,6 +15797,14 @@ namespace BinaryNinja {
 		}
 
 		Ref<FlowGraph> CreateFunctionGraph(DisassemblySettings* settings = nullptr);
+
+	  private:
+		void ClearCaches();
+
+		std::shared_ptr<const LowLevelILExprArena> m_exprArena;
+		std::shared_ptr<const LowLevelILSSARegisterDefUseTable> m_ssaRegisterDefUseTable;
+		// Set while LiftInstructionWithTemplateCache records a lift
+		LowLevelILLiftingTemplate* m_liftingTemplate = nullptr;
 	};
 
 	/*!
@@ -13349,11 +16066,37 @@ namespace BinaryNinja {
 		MediumLevelILInstruction operator[](size_t i);
 		MediumLevelILInstruction GetInstruction(size_t i);
 		MediumLevelILInstruction GetExpr(size_t i);
+		/*! Append up to \c count instructions (or expressions) starting at index \c start to \c result.
+
+			Cheaper than calling GetInstruction or GetExpr in a loop, and served entirely from the expression
+			arena when one is attached (see GetExprArena).
+
+			\return The number of entries appended, which is less than \c count at the end of the function
+		*/
+		size_t GetInstructions(size_t start, size_t count, std::vector<MediumLevelILInstruction>& result);
+		size_t GetExprs(size_t start, size_t count, std::vector<MediumLevelILInstruction>& result);
 		size_t GetIndexForInstruction(size_t i) const;
 		size_t GetInstructionForExpr(size_t expr) const;
 		size_t GetInstructionCount() const;
 		size_t GetExprCount() const;
 
+		/*! Snapshot every expression of this function into an arena and attach it to this object.
+
+			While attached, expression and instruction lookups through this object read from the arena
+			instead of calling into the core. Modifying the function through this object releases it.
+			Attaching or releasing must not race with other uses of this object.
+
+			\return The attached arena
+		*/
+		std::shared_ptr<const MediumLevelILExprArena> GetExprArena();
+		void ReleaseExprArena();
+
+		/*! Structural hash of every expression of this function, computed once and cached on this object.
+			Attach an expression arena first (see GetExprArena) to avoid most core calls while hashing. The cache
+			is dropped when the function is modified through this object.
+		*/
+		std::shared_ptr<const ILStructuralHashTable> GetStructuralHashes();
+
 		void UpdateInstructionOperand(size_t i, size_t operandIndex, ExprId value);
 		void MarkInstructionForRemoval(size_t i);
 		void ReplaceInstruction(size_t i, ExprId expr);
@@ -13388,6 +16131,13 @@ namespace BinaryNinja {
 		size_t GetSSAMemoryDefinition(size_t version) const;
 		std::set<size_t> GetSSAVarUses(const SSAVariable& var) const;
 		std::set<size_t> GetSSAMemoryUses(size_t version) const;
+
+		/*! Definition and uses of every SSA variable of this SSA form function, queried once and cached on
+			this object. Cheaper than GetSSAVarDefinition and GetSSAVarUses per variable when most of them are needed.
+			The cache is dropped when the function is modified through this object.
+		*/
+		std::shared_ptr<const MediumLevelILSSAVariableDefUseTable> GetSSAVarDefUseTable();
+
 		bool IsSSAVarLive(const SSAVariable& var) const;
 		bool IsSSAVarLiveAt(const SSAVariable& var, const size_t instr) const;
 		bool IsVarLiveAt(const Variable& var, const size_t instr) const;
@@ -13469,6 +16219,13 @@ namespace BinaryNinja {
 		std::set<size_t> GetLiveInstructionsForVariable(const Variable& var, bool includeLastUse = true);
 
 		Variable GetSplitVariableForDefinition(const Variable& var, size_t instrIndex);
+
+	  private:
+		void ClearCaches();
+
+		std::shared_ptr<const MediumLevelILExprArena> m_exprArena;
+		std::shared_ptr<const MediumLevelILSSAVariableDefUseTable> m_ssaVarDefUseTable;
+		std::shared_ptr<const ILStructuralHashTable> m_structuralHashes;
 	};
 
 	struct HighLevelILInstruction;
@@ -13683,11 +16440,37 @@ namespace BinaryNinja {
 		HighLevelILInstruction operator[](size_t i);
 		HighLevelILInstruction GetInstruction(size_t i);
 		HighLevelILInstruction GetExpr(size_t i, bool asFullAst = true);
+		/*! Append up to \c count instructions (or expressions) starting at index \c start to \c result.
+
+			Cheaper than calling GetInstruction or GetExpr in a loop, and served entirely from the expression
+			arena when one is attached (see GetExprArena).
+
+			\return The number of entries appended, which is less than \c count at the end of the function
+		*/
+		size_t GetInstructions(size_t start, size_t count, std::vector<HighLevelILInstruction>& result);
+		size_t GetExprs(size_t start, size_t count, std::vector<HighLevelILInstruction>& result, bool asFullAst = true);
 		size_t GetIndexForInstruction(size_t i) const;
 		size_t GetInstructionForExpr(size_t expr) const;
 		size_t GetInstructionCount() const;
 		size_t GetExprCount() const;
 
+		/*! Snapshot every expression of this function into an arena and attach it to this object.
+
+			While attached, expression and instruction lookups through this object read from the arena
+			instead of calling into the core. Modifying the function through this object releases it.
+			Attaching or releasing must not race with other uses of this object.
+
+			\return The attached arena
+		*/
+		std::shared_ptr<const HighLevelILExprArena> GetExprArena();
+		void ReleaseExprArena();
+
+		/*! Structural hash of every expression of this function, computed once and cached on this object.
+			Attach an expression arena first (see GetExprArena) to avoid most core calls while hashing. The cache
+			is dropped when the function is modified through this object.
+		*/
+		std::shared_ptr<const ILStructuralHashTable> GetStructuralHashes();
+
 		std::vector<Ref<BasicBlock>> GetBasicBlocks() const;
 		Ref<BasicBlock> GetBasicBlockForInstruction(size_t i) const;
 
@@ -13757,6 +16540,12 @@ namespace BinaryNinja {
 		std::set<Variable> GetVariables();
 		std::set<Variable> GetAliasedVariables();
 		std::set<SSAVariable> GetSSAVariables();
+
+	  private:
+		void ClearCaches();
+
+		std::shared_ptr<const HighLevelILExprArena> m_exprArena;
+		std::shared_ptr<const ILStructuralHashTable> m_structuralHashes;
 	};
 
 	struct LineFormatterSettings
@@ -14060,6 +16849,24 @@ namespace BinaryNinja {
 		static bool IsValidByName(const std::string& name, BinaryView* view);
 		static std::vector<Ref<LanguageRepresentationFunctionType>> GetTypes();
 
+		/*! Renders the High Level IL of many functions in this language, for exporting whole binaries.
+
+		    Functions are rendered concurrently, but \c writer is called on the calling thread once per function,
+		    in the order of \c functions. Only a small window of rendered functions is held while waiting for
+		    their turn. A function whose output exceeds \c maxBufferedTokens is not buffered at all and is
+		    rendered again when it is written instead.
+
+		    \param functions The functions to render.
+		    \param settings The settings for disassembly (optional).
+		    \param writer Called with the lines of each function. Return false to stop rendering.
+		    \param threads Number of threads to render on, or 0 for the worker pool size.
+		    \param maxBufferedTokens Largest number of tokens buffered for a single function.
+		    \return False if \c writer stopped the export early, true otherwise.
+		*/
+		bool RenderFunctions(const std::vector<Ref<Function>>& functions, DisassemblySettings* settings,
+			const std::function<bool(Function*, const std::vector<DisassemblyTextLine>&)>& writer,
+			size_t threads = 0, size_t maxBufferedTokens = 0x100000);
+
 	private:
 		static BNLanguageRepresentationFunction* CreateCallback(
 			void* ctxt, BNArchitecture* arch, BNFunction* owner, BNHighLevelILFunction* highLevelIL);
@@ -14086,6 +16893,19 @@ namespace BinaryNinja {
 			Function* func, DisassemblySettings* settings = nullptr) override;
 	};
 
+	/*! Properties of a function's lifted IL that recognizers commonly test for.
+
+		\ingroup functionrecognizer
+	*/
+	struct LowLevelILFeatures
+	{
+		size_t instructionCount = 0;
+		std::vector<uint64_t> callTargets;  //!< Constant targets of calls and tail calls, sorted and unique
+		std::vector<uint64_t> jumpTargets;  //!< Constant targets of jumps, sorted and unique
+		std::vector<uint64_t> constants;  //!< Every constant and pointer operand, sorted and unique
+		bool hasIndirectBranch = false;  //!< Whether any call or jump goes through a computed destination
+	};
+
 	/*!
 		\ingroup functionrecognizer
 	*/
@@ -14104,6 +16924,17 @@ namespace BinaryNinja {
 
 		virtual bool RecognizeLowLevelIL(BinaryView* data, Function* func, LowLevelILFunction* il);
 		virtual bool RecognizeMediumLevelIL(BinaryView* data, Function* func, MediumLevelILFunction* il);
+
+		/*! Walk \c il once and summarize it for recognizers.
+
+			Every recognizer registered for a function is handed the same IL, so the result is cached for the
+			most recent function on each thread and the later recognizers reuse the first one's walk instead of
+			visiting every expression again.
+
+			\param il Lifted IL passed to RecognizeLowLevelIL
+			\return Features of \c il
+		*/
+		static std::shared_ptr<const LowLevelILFeatures> GetLowLevelILFeatures(LowLevelILFunction* il);
 	};
 
 	class RelocationHandler :
@@ -15163,6 +17994,56 @@ namespace BinaryNinja {
 		void Execute(const PluginCommandContext& ctxt) const;
 	};
 
+	/*!
+		A set of register indices, kept both as the list in its original order and as a bitmask so membership tests
+		don't need to search the list.
+
+		\ingroup callingconvention
+	*/
+	class RegisterSet
+	{
+		std::vector<uint32_t> m_registers;
+		std::vector<uint64_t> m_mask;
+
+	  public:
+		RegisterSet() = default;
+		RegisterSet(std::vector<uint32_t> registers);
+
+		const std::vector<uint32_t>& GetRegisters() const { return m_registers; }
+		bool Contains(uint32_t reg) const;
+
+		size_t size() const { return m_registers.size(); }
+		bool empty() const { return m_registers.empty(); }
+		uint32_t operator[](size_t i) const { return m_registers[i]; }
+		std::vector<uint32_t>::const_iterator begin() const { return m_registers.begin(); }
+		std::vector<uint32_t>::const_iterator end() const { return m_registers.end(); }
+	};
+
+	/*!
+		Snapshot of the register assignments and properties of a CallingConvention. See
+		CallingConvention::GetCachedInfo.
+
+		\ingroup callingconvention
+	*/
+	struct CallingConventionInfo
+	{
+		std::string name;
+		RegisterSet callerSavedRegisters;
+		RegisterSet calleeSavedRegisters;
+		RegisterSet integerArgumentRegisters;
+		RegisterSet floatArgumentRegisters;
+		RegisterSet implicitlyDefinedRegisters;
+		uint32_t integerReturnValueRegister;
+		uint32_t highIntegerReturnValueRegister;
+		uint32_t floatReturnValueRegister;
+		uint32_t globalPointerRegister;
+		bool argumentRegistersSharedIndex;
+		bool argumentRegistersUsedForVarArgs;
+		bool stackReservedForArgumentRegisters;
+		bool stackAdjustedOnReturn;
+		bool eligibleForHeuristics;
+	};
+
 	/*!
 		\ingroup callingconvention
 	*/
@@ -15228,6 +18109,16 @@ namespace BinaryNinja {
 
 		virtual Variable GetIncomingVariableForParameterVariable(const Variable& var, Function* func);
 		virtual Variable GetParameterVariableForIncomingVariable(const Variable& var, Function* func);
+
+		/*! Get the register assignments and properties of this calling convention without querying them again
+
+			The first call for a calling convention reads everything through the getters above and every later call,
+			from any thread and through any CallingConvention object referring to the same convention, returns the
+			same snapshot. Calling conventions are not expected to change once they are registered with a platform.
+
+			\return Shared, immutable snapshot of this calling convention
+		*/
+		std::shared_ptr<const CallingConventionInfo> GetCachedInfo();
 	};
 
 	/*!
@@ -15262,6 +18153,21 @@ namespace BinaryNinja {
 		virtual Variable GetParameterVariableForIncomingVariable(const Variable& var, Function* func) override;
 	};
 
+	/*!
+		Calling conventions of a Platform. See Platform::GetCachedCallingConventions.
+
+		\ingroup Platform
+	*/
+	struct PlatformCallingConventions
+	{
+		Ref<CallingConvention> defaultCallingConvention;
+		Ref<CallingConvention> cdeclCallingConvention;
+		Ref<CallingConvention> stdcallCallingConvention;
+		Ref<CallingConvention> fastcallCallingConvention;
+		Ref<CallingConvention> systemCallConvention;
+		std::vector<Ref<CallingConvention>> callingConventions;
+	};
+
 	/*!
 	    Platform base class. This should be subclassed when creating a new platform
 
@@ -15402,6 +18308,15 @@ namespace BinaryNinja {
 		*/
 		Ref<CallingConvention> GetSystemCallConvention() const;
 
+		/*! Get all of the calling conventions of the platform at once
+
+			The result is kept until a calling convention of the platform is registered or replaced from this API, so
+			analysis code can call this repeatedly without a round trip to the core for each convention.
+
+			\return Shared, immutable set of calling conventions
+		*/
+		std::shared_ptr<const PlatformCallingConventions> GetCachedCallingConventions() const;
+
 		/*! Register a Calling Convention
 
 			\param cc Calling Convention to register
@@ -15663,30 +18578,83 @@ namespace BinaryNinja {
 		virtual bool GetOptionText(BNTypeParserOption option, std::string value, std::string& result) const;
 
 		/*!
-		    Preprocess a block of source, returning the source that would be parsed
-		    \param source Source code to process
-		    \param fileName Name of the file containing the source (does not need to exist on disk)
-		    \param platform Platform to assume the source is relevant to
+		    Preprocess a block of source, returning the source that would be parsed
+		    \param source Source code to process
+		    \param fileName Name of the file containing the source (does not need to exist on disk)
+		    \param platform Platform to assume the source is relevant to
+		    \param existingTypes Container of all existing types to use for parsing context
+		    \param options String arguments to pass as options, e.g. command line arguments
+		    \param includeDirs List of directories to include in the header search path
+		    \param output Reference to a string into which the preprocessed source will be written
+		    \param errors Reference to a list into which any parse errors will be written
+		    \return True if preprocessing was successful
+		*/
+		virtual bool PreprocessSource(
+			const std::string& source,
+			const std::string& fileName,
+			Ref<Platform> platform,
+			std::optional<TypeContainer> existingTypes,
+			const std::vector<std::string>& options,
+			const std::vector<std::string>& includeDirs,
+			std::string& output,
+			std::vector<TypeParserError>& errors
+		) = 0;
+
+		/*!
+		    Parse an entire block of source into types, variables, and functions
+		    \param source Source code to parse
+		    \param fileName Name of the file containing the source (optional: exists on disk)
+		    \param platform Platform to assume the types are relevant to
+		    \param existingTypes Container of all existing types to use for parsing context
+		    \param options String arguments to pass as options, e.g. command line arguments
+		    \param includeDirs List of directories to include in the header search path
+		    \param autoTypeSource Optional source of types if used for automatically generated types
+		    \param result Reference to structure into which the results will be written
+		    \param errors Reference to a list into which any parse errors will be written
+		    \return True if parsing was successful
+		*/
+		virtual bool ParseTypesFromSource(
+			const std::string& source,
+			const std::string& fileName,
+			Ref<Platform> platform,
+			std::optional<TypeContainer> existingTypes,
+			const std::vector<std::string>& options,
+			const std::vector<std::string>& includeDirs,
+			const std::string& autoTypeSource,
+			TypeParserResult& result,
+			std::vector<TypeParserError>& errors
+		) = 0;
+
+		/*!
+		    Parse an entire source file into types, variables, and functions
+		    \param fileName Name of the file on disk containing the source
+		    \param platform Platform to assume the types are relevant to
 		    \param existingTypes Container of all existing types to use for parsing context
 		    \param options String arguments to pass as options, e.g. command line arguments
 		    \param includeDirs List of directories to include in the header search path
-		    \param output Reference to a string into which the preprocessed source will be written
+		    \param autoTypeSource Optional source of types if used for automatically generated types
+		    \param result Reference to structure into which the results will be written
 		    \param errors Reference to a list into which any parse errors will be written
-		    \return True if preprocessing was successful
+		    \return True if parsing was successful
 		*/
-		virtual bool PreprocessSource(
-			const std::string& source,
+		bool ParseTypesFromSourceFile(
 			const std::string& fileName,
 			Ref<Platform> platform,
 			std::optional<TypeContainer> existingTypes,
 			const std::vector<std::string>& options,
 			const std::vector<std::string>& includeDirs,
-			std::string& output,
+			const std::string& autoTypeSource,
+			TypeParserResult& result,
 			std::vector<TypeParserError>& errors
-		) = 0;
+		);
 
 		/*!
-		    Parse an entire block of source into types, variables, and functions
+		    Parse an entire block of source like ParseTypesFromSource, reusing the result of an earlier
+		    successful call with the same parser, platform, type container, options, include directories,
+		    file name and source.
+
+		    Headers found through the include directories are not part of the key, and neither are the
+		    contents of \c existingTypes, only its id. Call ClearParseCache after changing either.
 		    \param source Source code to parse
 		    \param fileName Name of the file containing the source (optional: exists on disk)
 		    \param platform Platform to assume the types are relevant to
@@ -15698,7 +18666,7 @@ namespace BinaryNinja {
 		    \param errors Reference to a list into which any parse errors will be written
 		    \return True if parsing was successful
 		*/
-		virtual bool ParseTypesFromSource(
+		bool ParseTypesFromSourceCached(
 			const std::string& source,
 			const std::string& fileName,
 			Ref<Platform> platform,
@@ -15708,31 +18676,37 @@ namespace BinaryNinja {
 			const std::string& autoTypeSource,
 			TypeParserResult& result,
 			std::vector<TypeParserError>& errors
-		) = 0;
+		);
 
 		/*!
-		    Parse an entire source file into types, variables, and functions
-		    \param fileName Name of the file on disk containing the source
+		    Parse several independent source files in parallel, each as its own translation unit and through
+		    ParseTypesFromSourceCached
+		    \param fileNames Names of the files on disk containing the source
 		    \param platform Platform to assume the types are relevant to
 		    \param existingTypes Container of all existing types to use for parsing context
 		    \param options String arguments to pass as options, e.g. command line arguments
 		    \param includeDirs List of directories to include in the header search path
 		    \param autoTypeSource Optional source of types if used for automatically generated types
-		    \param result Reference to structure into which the results will be written
-		    \param errors Reference to a list into which any parse errors will be written
-		    \return True if parsing was successful
+		    \param results Reference to a list into which the result of each file will be written, in order
+		    \param errors Reference to a list into which any parse errors will be written, in file order
+		    \return True if parsing every file was successful
 		*/
-		bool ParseTypesFromSourceFile(
-			const std::string& fileName,
+		bool ParseTypesFromSourceFiles(
+			const std::vector<std::string>& fileNames,
 			Ref<Platform> platform,
 			std::optional<TypeContainer> existingTypes,
 			const std::vector<std::string>& options,
 			const std::vector<std::string>& includeDirs,
 			const std::string& autoTypeSource,
-			TypeParserResult& result,
+			std::vector<TypeParserResult>& results,
 			std::vector<TypeParserError>& errors
 		);
 
+		/*!
+		    Drop every result kept by ParseTypesFromSourceCached
+		*/
+		static void ClearParseCache();
+
 		/*!
 		    Parse a single type and name from a string containing their definition.
 		    \param source Source code to parse
@@ -16014,6 +18988,51 @@ namespace BinaryNinja {
 			Ref<BinaryView> data, int paddingCols, BNTokenEscapingType escaping) override;
 	};
 
+	/*! Cache of the printed lines of a view's types, keyed by type id and printer settings.
+
+		Every entry is dropped when the view reports a type being defined, undefined or changing references,
+		since a type's lines can depend on other types.
+
+		\ingroup typeprinter
+	*/
+	class TypeLinesCache : public BinaryDataNotification
+	{
+		Ref<BinaryView> m_view;
+		std::mutex m_mutex;
+		std::unordered_map<std::string, std::shared_ptr<const std::vector<TypeDefinitionLine>>> m_lines;
+		uint64_t m_generation = 0;
+
+	  public:
+		/*!
+			\param view View whose types are printed, watched for changes
+		*/
+		TypeLinesCache(BinaryView* view);
+		virtual ~TypeLinesCache();
+
+		/*! Lines for the type with id \c typeId, as TypePrinter::GetTypeLines would return them
+
+			\return The lines, or nullptr if there is no type with that id
+		*/
+		std::shared_ptr<const std::vector<TypeDefinitionLine>> GetTypeLines(TypePrinter* printer,
+			const std::string& typeId, int paddingCols = 64, bool collapsed = false,
+			BNTokenEscapingType escaping = NoTokenEscapingType);
+
+		/*! Print every type in the view, each after the types it depends on
+
+			\param callback Called with each type's name and lines in turn; return false to stop
+		*/
+		void PrintTypesInDependencyOrder(TypePrinter* printer,
+			const std::function<bool(const QualifiedName&, const std::vector<TypeDefinitionLine>&)>& callback,
+			int paddingCols = 64, bool collapsed = false, BNTokenEscapingType escaping = NoTokenEscapingType);
+
+		/*! Drop every cached line */
+		void Invalidate();
+
+		void OnTypeDefined(BinaryView* data, const QualifiedName& name, Type* type) override;
+		void OnTypeUndefined(BinaryView* data, const QualifiedName& name, Type* type) override;
+		void OnTypeReferenceChanged(BinaryView* data, const QualifiedName& name, Type* type) override;
+	};
+
 	// DownloadProvider
 	class DownloadProvider;
 
@@ -16407,7 +19426,17 @@ namespace BinaryNinja {
 	class BackgroundTask :
 	    public CoreRefCountObject<BNBackgroundTask, BNNewBackgroundTaskReference, BNFreeBackgroundTask>
 	{
+		std::shared_ptr<const std::string> m_progressDescription;
+		std::atomic<uint64_t> m_progressCurrent = 0;
+		std::atomic<uint64_t> m_progressTotal = 0;
+		std::atomic<int64_t> m_nextProgressUpdate = 0;  // steady_clock ticks
+
+		void PublishProgress();
+
 	  public:
+		/*! Shortest time between two progress texts sent by SetProgress */
+		static constexpr std::chrono::milliseconds ProgressUpdateInterval = std::chrono::milliseconds(100);
+
 		BackgroundTask(BNBackgroundTask *task);
 
 		/*!
@@ -16433,6 +19462,20 @@ namespace BinaryNinja {
 		void Finish();
 		void SetProgressText(const std::string& text);
 
+		/*! Set the text that SetProgress shows the counts after, as "description (current/total)" */
+		void SetProgressDescription(const std::string& description);
+
+		/*! Report that \c current of \c total items are done
+
+			Meant to be called for every item of a loop, from any number of threads. The counts are only stored,
+			and the progress text is composed from them and sent to the core at most once per
+			ProgressUpdateInterval, so most calls don't allocate or take a lock.
+		*/
+		void SetProgress(uint64_t current, uint64_t total);
+
+		/*! Add \c count to the items done, as SetProgress does */
+		void AddProgress(uint64_t count = 1);
+
 		static std::vector<Ref<BackgroundTask>> GetRunningTasks();
 	};
 
@@ -16939,10 +19982,19 @@ namespace BinaryNinja {
 	 	A "generic" type renderer is able to be overridden by a "type specific" renderer. For instance there is a
 	 	generic struct render which renders any struct that hasn't been explicitly overridden by a "type specific" renderer.
 
+		The core asks every registered renderer about every piece of data that is rendered. A renderer that only
+		handles some types should declare them with `AddHandledTypeClass()` or `AddHandledStructName()` before it
+		is registered, so that other types are turned down without calling `IsValidForData`.
+
 		\ingroup datarenderer
 	*/
 	class DataRenderer : public CoreRefCountObject<BNDataRenderer, BNNewDataRendererReference, BNFreeDataRenderer>
 	{
+		std::set<BNTypeClass> m_handledTypeClasses;
+		std::set<QualifiedName> m_handledStructNames;
+
+		bool MightHandle(BNType* type, BNTypeContext* typeCtx, size_t ctxCount) const;
+
 		static bool IsValidForDataCallback(
 		    void* ctxt, BNBinaryView* data, uint64_t addr, BNType* type, BNTypeContext* typeCtx, size_t ctxCount);
 		static BNDisassemblyTextLine* GetLinesForDataCallback(void* ctxt, BNBinaryView* data, uint64_t addr,
@@ -16954,6 +20006,20 @@ namespace BinaryNinja {
 	  public:
 		DataRenderer();
 		DataRenderer(BNDataRenderer* renderer);
+
+		/*! Only offer data of type class \c typeClass to this renderer, along with the other declared types
+
+			Renderers that declare nothing are offered everything. Call this before registering the renderer.
+		*/
+		void AddHandledTypeClass(BNTypeClass typeClass);
+
+		/*! Only offer structures named \c name to this renderer, as IsStructOfTypeName matches them, along with
+			the other declared types
+
+			Renderers that declare nothing are offered everything. Call this before registering the renderer.
+		*/
+		void AddHandledStructName(const QualifiedName& name);
+
 		virtual bool IsValidForData(
 		    BinaryView* data, uint64_t addr, Type* type, std::vector<std::pair<Type*, size_t>>& context);
 		virtual std::vector<DisassemblyTextLine> GetLinesForData(BinaryView* data, uint64_t addr, Type* type,
@@ -17177,6 +20243,76 @@ namespace BinaryNinja {
 		static int Compare(LinearViewCursor* a, LinearViewCursor* b);
 	};
 
+	/*! Bounded cache of linear view lines keyed by object path, filled ahead of and behind a cursor on worker threads.
+
+		GetLines returns the lines at a cursor, generating them synchronously only on a miss, and queues
+		background generation for the objects around it so that scrolling mostly hits the cache.
+
+		Entries are dropped when the view reports a change overlapping their address range; data insertion
+		and removal, symbol, type, segment and section changes drop everything. Lines depend on the cursor's
+		root object and render layers, so use one cache per linear view configuration.
+
+		\ingroup lineardisassembly
+	*/
+	class LinearViewLineCache : public BinaryDataNotification
+	{
+		struct State;
+		std::shared_ptr<State> m_state;
+		Ref<BinaryView> m_view;
+
+		void InvalidateRange(uint64_t start, uint64_t end);
+
+	  public:
+		/*!
+			\param view View the cursors belong to, watched for changes
+			\param maxObjects Number of objects to keep lines for
+			\param prefetchAhead Number of objects after the cursor to generate in the background
+			\param prefetchBehind Number of objects before the cursor to generate in the background
+		*/
+		LinearViewLineCache(
+		    BinaryView* view, size_t maxObjects = 4096, size_t prefetchAhead = 64, size_t prefetchBehind = 16);
+		virtual ~LinearViewLineCache();
+
+		/*! Lines for the object at \c cursor, as LinearViewCursor::GetLines would return them
+
+			Also queues a Prefetch around \c cursor.
+		*/
+		std::vector<LinearDisassemblyLine> GetLines(LinearViewCursor* cursor);
+
+		/*! Queue background generation of the objects around \c cursor, replacing any prefetch still running */
+		void Prefetch(LinearViewCursor* cursor);
+
+		/*! Drop every cached line */
+		void Invalidate();
+
+		void GetStats(uint64_t& hits, uint64_t& misses) const;
+
+		void OnBinaryDataWritten(BinaryView* view, uint64_t offset, size_t len) override;
+		void OnBinaryDataInserted(BinaryView* view, uint64_t offset, size_t len) override;
+		void OnBinaryDataRemoved(BinaryView* view, uint64_t offset, uint64_t len) override;
+		void OnAnalysisFunctionAdded(BinaryView* view, Function* func) override;
+		void OnAnalysisFunctionRemoved(BinaryView* view, Function* func) override;
+		void OnAnalysisFunctionUpdated(BinaryView* view, Function* func) override;
+		void OnDataVariableAdded(BinaryView* view, const DataVariable& var) override;
+		void OnDataVariableRemoved(BinaryView* view, const DataVariable& var) override;
+		void OnDataVariableUpdated(BinaryView* view, const DataVariable& var) override;
+		void OnTagAdded(BinaryView* view, const TagReference& tagRef) override;
+		void OnTagRemoved(BinaryView* view, const TagReference& tagRef) override;
+		void OnTagUpdated(BinaryView* view, const TagReference& tagRef) override;
+		void OnSymbolAdded(BinaryView* view, Symbol* sym) override;
+		void OnSymbolRemoved(BinaryView* view, Symbol* sym) override;
+		void OnSymbolUpdated(BinaryView* view, Symbol* sym) override;
+		void OnTypeDefined(BinaryView* data, const QualifiedName& name, Type* type) override;
+		void OnTypeUndefined(BinaryView* data, const QualifiedName& name, Type* type) override;
+		void OnTypeReferenceChanged(BinaryView* data, const QualifiedName& name, Type* type) override;
+		void OnSegmentAdded(BinaryView* data, Segment* segment) override;
+		void OnSegmentRemoved(BinaryView* data, Segment* segment) override;
+		void OnSegmentUpdated(BinaryView* data, Segment* segment) override;
+		void OnSectionAdded(BinaryView* data, Section* section) override;
+		void OnSectionRemoved(BinaryView* data, Section* section) override;
+		void OnSectionUpdated(BinaryView* data, Section* section) override;
+	};
+
 	/*!
 
 		\ingroup simplifyname
@@ -17295,6 +20431,14 @@ namespace BinaryNinja {
 		bool AddType(const std::string& name, Ref<Type> type, const std::vector<std::string>& components = {});
 		bool AddFunction(const DebugFunctionInfo& function);
 		bool AddDataVariable(uint64_t address, Ref<Type> type, const std::string& name = "", const std::vector<std::string>& components = {});
+
+		/*! Remove the functions and data variables that an earlier container already has at the same address,
+			so applying the containers in order keeps the information of the parser that comes first. Types are
+			scoped by parser name and are left alone.
+
+			\param debugInfos Containers in order of priority
+		*/
+		static void ResolveConflicts(const std::vector<Ref<DebugInfo>>& debugInfos);
 	};
 
 	/*!
@@ -17313,6 +20457,20 @@ namespace BinaryNinja {
 		std::string GetName() const;
 		Ref<DebugInfo> Parse(Ref<BinaryView> view, Ref<BinaryView> debugView, Ref<DebugInfo> existingDebugInfo = nullptr, std::function<bool(size_t, size_t)> progress = {}) const;
 
+		/*! Run every parser on its own thread, each into a new DebugInfo, instead of one after the other
+
+			progress is called from the parser threads with the combined progress of all of them; returning false
+			cancels the parsers that are still running.
+
+			\param view View the debug info is for
+			\param debugView View of the file holding the debug info
+			\param parsers Parsers to run
+			\param progress Combined progress callback
+			\return One DebugInfo per parser, in the order of parsers, nullptr where a parser failed
+		*/
+		static std::vector<Ref<DebugInfo>> ParseConcurrently(Ref<BinaryView> view, Ref<BinaryView> debugView,
+			const std::vector<Ref<DebugInfoParser>>& parsers, std::function<bool(size_t, size_t)> progress = {});
+
 		bool IsValidForView(const Ref<BinaryView> view) const;
 	};
 
@@ -17535,6 +20693,42 @@ namespace BinaryNinja {
 
 		bool RemoveDataVariable(DataVariable dataVariable);
 
+		/*! Add several functions to this component as one undo action
+
+		 	@threadsafe
+
+			\param funcs Functions to add
+			\return Number of functions that were added
+		*/
+		size_t AddFunctions(const std::vector<Ref<Function>>& funcs);
+
+		/*! Remove several functions from this component as one undo action
+
+		 	@threadsafe
+
+			\param funcs Functions to remove
+			\return Number of functions that were removed
+		*/
+		size_t RemoveFunctions(const std::vector<Ref<Function>>& funcs);
+
+		/*! Add the data variables at several addresses to this component as one undo action
+
+		 	@threadsafe
+
+			\param addresses Addresses of the data variables to add
+			\return Number of data variables that were added
+		*/
+		size_t AddDataVariables(const std::vector<uint64_t>& addresses);
+
+		/*! Remove the data variables at several addresses from this component as one undo action
+
+		 	@threadsafe
+
+			\param addresses Addresses of the data variables to remove
+			\return Number of data variables that were removed
+		*/
+		size_t RemoveDataVariables(const std::vector<uint64_t>& addresses);
+
 		/*! Get a list of types referenced by the functions in this Component.
 
 		 	@threadsafe
@@ -17576,6 +20770,42 @@ namespace BinaryNinja {
 		std::vector<DataVariable> GetReferencedDataVariables();
 	};
 
+	/*! A reverse index from functions and data variables to the components that directly contain them.
+
+		BinaryView::GetFunctionParentComponents asks the core for every function, which adds up when a whole
+		function list is being grouped by component. The index walks the component tree once on first use and is
+		then kept current by component notifications. Functions are looked up by start address, like
+		CallGraphSnapshot. Adding or removing a component rebuilds the index on the next lookup.
+
+		\ingroup binaryview
+	*/
+	class ComponentMembershipIndex : public BinaryDataNotification
+	{
+		struct State;
+		Ref<BinaryView> m_view;
+		std::unique_ptr<State> m_state;
+
+		void Rebuild();
+		void Update(bool function, uint64_t key, Component* component, bool added);
+
+	  public:
+		ComponentMembershipIndex(BinaryView* view);
+		virtual ~ComponentMembershipIndex();
+
+		/*! The index shared by every caller for \c view, created on first use */
+		static std::shared_ptr<ComponentMembershipIndex> GetForView(BinaryView* view);
+
+		std::vector<Ref<Component>> GetComponentsForFunction(Function* func);
+		std::vector<Ref<Component>> GetComponentsForDataVariable(uint64_t addr);
+
+		void OnComponentAdded(BinaryView* data, Component* component) override;
+		void OnComponentRemoved(BinaryView* data, Component* formerParent, Component* component) override;
+		void OnComponentFunctionAdded(BinaryView* data, Component* component, Function* function) override;
+		void OnComponentFunctionRemoved(BinaryView* data, Component* component, Function* function) override;
+		void OnComponentDataVariableAdded(BinaryView* data, Component* component, const DataVariable& var) override;
+		void OnComponentDataVariableRemoved(BinaryView* data, Component* component, const DataVariable& var) override;
+	};
+
 	class TypeLibrary: public CoreRefCountObject<BNTypeLibrary, BNNewTypeLibraryReference, BNFreeTypeLibrary>
 	{
 	public:
@@ -17720,10 +20950,19 @@ namespace BinaryNinja {
 
 		/*! A list containing all named types provided by a type library
 
+			This creates every type in the library. Code that only needs a few of them should look them up
+			with GetNamedType, using GetNamedTypeNames to find what is available.
+
 			\return
 		*/
 		std::vector<QualifiedNameAndType> GetNamedTypes();
 
+		/*! The names of all named types provided by a type library, without their types
+
+			\return
+		*/
+		std::vector<QualifiedName> GetNamedTypeNames();
+
 		/*! Sets the name of a type library instance that has not been finalized
 
 			\param name
@@ -17894,6 +21133,20 @@ namespace BinaryNinja {
 		}
 	};
 
+	/*! Type ids that differ between two snapshots of a TypeArchive, see TypeArchive::DiffSnapshots
+
+	    \ingroup binaryview
+	 */
+	struct TypeArchiveSnapshotDiff
+	{
+		std::vector<std::string> added;
+		/*! Ids in both snapshots whose name or definition differs */
+		std::vector<std::string> changed;
+		std::vector<std::string> removed;
+
+		bool IsEmpty() const { return added.empty() && changed.empty() && removed.empty(); }
+	};
+
 	/*! Type Archives are a collection of types which can be shared between different analysis
 	    sessions and are backed by a database file on disk. Their types can be modified, and
 	    a history of previous versions of types is stored in snapshots in the archive.
@@ -18004,6 +21257,18 @@ namespace BinaryNinja {
 		 */
 		std::vector<std::string> GetSnapshotChildIds(const std::string& id) const;
 
+		/*! Find the types that were added, changed or removed going from one snapshot to another
+
+		    Snapshots can't be modified, so a caller that remembers the snapshot it last synced from can use
+		    this to process just the types that have changed since.
+
+		    \param from Earlier snapshot id, or an empty string to treat every type in \c to as added
+		    \param to Later snapshot id
+		    \throws ExceptionWithStackTrace if an exception occurs
+		    \return Sorted type ids in each category
+		 */
+		TypeArchiveSnapshotDiff DiffSnapshots(const std::string& from, const std::string& to) const;
+
 		/*! Get the TypeContainer interface for this Type Archive, presenting types
 		    at the current snapshot in the archive.
 
@@ -18463,6 +21728,69 @@ namespace BinaryNinja {
 		);
 	};
 
+	/*! Sorted snapshot of the type names in a Type Container, for searching as the user types.
+
+		Names are matched case-insensitively. The index doesn't follow changes to the container; call Refresh
+		to pick them up.
+
+		\ingroup types
+	*/
+	class TypeNameIndex
+	{
+	  public:
+		struct Match
+		{
+			std::string typeId;
+			QualifiedName name;
+		};
+
+	  private:
+		struct Entry
+		{
+			std::string key;  // Lowercased full name
+			std::string typeId;
+			QualifiedName name;
+		};
+
+		bool m_fuzzy;
+		std::vector<Entry> m_entries;  // Sorted by key
+		std::vector<std::pair<uint32_t, uint32_t>> m_trigrams;  // (trigram, entry index), sorted
+
+	  public:
+		/*!
+			\param container Type Container to index
+			\param fuzzy Whether to also build the trigram index used by FindFuzzy
+		*/
+		TypeNameIndex(const TypeContainer& container, bool fuzzy = false);
+
+		/*! Rebuild the index from the current contents of \c container
+
+			\return False if the names could not be read, leaving the index empty
+		*/
+		bool Refresh(const TypeContainer& container);
+
+		size_t GetCount() const { return m_entries.size(); }
+
+		/*! Types whose full name starts with \c prefix, in name order
+
+			\param prefix Start of the name to look for
+			\param maxResults Maximum number of matches to return
+			\return Up to \c maxResults matches
+		*/
+		std::vector<Match> FindByPrefix(const std::string& prefix, size_t maxResults = 50) const;
+
+		/*! Types whose full name shares the most three character sequences with \c query, best matches first
+
+			Queries shorter than three characters match names containing them. Returns nothing unless the index
+			was built with \c fuzzy set.
+
+			\param query Text to look for
+			\param maxResults Maximum number of matches to return
+			\return Up to \c maxResults matches
+		*/
+		std::vector<Match> FindFuzzy(const std::string& query, size_t maxResults = 50) const;
+	};
+
 	/*!
 	    \ingroup binaryview
 	*/
@@ -18481,6 +21809,74 @@ namespace BinaryNinja {
 		void Process();
 	};
 
+	/*! Interned full names of the symbols in a view, for pickers that search them as the user types.
+
+		Every distinct name is stored once and identified by the order it was first added in. Names are never
+		moved once added, so the views returned by GetName stay valid for the lifetime of the store. Names can be
+		read and searched while another thread is still adding them, so one store can be shared by everything
+		that lists the symbols of a view.
+
+		\ingroup binaryview
+	*/
+	class SymbolNameStore
+	{
+		static constexpr size_t BlockSize = 0x100000;
+
+		mutable std::mutex m_mutex;
+		std::vector<std::unique_ptr<char[]>> m_blocks;
+		char* m_blockNext = nullptr;
+		size_t m_blockRemaining = 0;
+		std::vector<std::string_view> m_names;
+		std::unordered_map<std::string_view, uint32_t> m_ids;
+		mutable std::vector<uint32_t> m_sorted;  // Ids in case-insensitive name order, caught up on search
+
+		uint32_t AddLocked(const std::string& name);
+		void UpdateSortedLocked() const;
+
+	  public:
+		SymbolNameStore() = default;
+		SymbolNameStore(const SymbolNameStore&) = delete;
+		SymbolNameStore& operator=(const SymbolNameStore&) = delete;
+
+		/*! Add a name if it isn't in the store yet
+
+			\param name Name to add
+			\return Id of the name
+		*/
+		uint32_t Add(const std::string& name);
+
+		/*! Add the full names of the symbols in \c view, a chunk at a time
+
+			\param view View to read symbols from
+			\param chunkReady Called after each chunk with the number of names now in the store; return false to
+			       stop adding
+			\param chunkSize Number of symbols per chunk
+			\param nameSpace Namespace of the symbols, or the default namespace
+			\return False if \c chunkReady stopped it
+		*/
+		bool AddSymbols(BinaryView* view, const std::function<bool(size_t count)>& chunkReady,
+			size_t chunkSize = 4096, const NameSpace& nameSpace = NameSpace());
+
+		size_t GetCount() const;
+		std::string_view GetName(uint32_t id) const;
+
+		/*! Names starting with \c prefix, ignoring case, in name order
+
+			\param prefix Start of the name to look for
+			\param maxResults Maximum number of matches to return
+			\return Ids of up to \c maxResults matches
+		*/
+		std::vector<uint32_t> FindByPrefix(const std::string& prefix, size_t maxResults = 50) const;
+
+		/*! Names containing \c text, ignoring case, in the order they were added
+
+			\param text Text to look for
+			\param maxResults Maximum number of matches to return
+			\return Ids of up to \c maxResults matches
+		*/
+		std::vector<uint32_t> FindContaining(const std::string& text, size_t maxResults = 50) const;
+	};
+
 	struct BaseAddressDetectionSettings
 	{
 		std::string Architecture;
@@ -18511,6 +21907,25 @@ namespace BinaryNinja {
 		 */
 		bool DetectBaseAddress(BaseAddressDetectionSettings& settings);
 
+		/*! Receives the current top candidates while detection is running; returning false aborts detection
+		*/
+		typedef std::function<bool(const std::set<std::pair<size_t, uint64_t>>& scores,
+		    BNBaseAddressDetectionConfidence confidence, uint64_t lastTestedBaseAddress)> ScoresCallback;
+
+		/*! Detect candidate base addresses, reporting the scores found so far every \c pollInterval
+
+			Detection runs on a separate thread while the calling thread polls the scores and passes them to
+			\c callback. Callers can stop as soon as one candidate is clearly ahead instead of waiting for the
+			whole search range, in which case the scores found so far remain available from GetScores.
+
+			\param settings Base address detection settings
+			\param callback Called with the current top candidates, returns false to abort
+			\param pollInterval Time between calls to \c callback
+			\return true on success, false otherwise (including when aborted)
+		 */
+		bool DetectBaseAddress(BaseAddressDetectionSettings& settings, const ScoresCallback& callback,
+		    std::chrono::milliseconds pollInterval = std::chrono::milliseconds(250));
+
 		/*! Get the top 10 candidate base addresses and thier scores
 
 			\param confidence Confidence level that indicates the likelihood the top base address candidate is correct
@@ -18632,6 +22047,15 @@ namespace BinaryNinja {
 		Ref<BinaryView> m_view;
 		BNFirmwareNinja* m_object;
 
+		// Core representation of the memory accesses last passed in, reused while callers keep passing the same
+		// accesses (such as when building a reference tree for every device)
+		struct MemoryAccessArray;
+		std::unique_ptr<MemoryAccessArray> m_accessArray;
+		std::mutex m_accessArrayMutex;
+
+		BNFirmwareNinjaFunctionMemoryAccesses** GetMemoryAccessArray(
+			const std::vector<FirmwareNinjaFunctionMemoryAccesses>& fma);
+
 	public:
 		FirmwareNinja(Ref<BinaryView> view);
 		~FirmwareNinja();
@@ -18790,6 +22214,33 @@ namespace BinaryNinja {
 		 */
 		static void Promote(Ref<Demangler> demangler);
 
+		/*! Outcome of demangling one name in a DemangleBatch call
+		 */
+		struct BatchResult
+		{
+			bool success = false;
+			Ref<Type> type;
+			QualifiedName name;
+		};
+
+		/*! Demangle many names with DemangleGeneric, spread across a pool of threads.
+
+			Results are kept in a process-wide LRU cache keyed by architecture, name and \c simplify, so
+			names that several binaries share, like runtime library symbols, are only demangled once. An
+			entry is reused whichever view it was first demangled for, so callers relying on view-specific
+			demangling should use DemangleGeneric instead.
+
+			\param arch Architecture the names belong to
+			\param names Raw mangled names
+			\param results Receives one result per name, in the same order
+			\param threads Maximum number of threads to use including the caller's, or 0 for one per core
+			\param view (Optional) BinaryView passed to DemangleGeneric for names not already cached
+			\param simplify Whether to simplify demangled names
+		 */
+		static void DemangleBatch(Ref<Architecture> arch, const std::vector<std::string>& names,
+			std::vector<BatchResult>& results, size_t threads = 0, Ref<BinaryView> view = nullptr,
+			bool simplify = false);
+
 		std::string GetName() const;
 
 		/*! Determine if a given name is mangled and this demangler can process it
@@ -18830,6 +22281,21 @@ namespace BinaryNinja {
 		 */
 		virtual bool Demangle(Ref<Architecture> arch, const std::string& name, Ref<Type>& outType,
 			QualifiedName& outVarName, Ref<BinaryView> view = nullptr) = 0;
+
+		/*! Demangle a raw name into only its QualifiedName.
+
+			For callers such as loaders that need the name now and the type later, if at all. The result
+			must match the name Demangle would produce. The default implementation calls Demangle and
+			discards the type; demanglers that can skip building the type should override it.
+
+			\param arch Architecture for context in which the name exists, eg for pointer sizes
+			\param name Raw mangled name
+			\param outVarName Resulting variable name
+			\param view (Optional) BinaryView context in which the name exists
+			\return True if demangling was successful and the name was stored into outVarName
+		 */
+		virtual bool DemangleName(Ref<Architecture> arch, const std::string& name, QualifiedName& outVarName,
+			Ref<BinaryView> view = nullptr);
 	};
 
 	/*!
@@ -18850,6 +22316,15 @@ namespace BinaryNinja {
 	{
 		std::string UTF16ToUTF8(const uint8_t* utf16, const size_t len);
 		std::string UTF32ToUTF8(const uint8_t* utf32);
+
+		/*! Read the text of many strings at once, converted to UTF-8. Strings that are close together in the view
+			are read with a single call, and the common encodings are converted without going through the core.
+
+			\param view View containing the strings
+			\param strings Strings to read, as returned by BinaryView::GetStrings
+			\return Text of each string, in the same order as \c strings
+		*/
+		std::vector<std::string> GetStringContents(BinaryView* view, const std::vector<BNStringReference>& strings);
 		bool GetBlockRange(const std::string& name, std::pair<uint32_t, uint32_t>& range);
 		std::vector<std::vector<std::pair<uint32_t, uint32_t>>> GetBlocksForNames(const std::vector<std::string>& names);
 		std::vector<std::string> GetBlockNames();
@@ -18899,13 +22374,16 @@ namespace BinaryNinja {
 		template <typename... Args>
 		void Append(Args&&... args)
 		{
-			InstructionTextToken token(std::forward<Args>(args)...);
-			BNInstructionTextToken converted;
-			InstructionTextToken::ConvertInstructionTextToken(token, &converted);
-			BNHighLevelILTokenEmitterAppend(m_object, &converted);
-			InstructionTextToken::FreeInstructionTextToken(&converted);
+			if constexpr (sizeof...(Args) == 1
+			    && (std::is_same_v<std::decay_t<Args>, InstructionTextToken> && ...))
+				AppendToken(args...);
+			else
+				AppendToken(InstructionTextToken(std::forward<Args>(args)...));
 		}
 
+		/*! Appends an existing token to the output without copying it first. */
+		void AppendToken(const InstructionTextToken& token);
+
 		void PrependCollapseIndicator();
 		void PrependCollapseIndicator(Ref<Function> function, const HighLevelILInstruction& instr, uint64_t designator = 0);
 		void PrependCollapseIndicator(BNInstructionTextTokenContext context, uint64_t hash);
@@ -19081,6 +22559,14 @@ namespace BinaryNinja {
 			BinaryView* data, Type* type, const HighLevelILInstruction& var, std::vector<std::string>& nameList);
 	};
 
+	/*! Lines of one Basic Block, as passed to RenderLayer::ApplyToBlocks
+	 */
+	struct RenderLayerBlockLines
+	{
+		Ref<BasicBlock> block;
+		std::vector<DisassemblyTextLine> lines;
+	};
+
 	/*! RenderLayer is a plugin class that allows you to customize the presentation of
 		Linear and Graph view output, adding, changing, or removing lines before they are
 		presented in the UI.
@@ -19090,6 +22576,11 @@ namespace BinaryNinja {
 		std::string m_nameForRegister;
 		static std::unordered_map<BNRenderLayer*, RenderLayer*> g_registeredInstances;
 
+		struct BlockCache;
+		std::shared_ptr<BlockCache> m_blockCache;
+
+		void ApplyToBlocksCached(std::vector<RenderLayerBlockLines>& blocks);
+
 	protected:
 		explicit RenderLayer(const std::string& name);
 		RenderLayer(BNRenderLayer* layer);
@@ -19276,6 +22767,33 @@ namespace BinaryNinja {
 			std::vector<DisassemblyTextLine>& lines
 		);
 
+		/*! Apply to the lines of many Basic Blocks at once. ApplyToFlowGraph passes every block
+			of the graph, and ApplyToLinearViewObject every block of the object, in one call. If not
+			overridden, this function calls ApplyToBlock for each block.
+
+			Override this to share per-function work (looking up analysis results, building maps)
+			across blocks instead of repeating it for each one.
+
+			\param blocks Blocks and their lines, to be modified by this function
+		 */
+		virtual void ApplyToBlocks(std::vector<RenderLayerBlockLines>& blocks);
+
+		/*! Cache the results of ApplyToBlocks, so blocks that are rendered again with the same
+			lines skip this layer. Each Basic Block object has one entry, which is replaced when the
+			block's input lines change. The core creates new Basic Blocks when a function is reanalyzed, so an entry never
+			outlives the analysis it was computed from.
+
+			Only enable this for layers whose output depends on nothing but the block, its function's
+			analysis and the lines.
+
+			\param maxBlocks Number of blocks to keep results for, or 0 to disable the cache (the default)
+		 */
+		void SetBlockCacheSize(size_t maxBlocks);
+
+		/*! Drop all results cached by SetBlockCacheSize, for example after a layer setting changed
+		 */
+		void ClearBlockCache();
+
 		/*! Apply this Render Layer to a Flow Graph, potentially modifying its nodes,
 			their edges, their lines, and their lines' content.
 
@@ -19933,6 +23451,18 @@ namespace BinaryNinja::Collaboration
 		 */
 		std::vector<uint8_t> Download(std::function<bool(size_t, size_t)> progress = {});
 
+		/*!
+		    Download the contents of a remote file to disk, skipping the transfer if the copy there is current
+		    The file is written under a temporary name and renamed into place, so an interrupted download never
+		    leaves a truncated file at \c path. A sidecar file next to \c path records the remote hash of the
+		    last completed download; if it and the size still match, nothing is transferred.
+		    \param path Path to write the file to
+		    \param progress Function to call on progress updates
+		    \return True if the file was downloaded, false if the copy at \c path was already current
+		    \throws SyncException If the download or writing the file fails
+		 */
+		bool DownloadToFile(const std::string& path, std::function<bool(size_t, size_t)> progress = {});
+
 		/*!
 		    Get the current user positions for this file
 		    \return User positions as json
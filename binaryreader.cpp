@@ -18,13 +18,49 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <cstring>
 #include "binaryninjaapi.h"
 
 using namespace BinaryNinja;
 using namespace std;
 
+// Size of the read-ahead window of a buffered reader
+static constexpr size_t BufferedReadWindowSize = 0x10000;
 
-BinaryReader::BinaryReader(BinaryView* data, BNEndianness endian) : m_view(data)
+
+template <typename T>
+static T DecodeValue(const uint8_t* data, BNEndianness endian)
+{
+	T result = 0;
+	for (size_t i = 0; i < sizeof(T); i++)
+		result |= (T)data[i] << ((endian == LittleEndian ? i : sizeof(T) - 1 - i) * 8);
+	return result;
+}
+
+
+struct BinaryReader::WindowInvalidator : public BinaryDataNotification
+{
+	Ref<BinaryView> view;
+	std::atomic<bool> stale = false;
+
+	WindowInvalidator(BinaryView* data) :
+	    BinaryDataNotification(DataWritten | DataInserted | DataRemoved | SegmentUpdates), view(data)
+	{
+		view->RegisterNotification(this);
+	}
+
+	~WindowInvalidator() { view->UnregisterNotification(this); }
+
+	void OnBinaryDataWritten(BinaryView*, uint64_t, size_t) override { stale = true; }
+	void OnBinaryDataInserted(BinaryView*, uint64_t, size_t) override { stale = true; }
+	void OnBinaryDataRemoved(BinaryView*, uint64_t, uint64_t) override { stale = true; }
+	void OnSegmentAdded(BinaryView*, Segment*) override { stale = true; }
+	void OnSegmentRemoved(BinaryView*, Segment*) override { stale = true; }
+	void OnSegmentUpdated(BinaryView*, Segment*) override { stale = true; }
+};
+
+
+BinaryReader::BinaryReader(BinaryView* data, BNEndianness endian) : m_view(data), m_endian(endian)
 {
 	m_stream = BNCreateBinaryReader(data->GetObject());
 	BNSetBinaryReaderEndianness(m_stream, endian);
@@ -39,19 +75,135 @@ BinaryReader::~BinaryReader()
 
 BNEndianness BinaryReader::GetEndianness() const
 {
-	return BNGetBinaryReaderEndianness(m_stream);
+	return m_endian;
 }
 
 
 void BinaryReader::SetEndianness(BNEndianness endian)
 {
+	m_endian = endian;
 	BNSetBinaryReaderEndianness(m_stream, endian);
 }
 
 
+bool BinaryReader::IsBuffered() const
+{
+	return m_buffered;
+}
+
+
+void BinaryReader::SetBuffered(bool buffered)
+{
+	if (m_buffered && !buffered)
+		BNSeekBinaryReader(m_stream, m_position);
+	else if (buffered && !m_buffered)
+		m_position = BNGetReaderPosition(m_stream);
+	m_buffered = buffered;
+	m_addressSize = m_view->GetAddressSize();
+	m_window.clear();
+	m_windowStart = 0;
+	m_windowLength = 0;
+	if (buffered)
+	{
+		m_window.resize(BufferedReadWindowSize);
+		if (!m_invalidator)
+			m_invalidator = make_shared<WindowInvalidator>(m_view);
+		m_invalidator->stale = false;
+	}
+	else
+	{
+		m_invalidator.reset();
+	}
+}
+
+
+bool BinaryReader::ReadFromWindow(void* dest, size_t len)
+{
+	// Positions are only known to be view addresses without a virtual base, so those readers always use the core
+	if (m_virtualBase != 0 || len > m_window.size())
+		return false;
+	if (m_invalidator->stale)
+	{
+		m_invalidator->stale = false;
+		m_windowLength = 0;
+	}
+	if (m_position < m_windowStart || m_position - m_windowStart > m_windowLength
+	    || len > m_windowLength - (m_position - m_windowStart))
+	{
+		m_windowStart = m_position;
+		m_windowLength = BNReadViewData(m_view->GetObject(), m_window.data(), m_position, m_window.size());
+		if (len > m_windowLength)
+			return false;
+	}
+	memcpy(dest, m_window.data() + (m_position - m_windowStart), len);
+	m_position += len;
+	return true;
+}
+
+
+bool BinaryReader::BufferedRead(void* dest, size_t len)
+{
+	if (ReadFromWindow(dest, len))
+		return true;
+
+	// Anything the window can't cover is left to the core so failures behave the same as unbuffered reads
+	BNSeekBinaryReader(m_stream, m_position);
+	bool result = BNReadData(m_stream, dest, len);
+	m_position = BNGetReaderPosition(m_stream);
+	return result;
+}
+
+
+template <typename T>
+bool BinaryReader::BufferedReadValue(T& result, BNEndianness endian)
+{
+	uint8_t data[sizeof(T)];
+	if (!BufferedRead(data, sizeof(T)))
+		return false;
+	result = DecodeValue<T>(data, endian);
+	return true;
+}
+
+
+bool BinaryReader::BufferedReadPointer(uint64_t& result, BNEndianness endian)
+{
+	switch (m_addressSize)
+	{
+		case 1:
+		{
+			uint8_t r;
+			if (!BufferedReadValue(r, endian))
+				return false;
+			result = r;
+			return true;
+		}
+		case 2:
+		{
+			uint16_t r;
+			if (!BufferedReadValue(r, endian))
+				return false;
+			result = r;
+			return true;
+		}
+		case 4:
+		{
+			uint32_t r;
+			if (!BufferedReadValue(r, endian))
+				return false;
+			result = r;
+			return true;
+		}
+		case 8:
+			return BufferedReadValue(result, endian);
+		default:
+			return false;
+	}
+}
+
+
 void BinaryReader::Read(void* dest, size_t len)
 {
-	if (!BNReadData(m_stream, dest, len))
+	if (!TryRead(dest, len))
 		throw ReadException();
 }
 
@@ -74,7 +226,7 @@ string BinaryReader::ReadString(size_t len)
 uint8_t BinaryReader::Read8()
 {
 	uint8_t result;
-	if (!BNRead8(m_stream, &result))
+	if (!TryRead8(result))
 		throw ReadException();
 	return result;
 }
@@ -83,7 +235,7 @@ uint8_t BinaryReader::Read8()
 uint16_t BinaryReader::Read16()
 {
 	uint16_t result;
-	if (!BNRead16(m_stream, &result))
+	if (!TryRead16(result))
 		throw ReadException();
 	return result;
 }
@@ -92,7 +244,7 @@ uint16_t BinaryReader::Read16()
 uint32_t BinaryReader::Read32()
 {
 	uint32_t result;
-	if (!BNRead32(m_stream, &result))
+	if (!TryRead32(result))
 		throw ReadException();
 	return result;
 }
@@ -101,7 +253,7 @@ uint32_t BinaryReader::Read32()
 uint64_t BinaryReader::Read64()
 {
 	uint64_t result;
-	if (!BNRead64(m_stream, &result))
+	if (!TryRead64(result))
 		throw ReadException();
 	return result;
 }
@@ -109,11 +261,11 @@ uint64_t BinaryReader::Read64()
 
 uint64_t BinaryReader::ReadPointer()
 {
-	size_t addressSize = m_view->GetAddressSize();
+	size_t addressSize = m_buffered ? m_addressSize : m_view->GetAddressSize();
 	if (addressSize > 8 || addressSize == 0)
 		throw ReadException();
 
-	if (GetEndianness() == BigEndian)
+	if (m_endian == BigEndian)
 		return ReadBEPointer();
 
 	return ReadLEPointer();
@@ -123,7 +275,7 @@ uint64_t BinaryReader::ReadPointer()
 uint16_t BinaryReader::ReadLE16()
 {
 	uint16_t result;
-	if (!BNReadLE16(m_stream, &result))
+	if (!TryReadLE16(result))
 		throw ReadException();
 	return result;
 }
@@ -132,7 +284,7 @@ uint16_t BinaryReader::ReadLE16()
 uint32_t BinaryReader::ReadLE32()
 {
 	uint32_t result;
-	if (!BNReadLE32(m_stream, &result))
+	if (!TryReadLE32(result))
 		throw ReadException();
 	return result;
 }
@@ -141,7 +293,7 @@ uint32_t BinaryReader::ReadLE32()
 uint64_t BinaryReader::ReadLE64()
 {
 	uint64_t result;
-	if (!BNReadLE64(m_stream, &result))
+	if (!TryReadLE64(result))
 		throw ReadException();
 	return result;
 }
@@ -149,45 +301,8 @@ uint64_t BinaryReader::ReadLE64()
 uint64_t BinaryReader::ReadLEPointer()
 {
 	uint64_t result;
-	size_t addressSize = m_view->GetAddressSize();
-	switch (addressSize)
-	{
-		case 1:
-		{
-			uint8_t r;
-			if (!BNRead8(m_stream, &r))
-				throw ReadException();
-			result = r;
-			break;
-		}
-		case 2:
-		{
-			uint16_t r;
-			if (!BNReadLE16(m_stream, &r))
-				throw ReadException();
-			result = r;
-			break;
-		}
-		case 4:
-		{
-			uint32_t r;
-			if (!BNReadLE32(m_stream, &r))
-				throw ReadException();
-			result = r;
-			break;
-		}
-		case 8:
-		{
-			if (!BNReadLE64(m_stream, &result))
-				throw ReadException();
-			break;
-		}
-		default:
-		{
-			throw ReadException();
-			break;
-		}
-	}
+	if (!TryReadLEPointer(result))
+		throw ReadException();
 	return result;
 }
 
@@ -195,7 +310,7 @@ uint64_t BinaryReader::ReadLEPointer()
 uint16_t BinaryReader::ReadBE16()
 {
 	uint16_t result;
-	if (!BNReadBE16(m_stream, &result))
+	if (!TryReadBE16(result))
 		throw ReadException();
 	return result;
 }
@@ -204,7 +319,7 @@ uint16_t BinaryReader::ReadBE16()
 uint32_t BinaryReader::ReadBE32()
 {
 	uint32_t result;
-	if (!BNReadBE32(m_stream, &result))
+	if (!TryReadBE32(result))
 		throw ReadException();
 	return result;
 }
@@ -213,7 +328,7 @@ uint32_t BinaryReader::ReadBE32()
 uint64_t BinaryReader::ReadBE64()
 {
 	uint64_t result;
-	if (!BNReadBE64(m_stream, &result))
+	if (!TryReadBE64(result))
 		throw ReadException();
 	return result;
 }
@@ -222,51 +337,16 @@ uint64_t BinaryReader::ReadBE64()
 uint64_t BinaryReader::ReadBEPointer()
 {
 	uint64_t result;
-	size_t addressSize = m_view->GetAddressSize();
-	switch (addressSize)
-	{
-		case 1:
-		{
-			uint8_t r;
-			if (!BNRead8(m_stream, &r))
-				throw ReadException();
-			result = r;
-			break;
-		}
-		case 2:
-		{
-			uint16_t r;
-			if (!BNReadBE16(m_stream, &r))
-				throw ReadException();
-			result = r;
-			break;
-		}
-		case 4:
-		{
-			uint32_t r;
-			if (!BNReadBE32(m_stream, &r))
-				throw ReadException();
-			result = r;
-			break;
-		}
-		case 8:
-		{
-			if (!BNReadBE64(m_stream, &result))
-				throw ReadException();
-			break;
-		}
-		default:
-		{
-			throw ReadException();
-			break;
-		}
-	}
+	if (!TryReadBEPointer(result))
+		throw ReadException();
 	return result;
 }
 
 
 bool BinaryReader::TryRead(void* dest, size_t len)
 {
+	if (m_buffered)
+		return BufferedRead(dest, len);
 	return BNReadData(m_stream, dest, len);
 }
 
@@ -290,54 +370,73 @@ bool BinaryReader::TryReadString(string& dest, size_t len)
 
 bool BinaryReader::TryRead8(uint8_t& result)
 {
+	if (m_buffered)
+		return BufferedReadValue(result, m_endian);
 	return BNRead8(m_stream, &result);
 }
 
 
 bool BinaryReader::TryRead16(uint16_t& result)
 {
+	if (m_buffered)
+		return BufferedReadValue(result, m_endian);
 	return BNRead16(m_stream, &result);
 }
 
 
 bool BinaryReader::TryRead32(uint32_t& result)
 {
+	if (m_buffered)
+		return BufferedReadValue(result, m_endian);
 	return BNRead32(m_stream, &result);
 }
 
 
 bool BinaryReader::TryRead64(uint64_t& result)
 {
+	if (m_buffered)
+		return BufferedReadValue(result, m_endian);
 	return BNRead64(m_stream, &result);
 }
 
 
 bool BinaryReader::TryReadPointer(uint64_t& result)
 {
+	if (m_buffered)
+		return BufferedReadPointer(result, m_endian);
 	return BNReadPointer(m_view->GetObject(), m_stream, &result);
 }
 
 
 bool BinaryReader::TryReadLE16(uint16_t& result)
 {
+	if (m_buffered)
+		return BufferedReadValue(result, LittleEndian);
 	return BNReadLE16(m_stream, &result);
 }
 
 
 bool BinaryReader::TryReadLE32(uint32_t& result)
 {
+	if (m_buffered)
+		return BufferedReadValue(result, LittleEndian);
 	return BNReadLE32(m_stream, &result);
 }
 
 
 bool BinaryReader::TryReadLE64(uint64_t& result)
 {
+	if (m_buffered)
+		return BufferedReadValue(result, LittleEndian);
 	return BNReadLE64(m_stream, &result);
 }
 
 
 bool BinaryReader::TryReadLEPointer(uint64_t& result)
 {
+	if (m_buffered)
+		return BufferedReadPointer(result, LittleEndian);
+
 	size_t addressSize = m_view->GetAddressSize();
 	switch (addressSize)
 	{
@@ -382,18 +481,24 @@ bool BinaryReader::TryReadLEPointer(uint64_t& result)
 
 bool BinaryReader::TryReadBE16(uint16_t& result)
 {
+	if (m_buffered)
+		return BufferedReadValue(result, BigEndian);
 	return BNReadBE16(m_stream, &result);
 }
 
 
 bool BinaryReader::TryReadBE32(uint32_t& result)
 {
+	if (m_buffered)
+		return BufferedReadValue(result, BigEndian);
 	return BNReadBE32(m_stream, &result);
 }
 
 
 bool BinaryReader::TryReadBE64(uint64_t& result)
 {
+	if (m_buffered)
+		return BufferedReadValue(result, BigEndian);
 	return BNReadBE64(m_stream, &result);
 }
 
@@ -401,6 +506,9 @@ bool BinaryReader::TryReadBE64(uint64_t& result)
 
 bool BinaryReader::TryReadBEPointer(uint64_t& result)
 {
+	if (m_buffered)
+		return BufferedReadPointer(result, BigEndian);
+
 	size_t addressSize = m_view->GetAddressSize();
 	switch (addressSize)
 	{
@@ -445,19 +553,27 @@ bool BinaryReader::TryReadBEPointer(uint64_t& result)
 
 uint64_t BinaryReader::GetOffset() const
 {
+	if (m_buffered)
+		return m_position;
 	return BNGetReaderPosition(m_stream);
 }
 
 
 void BinaryReader::Seek(uint64_t offset)
 {
-	BNSeekBinaryReader(m_stream, offset);
+	if (m_buffered)
+		m_position = offset;
+	else
+		BNSeekBinaryReader(m_stream, offset);
 }
 
 
 void BinaryReader::SeekRelative(int64_t offset)
 {
-	BNSeekBinaryReaderRelative(m_stream, offset);
+	if (m_buffered)
+		m_position += offset;
+	else
+		BNSeekBinaryReaderRelative(m_stream, offset);
 }
 
 
@@ -468,12 +584,25 @@ uint64_t BinaryReader::GetVirtualBase()
 
 void BinaryReader::SetVirtualBase(uint64_t base)
 {
-	BNSetBinaryReaderVirtualBase(m_stream, base);
+	if (m_buffered)
+	{
+		// The core may rebase the cursor, so let it and pick up the result
+		BNSeekBinaryReader(m_stream, m_position);
+		BNSetBinaryReaderVirtualBase(m_stream, base);
+		m_position = BNGetReaderPosition(m_stream);
+	}
+	else
+	{
+		BNSetBinaryReaderVirtualBase(m_stream, base);
+	}
+	m_virtualBase = base;
 }
 
 
 bool BinaryReader::IsEndOfFile() const
 {
+	if (m_buffered)
+		BNSeekBinaryReader(m_stream, m_position);
 	return BNIsEndOfFile(m_stream);
 }
 
@@ -19,9 +19,17 @@
 // IN THE SOFTWARE.
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <iterator>
 #include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <unordered_set>
 #include "binaryninjaapi.h"
+#include "ffi.h"
+#include "genericrange.h"
 
 using namespace BinaryNinja;
 using namespace std;
@@ -650,6 +658,399 @@ BinaryDataNotification::BinaryDataNotification(NotificationTypes notifications)
 }
 
 
+AnalysisUpdateRecorder::AnalysisUpdateRecorder(BinaryView* view) :
+    BinaryDataNotification(FunctionUpdated | FunctionUpdateRequested | DataWritten | DataVariableUpdates
+        | SymbolUpdates | TypeUpdates),
+    m_view(view)
+{
+	m_view->RegisterNotification(this);
+}
+
+
+AnalysisUpdateRecorder::~AnalysisUpdateRecorder()
+{
+	m_view->UnregisterNotification(this);
+}
+
+
+void AnalysisUpdateRecorder::NoteEdit(string description)
+{
+	unique_lock<mutex> lock(m_mutex);
+	m_lastEdit = std::move(description);
+}
+
+
+FunctionInvalidation& AnalysisUpdateRecorder::GetEntry(Function* func)
+{
+	auto [i, inserted] = m_functionIndex.try_emplace(func->GetObject(), m_functions.size());
+	if (inserted)
+		m_functions.push_back({func, m_lastEdit, 0, 0});
+	return m_functions[i->second];
+}
+
+
+vector<FunctionInvalidation> AnalysisUpdateRecorder::GetInvalidatedFunctions()
+{
+	unique_lock<mutex> lock(m_mutex);
+	vector<FunctionInvalidation> result;
+	for (auto& entry : m_functions)
+	{
+		if (entry.updateRequests != 0)
+			result.push_back(entry);
+	}
+	return result;
+}
+
+
+void AnalysisUpdateRecorder::Reset()
+{
+	unique_lock<mutex> lock(m_mutex);
+	m_lastEdit.clear();
+	m_functions.clear();
+	m_functionIndex.clear();
+}
+
+
+void AnalysisUpdateRecorder::OnBinaryDataWritten(BinaryView*, uint64_t offset, size_t len)
+{
+	NoteEdit(fmt::format("data written at {:#x} ({:#x} bytes)", offset, len));
+}
+
+
+void AnalysisUpdateRecorder::OnAnalysisFunctionUpdated(BinaryView*, Function* func)
+{
+	unique_lock<mutex> lock(m_mutex);
+	GetEntry(func).updates++;
+}
+
+
+void AnalysisUpdateRecorder::OnAnalysisFunctionUpdateRequested(BinaryView*, Function* func)
+{
+	unique_lock<mutex> lock(m_mutex);
+	GetEntry(func).updateRequests++;
+}
+
+
+void AnalysisUpdateRecorder::OnDataVariableAdded(BinaryView*, const DataVariable& var)
+{
+	NoteEdit(fmt::format("data variable added at {:#x}", var.address));
+}
+
+
+void AnalysisUpdateRecorder::OnDataVariableRemoved(BinaryView*, const DataVariable& var)
+{
+	NoteEdit(fmt::format("data variable removed at {:#x}", var.address));
+}
+
+
+void AnalysisUpdateRecorder::OnDataVariableUpdated(BinaryView*, const DataVariable& var)
+{
+	NoteEdit(fmt::format("data variable updated at {:#x}", var.address));
+}
+
+
+void AnalysisUpdateRecorder::OnSymbolAdded(BinaryView*, Symbol* sym)
+{
+	NoteEdit(fmt::format("symbol '{}' added at {:#x}", sym->GetFullName(), sym->GetAddress()));
+}
+
+
+void AnalysisUpdateRecorder::OnSymbolRemoved(BinaryView*, Symbol* sym)
+{
+	NoteEdit(fmt::format("symbol '{}' removed at {:#x}", sym->GetFullName(), sym->GetAddress()));
+}
+
+
+void AnalysisUpdateRecorder::OnSymbolUpdated(BinaryView*, Symbol* sym)
+{
+	NoteEdit(fmt::format("symbol '{}' updated at {:#x}", sym->GetFullName(), sym->GetAddress()));
+}
+
+
+void AnalysisUpdateRecorder::OnTypeDefined(BinaryView*, const QualifiedName& name, Type*)
+{
+	NoteEdit(fmt::format("type '{}' defined", name.GetString()));
+}
+
+
+void AnalysisUpdateRecorder::OnTypeUndefined(BinaryView*, const QualifiedName& name, Type*)
+{
+	NoteEdit(fmt::format("type '{}' undefined", name.GetString()));
+}
+
+
+void AnalysisUpdateRecorder::OnTypeReferenceChanged(BinaryView*, const QualifiedName& name, Type*)
+{
+	NoteEdit(fmt::format("reference to type '{}' changed", name.GetString()));
+}
+
+
+void AnalysisUpdateRecorder::OnTypeFieldReferenceChanged(BinaryView*, const QualifiedName& name, uint64_t offset)
+{
+	NoteEdit(fmt::format("reference to field {:#x} of type '{}' changed", offset, name.GetString()));
+}
+
+
+namespace
+{
+	// Net effect of the changes to each object since the last batch, in the order objects first changed
+	template <typename Key, typename Value>
+	class PendingChanges
+	{
+		enum class Change
+		{
+			Added,
+			Updated,
+			Removed
+		};
+
+		struct Entry
+		{
+			size_t order;
+			Change change;
+			Value value;
+		};
+
+		unordered_map<Key, Entry> m_entries;
+		size_t m_nextOrder = 0;
+
+	  public:
+		bool Empty() const { return m_entries.empty(); }
+
+		void Add(const Key& key, Value value)
+		{
+			auto i = m_entries.find(key);
+			if (i == m_entries.end())
+			{
+				m_entries.emplace(key, Entry {m_nextOrder++, Change::Added, std::move(value)});
+				return;
+			}
+			if (i->second.change == Change::Removed)
+				i->second.change = Change::Updated;
+			i->second.value = std::move(value);
+		}
+
+		void Update(const Key& key, Value value)
+		{
+			auto i = m_entries.find(key);
+			if (i == m_entries.end())
+				m_entries.emplace(key, Entry {m_nextOrder++, Change::Updated, std::move(value)});
+			else if (i->second.change != Change::Removed)
+				i->second.value = std::move(value);
+		}
+
+		void Remove(const Key& key, Value value)
+		{
+			auto i = m_entries.find(key);
+			if (i == m_entries.end())
+			{
+				m_entries.emplace(key, Entry {m_nextOrder++, Change::Removed, std::move(value)});
+				return;
+			}
+			if (i->second.change == Change::Added)
+			{
+				m_entries.erase(i);
+				return;
+			}
+			i->second.change = Change::Removed;
+			i->second.value = std::move(value);
+		}
+
+		void Take(vector<Value>& added, vector<Value>& updated, vector<Value>& removed)
+		{
+			vector<Entry*> ordered;
+			ordered.reserve(m_entries.size());
+			for (auto& [key, entry] : m_entries)
+				ordered.push_back(&entry);
+			sort(ordered.begin(), ordered.end(), [](Entry* a, Entry* b) { return a->order < b->order; });
+			for (Entry* entry : ordered)
+			{
+				switch (entry->change)
+				{
+				case Change::Added:
+					added.push_back(std::move(entry->value));
+					break;
+				case Change::Updated:
+					updated.push_back(std::move(entry->value));
+					break;
+				case Change::Removed:
+					removed.push_back(std::move(entry->value));
+					break;
+				}
+			}
+			m_entries.clear();
+		}
+	};
+}
+
+
+struct BatchedBinaryDataNotification::State
+{
+	struct ViewChanges
+	{
+		PendingChanges<BNFunction*, Ref<Function>> functions;
+		PendingChanges<uint64_t, DataVariable> dataVariables;
+		PendingChanges<BNSymbol*, Ref<Symbol>> symbols;
+	};
+
+	mutex changesMutex;
+	unordered_map<BNBinaryView*, ViewChanges> views;
+	uint32_t interval;
+
+	ViewChanges& GetChanges(BinaryView* view) { return views[view->GetObject()]; }
+};
+
+
+BatchedBinaryDataNotification::BatchedBinaryDataNotification(
+    NotificationTypes batched, NotificationTypes immediate, uint32_t intervalMs) :
+    BinaryDataNotification(batched | immediate | NotificationBarrier),
+    m_state(make_unique<State>()), m_batched(batched)
+{
+	m_state->interval = intervalMs;
+}
+
+
+BatchedBinaryDataNotification::~BatchedBinaryDataNotification() {}
+
+
+void BatchedBinaryDataNotification::Flush(BinaryView* view)
+{
+	State::ViewChanges changes;
+	{
+		unique_lock<mutex> lock(m_state->changesMutex);
+		auto i = m_state->views.find(view->GetObject());
+		if (i == m_state->views.end())
+			return;
+		changes = std::move(i->second);
+		m_state->views.erase(i);
+	}
+
+	vector<Ref<Function>> functionsAdded, functionsUpdated, functionsRemoved;
+	vector<DataVariable> varsAdded, varsUpdated, varsRemoved;
+	vector<Ref<Symbol>> symbolsAdded, symbolsUpdated, symbolsRemoved;
+	changes.functions.Take(functionsAdded, functionsUpdated, functionsRemoved);
+	changes.dataVariables.Take(varsAdded, varsUpdated, varsRemoved);
+	changes.symbols.Take(symbolsAdded, symbolsUpdated, symbolsRemoved);
+
+	if (!functionsAdded.empty())
+		OnAnalysisFunctionsAdded(view, functionsAdded);
+	if (!varsAdded.empty())
+		OnDataVariablesAdded(view, varsAdded);
+	if (!symbolsAdded.empty())
+		OnSymbolsAdded(view, symbolsAdded);
+	if (!functionsUpdated.empty())
+		OnAnalysisFunctionsUpdated(view, functionsUpdated);
+	if (!varsUpdated.empty())
+		OnDataVariablesUpdated(view, varsUpdated);
+	if (!symbolsUpdated.empty())
+		OnSymbolsUpdated(view, symbolsUpdated);
+	if (!symbolsRemoved.empty())
+		OnSymbolsRemoved(view, symbolsRemoved);
+	if (!varsRemoved.empty())
+		OnDataVariablesRemoved(view, varsRemoved);
+	if (!functionsRemoved.empty())
+		OnAnalysisFunctionsRemoved(view, functionsRemoved);
+}
+
+
+uint64_t BatchedBinaryDataNotification::OnNotificationBarrier(BinaryView* view)
+{
+	bool pending;
+	{
+		unique_lock<mutex> lock(m_state->changesMutex);
+		pending = m_state->views.count(view->GetObject()) != 0;
+	}
+	if (!pending)
+	{
+		// Quiesce; the next change of interest schedules a new barrier
+		return 0;
+	}
+	Flush(view);
+	return m_state->interval;
+}
+
+
+void BatchedBinaryDataNotification::OnAnalysisFunctionAdded(BinaryView* view, Function* func)
+{
+	if (!(m_batched & FunctionAdded))
+		return;
+	unique_lock<mutex> lock(m_state->changesMutex);
+	m_state->GetChanges(view).functions.Add(func->GetObject(), func);
+}
+
+
+void BatchedBinaryDataNotification::OnAnalysisFunctionRemoved(BinaryView* view, Function* func)
+{
+	if (!(m_batched & FunctionRemoved))
+		return;
+	unique_lock<mutex> lock(m_state->changesMutex);
+	m_state->GetChanges(view).functions.Remove(func->GetObject(), func);
+}
+
+
+void BatchedBinaryDataNotification::OnAnalysisFunctionUpdated(BinaryView* view, Function* func)
+{
+	if (!(m_batched & FunctionUpdated))
+		return;
+	unique_lock<mutex> lock(m_state->changesMutex);
+	m_state->GetChanges(view).functions.Update(func->GetObject(), func);
+}
+
+
+void BatchedBinaryDataNotification::OnDataVariableAdded(BinaryView* view, const DataVariable& var)
+{
+	if (!(m_batched & DataVariableAdded))
+		return;
+	unique_lock<mutex> lock(m_state->changesMutex);
+	m_state->GetChanges(view).dataVariables.Add(var.address, var);
+}
+
+
+void BatchedBinaryDataNotification::OnDataVariableRemoved(BinaryView* view, const DataVariable& var)
+{
+	if (!(m_batched & DataVariableRemoved))
+		return;
+	unique_lock<mutex> lock(m_state->changesMutex);
+	m_state->GetChanges(view).dataVariables.Remove(var.address, var);
+}
+
+
+void BatchedBinaryDataNotification::OnDataVariableUpdated(BinaryView* view, const DataVariable& var)
+{
+	if (!(m_batched & DataVariableUpdated))
+		return;
+	unique_lock<mutex> lock(m_state->changesMutex);
+	m_state->GetChanges(view).dataVariables.Update(var.address, var);
+}
+
+
+void BatchedBinaryDataNotification::OnSymbolAdded(BinaryView* view, Symbol* sym)
+{
+	if (!(m_batched & SymbolAdded))
+		return;
+	unique_lock<mutex> lock(m_state->changesMutex);
+	m_state->GetChanges(view).symbols.Add(sym->GetObject(), sym);
+}
+
+
+void BatchedBinaryDataNotification::OnSymbolRemoved(BinaryView* view, Symbol* sym)
+{
+	if (!(m_batched & SymbolRemoved))
+		return;
+	unique_lock<mutex> lock(m_state->changesMutex);
+	m_state->GetChanges(view).symbols.Remove(sym->GetObject(), sym);
+}
+
+
+void BatchedBinaryDataNotification::OnSymbolUpdated(BinaryView* view, Symbol* sym)
+{
+	if (!(m_batched & SymbolUpdated))
+		return;
+	unique_lock<mutex> lock(m_state->changesMutex);
+	m_state->GetChanges(view).symbols.Update(sym->GetObject(), sym);
+}
+
+
 Symbol::Symbol(BNSymbolType type, const string& shortName, const string& fullName, const string& rawName, uint64_t addr,
     BNSymbolBinding binding, const NameSpace& nameSpace, uint64_t ordinal)
 {
@@ -1545,6 +1946,84 @@ bool BinaryView::SaveAutoSnapshot(
 }
 
 
+namespace
+{
+	// Files with an asynchronous save running; a second one would only race the first for the database
+	std::mutex g_asyncSaveMutex;
+	std::set<BNFileMetadata*> g_asyncSaves;
+
+
+	Ref<BackgroundTask> StartAsyncSave(Ref<FileMetadata> file, const string& description,
+	    function<bool(const function<bool(size_t, size_t)>&)> save, const function<void(bool)>& completion)
+	{
+		{
+			unique_lock<mutex> lock(g_asyncSaveMutex);
+			if (!g_asyncSaves.insert(file->GetObject()).second)
+				return nullptr;
+		}
+
+		Ref<BackgroundTask> task = new BackgroundTask(description + "...", true);
+		// A separate thread rather than a worker: saves can take long enough to starve analysis
+		thread([file, description, save, completion, task]() {
+			bool success = false;
+			try
+			{
+				success = save([&](size_t progress, size_t total) {
+					if (total)
+						task->SetProgressText(fmt::format("{}... {}%", description, progress * 100 / total));
+					return !task->IsCancelled();
+				});
+			}
+			catch (exception& e)
+			{
+				LogError("%s failed: %s", description.c_str(), e.what());
+			}
+			task->Finish();
+			{
+				unique_lock<mutex> lock(g_asyncSaveMutex);
+				g_asyncSaves.erase(file->GetObject());
+			}
+			if (completion)
+				completion(success);
+		}).detach();
+		return task;
+	}
+}  // namespace
+
+
+Ref<BackgroundTask> BinaryView::CreateDatabaseAsync(
+    const string& path, const function<void(bool success)>& completion, Ref<SaveSettings> settings)
+{
+	Ref<BinaryView> view = this;
+	if (auto parent = GetParentView())
+		view = parent;
+	return StartAsyncSave(view->GetFile(), "Saving database",
+	    [view, path, settings](const function<bool(size_t, size_t)>& progress) {
+		    return view->GetFile()->CreateDatabase(path, view, progress, settings);
+	    },
+	    completion);
+}
+
+
+Ref<BackgroundTask> BinaryView::SaveAutoSnapshotAsync(
+    const function<void(bool success)>& completion, Ref<SaveSettings> settings)
+{
+	Ref<BinaryView> view = this;
+	return StartAsyncSave(m_file, "Saving snapshot",
+	    [view, settings](const function<bool(size_t, size_t)>& progress) {
+		    return view->SaveAutoSnapshot(progress, settings);
+	    },
+	    completion);
+}
+
+
+bool BinaryView::IsAsyncSaveInProgress() const
+{
+	unique_lock<mutex> lock(g_asyncSaveMutex);
+	return g_asyncSaves.count(m_file->GetObject()) != 0;
+}
+
+
 bool BinaryView::RunUndoableTransaction(std::function<bool()> func)
 {
 	return m_file->RunUndoableTransaction(func);
@@ -1624,6 +2103,12 @@ DataBuffer BinaryView::ReadBuffer(uint64_t offset, size_t len)
 }
 
 
+ViewBuffer BinaryView::MapBuffer(uint64_t offset, size_t len)
+{
+	return ViewBuffer(ReadBuffer(offset, len));
+}
+
+
 size_t BinaryView::WriteBuffer(uint64_t offset, const DataBuffer& data)
 {
 	return BNWriteViewBuffer(m_object, offset, data.GetBufferObject());
@@ -1640,16 +2125,11 @@ vector<float> BinaryView::GetEntropy(uint64_t offset, size_t len, size_t blockSi
 {
 	if (!blockSize)
 		blockSize = len;
+	if (!blockSize)
+		return {};
 
-	float* entopy = new float[(len / blockSize) + 1];
-	len = BNGetEntropy(m_object, offset, len, blockSize, entopy);
-
-	vector<float> result;
-	result.reserve(len);
-	for (size_t i = 0; i < len; i++)
-		result.push_back(entopy[i]);
-
-	delete[] entopy;
+	vector<float> result((len / blockSize) + 1);
+	result.resize(BNGetEntropy(m_object, offset, len, blockSize, result.data()));
 	return result;
 }
 
@@ -2058,6 +2538,144 @@ void BinaryView::AbortAnalysis()
 }
 
 
+static void GenerateILForPrefetch(Function* func, BNFunctionGraphType level)
+{
+	switch (level)
+	{
+	case LowLevelILFunctionGraph:
+		func->GetLowLevelIL();
+		break;
+	case LiftedILFunctionGraph:
+		func->GetLiftedIL();
+		break;
+	case LowLevelILSSAFormFunctionGraph:
+		if (Ref<LowLevelILFunction> il = func->GetLowLevelIL())
+			il->GetSSAForm();
+		break;
+	case MediumLevelILFunctionGraph:
+		func->GetMediumLevelIL();
+		break;
+	case MediumLevelILSSAFormFunctionGraph:
+		if (Ref<MediumLevelILFunction> il = func->GetMediumLevelIL())
+			il->GetSSAForm();
+		break;
+	case MappedMediumLevelILFunctionGraph:
+		func->GetMappedMediumLevelIL();
+		break;
+	case MappedMediumLevelILSSAFormFunctionGraph:
+		if (Ref<MediumLevelILFunction> il = func->GetMappedMediumLevelIL())
+			il->GetSSAForm();
+		break;
+	case HighLevelILFunctionGraph:
+	case HighLevelLanguageRepresentationFunctionGraph:
+		func->GetHighLevelIL();
+		break;
+	case HighLevelILSSAFormFunctionGraph:
+		if (Ref<HighLevelILFunction> il = func->GetHighLevelIL())
+			il->GetSSAForm();
+		break;
+	default:
+		break;
+	}
+}
+
+
+void BinaryView::PrefetchIL(const vector<Ref<Function>>& functions, BNFunctionGraphType level, size_t threads,
+    const function<void(Function*)>& onReady, const function<void()>& onComplete)
+{
+	struct PrefetchState
+	{
+		vector<Ref<Function>> functions;
+		BNFunctionGraphType level;
+		function<void(Function*)> onReady;
+		function<void()> onComplete;
+		atomic<size_t> next {0};
+		atomic<size_t> activeJobs {0};
+	};
+
+	if (functions.empty())
+	{
+		if (onComplete)
+			onComplete();
+		return;
+	}
+
+	if (threads == 0)
+		threads = max<size_t>(GetWorkerThreadCount() / 2, 1);
+	threads = min(threads, functions.size());
+
+	auto state = make_shared<PrefetchState>();
+	state->functions = functions;
+	state->level = level;
+	state->onReady = onReady;
+	state->onComplete = onComplete;
+	state->activeJobs = threads;
+
+	// Jobs pull functions from a shared cursor rather than owning a fixed slice, so one slow function
+	// doesn't leave the other jobs idle
+	for (size_t i = 0; i < threads; i++)
+	{
+		WorkerEnqueue([state]() {
+			for (size_t index = state->next++; index < state->functions.size(); index = state->next++)
+			{
+				Function* func = state->functions[index];
+				GenerateILForPrefetch(func, state->level);
+				if (state->onReady)
+					state->onReady(func);
+			}
+			if (--state->activeJobs == 0 && state->onComplete)
+				state->onComplete();
+		}, "PrefetchIL");
+	}
+}
+
+
+void BinaryView::PrioritizeAnalysis(const vector<pair<Ref<Function>, int>>& functions, bool includeCallees,
+    BNFunctionGraphType level, size_t threads, const function<void(size_t, size_t)>& progress,
+    const function<void()>& onComplete)
+{
+	vector<pair<Ref<Function>, int>> sorted = functions;
+	stable_sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+
+	vector<Ref<Function>> order;
+	unordered_set<BNFunction*> queued;
+	auto enqueue = [&](Function* func) {
+		if (queued.insert(func->GetObject()).second)
+			order.push_back(func);
+	};
+	for (auto& [func, priority] : sorted)
+	{
+		if (!func)
+			continue;
+		if (includeCallees)
+		{
+			Ref<Platform> platform = func->GetPlatform();
+			for (auto& site : func->GetCallSites())
+			{
+				for (uint64_t target : GetCallees(site))
+				{
+					if (Ref<Function> callee = GetAnalysisFunction(platform, target))
+						enqueue(callee);
+				}
+			}
+		}
+		enqueue(func);
+	}
+
+	UpdateAnalysis();
+
+	size_t total = order.size();
+	auto done = make_shared<atomic<size_t>>(0);
+	PrefetchIL(order, level, threads,
+	    [done, total, progress](Function*) {
+		    size_t count = ++*done;
+		    if (progress)
+			    progress(count, total);
+	    },
+	    onComplete);
+}
+
+
 void BinaryView::DefineDataVariable(uint64_t addr, const Confidence<Ref<Type>>& type)
 {
 	BNTypeWithConfidence tc;
@@ -2107,6 +2725,29 @@ map<uint64_t, DataVariable> BinaryView::GetDataVariables()
 }
 
 
+bool BinaryView::IterateDataVariables(
+	uint64_t start, uint64_t end, const function<bool(const DataVariable&)>& callback)
+{
+	for (uint64_t addr = start; addr < end;)
+	{
+		BNDataVariable var;
+		if (BNGetDataVariableAtAddress(m_object, addr, &var))
+		{
+			// Owns the reference returned by the core, even for a variable that only covers this address
+			Confidence<Ref<Type>> type(new Type(var.type), var.typeConfidence);
+			if (var.address == addr && !callback(DataVariable(var.address, type, var.autoDiscovered)))
+				return false;
+		}
+
+		uint64_t next = BNGetNextDataVariableStartAfterAddress(m_object, addr);
+		if (next <= addr)
+			break;
+		addr = next;
+	}
+	return true;
+}
+
+
 bool BinaryView::GetDataVariableAtAddress(uint64_t addr, DataVariable& var)
 {
 	var.address = 0;
@@ -2140,14 +2781,59 @@ vector<Ref<Function>> BinaryView::GetAnalysisFunctionList()
 }
 
 
-AnalysisInfo BinaryView::GetAnalysisInfo()
+BorrowedList<Function> BinaryView::BorrowAnalysisFunctionList()
 {
-	AnalysisInfo result;
-	BNAnalysisInfo* info = BNGetAnalysisInfo(m_object);
-	result.state = info->state;
-	result.analysisTime = info->analysisTime;
-	result.activeInfo.reserve(info->count);
-	for (size_t i = 0; i < info->count; i++)
+	size_t count;
+	BNFunction** list = BNGetAnalysisFunctionList(m_object, &count);
+	return BorrowedList<Function>(list, count, BNFreeFunctionList);
+}
+
+
+ILResidency BinaryView::GetILResidency()
+{
+	ILResidency result {};
+	BorrowedList<Function> functions = BorrowAnalysisFunctionList();
+	result.functions = functions.size();
+	for (size_t i = 0; i < functions.size(); i++)
+	{
+		BNFunction* func = functions.GetObject(i);
+		if (BNLowLevelILFunction* il = BNGetFunctionLiftedILIfAvailable(func))
+		{
+			result.liftedIL++;
+			result.liftedILInstructions += BNGetLowLevelILInstructionCount(il);
+			BNFreeLowLevelILFunction(il);
+		}
+		if (BNLowLevelILFunction* il = BNGetFunctionLowLevelILIfAvailable(func))
+		{
+			result.lowLevelIL++;
+			result.lowLevelILInstructions += BNGetLowLevelILInstructionCount(il);
+			BNFreeLowLevelILFunction(il);
+		}
+		if (BNMediumLevelILFunction* il = BNGetFunctionMediumLevelILIfAvailable(func))
+		{
+			result.mediumLevelIL++;
+			result.mediumLevelILInstructions += BNGetMediumLevelILInstructionCount(il);
+			BNFreeMediumLevelILFunction(il);
+		}
+		if (BNHighLevelILFunction* il = BNGetFunctionHighLevelILIfAvailable(func))
+		{
+			result.highLevelIL++;
+			result.highLevelILInstructions += BNGetHighLevelILInstructionCount(il);
+			BNFreeHighLevelILFunction(il);
+		}
+	}
+	return result;
+}
+
+
+AnalysisInfo BinaryView::GetAnalysisInfo()
+{
+	AnalysisInfo result;
+	BNAnalysisInfo* info = BNGetAnalysisInfo(m_object);
+	result.state = info->state;
+	result.analysisTime = info->analysisTime;
+	result.activeInfo.reserve(info->count);
+	for (size_t i = 0; i < info->count; i++)
 		result.activeInfo.emplace_back(new Function(BNNewFunctionReference(info->activeInfo[i].func)),
 		    info->activeInfo[i].analysisTime, info->activeInfo[i].submitCount, info->activeInfo[i].updateCount);
 	BNFreeAnalysisInfo(info);
@@ -2326,6 +3012,116 @@ vector<ReferenceSource> BinaryView::GetCodeReferences(uint64_t addr, uint64_t le
 }
 
 
+ReferenceTable<ReferenceSource> BinaryView::GetCodeReferencesForAddresses(const vector<uint64_t>& addrs)
+{
+	ReferenceTable<ReferenceSource> result;
+	result.offsets.reserve(addrs.size() + 1);
+	result.offsets.push_back(0);
+
+	// References from the same function are common, so wrap each function and architecture only once
+	unordered_map<BNFunction*, Ref<Function>> functions;
+	unordered_map<BNArchitecture*, Ref<Architecture>> architectures;
+	for (uint64_t addr : addrs)
+	{
+		size_t count;
+		BNReferenceSource* refs = BNGetCodeReferences(m_object, addr, &count);
+		for (size_t i = 0; i < count; i++)
+		{
+			Ref<Function>& func = functions[refs[i].func];
+			if (!func)
+				func = new Function(BNNewFunctionReference(refs[i].func));
+			Ref<Architecture>& arch = architectures[refs[i].arch];
+			if (!arch)
+				arch = new CoreArchitecture(refs[i].arch);
+			result.sources.push_back({func, arch, refs[i].addr});
+		}
+		BNFreeCodeReferences(refs, count);
+		result.offsets.push_back(result.sources.size());
+	}
+	return result;
+}
+
+
+CodeReferenceCursor BinaryView::GetCodeReferencesCursor(uint64_t addr)
+{
+	return CodeReferenceCursor(this, addr);
+}
+
+
+CodeReferenceCursor BinaryView::GetCodeReferencesCursor(uint64_t addr, uint64_t len)
+{
+	return CodeReferenceCursor(this, addr, len);
+}
+
+
+CodeReferenceCursor::CodeReferenceCursor(BinaryView* view, uint64_t addr)
+{
+	m_refs = BNGetCodeReferences(view->GetObject(), addr, &m_count);
+}
+
+
+CodeReferenceCursor::CodeReferenceCursor(BinaryView* view, uint64_t addr, uint64_t len)
+{
+	m_refs = BNGetCodeReferencesInRange(view->GetObject(), addr, len, &m_count);
+}
+
+
+CodeReferenceCursor::CodeReferenceCursor(CodeReferenceCursor&& other) :
+    m_refs(other.m_refs), m_count(other.m_count), m_position(other.m_position),
+    m_functions(std::move(other.m_functions)), m_architectures(std::move(other.m_architectures))
+{
+	other.m_refs = nullptr;
+	other.m_count = 0;
+	other.m_position = 0;
+}
+
+
+CodeReferenceCursor& CodeReferenceCursor::operator=(CodeReferenceCursor&& other)
+{
+	if (this != &other)
+	{
+		if (m_refs)
+			BNFreeCodeReferences(m_refs, m_count);
+		m_refs = other.m_refs;
+		m_count = other.m_count;
+		m_position = other.m_position;
+		m_functions = std::move(other.m_functions);
+		m_architectures = std::move(other.m_architectures);
+		other.m_refs = nullptr;
+		other.m_count = 0;
+		other.m_position = 0;
+	}
+	return *this;
+}
+
+
+CodeReferenceCursor::~CodeReferenceCursor()
+{
+	if (m_refs)
+		BNFreeCodeReferences(m_refs, m_count);
+}
+
+
+vector<ReferenceSource> CodeReferenceCursor::Next(size_t pageSize)
+{
+	size_t end = m_position + min(pageSize, m_count - m_position);
+	vector<ReferenceSource> result;
+	result.reserve(end - m_position);
+	for (; m_position < end; m_position++)
+	{
+		const BNReferenceSource& ref = m_refs[m_position];
+		Ref<Function>& func = m_functions[ref.func];
+		if (!func)
+			func = new Function(BNNewFunctionReference(ref.func));
+		Ref<Architecture>& arch = m_architectures[ref.arch];
+		if (!arch)
+			arch = new CoreArchitecture(ref.arch);
+		result.push_back({func, arch, ref.addr});
+	}
+	return result;
+}
+
+
 vector<uint64_t> BinaryView::GetCodeReferencesFrom(ReferenceSource src)
 {
 	size_t count;
@@ -2358,6 +3154,23 @@ vector<uint64_t> BinaryView::GetDataReferences(uint64_t addr)
 }
 
 
+ReferenceTable<uint64_t> BinaryView::GetDataReferencesForAddresses(const vector<uint64_t>& addrs)
+{
+	ReferenceTable<uint64_t> result;
+	result.offsets.reserve(addrs.size() + 1);
+	result.offsets.push_back(0);
+	for (uint64_t addr : addrs)
+	{
+		size_t count;
+		uint64_t* refs = BNGetDataReferences(m_object, addr, &count);
+		result.sources.insert(result.sources.end(), refs, refs + count);
+		BNFreeDataReferences(refs);
+		result.offsets.push_back(result.sources.size());
+	}
+	return result;
+}
+
+
 vector<uint64_t> BinaryView::GetDataReferences(uint64_t addr, uint64_t len)
 {
 	size_t count;
@@ -2831,6 +3644,12 @@ vector<uint64_t> BinaryView::GetCallees(ReferenceSource callSite)
 }
 
 
+shared_ptr<const CallGraphSnapshot> BinaryView::GetCallGraph()
+{
+	return ViewCallGraph::GetForView(this)->GetSnapshot();
+}
+
+
 vector<ReferenceSource> BinaryView::GetCallers(uint64_t addr)
 {
 	size_t count;
@@ -2874,6 +3693,16 @@ Ref<Symbol> BinaryView::GetSymbolByRawName(const string& name, const NameSpace&
 }
 
 
+BorrowedList<Symbol> BinaryView::BorrowSymbolsByName(const string& name, const NameSpace& nameSpace)
+{
+	size_t count;
+	BNNameSpace ns = nameSpace.GetAPIObject();
+	BNSymbol** syms = BNGetSymbolsByName(m_object, name.c_str(), &count, &ns);
+	NameSpace::FreeAPIObject(&ns);
+	return BorrowedList<Symbol>(syms, count, BNFreeSymbolList);
+}
+
+
 vector<Ref<Symbol>> BinaryView::GetSymbolsByName(const string& name, const NameSpace& nameSpace)
 {
 	size_t count;
@@ -2942,6 +3771,39 @@ vector<Ref<Symbol>> BinaryView::GetSymbols(uint64_t start, uint64_t len, const N
 }
 
 
+bool BinaryView::IterateSymbols(uint64_t start, uint64_t end, const function<bool(Symbol*)>& callback,
+	const NameSpace& nameSpace, uint64_t windowSize)
+{
+	if (windowSize == 0)
+		windowSize = 0x100000;
+
+	BNNameSpace ns = nameSpace.GetAPIObject();
+	bool completed = true;
+	for (uint64_t windowStart = start; completed && windowStart < end;)
+	{
+		uint64_t len = min(windowSize, end - windowStart);
+		size_t count;
+		BNSymbol** syms = BNGetSymbolsInRange(m_object, windowStart, len, &count, &ns);
+		for (size_t i = 0; i < count; i++)
+		{
+			Ref<Symbol> sym = new Symbol(BNNewSymbolReference(syms[i]));
+			if (!callback(sym))
+			{
+				completed = false;
+				break;
+			}
+		}
+		BNFreeSymbolList(syms, count);
+
+		if (len == end - windowStart)
+			break;
+		windowStart += len;
+	}
+	NameSpace::FreeAPIObject(&ns);
+	return completed;
+}
+
+
 vector<Ref<Symbol>> BinaryView::GetSymbolsOfType(BNSymbolType type, const NameSpace& nameSpace)
 {
 	size_t count;
@@ -3000,6 +3862,25 @@ void BinaryView::DefineAutoSymbol(Ref<Symbol> sym)
 }
 
 
+void BinaryView::DefineAutoSymbols(const vector<SymbolSpec>& symbols, const NameSpace& nameSpace)
+{
+	if (symbols.empty())
+		return;
+
+	BNNameSpace ns = nameSpace.GetAPIObject();
+	BNBeginBulkModifySymbols(m_object);
+	for (const SymbolSpec& spec : symbols)
+	{
+		const char* name = spec.name.c_str();
+		BNSymbol* sym = BNCreateSymbol(spec.type, name, name, name, spec.address, spec.binding, &ns, spec.ordinal);
+		BNDefineAutoSymbol(m_object, sym);
+		BNFreeSymbol(sym);
+	}
+	BNEndBulkModifySymbols(m_object);
+	NameSpace::FreeAPIObject(&ns);
+}
+
+
 Ref<Symbol> BinaryView::DefineAutoSymbolAndVariableOrFunction(Ref<Platform> platform, Ref<Symbol> sym, Ref<Type> type)
 {
 	BNSymbol* result = BNDefineAutoSymbolAndVariableOrFunction(
@@ -3050,6 +3931,20 @@ void BinaryView::ApplyDebugInfo(Ref<DebugInfo> newDebugInfo)
 }
 
 
+void BinaryView::ApplyDebugInfo(const vector<Ref<DebugInfo>>& debugInfos)
+{
+	DebugInfo::ResolveConflicts(debugInfos);
+
+	BeginBulkModifySymbols();
+	for (auto& info : debugInfos)
+	{
+		if (info)
+			BNApplyDebugInfo(m_object, info->GetObject());
+	}
+	EndBulkModifySymbols();
+}
+
+
 void BinaryView::SetDebugInfo(Ref<DebugInfo> newDebugInfo)
 {
 	BNSetDebugInfo(m_object, newDebugInfo->GetObject());
@@ -3385,6 +4280,31 @@ void BinaryView::RemoveTagReference(const TagReference& ref)
 }
 
 
+void BinaryView::AddAutoDataTags(const std::vector<std::pair<uint64_t, Ref<Tag>>>& tags)
+{
+	for (auto& [addr, tag] : tags)
+		BNAddAutoDataTag(m_object, addr, tag->GetObject());
+}
+
+
+void BinaryView::AddUserDataTags(const std::vector<std::pair<uint64_t, Ref<Tag>>>& tags)
+{
+	std::string undo = BeginUndoActions(false);
+	for (auto& [addr, tag] : tags)
+		BNAddUserDataTag(m_object, addr, tag->GetObject());
+	CommitUndoActions(undo);
+}
+
+
+void BinaryView::RemoveTagReferences(const std::vector<TagReference>& refs)
+{
+	std::string undo = BeginUndoActions(false);
+	for (auto& ref : refs)
+		BNRemoveTagReference(m_object, (BNTagReference)ref);
+	CommitUndoActions(undo);
+}
+
+
 Ref<Tag> BinaryView::CreateAutoDataTag(
     uint64_t addr, const std::string& tagTypeName, const std::string& data, bool unique)
 {
@@ -3691,6 +4611,41 @@ vector<BNStringReference> BinaryView::GetStrings(uint64_t start, uint64_t len)
 }
 
 
+bool BinaryView::IterateStrings(
+	uint64_t start, uint64_t end, const function<bool(const BNStringReference&)>& callback, uint64_t windowSize)
+{
+	if (windowSize == 0)
+		windowSize = 0x100000;
+
+	for (uint64_t windowStart = start; windowStart < end;)
+	{
+		uint64_t len = min(windowSize, end - windowStart);
+		size_t count;
+		BNStringReference* strings = BNGetStringsInRange(m_object, windowStart, len, &count);
+		bool completed = true;
+		for (size_t i = 0; i < count; i++)
+		{
+			// A string crossing into the window belongs to the window it starts in
+			if (strings[i].start < windowStart || strings[i].start - windowStart >= len)
+				continue;
+			if (!callback(strings[i]))
+			{
+				completed = false;
+				break;
+			}
+		}
+		BNFreeStringReferenceList(strings);
+		if (!completed)
+			return false;
+
+		if (len == end - windowStart)
+			break;
+		windowStart += len;
+	}
+	return true;
+}
+
+
 // The caller of this function must hold a reference to the returned Ref<AnalysisCompletionEvent>.
 // Otherwise, it can be freed before the callback is triggered, leading to a crash.
 Ref<AnalysisCompletionEvent> BinaryView::AddAnalysisCompletionEvent(const function<void()>& callback)
@@ -4545,6 +5500,47 @@ bool BinaryView::PushTypeArchiveTypes(const std::string& archiveId, const std::u
 }
 
 
+bool BinaryView::PullTypeArchiveChanges(const std::string& archiveId, std::unordered_map<std::string, std::string>& updatedTypes)
+{
+	Ref<TypeArchive> archive = GetTypeArchive(archiveId);
+	if (!archive)
+		return false;
+
+	std::string key = "typeArchiveSyncSnapshot." + archiveId;
+	std::string current = archive->GetCurrentSnapshotId();
+	std::unordered_set<std::string> archiveTypeIds;
+	for (auto& [typeId, archiveTypeId] : GetAssociatedTypesFromArchive(archiveId))
+		archiveTypeIds.insert(archiveTypeId);
+
+	Ref<Metadata> previous = QueryMetadata(key);
+	if (previous && previous->IsString() && !archiveTypeIds.empty())
+	{
+		try
+		{
+			TypeArchiveSnapshotDiff diff = archive->DiffSnapshots(previous->GetString(), current);
+			std::unordered_set<std::string> changed(diff.changed.begin(), diff.changed.end());
+			for (auto i = archiveTypeIds.begin(); i != archiveTypeIds.end();)
+			{
+				if (changed.count(*i))
+					++i;
+				else
+					i = archiveTypeIds.erase(i);
+			}
+		}
+		catch (ExceptionWithStackTrace&)
+		{
+			// The archive no longer has the snapshot, so every associated type is pulled again
+		}
+	}
+
+	updatedTypes.clear();
+	if (!archiveTypeIds.empty() && !PullTypeArchiveTypes(archiveId, archiveTypeIds, updatedTypes))
+		return false;
+	StoreMetadata(key, new Metadata(current), true);
+	return true;
+}
+
+
 bool BinaryView::FindNextData(uint64_t start, const DataBuffer& data, uint64_t& result, BNFindFlag flags)
 {
 	return BNFindNextData(m_object, start, data.GetBufferObject(), &result, flags);
@@ -4669,6 +5665,219 @@ bool BinaryView::FindAllText(uint64_t start, uint64_t end, const std::string& da
 }
 
 
+namespace
+{
+	// Aho-Corasick automaton over a set of byte patterns. The root has a dense transition table since almost
+	// every input byte passes through it; other states keep their few edges sorted.
+	class MultiPatternMatcher
+	{
+		static constexpr uint32_t NoState = UINT32_MAX;
+
+		struct State
+		{
+			vector<pair<uint8_t, uint32_t>> edges;
+			uint32_t fail = 0;
+			// Closest state on the failure chain that completes a pattern
+			uint32_t output = NoState;
+			vector<uint32_t> patterns;
+		};
+
+		vector<State> m_states;
+		uint32_t m_root[256];
+		vector<size_t> m_lengths;
+		size_t m_maxLength = 0;
+		bool m_foldCase;
+
+		uint8_t Fold(uint8_t byte) const
+		{
+			return (m_foldCase && byte >= 'A' && byte <= 'Z') ? byte + ('a' - 'A') : byte;
+		}
+
+		uint32_t Child(uint32_t state, uint8_t byte) const
+		{
+			if (state == 0)
+				return m_root[byte] ? m_root[byte] : NoState;
+			const auto& edges = m_states[state].edges;
+			auto i = lower_bound(edges.begin(), edges.end(), byte,
+				[](const pair<uint8_t, uint32_t>& edge, uint8_t b) { return edge.first < b; });
+			if (i != edges.end() && i->first == byte)
+				return i->second;
+			return NoState;
+		}
+
+		uint32_t Step(uint32_t state, uint8_t byte) const
+		{
+			while (true)
+			{
+				if (state == 0)
+					return m_root[byte];
+				uint32_t next = Child(state, byte);
+				if (next != NoState)
+					return next;
+				state = m_states[state].fail;
+			}
+		}
+
+	public:
+		MultiPatternMatcher(const vector<DataBuffer>& patterns, bool foldCase) : m_foldCase(foldCase)
+		{
+			m_states.emplace_back();
+			memset(m_root, 0, sizeof(m_root));
+			m_lengths.reserve(patterns.size());
+			for (size_t i = 0; i < patterns.size(); i++)
+			{
+				const uint8_t* data = (const uint8_t*)patterns[i].GetData();
+				size_t len = patterns[i].GetLength();
+				m_lengths.push_back(len);
+				if (len == 0)
+					continue;
+				m_maxLength = max(m_maxLength, len);
+
+				uint32_t state = 0;
+				for (size_t j = 0; j < len; j++)
+				{
+					uint8_t byte = Fold(data[j]);
+					uint32_t next = Child(state, byte);
+					if (next == NoState)
+					{
+						next = (uint32_t)m_states.size();
+						m_states.emplace_back();
+						if (state == 0)
+						{
+							m_root[byte] = next;
+						}
+						else
+						{
+							auto& edges = m_states[state].edges;
+							auto k = lower_bound(edges.begin(), edges.end(), byte,
+								[](const pair<uint8_t, uint32_t>& edge, uint8_t b) { return edge.first < b; });
+							edges.insert(k, {byte, next});
+						}
+					}
+					state = next;
+				}
+				m_states[state].patterns.push_back((uint32_t)i);
+			}
+
+			// Breadth first, so every failure target is finished before the states that point at it
+			vector<uint32_t> queue;
+			for (size_t byte = 0; byte < 256; byte++)
+			{
+				if (m_root[byte])
+					queue.push_back(m_root[byte]);
+			}
+			for (size_t i = 0; i < queue.size(); i++)
+			{
+				uint32_t state = queue[i];
+				for (auto& [byte, child] : m_states[state].edges)
+				{
+					uint32_t fail = Step(m_states[state].fail, byte);
+					m_states[child].fail = fail;
+					m_states[child].output = m_states[fail].patterns.empty() ? m_states[fail].output : fail;
+					queue.push_back(child);
+				}
+			}
+		}
+
+		size_t GetMaxLength() const { return m_maxLength; }
+
+		/*! Scans \c len bytes read from \c base, reporting matches that start in [reportStart, reportEnd) */
+		template <typename Callback>
+		bool Scan(const uint8_t* data, size_t len, uint64_t base, uint64_t reportStart, uint64_t reportEnd,
+			Callback&& onMatch) const
+		{
+			uint32_t state = 0;
+			for (size_t i = 0; i < len; i++)
+			{
+				state = Step(state, Fold(data[i]));
+				uint32_t found = m_states[state].patterns.empty() ? m_states[state].output : state;
+				for (; found != NoState; found = m_states[found].output)
+				{
+					for (uint32_t pattern : m_states[found].patterns)
+					{
+						uint64_t addr = base + i + 1 - m_lengths[pattern];
+						if (addr >= reportStart && addr < reportEnd && !onMatch(pattern, addr))
+							return false;
+					}
+				}
+			}
+			return true;
+		}
+	};
+}
+
+
+bool BinaryView::FindAllDataMulti(const vector<DataBuffer>& patterns, const vector<BNAddressRange>& ranges,
+	BNFindFlag flags, const function<bool(size_t current, size_t total)>& progress,
+	const function<bool(size_t pattern, uint64_t addr)>& matchCallback, size_t threads)
+{
+	static constexpr uint64_t ChunkSize = 0x400000;
+
+	const MultiPatternMatcher matcher(patterns, flags == FindCaseInsensitive);
+	if (matcher.GetMaxLength() == 0)
+		return true;
+
+	// Split the ranges into chunks. Each chunk reads past its end far enough to see matches starting in it.
+	struct Chunk
+	{
+		uint64_t start, end, readEnd;
+	};
+	vector<Chunk> chunks;
+	size_t total = 0;
+	for (auto& range : ranges.empty() ? GetBackedAddressRanges() : ranges)
+	{
+		for (uint64_t start = range.start; start < range.end; start += min(ChunkSize, range.end - start))
+		{
+			uint64_t end = start + min(ChunkSize, range.end - start);
+			uint64_t readEnd = end + min<uint64_t>(matcher.GetMaxLength() - 1, range.end - end);
+			chunks.push_back({start, end, readEnd});
+			total += end - start;
+		}
+	}
+
+	if (threads == 0)
+		threads = GetWorkerThreadCount();
+	threads = max<size_t>(1, min(threads, chunks.size()));
+
+	mutex callbackMutex;
+	atomic<size_t> nextChunk = 0;
+	atomic<bool> stopped = false;
+	size_t current = 0;
+
+	auto worker = [&]() {
+		vector<uint8_t> buffer;
+		while (!stopped)
+		{
+			size_t index = nextChunk++;
+			if (index >= chunks.size())
+				return;
+			const Chunk& chunk = chunks[index];
+
+			buffer.resize(chunk.readEnd - chunk.start);
+			size_t len = Read(buffer.data(), chunk.start, buffer.size());
+			bool completed = matcher.Scan(buffer.data(), len, chunk.start, chunk.start, chunk.end,
+				[&](size_t pattern, uint64_t addr) {
+					unique_lock<mutex> lock(callbackMutex);
+					return !stopped && matchCallback(pattern, addr);
+				});
+
+			unique_lock<mutex> lock(callbackMutex);
+			current += chunk.end - chunk.start;
+			if (!completed || (progress && !progress(current, total)))
+				stopped = true;
+		}
+	};
+
+	vector<thread> workers;
+	for (size_t i = 1; i < threads; i++)
+		workers.emplace_back(worker);
+	worker();
+	for (auto& i : workers)
+		i.join();
+	return !stopped;
+}
+
+
 bool BinaryView::FindAllConstant(uint64_t start, uint64_t end, uint64_t constant, Ref<DisassemblySettings> settings,
     const FunctionViewType& viewType, const std::function<bool(size_t current, size_t total)>& progress,
     const std::function<bool(uint64_t addr, const LinearDisassemblyLine& line)>& matchCallback)
@@ -4813,6 +6022,24 @@ vector<Ref<Segment>> BinaryView::GetSegments()
 }
 
 
+vector<Ref<Segment>> BinaryView::GetSegmentsInRange(uint64_t start, uint64_t len)
+{
+	size_t count;
+	BNSegment** segments = BNGetSegments(m_object, &count);
+
+	uint64_t end = (start + len < start) ? UINT64_MAX : start + len;
+	vector<Ref<Segment>> result;
+	for (size_t i = 0; i < count; i++)
+	{
+		if ((BNSegmentGetStart(segments[i]) < end) && (BNSegmentGetEnd(segments[i]) > start))
+			result.push_back(new Segment(BNNewSegmentReference(segments[i])));
+	}
+
+	BNFreeSegmentList(segments, count);
+	return result;
+}
+
+
 Ref<Segment> BinaryView::GetSegmentAt(uint64_t addr)
 {
 	BNSegment* segment = BNGetSegmentAt(m_object, addr);
@@ -4904,6 +6131,24 @@ vector<Ref<Section>> BinaryView::GetSectionsAt(uint64_t addr)
 }
 
 
+vector<Ref<Section>> BinaryView::GetSectionsInRange(uint64_t start, uint64_t len)
+{
+	size_t count;
+	BNSection** sections = BNGetSections(m_object, &count);
+
+	uint64_t end = (start + len < start) ? UINT64_MAX : start + len;
+	vector<Ref<Section>> result;
+	for (size_t i = 0; i < count; i++)
+	{
+		if ((BNSectionGetStart(sections[i]) < end) && (BNSectionGetEnd(sections[i]) > start))
+			result.push_back(new Section(BNNewSectionReference(sections[i])));
+	}
+
+	BNFreeSectionList(sections, count);
+	return result;
+}
+
+
 Ref<Section> BinaryView::GetSectionByName(const string& name)
 {
 	BNSection* section = BNGetSectionByName(m_object, name.c_str());
@@ -5526,19 +6771,88 @@ Ref<BinaryView> BinaryNinja::Load(Ref<ProjectFile> projectFile, bool updateAnaly
 }
 
 
-Ref<BinaryView> BinaryNinja::ParseTextFormat(const std::string& filename)
+vector<UniversalSlice> BinaryNinja::LoadUniversalSlices(
+    const string& filename, bool updateAnalysis, const string& options, function<bool(size_t, size_t)> progress)
 {
-	BNBinaryView* handle = BNParseTextFormat(filename.c_str());
-	if (!handle)
-		return nullptr;
-	return new BinaryView(handle);
-}
+	Ref<BinaryViewType> universalType = BinaryViewType::GetByName("Universal");
+	if (!universalType)
+		return {};
 
+	// The Universal view type describes the object files in its load settings
+	Ref<FileMetadata> file = new FileMetadata(filename);
+	Ref<BinaryView> rawData = new BinaryData(file, filename);
+	Ref<Settings> loadSettings = universalType->GetLoadSettingsForData(rawData);
+	file->Close();
+	if (!loadSettings)
+		return {};
+	nlohmann::json entries =
+	    nlohmann::json::parse(loadSettings->Get<string>("loader.universal.architectures"), nullptr, false);
+	nlohmann::json baseOptions = nlohmann::json::parse(options, nullptr, false);
+	if (!entries.is_array() || !baseOptions.is_object())
+		return {};
 
-SymbolQueue::SymbolQueue()
-{
-	m_object = BNCreateSymbolQueue();
-}
+	vector<UniversalSlice> slices;
+	for (auto& entry : entries)
+	{
+		UniversalSlice slice;
+		slice.architecture = entry.value("architecture", "");
+		slice.offset = entry.value("offset", (uint64_t)0);
+		slice.size = entry.value("size", (uint64_t)0);
+		slices.push_back(std::move(slice));
+	}
+
+	mutex progressMutex;
+	vector<pair<size_t, size_t>> sliceProgress(slices.size(), {0, 0});
+	atomic<bool> cancelled = false;
+	auto reportProgress = [&](size_t index, size_t current, size_t total) {
+		if (cancelled)
+			return false;
+		if (!progress)
+			return true;
+
+		lock_guard<mutex> lock(progressMutex);
+		sliceProgress[index] = {current, total};
+		size_t combinedCurrent = 0, combinedTotal = 0;
+		for (auto& [sliceCurrent, sliceTotal] : sliceProgress)
+		{
+			combinedCurrent += sliceCurrent;
+			combinedTotal += sliceTotal;
+		}
+		if (!progress(combinedCurrent, combinedTotal))
+			cancelled = true;
+		return !cancelled;
+	};
+
+	vector<thread> threads;
+	for (size_t i = 0; i < slices.size(); i++)
+	{
+		threads.emplace_back([&, i]() {
+			nlohmann::json sliceOptions = baseOptions;
+			sliceOptions["files.universal.architecturePreference"] = {slices[i].architecture};
+			sliceOptions["loader.macho.universalImageOffset"] = slices[i].offset;
+			slices[i].view = Load(filename, updateAnalysis, sliceOptions.dump(),
+			    [&, i](size_t current, size_t total) { return reportProgress(i, current, total); });
+		});
+	}
+	for (auto& t : threads)
+		t.join();
+	return slices;
+}
+
+
+Ref<BinaryView> BinaryNinja::ParseTextFormat(const std::string& filename)
+{
+	BNBinaryView* handle = BNParseTextFormat(filename.c_str());
+	if (!handle)
+		return nullptr;
+	return new BinaryView(handle);
+}
+
+
+SymbolQueue::SymbolQueue()
+{
+	m_object = BNCreateSymbolQueue();
+}
 
 
 SymbolQueue::~SymbolQueue()
@@ -5580,3 +6894,1408 @@ void SymbolQueue::Process()
 {
 	BNProcessSymbolQueue(m_object);
 }
+
+
+static char LowerAscii(char c)
+{
+	return ((c >= 'A') && (c <= 'Z')) ? (char)(c - 'A' + 'a') : c;
+}
+
+
+static bool LessIgnoringCase(string_view a, string_view b)
+{
+	return lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(),
+		[](char x, char y) { return (unsigned char)LowerAscii(x) < (unsigned char)LowerAscii(y); });
+}
+
+
+static bool EqualIgnoringCase(char a, char b)
+{
+	return LowerAscii(a) == LowerAscii(b);
+}
+
+
+uint32_t SymbolNameStore::AddLocked(const string& name)
+{
+	auto existing = m_ids.find(name);
+	if (existing != m_ids.end())
+		return existing->second;
+
+	char* storage;
+	if (name.size() > BlockSize)
+	{
+		m_blocks.push_back(make_unique<char[]>(name.size()));
+		storage = m_blocks.back().get();
+	}
+	else
+	{
+		if (name.size() > m_blockRemaining)
+		{
+			m_blocks.push_back(make_unique<char[]>(BlockSize));
+			m_blockNext = m_blocks.back().get();
+			m_blockRemaining = BlockSize;
+		}
+		storage = m_blockNext;
+		m_blockNext += name.size();
+		m_blockRemaining -= name.size();
+	}
+	if (!name.empty())
+		memcpy(storage, name.data(), name.size());
+
+	string_view stored(storage, name.size());
+	uint32_t id = (uint32_t)m_names.size();
+	m_names.push_back(stored);
+	m_ids.emplace(stored, id);
+	return id;
+}
+
+
+void SymbolNameStore::UpdateSortedLocked() const
+{
+	size_t sortedCount = m_sorted.size();
+	if (sortedCount == m_names.size())
+		return;
+
+	// Only the names added since the last search are sorted, then merged into the rest
+	auto less = [this](uint32_t a, uint32_t b) { return LessIgnoringCase(m_names[a], m_names[b]); };
+	m_sorted.resize(m_names.size());
+	iota(m_sorted.begin() + sortedCount, m_sorted.end(), (uint32_t)sortedCount);
+	sort(m_sorted.begin() + sortedCount, m_sorted.end(), less);
+	inplace_merge(m_sorted.begin(), m_sorted.begin() + sortedCount, m_sorted.end(), less);
+}
+
+
+uint32_t SymbolNameStore::Add(const string& name)
+{
+	lock_guard<mutex> lock(m_mutex);
+	return AddLocked(name);
+}
+
+
+bool SymbolNameStore::AddSymbols(BinaryView* view, const function<bool(size_t count)>& chunkReady,
+	size_t chunkSize, const NameSpace& nameSpace)
+{
+	size_t count;
+	BNNameSpace ns = nameSpace.GetAPIObject();
+	BNSymbol** syms = BNGetSymbols(view->GetObject(), &count, &ns);
+	NameSpace::FreeAPIObject(&ns);
+
+	bool completed = true;
+	chunkSize = max<size_t>(chunkSize, 1);
+	vector<string> names;
+	names.reserve(min(chunkSize, count));
+	for (size_t start = 0; start < count; start += chunkSize)
+	{
+		// Names are read from the core before taking the lock so that searches aren't held up by it
+		names.clear();
+		for (size_t i = start; i < min(start + chunkSize, count); i++)
+		{
+			char* name = BNGetSymbolFullName(syms[i]);
+			names.emplace_back(name);
+			BNFreeString(name);
+		}
+
+		size_t total;
+		{
+			lock_guard<mutex> lock(m_mutex);
+			for (auto& name : names)
+				AddLocked(name);
+			total = m_names.size();
+		}
+		if (!chunkReady(total))
+		{
+			completed = false;
+			break;
+		}
+	}
+
+	BNFreeSymbolList(syms, count);
+	return completed;
+}
+
+
+size_t SymbolNameStore::GetCount() const
+{
+	lock_guard<mutex> lock(m_mutex);
+	return m_names.size();
+}
+
+
+string_view SymbolNameStore::GetName(uint32_t id) const
+{
+	lock_guard<mutex> lock(m_mutex);
+	return (id < m_names.size()) ? m_names[id] : string_view();
+}
+
+
+vector<uint32_t> SymbolNameStore::FindByPrefix(const string& prefix, size_t maxResults) const
+{
+	lock_guard<mutex> lock(m_mutex);
+	UpdateSortedLocked();
+
+	// Names starting with the prefix sort directly after it
+	vector<uint32_t> result;
+	auto i = lower_bound(m_sorted.begin(), m_sorted.end(), prefix,
+		[this](uint32_t id, const string& prefix) { return LessIgnoringCase(m_names[id], prefix); });
+	for (; (i != m_sorted.end()) && (result.size() < maxResults); ++i)
+	{
+		string_view name = m_names[*i];
+		if ((name.size() < prefix.size()) || !equal(prefix.begin(), prefix.end(), name.begin(), EqualIgnoringCase))
+			break;
+		result.push_back(*i);
+	}
+	return result;
+}
+
+
+vector<uint32_t> SymbolNameStore::FindContaining(const string& text, size_t maxResults) const
+{
+	lock_guard<mutex> lock(m_mutex);
+	vector<uint32_t> result;
+	for (size_t id = 0; (id < m_names.size()) && (result.size() < maxResults); id++)
+	{
+		string_view name = m_names[id];
+		if (text.empty() || (search(name.begin(), name.end(), text.begin(), text.end(), EqualIgnoringCase) != name.end()))
+			result.push_back((uint32_t)id);
+	}
+	return result;
+}
+
+
+ViewPageCache::ViewPageCache(BinaryView* view, size_t maxPages) :
+    BinaryDataNotification(BinaryDataUpdates | SegmentUpdates), m_view(view), m_maxPages(max<size_t>(maxPages, 1))
+{
+	m_view->RegisterNotification(this);
+}
+
+
+ViewPageCache::~ViewPageCache()
+{
+	m_view->UnregisterNotification(this);
+}
+
+
+shared_ptr<ViewPageCache> ViewPageCache::GetForView(BinaryView* view)
+{
+	return GetSharedForObject<ViewPageCache>(view);
+}
+
+
+shared_ptr<const vector<uint8_t>> ViewPageCache::GetPage(uint64_t pageStart)
+{
+	uint64_t generation;
+	{
+		lock_guard<mutex> lock(m_mutex);
+		auto i = m_pages.find(pageStart);
+		if (i != m_pages.end())
+		{
+			m_hits++;
+			m_lru.splice(m_lru.begin(), m_lru, i->second.lruEntry);
+			return i->second.data;
+		}
+		m_misses++;
+		generation = m_generation;
+	}
+
+	// The view is read without holding the lock so that pages already cached can be served meanwhile
+	auto data = make_shared<vector<uint8_t>>(PageSize);
+	data->resize(BNReadViewData(m_view->GetObject(), data->data(), pageStart, PageSize));
+
+	lock_guard<mutex> lock(m_mutex);
+	if (generation != m_generation)
+		return data;
+	auto i = m_pages.find(pageStart);
+	if (i != m_pages.end())
+		return i->second.data;
+
+	m_lru.push_front(pageStart);
+	m_pages[pageStart] = Page {data, m_lru.begin()};
+	while (m_pages.size() > m_maxPages)
+	{
+		m_pages.erase(m_lru.back());
+		m_lru.pop_back();
+	}
+	return data;
+}
+
+
+size_t ViewPageCache::Read(void* dest, uint64_t offset, size_t len)
+{
+	uint8_t* out = (uint8_t*)dest;
+	size_t done = 0;
+	while (done < len)
+	{
+		uint64_t addr = offset + done;
+		uint64_t pageStart = addr & ~(PageSize - 1);
+		shared_ptr<const vector<uint8_t>> page = GetPage(pageStart);
+		size_t pageOffset = (size_t)(addr - pageStart);
+		if (pageOffset >= page->size())
+		{
+			// The page read stopped before this address, which happens when a segment starts partway into the
+			// page, so read the rest directly
+			return done + m_view->Read(out + done, addr, len - done);
+		}
+
+		size_t count = min(len - done, page->size() - pageOffset);
+		memcpy(out + done, page->data() + pageOffset, count);
+		done += count;
+	}
+	return done;
+}
+
+
+DataBuffer ViewPageCache::ReadBuffer(uint64_t offset, size_t len)
+{
+	DataBuffer result(len);
+	result.SetSize(Read(result.GetData(), offset, len));
+	return result;
+}
+
+
+void ViewPageCache::Invalidate()
+{
+	lock_guard<mutex> lock(m_mutex);
+	m_pages.clear();
+	m_lru.clear();
+	m_generation++;
+}
+
+
+void ViewPageCache::InvalidateFrom(uint64_t start, uint64_t end)
+{
+	lock_guard<mutex> lock(m_mutex);
+	for (auto i = m_pages.begin(); i != m_pages.end();)
+	{
+		if ((i->first < end) && (i->first + PageSize > start))
+		{
+			m_lru.erase(i->second.lruEntry);
+			i = m_pages.erase(i);
+		}
+		else
+		{
+			++i;
+		}
+	}
+	m_generation++;
+}
+
+
+void ViewPageCache::GetStats(uint64_t& hits, uint64_t& misses)
+{
+	lock_guard<mutex> lock(m_mutex);
+	hits = m_hits;
+	misses = m_misses;
+}
+
+
+void ViewPageCache::OnBinaryDataWritten(BinaryView*, uint64_t offset, size_t len)
+{
+	InvalidateFrom(offset, offset + len);
+}
+
+
+void ViewPageCache::OnBinaryDataInserted(BinaryView*, uint64_t offset, size_t)
+{
+	// Everything after the insertion moves
+	InvalidateFrom(offset, UINT64_MAX);
+}
+
+
+void ViewPageCache::OnBinaryDataRemoved(BinaryView*, uint64_t offset, uint64_t)
+{
+	InvalidateFrom(offset, UINT64_MAX);
+}
+
+
+void ViewPageCache::OnSegmentAdded(BinaryView*, Segment*)
+{
+	Invalidate();
+}
+
+
+void ViewPageCache::OnSegmentRemoved(BinaryView*, Segment*)
+{
+	Invalidate();
+}
+
+
+void ViewPageCache::OnSegmentUpdated(BinaryView*, Segment*)
+{
+	Invalidate();
+}
+
+
+struct FeatureMapCounts::State
+{
+	mutex stateMutex;
+	condition_variable wake;
+	atomic<bool> stop = false;
+	bool dirty = false;
+	bool loaded = false;
+	bool rangesUpdated = false;
+	thread worker;
+
+	RenderCallback render;
+	chrono::milliseconds interval;
+
+	vector<BNAddressRange> ranges;
+	vector<uint64_t> rangeOffsets;  // Position of each range once they are laid end to end
+	uint64_t totalLength = 0;
+	size_t bucketCount;
+	uint64_t bytesPerBucket = 1;
+	vector<uint64_t> counts[FeatureCount];  // Bytes covered in each bucket, by feature
+
+	unordered_map<BNFunction*, vector<BNAddressRange>> functions;
+	unordered_map<uint64_t, uint64_t> dataVariables, strings;
+
+	// Features changed by notifications while the initial load was reading them, which it must not overwrite
+	unordered_set<BNFunction*> touchedFunctions;
+	unordered_set<uint64_t> touchedDataVariables, touchedStrings;
+
+	void SetRanges(vector<BNAddressRange> newRanges)
+	{
+		sort(newRanges.begin(), newRanges.end(),
+			[](const BNAddressRange& a, const BNAddressRange& b) { return a.start < b.start; });
+		ranges = std::move(newRanges);
+		rangeOffsets.clear();
+		totalLength = 0;
+		for (auto& range : ranges)
+		{
+			rangeOffsets.push_back(totalLength);
+			totalLength += range.end - range.start;
+		}
+	}
+
+	bool GetLinearOffset(uint64_t addr, uint64_t& offset) const
+	{
+		auto i = upper_bound(ranges.begin(), ranges.end(), addr,
+			[](uint64_t addr, const BNAddressRange& range) { return addr < range.end; });
+		if ((i == ranges.end()) || (addr < i->start))
+			return false;
+		offset = rangeOffsets[i - ranges.begin()] + (addr - i->start);
+		return true;
+	}
+
+	void Count(Feature feature, uint64_t start, uint64_t len, bool add)
+	{
+		uint64_t end = (start + len < start) ? UINT64_MAX : start + len;
+		auto i = upper_bound(ranges.begin(), ranges.end(), start,
+			[](uint64_t addr, const BNAddressRange& range) { return addr < range.end; });
+		for (; (i != ranges.end()) && (i->start < end); ++i)
+		{
+			uint64_t partStart = max(start, i->start);
+			uint64_t linearStart = rangeOffsets[i - ranges.begin()] + (partStart - i->start);
+			uint64_t linearEnd = linearStart + (min(end, i->end) - partStart);
+			for (uint64_t bucket = linearStart / bytesPerBucket;
+				 (bucket < bucketCount) && (bucket * bytesPerBucket < linearEnd); bucket++)
+			{
+				uint64_t bytes = min(linearEnd, (bucket + 1) * bytesPerBucket) - max(linearStart, bucket * bytesPerBucket);
+				if (add)
+					counts[feature][bucket] += bytes;
+				else
+					counts[feature][bucket] -= bytes;
+			}
+		}
+		dirty = true;
+	}
+
+	void Recount()
+	{
+		bytesPerBucket = max<uint64_t>((totalLength + bucketCount - 1) / bucketCount, 1);
+		for (auto& featureCounts : counts)
+			featureCounts.assign(bucketCount, 0);
+		for (auto& [func, funcRanges] : functions)
+		{
+			for (auto& range : funcRanges)
+				Count(FunctionFeature, range.start, range.end - range.start, true);
+		}
+		for (auto& [addr, len] : dataVariables)
+			Count(DataVariableFeature, addr, len, true);
+		for (auto& [addr, len] : strings)
+			Count(StringFeature, addr, len, true);
+		dirty = true;
+	}
+
+	void SetFunction(BNFunction* func, vector<BNAddressRange> funcRanges, bool present)
+	{
+		lock_guard<mutex> lock(stateMutex);
+		if (!loaded)
+			touchedFunctions.insert(func);
+		auto i = functions.find(func);
+		if (i != functions.end())
+		{
+			for (auto& range : i->second)
+				Count(FunctionFeature, range.start, range.end - range.start, false);
+			functions.erase(i);
+		}
+		if (present)
+		{
+			for (auto& range : funcRanges)
+				Count(FunctionFeature, range.start, range.end - range.start, true);
+			functions[func] = std::move(funcRanges);
+		}
+		wake.notify_all();
+	}
+
+	// A length of zero removes the feature at addr
+	void SetRange(Feature feature, unordered_map<uint64_t, uint64_t>& features, unordered_set<uint64_t>& touched,
+		uint64_t addr, uint64_t len)
+	{
+		lock_guard<mutex> lock(stateMutex);
+		if (!loaded)
+			touched.insert(addr);
+		auto i = features.find(addr);
+		if (i != features.end())
+		{
+			Count(feature, addr, i->second, false);
+			features.erase(i);
+		}
+		if (len != 0)
+		{
+			Count(feature, addr, len, true);
+			features[addr] = len;
+		}
+		wake.notify_all();
+	}
+
+	void UpdateRanges(BinaryView* view)
+	{
+		vector<BNAddressRange> newRanges = view->GetBackedAddressRanges();
+		lock_guard<mutex> lock(stateMutex);
+		rangesUpdated = true;
+		SetRanges(std::move(newRanges));
+		Recount();
+		wake.notify_all();
+	}
+
+	void Load(Ref<BinaryView> view)
+	{
+		vector<pair<BNFunction*, vector<BNAddressRange>>> loadedFunctions;
+		for (auto& func : view->GetAnalysisFunctionList())
+		{
+			if (stop)
+				return;
+			loadedFunctions.emplace_back(func->GetObject(), func->GetAddressRanges());
+		}
+		map<uint64_t, DataVariable> loadedVariables = view->GetDataVariables();
+		vector<BNStringReference> loadedStrings = view->GetStrings();
+		vector<BNAddressRange> loadedRanges = view->GetBackedAddressRanges();
+
+		lock_guard<mutex> lock(stateMutex);
+		if (!rangesUpdated)
+			SetRanges(std::move(loadedRanges));
+		for (auto& [func, funcRanges] : loadedFunctions)
+		{
+			if (touchedFunctions.count(func) == 0)
+				functions[func] = std::move(funcRanges);
+		}
+		for (auto& [addr, var] : loadedVariables)
+		{
+			if (touchedDataVariables.count(addr) == 0)
+				dataVariables[addr] = GetDataVariableLength(var);
+		}
+		for (auto& str : loadedStrings)
+		{
+			if (touchedStrings.count(str.start) == 0)
+				strings[str.start] = str.length;
+		}
+		touchedFunctions.clear();
+		touchedDataVariables.clear();
+		touchedStrings.clear();
+		loaded = true;
+		Recount();
+	}
+
+	void Run(Ref<BinaryView> view)
+	{
+		Load(view);
+
+		unique_lock<mutex> lock(stateMutex);
+		chrono::steady_clock::time_point lastRender;
+		while (!stop)
+		{
+			wake.wait(lock, [&]() { return stop || dirty; });
+			// Changes arriving until the interval is up are drawn together
+			if (wake.wait_until(lock, lastRender + interval, [&]() { return stop.load(); }))
+				break;
+
+			vector<uint8_t> features(bucketCount, NoFeature);
+			for (size_t bucket = 0; bucket < bucketCount; bucket++)
+			{
+				uint64_t best = 0;
+				for (uint8_t feature = FunctionFeature; feature < FeatureCount; feature++)
+				{
+					if (counts[feature][bucket] > best)
+					{
+						best = counts[feature][bucket];
+						features[bucket] = feature;
+					}
+				}
+			}
+			dirty = false;
+			lastRender = chrono::steady_clock::now();
+
+			lock.unlock();
+			render(features);
+			lock.lock();
+		}
+	}
+
+	static uint64_t GetDataVariableLength(const DataVariable& var)
+	{
+		// Variables without a size still get a byte so that they show up
+		return max<uint64_t>(var.type.GetValue() ? var.type->GetWidth() : 0, 1);
+	}
+};
+
+
+FeatureMapCounts::FeatureMapCounts(
+	BinaryView* view, size_t bucketCount, const RenderCallback& render, chrono::milliseconds interval) :
+    BinaryDataNotification(FunctionUpdates | DataVariableUpdates | StringUpdates | SegmentUpdates),
+    m_state(make_shared<State>()), m_view(view)
+{
+	m_state->render = render;
+	m_state->interval = interval;
+	m_state->bucketCount = max<size_t>(bucketCount, 1);
+	m_view->RegisterNotification(this);
+
+	Ref<BinaryView> viewRef = m_view;
+	m_state->worker = thread([state = m_state.get(), viewRef]() { state->Run(viewRef); });
+}
+
+
+FeatureMapCounts::~FeatureMapCounts()
+{
+	m_view->UnregisterNotification(this);
+	{
+		lock_guard<mutex> lock(m_state->stateMutex);
+		m_state->stop = true;
+	}
+	m_state->wake.notify_all();
+	m_state->worker.join();
+}
+
+
+void FeatureMapCounts::SetBucketCount(size_t bucketCount)
+{
+	lock_guard<mutex> lock(m_state->stateMutex);
+	m_state->bucketCount = max<size_t>(bucketCount, 1);
+	m_state->Recount();
+	m_state->wake.notify_all();
+}
+
+
+size_t FeatureMapCounts::GetBucketCount() const
+{
+	lock_guard<mutex> lock(m_state->stateMutex);
+	return m_state->bucketCount;
+}
+
+
+bool FeatureMapCounts::GetBucketForAddress(uint64_t addr, size_t& bucket) const
+{
+	lock_guard<mutex> lock(m_state->stateMutex);
+	uint64_t offset;
+	if (!m_state->GetLinearOffset(addr, offset))
+		return false;
+	bucket = (size_t)min<uint64_t>(offset / m_state->bytesPerBucket, m_state->bucketCount - 1);
+	return true;
+}
+
+
+void FeatureMapCounts::OnAnalysisFunctionAdded(BinaryView*, Function* func)
+{
+	m_state->SetFunction(func->GetObject(), func->GetAddressRanges(), true);
+}
+
+
+void FeatureMapCounts::OnAnalysisFunctionRemoved(BinaryView*, Function* func)
+{
+	m_state->SetFunction(func->GetObject(), {}, false);
+}
+
+
+void FeatureMapCounts::OnAnalysisFunctionUpdated(BinaryView*, Function* func)
+{
+	m_state->SetFunction(func->GetObject(), func->GetAddressRanges(), true);
+}
+
+
+void FeatureMapCounts::OnDataVariableAdded(BinaryView*, const DataVariable& var)
+{
+	m_state->SetRange(DataVariableFeature, m_state->dataVariables, m_state->touchedDataVariables, var.address,
+		State::GetDataVariableLength(var));
+}
+
+
+void FeatureMapCounts::OnDataVariableRemoved(BinaryView*, const DataVariable& var)
+{
+	m_state->SetRange(DataVariableFeature, m_state->dataVariables, m_state->touchedDataVariables, var.address, 0);
+}
+
+
+void FeatureMapCounts::OnDataVariableUpdated(BinaryView*, const DataVariable& var)
+{
+	m_state->SetRange(DataVariableFeature, m_state->dataVariables, m_state->touchedDataVariables, var.address,
+		State::GetDataVariableLength(var));
+}
+
+
+void FeatureMapCounts::OnStringFound(BinaryView*, BNStringType, uint64_t offset, size_t len)
+{
+	m_state->SetRange(StringFeature, m_state->strings, m_state->touchedStrings, offset, len);
+}
+
+
+void FeatureMapCounts::OnStringRemoved(BinaryView*, BNStringType, uint64_t offset, size_t)
+{
+	m_state->SetRange(StringFeature, m_state->strings, m_state->touchedStrings, offset, 0);
+}
+
+
+void FeatureMapCounts::OnSegmentAdded(BinaryView* data, Segment*)
+{
+	m_state->UpdateRanges(data);
+}
+
+
+void FeatureMapCounts::OnSegmentRemoved(BinaryView* data, Segment*)
+{
+	m_state->UpdateRanges(data);
+}
+
+
+void FeatureMapCounts::OnSegmentUpdated(BinaryView* data, Segment*)
+{
+	m_state->UpdateRanges(data);
+}
+
+
+template <typename T>
+struct MemoryMapRows
+{
+	struct Row
+	{
+		uint64_t start, end;
+		Ref<T> object;
+	};
+
+	vector<Row> rows;  // Sorted by start
+	uint64_t maxLength = 0;  // Longest region added so far, which bounds the search for overlaps
+	unordered_map<const void*, uint64_t> starts;  // Start of each row, by handle
+	vector<pair<Ref<T>, bool>> pending;  // Regions reported as changed and whether they still exist
+
+	static bool StartLess(const Row& row, uint64_t start) { return row.start < start; }
+	static bool AddressLess(uint64_t addr, const Row& row) { return addr < row.start; }
+
+	void Load(const vector<Ref<T>>& objects)
+	{
+		for (auto& object : objects)
+		{
+			rows.push_back(Row {object->GetStart(), object->GetEnd(), object});
+			starts[object->GetObject()] = object->GetStart();
+			maxLength = max(maxLength, object->GetEnd() - object->GetStart());
+		}
+		stable_sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) { return a.start < b.start; });
+	}
+
+	size_t Find(const void* handle) const
+	{
+		auto start = starts.find(handle);
+		if (start == starts.end())
+			return rows.size();
+		for (auto i = lower_bound(rows.begin(), rows.end(), start->second, StartLess);
+			 (i != rows.end()) && (i->start == start->second); ++i)
+		{
+			if (i->object->GetObject() == handle)
+				return i - rows.begin();
+		}
+		return rows.size();
+	}
+
+	void Apply(const vector<pair<Ref<T>, bool>>& changes, bool sections, size_t maxRowChanges,
+		const MemoryMapIndex::ChangeCallback& callback)
+	{
+		using Change = MemoryMapIndex::Change;
+
+		// Only the last reported state of each region matters
+		unordered_map<const void*, pair<Ref<T>, bool>> latest;
+		for (auto& [object, present] : changes)
+			latest[object->GetObject()] = {object, present};
+
+		if (latest.size() > maxRowChanges)
+		{
+			Change change {Change::Reset, sections, 0};
+			callback(change, false);
+			vector<Row> merged;
+			merged.reserve(rows.size() + latest.size());
+			for (auto& row : rows)
+			{
+				if (latest.count(row.object->GetObject()) == 0)
+					merged.push_back(std::move(row));
+			}
+			for (auto& [handle, entry] : latest)
+			{
+				starts.erase(handle);
+				if (!entry.second)
+					continue;
+				uint64_t start = entry.first->GetStart(), end = entry.first->GetEnd();
+				merged.push_back(Row {start, end, entry.first});
+				starts[handle] = start;
+				maxLength = max(maxLength, end - start);
+			}
+			stable_sort(merged.begin(), merged.end(), [](const Row& a, const Row& b) { return a.start < b.start; });
+			rows = std::move(merged);
+			callback(change, true);
+			return;
+		}
+
+		for (auto& [handle, entry] : latest)
+		{
+			auto& [object, present] = entry;
+			size_t row = Find(handle);
+			uint64_t start = present ? object->GetStart() : 0;
+			uint64_t end = present ? object->GetEnd() : 0;
+			if ((row < rows.size()) && present && (rows[row].start == start) && (rows[row].end == end))
+			{
+				Change change {Change::RowChanged, sections, row};
+				callback(change, false);
+				rows[row].object = object;
+				callback(change, true);
+				continue;
+			}
+
+			if (row < rows.size())
+			{
+				Change change {Change::RowRemoved, sections, row};
+				callback(change, false);
+				rows.erase(rows.begin() + row);
+				starts.erase(handle);
+				callback(change, true);
+			}
+			if (present)
+			{
+				row = upper_bound(rows.begin(), rows.end(), start, AddressLess) - rows.begin();
+				Change change {Change::RowInserted, sections, row};
+				callback(change, false);
+				rows.insert(rows.begin() + row, Row {start, end, object});
+				starts[handle] = start;
+				maxLength = max(maxLength, end - start);
+				callback(change, true);
+			}
+		}
+	}
+
+	vector<Ref<T>> GetRows(size_t firstRow, size_t count) const
+	{
+		vector<Ref<T>> result;
+		for (size_t i = firstRow; (i < rows.size()) && (i - firstRow < count); i++)
+			result.push_back(rows[i].object);
+		return result;
+	}
+
+	vector<Ref<T>> GetInRange(uint64_t start, uint64_t len) const
+	{
+		uint64_t end = (start + len < start) ? UINT64_MAX : start + len;
+		uint64_t earliest = (start > maxLength) ? start - maxLength : 0;
+		vector<Ref<T>> result;
+		for (auto i = lower_bound(rows.begin(), rows.end(), earliest, StartLess); (i != rows.end()) && (i->start < end);
+			 ++i)
+		{
+			if (i->end > start)
+				result.push_back(i->object);
+		}
+		return result;
+	}
+
+	size_t GetRowForAddress(uint64_t addr) const
+	{
+		auto i = upper_bound(rows.begin(), rows.end(), addr, AddressLess);
+		return (i == rows.begin()) ? 0 : (size_t)(i - rows.begin()) - 1;
+	}
+};
+
+
+struct MemoryMapIndex::State
+{
+	mutex pendingMutex;
+	size_t maxRowChanges;
+	MemoryMapRows<Segment> segments;
+	MemoryMapRows<Section> sections;
+};
+
+
+MemoryMapIndex::MemoryMapIndex(BinaryView* view, size_t maxRowChanges) :
+    BinaryDataNotification(SegmentUpdates | SectionUpdates), m_state(make_unique<State>()), m_view(view)
+{
+	m_state->maxRowChanges = maxRowChanges;
+	// Registered first so that nothing changing during the load is missed; Update treats repeats as changes
+	m_view->RegisterNotification(this);
+	m_state->segments.Load(m_view->GetSegments());
+	m_state->sections.Load(m_view->GetSections());
+}
+
+
+MemoryMapIndex::~MemoryMapIndex()
+{
+	m_view->UnregisterNotification(this);
+}
+
+
+bool MemoryMapIndex::Update(const ChangeCallback& callback)
+{
+	vector<pair<Ref<Segment>, bool>> segments;
+	vector<pair<Ref<Section>, bool>> sections;
+	{
+		lock_guard<mutex> lock(m_state->pendingMutex);
+		segments.swap(m_state->segments.pending);
+		sections.swap(m_state->sections.pending);
+	}
+	if (segments.empty() && sections.empty())
+		return false;
+
+	m_state->segments.Apply(segments, false, m_state->maxRowChanges, callback);
+	m_state->sections.Apply(sections, true, m_state->maxRowChanges, callback);
+	return true;
+}
+
+
+size_t MemoryMapIndex::GetSegmentCount() const
+{
+	return m_state->segments.rows.size();
+}
+
+
+size_t MemoryMapIndex::GetSectionCount() const
+{
+	return m_state->sections.rows.size();
+}
+
+
+vector<Ref<Segment>> MemoryMapIndex::GetSegments(size_t firstRow, size_t count) const
+{
+	return m_state->segments.GetRows(firstRow, count);
+}
+
+
+vector<Ref<Section>> MemoryMapIndex::GetSections(size_t firstRow, size_t count) const
+{
+	return m_state->sections.GetRows(firstRow, count);
+}
+
+
+vector<Ref<Segment>> MemoryMapIndex::GetSegmentsInRange(uint64_t start, uint64_t len) const
+{
+	return m_state->segments.GetInRange(start, len);
+}
+
+
+vector<Ref<Section>> MemoryMapIndex::GetSectionsInRange(uint64_t start, uint64_t len) const
+{
+	return m_state->sections.GetInRange(start, len);
+}
+
+
+size_t MemoryMapIndex::GetSegmentRowForAddress(uint64_t addr) const
+{
+	return m_state->segments.GetRowForAddress(addr);
+}
+
+
+size_t MemoryMapIndex::GetSectionRowForAddress(uint64_t addr) const
+{
+	return m_state->sections.GetRowForAddress(addr);
+}
+
+
+void MemoryMapIndex::OnSegmentAdded(BinaryView*, Segment* segment)
+{
+	lock_guard<mutex> lock(m_state->pendingMutex);
+	m_state->segments.pending.emplace_back(segment, true);
+}
+
+
+void MemoryMapIndex::OnSegmentRemoved(BinaryView*, Segment* segment)
+{
+	lock_guard<mutex> lock(m_state->pendingMutex);
+	m_state->segments.pending.emplace_back(segment, false);
+}
+
+
+void MemoryMapIndex::OnSegmentUpdated(BinaryView*, Segment* segment)
+{
+	lock_guard<mutex> lock(m_state->pendingMutex);
+	m_state->segments.pending.emplace_back(segment, true);
+}
+
+
+void MemoryMapIndex::OnSectionAdded(BinaryView*, Section* section)
+{
+	lock_guard<mutex> lock(m_state->pendingMutex);
+	m_state->sections.pending.emplace_back(section, true);
+}
+
+
+void MemoryMapIndex::OnSectionRemoved(BinaryView*, Section* section)
+{
+	lock_guard<mutex> lock(m_state->pendingMutex);
+	m_state->sections.pending.emplace_back(section, false);
+}
+
+
+void MemoryMapIndex::OnSectionUpdated(BinaryView*, Section* section)
+{
+	lock_guard<mutex> lock(m_state->pendingMutex);
+	m_state->sections.pending.emplace_back(section, true);
+}
+
+
+struct SegmentMapSnapshot::Index
+{
+	GenericRangeTree<Segment*> segments;
+	GenericRangeTree<Section*> sections;
+};
+
+
+// Sorts regions by start and indexes them. Starts and ends are read once here rather than on every comparison,
+// since each read is a call into the core; the tree's ranges are inclusive, so empty regions are left out.
+template <typename T>
+static GenericRangeTree<T*> BuildRegionTree(vector<Ref<T>>& regions)
+{
+	vector<typename GenericRangeTree<T*>::Entry> entries;
+	entries.reserve(regions.size());
+	for (auto& region : regions)
+		entries.push_back({region->GetStart(), region->GetEnd(), region.GetPtr()});
+	stable_sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.start < b.start; });
+
+	vector<Ref<T>> sorted;
+	sorted.reserve(entries.size());
+	for (auto& entry : entries)
+		sorted.push_back(entry.value);
+	regions.swap(sorted);
+	entries.erase(remove_if(entries.begin(), entries.end(), [](const auto& entry) { return entry.end <= entry.start; }),
+		entries.end());
+	for (auto& entry : entries)
+		entry.end--;
+	return GenericRangeTree<T*>(std::move(entries));
+}
+
+
+SegmentMapSnapshot::SegmentMapSnapshot(BinaryView* view, uint64_t version) :
+    m_version(version), m_segments(view->GetSegments()), m_sections(view->GetSections())
+{
+	auto index = make_unique<Index>();
+	index->segments = BuildRegionTree(m_segments);
+	index->sections = BuildRegionTree(m_sections);
+	m_index = std::move(index);
+}
+
+
+SegmentMapSnapshot::~SegmentMapSnapshot() {}
+
+
+Segment* SegmentMapSnapshot::GetSegmentAt(uint64_t addr) const
+{
+	auto entry = m_index->segments.GetInnermostContaining(addr);
+	return entry ? entry->value : nullptr;
+}
+
+
+Section* SegmentMapSnapshot::GetSectionAt(uint64_t addr) const
+{
+	auto entry = m_index->sections.GetInnermostContaining(addr);
+	return entry ? entry->value : nullptr;
+}
+
+
+vector<Section*> SegmentMapSnapshot::GetSectionsAt(uint64_t addr) const
+{
+	vector<Section*> result;
+	m_index->sections.ForEachOverlapping(addr, addr, [&](const GenericRangeTree<Section*>::Entry& entry) {
+		result.push_back(entry.value);
+		return true;
+	});
+	return result;
+}
+
+
+ViewSegmentMap::ViewSegmentMap(BinaryView* view) :
+    BinaryDataNotification(SegmentUpdates | SectionUpdates), m_view(view)
+{
+	m_view->RegisterNotification(this);
+}
+
+
+ViewSegmentMap::~ViewSegmentMap()
+{
+	m_view->UnregisterNotification(this);
+}
+
+
+shared_ptr<ViewSegmentMap> ViewSegmentMap::GetForView(BinaryView* view)
+{
+	return GetSharedForObject<ViewSegmentMap>(view);
+}
+
+
+shared_ptr<const SegmentMapSnapshot> ViewSegmentMap::GetSnapshot()
+{
+	// Held while copying so that callers racing for a stale snapshot wait for one copy instead of each making one
+	lock_guard<mutex> lock(m_mutex);
+	uint64_t version = m_version;
+	if (!m_snapshot || (m_snapshot->GetVersion() != version))
+	{
+		// A change notified during the copy bumps the version again, so the next call makes a fresh one
+		m_snapshot = make_shared<const SegmentMapSnapshot>(m_view, version);
+	}
+	return m_snapshot;
+}
+
+
+uint32_t CallGraphSnapshot::GetFunctionIndex(uint64_t addr) const
+{
+	auto i = lower_bound(functionStarts.begin(), functionStarts.end(), addr);
+	if ((i == functionStarts.end()) || (*i != addr))
+		return NotAFunction;
+	return (uint32_t)(i - functionStarts.begin());
+}
+
+
+// Call sites of the functions starting at an address, merged over every function there
+struct ViewCallGraphCalls
+{
+	vector<uint64_t> sites;
+	vector<size_t> calleeCounts;
+	vector<uint64_t> callees;
+};
+
+
+struct ViewCallGraph::State
+{
+	mutex pendingMutex;
+	atomic<uint64_t> version = 1;
+	bool loaded = false;
+	unordered_set<uint64_t> changed;
+
+	mutex buildMutex;
+	map<uint64_t, ViewCallGraphCalls> calls;
+	shared_ptr<const CallGraphSnapshot> snapshot;
+};
+
+
+// Appends the call sites of func and the callees of each to calls
+static void ReadFunctionCalls(BNBinaryView* view, BNFunction* func, ViewCallGraphCalls& calls)
+{
+	size_t siteCount;
+	BNReferenceSource* refs = BNGetFunctionCallSites(func, &siteCount);
+	for (size_t i = 0; i < siteCount; i++)
+	{
+		size_t count;
+		uint64_t* targets = BNGetCallees(view, &refs[i], &count);
+		calls.sites.push_back(refs[i].addr);
+		calls.calleeCounts.push_back(count);
+		calls.callees.insert(calls.callees.end(), targets, targets + count);
+		BNFreeAddressList(targets);
+	}
+	BNFreeCodeReferences(refs, siteCount);
+}
+
+
+ViewCallGraph::ViewCallGraph(BinaryView* view) :
+    BinaryDataNotification(FunctionUpdates), m_state(make_unique<State>()), m_view(view)
+{
+	// Registered before the first load so that nothing analysis changes meanwhile is missed
+	m_view->RegisterNotification(this);
+}
+
+
+ViewCallGraph::~ViewCallGraph()
+{
+	m_view->UnregisterNotification(this);
+}
+
+
+shared_ptr<ViewCallGraph> ViewCallGraph::GetForView(BinaryView* view)
+{
+	return GetSharedForObject<ViewCallGraph>(view);
+}
+
+
+uint64_t ViewCallGraph::GetVersion() const
+{
+	return m_state->version;
+}
+
+
+shared_ptr<const CallGraphSnapshot> ViewCallGraph::GetSnapshot()
+{
+	lock_guard<mutex> buildLock(m_state->buildMutex);
+	uint64_t version;
+	bool loaded;
+	unordered_set<uint64_t> changed;
+	{
+		lock_guard<mutex> lock(m_state->pendingMutex);
+		version = m_state->version;
+		if (m_state->snapshot && (m_state->snapshot->version == version))
+			return m_state->snapshot;
+		loaded = m_state->loaded;
+		m_state->loaded = true;
+		changed.swap(m_state->changed);
+	}
+
+	BNBinaryView* view = m_view->GetObject();
+	if (!loaded)
+	{
+		size_t count;
+		BNFunction** funcs = BNGetAnalysisFunctionList(view, &count);
+		m_state->calls.clear();
+		for (size_t i = 0; i < count; i++)
+			ReadFunctionCalls(view, funcs[i], m_state->calls[BNGetFunctionStart(funcs[i])]);
+		BNFreeFunctionList(funcs, count);
+	}
+	else
+	{
+		for (uint64_t addr : changed)
+		{
+			size_t count;
+			BNFunction** funcs = BNGetAnalysisFunctionsForAddress(view, addr, &count);
+			ViewCallGraphCalls calls;
+			for (size_t i = 0; i < count; i++)
+				ReadFunctionCalls(view, funcs[i], calls);
+			BNFreeFunctionList(funcs, count);
+			if (count)
+				m_state->calls[addr] = std::move(calls);
+			else
+				m_state->calls.erase(addr);
+		}
+	}
+
+	// Everything from here on uses the cached call sites only
+	auto snapshot = make_shared<CallGraphSnapshot>();
+	snapshot->version = version;
+	snapshot->functionStarts.reserve(m_state->calls.size());
+	for (auto& [addr, calls] : m_state->calls)
+		snapshot->functionStarts.push_back(addr);
+
+	snapshot->callSiteStarts.reserve(m_state->calls.size() + 1);
+	snapshot->calleeStarts.push_back(0);
+	for (auto& [addr, calls] : m_state->calls)
+	{
+		snapshot->callSiteStarts.push_back(snapshot->callSiteAddresses.size());
+		snapshot->callSiteAddresses.insert(snapshot->callSiteAddresses.end(), calls.sites.begin(), calls.sites.end());
+		for (size_t count : calls.calleeCounts)
+		{
+			snapshot->callSiteIndirect.push_back(count != 1);
+			snapshot->calleeStarts.push_back(snapshot->calleeStarts.back() + count);
+		}
+		snapshot->calleeAddresses.insert(snapshot->calleeAddresses.end(), calls.callees.begin(), calls.callees.end());
+	}
+	snapshot->callSiteStarts.push_back(snapshot->callSiteAddresses.size());
+
+	snapshot->callees.reserve(snapshot->calleeAddresses.size());
+	for (uint64_t callee : snapshot->calleeAddresses)
+		snapshot->callees.push_back(snapshot->GetFunctionIndex(callee));
+
+	m_state->snapshot = snapshot;
+	return snapshot;
+}
+
+
+void ViewCallGraph::MarkChanged(Function* func)
+{
+	uint64_t addr = func->GetStart();
+	lock_guard<mutex> lock(m_state->pendingMutex);
+	if (m_state->loaded)
+		m_state->changed.insert(addr);
+	m_state->version++;
+}
+
+
+void ViewCallGraph::OnAnalysisFunctionAdded(BinaryView*, Function* func)
+{
+	MarkChanged(func);
+}
+
+
+void ViewCallGraph::OnAnalysisFunctionRemoved(BinaryView*, Function* func)
+{
+	MarkChanged(func);
+}
+
+
+void ViewCallGraph::OnAnalysisFunctionUpdated(BinaryView*, Function* func)
+{
+	MarkChanged(func);
+}
+
+
+struct TagIndex::State
+{
+	struct Entry
+	{
+		TagReference ref;
+		Ref<TagType> type;
+		uint64_t addr;
+		bool added;
+	};
+
+	struct TypeTags
+	{
+		Ref<TagType> type;
+		multimap<uint64_t, TagReference> byAddress;
+	};
+
+	mutex tagsMutex;
+	// Keyed by the core object, every reference of a type has its own wrapper
+	unordered_map<BNTagType*, TypeTags> types;
+	size_t count = 0;
+	bool loaded = false;
+	// Notifications received while the initial references were being read, applied after them
+	vector<Entry> pending;
+
+	static Entry MakeEntry(const TagReference& ref, bool added)
+	{
+		uint64_t addr = ref.addr;
+		if (ref.refType == FunctionTagReference && ref.func)
+			addr = ref.func->GetStart();
+		return {ref, ref.tag->GetType(), addr, added};
+	}
+
+	void Apply(const Entry& entry)
+	{
+		auto found = types.find(entry.type->GetObject());
+		if (found == types.end())
+		{
+			if (!entry.added)
+				return;
+			found = types.emplace(entry.type->GetObject(), TypeTags {entry.type, {}}).first;
+		}
+
+		// Tags added during the load are seen both in the notifications and in the initial references
+		auto& byAddress = found->second.byAddress;
+		auto range = byAddress.equal_range(entry.addr);
+		auto existing = find_if(range.first, range.second, [&](auto& i) { return i.second == entry.ref; });
+		if (entry.added && existing == range.second)
+		{
+			byAddress.emplace_hint(range.second, entry.addr, entry.ref);
+			count++;
+		}
+		else if (!entry.added && existing != range.second)
+		{
+			byAddress.erase(existing);
+			count--;
+			if (byAddress.empty())
+				types.erase(found);
+		}
+	}
+
+	void Notify(Entry&& entry)
+	{
+		lock_guard<mutex> lock(tagsMutex);
+		if (loaded)
+			Apply(entry);
+		else
+			pending.push_back(std::move(entry));
+	}
+};
+
+
+TagIndex::TagIndex(BinaryView* view) :
+    BinaryDataNotification(TagLifetime), m_state(make_unique<State>()), m_view(view)
+{
+	// Registered first so that nothing changing during the load is missed
+	m_view->RegisterNotification(this);
+	vector<State::Entry> entries;
+	for (auto& ref : m_view->GetAllTagReferences())
+		entries.push_back(State::MakeEntry(ref, true));
+
+	lock_guard<mutex> lock(m_state->tagsMutex);
+	for (auto& entry : entries)
+		m_state->Apply(entry);
+	for (auto& entry : m_state->pending)
+		m_state->Apply(entry);
+	m_state->pending.clear();
+	m_state->loaded = true;
+}
+
+
+TagIndex::~TagIndex()
+{
+	m_view->UnregisterNotification(this);
+}
+
+
+size_t TagIndex::GetCount() const
+{
+	lock_guard<mutex> lock(m_state->tagsMutex);
+	return m_state->count;
+}
+
+
+size_t TagIndex::GetCount(TagType* tagType) const
+{
+	lock_guard<mutex> lock(m_state->tagsMutex);
+	auto found = m_state->types.find(tagType->GetObject());
+	if (found == m_state->types.end())
+		return 0;
+	return found->second.byAddress.size();
+}
+
+
+map<Ref<TagType>, size_t> TagIndex::GetTypeCounts() const
+{
+	lock_guard<mutex> lock(m_state->tagsMutex);
+	map<Ref<TagType>, size_t> result;
+	for (auto& [object, tags] : m_state->types)
+		result[tags.type] = tags.byAddress.size();
+	return result;
+}
+
+
+vector<TagReference> TagIndex::GetTagReferencesOfType(TagType* tagType) const
+{
+	lock_guard<mutex> lock(m_state->tagsMutex);
+	vector<TagReference> result;
+	auto found = m_state->types.find(tagType->GetObject());
+	if (found == m_state->types.end())
+		return result;
+	result.reserve(found->second.byAddress.size());
+	for (auto& [addr, ref] : found->second.byAddress)
+		result.push_back(ref);
+	return result;
+}
+
+
+vector<TagReference> TagIndex::GetTagReferencesInRange(uint64_t start, uint64_t end, TagType* tagType) const
+{
+	lock_guard<mutex> lock(m_state->tagsMutex);
+	vector<pair<uint64_t, TagReference>> refs;
+	for (auto& [object, tags] : m_state->types)
+	{
+		if (tagType && object != tagType->GetObject())
+			continue;
+		auto first = tags.byAddress.lower_bound(start);
+		auto last = tags.byAddress.lower_bound(end);
+		refs.insert(refs.end(), first, last);
+	}
+	// Each type is already in order, only interleaving them needs a sort
+	stable_sort(refs.begin(), refs.end(), [](auto& a, auto& b) { return a.first < b.first; });
+
+	vector<TagReference> result;
+	result.reserve(refs.size());
+	for (auto& [addr, ref] : refs)
+		result.push_back(std::move(ref));
+	return result;
+}
+
+
+void TagIndex::OnTagAdded(BinaryView*, const TagReference& tagRef)
+{
+	m_state->Notify(State::MakeEntry(tagRef, true));
+}
+
+
+void TagIndex::OnTagRemoved(BinaryView*, const TagReference& tagRef)
+{
+	m_state->Notify(State::MakeEntry(tagRef, false));
+}
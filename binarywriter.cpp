@@ -18,13 +18,22 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <cstring>
 #include "binaryninjaapi.h"
 
 using namespace BinaryNinja;
 using namespace std;
 
 
-BinaryWriter::BinaryWriter(BinaryView* data, BNEndianness endian) : m_view(data)
+template <typename T>
+static void EncodeValue(T value, BNEndianness endian, uint8_t* data)
+{
+	for (size_t i = 0; i < sizeof(T); i++)
+		data[i] = (uint8_t)(value >> ((endian == LittleEndian ? i : sizeof(T) - 1 - i) * 8));
+}
+
+
+BinaryWriter::BinaryWriter(BinaryView* data, BNEndianness endian) : m_view(data), m_endian(endian)
 {
 	m_stream = BNCreateBinaryWriter(data->GetObject());
 	BNSetBinaryWriterEndianness(m_stream, endian);
@@ -39,19 +48,117 @@ BinaryWriter::~BinaryWriter()
 
 BNEndianness BinaryWriter::GetEndianness() const
 {
-	return BNGetBinaryWriterEndianness(m_stream);
+	return m_endian;
 }
 
 
 void BinaryWriter::SetEndianness(BNEndianness endian)
 {
+	m_endian = endian;
 	BNSetBinaryWriterEndianness(m_stream, endian);
 }
 
 
+bool BinaryWriter::IsBatching() const
+{
+	return m_batching;
+}
+
+
+void BinaryWriter::BeginBatch()
+{
+	if (m_batching)
+		return;
+	m_position = BNGetWriterPosition(m_stream);
+	m_batching = true;
+}
+
+
+void BinaryWriter::CommitBatch()
+{
+	if (!m_batching)
+		return;
+	map<uint64_t, vector<uint8_t>> batch = std::move(m_batch);
+	DiscardBatch();
+	if (batch.empty())
+		return;
+
+	// Every run is one write, so analysis is only invalidated once for each range that was touched
+	string undo = m_view->BeginUndoActions();
+	for (auto& [start, data] : batch)
+	{
+		if (m_view->Write(start, data.data(), data.size()) != data.size())
+		{
+			m_view->RevertUndoActions(undo);
+			throw WriteException();
+		}
+	}
+	m_view->CommitUndoActions(undo);
+}
+
+
+void BinaryWriter::DiscardBatch()
+{
+	if (!m_batching)
+		return;
+	BNSeekBinaryWriter(m_stream, m_position);
+	m_batch.clear();
+	m_batching = false;
+}
+
+
+bool BinaryWriter::BatchWrite(const void* src, size_t len)
+{
+	uint64_t start = m_position;
+	m_position += len;
+	if (len == 0)
+		return true;
+
+	// Find the first run that overlaps or touches the new bytes and take it out to extend
+	auto next = m_batch.lower_bound(start);
+	if (next != m_batch.begin() && std::prev(next)->first + std::prev(next)->second.size() >= start)
+		--next;
+	uint64_t runStart = start;
+	vector<uint8_t> run;
+	if (next != m_batch.end() && next->first <= start)
+	{
+		runStart = next->first;
+		run = std::move(next->second);
+		next = m_batch.erase(next);
+	}
+
+	size_t offset = start - runStart;
+	if (run.size() < offset + len)
+		run.resize(offset + len);
+	memcpy(run.data() + offset, src, len);
+
+	// Absorb the runs that are now covered or adjacent, keeping whatever extends past the end
+	uint64_t runEnd = runStart + run.size();
+	while (next != m_batch.end() && next->first <= runEnd)
+	{
+		uint64_t nextEnd = next->first + next->second.size();
+		if (nextEnd > runEnd)
+			run.insert(run.end(), next->second.end() - (nextEnd - runEnd), next->second.end());
+		runEnd = runStart + run.size();
+		next = m_batch.erase(next);
+	}
+	m_batch.emplace_hint(next, runStart, std::move(run));
+	return true;
+}
+
+
+template <typename T>
+bool BinaryWriter::BatchWriteValue(T val, BNEndianness endian)
+{
+	uint8_t data[sizeof(T)];
+	EncodeValue(val, endian, data);
+	return BatchWrite(data, sizeof(T));
+}
+
+
 void BinaryWriter::Write(const void* src, size_t len)
 {
-	if (!BNWriteData(m_stream, src, len))
+	if (!TryWrite(src, len))
 		throw WriteException();
 }
 
@@ -70,76 +177,78 @@ void BinaryWriter::Write(const string& str)
 
 void BinaryWriter::Write8(uint8_t val)
 {
-	if (!BNWrite8(m_stream, val))
+	if (!TryWrite8(val))
 		throw WriteException();
 }
 
 
 void BinaryWriter::Write16(uint16_t val)
 {
-	if (!BNWrite16(m_stream, val))
+	if (!TryWrite16(val))
 		throw WriteException();
 }
 
 
 void BinaryWriter::Write32(uint32_t val)
 {
-	if (!BNWrite32(m_stream, val))
+	if (!TryWrite32(val))
 		throw WriteException();
 }
 
 
 void BinaryWriter::Write64(uint64_t val)
 {
-	if (!BNWrite64(m_stream, val))
+	if (!TryWrite64(val))
 		throw WriteException();
 }
 
 
 void BinaryWriter::WriteLE16(uint16_t val)
 {
-	if (!BNWriteLE16(m_stream, val))
+	if (!TryWriteLE16(val))
 		throw WriteException();
 }
 
 
 void BinaryWriter::WriteLE32(uint32_t val)
 {
-	if (!BNWriteLE32(m_stream, val))
+	if (!TryWriteLE32(val))
 		throw WriteException();
 }
 
 
 void BinaryWriter::WriteLE64(uint64_t val)
 {
-	if (!BNWriteLE64(m_stream, val))
+	if (!TryWriteLE64(val))
 		throw WriteException();
 }
 
 
 void BinaryWriter::WriteBE16(uint16_t val)
 {
-	if (!BNWriteBE16(m_stream, val))
+	if (!TryWriteBE16(val))
 		throw WriteException();
 }
 
 
 void BinaryWriter::WriteBE32(uint32_t val)
 {
-	if (!BNWriteBE32(m_stream, val))
+	if (!TryWriteBE32(val))
 		throw WriteException();
 }
 
 
 void BinaryWriter::WriteBE64(uint64_t val)
 {
-	if (!BNWriteBE64(m_stream, val))
+	if (!TryWriteBE64(val))
 		throw WriteException();
 }
 
 
 bool BinaryWriter::TryWrite(const void* src, size_t len)
 {
+	if (m_batching)
+		return BatchWrite(src, len);
 	return BNWriteData(m_stream, src, len);
 }
 
@@ -158,77 +267,105 @@ bool BinaryWriter::TryWrite(const string& str)
 
 bool BinaryWriter::TryWrite8(uint8_t val)
 {
+	if (m_batching)
+		return BatchWriteValue(val, m_endian);
 	return BNWrite8(m_stream, val);
 }
 
 
 bool BinaryWriter::TryWrite16(uint16_t val)
 {
+	if (m_batching)
+		return BatchWriteValue(val, m_endian);
 	return BNWrite16(m_stream, val);
 }
 
 
 bool BinaryWriter::TryWrite32(uint32_t val)
 {
+	if (m_batching)
+		return BatchWriteValue(val, m_endian);
 	return BNWrite32(m_stream, val);
 }
 
 
 bool BinaryWriter::TryWrite64(uint64_t val)
 {
+	if (m_batching)
+		return BatchWriteValue(val, m_endian);
 	return BNWrite64(m_stream, val);
 }
 
 
 bool BinaryWriter::TryWriteLE16(uint16_t val)
 {
+	if (m_batching)
+		return BatchWriteValue(val, LittleEndian);
 	return BNWriteLE16(m_stream, val);
 }
 
 
 bool BinaryWriter::TryWriteLE32(uint32_t val)
 {
+	if (m_batching)
+		return BatchWriteValue(val, LittleEndian);
 	return BNWriteLE32(m_stream, val);
 }
 
 
 bool BinaryWriter::TryWriteLE64(uint64_t val)
 {
+	if (m_batching)
+		return BatchWriteValue(val, LittleEndian);
 	return BNWriteLE64(m_stream, val);
 }
 
 
 bool BinaryWriter::TryWriteBE16(uint16_t val)
 {
+	if (m_batching)
+		return BatchWriteValue(val, BigEndian);
 	return BNWriteBE16(m_stream, val);
 }
 
 
 bool BinaryWriter::TryWriteBE32(uint32_t val)
 {
+	if (m_batching)
+		return BatchWriteValue(val, BigEndian);
 	return BNWriteBE32(m_stream, val);
 }
 
 
 bool BinaryWriter::TryWriteBE64(uint64_t val)
 {
+	if (m_batching)
+		return BatchWriteValue(val, BigEndian);
 	return BNWriteBE64(m_stream, val);
 }
 
 
 uint64_t BinaryWriter::GetOffset() const
 {
+	if (m_batching)
+		return m_position;
 	return BNGetWriterPosition(m_stream);
 }
 
 
 void BinaryWriter::Seek(uint64_t offset)
 {
-	BNSeekBinaryWriter(m_stream, offset);
+	if (m_batching)
+		m_position = offset;
+	else
+		BNSeekBinaryWriter(m_stream, offset);
 }
 
 
 void BinaryWriter::SeekRelative(int64_t offset)
 {
-	BNSeekBinaryWriterRelative(m_stream, offset);
+	if (m_batching)
+		m_position += offset;
+	else
+		BNSeekBinaryWriterRelative(m_stream, offset);
 }
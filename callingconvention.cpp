@@ -23,6 +23,32 @@
 using namespace std;
 using namespace BinaryNinja;
 
+// Registers at or above this are rare enough (temporaries and the like) that a search of the list is fine for them
+static constexpr uint32_t RegisterSetMaskLimit = 4096;
+
+
+RegisterSet::RegisterSet(vector<uint32_t> registers) : m_registers(std::move(registers))
+{
+	for (uint32_t reg : m_registers)
+	{
+		if (reg >= RegisterSetMaskLimit)
+			continue;
+		if ((reg / 64) >= m_mask.size())
+			m_mask.resize((reg / 64) + 1, 0);
+		m_mask[reg / 64] |= 1ull << (reg % 64);
+	}
+}
+
+
+bool RegisterSet::Contains(uint32_t reg) const
+{
+	if (reg >= RegisterSetMaskLimit)
+		return find(m_registers.begin(), m_registers.end(), reg) != m_registers.end();
+	if ((reg / 64) >= m_mask.size())
+		return false;
+	return (m_mask[reg / 64] >> (reg % 64)) & 1;
+}
+
 
 CallingConvention::CallingConvention(BNCallingConvention* cc)
 {
@@ -504,3 +530,45 @@ Variable CoreCallingConvention::GetParameterVariableForIncomingVariable(const Va
 {
 	return BNGetParameterVariableForIncomingVariable(m_object, &var, func ? func->GetObject() : nullptr);
 }
+
+
+std::shared_ptr<const CallingConventionInfo> CallingConvention::GetCachedInfo()
+{
+	// The entry keeps a reference to the calling convention so its handle can't be reused by another one
+	struct CacheEntry
+	{
+		Ref<CallingConvention> callingConvention;
+		std::shared_ptr<const CallingConventionInfo> info;
+	};
+	static std::shared_mutex cacheMutex;
+	static unordered_map<BNCallingConvention*, CacheEntry> cache;
+
+	{
+		std::shared_lock<std::shared_mutex> lock(cacheMutex);
+		auto i = cache.find(m_object);
+		if (i != cache.end())
+			return i->second.info;
+	}
+
+	auto info = std::make_shared<CallingConventionInfo>();
+	info->name = GetName();
+	info->callerSavedRegisters = RegisterSet(GetCallerSavedRegisters());
+	info->calleeSavedRegisters = RegisterSet(GetCalleeSavedRegisters());
+	info->integerArgumentRegisters = RegisterSet(GetIntegerArgumentRegisters());
+	info->floatArgumentRegisters = RegisterSet(GetFloatArgumentRegisters());
+	info->implicitlyDefinedRegisters = RegisterSet(GetImplicitlyDefinedRegisters());
+	info->integerReturnValueRegister = GetIntegerReturnValueRegister();
+	info->highIntegerReturnValueRegister = GetHighIntegerReturnValueRegister();
+	info->floatReturnValueRegister = GetFloatReturnValueRegister();
+	info->globalPointerRegister = GetGlobalPointerRegister();
+	info->argumentRegistersSharedIndex = AreArgumentRegistersSharedIndex();
+	info->argumentRegistersUsedForVarArgs = AreArgumentRegistersUsedForVarArgs();
+	info->stackReservedForArgumentRegisters = IsStackReservedForArgumentRegisters();
+	info->stackAdjustedOnReturn = IsStackAdjustedOnReturn();
+	info->eligibleForHeuristics = IsEligibleForHeuristics();
+
+	// Another thread may have filled the entry while this one was querying; keep whichever got there first
+	std::unique_lock<std::shared_mutex> lock(cacheMutex);
+	auto result = cache.try_emplace(m_object, CacheEntry {this, std::move(info)});
+	return result.first->second.info;
+}
@@ -18,6 +18,9 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
 #include "binaryninjaapi.h"
 #include "binaryninjacore.h"
 #include "http.h"
@@ -1832,43 +1835,94 @@ std::vector<uint8_t> RemoteFile::Download(std::function<bool(size_t, size_t)> pr
 }
 
 
-Json::Value RemoteFile::RequestUserPositions()
+bool RemoteFile::DownloadToFile(const std::string& path, std::function<bool(size_t, size_t)> progress)
 {
-	char* value = BNRemoteFileRequestUserPositions(m_object);
-	if (value == nullptr)
-		throw RemoteException("Failed to load user positions");
+	std::string hash = GetHash();
+	std::string hashPath = path + ".remotehash";
+	{
+		std::ifstream existing(path, std::ios::binary | std::ios::ate);
+		std::ifstream recorded(hashPath);
+		std::string recordedHash;
+		if (existing && recorded && std::getline(recorded, recordedHash) && !hash.empty() && recordedHash == hash
+		    && (uint64_t)existing.tellg() == GetSize())
+			return false;
+	}
+
+	ProgressContext pctxt;
+	pctxt.callback = progress;
+	size_t size = 0;
+	uint8_t* data;
+	if (!BNRemoteFileDownload(m_object, ProgressCallback, &pctxt, &data, &size))
+		throw SyncException("Failed to download file");
+
+	// Written straight from the core's buffer, without the copy Download makes
+	std::string partialPath = path + ".part";
+	bool written;
+	{
+		std::ofstream out(partialPath, std::ios::binary | std::ios::trunc);
+		out.write((const char*)data, size);
+		written = out.good();
+	}
+	delete[] data;
+	if (!written)
+	{
+		std::remove(partialPath.c_str());
+		throw SyncException("Failed to write " + partialPath);
+	}
+
+	// Drop the old hash first, so a failed rename can't leave it describing a stale file. The rename replaces
+	// path in one step, so readers see either the old file or the new one, never a missing one.
+	std::remove(hashPath.c_str());
+#ifdef WIN32
+	bool moved = MoveFileExA(partialPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+	std::error_code ec;
+	std::filesystem::rename(partialPath, path, ec);
+	bool moved = !ec;
+#endif
+	if (!moved)
+	{
+		std::remove(partialPath.c_str());
+		throw SyncException("Failed to move " + partialPath + " to " + path);
+	}
+	std::ofstream(hashPath) << hash << "\n";
+	return true;
+}
 
 
+// Parse and free a JSON string returned by the core, reusing one reader per thread
+static Json::Value ParseRemoteJson(char* value)
+{
+	thread_local std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
 	Json::Value json;
-	std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
 	std::string errors;
-	if (!reader->parse(value, value + strlen(value), &json, &errors))
+	bool parsed = reader->parse(value, value + strlen(value), &json, &errors);
+	BNFreeString(value);
+	if (!parsed)
 	{
 		throw RemoteException(errors);
 	}
-
-	BNFreeString(value);
 	return json;
 }
 
 
-Json::Value RemoteFile::RequestChatLog()
+Json::Value RemoteFile::RequestUserPositions()
 {
-	char* value = BNRemoteFileRequestChatLog(m_object);
+	char* value = BNRemoteFileRequestUserPositions(m_object);
 	if (value == nullptr)
 		throw RemoteException("Failed to load user positions");
 
+	return ParseRemoteJson(value);
+}
 
-	Json::Value json;
-	std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
-	std::string errors;
-	if (!reader->parse(value, value + strlen(value), &json, &errors))
-	{
-		throw RemoteException(errors);
-	}
 
-	BNFreeString(value);
-	return json;
+Json::Value RemoteFile::RequestChatLog()
+{
+	char* value = BNRemoteFileRequestChatLog(m_object);
+	if (value == nullptr)
+		throw RemoteException("Failed to load user positions");
+
+	return ParseRemoteJson(value);
 }
 
 
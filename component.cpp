@@ -1,5 +1,6 @@
 
 #include "binaryninjaapi.h"
+#include "ffi.h"
 
 using namespace BinaryNinja;
 using namespace std;
@@ -95,6 +96,46 @@ bool Component::RemoveDataVariable(DataVariable dataVariable)
 }
 
 
+size_t Component::AddFunctions(const std::vector<Ref<Function>>& funcs)
+{
+	UndoBatch batch(GetView()->GetFile());
+	for (auto& func : funcs)
+		if (BNComponentAddFunctionReference(m_object, func->GetObject()))
+			batch.Add();
+	return batch.GetItemCount();
+}
+
+
+size_t Component::RemoveFunctions(const std::vector<Ref<Function>>& funcs)
+{
+	UndoBatch batch(GetView()->GetFile());
+	for (auto& func : funcs)
+		if (BNComponentRemoveFunctionReference(m_object, func->GetObject()))
+			batch.Add();
+	return batch.GetItemCount();
+}
+
+
+size_t Component::AddDataVariables(const std::vector<uint64_t>& addresses)
+{
+	UndoBatch batch(GetView()->GetFile());
+	for (uint64_t addr : addresses)
+		if (BNComponentAddDataVariable(m_object, addr))
+			batch.Add();
+	return batch.GetItemCount();
+}
+
+
+size_t Component::RemoveDataVariables(const std::vector<uint64_t>& addresses)
+{
+	UndoBatch batch(GetView()->GetFile());
+	for (uint64_t addr : addresses)
+		if (BNComponentRemoveDataVariable(m_object, addr))
+			batch.Add();
+	return batch.GetItemCount();
+}
+
+
 std::vector<Ref<Component>> Component::GetContainedComponents()
 {
 	std::vector<Ref<Component>> components;
@@ -194,3 +235,151 @@ std::vector<DataVariable> Component::GetReferencedDataVariables()
 	BNFreeDataVariables(variables, count);
 	return result;
 }
+
+
+struct ComponentMembershipIndex::State
+{
+	mutex membersMutex;
+	bool stale = true;
+	// Counts notifications, so a rebuild can tell whether one arrived while it was walking the tree
+	uint64_t changes = 0;
+	unordered_map<uint64_t, vector<Ref<Component>>> functions;
+	unordered_map<uint64_t, vector<Ref<Component>>> dataVariables;
+};
+
+
+ComponentMembershipIndex::ComponentMembershipIndex(BinaryView* view) :
+    BinaryDataNotification(ComponentUpdates), m_view(view), m_state(make_unique<State>())
+{
+	m_view->RegisterNotification(this);
+}
+
+
+ComponentMembershipIndex::~ComponentMembershipIndex()
+{
+	m_view->UnregisterNotification(this);
+}
+
+
+shared_ptr<ComponentMembershipIndex> ComponentMembershipIndex::GetForView(BinaryView* view)
+{
+	return GetSharedForObject<ComponentMembershipIndex>(view);
+}
+
+
+void ComponentMembershipIndex::Rebuild()
+{
+	uint64_t changes;
+	{
+		lock_guard<mutex> lock(m_state->membersMutex);
+		if (!m_state->stale)
+			return;
+		changes = m_state->changes;
+	}
+
+	// Walked without the lock, as notifications for the view are sent while the core holds its own locks
+	unordered_map<uint64_t, vector<Ref<Component>>> functions;
+	unordered_map<uint64_t, vector<Ref<Component>>> dataVariables;
+	vector<Ref<Component>> pending {m_view->GetRootComponent()};
+	while (!pending.empty())
+	{
+		Ref<Component> component = pending.back();
+		pending.pop_back();
+		for (auto& func : component->GetContainedFunctions())
+			functions[func->GetStart()].push_back(component);
+		for (auto& var : component->GetContainedDataVariables())
+			dataVariables[var.address].push_back(component);
+		for (auto& child : component->GetContainedComponents())
+			pending.push_back(child);
+	}
+
+	lock_guard<mutex> lock(m_state->membersMutex);
+	m_state->functions = std::move(functions);
+	m_state->dataVariables = std::move(dataVariables);
+	// Changes made during the walk may be missing, so only a walk that raced nothing is trusted for later lookups
+	if (m_state->changes == changes)
+		m_state->stale = false;
+}
+
+
+void ComponentMembershipIndex::Update(bool function, uint64_t key, Component* component, bool added)
+{
+	lock_guard<mutex> lock(m_state->membersMutex);
+	m_state->changes++;
+	if (m_state->stale)
+		return;
+
+	auto& members = function ? m_state->functions : m_state->dataVariables;
+	auto& components = members[key];
+	auto i = find_if(components.begin(), components.end(), [&](const Ref<Component>& c) { return *c == *component; });
+	if (added && (i == components.end()))
+		components.push_back(component);
+	else if (!added && (i != components.end()))
+		components.erase(i);
+	if (components.empty())
+		members.erase(key);
+}
+
+
+vector<Ref<Component>> ComponentMembershipIndex::GetComponentsForFunction(Function* func)
+{
+	uint64_t start = func->GetStart();
+	Rebuild();
+	lock_guard<mutex> lock(m_state->membersMutex);
+	auto i = m_state->functions.find(start);
+	if (i == m_state->functions.end())
+		return {};
+	return i->second;
+}
+
+
+vector<Ref<Component>> ComponentMembershipIndex::GetComponentsForDataVariable(uint64_t addr)
+{
+	Rebuild();
+	lock_guard<mutex> lock(m_state->membersMutex);
+	auto i = m_state->dataVariables.find(addr);
+	if (i == m_state->dataVariables.end())
+		return {};
+	return i->second;
+}
+
+
+void ComponentMembershipIndex::OnComponentAdded(BinaryView*, Component*)
+{
+	lock_guard<mutex> lock(m_state->membersMutex);
+	m_state->changes++;
+	m_state->stale = true;
+}
+
+
+void ComponentMembershipIndex::OnComponentRemoved(BinaryView*, Component*, Component*)
+{
+	lock_guard<mutex> lock(m_state->membersMutex);
+	m_state->changes++;
+	m_state->stale = true;
+}
+
+
+void ComponentMembershipIndex::OnComponentFunctionAdded(BinaryView*, Component* component, Function* function)
+{
+	Update(true, function->GetStart(), component, true);
+}
+
+
+void ComponentMembershipIndex::OnComponentFunctionRemoved(BinaryView*, Component* component, Function* function)
+{
+	Update(true, function->GetStart(), component, false);
+}
+
+
+void ComponentMembershipIndex::OnComponentDataVariableAdded(BinaryView*, Component* component, const DataVariable& var)
+{
+	Update(false, var.address, component, true);
+}
+
+
+void ComponentMembershipIndex::OnComponentDataVariableRemoved(
+	BinaryView*, Component* component, const DataVariable& var)
+{
+	Update(false, var.address, component, false);
+}
@@ -17,7 +17,10 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
+#include <array>
 #include <cstring>
+#include <set>
+#include <sstream>
 #include "binaryninjaapi.h"
 
 using namespace BinaryNinja;
@@ -60,6 +63,30 @@ std::vector<std::string> KeyValueStore::GetKeys() const
 }
 
 
+// Building a reader or writer parses its settings, which costs more than reading a typical value, so every
+// thread keeps one of each for the values and globals it reads and writes
+static Json::CharReader& GetJsonReader()
+{
+	thread_local std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
+	return *reader;
+}
+
+
+static string WriteJson(const Json::Value& value)
+{
+	thread_local std::unique_ptr<Json::StreamWriter> writer = []() {
+		Json::StreamWriterBuilder builder;
+		builder["indentation"] = "";
+		return std::unique_ptr<Json::StreamWriter>(builder.newStreamWriter());
+	}();
+	thread_local std::ostringstream out;
+	out.str("");
+	out.clear();
+	writer->write(value, &out);
+	return out.str();
+}
+
+
 bool KeyValueStore::HasValue(const std::string& name) const
 {
 	return BNKeyValueStoreHasValue(m_object, name.c_str());
@@ -75,9 +102,8 @@ Json::Value KeyValueStore::GetValue(const std::string& name) const
 	}
 	DataBuffer value = DataBuffer(bnBuffer);
 	Json::Value json;
-	std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
 	std::string errors;
-	if (!reader->parse(static_cast<const char*>(value.GetData()),
+	if (!GetJsonReader().parse(static_cast<const char*>(value.GetData()),
 	        static_cast<const char*>(value.GetDataAt(value.GetLength())), &json, &errors))
 	{
 		throw DatabaseException(errors);
@@ -110,9 +136,12 @@ DataBuffer KeyValueStore::GetBuffer(const std::string& name) const
 
 void KeyValueStore::SetValue(const std::string& name, const Json::Value& value)
 {
-	Json::StreamWriterBuilder builder;
-	builder["indentation"] = "";
-	string json = Json::writeString(builder, value);
+	SetSerializedValue(name, WriteJson(value));
+}
+
+
+void KeyValueStore::SetSerializedValue(const std::string& name, const std::string& json)
+{
 	if (!BNSetKeyValueStoreValue(m_object, name.c_str(), json.c_str()))
 	{
 		throw DatabaseException("BNSetKeyValueStoreValue");
@@ -129,6 +158,69 @@ void KeyValueStore::SetBuffer(const std::string& name, const DataBuffer& value)
 }
 
 
+// Values written by SetCompressedBuffer start with this marker, a method byte and the uncompressed size
+static const char CompressedValueMagic[8] = {'B', 'N', 'K', 'V', 'Z', 'I', 'P', '1'};
+static const size_t CompressedValueHeaderSize = sizeof(CompressedValueMagic) + 1 + 8;
+enum CompressedValueMethod : uint8_t
+{
+	StoredValue = 0,
+	ZlibValue = 1
+};
+
+// Below this compressing doesn't win enough to be worth the header
+static const size_t MinCompressedValueSize = 256;
+
+
+void KeyValueStore::SetCompressedBuffer(const std::string& name, const DataBuffer& value)
+{
+	DataBuffer compressed;
+	bool useCompressed = value.GetLength() >= MinCompressedValueSize && value.ZlibCompress(compressed)
+		&& compressed.GetLength() + CompressedValueHeaderSize < value.GetLength();
+
+	const DataBuffer& payload = useCompressed ? compressed : value;
+	DataBuffer stored(CompressedValueHeaderSize + payload.GetLength());
+	uint8_t* header = (uint8_t*)stored.GetData();
+	memcpy(header, CompressedValueMagic, sizeof(CompressedValueMagic));
+	header[sizeof(CompressedValueMagic)] = useCompressed ? ZlibValue : StoredValue;
+	uint64_t size = value.GetLength();
+	for (size_t i = 0; i < 8; i++)
+		header[sizeof(CompressedValueMagic) + 1 + i] = (uint8_t)(size >> (i * 8));
+	if (payload.GetLength())
+		memcpy(header + CompressedValueHeaderSize, payload.GetData(), payload.GetLength());
+	SetBuffer(name, stored);
+}
+
+
+DataBuffer KeyValueStore::GetDecompressedBuffer(const std::string& name) const
+{
+	DataBuffer stored = GetBuffer(name);
+	const uint8_t* header = (const uint8_t*)stored.GetData();
+	if (stored.GetLength() < CompressedValueHeaderSize
+		|| memcmp(header, CompressedValueMagic, sizeof(CompressedValueMagic)) != 0)
+		return stored;
+
+	uint64_t size = 0;
+	for (size_t i = 0; i < 8; i++)
+		size |= (uint64_t)header[sizeof(CompressedValueMagic) + 1 + i] << (i * 8);
+	DataBuffer payload = stored.GetSlice(CompressedValueHeaderSize, stored.GetLength() - CompressedValueHeaderSize);
+
+	switch (header[sizeof(CompressedValueMagic)])
+	{
+	case StoredValue:
+		return payload;
+	case ZlibValue:
+	{
+		DataBuffer value;
+		if (!payload.ZlibDecompress(value) || value.GetLength() != size)
+			throw DatabaseException("Failed to decompress value of " + name);
+		return value;
+	}
+	default:
+		throw DatabaseException("Unknown compression of value of " + name);
+	}
+}
+
+
 DataBuffer KeyValueStore::GetSerializedData() const
 {
 	return DataBuffer(BNGetKeyValueStoreSerializedData(m_object));
@@ -481,23 +573,20 @@ Json::Value Database::ReadGlobal(const std::string& key) const
 	}
 
 	Json::Value json;
-	std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
 	std::string errors;
-	if (!reader->parse(value, value + strlen(value), &json, &errors))
+	bool parsed = GetJsonReader().parse(value, value + strlen(value), &json, &errors);
+	BNFreeString(value);
+	if (!parsed)
 	{
 		throw DatabaseException(errors);
 	}
-
-	BNFreeString(value);
 	return json;
 }
 
 
 void Database::WriteGlobal(const std::string& key, const Json::Value& val)
 {
-	Json::StreamWriterBuilder builder;
-	builder["indentation"] = "";
-	string json = Json::writeString(builder, val);
+	string json = WriteJson(val);
 	if (!BNWriteDatabaseGlobal(m_object, key.c_str(), json.c_str()))
 	{
 		throw DatabaseException("BNWriteDatabaseGlobal");
@@ -561,3 +650,333 @@ bool Database::SnapshotHasData(int64_t id)
 {
 	return BNSnapshotHasData(m_object, id);
 }
+
+
+namespace
+{
+	// Content-defined chunking parameters: a boundary is placed where the rolling hash has its low
+	// AverageChunkBits bits clear, but never before MinChunkSize or after MaxChunkSize bytes.
+	constexpr size_t MinChunkSize = 2 * 1024;
+	constexpr size_t MaxChunkSize = 64 * 1024;
+	constexpr size_t AverageChunkBits = 13;
+
+	const char* const ChunkedManifestPrefix = "chunked/manifest/";
+	const char* const ChunkedDataPrefix = "chunked/data/";
+	const char* const ChunkedFreeListKey = "chunked/free";
+
+	// Writers and the compactor must not interleave, or a chunk could be released between being found
+	// and being referenced by a new manifest
+	std::mutex g_chunkedDataMutex;
+
+
+	const uint64_t* GetGearTable()
+	{
+		// Fixed seed: boundaries, and so dedup, must be identical across runs and machines
+		static const auto table = []() {
+			array<uint64_t, 256> result;
+			uint64_t state = 0x2545f4914f6cdd1dull;
+			for (auto& entry : result)
+			{
+				uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+				z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+				z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+				entry = z ^ (z >> 31);
+			}
+			return result;
+		}();
+		return table.data();
+	}
+
+
+	size_t FindChunkEnd(const uint8_t* data, size_t len)
+	{
+		if (len <= MinChunkSize)
+			return len;
+		const uint64_t* gear = GetGearTable();
+		const uint64_t mask = ((1ull << AverageChunkBits) - 1) << (64 - AverageChunkBits);
+		size_t limit = min(len, MaxChunkSize);
+		uint64_t hash = 0;
+		for (size_t i = MinChunkSize; i < limit; i++)
+		{
+			hash = (hash << 1) + gear[data[i]];
+			if ((hash & mask) == 0)
+				return i + 1;
+		}
+		return limit;
+	}
+
+
+	string ToHex(const DataBuffer& buffer)
+	{
+		static const char digits[] = "0123456789abcdef";
+		string result;
+		result.reserve(buffer.GetLength() * 2);
+		const uint8_t* bytes = (const uint8_t*)buffer.GetData();
+		for (size_t i = 0; i < buffer.GetLength(); i++)
+		{
+			result += digits[bytes[i] >> 4];
+			result += digits[bytes[i] & 0xf];
+		}
+		return result;
+	}
+
+
+	string GetManifestKey(int64_t snapshotId, const string& key)
+	{
+		return ChunkedManifestPrefix + to_string(snapshotId) + "/" + key;
+	}
+
+
+	set<string> ReadFreeList(const Database* db)
+	{
+		set<string> result;
+		if (!db->HasGlobal(ChunkedFreeListKey))
+			return result;
+		for (auto& hash : db->ReadGlobal(ChunkedFreeListKey))
+			result.insert(hash.asString());
+		return result;
+	}
+
+
+	void WriteFreeList(Database* db, const set<string>& freeList)
+	{
+		Json::Value value(Json::arrayValue);
+		for (auto& hash : freeList)
+			value.append(hash);
+		db->WriteGlobal(ChunkedFreeListKey, value);
+	}
+}  // namespace
+
+
+uint64_t Database::WriteChunkedData(int64_t snapshotId, const std::string& key, const DataBuffer& data)
+{
+	unique_lock<mutex> lock(g_chunkedDataMutex);
+	set<string> freeList = ReadFreeList(this);
+	bool freeListChanged = false;
+
+	// The core's value hash names each chunk, so identical content maps to one stored chunk
+	Ref<KeyValueStore> hasher = new KeyValueStore();
+	Json::Value manifest(Json::arrayValue);
+	uint64_t written = 0;
+	const uint8_t* bytes = (const uint8_t*)data.GetData();
+	for (size_t offset = 0; offset < data.GetLength();)
+	{
+		size_t len = FindChunkEnd(bytes + offset, data.GetLength() - offset);
+		DataBuffer chunk(bytes + offset, len);
+		hasher->SetBuffer("chunk", chunk);
+		string hash = ToHex(hasher->GetValueHash("chunk")) + "-" + to_string(len);
+		string chunkKey = ChunkedDataPrefix + hash;
+
+		bool released = freeList.count(hash) != 0;
+		if (released || !HasGlobal(chunkKey))
+		{
+			WriteGlobalData(chunkKey, chunk);
+			written += len;
+			if (released)
+			{
+				freeList.erase(hash);
+				freeListChanged = true;
+			}
+		}
+		manifest.append(hash);
+		offset += len;
+	}
+
+	WriteGlobal(GetManifestKey(snapshotId, key), manifest);
+	if (freeListChanged)
+		WriteFreeList(this, freeList);
+	return written;
+}
+
+
+DataBuffer Database::ReadChunkedData(int64_t snapshotId, const std::string& key) const
+{
+	string manifestKey = GetManifestKey(snapshotId, key);
+	if (!HasGlobal(manifestKey))
+		throw DatabaseException("No chunked data for " + key);
+	Json::Value manifest = ReadGlobal(manifestKey);
+	if (!manifest.isArray())
+		throw DatabaseException("No chunked data for " + key);
+
+	DataBuffer result;
+	for (auto& hash : manifest)
+		result.Append(ReadGlobalData(ChunkedDataPrefix + hash.asString()));
+	return result;
+}
+
+
+bool Database::HasChunkedData(int64_t snapshotId, const std::string& key) const
+{
+	string manifestKey = GetManifestKey(snapshotId, key);
+	return HasGlobal(manifestKey) && ReadGlobal(manifestKey).isArray();
+}
+
+
+uint64_t Database::CompactChunkedData()
+{
+	unique_lock<mutex> lock(g_chunkedDataMutex);
+	set<string> freeList = ReadFreeList(this);
+	set<string> live;
+	vector<string> chunkHashes;
+	size_t manifestPrefixLen = strlen(ChunkedManifestPrefix);
+	size_t dataPrefixLen = strlen(ChunkedDataPrefix);
+
+	for (auto& key : GetGlobalKeys())
+	{
+		if (key.compare(0, dataPrefixLen, ChunkedDataPrefix) == 0)
+		{
+			chunkHashes.push_back(key.substr(dataPrefixLen));
+			continue;
+		}
+		if (key.compare(0, manifestPrefixLen, ChunkedManifestPrefix) != 0)
+			continue;
+
+		Json::Value manifest = ReadGlobal(key);
+		if (!manifest.isArray())
+			continue;
+		int64_t snapshotId = strtoll(key.c_str() + manifestPrefixLen, nullptr, 10);
+		if (!GetSnapshot(snapshotId) || !SnapshotHasData(snapshotId))
+		{
+			// Globals can't be deleted, so a dropped manifest is left as null
+			WriteGlobal(key, Json::Value());
+			continue;
+		}
+		for (auto& hash : manifest)
+			live.insert(hash.asString());
+	}
+
+	uint64_t released = 0;
+	for (auto& hash : chunkHashes)
+	{
+		if (live.count(hash) || freeList.count(hash))
+			continue;
+		// Chunk names end in their length, which saves reading them back
+		released += strtoull(hash.c_str() + hash.rfind('-') + 1, nullptr, 10);
+		WriteGlobalData(ChunkedDataPrefix + hash, DataBuffer());
+		freeList.insert(hash);
+	}
+	if (released)
+		WriteFreeList(this, freeList);
+	return released;
+}
+
+
+void Database::CompactChunkedDataInBackground(const std::function<void(uint64_t)>& completion)
+{
+	Ref<Database> self = this;
+	WorkerEnqueue(
+	    [self, completion]() {
+		    uint64_t released = 0;
+		    try
+		    {
+			    released = self->CompactChunkedData();
+		    }
+		    catch (DatabaseException& e)
+		    {
+			    LogError("Chunked data compaction failed: %s", e.what());
+		    }
+		    if (completion)
+			    completion(released);
+	    },
+	    "Database Chunk Compaction");
+}
+
+
+LazyDatabaseStore::LazyDatabaseStore(Ref<Database> database, const std::string& name) :
+    m_database(database), m_prefix("lazy/" + name + "/")
+{
+	// Only the index is read here; values wait for Get
+	if (!m_database->HasGlobal(GetIndexKey()))
+		return;
+	for (auto& key : m_database->ReadGlobal(GetIndexKey()))
+		m_keys.insert(key.asString());
+}
+
+
+string LazyDatabaseStore::GetIndexKey() const
+{
+	return m_prefix + "index";
+}
+
+
+string LazyDatabaseStore::GetFunctionKey(Function* func)
+{
+	return fmt::format("{}:{:x}", func->GetArchitecture()->GetName(), func->GetStart());
+}
+
+
+vector<string> LazyDatabaseStore::GetKeys() const
+{
+	unique_lock<mutex> lock(m_mutex);
+	return vector<string>(m_keys.begin(), m_keys.end());
+}
+
+
+bool LazyDatabaseStore::Has(const std::string& key) const
+{
+	unique_lock<mutex> lock(m_mutex);
+	return m_keys.count(key) != 0;
+}
+
+
+optional<DataBuffer> LazyDatabaseStore::Get(const std::string& key)
+{
+	unique_lock<mutex> lock(m_mutex);
+	if (m_keys.count(key) == 0)
+		return nullopt;
+	auto i = m_loaded.find(key);
+	if (i != m_loaded.end())
+		return i->second;
+	DataBuffer value = m_database->ReadGlobalData(m_prefix + "data/" + key);
+	m_loaded[key] = value;
+	return value;
+}
+
+
+void LazyDatabaseStore::Set(const std::string& key, const DataBuffer& value)
+{
+	unique_lock<mutex> lock(m_mutex);
+	m_indexDirty |= m_keys.insert(key).second;
+	m_loaded[key] = value;
+	m_dirty.insert(key);
+}
+
+
+void LazyDatabaseStore::Remove(const std::string& key)
+{
+	unique_lock<mutex> lock(m_mutex);
+	if (m_keys.erase(key) == 0)
+		return;
+	m_indexDirty = true;
+	m_loaded.erase(key);
+	m_dirty.insert(key);
+}
+
+
+void LazyDatabaseStore::Flush()
+{
+	unique_lock<mutex> lock(m_mutex);
+	for (auto& key : m_dirty)
+	{
+		// Removed values are emptied; globals can't be deleted
+		auto value = m_loaded.find(key);
+		m_database->WriteGlobalData(m_prefix + "data/" + key, value != m_loaded.end() ? value->second : DataBuffer());
+	}
+	m_dirty.clear();
+
+	if (m_indexDirty)
+	{
+		Json::Value index(Json::arrayValue);
+		for (auto& key : m_keys)
+			index.append(key);
+		m_database->WriteGlobal(GetIndexKey(), index);
+		m_indexDirty = false;
+	}
+}
+
+
+size_t LazyDatabaseStore::GetLoadedCount() const
+{
+	unique_lock<mutex> lock(m_mutex);
+	return m_loaded.size();
+}
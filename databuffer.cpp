@@ -270,6 +270,27 @@ bool DataBuffer::XzDecompress(DataBuffer& output) const
 }
 
 
+ViewBuffer::ViewBuffer(DataBuffer&& buffer)
+{
+	auto storage = make_shared<const DataBuffer>(std::move(buffer));
+	m_data = (const uint8_t*)storage->GetData();
+	m_length = storage->GetLength();
+	m_storage = std::move(storage);
+}
+
+
+ViewBuffer ViewBuffer::Slice(size_t offset, size_t len) const
+{
+	ViewBuffer result;
+	if (offset > m_length)
+		return result;
+	result.m_storage = m_storage;
+	result.m_data = m_data + offset;
+	result.m_length = min(len, m_length - offset);
+	return result;
+}
+
+
 string BinaryNinja::EscapeString(const string& s)
 {
 	DataBuffer buffer(s.c_str(), s.size());
@@ -37,10 +37,49 @@ bool DataRenderer::IsStructOfTypeName(Type* type, const string& name, vector<pai
 }
 
 
+void DataRenderer::AddHandledTypeClass(BNTypeClass typeClass)
+{
+	m_handledTypeClasses.insert(typeClass);
+}
+
+
+void DataRenderer::AddHandledStructName(const QualifiedName& name)
+{
+	m_handledStructNames.insert(name);
+}
+
+
+bool DataRenderer::MightHandle(BNType* type, BNTypeContext* typeCtx, size_t ctxCount) const
+{
+	if (m_handledTypeClasses.empty() && m_handledStructNames.empty())
+		return true;
+
+	// Checked on the core handles, before the wrappers IsValidForData takes are made
+	BNTypeClass typeClass = BNGetTypeClass(type);
+	if (m_handledTypeClasses.count(typeClass))
+		return true;
+	if (m_handledStructNames.empty() || (typeClass != StructureTypeClass) || (ctxCount == 0))
+		return false;
+	BNType* parent = typeCtx[ctxCount - 1].type;
+	if (BNGetTypeClass(parent) != NamedTypeReferenceClass)
+		return false;
+	BNNamedTypeReference* ntr = BNGetTypeNamedTypeReference(parent);
+	if (!ntr)
+		return false;
+	BNQualifiedName name = BNGetTypeReferenceName(ntr);
+	bool result = m_handledStructNames.count(QualifiedName::FromAPIObject(&name)) != 0;
+	BNFreeQualifiedName(&name);
+	BNFreeNamedTypeReference(ntr);
+	return result;
+}
+
+
 bool DataRenderer::IsValidForDataCallback(
     void* ctxt, BNBinaryView* view, uint64_t addr, BNType* type, BNTypeContext* typeCtx, size_t ctxCount)
 {
 	CallbackRef<DataRenderer> renderer(ctxt);
+	if (!renderer->MightHandle(type, typeCtx, ctxCount))
+		return false;
 	Ref<BinaryView> viewObj = new BinaryView(BNNewViewReference(view));
 	Ref<Type> typeObj = new Type(BNNewTypeReference(type));
 	vector<pair<Type*, size_t>> context;
@@ -22,6 +22,10 @@
 // TODO : Documentation
 
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
 #include "binaryninjaapi.h"
 using namespace BinaryNinja;
 using namespace std;
@@ -280,6 +284,67 @@ bool DebugInfo::RemoveFunctionByIndex(const string& parserName, const size_t ind
 }
 
 
+void DebugInfo::ResolveConflicts(const vector<Ref<DebugInfo>>& debugInfos)
+{
+	// Functions and data variables are independent, so each kind is collected on its own thread. Only reads
+	// happen there, the removals are made afterwards.
+	vector<tuple<Ref<DebugInfo>, string, size_t>> functionRemovals;
+	auto collectFunctions = [&]() {
+		unordered_set<uint64_t> seen;
+		for (auto& info : debugInfos)
+		{
+			if (!info)
+				continue;
+			vector<uint64_t> added;
+			for (auto& parser : info->GetParsers())
+			{
+				vector<DebugFunctionInfo> functions = info->GetFunctions(parser);
+				// Collected from the back so removing in order keeps the indices of the remaining ones valid
+				for (size_t i = functions.size(); i-- > 0;)
+				{
+					if (seen.count(functions[i].address))
+						functionRemovals.emplace_back(info, parser, i);
+					else
+						added.push_back(functions[i].address);
+				}
+			}
+			seen.insert(added.begin(), added.end());
+		}
+	};
+
+	vector<tuple<Ref<DebugInfo>, string, uint64_t>> dataVariableRemovals;
+	auto collectDataVariables = [&]() {
+		unordered_set<uint64_t> seen;
+		for (auto& info : debugInfos)
+		{
+			if (!info)
+				continue;
+			vector<uint64_t> added;
+			for (auto& parser : info->GetParsers())
+			{
+				for (auto& var : info->GetDataVariables(parser))
+				{
+					if (seen.count(var.address))
+						dataVariableRemovals.emplace_back(info, parser, var.address);
+					else
+						added.push_back(var.address);
+				}
+			}
+			seen.insert(added.begin(), added.end());
+		}
+	};
+
+	thread functions(collectFunctions);
+	collectDataVariables();
+	functions.join();
+
+	for (auto& [info, parser, index] : functionRemovals)
+		info->RemoveFunctionByIndex(parser, index);
+	for (auto& [info, parser, address] : dataVariableRemovals)
+		info->RemoveDataVariableByAddress(parser, address);
+}
+
+
 bool DebugInfo::RemoveDataVariableByAddress(const string& parserName, const uint64_t address)
 {
 	return BNRemoveDebugDataVariableByAddress(m_object, parserName.c_str(), address);
@@ -435,6 +500,46 @@ Ref<DebugInfo> DebugInfoParser::Parse(Ref<BinaryView> view, Ref<BinaryView> debu
 }
 
 
+vector<Ref<DebugInfo>> DebugInfoParser::ParseConcurrently(Ref<BinaryView> view, Ref<BinaryView> debugView,
+	const vector<Ref<DebugInfoParser>>& parsers, std::function<bool(size_t, size_t)> progress)
+{
+	vector<Ref<DebugInfo>> results(parsers.size());
+	vector<pair<size_t, size_t>> parserProgress(parsers.size(), {0, 0});
+	mutex progressMutex;
+	atomic<bool> cancelled = false;
+
+	auto parseOne = [&](size_t i) {
+		results[i] = parsers[i]->Parse(view, debugView, nullptr, [&, i](size_t current, size_t total) {
+			if (cancelled)
+				return false;
+			if (!progress)
+				return true;
+
+			unique_lock<mutex> lock(progressMutex);
+			parserProgress[i] = {current, total};
+			size_t combinedCurrent = 0, combinedTotal = 0;
+			for (auto& entry : parserProgress)
+			{
+				combinedCurrent += entry.first;
+				combinedTotal += entry.second;
+			}
+			if (!progress(combinedCurrent, combinedTotal))
+				cancelled = true;
+			return !cancelled;
+		});
+	};
+
+	vector<thread> threads;
+	for (size_t i = 1; i < parsers.size(); i++)
+		threads.emplace_back(parseOne, i);
+	if (!parsers.empty())
+		parseOne(0);
+	for (auto& t : threads)
+		t.join();
+	return results;
+}
+
+
 bool DebugInfoParser::IsValidForView(const Ref<BinaryView> view) const
 {
 	return BNIsDebugInfoParserValidForView(m_object, view->GetObject());
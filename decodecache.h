@@ -0,0 +1,156 @@
+// Copyright (c) 2015-2024 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+namespace BinaryNinja
+{
+	/*! Per-thread, direct-mapped cache of decoded instructions for architecture plugins.
+
+		The core asks an architecture for the info, text and IL of the same instruction separately, and each of
+		those decodes it again. Routing the decoder through Lookup lets the later requests copy the earlier
+		result instead.
+
+		An entry is keyed by the architecture object, the address, a caller-defined context word (for decoder
+		flags that can change) and the first \c MaxBytes bytes of input along with the usable length.
+		Everything the decoder reads must be part of that key. \c Instruction must be trivially copyable.
+
+		\ingroup architecture
+	*/
+	template <typename Instruction, size_t MaxBytes, size_t EntryCount = 2048>
+	class DecodeCache
+	{
+		static_assert((EntryCount & (EntryCount - 1)) == 0, "EntryCount must be a power of two");
+
+		struct Entry
+		{
+			const void* owner;
+			uint64_t address;
+			uint64_t context;
+			uint8_t length;
+			bool valid;
+			bool decoded;
+			uint8_t bytes[MaxBytes];
+			Instruction instr;
+		};
+
+		struct ThreadState
+		{
+			Entry entries[EntryCount];
+			uint64_t hits = 0;
+			uint64_t lookups = 0;
+		};
+
+		// Thread-local counts are published in batches so lookups don't contend on the shared counters
+		static constexpr uint64_t StatsFlushInterval = 0x10000;
+
+		static std::atomic<uint64_t>& TotalHits()
+		{
+			static std::atomic<uint64_t> hits {0};
+			return hits;
+		}
+
+		static std::atomic<uint64_t>& TotalLookups()
+		{
+			static std::atomic<uint64_t> lookups {0};
+			return lookups;
+		}
+
+		static ThreadState& GetThreadState()
+		{
+			thread_local std::unique_ptr<ThreadState> state;
+			if (!state)
+			{
+				state = std::make_unique<ThreadState>();
+				memset(state->entries, 0, sizeof(state->entries));
+			}
+			return *state;
+		}
+
+	  public:
+		/*! Return the cached decode of \c data at \c address, or call \c decode(result) and cache its outcome.
+
+			\param owner Architecture doing the decode
+			\param address Address of the instruction
+			\param context Any other decoder input that isn't implied by \c owner, or 0
+			\param data Instruction bytes
+			\param len Number of bytes available at \c data; only the first \c MaxBytes are considered
+			\param result Decoded instruction
+			\param decode Callable that decodes into its argument and returns whether decoding succeeded
+			\return The value \c decode returned for these inputs
+		*/
+		template <typename Decode>
+		static bool Lookup(const void* owner, uint64_t address, uint64_t context, const uint8_t* data, size_t len,
+		    Instruction& result, Decode&& decode)
+		{
+			len = std::min(len, MaxBytes);
+			uint64_t leading = 0;
+			memcpy(&leading, data, std::min(len, sizeof(leading)));
+
+			uint64_t slot = address ^ (address >> 13) ^ ((uintptr_t)owner >> 4) ^ context;
+			slot ^= leading * 0x9e3779b97f4a7c15;
+			slot ^= slot >> 29;
+
+			ThreadState& state = GetThreadState();
+			Entry& entry = state.entries[(slot ^ (address >> 2)) & (EntryCount - 1)];
+			if (++state.lookups == StatsFlushInterval)
+			{
+				TotalLookups() += state.lookups;
+				TotalHits() += state.hits;
+				state.lookups = 0;
+				state.hits = 0;
+			}
+
+			if (entry.valid && entry.owner == owner && entry.address == address && entry.context == context
+			    && entry.length == len && memcmp(entry.bytes, data, len) == 0)
+			{
+				state.hits++;
+				memcpy(&result, &entry.instr, sizeof(Instruction));
+				return entry.decoded;
+			}
+
+			bool decoded = decode(result);
+			entry.owner = owner;
+			entry.address = address;
+			entry.context = context;
+			entry.length = (uint8_t)len;
+			memcpy(entry.bytes, data, len);
+			memcpy(&entry.instr, &result, sizeof(Instruction));
+			entry.decoded = decoded;
+			entry.valid = true;
+			return decoded;
+		}
+
+		/*! Lookup and hit counts across all threads, for tuning.
+			Each thread's most recent lookups (fewer than 65536) are not included yet.
+		*/
+		static void GetStats(uint64_t& hits, uint64_t& lookups)
+		{
+			hits = TotalHits();
+			lookups = TotalLookups();
+		}
+	};
+}  // namespace BinaryNinja
@@ -1,8 +1,94 @@
 #include "binaryninjaapi.h"
+#include <list>
 #include <string>
+#include <thread>
 using namespace std;
 using namespace BinaryNinja;
 
+namespace
+{
+	struct DemangleCacheKey
+	{
+		BNArchitecture* arch;
+		bool simplify;
+		string name;
+
+		bool operator==(const DemangleCacheKey& other) const
+		{
+			return arch == other.arch && simplify == other.simplify && name == other.name;
+		}
+	};
+
+	struct DemangleCacheKeyHash
+	{
+		size_t operator()(const DemangleCacheKey& key) const
+		{
+			return hash<string>()(key.name) ^ (hash<void*>()(key.arch) * 31) ^ key.simplify;
+		}
+	};
+
+	// Bounded LRU of DemangleBatch results, split into independently locked shards so batch threads
+	// don't all wait on one mutex
+	class DemangleResultCache
+	{
+		static constexpr size_t ShardCount = 16;
+		static constexpr size_t ShardCapacity = 0x1000;
+
+		struct Shard
+		{
+			mutex lock;
+			list<pair<DemangleCacheKey, Demangler::BatchResult>> entries;
+			unordered_map<DemangleCacheKey, decltype(entries)::iterator, DemangleCacheKeyHash> index;
+		};
+		Shard m_shards[ShardCount];
+
+		Shard& GetShard(const DemangleCacheKey& key)
+		{
+			return m_shards[(DemangleCacheKeyHash()(key) >> 7) % ShardCount];
+		}
+
+	public:
+		bool Get(const DemangleCacheKey& key, Demangler::BatchResult& result)
+		{
+			Shard& shard = GetShard(key);
+			unique_lock<mutex> lock(shard.lock);
+			auto i = shard.index.find(key);
+			if (i == shard.index.end())
+				return false;
+			shard.entries.splice(shard.entries.begin(), shard.entries, i->second);
+			result = i->second->second;
+			return true;
+		}
+
+		void Put(DemangleCacheKey key, const Demangler::BatchResult& result)
+		{
+			Shard& shard = GetShard(key);
+			unique_lock<mutex> lock(shard.lock);
+			auto i = shard.index.find(key);
+			if (i != shard.index.end())
+			{
+				i->second->second = result;
+				shard.entries.splice(shard.entries.begin(), shard.entries, i->second);
+				return;
+			}
+			shard.entries.emplace_front(std::move(key), result);
+			shard.index.emplace(shard.entries.front().first, shard.entries.begin());
+			if (shard.entries.size() > ShardCapacity)
+			{
+				shard.index.erase(shard.entries.back().first);
+				shard.entries.pop_back();
+			}
+		}
+	};
+
+	DemangleResultCache& GetDemangleResultCache()
+	{
+		// Never destroyed: releasing the cached types at exit could run after the core has shut down
+		static DemangleResultCache* cache = new DemangleResultCache();
+		return *cache;
+	}
+}
+
 namespace BinaryNinja {
 	bool DemangleGeneric(Ref<Architecture> arch, const std::string& name, Ref<Type>& outType,
 		QualifiedName& outVarName, Ref<BinaryView> view, bool simplify)
@@ -171,6 +257,13 @@ namespace BinaryNinja {
 		return true;
 	}
 
+	bool Demangler::DemangleName(
+		Ref<Architecture> arch, const std::string& name, QualifiedName& outVarName, Ref<BinaryView> view)
+	{
+		Ref<Type> type;
+		return Demangle(arch, name, type, outVarName, view);
+	}
+
 	void Demangler::FreeVarNameCallback(void* ctxt, BNQualifiedName* name)
 	{
 		QualifiedName::FreeAPIObject(name);
@@ -210,6 +303,48 @@ namespace BinaryNinja {
 		BNPromoteDemangler(demangler->m_object);
 	}
 
+	void Demangler::DemangleBatch(Ref<Architecture> arch, const vector<string>& names, vector<BatchResult>& results,
+		size_t threads, Ref<BinaryView> view, bool simplify)
+	{
+		// Below this many names per thread, starting a thread costs more than it saves
+		static constexpr size_t MinNamesPerThread = 256;
+		static constexpr size_t ChunkSize = 64;
+
+		results.clear();
+		results.resize(names.size());
+		if (names.empty())
+			return;
+
+		DemangleResultCache& cache = GetDemangleResultCache();
+		atomic<size_t> next {0};
+		auto work = [&]() {
+			for (size_t start = next.fetch_add(ChunkSize); start < names.size(); start = next.fetch_add(ChunkSize))
+			{
+				size_t end = min(start + ChunkSize, names.size());
+				for (size_t i = start; i < end; i++)
+				{
+					DemangleCacheKey key {arch->GetObject(), simplify, names[i]};
+					BatchResult& result = results[i];
+					if (cache.Get(key, result))
+						continue;
+					result.success = DemangleGeneric(arch, names[i], result.type, result.name, view, simplify);
+					cache.Put(std::move(key), result);
+				}
+			}
+		};
+
+		if (threads == 0)
+			threads = max<size_t>(thread::hardware_concurrency(), 1);
+		threads = min(threads, (names.size() + MinNamesPerThread - 1) / MinNamesPerThread);
+
+		vector<thread> workers;
+		for (size_t i = 1; i < threads; i++)
+			workers.emplace_back(work);
+		work();
+		for (auto& worker : workers)
+			worker.join();
+	}
+
 	std::string Demangler::GetName() const
 	{
 		char* name = BNGetDemanglerName(m_object);
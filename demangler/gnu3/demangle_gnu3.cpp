@@ -49,8 +49,8 @@ void MyLogDebug(string fmt, ...)
 #else
 #define indent()
 #define dedent()
-void MyLogDebug(string fmt, ...)
-{ (void)fmt; }
+// A macro rather than an empty function so the GetRaw() copies in the arguments aren't made
+#define MyLogDebug(...) do {} while (0)
 #endif
 
 static inline void rtrim(string &s)
@@ -110,19 +110,19 @@ static TypeBuilder CreateUnknownType(const string& s)
 	return TypeBuilder::NamedType(NamedTypeReference::GenerateAutoDemangledTypeReference(UnknownNamedTypeClass, {s}));
 }
 
-DemangleGNU3::Reader::Reader(const string& data): m_data(data), m_offset(0)
+DemangleGNU3::Reader::Reader(std::string_view data): m_data(data), m_offset(0)
 {}
 
 
-string DemangleGNU3::Reader::PeekString(size_t count)
+std::string_view DemangleGNU3::Reader::PeekString(size_t count) const
 {
 	if (count > Length())
-		return "\0";
+		return std::string_view();
 	return m_data.substr(m_offset, count);
 }
 
 
-char DemangleGNU3::Reader::Peek()
+char DemangleGNU3::Reader::Peek() const
 {
 	if (1 > Length())
 		return '\0';
@@ -130,7 +130,7 @@ char DemangleGNU3::Reader::Peek()
 }
 
 
-bool DemangleGNU3::Reader::NextIsOneOf(const string& list)
+bool DemangleGNU3::Reader::NextIsOneOf(std::string_view list) const
 {
 	char elm = Peek();
 	for (auto a : list)
@@ -142,9 +142,9 @@ bool DemangleGNU3::Reader::NextIsOneOf(const string& list)
 }
 
 
-string DemangleGNU3::Reader::GetRaw()
+string DemangleGNU3::Reader::GetRaw() const
 {
-	return m_data.substr(m_offset);
+	return string(m_data.substr(m_offset));
 }
 
 
@@ -156,23 +156,23 @@ char DemangleGNU3::Reader::Read()
 }
 
 
-string DemangleGNU3::Reader::ReadString(size_t count)
+std::string_view DemangleGNU3::Reader::ReadString(size_t count)
 {
 	if (count > Length())
 		throw DemangleException();
 
-	const string out = m_data.substr(m_offset, count);
+	const std::string_view out = m_data.substr(m_offset, count);
 	m_offset += count;
 	return out;
 }
 
 
-string DemangleGNU3::Reader::ReadUntil(char sentinal)
+std::string_view DemangleGNU3::Reader::ReadUntil(char sentinal)
 {
-	size_t pos = m_data.find_first_of(sentinal, m_offset);
-	if (pos == string::npos)
+	size_t pos = m_data.find(sentinal, m_offset);
+	if (pos == std::string_view::npos)
 		throw DemangleException();
-	return ReadString(pos);
+	return ReadString(pos - m_offset);
 }
 
 
@@ -197,21 +197,45 @@ size_t DemangleGNU3::Reader::Length() const
 }
 
 
-DemangleGNU3::DemangleGNU3(Architecture* arch, const string& mangledName) :
+DemangleGNU3::DemangleGNU3(Architecture* arch, const string& mangledName, bool nameOnly) :
 	m_reader(mangledName),
 	m_arch(arch),
 	m_isParameter(false),
 	m_shouldDeleteReader(true),
 	m_topLevel(true),
-	m_isOperatorOverload(false)
+	m_isOperatorOverload(false),
+	m_nameOnly(nameOnly)
 {
 	MyLogDebug("%s : %s\n", __FUNCTION__, m_reader.GetRaw().c_str());
 }
 
 
+size_t DemangleGNU3::AddSubstitution(TypeBuilder type)
+{
+	m_substitutionArena.push_back({QualifiedName(), std::make_unique<TypeBuilder>(std::move(type))});
+	return m_substitutionArena.size() - 1;
+}
+
+
+size_t DemangleGNU3::AddSubstitution(const QualifiedName& name)
+{
+	m_substitutionArena.push_back({name, nullptr});
+	return m_substitutionArena.size() - 1;
+}
+
+
+const TypeBuilder& DemangleGNU3::GetSubstitution(size_t index)
+{
+	Substitution& entry = m_substitutionArena[index];
+	if (!entry.type)
+		entry.type = std::make_unique<TypeBuilder>(CreateUnknownType(entry.name));
+	return *entry.type;
+}
+
+
 void DemangleGNU3::PushTemplateType(TypeBuilder type)
 {
-	m_templateSubstitute.push_back(type);
+	m_templateSubstitute.push_back(AddSubstitution(std::move(type)));
 }
 
 
@@ -222,13 +246,19 @@ const TypeBuilder& DemangleGNU3::GetTemplateType(size_t ref)
 		// PrintTables();
 		throw DemangleException();
 	}
-	return m_templateSubstitute[ref];
+	return GetSubstitution(m_templateSubstitute[ref]);
 }
 
 
 void DemangleGNU3::PushType(TypeBuilder type)
 {
-	m_substitute.push_back(type);
+	m_substitute.push_back(AddSubstitution(std::move(type)));
+}
+
+
+void DemangleGNU3::PushUnknownType(const QualifiedName& name)
+{
+	m_substitute.push_back(AddSubstitution(name));
 }
 
 
@@ -239,7 +269,7 @@ const TypeBuilder& DemangleGNU3::GetType(size_t ref)
 		// PrintTables();
 		throw DemangleException();
 	}
-	return m_substitute[ref];
+	return GetSubstitution(m_substitute[ref]);
 }
 
 
@@ -277,7 +307,7 @@ void DemangleGNU3::DemangleCVQualifiers(bool& cnst, bool& vltl, bool& rstrct)
 }
 
 
-string DemangleGNU3::DemangleSourceName()
+const string& DemangleGNU3::DemangleSourceName()
 {
 	indent();
 	MyLogDebug("%s : %s\n", __FUNCTION__, m_reader.GetRaw().c_str());
@@ -310,9 +340,11 @@ TypeBuilder DemangleGNU3::DemangleFunction(bool cnst, bool vltl)
 		TypeBuilder param = DemangleType();
 		if (param.GetClass() == VoidTypeClass)
 			continue;
-		MyLogDebug("Var_%d - %s\n", i++, param.GetString().c_str());
-		m_functionSubstitute.back().push_back(param);
-		params.push_back({"", param.Finalize(), true, Variable()});
+		MyLogDebug("Var_%d - %s\n", i, param.GetString().c_str());
+		i++;
+		const size_t index = AddSubstitution(std::move(param));
+		m_functionSubstitute.back().push_back(index);
+		params.push_back({"", m_substitutionArena[index].type->Finalize(), true, Variable()});
 	}
 	m_reader.Consume();
 	m_functionSubstitute.pop_back();
@@ -700,18 +732,39 @@ string DemangleGNU3::DemangleNumberAsString()
 		m_reader.Consume();
 	}
 
+	const std::string_view rest = m_reader.PeekString(m_reader.Length());
+	size_t digits = 0;
+	while (digits < rest.size() && isdigit(rest[digits]))
+		digits++;
 	string number;
-	while (isdigit(m_reader.Peek()))
-	{
-		number += m_reader.ReadString(1);
-	}
-	return (negativeFactor?"-":"") + number;
+	number.reserve(digits + 1);
+	if (negativeFactor)
+		number += '-';
+	number += m_reader.ReadString(digits);
+	return number;
 }
 
 // number ::= [n] <decimal>
 int64_t DemangleGNU3::DemangleNumber()
 {
-	return std::stol(DemangleNumberAsString().c_str());
+	bool negativeFactor = false;
+	if (m_reader.Peek() == 'n')
+	{
+		negativeFactor = true;
+		m_reader.Consume();
+	}
+
+	if (!isdigit(m_reader.Peek()))
+		throw DemangleException();
+
+	uint64_t value = 0;
+	while (isdigit(m_reader.Peek()))
+	{
+		value = value * 10 + (m_reader.Read() - '0');
+		if (value > (uint64_t)INT64_MAX)
+			throw DemangleException();
+	}
+	return negativeFactor ? -(int64_t)value : (int64_t)value;
 }
 
 
@@ -851,12 +904,15 @@ string DemangleGNU3::DemangleBinaryExpression(const string& op)
 {
 	indent();
 	MyLogDebug("%s: '%s'\n", __FUNCTION__, m_reader.GetRaw().c_str());
-	const string lhs = "(" + DemangleExpression() + ")";
-	const string rhs = "(" + DemangleExpression() + ")";
+	string out = "(";
+	out += DemangleExpression();
+	out += op == "." ? ")" : ") ";
+	out += op;
+	out += op == "." ? "(" : " (";
+	out += DemangleExpression();
+	out += ")";
 	dedent();
-	if (op == ".")
-		return lhs + op + rhs;
-	return lhs + " " + op + " " + rhs;
+	return out;
 }
 
 
@@ -885,7 +941,7 @@ string DemangleGNU3::DemangleExpressionList()
 			expr += ", ";
 		const string e = DemangleExpression();
 		expr += e;
-		m_functionSubstitute.back().push_back(CreateUnknownType(e));
+		m_functionSubstitute.back().push_back(AddSubstitution(QualifiedName(e)));
 		first = false;
 	}
 	m_functionSubstitute.pop_back();
@@ -1225,7 +1281,7 @@ QualifiedName DemangleGNU3::DemangleBaseUnresolvedName()
 	QualifiedName out;
 	if (m_reader.Length() > 1)
 	{
-		const string str = m_reader.PeekString(2);
+		const std::string_view str = m_reader.PeekString(2);
 		if (str == "on")
 		{
 			out.push_back(GetOperator(m_reader.Read(), m_reader.Read()));
@@ -1235,7 +1291,7 @@ QualifiedName DemangleGNU3::DemangleBaseUnresolvedName()
 				vector<FunctionParameter> args;
 				DemangleTemplateArgs(args);
 				out.back() += GetTemplateString(args);
-				PushType(CreateUnknownType(out));
+				PushUnknownType(out);
 			}
 		}
 		else if (str == "dn")
@@ -1495,7 +1551,7 @@ string DemangleGNU3::DemangleExpression()
 		//                 ::= fL <L-1 num> p <CV> <prm-2 num> _ # L  > 0, second and later parameters
 
 		bool cnst = false, vltl = false, rstrct = false;
-		TypeBuilder type;
+		size_t index;
 		int64_t listNumber = 0;
 		int64_t elementNum = 0;
 		char elm;
@@ -1519,7 +1575,7 @@ string DemangleGNU3::DemangleExpression()
 			{
 				throw DemangleException();
 			}
-			type = m_functionSubstitute[listNumber][elementNum];
+			index = m_functionSubstitute[listNumber][elementNum];
 		}
 		else if (isdigit(elm) || isupper(elm))
 		{
@@ -1530,13 +1586,13 @@ string DemangleGNU3::DemangleExpression()
 			{
 				throw DemangleException();
 			}
-			type = m_functionSubstitute[listNumber][elementNum];
+			index = m_functionSubstitute[listNumber][elementNum];
 		}
 		else
 		{
 			throw DemangleException();
 		}
-		out = type.GetString();
+		out = GetSubstitution(index).GetString();
 		break;
 	}
 	case hash('s','r'):
@@ -1566,8 +1622,7 @@ string DemangleGNU3::DemangleExpression()
 			do
 			{
 				out += DemangleSourceName();
-				PushType(TypeBuilder::NamedType(NamedTypeReference::GenerateAutoDemangledTypeReference(
-					UnknownNamedTypeClass, out)));
+				PushUnknownType(out);
 				if (m_reader.Peek() == 'I')
 				{
 					vector<FunctionParameter> args;
@@ -1963,6 +2018,9 @@ TypeBuilder DemangleGNU3::DemangleSymbol(QualifiedName& varName)
 	bool cnst = false, vltl = false, rstrct = false;
 	bool oldTopLevel;
 	QualifiedName name;
+	// Nested encodings (guard variables, thunks, expressions) are needed in full
+	const bool nameOnly = m_nameOnly;
+	m_nameOnly = false;
 
 	/*
 	<encoding> ::= <function name> <bare-function-type>
@@ -2128,6 +2186,12 @@ TypeBuilder DemangleGNU3::DemangleSymbol(QualifiedName& varName)
 	}
 
 	varName = type.GetTypeName();
+	// The parameters don't contribute to the name unless a clone suffix follows them
+	if (nameOnly && m_reader.PeekString(m_reader.Length()).find('.') == std::string_view::npos)
+	{
+		dedent();
+		return type;
+	}
 	cnst = type.IsConst();
 	vltl = type.IsVolatile();
 	set<BNPointerSuffix> suffix = type.GetPointerSuffix();
@@ -2174,7 +2238,7 @@ TypeBuilder DemangleGNU3::DemangleSymbol(QualifiedName& varName)
 		if (m_reader.Peek() == '.')
 		{
 			// Extension, consume the rest
-			string ext = m_reader.ReadString(m_reader.Length());
+			string ext(m_reader.ReadString(m_reader.Length()));
 
 			if (ext == ".eh") ext = "exception handler";
 			else if (ext == ".eh_frame") ext = "exception handler frame";
@@ -2198,9 +2262,11 @@ TypeBuilder DemangleGNU3::DemangleSymbol(QualifiedName& varName)
 			}
 			break;
 		}
-		m_functionSubstitute.back().push_back(param);
-		params.push_back({"", param.Finalize(), true, Variable()});
-		if (param.GetClass() == VarArgsTypeClass)
+		const bool isVarArgs = param.GetClass() == VarArgsTypeClass;
+		const size_t index = AddSubstitution(std::move(param));
+		m_functionSubstitute.back().push_back(index);
+		params.push_back({"", m_substitutionArena[index].type->Finalize(), true, Variable()});
+		if (isVarArgs)
 		{
 			if (m_reader.Peek() == 'E')
 			{
@@ -2291,6 +2357,18 @@ bool DemangleGNU3::DemangleStringGNU3(Architecture* arch, const string& name, Re
 
 
 bool DemangleGNU3::DemangleStringGNU3(Architecture* arch, const string& name, Ref<Type>& outType, QualifiedName& outVarName)
+{
+	return DemangleStringGNU3(arch, name, &outType, outVarName);
+}
+
+
+bool DemangleGNU3::DemangleNameGNU3(Architecture* arch, const string& name, QualifiedName& outVarName)
+{
+	return DemangleStringGNU3(arch, name, nullptr, outVarName);
+}
+
+
+bool DemangleGNU3::DemangleStringGNU3(Architecture* arch, const string& name, Ref<Type>* outType, QualifiedName& outVarName)
 {
 	string encoding = name;
 	string header;
@@ -2307,32 +2385,37 @@ bool DemangleGNU3::DemangleStringGNU3(Architecture* arch, const string& name, Re
 		outVarName.clear();
 		outVarName.push_back(header);
 		outVarName.push_back(encoding);
-		outType = CreateUnknownType(outVarName).Finalize();
+		if (outType)
+			*outType = CreateUnknownType(outVarName).Finalize();
 		return true;
 	}
 	else
 		return false;
 
-	DemangleGNU3 demangle(arch, encoding);
+	DemangleGNU3 demangle(arch, encoding, !outType);
 	try
 	{
-		outType = demangle.DemangleSymbol(outVarName).Finalize();
+		TypeBuilder type = demangle.DemangleSymbol(outVarName);
+		bool hasType = true;
 
 		if (outVarName.size() == 0)
 		{
-			if (outType->GetClass() == NamedTypeReferenceClass && outType->GetNamedTypeReference()->GetTypeReferenceClass() == UnknownNamedTypeClass)
+			if (type.GetClass() == NamedTypeReferenceClass && type.GetNamedTypeReference()->GetTypeReferenceClass() == UnknownNamedTypeClass)
 			{
-				outVarName = outType->GetTypeName();
-				outType = nullptr;
+				outVarName = type.GetTypeName();
+				hasType = false;
 			}
-			else if (outType->GetClass() == NamedTypeReferenceClass)
+			else if (type.GetClass() == NamedTypeReferenceClass)
 			{
-				auto typeName = outType->GetTypeName();
+				auto typeName = type.GetTypeName();
 				if (typeName.size() > 0)
 					outVarName = "_" + typeName[typeName.size() - 1];
 			}
 		}
 
+		if (outType)
+			*outType = hasType ? type.Finalize() : nullptr;
+
 		if (foundHeader && !header.empty())
 		{
 			outVarName.insert(outVarName.begin(), header);
@@ -2371,6 +2454,14 @@ public:
 			return DemangleGNU3::DemangleStringGNU3(arch, name, outType, outVarName, view);
 		return DemangleGNU3::DemangleStringGNU3(arch, name, outType, outVarName);
 	}
+
+#ifndef BINARYNINJACORE_LIBRARY
+	virtual bool DemangleName(Ref<Architecture> arch, const string& name, QualifiedName& outVarName,
+	                          Ref<BinaryView> view) override
+	{
+		return DemangleGNU3::DemangleNameGNU3(arch, name, outVarName);
+	}
+#endif
 };
 
 
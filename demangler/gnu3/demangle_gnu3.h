@@ -15,6 +15,8 @@
 #pragma once
 #include <stdexcept>
 #include <exception>
+#include <memory>
+#include <string_view>
 
 // XXX: Compiled directly into the core for performance reasons
 // Will still work fine compiled independently, just at about a
@@ -45,45 +47,44 @@ public:
 
 class DemangleGNU3
 {
+	// Cursor over the mangled name. The views it hands out point into the caller's buffer, which must
+	// outlive the reader; nothing is copied until a caller stores a result.
 	class Reader
 	{
 	public:
-		Reader(const _STD_STRING& data);
-		_STD_STRING PeekString(size_t count=1);
-		char Peek();
-		bool NextIsOneOf(const _STD_STRING& list);
-		_STD_STRING GetRaw();
+		Reader(std::string_view data);
+		std::string_view PeekString(size_t count=1) const;
+		char Peek() const;
+		bool NextIsOneOf(std::string_view list) const;
+		_STD_STRING GetRaw() const;
 		char Read();
-		_STD_STRING ReadString(size_t count=1);
-		_STD_STRING ReadUntil(char sentinal);
+		std::string_view ReadString(size_t count=1);
+		std::string_view ReadUntil(char sentinal);
 		void Consume(size_t count=1);
 		size_t Length() const;
 		void UnRead(size_t count=1);
 	private:
-		_STD_STRING m_data;
+		std::string_view m_data;
 		size_t m_offset;
 	};
 
-	class SubstitutionList
+	// A substitution candidate. Entries pushed by name alone don't build their TypeBuilder until
+	// something looks them up, which most never are.
+	struct Substitution
 	{
-		_STD_VECTOR<BN::TypeBuilder> m_typeList;
-	public:
-		SubstitutionList();
-		~SubstitutionList();
-		void PushType(BN::TypeBuilder t);
-		void PopType();
-		const BN::TypeBuilder& GetType(size_t reference) const;
-		void PrintSubstitutionTable() const;
-		size_t Size() const { return m_typeList.size(); }
-		void Clear() { m_typeList.clear(); }
+		BN::QualifiedName name;
+		std::unique_ptr<BN::TypeBuilder> type;
 	};
 
 	BN::QualifiedName m_varName;
 	Reader m_reader;
 	BN::Architecture* m_arch;
-	_STD_VECTOR<BN::TypeBuilder> m_substitute;
-	_STD_VECTOR<BN::TypeBuilder> m_templateSubstitute;
-	_STD_VECTOR<_STD_VECTOR<BN::TypeBuilder>> m_functionSubstitute;
+	// Every candidate is stored once in the arena; the substitution tables hold indices into it, so
+	// pushing an entry or growing a table never clones a TypeBuilder.
+	_STD_VECTOR<Substitution> m_substitutionArena;
+	_STD_VECTOR<size_t> m_substitute;
+	_STD_VECTOR<size_t> m_templateSubstitute;
+	_STD_VECTOR<_STD_VECTOR<size_t>> m_functionSubstitute;
 	_STD_STRING m_lastName;
 	BNNameType m_nameType;
 	bool m_localType;
@@ -92,6 +93,7 @@ class DemangleGNU3
 	bool m_shouldDeleteReader;
 	bool m_topLevel;
 	bool m_isOperatorOverload;
+	bool m_nameOnly;
 	enum SymbolType { Function, FunctionWithReturn, Data, VTable, Rtti, Name};
 	BN::QualifiedName DemangleBaseUnresolvedName();
 	BN::TypeBuilder DemangleUnresolvedType();
@@ -102,7 +104,7 @@ class DemangleGNU3
 	_STD_STRING DemangleTypeString();
 	_STD_STRING DemangleExpressionList();
 	BN::TypeBuilder DemangleUnqualifiedName();
-	_STD_STRING DemangleSourceName();
+	const _STD_STRING& DemangleSourceName();
 	_STD_STRING DemangleNumberAsString();
 	_STD_STRING DemangleInitializer();
 	_STD_STRING DemangleExpression();
@@ -119,14 +121,22 @@ class DemangleGNU3
 	BN::TypeBuilder DemangleType();
 	int64_t DemangleNumber();
 	BN::TypeBuilder DemangleNestedName();
+	size_t AddSubstitution(BN::TypeBuilder type);
+	size_t AddSubstitution(const BN::QualifiedName& name);
+	const BN::TypeBuilder& GetSubstitution(size_t index);
 	void PushTemplateType(BN::TypeBuilder type);
 	const BN::TypeBuilder& GetTemplateType(size_t ref);
 	void PushType(BN::TypeBuilder type);
+	void PushUnknownType(const BN::QualifiedName& name);
 	const BN::TypeBuilder& GetType(size_t ref);
 	static bool DemangleGlobalHeader(_STD_STRING& name, _STD_STRING& header);
+	static bool DemangleStringGNU3(BN::Architecture* arch, const _STD_STRING& name, BN::Ref<BN::Type>* outType,
+		BN::QualifiedName& outVarName);
 
 public:
-	DemangleGNU3(BN::Architecture* arch, const _STD_STRING& mangledName);
+	// mangledName is read in place and must outlive the demangler. With nameOnly, DemangleSymbol stops
+	// once the top level name is known and doesn't build the function type.
+	DemangleGNU3(BN::Architecture* arch, const _STD_STRING& mangledName, bool nameOnly = false);
 	BN::TypeBuilder DemangleSymbol(BN::QualifiedName& varName);
 	BN::QualifiedName GetVarName() const { return m_varName; }
 	static bool IsGNU3MangledString(const _STD_STRING& name);
@@ -135,5 +145,7 @@ public:
 	static bool DemangleStringGNU3(BN::Architecture* arch, const _STD_STRING& name, BN::Ref<BN::Type>& outType, BN::QualifiedName& outVarName, const BN::Ref<BN::BinaryView>& view);
 	static bool DemangleStringGNU3(BN::Architecture* arch, const _STD_STRING& name, BN::Ref<BN::Type>& outType, BN::QualifiedName& outVarName, BN::BinaryView* view);
 	static bool DemangleStringGNU3(BN::Architecture* arch, const _STD_STRING& name, BN::Ref<BN::Type>& outType, BN::QualifiedName& outVarName);
+	// Same name as DemangleStringGNU3, without building the type
+	static bool DemangleNameGNU3(BN::Architecture* arch, const _STD_STRING& name, BN::QualifiedName& outVarName);
 	void PrintTables();
 };
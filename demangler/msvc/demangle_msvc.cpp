@@ -30,9 +30,22 @@ using namespace std;
 
 #define MAX_DEMANGLE_LENGTH 4096
 
-Demangle::Reader::Reader(string data)
+#undef MSVCDEMANGLE_DEBUG
+#ifdef MSVCDEMANGLE_DEBUG
+#define MyLogDebug(...) m_logger->LogDebug(__VA_ARGS__)
+#define indent() m_logger->Indent()
+#define dedent() m_logger->Dedent()
+#define CreateDemangleLogger() do { m_logger = LogRegistry::CreateLogger("MSVCDemangle"); m_logger->ResetIndent(); } while (0)
+#else
+// Macros rather than logger calls so release builds neither format the arguments nor cross into the core
+#define MyLogDebug(...) do {} while (0)
+#define indent()
+#define dedent()
+#define CreateDemangleLogger()
+#endif
+
+Demangle::Reader::Reader(string data): m_data(std::move(data)), m_offset(0)
 {
-	m_data = data;
 	//Check for non-ascii characters
 	for (auto a : m_data)
 	{
@@ -42,25 +55,25 @@ Demangle::Reader::Reader(string data)
 }
 
 
-string Demangle::Reader::PeekString(size_t count)
+std::string_view Demangle::Reader::PeekString(size_t count) const
 {
 	if (count > Length())
 		throw DemangleException();
-	return m_data.substr(0, count);
+	return std::string_view(m_data).substr(m_offset, count);
 }
 
 
-char Demangle::Reader::Peek()
+char Demangle::Reader::Peek() const
 {
 	if (1 > Length())
 		throw DemangleException();
-	return (char)m_data[0];
+	return (char)m_data[m_offset];
 }
 
 
-const char* Demangle::Reader::GetRaw()
+const char* Demangle::Reader::GetRaw() const
 {
-	return m_data.c_str();
+	return m_data.c_str() + m_offset;
 }
 
 
@@ -68,28 +81,27 @@ char Demangle::Reader::Read()
 {
 	if (1 > Length())
 		throw DemangleException();
-	char out = m_data[0];
-	m_data = m_data.substr(1);
-	return out;
+	return m_data[m_offset++];
 }
 
 
-string Demangle::Reader::ReadString(size_t count)
+std::string_view Demangle::Reader::ReadString(size_t count)
 {
-	if (count > Length())
+	// The character after the string is its terminator, which is consumed too
+	if (count >= Length())
 		throw DemangleException();
-	string out = m_data.substr(0, count);
-	m_data = m_data.substr(count + 1);
+	std::string_view out = std::string_view(m_data).substr(m_offset, count);
+	m_offset += count + 1;
 	return out;
 }
 
 
-string Demangle::Reader::ReadUntil(char sentinal)
+std::string_view Demangle::Reader::ReadUntil(char sentinal)
 {
-	size_t pos = m_data.find_first_of(sentinal);
+	size_t pos = m_data.find(sentinal, m_offset);
 	if (pos == string::npos)
 		throw DemangleException();
-	return ReadString(pos);
+	return ReadString(pos - m_offset);
 }
 
 
@@ -97,13 +109,13 @@ void Demangle::Reader::Consume(size_t count)
 {
 	if (count > Length())
 		throw DemangleException();
-	m_data = m_data.substr(count);
+	m_offset += count;
 }
 
 
-size_t Demangle::Reader::Length()
+size_t Demangle::Reader::Length() const
 {
-	return m_data.length();
+	return m_data.length() - m_offset;
 }
 
 
@@ -116,12 +128,12 @@ const TypeBuilder& Demangle::BackrefList::GetTypeBackref(size_t reference)
 }
 
 
-string Demangle::BackrefList::GetStringBackref(size_t reference)
+const string& Demangle::BackrefList::GetStringBackref(size_t reference)
 {
 	// LogDebug("type: %llx - ref: %d\n", this, reference);
 	if (reference < nameList.size())
 		return nameList[reference];
-	LogDebug("type: %p - Backref too large: %zu/%zu\n", this, nameList.size(), reference);
+	// LogDebug("type: %p - Backref too large: %zu/%zu\n", this, nameList.size(), reference);
 	throw DemangleException(string("Backref too large " + std::to_string(reference)));
 }
 
@@ -129,8 +141,12 @@ string Demangle::BackrefList::GetStringBackref(size_t reference)
 void Demangle::BackrefList::PushTypeBackref(TypeBuilder t)
 {
 	// LogDebug("this: %llx - TypeBackref: %lld  %s\n", this, nameList.size(), t.GetString().c_str());
-	if (typeList.size() <= 9)
-		typeList.push_back(t);
+	if (typeList.size() > 9)
+		return;
+	// There are at most ten, so size the list once instead of cloning builders as it grows
+	if (typeList.empty())
+		typeList.reserve(10);
+	typeList.push_back(std::move(t));
 }
 
 
@@ -138,7 +154,7 @@ void Demangle::BackrefList::PushStringBackref(string& s)
 {
 	if (s.size() > MAX_DEMANGLE_LENGTH)
 		throw DemangleException();
-	LogDebug("this: %p - Backref: %zu - %s\n", this, nameList.size(), s.c_str());
+	// LogDebug("this: %p - Backref: %zu - %s\n", this, nameList.size(), s.c_str());
 	for (const auto& name : nameList)
 		if (name == s)
 			return;
@@ -161,8 +177,7 @@ Demangle::Demangle(Architecture* arch, string mangledName) :
 	m_platform(nullptr),
 	m_view(nullptr)
 {
-	m_logger = LogRegistry::CreateLogger("MSVCDemangle");
-	m_logger->ResetIndent();
+	CreateDemangleLogger();
 }
 
 
@@ -172,8 +187,7 @@ Demangle::Demangle(Ref<Platform> platform, string mangledName) :
 	m_platform(platform),
 	m_view(nullptr)
 {
-	m_logger = LogRegistry::CreateLogger("MSVCDemangle");
-	m_logger->ResetIndent();
+	CreateDemangleLogger();
 }
 
 
@@ -185,14 +199,13 @@ Demangle::Demangle(Ref<BinaryView> view, string mangledName) :
 	if (!m_platform)
 		throw DemangleException();
 	m_arch = m_platform->GetArchitecture();
-	m_logger = LogRegistry::CreateLogger("MSVCDemangle");
-	m_logger->ResetIndent();
+	CreateDemangleLogger();
 }
 
 
 TypeBuilder Demangle::DemangleVarType(BackrefList& varList, bool isReturn, QualifiedName& name)
 {
-	m_logger->LogDebug("%s: '%s' - %lu\n", __FUNCTION__, reader.GetRaw(), varList.nameList.size());
+	MyLogDebug("%s: '%s' - %lu\n", __FUNCTION__, reader.GetRaw(), varList.nameList.size());
 	TypeBuilder newType;
 	bool _const = false, _volatile = false, isMember = false; //TODO: use this info, _signed = false;
 	BNReferenceType refType;
@@ -293,9 +306,9 @@ TypeBuilder Demangle::DemangleVarType(BackrefList& varList, bool isReturn, Quali
 		case 'O':
 		{
 			QualifiedName name;
-			m_logger->Indent();
+			indent();
 			auto childType = DemangleVarType(varList, false, name);
-			m_logger->Dedent();
+			dedent();
 			newType = TypeBuilder::ArrayType(childType.Finalize(), 0);
 			break;
 		}
@@ -340,9 +353,9 @@ TypeBuilder Demangle::DemangleVarType(BackrefList& varList, bool isReturn, Quali
 			reader.Consume(2);
 			DemangleModifiers(_const, _volatile, isMember);
 			QualifiedName name;
-			m_logger->Indent();
+			indent();
 			newType = DemangleVarType(varList, false, name);
-			m_logger->Dedent();
+			dedent();
 			newType.SetConst(_const);
 			newType.SetVolatile(_volatile);
 			return newType;
@@ -379,7 +392,7 @@ TypeBuilder Demangle::DemangleVarType(BackrefList& varList, bool isReturn, Quali
 	case '8':
 	case '9':
 		//Make a copy of the item in the backref list. Exit early since we don't want this added to the backref list.
-		m_logger->LogDebug("Backref %u %lu", elm - '0', varList.typeList.size());
+		MyLogDebug("Backref %u %lu", elm - '0', varList.typeList.size());
 		return varList.GetTypeBackref(elm - '0');
 	default:
 		throw DemangleException();
@@ -448,14 +461,14 @@ TypeBuilder Demangle::DemangleVarType(BackrefList& varList, bool isReturn, Quali
 		}
 		default:  // Non-numeric
 		{
-			m_logger->LogDebug("Demangle pointer subtype: '%s'\n", reader.GetRaw());
+			MyLogDebug("Demangle pointer subtype: '%s'\n", reader.GetRaw());
 			TypeBuilder child;
 			bool _const2 = false, _volatile2 = false, isMember = false;
 			auto suffix = DemanglePointerSuffix();
 			DemangleModifiers(_const2, _volatile2, isMember);
 			if (reader.Peek() == 'Y') //Multi-dimentional array
 			{
-				m_logger->LogDebug("Demangle multi-dimentional array");
+				MyLogDebug("Demangle multi-dimentional array");
 				int64_t nDimentions;
 				reader.Consume();
 				DemangleNumber(nDimentions);
@@ -467,9 +480,9 @@ TypeBuilder Demangle::DemangleVarType(BackrefList& varList, bool isReturn, Quali
 					elementList.push_back(element);
 				}
 				QualifiedName name;
-				m_logger->Indent();
+				indent();
 				child = DemangleVarType(varList, false, name);
-				m_logger->Dedent();
+				dedent();
 
 				for (auto i = elementList.rbegin(); i != elementList.rend(); i++)
 				{
@@ -479,9 +492,9 @@ TypeBuilder Demangle::DemangleVarType(BackrefList& varList, bool isReturn, Quali
 			else
 			{
 				QualifiedName name;
-				m_logger->Indent();
+				indent();
 				child = DemangleVarType(varList, true, name);
-				m_logger->Dedent();
+				dedent();
 			}
 
 			child.SetConst(_const2);
@@ -493,25 +506,25 @@ TypeBuilder Demangle::DemangleVarType(BackrefList& varList, bool isReturn, Quali
 			                                   refType);
 
 			newType.SetPointerSuffix(suffix);
-			m_logger->LogDebug("Name: %s\n", newType.GetString().c_str());
+			MyLogDebug("Name: %s\n", newType.GetString().c_str());
 			break;
 		}
 		}
 		break;
 	}
 	case EnumerationTypeClass:
-		m_logger->LogDebug("Demangle enumeration\n");
-		m_logger->Indent();
+		MyLogDebug("Demangle enumeration\n");
+		indent();
 		DemangleName(typeName, classFunctionType, varList);
-		m_logger->Dedent();
+		dedent();
 		newType = TypeBuilder::NamedType(NamedTypeReference::GenerateAutoDemangledTypeReference(EnumNamedTypeClass, typeName),
 		                                 width, width);
 		break;
 	case StructureTypeClass:
-		m_logger->LogDebug("Demangle structure\n");
-		m_logger->Indent();
+		MyLogDebug("Demangle structure\n");
+		indent();
 		DemangleName(typeName, classFunctionType, varList);
-		m_logger->Dedent();
+		dedent();
 		switch (structType)
 		{
 		case ClassStructureType:
@@ -545,7 +558,7 @@ TypeBuilder Demangle::DemangleVarType(BackrefList& varList, bool isReturn, Quali
 
 void Demangle::DemangleNumber(int64_t& num)
 {
-	m_logger->LogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+	MyLogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
 	num = 0;
 	int mult = 1;
 	if (reader.Peek() == '?')
@@ -563,8 +576,7 @@ void Demangle::DemangleNumber(int64_t& num)
 	else
 	{
 		//The number is hexidecimal
-		string strnum = reader.ReadUntil('@');
-		for (auto a : strnum)
+		for (auto a : reader.ReadUntil('@'))
 		{
 			num *= 16;
 			if (a >= 'A' && a <= 'P')
@@ -580,7 +592,7 @@ void Demangle::DemangleNumber(int64_t& num)
 
 void Demangle::DemangleChar(char& ch)
 {
-	m_logger->LogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+	MyLogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
 	// Basic char is just the char
 	if (reader.Peek() != '?')
 	{
@@ -593,7 +605,7 @@ void Demangle::DemangleChar(char& ch)
 	// Hex char is ?$XX for 2 hex digits XX
 	if (reader.Peek() == '$')
 	{
-		m_logger->LogDebug("%s: Hex digit '%s'\n", __FUNCTION__, reader.GetRaw());
+		MyLogDebug("%s: Hex digit '%s'\n", __FUNCTION__, reader.GetRaw());
 
 		reader.Consume();
 		char c1 = reader.Peek();
@@ -613,7 +625,7 @@ void Demangle::DemangleChar(char& ch)
 		return;
 	}
 
-	m_logger->LogDebug("%s: Table lookup '%s'\n", __FUNCTION__, reader.GetRaw());
+	MyLogDebug("%s: Table lookup '%s'\n", __FUNCTION__, reader.GetRaw());
 
 	// Otherwise it's a lookup based on some big table
 	// Thanks, LLVM!
@@ -699,7 +711,7 @@ void Demangle::DemangleWideChar(uint16_t& wch)
 
 void Demangle::DemangleVariableList(vector<FunctionParameter>& paramList, BackrefList& varList)
 {
-	m_logger->LogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+	MyLogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
 	bool _const = false, _volatile = false, isMember = false;
 	set<BNPointerSuffix> suffix;
 	for (size_t i = 0; reader.Peek() != 'Z'; i++)
@@ -720,10 +732,10 @@ void Demangle::DemangleVariableList(vector<FunctionParameter>& paramList, Backre
 
 		FunctionParameter vt;
 		QualifiedName name;
-		m_logger->LogDebug("Argument %d: %s", i, reader.GetRaw());
-		m_logger->Indent();
+		MyLogDebug("Argument %d: %s", i, reader.GetRaw());
+		indent();
 		TypeBuilder type = DemangleVarType(varList, false, name);
-		m_logger->Dedent();
+		dedent();
 		if (hasModifiers)
 		{
 			type.SetConst(_const);
@@ -735,11 +747,11 @@ void Demangle::DemangleVariableList(vector<FunctionParameter>& paramList, Backre
 		vt.defaultLocation = true;
 
 		paramList.push_back(vt);
-		m_logger->LogDebug("Argument %zu: '%s' - '%s'\n", i, vt.type->GetString().c_str(), reader.GetRaw());
+		MyLogDebug("Argument %zu: '%s' - '%s'\n", i, vt.type->GetString().c_str(), reader.GetRaw());
 	}
 	if (reader.Peek() == 'Z')
 		reader.Consume();
-	m_logger->LogDebug("%s: done '%s'\n", __FUNCTION__, reader.GetRaw());
+	MyLogDebug("%s: done '%s'\n", __FUNCTION__, reader.GetRaw());
 }
 
 
@@ -820,9 +832,9 @@ void Demangle::DemangleNameTypeRtti(BNNameType& classFunctionType,
 		DemangleModifiers(_const, _volatile, isMember);
 
 		QualifiedName name;
-		m_logger->Indent();
+		indent();
 		rtti = DemangleVarType(nameBackrefList, false, name);
-		m_logger->Dedent();
+		dedent();
 		rtti.SetConst(_const);
 		rtti.SetVolatile(_volatile);
 		rtti.SetPointerSuffix(suffix);
@@ -864,7 +876,7 @@ void Demangle::DemangleNameTypeRtti(BNNameType& classFunctionType,
 
 void Demangle::DemangleTypeNameLookup(string& out, BNNameType& functionType)
 {
-	m_logger->LogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+	MyLogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
 	switch (reader.Read())
 	{
 	case '?': functionType = NoNameType; break;
@@ -903,7 +915,7 @@ void Demangle::DemangleTypeNameLookup(string& out, BNNameType& functionType)
 	case 'Z': functionType = OperatorMinusEqualNameType; break;
 	case '_':
 	{
-		m_logger->LogDebug(" %s: '%s'\n", __FUNCTION__, reader.GetRaw());
+		MyLogDebug(" %s: '%s'\n", __FUNCTION__, reader.GetRaw());
 		switch (reader.Read())
 		{
 		case '0': functionType = OperatorDivideEqualNameType; break;
@@ -942,7 +954,7 @@ void Demangle::DemangleTypeNameLookup(string& out, BNNameType& functionType)
 		case 'W': // Fallthrough
 		case 'Z': functionType = NoNameType; break;
 		case '_':
-			m_logger->LogDebug("  %s: '%s'\n", __FUNCTION__, reader.GetRaw());
+			MyLogDebug("  %s: '%s'\n", __FUNCTION__, reader.GetRaw());
 			switch (reader.Read())
 			{
 			case 'A': functionType = ManagedVectorConstructorIteratorNameType; break;
@@ -975,7 +987,7 @@ string Demangle::DemangleTemplateInstantiationName(BackrefList& nameBackrefList)
 	string out;
 	BackrefList templateBackref;
 	reader.Consume(2);
-	m_logger->LogDebug("DemangleTemplateInstantiationName: '%s'\n", reader.GetRaw());
+	MyLogDebug("DemangleTemplateInstantiationName: '%s'\n", reader.GetRaw());
 	if (reader.Peek() >= '0' && reader.Peek() <= '9')
 	{
 		out = nameBackrefList.GetStringBackref(reader.Read() - '0');
@@ -991,10 +1003,10 @@ string Demangle::DemangleTemplateInstantiationName(BackrefList& nameBackrefList)
 
 string Demangle::DemangleTemplateParams(vector<FunctionParameter>& params, BackrefList& nameBackrefList, string& out)
 {
-	m_logger->Indent();
+	indent();
 	DemangleVariableList(params, nameBackrefList);
-	m_logger->Dedent();
-	m_logger->LogDebug("VariableList done\n");
+	dedent();
+	MyLogDebug("VariableList done\n");
 	out += "<";
 	for (size_t i = 0; i < params.size(); i++)
 	{
@@ -1055,7 +1067,7 @@ string Demangle::DemangleUnqualifiedSymbolName(QualifiedName& nameList, BackrefL
 
 TypeBuilder Demangle::DemangleString()
 {
-	m_logger->LogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+	MyLogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
 	// ??_C@_<length><crc32>@<name>
 	if (reader.Peek() != '_')
 	{
@@ -1087,7 +1099,7 @@ TypeBuilder Demangle::DemangleString()
 	}
 	uint64_t length = (uint64_t)lengthRaw;
 
-	m_logger->LogDebug("%s: Before CRC32 '%s'\n", __FUNCTION__, reader.GetRaw());
+	MyLogDebug("%s: Before CRC32 '%s'\n", __FUNCTION__, reader.GetRaw());
 
 	// CRC32 (ignored)
 	while (reader.Peek() != '@')
@@ -1105,7 +1117,7 @@ TypeBuilder Demangle::DemangleString()
 	// String bytes
 	if (isWideChar)
 	{
-		m_logger->LogDebug("%s: Wide string '%s'\n", __FUNCTION__, reader.GetRaw());
+		MyLogDebug("%s: Wide string '%s'\n", __FUNCTION__, reader.GetRaw());
 		string utf8name;
 		truncated = (length > 64);
 		while (reader.Peek() != '@')
@@ -1127,7 +1139,7 @@ TypeBuilder Demangle::DemangleString()
 	}
 	else
 	{
-		m_logger->LogDebug("%s: Non-wide string '%s'\n", __FUNCTION__, reader.GetRaw());
+		MyLogDebug("%s: Non-wide string '%s'\n", __FUNCTION__, reader.GetRaw());
 		uint64_t numNulls = 0;
 		size_t endNulls = 0;
 		vector<uint8_t> chars;
@@ -1156,7 +1168,7 @@ TypeBuilder Demangle::DemangleString()
 		// Now time to guess encoding
 		if (chars.size() % 1 != 0)
 		{
-			m_logger->LogDebug("%s: Looks like UTF8 '%s'\n", __FUNCTION__, reader.GetRaw());
+			MyLogDebug("%s: Looks like UTF8 '%s'\n", __FUNCTION__, reader.GetRaw());
 			name = Unicode::ToEscapedString(Unicode::GetBlocksForNames({}), false, chars.data(), chars.size() - endNulls);
 			type = Type::ArrayType(Type::IntegerType(1, true), length);
 		}
@@ -1164,7 +1176,7 @@ TypeBuilder Demangle::DemangleString()
 		{
 			if (chars.size() % 4 == 0 && numNulls > length * 2 / 3)
 			{
-				m_logger->LogDebug("%s: Looks like UTF32 '%s'\n", __FUNCTION__, reader.GetRaw());
+				MyLogDebug("%s: Looks like UTF32 '%s'\n", __FUNCTION__, reader.GetRaw());
 				string utf8name;
 				for (size_t i = 0; i < chars.size() - endNulls; i += 4)
 				{
@@ -1175,7 +1187,7 @@ TypeBuilder Demangle::DemangleString()
 			}
 			else if (numNulls > length / 3)
 			{
-				m_logger->LogDebug("%s: Looks like UTF16 '%s'\n", __FUNCTION__, reader.GetRaw());
+				MyLogDebug("%s: Looks like UTF16 '%s'\n", __FUNCTION__, reader.GetRaw());
 				string utf8name;
 				for (size_t i = 0; i < chars.size() - endNulls; i += 2)
 				{
@@ -1186,7 +1198,7 @@ TypeBuilder Demangle::DemangleString()
 			}
 			else
 			{
-				m_logger->LogDebug("%s: Looks like UTF8 '%s'\n", __FUNCTION__, reader.GetRaw());
+				MyLogDebug("%s: Looks like UTF8 '%s'\n", __FUNCTION__, reader.GetRaw());
 
 				name = Unicode::ToEscapedString(Unicode::GetBlocksForNames({}), false, chars.data(), chars.size() - endNulls);
 				type = Type::ArrayType(Type::IntegerType(1, true), length);
@@ -1211,7 +1223,7 @@ TypeBuilder Demangle::DemangleTypeInfoName()
 	bool isMember = false;
 	DemangleModifiers(_const, _volatile, isMember);
 
-	m_logger->LogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+	MyLogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
 
 	QualifiedName name;
 	TypeBuilder type = DemangleVarType(m_backrefList, false, name);
@@ -1239,45 +1251,45 @@ void Demangle::DemangleName(QualifiedName& nameList,
 	vector<FunctionParameter> params;
 	while(1)
 	{
-		m_logger->LogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+		MyLogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
 		switch (GetNameType())
 		{
 		case NameString:
-			m_logger->LogDebug("Demangle String\n");
+			MyLogDebug("Demangle String\n");
 			DemangleNameTypeString(out);
 			nameList.insert(nameList.begin(), out);
-			m_logger->LogDebug("Pushing backref NameString %s", out.c_str());
+			MyLogDebug("Pushing backref NameString %s", out.c_str());
 			nameBackrefList.PushStringBackref(out);
-			m_logger->LogDebug("nameList.front(): %s\n", nameList.front().c_str());
-			m_logger->LogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+			MyLogDebug("nameList.front(): %s\n", nameList.front().c_str());
+			MyLogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
 			break;
 		case NameLookup:
-			m_logger->LogDebug("Demangle Lookup\n");
+			MyLogDebug("Demangle Lookup\n");
 			DemangleTypeNameLookup(out, functionType);
 			classFunctionType = functionType;
 			nameList.insert(nameList.begin(), out);
 			break;
 		case NameBackref:
-			m_logger->LogDebug("Demangle Backref");
+			MyLogDebug("Demangle Backref");
 			out = nameBackrefList.GetStringBackref(reader.Read() - '0');
-			m_logger->LogDebug("Demangle Backref: %s", out.c_str());
+			MyLogDebug("Demangle Backref: %s", out.c_str());
 			nameList.insert(nameList.begin(), out);
 			break;
 		case NameTemplate:
 		{
-			m_logger->LogDebug("Demangle Template: '%s'\n", reader.GetRaw());
+			MyLogDebug("Demangle Template: '%s'\n", reader.GetRaw());
 			BackrefList templateBackref;
 			out = DemangleUnqualifiedSymbolName(nameList, templateBackref, functionType);
-			m_logger->LogDebug("Pushing backref NameTemplate %s", out.c_str());
+			MyLogDebug("Pushing backref NameTemplate %s", out.c_str());
 			templateBackref.PushStringBackref(out);
-			m_logger->LogDebug("Demangling Template variables %s\n", reader.GetRaw());
+			MyLogDebug("Demangling Template variables %s\n", reader.GetRaw());
 			DemangleTemplateParams(params, templateBackref, out);
 			nameList.insert(nameList.begin(), out);
 			nameBackrefList.PushStringBackref(out);
 			break;
 		}
 		case NameConstructor:
-			m_logger->LogDebug("NameConstructor\n");
+			MyLogDebug("NameConstructor\n");
 			classFunctionType = ConstructorNameType;
 			DemangleName(nameList, dummyFunctionType, nameBackrefList);
 			if (nameList.size() == 0)
@@ -1286,27 +1298,27 @@ void Demangle::DemangleName(QualifiedName& nameList,
 			return;
 		case NameDestructor:
 			classFunctionType = ConstructorNameType;
-			m_logger->LogDebug("NameDestructor\n");
+			MyLogDebug("NameDestructor\n");
 			DemangleName(nameList, dummyFunctionType, nameBackrefList);
 			if (nameList.size() == 0)
 				throw DemangleException();
 			nameList.push_back("~" + nameList[nameList.size()-1]);
 			return;
 		case NameRtti:
-			m_logger->LogDebug("NameRtti\n");
+			MyLogDebug("NameRtti\n");
 			DemangleNameTypeRtti(classFunctionType, nameBackrefList, out);
 			nameList.insert(nameList.begin(), out);
 			break;
 			// case NameDynamicInitializer:
-			// 	m_logger->LogDebug("NameDynamicInitializer\n");
+			// 	MyLogDebug("NameDynamicInitializer\n");
 			// 	DemangleInitFiniStub(false);
 			// 	break;
 			// case NameDynamicAtExitDestructor:
-			// 	m_logger->LogDebug("NameDynamicAtExitDestructor\n");
+			// 	MyLogDebug("NameDynamicAtExitDestructor\n");
 			// 	DemangleInitFiniStub(false);
 			// 	break;
 		case NameReturn:
-			m_logger->LogDebug("NameReturn\n");
+			MyLogDebug("NameReturn\n");
 			classFunctionType = OperatorReturnTypeNameType;
 			if (reader.PeekString(2) == "?$")
 			{
@@ -1371,7 +1383,7 @@ Ref<CallingConvention> Demangle::GetCallingConventionForType(BNCallingConvention
 
 BNCallingConventionName Demangle::DemangleCallingConvention()
 {
-	m_logger->LogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+	MyLogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
 	switch (reader.Read())
 	{
 	case 'A': //Exported function
@@ -1399,7 +1411,7 @@ BNCallingConventionName Demangle::DemangleCallingConvention()
 
 set<BNPointerSuffix> Demangle::DemanglePointerSuffix()
 {
-	m_logger->LogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+	MyLogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
 	set<BNPointerSuffix> suffix;
 	if (reader.Peek() == '@')
 		return suffix;
@@ -1426,7 +1438,7 @@ set<BNPointerSuffix> Demangle::DemanglePointerSuffix()
 
 void Demangle::DemangleModifiers(bool& _const, bool& _volatile, bool &isMember)
 {
-	m_logger->LogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+	MyLogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
 	if (reader.Peek() == '@')
 		return;
 
@@ -1494,7 +1506,7 @@ void Demangle::DemangleModifiers(bool& _const, bool& _volatile, bool &isMember)
 
 TypeBuilder Demangle::DemangleFunction(BNNameType classFunctionType, bool pointerSuffix, BackrefList& nameBackrefList, int funcClass)
 {
-	m_logger->LogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+	MyLogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
 	bool _const = false, _volatile = false, isMember = false;
 	set<BNPointerSuffix> suffix;
 	TypeBuilder returnType;
@@ -1531,6 +1543,11 @@ TypeBuilder Demangle::DemangleFunction(BNNameType classFunctionType, bool pointe
 		}
 	}
 
+	// Everything past the thunk adjustors only describes the type. Nested function types (funcClass of
+	// NoneFunctionClass) can be part of the name and are always demangled.
+	if (m_nameOnly && funcClass != NoneFunctionClass)
+		return TypeBuilder();
+
 	if (pointerSuffix)
 	{
 		suffix = DemanglePointerSuffix();
@@ -1545,7 +1562,7 @@ TypeBuilder Demangle::DemangleFunction(BNNameType classFunctionType, bool pointe
 		//No return type
 		shouldHaveReturnType = false;
 		reader.Consume();
-		m_logger->LogDebug("Function has no return type %s", reader.GetRaw());
+		MyLogDebug("Function has no return type %s", reader.GetRaw());
 	}
 	else
 	{
@@ -1563,11 +1580,11 @@ TypeBuilder Demangle::DemangleFunction(BNNameType classFunctionType, bool pointe
 		}
 
 		QualifiedName name;
-		m_logger->LogDebug("Demangle function return type %s", reader.GetRaw());
-		m_logger->Indent();
+		MyLogDebug("Demangle function return type %s", reader.GetRaw());
+		indent();
 		returnType = DemangleVarType(nameBackrefList, true, name);
-		m_logger->LogDebug("Return type: %s", returnType.GetString().c_str());
-		m_logger->Dedent();
+		MyLogDebug("Return type: %s", returnType.GetString().c_str());
+		dedent();
 		if (hasModifiers)
 		{
 			returnType.SetConst(return_const);
@@ -1578,7 +1595,7 @@ TypeBuilder Demangle::DemangleFunction(BNNameType classFunctionType, bool pointe
 	if (reader.Peek() == '@')
 		reader.Consume();
 
-	m_logger->LogDebug("\tDemangle Function Parameters %s", reader.GetRaw());
+	MyLogDebug("\tDemangle Function Parameters %s", reader.GetRaw());
 	vector<FunctionParameter> params;
 	bool needsThisPtr = false;
 	if (cc == ThisCallCallingConvention)
@@ -1626,19 +1643,21 @@ TypeBuilder Demangle::DemangleFunction(BNNameType classFunctionType, bool pointe
 	if (convention)
 		newType.SetCallingConvention(convention);
 
-	m_logger->LogDebug("Successfully Created Function Type!\n");
+	MyLogDebug("Successfully Created Function Type!\n");
 	return newType;
 }
 
 
 TypeBuilder Demangle::DemangleData()
 {
-	m_logger->LogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+	MyLogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+	if (m_nameOnly)
+		return TypeBuilder();
 	bool _const = false, _volatile = false, isMember = false;
 	QualifiedName name;
-	m_logger->Indent();
+	indent();
 	TypeBuilder newType = DemangleVarType(m_backrefList, false, name);
-	m_logger->Dedent();
+	dedent();
 	auto suffix = DemanglePointerSuffix();
 	DemangleModifiers(_const, _volatile, isMember);
 	newType.SetConst(_const);
@@ -1650,25 +1669,25 @@ TypeBuilder Demangle::DemangleData()
 
 TypeBuilder Demangle::DemanagleRTTI(BNNameType nameType)
 {
-	m_logger->LogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+	MyLogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
 	bool _const = false, _volatile = false, isMember = false;
 	if (reader.Length() > 0)
 		DemangleModifiers(_const, _volatile, isMember);
 	QualifiedName typeName = m_varName;
-	m_logger->LogDebug("new struct type\n");
+	MyLogDebug("new struct type\n");
 	TypeBuilder newType = TypeBuilder::NamedType(NamedTypeReference::GenerateAutoDemangledTypeReference(
 		StructNamedTypeClass, typeName));
 	newType.SetNameType(nameType);
 	newType.SetConst(_const);
 	newType.SetVolatile(_volatile);
-	m_logger->LogDebug("log: %s\n", newType.GetString().c_str());
+	MyLogDebug("log: %s\n", newType.GetString().c_str());
 	return newType;
 }
 
 
 TypeBuilder Demangle::DemangleVTable()
 {
-	m_logger->LogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+	MyLogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
 	bool _const = false, _volatile = false, isMember = false;
 	DemangleModifiers(_const, _volatile, isMember);
 	TypeBuilder newType = TypeBuilder::NamedType(NamedTypeReference::GenerateAutoDemangledTypeReference(
@@ -1695,8 +1714,8 @@ TypeBuilder Demangle::DemangleVTable()
 
 Demangle::DemangleContext Demangle::DemangleSymbol()
 {
-	m_logger->LogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
-	m_logger->Indent();
+	MyLogDebug("%s: '%s'\n", __FUNCTION__, reader.GetRaw());
+	indent();
 	BNNameType classFunctionType = NoNameType;
 	QualifiedName varName;
 
@@ -1713,7 +1732,7 @@ Demangle::DemangleContext Demangle::DemangleSymbol()
 	}
 
 	DemangleName(varName, classFunctionType, m_backrefList);
-	m_logger->LogDebug("Done demangling Name: '%s' - '%s'", varName.GetString().c_str(), reader.GetRaw());
+	MyLogDebug("Done demangling Name: '%s' - '%s'", varName.GetString().c_str(), reader.GetRaw());
 	m_varName = varName;
 
 	DemangleContext context;
@@ -1853,6 +1872,26 @@ bool Demangle::DemangleMS(const string& mangledName, Ref<Type>& outType,
 }
 
 
+bool Demangle::DemangleNameMS(Architecture* arch, const string& mangledName, QualifiedName& outVarName)
+{
+	if (mangledName.empty() || (mangledName[0] != '?' && mangledName[0] != '.'))
+		return false;
+	try
+	{
+		Demangle demangle(arch, mangledName);
+		demangle.m_nameOnly = true;
+		demangle.DemangleSymbol();
+		outVarName = demangle.GetVarName();
+	}
+	catch (DemangleException &e)
+	{
+		LogDebug("Demangling Failed '%s' '%s;", mangledName.c_str(), e.what());
+		return false;
+	}
+	return true;
+}
+
+
 class MSDemangler: public Demangler
 {
 public:
@@ -1878,6 +1917,14 @@ public:
 			return Demangle::DemangleMS(arch, name, outType, outVarName, view);
 		return Demangle::DemangleMS(arch, name, outType, outVarName);
 	}
+
+#ifndef BINARYNINJACORE_LIBRARY
+	virtual bool DemangleName(Ref<Architecture> arch, const string& name, QualifiedName& outVarName,
+	                          Ref<BinaryView> view) override
+	{
+		return Demangle::DemangleNameMS(arch, name, outVarName);
+	}
+#endif
 };
 
 extern "C"
@@ -15,6 +15,7 @@
 #pragma once
 #include <stdexcept>
 #include <exception>
+#include <string_view>
 
 // XXX: Compiled directly into the core for performance reasons
 // Will still work fine compiled independently, just at about a
@@ -85,16 +86,18 @@ class Demangle
 	{
 	public:
 		Reader(_STD_STRING data);
-		_STD_STRING PeekString(size_t count=1);
-		char Peek();
-		const char* GetRaw();
+		// Views stay valid for the lifetime of the reader
+		std::string_view PeekString(size_t count=1) const;
+		char Peek() const;
+		const char* GetRaw() const;
 		char Read();
-		_STD_STRING ReadString(size_t count=1);
-		_STD_STRING ReadUntil(char sentinal);
+		std::string_view ReadString(size_t count=1);
+		std::string_view ReadUntil(char sentinal);
 		void Consume(size_t count=1);
-		size_t Length();
+		size_t Length() const;
 	private:
 		_STD_STRING m_data;
+		size_t m_offset;
 	};
 
 	class BackrefList
@@ -103,7 +106,7 @@ class Demangle
 		_STD_VECTOR<BN::TypeBuilder> typeList;
 		_STD_VECTOR<_STD_STRING> nameList;
 		const BN::TypeBuilder& GetTypeBackref(size_t reference);
-		_STD_STRING GetStringBackref(size_t reference);
+		const _STD_STRING& GetStringBackref(size_t reference);
 		void PushTypeBackref(BN::TypeBuilder t);
 		void PushStringBackref(_STD_STRING& s);
 		void PushFrontStringBackref(_STD_STRING& s);
@@ -116,6 +119,8 @@ class Demangle
 	BN::Ref<BN::BinaryView> m_view;
 	BN::QualifiedName m_varName;
 	BN::Ref<BN::Logger> m_logger;
+	// Only the name of the top level symbol is wanted; its function or data type isn't built
+	bool m_nameOnly = false;
 
 	NameType GetNameType();
 	BN::TypeBuilder DemangleVarType(BackrefList& varList, bool isReturn, BN::QualifiedName& name);
@@ -175,5 +180,8 @@ public:
 	                       BN::QualifiedName& outVarName, const BN::Ref<BN::BinaryView>& view);
 	static bool DemangleMS(const _STD_STRING& mangledName, BN::Ref<BN::Type>& outType,
 	                       BN::QualifiedName& outVarName, BN::BinaryView* view);
+
+	// Same name as DemangleMS, without building the type
+	static bool DemangleNameMS(BN::Architecture* arch, const _STD_STRING& mangledName, BN::QualifiedName& outVarName);
 };
 
@@ -0,0 +1,339 @@
+/*
+ * Command line benchmark of the API hot paths.
+ *
+ * Every file given is opened and analyzed, then each benchmark is run against
+ * it a fixed number of times. Results are written as JSON so runs against the
+ * same corpus can be compared across releases.
+ *
+ *   api_bench [--iterations N] [--output results.json] <file>...
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+
+#include "binaryninjacore.h"
+#include "binaryninjaapi.h"
+#include "lowlevelilinstruction.h"
+#include "mediumlevelilinstruction.h"
+#include "highlevelilinstruction.h"
+
+using namespace BinaryNinja;
+using namespace std;
+
+// Caps so a large binary in the corpus doesn't dominate the run time
+static constexpr size_t MaxReaderBytes = 16 * 1024 * 1024;
+static constexpr size_t MaxFunctions = 1000;
+static constexpr size_t MaxLinearLines = 20000;
+
+using Clock = chrono::steady_clock;
+
+// Keeps the reads from being optimized out
+static volatile uint32_t g_sink;
+
+
+struct BenchmarkResult
+{
+	string name;
+	size_t items = 0;
+	vector<uint64_t> timesNs;
+};
+
+
+// Run `body` `iterations` times; it returns the number of items it processed, which should be the same every time
+static BenchmarkResult RunBenchmark(const string& name, size_t iterations, const function<size_t()>& body)
+{
+	BenchmarkResult result;
+	result.name = name;
+	for (size_t i = 0; i < iterations; i++)
+	{
+		auto start = Clock::now();
+		result.items = body();
+		auto elapsed = chrono::duration_cast<chrono::nanoseconds>(Clock::now() - start);
+		result.timesNs.push_back((uint64_t)elapsed.count());
+	}
+	return result;
+}
+
+
+static nlohmann::json ResultToJson(const BenchmarkResult& result)
+{
+	vector<uint64_t> sorted = result.timesNs;
+	sort(sorted.begin(), sorted.end());
+	uint64_t total = 0;
+	for (uint64_t time : sorted)
+		total += time;
+
+	nlohmann::json json;
+	json["name"] = result.name;
+	json["items"] = result.items;
+	json["iterations"] = sorted.size();
+	json["min_ns"] = sorted.empty() ? 0 : sorted.front();
+	json["median_ns"] = sorted.empty() ? 0 : sorted[sorted.size() / 2];
+	json["mean_ns"] = sorted.empty() ? 0 : total / sorted.size();
+	return json;
+}
+
+
+static vector<Ref<Function>> GetBenchmarkFunctions(BinaryView* bv)
+{
+	vector<Ref<Function>> functions = bv->GetAnalysisFunctionList();
+	if (functions.size() > MaxFunctions)
+		functions.resize(MaxFunctions);
+	return functions;
+}
+
+
+static size_t BenchReader(BinaryView* bv)
+{
+	BinaryReader reader(bv);
+	uint64_t end = min(bv->GetEnd(), bv->GetStart() + MaxReaderBytes);
+	size_t count = 0;
+	uint32_t sum = 0;
+	for (uint64_t addr = bv->GetStart(); addr + 4 <= end; addr += 4)
+	{
+		reader.Seek(addr);
+		try
+		{
+			sum += reader.Read32();
+			count++;
+		}
+		catch (ReadException&)
+		{
+			// Gaps between segments
+		}
+	}
+	g_sink = sum;
+	return count;
+}
+
+
+static size_t BenchCodeReferences(BinaryView* bv, const vector<Ref<Function>>& functions)
+{
+	size_t count = 0;
+	for (auto& func : functions)
+		count += bv->GetCodeReferences(func->GetStart()).size();
+	return count;
+}
+
+
+static size_t BenchLowLevelIL(const vector<Ref<Function>>& functions)
+{
+	size_t count = 0;
+	for (auto& func : functions)
+	{
+		Ref<LowLevelILFunction> il = func->GetLowLevelIL();
+		if (!il)
+			continue;
+		for (size_t i = 0; i < il->GetInstructionCount(); i++)
+		{
+			il->GetInstruction(i).VisitExprs([&](const LowLevelILInstruction&) {
+				count++;
+				return true;
+			});
+		}
+	}
+	return count;
+}
+
+
+static size_t BenchMediumLevelIL(const vector<Ref<Function>>& functions)
+{
+	size_t count = 0;
+	for (auto& func : functions)
+	{
+		Ref<MediumLevelILFunction> il = func->GetMediumLevelIL();
+		if (!il)
+			continue;
+		for (size_t i = 0; i < il->GetInstructionCount(); i++)
+		{
+			il->GetInstruction(i).VisitExprs([&](const MediumLevelILInstruction&) {
+				count++;
+				return true;
+			});
+		}
+	}
+	return count;
+}
+
+
+static size_t BenchHighLevelIL(const vector<Ref<Function>>& functions)
+{
+	size_t count = 0;
+	for (auto& func : functions)
+	{
+		Ref<HighLevelILFunction> il = func->GetHighLevelIL();
+		if (!il)
+			continue;
+		il->GetRootExpr().VisitExprs([&](const HighLevelILInstruction&) {
+			count++;
+			return true;
+		});
+	}
+	return count;
+}
+
+
+static size_t BenchPseudoC(const vector<Ref<Function>>& functions, DisassemblySettings* settings)
+{
+	size_t count = 0;
+	for (auto& func : functions)
+	{
+		Ref<LanguageRepresentationFunction> repr = func->GetLanguageRepresentation("Pseudo C");
+		Ref<HighLevelILFunction> il = repr ? repr->GetHighLevelILFunction() : nullptr;
+		if (il)
+			count += repr->GetLinearLines(il->GetRootExpr(), settings).size();
+	}
+	return count;
+}
+
+
+static size_t BenchDemangle(BinaryView* bv, const vector<string>& names)
+{
+	Ref<Architecture> arch = bv->GetDefaultArchitecture();
+	size_t count = 0;
+	for (auto& name : names)
+	{
+		Ref<Type> type;
+		QualifiedName varName;
+		if (DemangleGeneric(arch, name, type, varName))
+			count++;
+	}
+	return count;
+}
+
+
+// Returns bytes of UTF-8 produced, since string lengths vary too much for a count of strings to compare
+static size_t BenchStringContents(BinaryView* bv, const vector<BNStringReference>& strings)
+{
+	size_t bytes = 0;
+	for (auto& text : Unicode::GetStringContents(bv, strings))
+		bytes += text.size();
+	return bytes;
+}
+
+
+static size_t BenchLinearView(BinaryView* bv, DisassemblySettings* settings)
+{
+	Ref<LinearViewObject> root = LinearViewObject::CreateDisassembly(bv, settings);
+	Ref<LinearViewCursor> cursor = new LinearViewCursor(root);
+	size_t count = 0;
+	for (cursor->SeekToBegin(); !cursor->IsAfterEnd() && count < MaxLinearLines; cursor->Next())
+		count += cursor->GetLines().size();
+	return count;
+}
+
+
+static nlohmann::json BenchmarkFile(const string& fileName, size_t iterations)
+{
+	nlohmann::json json;
+	json["file"] = fileName;
+
+	// Opening is timed once, repeating it would mostly measure the analysis cache
+	auto start = Clock::now();
+	Ref<BinaryView> bv = Load(fileName, false);
+	auto opened = Clock::now();
+	if (!bv)
+	{
+		json["error"] = "failed to open";
+		return json;
+	}
+	bv->UpdateAnalysisAndWait();
+	auto analyzed = Clock::now();
+
+	json["view_type"] = bv->GetTypeName();
+	json["open_ns"] = chrono::duration_cast<chrono::nanoseconds>(opened - start).count();
+	json["analysis_ns"] = chrono::duration_cast<chrono::nanoseconds>(analyzed - opened).count();
+	json["function_count"] = bv->GetAnalysisFunctionList().size();
+
+	vector<Ref<Function>> functions = GetBenchmarkFunctions(bv);
+	Ref<DisassemblySettings> settings = DisassemblySettings::GetDefaultLinearSettings();
+	vector<string> mangledNames;
+	for (auto& sym : bv->GetSymbols())
+	{
+		const string name = sym->GetRawName();
+		if (name.rfind("_Z", 0) == 0 || name.rfind("__Z", 0) == 0 || name.rfind("?", 0) == 0)
+			mangledNames.push_back(name);
+	}
+
+	vector<BNStringReference> strings = bv->GetStrings();
+
+	vector<BenchmarkResult> results;
+	results.push_back(RunBenchmark("binary_reader_read32", iterations, [&]() { return BenchReader(bv); }));
+	results.push_back(RunBenchmark("get_symbols", iterations, [&]() { return bv->GetSymbols().size(); }));
+	results.push_back(RunBenchmark(
+		"get_code_references", iterations, [&]() { return BenchCodeReferences(bv, functions); }));
+	results.push_back(RunBenchmark("llil_visit_exprs", iterations, [&]() { return BenchLowLevelIL(functions); }));
+	results.push_back(RunBenchmark("mlil_visit_exprs", iterations, [&]() { return BenchMediumLevelIL(functions); }));
+	results.push_back(RunBenchmark("hlil_visit_exprs", iterations, [&]() { return BenchHighLevelIL(functions); }));
+	results.push_back(RunBenchmark("pseudo_c_lines", iterations, [&]() { return BenchPseudoC(functions, settings); }));
+	results.push_back(RunBenchmark("demangle", iterations, [&]() { return BenchDemangle(bv, mangledNames); }));
+	results.push_back(
+		RunBenchmark("string_contents_utf8", iterations, [&]() { return BenchStringContents(bv, strings); }));
+	results.push_back(RunBenchmark("linear_view_lines", iterations, [&]() { return BenchLinearView(bv, settings); }));
+
+	json["benchmarks"] = nlohmann::json::array();
+	for (auto& result : results)
+		json["benchmarks"].push_back(ResultToJson(result));
+
+	// Close the file so that the resources can be freed
+	bv->GetFile()->Close();
+	return json;
+}
+
+
+int main(int argc, char* argv[])
+{
+	size_t iterations = 5;
+	string outputPath;
+	vector<string> files;
+	for (int i = 1; i < argc; i++)
+	{
+		string arg = argv[i];
+		if (arg == "--iterations" && i + 1 < argc)
+			iterations = max<size_t>(1, strtoul(argv[++i], nullptr, 10));
+		else if (arg == "--output" && i + 1 < argc)
+			outputPath = argv[++i];
+		else
+			files.push_back(arg);
+	}
+
+	if (files.empty())
+	{
+		cerr << "USAGE: " << argv[0] << " [--iterations N] [--output results.json] <file>..." << endl;
+		return -1;
+	}
+
+	/* In order to initiate the bundled plugins properly, the location
+	 * of where bundled plugins directory is must be set. */
+	SetBundledPluginDirectory(GetBundledPluginDirectory());
+	auto start = Clock::now();
+	InitPlugins();
+	auto initialized = Clock::now();
+
+	nlohmann::json report;
+	report["version"] = GetVersionString();
+	report["iterations"] = iterations;
+	report["init_plugins_ns"] = chrono::duration_cast<chrono::nanoseconds>(initialized - start).count();
+	report["files"] = nlohmann::json::array();
+	for (auto& file : files)
+		report["files"].push_back(BenchmarkFile(file, iterations));
+
+	if (outputPath.empty())
+	{
+		cout << report.dump(2) << endl;
+	}
+	else
+	{
+		ofstream out(outputPath);
+		out << report.dump(2) << endl;
+	}
+
+	// Shutting down is required to allow for clean exit of the core
+	BNShutdown();
+
+	return 0;
+}
@@ -0,0 +1,184 @@
+// Headless checks of API behaviour that callers depend on. Exits non-zero if any check fails.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "binaryninjaapi.h"
+#include "lowlevelilinstruction.h"
+#include "mediumlevelilinstruction.h"
+
+using namespace BinaryNinja;
+using namespace std;
+
+static size_t g_failures = 0;
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			g_failures++; \
+		} \
+	} while (0)
+
+
+template <typename Instruction, typename Operation>
+static vector<Operation> VisitOrder(const Instruction& instr)
+{
+	vector<Operation> order;
+	// Through std::function, as existing visitors do, which forwards to the explicit stack traversal
+	std::function<bool(const Instruction&)> visitor = [&](const Instruction& expr) {
+		order.push_back(expr.operation);
+		return true;
+	};
+	instr.VisitExprs(visitor);
+	return order;
+}
+
+
+// VisitExprs is pre-order with operands in the order they appear in the expression
+static void TestLowLevelILVisitOrder(Architecture* arch)
+{
+	Ref<LowLevelILFunction> il = new LowLevelILFunction(arch);
+	uint32_t sp = arch->GetStackPointerRegister();
+
+	ExprId store = il->Store(8, il->Register(8, sp), il->Const(8, 1));
+	CHECK((VisitOrder<LowLevelILInstruction, BNLowLevelILOperation>(il->GetExpr(store))
+	       == vector<BNLowLevelILOperation> {LLIL_STORE, LLIL_REG, LLIL_CONST}));
+
+	ExprId add = il->Add(8, il->Register(8, sp), il->Const(8, 2));
+	CHECK((VisitOrder<LowLevelILInstruction, BNLowLevelILOperation>(il->GetExpr(add))
+	       == vector<BNLowLevelILOperation> {LLIL_ADD, LLIL_REG, LLIL_CONST}));
+
+	ExprId call = il->CallSSA({}, il->ConstPointer(8, 0x1000), {il->Register(8, sp), il->Const(8, 3)},
+	    SSARegister(sp, 0), 1, 0);
+	CHECK((VisitOrder<LowLevelILInstruction, BNLowLevelILOperation>(il->GetExpr(call))
+	       == vector<BNLowLevelILOperation> {LLIL_CALL_SSA, LLIL_CONST_PTR, LLIL_REG, LLIL_CONST}));
+}
+
+
+static void TestMediumLevelILVisitOrder(Architecture* arch)
+{
+	Ref<MediumLevelILFunction> il = new MediumLevelILFunction(arch);
+	Variable var(RegisterVariableSourceType, 0, arch->GetStackPointerRegister());
+
+	ExprId store = il->Store(8, il->Var(8, var), il->Const(8, 1));
+	CHECK((VisitOrder<MediumLevelILInstruction, BNMediumLevelILOperation>(il->GetExpr(store))
+	       == vector<BNMediumLevelILOperation> {MLIL_STORE, MLIL_VAR, MLIL_CONST}));
+
+	ExprId add = il->Add(8, il->Var(8, var), il->Const(8, 2));
+	CHECK((VisitOrder<MediumLevelILInstruction, BNMediumLevelILOperation>(il->GetExpr(add))
+	       == vector<BNMediumLevelILOperation> {MLIL_ADD, MLIL_VAR, MLIL_CONST}));
+
+	ExprId call = il->Call({}, il->ConstPointer(8, 0x1000), {il->Var(8, var), il->Const(8, 3)});
+	CHECK((VisitOrder<MediumLevelILInstruction, BNMediumLevelILOperation>(il->GetExpr(call))
+	       == vector<BNMediumLevelILOperation> {MLIL_CALL, MLIL_CONST_PTR, MLIL_VAR, MLIL_CONST}));
+}
+
+
+// Turning buffering off and on again must drop the window, so writes made in between are seen
+static void TestBufferedReaderRefresh()
+{
+	DataBuffer contents(16);
+	for (size_t i = 0; i < contents.GetLength(); i++)
+		contents[i] = (uint8_t)i;
+	Ref<FileMetadata> file = new FileMetadata();
+	Ref<BinaryView> view = new BinaryData(file, contents);
+
+	BinaryReader reader(view);
+	reader.SetBuffered(true);
+	CHECK(reader.Read32() == 0x03020100);
+
+	reader.SetBuffered(false);
+	uint8_t patch[4] = {0xaa, 0xbb, 0xcc, 0xdd};
+	CHECK(view->Write(0, patch, sizeof(patch)) == sizeof(patch));
+	reader.SetBuffered(true);
+
+	reader.Seek(0);
+	CHECK(reader.Read32() == 0xddccbbaa);
+	reader.Seek(8);
+	CHECK(reader.Read32() == 0x0b0a0908);
+}
+
+
+// Memory that takes a while to read, so asynchronous reads are still queued when their accessor goes away
+class SlowMemoryAccessor : public FileAccessor
+{
+	vector<uint8_t> m_data;
+
+  public:
+	SlowMemoryAccessor(size_t size) : m_data(size)
+	{
+		for (size_t i = 0; i < size; i++)
+			m_data[i] = (uint8_t)(i >> 8);
+	}
+
+	bool IsValid() const override { return true; }
+	uint64_t GetLength() const override { return m_data.size(); }
+
+	size_t Read(void* dest, uint64_t offset, size_t len) override
+	{
+		this_thread::sleep_for(chrono::milliseconds(1));
+		if (offset >= m_data.size())
+			return 0;
+		len = min<size_t>(len, m_data.size() - offset);
+		memcpy(dest, m_data.data() + offset, len);
+		return len;
+	}
+
+	size_t Write(uint64_t, const void*, size_t) override { return 0; }
+};
+
+
+// Destroying a PrefetchingFileAccessor must still call every queued ReadAsync callback
+static void TestPrefetchingAccessorCompletesReads()
+{
+	SlowMemoryAccessor memory(0x1000);
+	atomic<size_t> completed = 0;
+	atomic<size_t> correct = 0;
+	{
+		PrefetchingFileAccessor accessor(&memory, 1, 0x100);
+		for (uint64_t offset = 0; offset < 0x1000; offset += 0x100)
+		{
+			accessor.ReadAsync(offset, 4, [&, offset](DataBuffer data) {
+				completed++;
+				if (data.GetLength() == 4 && data[0] == (uint8_t)(offset >> 8))
+					correct++;
+			});
+		}
+	}
+	CHECK(completed == 16);
+	CHECK(correct == 16);
+}
+
+
+int main()
+{
+	SetBundledPluginDirectory(GetBundledPluginDirectory());
+	InitPlugins();
+
+	Ref<Architecture> arch = Architecture::GetByName("x86_64");
+	if (!arch)
+	{
+		fprintf(stderr, "x86_64 architecture is not available\n");
+		return 1;
+	}
+
+	TestLowLevelILVisitOrder(arch);
+	TestMediumLevelILVisitOrder(arch);
+	TestBufferedReaderRefresh();
+	TestPrefetchingAccessorCompletesReads();
+
+	BNShutdown();
+	if (g_failures)
+		fprintf(stderr, "%zu checks failed\n", g_failures);
+	return g_failures ? 1 : 0;
+}
@@ -0,0 +1,672 @@
+/*
+ * Streaming exporter of the Low or Medium Level IL of every function in a binary.
+ *
+ * Functions are lifted on a thread per core and written as soon as each one is done, so memory use doesn't
+ * grow with the size of the binary. The output is a compact binary format instead of text, meant to be
+ * memory mapped by the readers in the Python (binaryninja.ilexport) and Rust (binaryninja::il_export) APIs:
+ *
+ *   il_export [--mlil] [--threads N] <input file> <output.bnil>
+ *
+ * Format, version 1. Everything is little endian and every 8 byte column is 8 byte aligned.
+ *
+ *   Header
+ *     char[4]  magic "BNIL"
+ *     u32      version
+ *     u32      level (0 = LLIL, 1 = MLIL)
+ *     u32      function count
+ *     u64      string table offset
+ *     u64      function index offset
+ *
+ *   Function, once per function, in the order they finished
+ *     u64      start address
+ *     u32      name (string)
+ *     u32      architecture name (string)
+ *     u32      instruction count
+ *     u32      expression count
+ *     u32      operand count
+ *     u32      reserved
+ *     u32      root expression of each instruction [instruction count]     padded to 8
+ *     u64      address of each expression          [expression count]
+ *     u32      first operand of each expression    [expression count + 1]
+ *     u16      operation of each expression        [expression count]
+ *     u8       size of each expression             [expression count]      padded to 8
+ *     u64      operand values                      [operand count]
+ *     u8       operand kinds (ILExportOperandKind) [operand count]         padded to 8
+ *
+ *   String table
+ *     u32      string count
+ *     u32      reserved
+ *     u64      offset of each string from the end of this array [string count + 1]
+ *     u8       UTF-8 text of every string, without terminators
+ *
+ *   Function index
+ *     u64      offset of each function, sorted by start address [function count]
+ *
+ * Expressions are numbered per function in post order, so the operands of an expression only refer to
+ * expressions before it. Names of registers, flags, intrinsics, variables and the text of types are stored
+ * once in the string table and referred to by index.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "binaryninjacore.h"
+#include "binaryninjaapi.h"
+#include "lowlevelilinstruction.h"
+#include "mediumlevelilinstruction.h"
+
+using namespace BinaryNinja;
+using namespace std;
+
+static constexpr uint32_t FormatVersion = 1;
+
+// Kind of each operand value; kinds marked as strings are indices into the string table
+enum ILExportOperandKind : uint8_t
+{
+	IntegerOperandKind = 0,
+	IndexOperandKind = 1,
+	ExprOperandKind = 2,
+	RegisterOperandKind = 3,  // string
+	RegisterStackOperandKind = 4,  // string
+	FlagOperandKind = 5,  // string
+	FlagConditionOperandKind = 6,
+	IntrinsicOperandKind = 7,  // string
+	SemanticFlagClassOperandKind = 8,  // string
+	SemanticFlagGroupOperandKind = 9,  // string
+	VersionOperandKind = 10,  // SSA version of the operand before it
+	ListOperandKind = 11,  // value is the number of operands after it that are the elements of the list
+	VariableOperandKind = 12,  // string, followed by the type of the variable
+	TypeOperandKind = 13,  // string
+	ConstantStateOperandKind = 14,  // BNRegisterValueType, followed by the value and size
+};
+
+
+static bool IsStringKind(uint8_t kind)
+{
+	switch (kind)
+	{
+	case RegisterOperandKind:
+	case RegisterStackOperandKind:
+	case FlagOperandKind:
+	case IntrinsicOperandKind:
+	case SemanticFlagClassOperandKind:
+	case SemanticFlagGroupOperandKind:
+	case VariableOperandKind:
+	case TypeOperandKind:
+		return true;
+	default:
+		return false;
+	}
+}
+
+
+// Columns of one function, with strings numbered locally until the function is written
+struct FunctionBlock
+{
+	uint64_t start = 0;
+	uint32_t name = 0;
+	uint32_t arch = 0;
+	vector<uint32_t> instructions;
+	vector<uint64_t> addresses;
+	vector<uint32_t> operandStarts {0};
+	vector<uint16_t> opcodes;
+	vector<uint8_t> sizes;
+	vector<uint64_t> operandValues;
+	vector<uint8_t> operandKinds;
+
+	vector<string> strings;
+	unordered_map<string, uint32_t> stringIndices;
+
+	uint32_t AddString(const string& str)
+	{
+		auto [i, inserted] = stringIndices.try_emplace(str, (uint32_t)strings.size());
+		if (inserted)
+			strings.push_back(str);
+		return i->second;
+	}
+};
+
+
+// Operands of the expression being encoded, collected before they are appended since encoding the
+// subexpressions they refer to appends those first
+class OperandList
+{
+	FunctionBlock& m_block;
+	vector<pair<uint8_t, uint64_t>> m_operands;
+
+  public:
+	OperandList(FunctionBlock& block) : m_block(block) {}
+
+	void Add(uint8_t kind, uint64_t value) { m_operands.emplace_back(kind, value); }
+	void AddString(uint8_t kind, const string& str) { m_operands.emplace_back(kind, m_block.AddString(str)); }
+	void AddList(size_t count) { m_operands.emplace_back(ListOperandKind, count); }
+
+	uint32_t Finish(uint16_t operation, size_t size, uint64_t address)
+	{
+		uint32_t index = (uint32_t)m_block.opcodes.size();
+		m_block.opcodes.push_back(operation);
+		m_block.sizes.push_back((uint8_t)min<size_t>(size, 0xff));
+		m_block.addresses.push_back(address);
+		for (auto& [kind, value] : m_operands)
+		{
+			m_block.operandKinds.push_back(kind);
+			m_block.operandValues.push_back(value);
+		}
+		m_block.operandStarts.push_back((uint32_t)m_block.operandValues.size());
+		return index;
+	}
+};
+
+
+static string RegisterName(Architecture* arch, uint32_t reg)
+{
+	if (LLIL_REG_IS_TEMP(reg))
+		return "temp" + to_string(LLIL_GET_TEMP_REG_INDEX(reg));
+	return arch->GetRegisterName(reg);
+}
+
+
+static string FlagName(Architecture* arch, uint32_t flag)
+{
+	if (LLIL_REG_IS_TEMP(flag))
+		return "cond:" + to_string(LLIL_GET_TEMP_REG_INDEX(flag));
+	return arch->GetFlagName(flag);
+}
+
+
+static uint32_t EncodeExpr(FunctionBlock& block, Architecture* arch, const LowLevelILInstruction& instr,
+	unordered_map<size_t, uint32_t>& encoded)
+{
+	auto found = encoded.find(instr.exprIndex);
+	if (found != encoded.end())
+		return found->second;
+
+	OperandList operands(block);
+	for (auto& operand : instr.GetOperands())
+	{
+		switch (operand.GetType())
+		{
+		case IntegerLowLevelOperand:
+			operands.Add(IntegerOperandKind, operand.GetInteger());
+			break;
+		case IndexLowLevelOperand:
+			operands.Add(IndexOperandKind, operand.GetIndex());
+			break;
+		case ExprLowLevelOperand:
+			operands.Add(ExprOperandKind, EncodeExpr(block, arch, operand.GetExpr(), encoded));
+			break;
+		case RegisterLowLevelOperand:
+			operands.AddString(RegisterOperandKind, RegisterName(arch, operand.GetRegister()));
+			break;
+		case RegisterStackLowLevelOperand:
+			operands.AddString(RegisterStackOperandKind, arch->GetRegisterStackName(operand.GetRegisterStack()));
+			break;
+		case FlagLowLevelOperand:
+			operands.AddString(FlagOperandKind, FlagName(arch, operand.GetFlag()));
+			break;
+		case FlagConditionLowLevelOperand:
+			operands.Add(FlagConditionOperandKind, operand.GetFlagCondition());
+			break;
+		case IntrinsicLowLevelOperand:
+			operands.AddString(IntrinsicOperandKind, arch->GetIntrinsicName(operand.GetIntrinsic()));
+			break;
+		case SemanticFlagClassLowLevelOperand:
+			operands.AddString(
+				SemanticFlagClassOperandKind, arch->GetSemanticFlagClassName(operand.GetSemanticFlagClass()));
+			break;
+		case SemanticFlagGroupLowLevelOperand:
+			operands.AddString(
+				SemanticFlagGroupOperandKind, arch->GetSemanticFlagGroupName(operand.GetSemanticFlagGroup()));
+			break;
+		case SSARegisterLowLevelOperand:
+			operands.AddString(RegisterOperandKind, RegisterName(arch, operand.GetSSARegister().reg));
+			operands.Add(VersionOperandKind, operand.GetSSARegister().version);
+			break;
+		case SSARegisterStackLowLevelOperand:
+			operands.AddString(
+				RegisterStackOperandKind, arch->GetRegisterStackName(operand.GetSSARegisterStack().regStack));
+			operands.Add(VersionOperandKind, operand.GetSSARegisterStack().version);
+			break;
+		case SSAFlagLowLevelOperand:
+			operands.AddString(FlagOperandKind, FlagName(arch, operand.GetSSAFlag().flag));
+			operands.Add(VersionOperandKind, operand.GetSSAFlag().version);
+			break;
+		case IndexListLowLevelOperand:
+		{
+			auto list = operand.GetIndexList();
+			operands.AddList(list.size());
+			for (auto i : list)
+				operands.Add(IndexOperandKind, i);
+			break;
+		}
+		case IndexMapLowLevelOperand:
+		{
+			auto map = operand.GetIndexMap();
+			operands.AddList(map.size() * 2);
+			for (auto i : map)
+			{
+				operands.Add(IntegerOperandKind, i.first);
+				operands.Add(IndexOperandKind, i.second);
+			}
+			break;
+		}
+		case ExprListLowLevelOperand:
+		{
+			auto list = operand.GetExprList();
+			operands.AddList(list.size());
+			for (auto i : list)
+				operands.Add(ExprOperandKind, EncodeExpr(block, arch, i, encoded));
+			break;
+		}
+		case RegisterOrFlagListLowLevelOperand:
+		{
+			auto list = operand.GetRegisterOrFlagList();
+			operands.AddList(list.size());
+			for (auto i : list)
+			{
+				if (i.IsFlag())
+					operands.AddString(FlagOperandKind, FlagName(arch, i.GetFlag()));
+				else
+					operands.AddString(RegisterOperandKind, RegisterName(arch, i.GetRegister()));
+			}
+			break;
+		}
+		case SSARegisterListLowLevelOperand:
+		{
+			auto list = operand.GetSSARegisterList();
+			operands.AddList(list.size() * 2);
+			for (auto i : list)
+			{
+				operands.AddString(RegisterOperandKind, RegisterName(arch, i.reg));
+				operands.Add(VersionOperandKind, i.version);
+			}
+			break;
+		}
+		case SSARegisterStackListLowLevelOperand:
+		{
+			auto list = operand.GetSSARegisterStackList();
+			operands.AddList(list.size() * 2);
+			for (auto i : list)
+			{
+				operands.AddString(RegisterStackOperandKind, arch->GetRegisterStackName(i.regStack));
+				operands.Add(VersionOperandKind, i.version);
+			}
+			break;
+		}
+		case SSAFlagListLowLevelOperand:
+		{
+			auto list = operand.GetSSAFlagList();
+			operands.AddList(list.size() * 2);
+			for (auto i : list)
+			{
+				operands.AddString(FlagOperandKind, FlagName(arch, i.flag));
+				operands.Add(VersionOperandKind, i.version);
+			}
+			break;
+		}
+		case SSARegisterOrFlagListLowLevelOperand:
+		{
+			auto list = operand.GetSSARegisterOrFlagList();
+			operands.AddList(list.size() * 2);
+			for (auto i : list)
+			{
+				if (i.regOrFlag.IsFlag())
+					operands.AddString(FlagOperandKind, FlagName(arch, i.regOrFlag.GetFlag()));
+				else
+					operands.AddString(RegisterOperandKind, RegisterName(arch, i.regOrFlag.GetRegister()));
+				operands.Add(VersionOperandKind, i.version);
+			}
+			break;
+		}
+		case RegisterStackAdjustmentsLowLevelOperand:
+		{
+			auto adjustments = operand.GetRegisterStackAdjustments();
+			operands.AddList(adjustments.size() * 2);
+			for (auto& [regStack, adjustment] : adjustments)
+			{
+				operands.AddString(RegisterStackOperandKind, arch->GetRegisterStackName(regStack));
+				operands.Add(IntegerOperandKind, (uint64_t)(int64_t)adjustment);
+			}
+			break;
+		}
+		}
+	}
+
+	uint32_t index = operands.Finish((uint16_t)instr.operation, instr.size, instr.address);
+	encoded[instr.exprIndex] = index;
+	return index;
+}
+
+
+static void AddVariable(OperandList& operands, Function* func, const Variable& var)
+{
+	operands.AddString(VariableOperandKind, func->GetVariableNameOrDefault(var));
+	Confidence<Ref<Type>> type = func->GetVariableType(var);
+	operands.AddString(TypeOperandKind, type.GetValue() ? type->GetString() : string());
+}
+
+
+static uint32_t EncodeExpr(FunctionBlock& block, Function* func, const MediumLevelILInstruction& instr,
+	unordered_map<size_t, uint32_t>& encoded)
+{
+	auto found = encoded.find(instr.exprIndex);
+	if (found != encoded.end())
+		return found->second;
+
+	OperandList operands(block);
+	for (auto& operand : instr.GetOperands())
+	{
+		switch (operand.GetType())
+		{
+		case IntegerMediumLevelOperand:
+			operands.Add(IntegerOperandKind, operand.GetInteger());
+			break;
+		case ConstantDataMediumLevelOperand:
+		{
+			ConstantData data = operand.GetConstantData();
+			operands.Add(ConstantStateOperandKind, data.state);
+			operands.Add(IntegerOperandKind, (uint64_t)data.value);
+			operands.Add(IntegerOperandKind, data.size);
+			break;
+		}
+		case IndexMediumLevelOperand:
+			operands.Add(IndexOperandKind, operand.GetIndex());
+			break;
+		case IntrinsicMediumLevelOperand:
+			operands.AddString(IntrinsicOperandKind, func->GetArchitecture()->GetIntrinsicName(operand.GetIntrinsic()));
+			break;
+		case ExprMediumLevelOperand:
+			operands.Add(ExprOperandKind, EncodeExpr(block, func, operand.GetExpr(), encoded));
+			break;
+		case VariableMediumLevelOperand:
+			AddVariable(operands, func, operand.GetVariable());
+			break;
+		case SSAVariableMediumLevelOperand:
+			AddVariable(operands, func, operand.GetSSAVariable().var);
+			operands.Add(VersionOperandKind, operand.GetSSAVariable().version);
+			break;
+		case IndexListMediumLevelOperand:
+		{
+			auto list = operand.GetIndexList();
+			operands.AddList(list.size());
+			for (auto i : list)
+				operands.Add(IndexOperandKind, i);
+			break;
+		}
+		case IndexMapMediumLevelOperand:
+		{
+			auto map = operand.GetIndexMap();
+			operands.AddList(map.size() * 2);
+			for (auto i : map)
+			{
+				operands.Add(IntegerOperandKind, i.first);
+				operands.Add(IndexOperandKind, i.second);
+			}
+			break;
+		}
+		case VariableListMediumLevelOperand:
+		{
+			auto list = operand.GetVariableList();
+			operands.AddList(list.size() * 2);
+			for (auto i : list)
+				AddVariable(operands, func, i);
+			break;
+		}
+		case SSAVariableListMediumLevelOperand:
+		{
+			auto list = operand.GetSSAVariableList();
+			operands.AddList(list.size() * 3);
+			for (auto i : list)
+			{
+				AddVariable(operands, func, i.var);
+				operands.Add(VersionOperandKind, i.version);
+			}
+			break;
+		}
+		case ExprListMediumLevelOperand:
+		{
+			auto list = operand.GetExprList();
+			operands.AddList(list.size());
+			for (auto i : list)
+				operands.Add(ExprOperandKind, EncodeExpr(block, func, i, encoded));
+			break;
+		}
+		}
+	}
+
+	uint32_t index = operands.Finish((uint16_t)instr.operation, instr.size, instr.address);
+	encoded[instr.exprIndex] = index;
+	return index;
+}
+
+
+static bool EncodeFunction(Function* func, bool mlil, FunctionBlock& block)
+{
+	block.start = func->GetStart();
+	Ref<Symbol> sym = func->GetSymbol();
+	block.name = block.AddString(sym ? sym->GetFullName() : string());
+	block.arch = block.AddString(func->GetArchitecture()->GetName());
+
+	unordered_map<size_t, uint32_t> encoded;
+	if (mlil)
+	{
+		Ref<MediumLevelILFunction> il = func->GetMediumLevelIL();
+		if (!il)
+			return false;
+		for (size_t i = 0; i < il->GetInstructionCount(); i++)
+			block.instructions.push_back(EncodeExpr(block, func, il->GetInstruction(i), encoded));
+	}
+	else
+	{
+		Ref<LowLevelILFunction> il = func->GetLowLevelIL();
+		if (!il)
+			return false;
+		Ref<Architecture> arch = il->GetArchitecture();
+		for (size_t i = 0; i < il->GetInstructionCount(); i++)
+			block.instructions.push_back(EncodeExpr(block, arch, il->GetInstruction(i), encoded));
+	}
+	return true;
+}
+
+
+// Appends functions to the output as they are encoded, merging their strings into one table
+class ILExportWriter
+{
+	ofstream m_out;
+	uint64_t m_offset = 0;
+	uint32_t m_level;
+	mutex m_mutex;
+	vector<string> m_strings;
+	unordered_map<string, uint32_t> m_stringIndices;
+	vector<pair<uint64_t, uint64_t>> m_functions;
+
+	template <typename T>
+	void Write(const T& value)
+	{
+		m_out.write((const char*)&value, sizeof(T));
+		m_offset += sizeof(T);
+	}
+
+	template <typename T>
+	void WriteColumn(const vector<T>& column)
+	{
+		m_out.write((const char*)column.data(), column.size() * sizeof(T));
+		m_offset += column.size() * sizeof(T);
+	}
+
+	void Align()
+	{
+		static const char padding[8] = {};
+		m_out.write(padding, (8 - (m_offset % 8)) % 8);
+		m_offset += (8 - (m_offset % 8)) % 8;
+	}
+
+	void WriteHeader(uint32_t functionCount, uint64_t stringsOffset, uint64_t indexOffset)
+	{
+		m_out.write("BNIL", 4);
+		m_offset += 4;
+		Write(FormatVersion);
+		Write(m_level);
+		Write(functionCount);
+		Write(stringsOffset);
+		Write(indexOffset);
+	}
+
+  public:
+	ILExportWriter(const string& path, bool mlil) : m_out(path, ios::binary), m_level(mlil ? 1 : 0)
+	{
+		// Rewritten with the real offsets once everything else is
+		WriteHeader(0, 0, 0);
+	}
+
+	bool IsValid() const { return m_out.good(); }
+
+	void WriteFunction(FunctionBlock& block)
+	{
+		unique_lock<mutex> lock(m_mutex);
+
+		vector<uint32_t> remap(block.strings.size());
+		for (size_t i = 0; i < block.strings.size(); i++)
+		{
+			auto [j, inserted] = m_stringIndices.try_emplace(block.strings[i], (uint32_t)m_strings.size());
+			if (inserted)
+				m_strings.push_back(block.strings[i]);
+			remap[i] = j->second;
+		}
+		for (size_t i = 0; i < block.operandKinds.size(); i++)
+		{
+			if (IsStringKind(block.operandKinds[i]))
+				block.operandValues[i] = remap[block.operandValues[i]];
+		}
+
+		m_functions.emplace_back(block.start, m_offset);
+		Write(block.start);
+		Write(remap[block.name]);
+		Write(remap[block.arch]);
+		Write((uint32_t)block.instructions.size());
+		Write((uint32_t)block.opcodes.size());
+		Write((uint32_t)block.operandValues.size());
+		Write((uint32_t)0);
+		WriteColumn(block.instructions);
+		Align();
+		WriteColumn(block.addresses);
+		WriteColumn(block.operandStarts);
+		WriteColumn(block.opcodes);
+		WriteColumn(block.sizes);
+		Align();
+		WriteColumn(block.operandValues);
+		WriteColumn(block.operandKinds);
+		Align();
+	}
+
+	bool Finish()
+	{
+		uint64_t stringsOffset = m_offset;
+		Write((uint32_t)m_strings.size());
+		Write((uint32_t)0);
+		uint64_t stringOffset = 0;
+		for (auto& str : m_strings)
+		{
+			Write(stringOffset);
+			stringOffset += str.size();
+		}
+		Write(stringOffset);
+		for (auto& str : m_strings)
+		{
+			m_out.write(str.data(), str.size());
+			m_offset += str.size();
+		}
+		Align();
+
+		uint64_t indexOffset = m_offset;
+		sort(m_functions.begin(), m_functions.end());
+		for (auto& function : m_functions)
+			Write(function.second);
+
+		m_out.seekp(0);
+		m_offset = 0;
+		WriteHeader((uint32_t)m_functions.size(), stringsOffset, indexOffset);
+		m_out.close();
+		return !m_out.fail();
+	}
+};
+
+
+int main(int argc, char* argv[])
+{
+	bool mlil = false;
+	size_t threadCount = max(thread::hardware_concurrency(), 1u);
+	vector<string> paths;
+	for (int i = 1; i < argc; i++)
+	{
+		string arg = argv[i];
+		if (arg == "--mlil")
+			mlil = true;
+		else if (arg == "--threads" && i + 1 < argc)
+			threadCount = max<size_t>(1, strtoul(argv[++i], nullptr, 10));
+		else
+			paths.push_back(arg);
+	}
+
+	if (paths.size() != 2)
+	{
+		fprintf(stderr, "USAGE: %s [--mlil] [--threads N] <input file> <output.bnil>\n", argv[0]);
+		return 1;
+	}
+
+	// In order to initiate the bundled plugins properly, the location
+	// of where bundled plugins directory is must be set.
+	SetBundledPluginDirectory(GetBundledPluginDirectory());
+	InitPlugins();
+
+	Ref<BinaryView> bv = BinaryNinja::Load(paths[0]);
+	if (!bv || bv->GetTypeName() == "Raw")
+	{
+		fprintf(stderr, "Input file does not appear to be an executable\n");
+		return -1;
+	}
+
+	ILExportWriter writer(paths[1], mlil);
+	if (!writer.IsValid())
+	{
+		fprintf(stderr, "Unable to open %s for writing\n", paths[1].c_str());
+		return -1;
+	}
+
+	vector<Ref<Function>> functions = bv->GetAnalysisFunctionList();
+	atomic<size_t> next(0);
+	auto worker = [&]() {
+		for (size_t i = next++; i < functions.size(); i = next++)
+		{
+			FunctionBlock block;
+			if (EncodeFunction(functions[i], mlil, block))
+				writer.WriteFunction(block);
+		}
+	};
+
+	vector<thread> threads;
+	for (size_t i = 1; i < min(threadCount, functions.size()); i++)
+		threads.emplace_back(worker);
+	worker();
+	for (auto& t : threads)
+		t.join();
+
+	bool ok = writer.Finish();
+	if (!ok)
+		fprintf(stderr, "Failed to write %s\n", paths[1].c_str());
+
+	// Close the file so that the resources can be freed
+	bv->GetFile()->Close();
+
+	// Shutting down is required to allow for clean exit of the core
+	BNShutdown();
+
+	return ok ? 0 : -1;
+}
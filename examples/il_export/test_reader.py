@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+# Tests for the binaryninja.ilexport reader. It doesn't need the core, so it is loaded straight from the source
+# tree and this runs without Binary Ninja installed:
+#   python3 test_reader.py
+
+import importlib.util
+import os
+import struct
+import tempfile
+import unittest
+
+_ilexport_path = os.path.join(os.path.dirname(__file__), "..", "..", "python", "ilexport.py")
+_spec = importlib.util.spec_from_file_location("ilexport", _ilexport_path)
+ilexport = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(ilexport)
+
+
+def _pad(data: bytearray) -> None:
+	data.extend(b"\0" * (-len(data) % 8))
+
+
+def build_export() -> bytes:
+	"""An export with one function `main` made of `eax = 1`, laid out the way the exporter writes it"""
+	strings = [b"main", b"x86_64", b"eax"]
+	data = bytearray(32)
+
+	function_offset = len(data)
+	data += struct.pack("<QIIIIII", 0x1000, 0, 1, 1, 2, 2, 0)
+	data += struct.pack("<I", 1)
+	_pad(data)
+	data += struct.pack("<QQ", 0x1000, 0x1000)
+	data += struct.pack("<III", 0, 1, 2)
+	# LLIL_CONST, LLIL_SET_REG
+	data += struct.pack("<HH", 9, 1)
+	data += bytes([4, 4])
+	_pad(data)
+	# The constant, then the index of "eax" in the string table
+	data += struct.pack("<QQ", 1, 2)
+	data += bytes([0, 3])
+	_pad(data)
+
+	strings_offset = len(data)
+	data += struct.pack("<II", len(strings), 0)
+	offset = 0
+	for string in strings:
+		data += struct.pack("<Q", offset)
+		offset += len(string)
+	data += struct.pack("<Q", offset)
+	data += b"".join(strings)
+	_pad(data)
+
+	index_offset = len(data)
+	data += struct.pack("<Q", function_offset)
+
+	data[0:32] = struct.pack("<4sIIIQQ", b"BNIL", 1, 0, 1, strings_offset, index_offset)
+	return bytes(data)
+
+
+class ILExportFileTest(unittest.TestCase):
+	def setUp(self):
+		fd, self.path = tempfile.mkstemp(suffix=".bnil")
+		with os.fdopen(fd, "wb") as f:
+			f.write(build_export())
+
+	def tearDown(self):
+		os.remove(self.path)
+
+	def test_documented_example(self):
+		# The example from the ILExportFile docstring, which keeps `func` alive past the end of the with block
+		lengths = []
+		with ilexport.ILExportFile(self.path) as export:
+			for func in export:
+				lengths.append((func.name, len(func.operations)))
+		self.assertEqual(lengths, [("main", 2)])
+		with self.assertRaises(ValueError):
+			len(func.operations)
+
+	def test_read_export(self):
+		with ilexport.ILExportFile(self.path) as export:
+			self.assertEqual(export.level, ilexport.ILExportLevel.LowLevelIL)
+			self.assertEqual(len(export), 1)
+			self.assertEqual(export.string_count, 3)
+
+			func = export[0]
+			self.assertEqual(func.start, 0x1000)
+			self.assertEqual(func.arch, "x86_64")
+			self.assertEqual(list(func.instructions), [1])
+			self.assertEqual(list(func.operations), [9, 1])
+			self.assertEqual(func.operands(0), [(ilexport.ILExportOperandKind.Integer, 1)])
+			self.assertEqual(func.operands(1), [(ilexport.ILExportOperandKind.Register, "eax")])
+
+	def test_invalid_export(self):
+		with open(self.path, "r+b") as f:
+			f.write(b"XNIL")
+		with self.assertRaises(ValueError):
+			ilexport.ILExportFile(self.path)
+
+
+if __name__ == "__main__":
+	unittest.main()
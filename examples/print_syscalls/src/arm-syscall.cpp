@@ -54,14 +54,14 @@ int main(int argc, char* argv[])
 	auto arch = bv->GetDefaultArchitecture();
 	auto platform = bv->GetDefaultPlatform();
 
-	auto cc = platform->GetSystemCallConvention();
+	auto cc = platform->GetCachedCallingConventions()->systemCallConvention;
 	if (!cc)
 	{
 		cerr << "Error: No system call conventions found for " << platform->GetName() << endl;
 		exit(-1);
 	}
 
-	auto reg = cc->GetIntegerArgumentRegisters()[0];
+	auto reg = cc->GetCachedInfo()->integerArgumentRegisters[0];
 
 	for (Function* func : bv->GetAnalysisFunctionList())
 	{
@@ -24,6 +24,8 @@ ByteView::ByteView(QWidget* parent, BinaryViewRef data) : QAbstractScrollArea(pa
 	setBinaryDataNavigable(true);
 	setupView(this);
 	m_data = data;
+	// Repaints read the same lines again, shared with the other widgets showing this view
+	m_pageCache = BinaryNinja::ViewPageCache::GetForView(m_data);
 
 	setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
 	setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
@@ -314,7 +316,7 @@ ByteViewLine ByteView::createLine(uint64_t addr, size_t length, bool separator)
 	}
 	else
 	{
-		BinaryNinja::DataBuffer data = m_data->ReadBuffer(addr, length);
+		BinaryNinja::DataBuffer data = m_pageCache->ReadBuffer(addr, length);
 		QString line;
 		for (size_t i = 0; i < data.GetLength(); i++)
 			line.append(QString(g_byteMapping[data[i]]));
@@ -645,7 +647,7 @@ void ByteView::paintEvent(QPaintEvent* event)
 			p.drawRect(
 			    2 + ((int)m_addrWidth + 2 + cursorCol) * charWidth, 2 + y * charHeight, charWidth, charHeight + 1);
 			QColor caretTextColor = palette().color(QPalette::Base);
-			BinaryNinja::DataBuffer byteValue = m_data->ReadBuffer(lineStartAddr + cursorCol, 1);
+			BinaryNinja::DataBuffer byteValue = m_pageCache->ReadBuffer(lineStartAddr + cursorCol, 1);
 			if (byteValue.GetLength() == 1)
 			{
 				QString byteStr = g_byteMapping[byteValue[0]];
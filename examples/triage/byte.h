@@ -17,6 +17,7 @@ struct ByteViewLine
 class ByteView : public QAbstractScrollArea, public View
 {
 	BinaryViewRef m_data;
+	std::shared_ptr<BinaryNinja::ViewPageCache> m_pageCache;
 	RenderContext m_render;
 
 	uint64_t m_cursorAddr, m_prevCursorAddr, m_selectionStartAddr, m_topAddr, m_bottomAddr;
@@ -25,32 +25,46 @@ EntropyThread::~EntropyThread()
 
 void EntropyThread::Run()
 {
-	int width = m_image->width();
-	for (int i = 0; i < width; i++)
-	{
-		if (!m_running)
-			break;
-		std::vector<float> entropy =
-		    m_data->GetEntropy(m_data->GetStart() + ((uint64_t)i * m_blockSize), m_blockSize, m_blockSize);
-		int v;
-		if (entropy.size() == 0)
-			v = 0;
-		else
-			v = (int)(entropy[0] * 255);
-		if (v >= 240)
-		{
-			QColor color = getThemeColor(YellowStandardHighlightColor);
-			m_image->setPixelColor(i, 0, color);
-		}
-		else
+	// Columns are computed in batches, each with a single entropy request, spread over a few threads
+	static constexpr int ColumnsPerBatch = 256;
+
+	const int width = m_image->width();
+	const QColor highColor = getThemeColor(YellowStandardHighlightColor);
+	const QColor baseColor = getThemeColor(FeatureMapBaseColor);
+	const QColor entropyColor = getThemeColor(BlueStandardHighlightColor);
+
+	std::atomic<int> nextBatch = 0;
+	std::mutex imageMutex;
+	auto worker = [&]() {
+		while (m_running)
 		{
-			QColor baseColor = getThemeColor(FeatureMapBaseColor);
-			QColor entropyColor = getThemeColor(BlueStandardHighlightColor);
-			QColor color = mixColor(baseColor, entropyColor, (uint8_t)v);
-			m_image->setPixelColor(i, 0, color);
+			int first = (nextBatch++) * ColumnsPerBatch;
+			if (first >= width)
+				break;
+			int count = std::min(ColumnsPerBatch, width - first);
+			std::vector<float> entropy = m_data->GetEntropy(m_data->GetStart() + ((uint64_t)first * m_blockSize),
+			    (size_t)count * m_blockSize, m_blockSize);
+
+			std::unique_lock<std::mutex> lock(imageMutex);
+			for (int i = 0; i < count; i++)
+			{
+				int v = (i < (int)entropy.size()) ? (int)(entropy[i] * 255) : 0;
+				if (v >= 240)
+					m_image->setPixelColor(first + i, 0, highColor);
+				else
+					m_image->setPixelColor(first + i, 0, mixColor(baseColor, entropyColor, (uint8_t)v));
+			}
+			m_updated = true;
 		}
-		m_updated = true;
-	}
+	};
+
+	size_t threadCount = std::max(1u, std::min(std::thread::hardware_concurrency(), 4u));
+	std::vector<std::thread> workers;
+	for (size_t i = 1; i < threadCount; i++)
+		workers.emplace_back(worker);
+	worker();
+	for (auto& i : workers)
+		i.join();
 }
 
 
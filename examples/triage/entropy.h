@@ -2,6 +2,8 @@
 
 #include <QtWidgets/QWidget>
 #include <QtGui/QImage>
+#include <atomic>
+#include <mutex>
 #include <thread>
 #include "uitypes.h"
 
@@ -11,7 +13,7 @@ class EntropyThread
 	BinaryViewRef m_data;
 	QImage* m_image;
 	size_t m_blockSize;
-	bool m_updated, m_running;
+	std::atomic<bool> m_updated, m_running;
 	std::thread m_thread;
 
   public:
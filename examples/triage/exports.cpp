@@ -14,10 +14,11 @@ const int ColumnCount = 3;
 const int ColumnVisibleRole = Qt::UserRole;
 
 
-GenericExportsModel::GenericExportsModel(QWidget* parent, BinaryViewRef data): QAbstractItemModel(parent), BinaryDataNotification(FunctionUpdates | SymbolUpdates)
+GenericExportsModel::GenericExportsModel(QWidget* parent, BinaryViewRef data, TriageTasks* tasks): QAbstractItemModel(parent), BinaryDataNotification(FunctionUpdates | SymbolUpdates)
 {
 	m_sortOrder = Qt::AscendingOrder;
 	m_data = data;
+	m_tasks = tasks;
 	m_hasOrdinals = false;
 	if (data->GetTypeName() == "PE")
 	{
@@ -37,7 +38,6 @@ GenericExportsModel::GenericExportsModel(QWidget* parent, BinaryViewRef data): Q
 	m_data->RegisterNotification(this);
 
 	updateModel();
-	m_entries = m_allEntries;
 }
 
 
@@ -47,23 +47,35 @@ GenericExportsModel::~GenericExportsModel()
 }
 
 
-void GenericExportsModel::updateModel()
+std::vector<SymbolRef> GenericExportsModel::collectSymbols(BinaryViewRef data, const std::atomic<bool>& cancelled)
 {
-	beginResetModel();
-	m_allEntries.clear();
-	for (auto& sym : m_data->GetSymbolsOfType(FunctionSymbol))
-	{
-		if ((sym->GetBinding() == GlobalBinding) || (sym->GetBinding() == WeakBinding))
-			m_allEntries.push_back(sym);
-	}
-	for (auto& sym : m_data->GetSymbolsOfType(DataSymbol))
+	std::vector<SymbolRef> result;
+	for (auto type : {FunctionSymbol, DataSymbol})
 	{
-		if ((sym->GetBinding() == GlobalBinding) || (sym->GetBinding() == WeakBinding))
-			m_allEntries.push_back(sym);
+		for (auto& sym : data->GetSymbolsOfType(type))
+		{
+			if (cancelled)
+				return result;
+			if ((sym->GetBinding() == GlobalBinding) || (sym->GetBinding() == WeakBinding))
+				result.push_back(sym);
+		}
 	}
-	endResetModel();
+	return result;
+}
+
 
-	setFilter(m_filter);
+void GenericExportsModel::updateModel()
+{
+	size_t generation = ++m_updateGeneration;
+	BinaryViewRef data = m_data;
+	m_tasks->run(
+	    this, [data](const std::atomic<bool>& cancelled) { return collectSymbols(data, cancelled); },
+	    [this, generation](std::vector<SymbolRef> symbols) {
+		    if (generation != m_updateGeneration)
+			    return;
+		    m_allEntries = std::move(symbols);
+		    setFilter(m_filter);
+	    });
 }
 
 
@@ -289,7 +301,7 @@ ExportsTreeView::ExportsTreeView(ExportsWidget* parent, TriageView* view, Binary
 
 	setFont(getMonospaceFont(this));
 
-	m_model = new GenericExportsModel(this, m_data);
+	m_model = new GenericExportsModel(this, m_data, &m_view->getTasks());
 	setModel(m_model);
 	setRootIsDecorated(false);
 	setUniformRowHeights(true);
@@ -4,6 +4,7 @@
 #include <QtCore/QTimer>
 #include <QtWidgets/QTreeView>
 #include "filter.h"
+#include "tasks.h"
 
 
 class GenericExportsModel : public QAbstractItemModel, public BinaryNinja::BinaryDataNotification
@@ -17,7 +18,11 @@ class GenericExportsModel : public QAbstractItemModel, public BinaryNinja::Binar
 	int m_sortCol;
 	bool m_hasOrdinals;
 	QTimer* m_updateTimer;
+	TriageTasks* m_tasks;
+	// Incremented for every update so a slower, older collection can't replace a newer one
+	size_t m_updateGeneration = 0;
 
+	static std::vector<SymbolRef> collectSymbols(BinaryViewRef data, const std::atomic<bool>& cancelled);
 	void performSort(int col, Qt::SortOrder order);
 	void updateModel();
 
@@ -25,7 +30,7 @@ class GenericExportsModel : public QAbstractItemModel, public BinaryNinja::Binar
 	void modelUpdate();
 
   public:
-	GenericExportsModel(QWidget* parent, BinaryViewRef data);
+	GenericExportsModel(QWidget* parent, BinaryViewRef data, TriageTasks* tasks);
 	virtual ~GenericExportsModel();
 
 	virtual int columnCount(const QModelIndex& parent) const override;
@@ -15,7 +15,13 @@ GenericImportsModel::GenericImportsModel(QWidget* parent, BinaryViewRef data) :
 	m_totalCols = 3;
 	m_sortCol = 0;
 	m_sortOrder = Qt::AscendingOrder;
-	m_allEntries = data->GetSymbolsOfType(ImportAddressSymbol);
+}
+
+
+void GenericImportsModel::setSymbols(std::vector<SymbolRef> symbols)
+{
+	beginResetModel();
+	m_allEntries = std::move(symbols);
 	for (auto& sym : m_allEntries)
 	{
 		if ((sym->GetNameSpace().size() != 1) || (sym->GetNameSpace()[0] != "BNINTERNALNAMESPACE"))
@@ -33,6 +39,8 @@ GenericImportsModel::GenericImportsModel(QWidget* parent, BinaryViewRef data) :
 		m_totalCols = 5;
 	}
 	m_entries = m_allEntries;
+	performSort(m_sortCol, m_sortOrder);
+	endResetModel();
 }
 
 
@@ -238,10 +246,17 @@ ImportsTreeView::ImportsTreeView(ImportsWidget* parent, TriageView* view, Binary
 	setUniformRowHeights(true);
 	setSortingEnabled(true);
 	sortByColumn(0, Qt::AscendingOrder);
-	if (m_model->HasOrdinalCol())
-		setColumnWidth(m_model->GetOrdinalCol(), 55);
-	setColumnWidth(m_model->GetTypeLibCol(), 90);
-	resizeColumnToContents(m_model->GetNameCol());
+
+	// The columns depend on the symbols, so they are sized once those have been read
+	m_view->getTasks().run(
+	    this, [data](const std::atomic<bool>&) { return data->GetSymbolsOfType(ImportAddressSymbol); },
+	    [this](std::vector<SymbolRef> symbols) {
+		    m_model->setSymbols(std::move(symbols));
+		    if (m_model->HasOrdinalCol())
+			    setColumnWidth(m_model->GetOrdinalCol(), 55);
+		    setColumnWidth(m_model->GetTypeLibCol(), 90);
+		    resizeColumnToContents(m_model->GetNameCol());
+	    });
 
 	connect(selectionModel(), &QItemSelectionModel::currentChanged, this, &ImportsTreeView::importSelected);
 	connect(this, &QTreeView::doubleClicked, this, &ImportsTreeView::importDoubleClicked);
@@ -9,7 +9,7 @@ class GenericImportsModel : public QAbstractItemModel
 {
 	BinaryViewRef m_data;
 	std::vector<SymbolRef> m_allEntries, m_entries;
-	bool m_hasModules;
+	bool m_hasModules = false;
 	int m_nameCol, m_moduleCol, m_ordinalCol, m_typeLibCol;
 	int m_totalCols, m_sortCol;
 	Qt::SortOrder m_sortOrder;
@@ -20,6 +20,7 @@ class GenericImportsModel : public QAbstractItemModel
 
   public:
 	GenericImportsModel(QWidget* parent, BinaryViewRef data);
+	void setSymbols(std::vector<SymbolRef> symbols);
 
 	virtual int columnCount(const QModelIndex& parent) const override;
 	virtual int rowCount(const QModelIndex& parent) const override;
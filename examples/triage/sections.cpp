@@ -7,19 +7,37 @@
 #include "fontsettings.h"
 
 
-SegmentsWidget::SegmentsWidget(QWidget* parent, BinaryViewRef data) : QWidget(parent)
+SegmentsWidget::SegmentsWidget(QWidget* parent, BinaryViewRef data, TriageTasks& tasks) : QWidget(parent)
 {
-	QGridLayout* layout = new QGridLayout();
-	layout->setContentsMargins(0, 0, 0, 0);
-	layout->setVerticalSpacing(1);
-	layout->setHorizontalSpacing(UIContext::getScaledWindowSize(16, 16).width());
+	m_layout = new QGridLayout();
+	m_layout->setContentsMargins(0, 0, 0, 0);
+	m_layout->setVerticalSpacing(1);
+	m_layout->setHorizontalSpacing(UIContext::getScaledWindowSize(16, 16).width());
+	m_layout->setColumnStretch(2, 1);
+	setLayout(m_layout);
+
+	tasks.run(
+	    this,
+	    [data](const std::atomic<bool>&) {
+		    std::vector<SegmentRef> segments;
+		    for (auto& segment : data->GetSegments())
+			    if ((segment->GetFlags() & (SegmentReadable | SegmentWritable | SegmentExecutable)) != 0)
+				    segments.push_back(segment);
+		    sort(segments.begin(), segments.end(),
+		        [&](SegmentRef a, SegmentRef b) { return a->GetStart() < b->GetStart(); });
+		    return segments;
+	    },
+	    [this](std::vector<SegmentRef> segments) {
+		    m_segments = std::move(segments);
+		    addRows();
+		    emit populated();
+	    });
+}
 
-	for (auto& segment : data->GetSegments())
-		if ((segment->GetFlags() & (SegmentReadable | SegmentWritable | SegmentExecutable)) != 0)
-			m_segments.push_back(segment);
-	sort(m_segments.begin(), m_segments.end(),
-	    [&](SegmentRef a, SegmentRef b) { return a->GetStart() < b->GetStart(); });
 
+void SegmentsWidget::addRows()
+{
+	QGridLayout* layout = m_layout;
 	int row = 0;
 	for (auto& segment : m_segments)
 	{
@@ -57,66 +75,89 @@ SegmentsWidget::SegmentsWidget(QWidget* parent, BinaryViewRef data) : QWidget(pa
 
 		row++;
 	}
-
-	layout->setColumnStretch(2, 1);
-	setLayout(layout);
 }
 
 
-SectionsWidget::SectionsWidget(QWidget* parent, BinaryViewRef data) : QWidget(parent)
+SectionsWidget::SectionsWidget(QWidget* parent, BinaryViewRef data, TriageTasks& tasks) : QWidget(parent)
 {
-	QGridLayout* layout = new QGridLayout();
-	layout->setContentsMargins(0, 0, 0, 0);
-	layout->setVerticalSpacing(1);
-	layout->setHorizontalSpacing(UIContext::getScaledWindowSize(16, 16).width());
-
-	size_t maxNameLen = 0;
-	for (auto& section : data->GetSections())
-		if (section->GetName().size() > maxNameLen)
-			maxNameLen = section->GetName().size();
-	if (maxNameLen > 32)
-		maxNameLen = 32;
-
-	for (auto& section : data->GetSections())
-		if (section->GetSemantics() != ExternalSectionSemantics)
-			m_sections.push_back(section);
-	sort(m_sections.begin(), m_sections.end(),
-	    [&](SectionRef a, SectionRef b) { return a->GetStart() < b->GetStart(); });
+	m_layout = new QGridLayout();
+	m_layout->setContentsMargins(0, 0, 0, 0);
+	m_layout->setVerticalSpacing(1);
+	m_layout->setHorizontalSpacing(UIContext::getScaledWindowSize(16, 16).width());
+	m_layout->setColumnStretch(5, 1);
+	setLayout(m_layout);
+
+	tasks.run(
+	    this,
+	    [data](const std::atomic<bool>& cancelled) {
+		    std::vector<SectionRef> sections = data->GetSections();
+		    size_t maxNameLen = 0;
+		    for (auto& section : sections)
+			    if (section->GetName().size() > maxNameLen)
+				    maxNameLen = section->GetName().size();
+		    if (maxNameLen > 32)
+			    maxNameLen = 32;
+
+		    std::vector<SectionRow> rows;
+		    for (auto& section : sections)
+		    {
+			    if (cancelled)
+				    break;
+			    if (section->GetSemantics() == ExternalSectionSemantics)
+				    continue;
+
+			    SectionRow row;
+			    row.section = section;
+			    row.name = section->GetName();
+			    if (row.name.size() > maxNameLen)
+				    row.name = row.name.substr(0, maxNameLen - 1) + std::string("…");
+			    row.typeName = QString::fromStdString(section->GetType());
+
+			    if (data->IsOffsetReadable(section->GetStart()))
+				    row.permissions += "r";
+			    else
+				    row.permissions += "-";
+			    if (data->IsOffsetWritable(section->GetStart()))
+				    row.permissions += "w";
+			    else
+				    row.permissions += "-";
+			    if (data->IsOffsetExecutable(section->GetStart()))
+				    row.permissions += "x";
+			    else
+				    row.permissions += "-";
+
+			    if (section->GetSemantics() == ReadOnlyCodeSectionSemantics)
+				    row.semantics = "Code";
+			    else if (section->GetSemantics() == ReadOnlyDataSectionSemantics)
+				    row.semantics = "Read-only Data";
+			    else if (section->GetSemantics() == ReadWriteDataSectionSemantics)
+				    row.semantics = "Writable Data";
+			    rows.push_back(std::move(row));
+		    }
+		    sort(rows.begin(), rows.end(),
+		        [&](const SectionRow& a, const SectionRow& b) { return a.section->GetStart() < b.section->GetStart(); });
+		    return rows;
+	    },
+	    [this](std::vector<SectionRow> rows) {
+		    addRows(rows);
+		    emit populated();
+	    });
+}
+
 
+void SectionsWidget::addRows(const std::vector<SectionRow>& rows)
+{
+	QGridLayout* layout = m_layout;
 	int row = 0;
-	for (auto& section : m_sections)
+	for (auto& sectionRow : rows)
 	{
-		std::string name = section->GetName();
-		if (name.size() > maxNameLen)
-			name = name.substr(0, maxNameLen - 1) + std::string("…");
+		SectionRef section = sectionRow.section;
+		m_sections.push_back(section);
 
 		QString begin = QString("0x") + QString::number(section->GetStart(), 16);
 		QString end = QString("0x") + QString::number(section->GetStart() + section->GetLength(), 16);
-		QString typeName = QString::fromStdString(section->GetType());
-
-		QString permissions;
-		if (data->IsOffsetReadable(section->GetStart()))
-			permissions += "r";
-		else
-			permissions += "-";
-		if (data->IsOffsetWritable(section->GetStart()))
-			permissions += "w";
-		else
-			permissions += "-";
-		if (data->IsOffsetExecutable(section->GetStart()))
-			permissions += "x";
-		else
-			permissions += "-";
-
-		QString semantics;
-		if (section->GetSemantics() == ReadOnlyCodeSectionSemantics)
-			semantics = "Code";
-		else if (section->GetSemantics() == ReadOnlyDataSectionSemantics)
-			semantics = "Read-only Data";
-		else if (section->GetSemantics() == ReadWriteDataSectionSemantics)
-			semantics = "Writable Data";
 
-		QLabel* nameLabel = new QLabel(QString::fromStdString(name));
+		QLabel* nameLabel = new QLabel(QString::fromStdString(sectionRow.name));
 		nameLabel->setFont(getMonospaceFont(this));
 		layout->addWidget(nameLabel, row, 0);
 
@@ -131,19 +172,16 @@ SectionsWidget::SectionsWidget(QWidget* parent, BinaryViewRef data) : QWidget(pa
 		rangeLayout->addWidget(endLabel);
 		layout->addLayout(rangeLayout, row, 1);
 
-		QLabel* permissionsLabel = new QLabel(permissions);
+		QLabel* permissionsLabel = new QLabel(sectionRow.permissions);
 		permissionsLabel->setFont(getMonospaceFont(this));
 		layout->addWidget(permissionsLabel, row, 2);
-		QLabel* typeLabel = new QLabel(typeName);
+		QLabel* typeLabel = new QLabel(sectionRow.typeName);
 		typeLabel->setFont(getMonospaceFont(this));
 		layout->addWidget(typeLabel, row, 3);
-		QLabel* semanticsLabel = new QLabel(semantics);
+		QLabel* semanticsLabel = new QLabel(sectionRow.semantics);
 		semanticsLabel->setFont(getMonospaceFont(this));
 		layout->addWidget(semanticsLabel, row, 4);
 
 		row++;
 	}
-
-	layout->setColumnStretch(5, 1);
-	setLayout(layout);
 }
@@ -1,24 +1,51 @@
 #pragma once
 
+#include <QtWidgets/QGridLayout>
 #include <QtWidgets/QWidget>
 #include "uitypes.h"
+#include "tasks.h"
 
 
+// Segments and sections are read on a worker thread, populated() is emitted once their rows have been added
+
 class SegmentsWidget : public QWidget
 {
+	Q_OBJECT
+
+	QGridLayout* m_layout;
 	std::vector<SegmentRef> m_segments;
 
+	void addRows();
+
+  signals:
+	void populated();
+
   public:
-	SegmentsWidget(QWidget* parent, BinaryViewRef data);
+	SegmentsWidget(QWidget* parent, BinaryViewRef data, TriageTasks& tasks);
 	const std::vector<SegmentRef>& GetSegments() const { return m_segments; }
 };
 
 
 class SectionsWidget : public QWidget
 {
+	Q_OBJECT
+
+	struct SectionRow
+	{
+		SectionRef section;
+		std::string name;
+		QString typeName, permissions, semantics;
+	};
+
+	QGridLayout* m_layout;
 	std::vector<SectionRef> m_sections;
 
+	void addRows(const std::vector<SectionRow>& rows);
+
+  signals:
+	void populated();
+
   public:
-	SectionsWidget(QWidget* parent, BinaryViewRef data);
+	SectionsWidget(QWidget* parent, BinaryViewRef data, TriageTasks& tasks);
 	const std::vector<SectionRef>& GetSections() const { return m_sections; }
 };
@@ -1,10 +1,19 @@
 #include <string.h>
+#include <QtCore/QCoreApplication>
 #include <algorithm>
+#include <numeric>
 #include "strings.h"
 #include "view.h"
 #include "fontsettings.h"
 
 
+// Strings are decoded in chunks so the first ones are available while the rest decode
+static constexpr size_t DecodeChunkSize = 4096;
+
+// A chunk whose strings lie within this many bytes is read from the view all at once
+static constexpr uint64_t MaxChunkReadLength = 0x100000;
+
+
 GenericStringsModel::GenericStringsModel(QWidget* parent, BinaryViewRef data) : QAbstractItemModel(parent)
 {
 	m_data = data;
@@ -12,7 +21,83 @@ GenericStringsModel::GenericStringsModel(QWidget* parent, BinaryViewRef data) :
 	m_sortCol = 0;
 	m_sortOrder = Qt::AscendingOrder;
 	m_allEntries = data->GetStrings();
-	m_entries = m_allEntries;
+	m_entries.resize(m_allEntries.size());
+	std::iota(m_entries.begin(), m_entries.end(), 0);
+
+	// Filtering and sorting by contents use the decoded strings instead of reading them from the view again
+	m_strings.reserve(m_allEntries.size());
+	m_decodeCancelled = false;
+	m_decodeThread = std::thread([=]() { decodeStrings(); });
+}
+
+
+GenericStringsModel::~GenericStringsModel()
+{
+	m_decodeCancelled = true;
+	if (m_decodeThread.joinable())
+		m_decodeThread.join();
+}
+
+
+void GenericStringsModel::decodeStrings()
+{
+	for (size_t start = 0; (start < m_allEntries.size()) && !m_decodeCancelled; start += DecodeChunkSize)
+	{
+		size_t end = std::min(start + DecodeChunkSize, m_allEntries.size());
+		uint64_t spanStart = UINT64_MAX, spanEnd = 0;
+		for (size_t i = start; i < end; i++)
+		{
+			spanStart = std::min(spanStart, m_allEntries[i].start);
+			spanEnd = std::max(spanEnd, m_allEntries[i].start + m_allEntries[i].length);
+		}
+		BinaryNinja::DataBuffer span;
+		if (spanEnd - spanStart <= MaxChunkReadLength)
+			span = m_data->ReadBuffer(spanStart, spanEnd - spanStart);
+
+		auto strings = std::make_shared<std::vector<std::string>>();
+		strings->reserve(end - start);
+		for (size_t i = start; i < end; i++)
+		{
+			const BNStringReference& stringRef = m_allEntries[i];
+			uint64_t offset = stringRef.start - spanStart;
+			if (offset + stringRef.length <= span.GetLength())
+			{
+				const uint8_t* data = (const uint8_t*)span.GetData() + offset;
+				strings->push_back(decodeString(stringRef, data, stringRef.length).toStdString());
+			}
+			else
+			{
+				// Either the chunk was too spread out or the span read stopped at a gap
+				strings->push_back(stringRefToQString(stringRef).toStdString());
+			}
+		}
+
+		QMetaObject::invokeMethod(
+			this, [this, start, strings]() { addDecodedStrings(start, *strings); }, Qt::QueuedConnection);
+	}
+}
+
+
+void GenericStringsModel::addDecodedStrings(size_t start, std::vector<std::string>& strings)
+{
+	// Chunks arrive in order, anything else was already decoded by finishDecoding
+	if (start != m_strings.size())
+		return;
+	m_strings.insert(m_strings.end(), std::make_move_iterator(strings.begin()), std::make_move_iterator(strings.end()));
+}
+
+
+void GenericStringsModel::finishDecoding()
+{
+	if (m_strings.size() == m_allEntries.size())
+		return;
+
+	// Let the thread finish and take the chunks it has queued, then decode whatever is still missing
+	if (m_decodeThread.joinable())
+		m_decodeThread.join();
+	QCoreApplication::sendPostedEvents(this, QEvent::MetaCall);
+	for (size_t i = m_strings.size(); i < m_allEntries.size(); i++)
+		m_strings.push_back(stringRefToQString(m_allEntries[i]).toStdString());
 }
 
 
@@ -35,15 +120,22 @@ QVariant GenericStringsModel::data(const QModelIndex& index, int role) const
 	switch (role)
 	{
 	case Qt::DisplayRole:
+	{
 		if (!index.isValid() || index.row() >= (int)m_entries.size())
 			return QVariant();
+		size_t entry = m_entries[index.row()];
 		if (index.column() == 0)
-			return QString("0x") + QString::number(m_entries[index.row()].start, 16);
+			return QString("0x") + QString::number(m_allEntries[entry].start, 16);
 		if (index.column() == 1)
-			return QString::number(m_entries[index.row()].length);
+			return QString::number(m_allEntries[entry].length);
 		if (index.column() == 2)
-			return stringRefToQString(m_entries[index.row()]).replace("\n", "\\n");
+		{
+			QString string = (entry < m_strings.size()) ? QString::fromStdString(m_strings[entry])
+			                                             : stringRefToQString(m_allEntries[entry]);
+			return string.replace("\n", "\\n");
+		}
 		break;
+	}
 	case Qt::ForegroundRole:
 		if (index.column() == 0)
 			return getThemeColor(AddressColor);
@@ -88,28 +180,20 @@ QModelIndex GenericStringsModel::parent(const QModelIndex&) const
 }
 
 
-QString GenericStringsModel::stringRefToQString(const BNStringReference& stringRef) const
+QString GenericStringsModel::decodeString(const BNStringReference& stringRef, const uint8_t* data, size_t len)
 {
-	QString qstr;
-	BinaryNinja::DataBuffer stringBuffer = m_data->ReadBuffer(stringRef.start, stringRef.length);
-
 	if (stringRef.type == BNStringType::Utf32String)
-	{	
-		char32_t* data = (char32_t*)stringBuffer.GetData();
-		qstr = QString::fromUcs4(data, stringRef.length / 4);
-	} 
-	else if (stringRef.type == BNStringType::Utf16String)
-	{
-		char16_t* data = (char16_t*)stringBuffer.GetData();
-		qstr = QString::fromUtf16(data, stringRef.length / 2);
-	}
-	else 
-	{
-		char* data = (char*)stringBuffer.GetData();
-		qstr = QString::fromUtf8(data, stringBuffer.GetLength());
-	}
+		return QString::fromUcs4((const char32_t*)data, len / 4);
+	if (stringRef.type == BNStringType::Utf16String)
+		return QString::fromUtf16((const char16_t*)data, len / 2);
+	return QString::fromUtf8((const char*)data, len);
+}
 
-	return qstr;
+
+QString GenericStringsModel::stringRefToQString(const BNStringReference& stringRef) const
+{
+	BinaryNinja::DataBuffer stringBuffer = m_data->ReadBuffer(stringRef.start, stringRef.length);
+	return decodeString(stringRef, (const uint8_t*)stringBuffer.GetData(), stringBuffer.GetLength());
 }
 
 
@@ -117,36 +201,23 @@ BNStringReference GenericStringsModel::getStringRefAt(const QModelIndex& index)
 {
 	if (!index.isValid() || index.row() >= (int)m_entries.size())
 		return BNStringReference{};
-	return m_entries[index.row()];
+	return m_allEntries[m_entries[index.row()]];
 }
 
 void GenericStringsModel::performSort(int col, Qt::SortOrder order)
 {
-	std::sort(m_entries.begin(), m_entries.end(), [&](BNStringReference a, BNStringReference b) {
-		if (col == 0)
-		{
-			if (order == Qt::AscendingOrder)
-				return a.start < b.start;
-			else
-				return a.start > b.start;
-		}
-		else if (col == 1)
-		{
-			if (order == Qt::AscendingOrder)
-				return a.length < b.length;
-			else
-				return a.length > b.length;
-		}
-		else if (col == 2)
-		{	
-			QString s = stringRefToQString(a);
-			QString s2 = stringRefToQString(b);
+	if (col == 2)
+		finishDecoding();
 
-			if (order == Qt::AscendingOrder)
-				return s < s2;
-			else
-				return s > s2;
-		}
+	std::sort(m_entries.begin(), m_entries.end(), [&](size_t a, size_t b) {
+		if (order != Qt::AscendingOrder)
+			std::swap(a, b);
+		if (col == 0)
+			return m_allEntries[a].start < m_allEntries[b].start;
+		if (col == 1)
+			return m_allEntries[a].length < m_allEntries[b].length;
+		if (col == 2)
+			return m_strings[a] < m_strings[b];
 		return false;
 	});
 }
@@ -164,16 +235,32 @@ void GenericStringsModel::sort(int col, Qt::SortOrder order)
 
 void GenericStringsModel::setFilter(const std::string& filterText)
 {
+	finishDecoding();
+
 	beginResetModel();
+	// Typing more of the same filter can only remove rows, so only the current ones need checking and they
+	// are already sorted
+	bool narrowing = !m_filter.empty() && (filterText.compare(0, m_filter.size(), m_filter) == 0);
+	std::vector<size_t> candidates;
+	if (narrowing)
+	{
+		candidates.swap(m_entries);
+	}
+	else
+	{
+		candidates.resize(m_allEntries.size());
+		std::iota(candidates.begin(), candidates.end(), 0);
+	}
+
 	m_entries.clear();
-	for (auto& entry : m_allEntries)
+	for (size_t entry : candidates)
 	{
-		auto s = stringRefToQString(entry).toStdString();
-		
-		if (FilteredView::match(s, filterText))
+		if (FilteredView::match(m_strings[entry], filterText))
 			m_entries.push_back(entry);
 	}
-	performSort(m_sortCol, m_sortOrder);
+	if (!narrowing)
+		performSort(m_sortCol, m_sortOrder);
+	m_filter = filterText;
 	endResetModel();
 }
 
@@ -2,20 +2,35 @@
 
 #include <QtCore/QAbstractItemModel>
 #include <QtWidgets/QTreeView>
+#include <atomic>
+#include <thread>
 #include "filter.h"
 
 
 class GenericStringsModel : public QAbstractItemModel
 {
     BinaryViewRef m_data;
-	std::vector<BNStringReference> m_allEntries, m_entries;
+	std::vector<BNStringReference> m_allEntries;
+	// UTF-8 contents of m_allEntries, in the same order, decoded in chunks by m_decodeThread
+	std::vector<std::string> m_strings;
+	// Rows are indices into m_allEntries
+	std::vector<size_t> m_entries;
+	std::string m_filter;
 	int m_totalCols, m_sortCol;
 	Qt::SortOrder m_sortOrder;
+	std::atomic<bool> m_decodeCancelled;
+	std::thread m_decodeThread;
 
+	void decodeStrings();
+	void addDecodedStrings(size_t start, std::vector<std::string>& strings);
+	void finishDecoding();
 	void performSort(int col, Qt::SortOrder order);
 
+	static QString decodeString(const BNStringReference& stringRef, const uint8_t* data, size_t len);
+
   public:
 	GenericStringsModel(QWidget* parent, BinaryViewRef data);
+	virtual ~GenericStringsModel();
 
 	virtual int columnCount(const QModelIndex& parent) const override;
 	virtual int rowCount(const QModelIndex& parent) const override;
@@ -0,0 +1,50 @@
+#include "tasks.h"
+
+
+TriageTasks::TriageTasks() : m_cancelled(std::make_shared<std::atomic<bool>>(false)) {}
+
+
+TriageTasks::~TriageTasks()
+{
+	cancel();
+	std::vector<Task> tasks;
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		tasks.swap(m_tasks);
+	}
+	for (auto& task : tasks)
+		task.thread.join();
+}
+
+
+void TriageTasks::cancel()
+{
+	*m_cancelled = true;
+}
+
+
+void TriageTasks::start(std::function<void()> body)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+
+	// Models refresh through here repeatedly, so reap the tasks that have finished since the last one
+	for (auto i = m_tasks.begin(); i != m_tasks.end();)
+	{
+		if (*i->done)
+		{
+			i->thread.join();
+			i = m_tasks.erase(i);
+		}
+		else
+		{
+			++i;
+		}
+	}
+
+	auto done = std::make_shared<std::atomic<bool>>(false);
+	std::thread thread([body, done]() {
+		body();
+		*done = true;
+	});
+	m_tasks.push_back({std::move(thread), done});
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <QtCore/QObject>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+// Collects the data of the triage panes on worker threads so the view can be shown before all of it is read.
+// Every task of a view shares one cancellation token, which is set when the view is closed; results that
+// arrive after that are dropped and the destructor waits for the tasks that are still running.
+class TriageTasks
+{
+	struct Task
+	{
+		std::thread thread;
+		std::shared_ptr<std::atomic<bool>> done;
+	};
+
+	std::shared_ptr<std::atomic<bool>> m_cancelled;
+	std::mutex m_mutex;
+	std::vector<Task> m_tasks;
+
+	void start(std::function<void()> body);
+
+  public:
+	TriageTasks();
+	~TriageTasks();
+
+	void cancel();
+	bool isCancelled() const { return *m_cancelled; }
+
+	// Call collect(cancelled) on a worker thread, then apply(result) on the thread of receiver. collect
+	// should check the token between items and may return early once it is set.
+	template <typename Collect, typename Apply>
+	void run(QObject* receiver, Collect collect, Apply apply)
+	{
+		using Result = decltype(collect(std::declval<const std::atomic<bool>&>()));
+		std::shared_ptr<std::atomic<bool>> cancelled = m_cancelled;
+		start([=]() {
+			auto result = std::make_shared<Result>(collect(*cancelled));
+			if (*cancelled)
+				return;
+			QMetaObject::invokeMethod(
+			    receiver,
+			    [=]() {
+				    if (!*cancelled)
+					    apply(std::move(*result));
+			    },
+			    Qt::QueuedConnection);
+		});
+	}
+};
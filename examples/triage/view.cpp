@@ -38,21 +38,24 @@ TriageView::TriageView(QWidget* parent, BinaryViewRef data) : QScrollArea(parent
 	fileInfoGroup->setLayout(fileInfoLayout);
 	layout->addWidget(fileInfoGroup);
 
-	Headers* hdr = nullptr;
-	if (m_data->GetTypeName() == "PE")
-		hdr = new PEHeaders(m_data);
-	else if (m_data->GetTypeName() != "Raw")
-		hdr = new GenericHeaders(m_data);
-
-	if (hdr)
+	// The panes below fill themselves in from m_tasks as their data is read, closing the view cancels them
+	std::string typeName = m_data->GetTypeName();
+	if (typeName != "Raw")
 	{
 		QGroupBox* headerGroup = new QGroupBox("Headers", container);
 		QVBoxLayout* headerLayout = new QVBoxLayout();
-		HeaderWidget* headerWidget = new HeaderWidget(headerGroup, *hdr);
-		headerLayout->addWidget(headerWidget);
 		headerGroup->setLayout(headerLayout);
 		layout->addWidget(headerGroup);
-		delete hdr;
+		m_tasks.run(
+		    headerGroup,
+		    [data, typeName](const std::atomic<bool>&) -> Headers {
+			    if (typeName == "PE")
+				    return PEHeaders(data);
+			    return GenericHeaders(data);
+		    },
+		    [headerGroup, headerLayout](Headers headers) {
+			    headerLayout->addWidget(new HeaderWidget(headerGroup, headers));
+		    });
 	}
 
 	auto fileMetadata = m_data->GetFile();
@@ -102,22 +105,24 @@ TriageView::TriageView(QWidget* parent, BinaryViewRef data) : QScrollArea(parent
 		{
 			QGroupBox* segmentsGroup = new QGroupBox("Segments", container);
 			QVBoxLayout* segmentsLayout = new QVBoxLayout();
-			SegmentsWidget* segmentsWidget = new SegmentsWidget(segmentsGroup, m_data);
+			SegmentsWidget* segmentsWidget = new SegmentsWidget(segmentsGroup, m_data, m_tasks);
 			segmentsLayout->addWidget(segmentsWidget);
 			segmentsGroup->setLayout(segmentsLayout);
 			layout->addWidget(segmentsGroup);
-			if (segmentsWidget->GetSegments().size() == 0)
-				segmentsGroup->hide();
+			segmentsGroup->hide();
+			connect(segmentsWidget, &SegmentsWidget::populated, segmentsGroup,
+			    [=]() { segmentsGroup->setVisible(segmentsWidget->GetSegments().size() != 0); });
 		}
 
 		QGroupBox* sectionsGroup = new QGroupBox("Sections", container);
 		QVBoxLayout* sectionsLayout = new QVBoxLayout();
-		SectionsWidget* sectionsWidget = new SectionsWidget(sectionsGroup, m_data);
+		SectionsWidget* sectionsWidget = new SectionsWidget(sectionsGroup, m_data, m_tasks);
 		sectionsLayout->addWidget(sectionsWidget);
 		sectionsGroup->setLayout(sectionsLayout);
 		layout->addWidget(sectionsGroup);
-		if (sectionsWidget->GetSections().size() == 0)
-			sectionsGroup->hide();
+		sectionsGroup->hide();
+		connect(sectionsWidget, &SectionsWidget::populated, sectionsGroup,
+		    [=]() { sectionsGroup->setVisible(sectionsWidget->GetSections().size() != 0); });
 
 		QGroupBox* analysisInfoGroup = new QGroupBox("Analysis Info", container);
 		QVBoxLayout* analysisInfoLayout = new QVBoxLayout();
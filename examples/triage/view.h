@@ -4,6 +4,7 @@
 #include <QtWidgets/QPushButton>
 #include "viewframe.h"
 #include "byte.h"
+#include "tasks.h"
 
 
 class TriageView : public QScrollArea, public View
@@ -12,6 +13,7 @@ class TriageView : public QScrollArea, public View
 	uint64_t m_currentOffset = 0;
 	ByteView* m_byteView = nullptr;
 	QPushButton* m_fullAnalysisButton = nullptr;
+	TriageTasks m_tasks;
 
   public:
 	TriageView(QWidget* parent, BinaryViewRef data);
@@ -25,6 +27,7 @@ class TriageView : public QScrollArea, public View
 
 	void setCurrentOffset(uint64_t offset);
 	void navigateToFileOffset(uint64_t offset);
+	TriageTasks& getTasks() { return m_tasks; }
 
   protected:
 	virtual void focusInEvent(QFocusEvent* event) override;
@@ -3,7 +3,7 @@
 #include <cinttypes>
 #include <cstdint>
 #include <cstdio>
-#include <mutex>
+#include <set>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -25,26 +25,17 @@ extern "C"
 {
 	BN_DECLARE_CORE_ABI_VERSION
 
-	// TODO: Replace with analysis cache opaque datastore.
-	std::mutex g_mutex;
-	unordered_map<void*, unordered_map<uint64_t, set<uint64_t>>> g_callSiteInlines;
+	AnalysisDataStore<set<uint64_t>> g_callSiteInlines;
 
 	void FunctionInliner(Ref<AnalysisContext> analysisContext)
 	{
-		std::unique_lock<std::mutex> lock(g_mutex);
-
 		Ref<Function> function = analysisContext->GetFunction();
 		Ref<BinaryView> data = function->GetView();
-		auto gItr = g_callSiteInlines.find(data->GetObject());
-		if (gItr == g_callSiteInlines.end())
-			return;
-
-		auto itr = gItr->second.find(function->GetStart());
-		if (itr == gItr->second.end())
+		auto callSiteInlinesSnapshot = g_callSiteInlines.Get(data, function->GetStart());
+		if (!callSiteInlinesSnapshot)
 			return;
 
-		auto& callSiteInlines = itr->second;
-		lock.unlock();
+		auto& callSiteInlines = *callSiteInlinesSnapshot;
 
 		bool updated = false;
 		uint8_t opcode[BN_MAX_INSTRUCTION_LENGTH];
@@ -152,8 +143,9 @@ extern "C"
 		    [](BinaryView* view, Function* func) {
 			    // TODO func->Inform("inlinedCallSites")
 			    // TODO resolve multiple embedded inlines
-			    std::lock_guard<std::mutex> lock(g_mutex);
-			    g_callSiteInlines[view->GetObject()][func->GetStart()].insert(view->GetCurrentOffset());
+			    uint64_t callSite = view->GetCurrentOffset();
+			    g_callSiteInlines.Update(
+			        view, func->GetStart(), [&](set<uint64_t>& callSites) { callSites.insert(callSite); });
 			    func->Reanalyze();
 		    },
 		    inlinerIsValid);
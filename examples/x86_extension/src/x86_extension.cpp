@@ -15,7 +15,14 @@ using namespace asmx86;
 class x86ArchitectureExtension : public ArchitectureHook
 {
   public:
-	x86ArchitectureExtension(Architecture* x86) : ArchitectureHook(x86) {}
+	x86ArchitectureExtension(Architecture* x86) : ArchitectureHook(x86)
+	{
+		// Only lifting is changed, and only for CPUID (0f a2), so let everything else go straight to x86
+		SetHookedInstructionMethods(HookedGetInstructionLowLevelIL);
+		SetInstructionFilter([](const uint8_t* data, uint64_t, size_t len) {
+			return len >= 2 && data[0] == 0x0f && data[1] == 0xa2;
+		});
+	}
 
 	virtual bool GetInstructionLowLevelIL(
 	    const uint8_t* data, uint64_t addr, size_t& len, LowLevelILFunction& il) override
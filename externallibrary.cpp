@@ -17,9 +17,11 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
+#include <filesystem>
 #include <optional>
 #include "binaryninjaapi.h"
 #include "binaryninjacore.h"
+#include "ffi.h"
 
 using namespace BinaryNinja;
 
@@ -142,3 +144,138 @@ void ExternalLocation::SetExternalLibrary(Ref<ExternalLibrary> library)
 }
 
 
+
+
+ProjectExportIndex::ProjectExportIndex(Project* project) : m_project(project) {}
+
+
+std::shared_ptr<ProjectExportIndex> ProjectExportIndex::GetForProject(Project* project)
+{
+	return GetSharedForObject<ProjectExportIndex>(project);
+}
+
+
+std::shared_ptr<const ProjectExportIndex::Exports> ProjectExportIndex::ReadExports(ProjectFile* file)
+{
+	Ref<BinaryView> view = Load(Ref<ProjectFile>(file), false);
+	if (!view)
+		return nullptr;
+
+	auto exports = std::make_shared<Exports>();
+	for (auto& symbol : view->GetSymbols())
+	{
+		BNSymbolType type = symbol->GetType();
+		BNSymbolBinding binding = symbol->GetBinding();
+		if ((type != FunctionSymbol) && (type != DataSymbol))
+			continue;
+		if ((binding != GlobalBinding) && (binding != WeakBinding))
+			continue;
+		exports->emplace(symbol->GetRawName(), symbol->GetAddress());
+	}
+	view->GetFile()->Close();
+	return exports;
+}
+
+
+std::shared_ptr<const ProjectExportIndex::Exports> ProjectExportIndex::GetExports(ProjectFile* file)
+{
+	std::string id = file->GetId();
+	std::string key = "exportIndex." + id;
+
+	// The file on disk only changes when its contents are replaced, so its size and time tell when to rebuild
+	std::error_code error;
+	std::filesystem::path path = file->GetPathOnDisk();
+	uint64_t size = std::filesystem::file_size(path, error);
+	if (error)
+		size = 0;
+	int64_t modified = std::filesystem::last_write_time(path, error).time_since_epoch().count();
+	if (error)
+		modified = 0;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto i = m_entries.find(id);
+		if ((i != m_entries.end()) && (i->second.size == size) && (i->second.modified == modified))
+			return i->second.exports;
+	}
+
+	std::shared_ptr<const Exports> exports;
+	Ref<Metadata> stored = m_project->QueryMetadata(key);
+	if (stored && stored->IsKeyValueStore() && stored->Get("size") && stored->Get("modified")
+		&& (stored->Get("size")->GetUnsignedInteger() == size)
+		&& (stored->Get("modified")->GetSignedInteger() == modified) && stored->Get("names")
+		&& stored->Get("addresses"))
+	{
+		std::vector<std::string> names = stored->Get("names")->GetStringList();
+		std::vector<uint64_t> addresses = stored->Get("addresses")->GetUnsignedIntegerList();
+		auto loaded = std::make_shared<Exports>();
+		loaded->reserve(names.size());
+		for (size_t i = 0; (i < names.size()) && (i < addresses.size()); i++)
+			loaded->emplace(std::move(names[i]), addresses[i]);
+		exports = loaded;
+	}
+	else
+	{
+		exports = ReadExports(file);
+		if (!exports)
+			return nullptr;
+
+		std::vector<std::string> names;
+		std::vector<uint64_t> addresses;
+		names.reserve(exports->size());
+		addresses.reserve(exports->size());
+		for (auto& [name, address] : *exports)
+		{
+			names.push_back(name);
+			addresses.push_back(address);
+		}
+		std::map<std::string, Ref<Metadata>> value;
+		value["size"] = new Metadata(size);
+		value["modified"] = new Metadata(modified);
+		value["names"] = new Metadata(names);
+		value["addresses"] = new Metadata(addresses);
+		m_project->StoreMetadata(key, new Metadata(value));
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_entries[id] = Entry {size, modified, exports};
+	return exports;
+}
+
+
+std::optional<uint64_t> ProjectExportIndex::Lookup(ProjectFile* file, const std::string& name)
+{
+	auto exports = GetExports(file);
+	if (!exports)
+		return std::nullopt;
+	auto i = exports->find(name);
+	if (i == exports->end())
+		return std::nullopt;
+	return i->second;
+}
+
+
+std::optional<uint64_t> ProjectExportIndex::Resolve(ExternalLocation* location)
+{
+	if (auto address = location->GetTargetAddress())
+		return address;
+	auto symbol = location->GetTargetSymbol();
+	Ref<ExternalLibrary> library = location->GetExternalLibrary();
+	if (!symbol || !library)
+		return std::nullopt;
+	Ref<ProjectFile> file = library->GetBackingFile();
+	if (!file)
+		return std::nullopt;
+	return Lookup(file, *symbol);
+}
+
+
+void ProjectExportIndex::Invalidate(ProjectFile* file)
+{
+	std::string id = file->GetId();
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_entries.erase(id);
+	}
+	m_project->RemoveMetadata("exportIndex." + id);
+}
@@ -125,6 +125,43 @@ void BinaryNinja::AllocApiStringList(const unordered_set<string>& stringList, ch
 }
 
 
+char BN_API_PTR* BN_API_PTR* BinaryNinja::AllocApiPackedStringList(const vector<string>& stringList, size_t* count)
+{
+	*count = stringList.size();
+	size_t pointerBytes = stringList.size() * sizeof(char*);
+	size_t totalBytes = pointerBytes;
+	for (const auto& string: stringList)
+		totalBytes += string.size() + 1;
+
+	char* block = new char[totalBytes];
+	char** result = (char**)block;
+	char* cursor = block + pointerBytes;
+	for (size_t i = 0; i < stringList.size(); i++)
+	{
+		memcpy(cursor, stringList[i].c_str(), stringList[i].size() + 1);
+		result[i] = cursor;
+		cursor += stringList[i].size() + 1;
+	}
+	return result;
+}
+
+
+void BinaryNinja::FreeApiPackedStringList(char BN_API_PTR* BN_API_PTR* stringList)
+{
+	delete[] (char*)stringList;
+}
+
+
+vector<const char*> BinaryNinja::BorrowApiStringList(const vector<string>& stringList)
+{
+	vector<const char*> result;
+	result.reserve(stringList.size());
+	for (const auto& string: stringList)
+		result.push_back(string.c_str());
+	return result;
+}
+
+
 void BinaryNinja::AllocApiStringPairList(const vector<pair<string, string>>& stringPairList, char BN_API_PTR* BN_API_PTR** outputKeys, char BN_API_PTR* BN_API_PTR** outputValues, size_t* count)
 {
 	*count = stringPairList.size();
@@ -194,6 +231,12 @@ vector<string> BinaryNinja::ParseStringList(const char* const* stringList, size_
 }
 
 
+vector<string_view> BinaryNinja::ParseStringViewList(const char* const* stringList, size_t count)
+{
+	return vector<string_view>(stringList, stringList + count);
+}
+
+
 set<string> BinaryNinja::ParseStringSet(const char* const* stringList, size_t count)
 {
 	set<string> result;
@@ -1,8 +1,11 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <set>
 #include <unordered_set>
@@ -42,12 +45,25 @@ namespace BinaryNinja
 	char BN_API_PTR* BN_API_PTR* AllocApiStringList(const std::unordered_set<std::string>& stringList, size_t* count);
 	void AllocApiStringList(const std::unordered_set<std::string>& stringList, char BN_API_PTR* BN_API_PTR** output, size_t* count);
 
+	/*! Allocates a list of strings as one block: the pointer array followed by the strings it points to.
+		Only for lists that are freed by the API again, with FreeApiPackedStringList.
+	*/
+	char BN_API_PTR* BN_API_PTR* AllocApiPackedStringList(const std::vector<std::string>& stringList, size_t* count);
+	void FreeApiPackedStringList(char BN_API_PTR* BN_API_PTR* stringList);
+
+	/*! Pointers to the strings in \c stringList, for passing a list the core only reads during the call.
+		Nothing is copied, so the result is only valid while \c stringList is unchanged.
+	*/
+	std::vector<const char*> BorrowApiStringList(const std::vector<std::string>& stringList);
+
 	void AllocApiStringPairList(const std::vector<std::pair<std::string, std::string>>& stringPairList, char BN_API_PTR* BN_API_PTR** outputKeys, char BN_API_PTR* BN_API_PTR** outputValues, size_t* count);
 	void AllocApiStringPairList(const std::map<std::string, std::string>& stringPairList, char BN_API_PTR* BN_API_PTR** outputKeys, char BN_API_PTR* BN_API_PTR** outputValues, size_t* count);
 	void AllocApiStringPairList(const std::unordered_map<std::string, std::string>& stringPairList, char BN_API_PTR* BN_API_PTR** outputKeys, char BN_API_PTR* BN_API_PTR** outputValues, size_t* count);
 
 	std::string ParseString(const char* string);
 	std::vector<std::string> ParseStringList(const char* const* stringList, size_t count);
+	/*! Views of the strings in \c stringList without copying them; only valid until the list is freed */
+	std::vector<std::string_view> ParseStringViewList(const char* const* stringList, size_t count);
 	std::set<std::string> ParseStringSet(const char* const* stringList, size_t count);
 	std::unordered_set<std::string> ParseStringUnorderedSet(const char* const* stringList, size_t count);
 
@@ -145,6 +161,44 @@ namespace BinaryNinja
 
 	//endregion
 
+	//------------------------------------------------------------------------------------
+	//region Shared Per-Object State
+
+	/*!
+		The \c T shared by every caller for \c owner, created with \c T(owner) on first use and freed
+		with its last user. Entries are keyed by the owner's core handle. A live \c T holds a reference to its
+		owner, so the handle can't have been reused by another object.
+		\tparam T Type of the shared state, constructible from \c Owner*
+		\tparam Owner API object the state belongs to, such as a BinaryView or Project
+	 */
+	template<typename T, typename Owner>
+	std::shared_ptr<T> GetSharedForObject(Owner* owner)
+	{
+		using Handle = decltype(owner->GetObject());
+		static std::mutex instancesMutex;
+		static std::unordered_map<Handle, std::weak_ptr<T>> instances;
+
+		std::lock_guard<std::mutex> lock(instancesMutex);
+		for (auto i = instances.begin(); i != instances.end();)
+		{
+			if (i->second.expired())
+				i = instances.erase(i);
+			else
+				++i;
+		}
+
+		auto& entry = instances[owner->GetObject()];
+		std::shared_ptr<T> instance = entry.lock();
+		if (!instance)
+		{
+			instance = std::make_shared<T>(owner);
+			entry = instance;
+		}
+		return instance;
+	}
+
+	//endregion
+
 	//------------------------------------------------------------------------------------
 	//region Try/Catch Helpers
 
@@ -18,6 +18,10 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <thread>
 #include "binaryninjaapi.h"
 
 using namespace BinaryNinja;
@@ -76,3 +80,325 @@ size_t CoreFileAccessor::Write(uint64_t offset, const void* src, size_t len)
 {
 	return m_callbacks.write(m_callbacks.context, offset, src, len);
 }
+
+
+struct PrefetchingFileAccessor::State
+{
+	enum BlockState
+	{
+		Queued,
+		Loading,
+		Ready
+	};
+
+	struct Block
+	{
+		BlockState state;
+		uint64_t id;
+		uint64_t lastUse;
+		vector<uint8_t> data;
+	};
+
+	FileAccessor* accessor;
+	size_t blockSize;
+	size_t maxCachedBlocks;
+
+	mutex m;
+	condition_variable workAvailable;
+	condition_variable blockLoaded;
+	condition_variable idle;
+	map<uint64_t, Block> blocks;
+	deque<function<void()>> work;
+	vector<thread> workers;
+	size_t activeWorkers = 0;
+	bool stopping = false;
+
+	FileAccessPattern pattern = NormalFileAccess;
+	size_t readAhead = 8;
+	uint64_t lastReadEnd = 0;
+	uint64_t nextId = 0;
+	uint64_t useCounter = 0;
+
+	void Worker()
+	{
+		unique_lock<mutex> lock(m);
+		while (true)
+		{
+			workAvailable.wait(lock, [&]() { return stopping || !work.empty(); });
+			// Queued work is drained before stopping, so that every ReadAsync callback gets called
+			if (work.empty())
+				return;
+			function<void()> task = std::move(work.front());
+			work.pop_front();
+			activeWorkers++;
+			lock.unlock();
+			task();
+			lock.lock();
+			activeWorkers--;
+			if (work.empty() && activeWorkers == 0)
+				idle.notify_all();
+		}
+	}
+
+	// Read block index from the underlying accessor. The lock is held on entry and exit but not during the read.
+	void Load(unique_lock<mutex>& lock, uint64_t index, Block& block)
+	{
+		block.state = Loading;
+		uint64_t id = block.id;
+		lock.unlock();
+		vector<uint8_t> data(blockSize);
+		data.resize(accessor->Read(data.data(), index * blockSize, blockSize));
+		lock.lock();
+
+		// A write or invalidation may have dropped the block while it was being read; the data is stale then
+		auto i = blocks.find(index);
+		if (i != blocks.end() && i->second.id == id)
+		{
+			i->second.data = std::move(data);
+			i->second.state = Ready;
+			i->second.lastUse = ++useCounter;
+		}
+		blockLoaded.notify_all();
+	}
+
+	void Evict()
+	{
+		while (blocks.size() > maxCachedBlocks)
+		{
+			auto oldest = blocks.end();
+			for (auto i = blocks.begin(); i != blocks.end(); ++i)
+			{
+				if (i->second.state != Ready)
+					continue;
+				if (oldest == blocks.end() || i->second.lastUse < oldest->second.lastUse)
+					oldest = i;
+			}
+			if (oldest == blocks.end())
+				return;
+			blocks.erase(oldest);
+		}
+	}
+
+	void Queue(uint64_t index)
+	{
+		if (blocks.find(index) != blocks.end())
+			return;
+		uint64_t id = ++nextId;
+		blocks[index] = Block {Queued, id, ++useCounter, {}};
+		work.push_back([this, index, id]() {
+			unique_lock<mutex> lock(m);
+			// Skip blocks that a reader already took over or that were dropped since being queued
+			auto i = blocks.find(index);
+			if (i != blocks.end() && i->second.id == id && i->second.state == Queued)
+				Load(lock, index, i->second);
+		});
+		workAvailable.notify_one();
+	}
+
+	void QueueRange(uint64_t offset, uint64_t len)
+	{
+		if (len == 0)
+			return;
+		uint64_t first = offset / blockSize;
+		uint64_t last = (offset + len - 1) / blockSize;
+		// Never queue more than the cache can hold, as the first blocks would be evicted before they are used
+		last = min(last, first + maxCachedBlocks - 1);
+		for (uint64_t index = first; index <= last; index++)
+			Queue(index);
+	}
+
+	// Wait until block index is loaded, loading it on this thread if nobody else has started to
+	const Block* Get(unique_lock<mutex>& lock, uint64_t index)
+	{
+		while (true)
+		{
+			auto i = blocks.find(index);
+			if (i == blocks.end())
+			{
+				i = blocks.emplace(index, Block {Queued, ++nextId, ++useCounter, {}}).first;
+				Load(lock, index, i->second);
+				continue;
+			}
+			if (i->second.state == Ready)
+			{
+				i->second.lastUse = ++useCounter;
+				return &i->second;
+			}
+			if (i->second.state == Queued)
+			{
+				Load(lock, index, i->second);
+				continue;
+			}
+			blockLoaded.wait(lock);
+		}
+	}
+};
+
+
+PrefetchingFileAccessor::PrefetchingFileAccessor(
+    FileAccessor* accessor, size_t threadCount, size_t blockSize, size_t maxCachedBlocks) :
+    m_state(std::make_unique<State>())
+{
+	m_state->accessor = accessor;
+	m_state->blockSize = max<size_t>(blockSize, 1);
+	m_state->maxCachedBlocks = max<size_t>(maxCachedBlocks, 1);
+	for (size_t i = 0; i < threadCount; i++)
+		m_state->workers.emplace_back([this]() { m_state->Worker(); });
+}
+
+
+PrefetchingFileAccessor::~PrefetchingFileAccessor()
+{
+	{
+		unique_lock<mutex> lock(m_state->m);
+		m_state->stopping = true;
+		// Prefetches that haven't started skip their block once it is gone, asynchronous reads still complete
+		for (auto i = m_state->blocks.begin(); i != m_state->blocks.end();)
+		{
+			if (i->second.state == State::Queued)
+				i = m_state->blocks.erase(i);
+			else
+				++i;
+		}
+		m_state->workAvailable.notify_all();
+	}
+	for (auto& worker : m_state->workers)
+		worker.join();
+}
+
+
+void PrefetchingFileAccessor::SetAccessPattern(FileAccessPattern pattern)
+{
+	unique_lock<mutex> lock(m_state->m);
+	m_state->pattern = pattern;
+}
+
+
+void PrefetchingFileAccessor::SetReadAhead(size_t blocks)
+{
+	unique_lock<mutex> lock(m_state->m);
+	m_state->readAhead = blocks;
+}
+
+
+void PrefetchingFileAccessor::Prefetch(uint64_t offset, size_t len)
+{
+	unique_lock<mutex> lock(m_state->m);
+	if (m_state->workers.empty())
+		return;
+	m_state->QueueRange(offset, len);
+}
+
+
+void PrefetchingFileAccessor::Prefetch(const vector<BNAddressRange>& ranges)
+{
+	unique_lock<mutex> lock(m_state->m);
+	if (m_state->workers.empty())
+		return;
+	for (auto& range : ranges)
+	{
+		if (range.end > range.start)
+			m_state->QueueRange(range.start, range.end - range.start);
+	}
+}
+
+
+void PrefetchingFileAccessor::ReadAsync(uint64_t offset, size_t len, const function<void(DataBuffer)>& callback)
+{
+	if (m_state->workers.empty())
+	{
+		DataBuffer buffer(len);
+		buffer.SetSize(Read(buffer.GetData(), offset, len));
+		callback(std::move(buffer));
+		return;
+	}
+
+	unique_lock<mutex> lock(m_state->m);
+	// Queue the blocks first so the other workers fetch them while this read waits for the first one
+	m_state->QueueRange(offset, len);
+	m_state->work.push_back([this, offset, len, callback]() {
+		DataBuffer buffer(len);
+		buffer.SetSize(Read(buffer.GetData(), offset, len));
+		callback(std::move(buffer));
+	});
+	m_state->workAvailable.notify_one();
+}
+
+
+void PrefetchingFileAccessor::WaitForPendingReads()
+{
+	unique_lock<mutex> lock(m_state->m);
+	m_state->idle.wait(lock, [&]() { return m_state->work.empty() && m_state->activeWorkers == 0; });
+}
+
+
+void PrefetchingFileAccessor::Invalidate()
+{
+	unique_lock<mutex> lock(m_state->m);
+	m_state->blocks.clear();
+	m_state->blockLoaded.notify_all();
+}
+
+
+bool PrefetchingFileAccessor::IsValid() const
+{
+	return m_state->accessor->IsValid();
+}
+
+
+uint64_t PrefetchingFileAccessor::GetLength() const
+{
+	return m_state->accessor->GetLength();
+}
+
+
+size_t PrefetchingFileAccessor::Read(void* dest, uint64_t offset, size_t len)
+{
+	State& state = *m_state;
+	unique_lock<mutex> lock(state.m);
+
+	size_t result = 0;
+	while (result < len)
+	{
+		uint64_t index = (offset + result) / state.blockSize;
+		size_t start = (size_t)((offset + result) % state.blockSize);
+		const State::Block* block = state.Get(lock, index);
+		if (start >= block->data.size())
+			break;
+		size_t count = min(block->data.size() - start, len - result);
+		memcpy((uint8_t*)dest + result, block->data.data() + start, count);
+		result += count;
+		if (block->data.size() < state.blockSize)
+			break;
+	}
+
+	bool sequential = state.pattern == SequentialFileAccess
+		|| (state.pattern == NormalFileAccess && offset == state.lastReadEnd && offset != 0);
+	state.lastReadEnd = offset + result;
+	if (sequential && result == len && state.readAhead != 0 && !state.workers.empty() && !state.stopping)
+	{
+		uint64_t next = (offset + len + state.blockSize - 1) / state.blockSize;
+		for (uint64_t index = next; index < next + state.readAhead; index++)
+			state.Queue(index);
+	}
+
+	state.Evict();
+	return result;
+}
+
+
+size_t PrefetchingFileAccessor::Write(uint64_t offset, const void* src, size_t len)
+{
+	State& state = *m_state;
+	unique_lock<mutex> lock(state.m);
+	if (len != 0)
+	{
+		auto first = state.blocks.lower_bound(offset / state.blockSize);
+		auto last = state.blocks.upper_bound((offset + len - 1) / state.blockSize);
+		state.blocks.erase(first, last);
+		state.blockLoaded.notify_all();
+	}
+
+	// Hold the lock during the write so a block can't be loaded with data from before it
+	return state.accessor->Write(offset, src, len);
+}
@@ -24,38 +24,65 @@
 using namespace BinaryNinja;
 
 
-static BNFirmwareNinjaFunctionMemoryAccesses** MemoryInfoVectorToArray(
-	const std::vector<FirmwareNinjaFunctionMemoryAccesses>& fma)
+struct FirmwareNinja::MemoryAccessArray
 {
-	BNFirmwareNinjaFunctionMemoryAccesses** result = new BNFirmwareNinjaFunctionMemoryAccesses*[fma.size()];
-	for (size_t i = 0; i < fma.size(); i++)
+	std::vector<FirmwareNinjaFunctionMemoryAccesses> source;
+	std::vector<BNFirmwareNinjaMemoryAccess> accesses;
+	std::vector<BNFirmwareNinjaMemoryAccess*> accessPointers;
+	std::vector<BNFirmwareNinjaFunctionMemoryAccesses> functions;
+	std::vector<BNFirmwareNinjaFunctionMemoryAccesses*> functionPointers;
+
+	// All of the accesses are laid out in a handful of flat arrays, rather than an allocation per access
+	explicit MemoryAccessArray(const std::vector<FirmwareNinjaFunctionMemoryAccesses>& fma) : source(fma)
 	{
-		result[i] = new BNFirmwareNinjaFunctionMemoryAccesses;
-		result[i]->start = fma[i].start;
-		result[i]->count = fma[i].count;
-		result[i]->accesses = new BNFirmwareNinjaMemoryAccess*[fma[i].count];
-		for (size_t j = 0; j < fma[i].count; j++)
+		size_t total = 0;
+		for (auto& info : fma)
+			total += info.accesses.size();
+
+		accesses.reserve(total);
+		for (auto& info : fma)
+			accesses.insert(accesses.end(), info.accesses.begin(), info.accesses.end());
+
+		accessPointers.reserve(total);
+		for (auto& access : accesses)
+			accessPointers.push_back(&access);
+
+		functions.reserve(fma.size());
+		size_t offset = 0;
+		for (auto& info : fma)
 		{
-			result[i]->accesses[j] = new BNFirmwareNinjaMemoryAccess;
-			std::memcpy(result[i]->accesses[j], &fma[i].accesses[j], sizeof(BNFirmwareNinjaMemoryAccess));
+			BNFirmwareNinjaFunctionMemoryAccesses function;
+			function.start = info.start;
+			function.count = info.accesses.size();
+			function.accesses = accessPointers.data() + offset;
+			offset += info.accesses.size();
+			functions.push_back(function);
 		}
-	}
-
-	return result;
-}
 
+		functionPointers.reserve(fma.size());
+		for (auto& function : functions)
+			functionPointers.push_back(&function);
+	}
 
-static void FreeMemoryInfoArray(BNFirmwareNinjaFunctionMemoryAccesses** fma, size_t count)
-{
-	for (size_t i = 0; i < count; i++)
+	bool Matches(const std::vector<FirmwareNinjaFunctionMemoryAccesses>& fma) const
 	{
-		for (size_t j = 0; j < fma[i]->count; j++)
-			delete fma[i]->accesses[j];
+		if (fma.size() != source.size())
+			return false;
 
-		delete[] fma[i]->accesses;
-		delete fma[i];
+		for (size_t i = 0; i < fma.size(); i++)
+		{
+			const auto& a = fma[i];
+			const auto& b = source[i];
+			if (a.start != b.start || a.count != b.count || a.accesses.size() != b.accesses.size())
+				return false;
+			size_t size = a.accesses.size() * sizeof(BNFirmwareNinjaMemoryAccess);
+			if (size && std::memcmp(a.accesses.data(), b.accesses.data(), size) != 0)
+				return false;
+		}
+
+		return true;
 	}
-}
+};
 
 
 FirmwareNinjaReferenceNode::FirmwareNinjaReferenceNode(BNFirmwareNinjaReferenceNode* node)
@@ -144,6 +171,17 @@ FirmwareNinja::~FirmwareNinja()
 }
 
 
+BNFirmwareNinjaFunctionMemoryAccesses** FirmwareNinja::GetMemoryAccessArray(
+	const std::vector<FirmwareNinjaFunctionMemoryAccesses>& fma)
+{
+	if (fma.empty())
+		return nullptr;
+	if (!m_accessArray || !m_accessArray->Matches(fma))
+		m_accessArray = std::make_unique<MemoryAccessArray>(fma);
+	return m_accessArray->functionPointers.data();
+}
+
+
 bool FirmwareNinja::StoreCustomDevice(FirmwareNinjaDevice& device)
 {
 	return BNFirmwareNinjaStoreCustomDevice(m_object, device.name.c_str(),
@@ -269,6 +307,7 @@ std::vector<FirmwareNinjaFunctionMemoryAccesses> FirmwareNinja::GetFunctionMemor
 		FirmwareNinjaFunctionMemoryAccesses info;
 		info.start = fma[i]->start;
 		info.count = fma[i]->count;
+		info.accesses.reserve(info.count);
 		for (size_t j = 0; j < info.count; j++)
 		{
 			BNFirmwareNinjaMemoryAccess access;
@@ -294,9 +333,9 @@ void FirmwareNinja::StoreFunctionMemoryAccesses(const std::vector<FirmwareNinjaF
 	if (fma.empty())
 		return;
 
-	BNFirmwareNinjaFunctionMemoryAccesses** fmaArray = MemoryInfoVectorToArray(fma);
+	std::unique_lock<std::mutex> lock(m_accessArrayMutex);
+	BNFirmwareNinjaFunctionMemoryAccesses** fmaArray = GetMemoryAccessArray(fma);
 	BNFirmwareNinjaStoreFunctionMemoryAccessesToMetadata(m_object, fmaArray, fma.size());
-	FreeMemoryInfoArray(fmaArray, fma.size());
 }
 
 
@@ -314,6 +353,7 @@ std::vector<FirmwareNinjaFunctionMemoryAccesses> FirmwareNinja::QueryFunctionMem
 		FirmwareNinjaFunctionMemoryAccesses info;
 		info.start = fma[i]->start;
 		info.count = fma[i]->count;
+		info.accesses.reserve(info.count);
 		for (size_t j = 0; j < info.count; j++)
 		{
 			BNFirmwareNinjaMemoryAccess access;
@@ -349,10 +389,11 @@ std::vector<FirmwareNinjaDeviceAccesses> FirmwareNinja::GetBoardDeviceAccesses(
 	if (!arch)
 		return result;
 
-	BNFirmwareNinjaFunctionMemoryAccesses** fmaArray = MemoryInfoVectorToArray(fma);
+	std::unique_lock<std::mutex> lock(m_accessArrayMutex);
+	BNFirmwareNinjaFunctionMemoryAccesses** fmaArray = GetMemoryAccessArray(fma);
 	BNFirmwareNinjaDeviceAccesses* accesses;
 	int count = BNFirmwareNinjaGetBoardDeviceAccesses(m_object, fmaArray, fma.size(), &accesses, arch->GetObject());
-	FreeMemoryInfoArray(fmaArray, fma.size());
+	lock.unlock();
 	if (count <= 0)
 		return result;
 
@@ -372,14 +413,13 @@ std::vector<FirmwareNinjaDeviceAccesses> FirmwareNinja::GetBoardDeviceAccesses(
 Ref<FirmwareNinjaReferenceNode> FirmwareNinja::GetReferenceTree(
 	FirmwareNinjaDevice& device, const std::vector<FirmwareNinjaFunctionMemoryAccesses>& fma, uint64_t* value)
 {
-	BNFirmwareNinjaFunctionMemoryAccesses** fmaArray = nullptr;
-	if (!fma.empty())
-		fmaArray = MemoryInfoVectorToArray(fma);
+	std::unique_lock<std::mutex> lock(m_accessArrayMutex);
+	BNFirmwareNinjaFunctionMemoryAccesses** fmaArray = GetMemoryAccessArray(fma);
 
 	auto bnReferenceTree = BNFirmwareNinjaGetMemoryRegionReferenceTree(
 		m_object, device.start, device.end, fmaArray, fma.size(), value);
 
-	FreeMemoryInfoArray(fmaArray, fma.size());
+	lock.unlock();
 	if (!bnReferenceTree)
 		return nullptr;
 
@@ -390,14 +430,13 @@ Ref<FirmwareNinjaReferenceNode> FirmwareNinja::GetReferenceTree(
 Ref<FirmwareNinjaReferenceNode> FirmwareNinja::GetReferenceTree(
 	Section& section, const std::vector<FirmwareNinjaFunctionMemoryAccesses>& fma, uint64_t* value)
 {
-	BNFirmwareNinjaFunctionMemoryAccesses** fmaArray = nullptr;
-	if (!fma.empty())
-		fmaArray = MemoryInfoVectorToArray(fma);
+	std::unique_lock<std::mutex> lock(m_accessArrayMutex);
+	BNFirmwareNinjaFunctionMemoryAccesses** fmaArray = GetMemoryAccessArray(fma);
 
 	auto bnReferenceTree = BNFirmwareNinjaGetMemoryRegionReferenceTree(
 		m_object, section.GetStart(), section.GetStart() + section.GetLength(), fmaArray, fma.size(), value);
 
-	FreeMemoryInfoArray(fmaArray, fma.size());
+	lock.unlock();
 	if (!bnReferenceTree)
 		return nullptr;
 
@@ -408,13 +447,12 @@ Ref<FirmwareNinjaReferenceNode> FirmwareNinja::GetReferenceTree(
 Ref<FirmwareNinjaReferenceNode> FirmwareNinja::GetReferenceTree(
 	uint64_t address, const std::vector<FirmwareNinjaFunctionMemoryAccesses>& fma, uint64_t* value)
 {
-	BNFirmwareNinjaFunctionMemoryAccesses** fmaArray = nullptr;
-	if (!fma.empty())
-		fmaArray = MemoryInfoVectorToArray(fma);
+	std::unique_lock<std::mutex> lock(m_accessArrayMutex);
+	BNFirmwareNinjaFunctionMemoryAccesses** fmaArray = GetMemoryAccessArray(fma);
 
 	auto bnReferenceTree = BNFirmwareNinjaGetAddressReferenceTree(m_object, address, fmaArray, fma.size(), value);
 
-	FreeMemoryInfoArray(fmaArray, fma.size());
+	lock.unlock();
 	if (!bnReferenceTree)
 		return nullptr;
 
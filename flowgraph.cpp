@@ -338,6 +338,40 @@ vector<Ref<FlowGraphNode>> FlowGraph::GetNodesInRegion(int left, int top, int ri
 }
 
 
+vector<FlowGraphNodeBounds> FlowGraph::GetNodeBoundsInRegion(int left, int top, int right, int bottom, int margin)
+{
+	size_t count;
+	BNFlowGraphNode** nodes =
+	    BNGetFlowGraphNodesInRegion(m_object, left - margin, top - margin, right + margin, bottom + margin, &count);
+
+	vector<FlowGraphNodeBounds> result;
+	result.reserve(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		FlowGraphNodeBounds bounds;
+		auto node = m_cachedNodes.find(nodes[i]);
+		if (node == m_cachedNodes.end())
+		{
+			bounds.node = new FlowGraphNode(BNNewFlowGraphNodeReference(nodes[i]));
+			m_cachedNodes[nodes[i]] = bounds.node;
+		}
+		else
+		{
+			bounds.node = node->second;
+		}
+		bounds.x = BNGetFlowGraphNodeX(nodes[i]);
+		bounds.y = BNGetFlowGraphNodeY(nodes[i]);
+		bounds.width = BNGetFlowGraphNodeWidth(nodes[i]);
+		bounds.height = BNGetFlowGraphNodeHeight(nodes[i]);
+		bounds.highlight = BNGetFlowGraphNodeHighlight(nodes[i]);
+		result.push_back(bounds);
+	}
+
+	BNFreeFlowGraphNodeList(nodes, count);
+	return result;
+}
+
+
 bool FlowGraph::IsILGraph() const
 {
 	return BNIsILFlowGraph(m_object);
@@ -18,11 +18,17 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <algorithm>
+#include <numeric>
+#include <thread>
 #include "binaryninjaapi.h"
 
 using namespace BinaryNinja;
 using namespace std;
 
+// Number of graphs per layout whose state is kept for the next layout
+static constexpr size_t MaxSavedLayoutStates = 64;
+
 
 FlowGraphLayout::FlowGraphLayout(BNFlowGraphLayout* layout)
 {
@@ -47,7 +53,31 @@ bool FlowGraphLayout::LayoutCallback(void* ctxt, BNFlowGraph* graph, BNFlowGraph
 		nodeVec.push_back(new FlowGraphNode(nodes[i]));
 	}
 
-	bool result = layout->Layout(new CoreFlowGraph(graph), nodeVec);
+	Ref<FlowGraph> graphObject = new CoreFlowGraph(graph);
+	Ref<Function> func = graphObject->GetFunction();
+	int ilForm = graphObject->IsLowLevelILGraph() ? 1 : graphObject->IsMediumLevelILGraph() ? 2 :
+	    graphObject->IsHighLevelILGraph() ? 3 : 0;
+	auto stateKey = make_tuple(func ? func->GetObject() : nullptr, func ? func->GetStart() : 0, ilForm);
+
+	// Taken out of the map for the duration of the layout, so concurrent layouts of the same graph each
+	// work on their own copy
+	FlowGraphLayoutState state;
+	{
+		unique_lock<mutex> lock(layout->m_stateMutex);
+		auto i = layout->m_states.find(stateKey);
+		if (i != layout->m_states.end())
+		{
+			state = std::move(i->second);
+			layout->m_states.erase(i);
+		}
+	}
+
+	bool result = layout->Layout(graphObject, nodeVec, state);
+
+	unique_lock<mutex> lock(layout->m_stateMutex);
+	if (layout->m_states.size() >= MaxSavedLayoutStates)
+		layout->m_states.erase(layout->m_states.begin());
+	layout->m_states[stateKey] = std::move(state);
 	return result;
 }
 
@@ -101,6 +131,12 @@ bool FlowGraphLayout::Layout(Ref<FlowGraph> graph, std::vector<Ref<FlowGraphNode
 }
 
 
+bool FlowGraphLayout::Layout(Ref<FlowGraph> graph, std::vector<Ref<FlowGraphNode>>& nodes, FlowGraphLayoutState&)
+{
+	return Layout(graph, nodes);
+}
+
+
 CoreFlowGraphLayout::CoreFlowGraphLayout(BNFlowGraphLayout* layout) : FlowGraphLayout(layout) {}
 
 
@@ -115,3 +151,439 @@ bool CoreFlowGraphLayout::Layout(Ref<FlowGraph> graph, std::vector<Ref<FlowGraph
 	delete[] nodeList;
 	return result;
 }
+
+
+namespace
+{
+	struct IncrementalLayoutEdge
+	{
+		// Index of the target node, or SIZE_MAX for an edge that leaves the graph
+		size_t target;
+		bool backEdge;
+		vector<BNPoint> points;
+	};
+
+	struct IncrementalLayoutNode
+	{
+		uint64_t key;
+		uint64_t edgeSignature;
+		int width;
+		int height;
+		vector<IncrementalLayoutEdge> edges;
+
+		size_t layer;
+		size_t order;
+		int x;
+		int y;
+		int visibleRight;
+		int visibleBottom;
+	};
+
+	struct IncrementalLayoutComponent
+	{
+		vector<size_t> nodes;
+		// Component laid out previously with exactly these nodes and edges, if any
+		size_t previous = SIZE_MAX;
+		int width = 0;
+		int height = 0;
+	};
+
+
+	// Assign layers along forward edges and order nodes within them to reduce crossings
+	void AssignLayers(vector<IncrementalLayoutNode>& nodes, const vector<size_t>& members)
+	{
+		// Anything reached again while still on the DFS stack closes a cycle; those edges are drawn
+		// separately and ignored for layering
+		enum Color : uint8_t { White, Gray, Black };
+		unordered_map<size_t, Color> color;
+		for (size_t i : members)
+			color[i] = White;
+		vector<pair<size_t, size_t>> stack;
+		for (size_t root : members)
+		{
+			if (color[root] != White)
+				continue;
+			color[root] = Gray;
+			stack.push_back({root, 0});
+			while (!stack.empty())
+			{
+				auto& [node, edgeIndex] = stack.back();
+				if (edgeIndex == nodes[node].edges.size())
+				{
+					color[node] = Black;
+					stack.pop_back();
+					continue;
+				}
+				IncrementalLayoutEdge& edge = nodes[node].edges[edgeIndex++];
+				if (edge.target == SIZE_MAX)
+					continue;
+				Color& targetColor = color[edge.target];
+				edge.backEdge = targetColor == Gray;
+				if (targetColor == White)
+				{
+					targetColor = Gray;
+					stack.push_back({edge.target, 0});
+				}
+			}
+		}
+
+		unordered_map<size_t, size_t> incoming;
+		for (size_t i : members)
+		{
+			nodes[i].layer = 0;
+			for (auto& edge : nodes[i].edges)
+				if (edge.target != SIZE_MAX && !edge.backEdge)
+					incoming[edge.target]++;
+		}
+		vector<size_t> ready;
+		for (size_t i : members)
+			if (incoming[i] == 0)
+				ready.push_back(i);
+		vector<size_t> topological;
+		topological.reserve(members.size());
+		for (size_t next = 0; next < ready.size(); next++)
+		{
+			size_t node = ready[next];
+			topological.push_back(node);
+			for (auto& edge : nodes[node].edges)
+			{
+				if (edge.target == SIZE_MAX || edge.backEdge)
+					continue;
+				nodes[edge.target].layer = max(nodes[edge.target].layer, nodes[node].layer + 1);
+				if (--incoming[edge.target] == 0)
+					ready.push_back(edge.target);
+			}
+		}
+
+		size_t layerCount = 0;
+		for (size_t i : members)
+			layerCount = max(layerCount, nodes[i].layer + 1);
+		vector<vector<size_t>> layers(layerCount);
+		for (size_t i : topological)
+			layers[nodes[i].layer].push_back(i);
+		auto renumber = [&](vector<size_t>& layer) {
+			for (size_t i = 0; i < layer.size(); i++)
+				nodes[layer[i]].order = i;
+		};
+		for (auto& layer : layers)
+			renumber(layer);
+
+		unordered_map<size_t, vector<size_t>> predecessors;
+		for (size_t i : members)
+			for (auto& edge : nodes[i].edges)
+				if (edge.target != SIZE_MAX && !edge.backEdge)
+					predecessors[edge.target].push_back(i);
+
+		// Alternate downward and upward barycenter sweeps
+		static constexpr size_t BarycenterPasses = 4;
+		unordered_map<size_t, double> weight;
+		for (size_t pass = 0; pass < BarycenterPasses; pass++)
+		{
+			bool down = (pass % 2) == 0;
+			for (size_t step = 1; step < layerCount; step++)
+			{
+				vector<size_t>& layer = layers[down ? step : layerCount - 1 - step];
+				for (size_t node : layer)
+				{
+					double sum = 0;
+					size_t count = 0;
+					if (down)
+					{
+						for (size_t pred : predecessors[node])
+						{
+							sum += nodes[pred].order;
+							count++;
+						}
+					}
+					else
+					{
+						for (auto& edge : nodes[node].edges)
+						{
+							if (edge.target == SIZE_MAX || edge.backEdge)
+								continue;
+							sum += nodes[edge.target].order;
+							count++;
+						}
+					}
+					weight[node] = count ? sum / count : (double)nodes[node].order;
+				}
+				stable_sort(layer.begin(), layer.end(), [&](size_t a, size_t b) { return weight[a] < weight[b]; });
+				renumber(layer);
+			}
+		}
+	}
+
+
+	// Compute coordinates and edge routes relative to the component's top left corner
+	void PlaceComponent(vector<IncrementalLayoutNode>& nodes, IncrementalLayoutComponent& component,
+	    int horizontalMargin, int verticalMargin)
+	{
+		size_t layerCount = 0;
+		for (size_t i : component.nodes)
+			layerCount = max(layerCount, nodes[i].layer + 1);
+		vector<vector<size_t>> layers(layerCount);
+		for (size_t i : component.nodes)
+			layers[nodes[i].layer].push_back(i);
+		for (auto& layer : layers)
+			sort(layer.begin(), layer.end(), [&](size_t a, size_t b) { return nodes[a].order < nodes[b].order; });
+
+		unordered_map<size_t, vector<size_t>> predecessors;
+		for (size_t i : component.nodes)
+			for (auto& edge : nodes[i].edges)
+				if (edge.target != SIZE_MAX && !edge.backEdge)
+					predecessors[edge.target].push_back(i);
+
+		// Center each node under its predecessors, pushing right only as far as needed to avoid overlap
+		int y = 0;
+		int minX = INT32_MAX;
+		for (auto& layer : layers)
+		{
+			int layerHeight = 0;
+			int right = INT32_MIN;
+			for (size_t node : layer)
+			{
+				IncrementalLayoutNode& info = nodes[node];
+				int center = 0;
+				auto& preds = predecessors[node];
+				if (!preds.empty())
+				{
+					int64_t sum = 0;
+					for (size_t pred : preds)
+						sum += nodes[pred].x + nodes[pred].width / 2;
+					center = (int)(sum / (int64_t)preds.size());
+				}
+				info.x = center - info.width / 2;
+				if (right != INT32_MIN)
+					info.x = max(info.x, right + horizontalMargin);
+				info.y = y;
+				right = info.x + info.width;
+				layerHeight = max(layerHeight, info.height);
+				minX = min(minX, info.x);
+			}
+			y += layerHeight + verticalMargin;
+		}
+
+		int width = 0;
+		bool hasBackEdges = false;
+		for (size_t i : component.nodes)
+		{
+			nodes[i].x -= minX;
+			width = max(width, nodes[i].x + nodes[i].width);
+			for (auto& edge : nodes[i].edges)
+				hasBackEdges |= edge.target != SIZE_MAX && edge.backEdge;
+		}
+		// Back edges return up a lane to the right of the component
+		int laneX = width + horizontalMargin / 2;
+		component.width = hasBackEdges ? width + horizontalMargin : width;
+		component.height = max(y - verticalMargin, 0);
+
+		float halfMargin = verticalMargin / 2.0f;
+		for (size_t i : component.nodes)
+		{
+			IncrementalLayoutNode& source = nodes[i];
+			source.visibleRight = source.x + source.width;
+			source.visibleBottom = source.y + source.height;
+			for (auto& edge : source.edges)
+			{
+				edge.points.clear();
+				if (edge.target == SIZE_MAX)
+					continue;
+				IncrementalLayoutNode& target = nodes[edge.target];
+				BNPoint start = {(float)(source.x + source.width / 2), (float)(source.y + source.height)};
+				BNPoint end = {(float)(target.x + target.width / 2), (float)target.y};
+				edge.points.push_back(start);
+				edge.points.push_back({start.x, start.y + halfMargin});
+				if (edge.backEdge)
+				{
+					edge.points.push_back({(float)laneX, start.y + halfMargin});
+					edge.points.push_back({(float)laneX, end.y - halfMargin});
+					source.visibleRight = max(source.visibleRight, laneX);
+				}
+				edge.points.push_back({end.x, end.y - halfMargin});
+				edge.points.push_back(end);
+				for (auto& point : edge.points)
+				{
+					source.visibleRight = max(source.visibleRight, (int)point.x);
+					source.visibleBottom = max(source.visibleBottom, (int)point.y);
+				}
+			}
+		}
+	}
+}  // namespace
+
+
+IncrementalFlowGraphLayout::IncrementalFlowGraphLayout(const string& name, size_t threads) :
+    FlowGraphLayout(name), m_threads(threads)
+{}
+
+
+bool IncrementalFlowGraphLayout::Layout(
+    Ref<FlowGraph> graph, std::vector<Ref<FlowGraphNode>>& nodes, FlowGraphLayoutState& state)
+{
+	// Read everything out of the core up front; the parallel phase only touches local data
+	vector<IncrementalLayoutNode> info(nodes.size());
+	unordered_map<BNFlowGraphNode*, size_t> indexOf;
+	for (size_t i = 0; i < nodes.size(); i++)
+		indexOf[nodes[i]->GetObject()] = i;
+
+	unordered_set<uint64_t> usedKeys;
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		Ref<BasicBlock> block = nodes[i]->GetBasicBlock();
+		// Nodes without a block of their own fall back to their position, which has the top bit set so it
+		// can't collide with a block start
+		uint64_t key = block ? block->GetStart() : 0;
+		if (!block || !usedKeys.insert(key).second)
+			key = (1ull << 63) | i;
+		info[i].key = key;
+		info[i].width = nodes[i]->GetWidth();
+		info[i].height = nodes[i]->GetHeight();
+		for (auto& edge : nodes[i]->GetOutgoingEdges())
+		{
+			auto target = edge.target ? indexOf.find(edge.target->GetObject()) : indexOf.end();
+			info[i].edges.push_back({target == indexOf.end() ? SIZE_MAX : target->second, false, {}});
+		}
+	}
+
+	// Edge signatures can only be computed once every node has its key
+	vector<size_t> parent(nodes.size());
+	iota(parent.begin(), parent.end(), 0);
+	auto find = [&](size_t i) {
+		while (parent[i] != i)
+			i = parent[i] = parent[parent[i]];
+		return i;
+	};
+	for (size_t i = 0; i < info.size(); i++)
+	{
+		uint64_t signature = info[i].edges.size();
+		for (auto& edge : info[i].edges)
+		{
+			uint64_t target = edge.target == SIZE_MAX ? ~0ull : info[edge.target].key;
+			signature = (signature ^ target) * 0x100000001b3ull;
+			if (edge.target != SIZE_MAX)
+				parent[find(i)] = find(edge.target);
+		}
+		info[i].edgeSignature = signature;
+	}
+
+	vector<IncrementalLayoutComponent> components;
+	unordered_map<size_t, size_t> componentOf;
+	for (size_t i = 0; i < info.size(); i++)
+	{
+		auto [entry, added] = componentOf.try_emplace(find(i), components.size());
+		if (added)
+			components.emplace_back();
+		components[entry->second].nodes.push_back(i);
+	}
+
+	for (size_t c = 0; c < components.size(); c++)
+	{
+		IncrementalLayoutComponent& component = components[c];
+		size_t previous = SIZE_MAX;
+		bool reusable = true;
+		for (size_t i : component.nodes)
+		{
+			auto prior = state.nodes.find(info[i].key);
+			if (prior == state.nodes.end() || prior->second.edgeSignature != info[i].edgeSignature
+			    || (previous != SIZE_MAX && prior->second.component != previous))
+			{
+				reusable = false;
+				break;
+			}
+			previous = prior->second.component;
+		}
+		// Every node matching and the sizes agreeing means the previous component is this exact node set
+		if (reusable && previous < state.componentSizes.size()
+		    && state.componentSizes[previous] == component.nodes.size())
+		{
+			component.previous = previous;
+			for (size_t i : component.nodes)
+			{
+				auto& prior = state.nodes[info[i].key];
+				info[i].layer = prior.layer;
+				info[i].order = prior.order;
+			}
+		}
+	}
+
+	int horizontalMargin = graph->GetHorizontalNodeMargin();
+	int verticalMargin = graph->GetVerticalNodeMargin();
+
+	// Largest components first so one big component doesn't end up last on a busy thread
+	vector<size_t> schedule(components.size());
+	iota(schedule.begin(), schedule.end(), 0);
+	sort(schedule.begin(), schedule.end(),
+	    [&](size_t a, size_t b) { return components[a].nodes.size() > components[b].nodes.size(); });
+
+	// Components are disjoint, so workers never touch the same node
+	atomic<size_t> nextComponent = 0;
+	auto worker = [&]() {
+		while (true)
+		{
+			size_t index = nextComponent++;
+			if (index >= schedule.size())
+				return;
+			IncrementalLayoutComponent& component = components[schedule[index]];
+			if (component.previous == SIZE_MAX)
+			{
+				AssignLayers(info, component.nodes);
+			}
+			else
+			{
+				// Reused layers still need their back edges identified for routing
+				for (size_t i : component.nodes)
+					for (auto& edge : info[i].edges)
+						edge.backEdge = edge.target != SIZE_MAX && info[edge.target].layer <= info[i].layer;
+			}
+			PlaceComponent(info, component, horizontalMargin, verticalMargin);
+		}
+	};
+
+	size_t threads = m_threads ? m_threads : GetWorkerThreadCount();
+	threads = max<size_t>(1, min(threads, components.size()));
+	vector<thread> workers;
+	for (size_t i = 1; i < threads; i++)
+		workers.emplace_back(worker);
+	worker();
+	for (auto& i : workers)
+		i.join();
+
+	int left = horizontalMargin;
+	int top = verticalMargin;
+	int height = 0;
+	for (auto& component : components)
+	{
+		for (size_t i : component.nodes)
+		{
+			IncrementalLayoutNode& node = info[i];
+			nodes[i]->SetX(node.x + left);
+			nodes[i]->SetY(node.y + top);
+			nodes[i]->SetVisibilityRegion(
+			    node.x + left, node.y + top, node.visibleRight - node.x, node.visibleBottom - node.y);
+			for (size_t e = 0; e < node.edges.size(); e++)
+			{
+				vector<BNPoint> points = node.edges[e].points;
+				for (auto& point : points)
+				{
+					point.x += left;
+					point.y += top;
+				}
+				nodes[i]->SetOutgoingEdgePoints(e, points);
+			}
+		}
+		left += component.width + horizontalMargin;
+		height = max(height, component.height);
+	}
+	graph->SetWidth(left);
+	graph->SetHeight(height + verticalMargin * 2);
+
+	state.nodes.clear();
+	state.componentSizes.clear();
+	for (size_t c = 0; c < components.size(); c++)
+	{
+		state.componentSizes.push_back(components[c].nodes.size());
+		for (size_t i : components[c].nodes)
+			state.nodes[info[i].key] = {info[i].layer, info[i].order, c, info[i].edgeSignature};
+	}
+	return true;
+}
@@ -243,3 +243,11 @@ void FlowGraphNode::SetVisibilityRegion(int x, int y, int w, int h)
 {
 	BNFlowGraphNodeSetVisibilityRegion(m_object, x, y, w, h);
 }
+
+
+void FlowGraphNode::SetOutgoingEdgePoints(size_t edgeNum, const vector<BNPoint>& points)
+{
+	BNFlowGraphNodeSetOutgoingEdgePoints(m_object, edgeNum, (BNPoint*)points.data(), points.size());
+	m_cachedEdges.clear();
+	m_cachedEdgesValid = false;
+}
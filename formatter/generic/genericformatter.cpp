@@ -513,312 +513,342 @@ GenericLineFormatter::GenericLineFormatter(): LineFormatter("GenericLineFormatte
 }
 
 
-vector<DisassemblyTextLine> GenericLineFormatter::FormatLines(
-	const vector<DisassemblyTextLine>& lines, const LineFormatterSettings& settings)
+void GenericLineFormatter::FormatLine(const DisassemblyTextLine& currentLine, const DisassemblyTextLine* nextLine,
+	const LineFormatterSettings& settings, const function<void(DisassemblyTextLine&&)>& output)
 {
-	vector<DisassemblyTextLine> result;
-	for (size_t i = 0; i < lines.size(); i++)
-	{
-		const DisassemblyTextLine& currentLine = lines[i];
+	size_t totalLength = currentLine.GetTotalWidth();
+	size_t indentation = currentLine.GetAddressAndIndentationWidth();
 
-		size_t totalLength = currentLine.GetTotalWidth();
-		size_t indentation = currentLine.GetAddressAndIndentationWidth();
+	// Check width against settings
+	size_t contentLength = totalLength - indentation;
+	if (totalLength <= settings.desiredLineLength || contentLength <= settings.minimumContentLength)
+	{
+		// Line fits, emit as-is
+		output(DisassemblyTextLine(currentLine));
+		return;
+	}
 
-		// Check width against settings
-		size_t contentLength = totalLength - indentation;
-		if (totalLength <= settings.desiredLineLength || contentLength <= settings.minimumContentLength)
-		{
-			// Line fits, emit as-is
-			result.push_back(currentLine);
-			continue;
-		}
+	// Calculate indentation for continuation lines. If the next line in the input is more indented, make
+	// the continuation lines more indented than that to separate the continuation from the new scope.
+	size_t continuationIndentation = indentation + settings.tabWidth;
+	if (nextLine)
+	{
+		size_t nextLineIndentation = nextLine->GetAddressAndIndentationWidth();
+		if (nextLineIndentation > indentation)
+			continuationIndentation = nextLineIndentation + settings.tabWidth;
+	}
+	size_t additionalContinuationIndentation = continuationIndentation - indentation;
 
-		// Calculate indentation for continuation lines. If the next line in the input is more indented, make
-		// the continuation lines more indented than that to separate the continuation from the new scope.
-		size_t continuationIndentation = indentation + settings.tabWidth;
-		if ((i + 1) < lines.size())
-		{
-			size_t nextLineIndentation = lines[i + 1].GetAddressAndIndentationWidth();
-			if (nextLineIndentation > indentation)
-				continuationIndentation = nextLineIndentation + settings.tabWidth;
-		}
-		size_t additionalContinuationIndentation = continuationIndentation - indentation;
+	// Compute the target length for this line
+	size_t desiredWidth = settings.minimumContentLength;
+	if (indentation < settings.desiredLineLength)
+	{
+		size_t remainingWidth = settings.desiredLineLength - indentation;
+		if (remainingWidth > desiredWidth)
+			desiredWidth = remainingWidth;
+	}
 
-		// Compute the target length for this line
-		size_t desiredWidth = settings.minimumContentLength;
-		if (indentation < settings.desiredLineLength)
-		{
-			size_t remainingWidth = settings.desiredLineLength - indentation;
-			if (remainingWidth > desiredWidth)
-				desiredWidth = remainingWidth;
-		}
+	// Compute the target length for the continuation lines
+	size_t desiredContinuationWidth = settings.minimumContentLength;
+	if (continuationIndentation < settings.desiredLineLength)
+	{
+		size_t remainingWidth = settings.desiredLineLength - continuationIndentation;
+		if (remainingWidth > desiredContinuationWidth)
+			desiredContinuationWidth = remainingWidth;
+	}
 
-		// Compute the target length for the continuation lines
-		size_t desiredContinuationWidth = settings.minimumContentLength;
-		if (continuationIndentation < settings.desiredLineLength)
-		{
-			size_t remainingWidth = settings.desiredLineLength - continuationIndentation;
-			if (remainingWidth > desiredContinuationWidth)
-				desiredContinuationWidth = remainingWidth;
-		}
+	// Gather the indentation tokens at the beginning of the line
+	vector<InstructionTextToken> indentationTokens = currentLine.GetAddressAndIndentationTokens();
+	size_t tokenIndex = indentationTokens.size();
 
-		// Gather the indentation tokens at the beginning of the line
-		vector<InstructionTextToken> indentationTokens = currentLine.GetAddressAndIndentationTokens();
-		size_t tokenIndex = indentationTokens.size();
+	// First break the line down into nested container items. A container is anything between a pair of
+	// BraceTokens (except for strings, where the entire string, including the quotes, are treated as
+	// a single atom).
+	vector<Item> items;
+	stack<vector<Item>> itemStack;
+	for (; tokenIndex < currentLine.tokens.size(); tokenIndex++)
+	{
+		const InstructionTextToken& token = currentLine.tokens[tokenIndex];
+		string trimmedText = TrimString(token.text);
 
-		// First break the line down into nested container items. A container is anything between a pair of
-		// BraceTokens (except for strings, where the entire string, including the quotes, are treated as
-		// a single atom).
-		vector<Item> items;
-		stack<vector<Item>> itemStack;
-		for (; tokenIndex < currentLine.tokens.size(); tokenIndex++)
+		switch (token.type)
 		{
-			const InstructionTextToken& token = currentLine.tokens[tokenIndex];
-			string trimmedText = TrimString(token.text);
-
-			switch (token.type)
+		case BraceToken:
+			if (tokenIndex + 1 < currentLine.tokens.size()
+				&& currentLine.tokens[tokenIndex + 1].type == StringToken)
 			{
-			case BraceToken:
+				// Treat string tokens surrounded by brace tokens as a unit (this is usually the quotes
+				// surrounding the string)
+				Item atom;
+				atom.type = Atom;
+				atom.tokens.push_back(token);
+				atom.tokens.push_back(currentLine.tokens[tokenIndex + 1]);
+				atom.width = 0;
+				tokenIndex++;
 				if (tokenIndex + 1 < currentLine.tokens.size()
-					&& currentLine.tokens[tokenIndex + 1].type == StringToken)
+					&& currentLine.tokens[tokenIndex + 1].type == BraceToken)
 				{
-					// Treat string tokens surrounded by brace tokens as a unit (this is usually the quotes
-					// surrounding the string)
-					Item atom;
-					atom.type = Atom;
-					atom.tokens.push_back(token);
 					atom.tokens.push_back(currentLine.tokens[tokenIndex + 1]);
-					atom.width = 0;
 					tokenIndex++;
-					if (tokenIndex + 1 < currentLine.tokens.size()
-						&& currentLine.tokens[tokenIndex + 1].type == BraceToken)
-					{
-						atom.tokens.push_back(currentLine.tokens[tokenIndex + 1]);
-						tokenIndex++;
-					}
-
-					items.push_back(atom);
-					break;
 				}
 
-				if (trimmedText == "(" || trimmedText == "[" || trimmedText == "{")
-				{
-					// Create a ContainerContents item and place it onto the item stack. This will hold anything
-					// inside the container once the end of the container is found.
-					items.push_back(Item {Container, {}, {}, 0});
-					itemStack.push(items);
-
-					// Starting a new context
-					items.clear();
-					items.push_back(Item {StartOfContainer, {}, {token}, 0});
-				}
-				else if (trimmedText == ")" || trimmedText == "]" || trimmedText == "}")
-				{
-					items.push_back(Item {EndOfContainer, {}, {token}, 0});
-
-					if (itemStack.empty())
-						break;
-
-					// Go back up the item stack and add the items to the container
-					vector<Item> parent = itemStack.top();
-					itemStack.pop();
-					parent.back().items.insert(parent.back().items.end(), items.begin(), items.end());
-					items = parent;
-				}
+				items.push_back(atom);
 				break;
-			case CommentToken:
+			}
+
+			if (trimmedText == "(" || trimmedText == "[" || trimmedText == "{")
 			{
-				// The rest of the line is a comment. There may be tokens that are not of CommentToken type, but
-				// these are used to create clickable items when things are referenced by the comment.
-				Item comment {Comment, {}, {}, 0};
-				for (; tokenIndex < currentLine.tokens.size(); tokenIndex++)
-					comment.tokens.push_back(currentLine.tokens[tokenIndex]);
-				items.push_back(comment);
-				break;
+				// Create a ContainerContents item and place it onto the item stack. This will hold anything
+				// inside the container once the end of the container is found.
+				items.push_back(Item {Container, {}, {}, 0});
+				itemStack.push(items);
+
+				// Starting a new context
+				items.clear();
+				items.push_back(Item {StartOfContainer, {}, {token}, 0});
 			}
-			case TextToken:
-				if (trimmedText == ",")
-					items.push_back(Item {ArgumentSeparator, {}, {token}, 0});
-				else if ((!trimmedText.empty() && trimmedText[0] == '.') || trimmedText == "->")
-					items.push_back(Item {FieldAccessor, {}, {token}, 0});
-				else if (trimmedText == ";")
-					items.push_back(Item {StatementSeparator, {}, {token}, 0});
-				else if (trimmedText == ":" && !items.empty())
-					items.back().AddTokenToLastAtom(token);
-				else
-					items.push_back(Item {Atom, {}, {token}, 0});
-				break;
-			case OperationToken:
-				if ((!trimmedText.empty() && trimmedText[0] == '.') || trimmedText == "->")
-					items.push_back(Item {FieldAccessor, {}, {token}, 0});
-				else
-					items.push_back(Item {Operator, {}, {token}, 0});
-				break;
-			default:
-				items.push_back(Item {Atom, {}, {token}, 0});
-				break;
+			else if (trimmedText == ")" || trimmedText == "]" || trimmedText == "}")
+			{
+				items.push_back(Item {EndOfContainer, {}, {token}, 0});
+
+				if (itemStack.empty())
+					break;
+
+				// Go back up the item stack and add the items to the container
+				vector<Item> parent = itemStack.top();
+				itemStack.pop();
+				parent.back().items.insert(parent.back().items.end(), items.begin(), items.end());
+				items = parent;
 			}
+			break;
+		case CommentToken:
+		{
+			// The rest of the line is a comment. There may be tokens that are not of CommentToken type, but
+			// these are used to create clickable items when things are referenced by the comment.
+			Item comment {Comment, {}, {}, 0};
+			for (; tokenIndex < currentLine.tokens.size(); tokenIndex++)
+				comment.tokens.push_back(currentLine.tokens[tokenIndex]);
+			items.push_back(comment);
+			break;
 		}
-
-		while (!itemStack.empty())
-		{
-			vector<Item> parent = itemStack.top();
-			itemStack.pop();
-			parent.back().items.insert(parent.back().items.end(), items.begin(), items.end());
-			items = parent;
+		case TextToken:
+			if (trimmedText == ",")
+				items.push_back(Item {ArgumentSeparator, {}, {token}, 0});
+			else if ((!trimmedText.empty() && trimmedText[0] == '.') || trimmedText == "->")
+				items.push_back(Item {FieldAccessor, {}, {token}, 0});
+			else if (trimmedText == ";")
+				items.push_back(Item {StatementSeparator, {}, {token}, 0});
+			else if (trimmedText == ":" && !items.empty())
+				items.back().AddTokenToLastAtom(token);
+			else
+				items.push_back(Item {Atom, {}, {token}, 0});
+			break;
+		case OperationToken:
+			if ((!trimmedText.empty() && trimmedText[0] == '.') || trimmedText == "->")
+				items.push_back(Item {FieldAccessor, {}, {token}, 0});
+			else
+				items.push_back(Item {Operator, {}, {token}, 0});
+			break;
+		default:
+			items.push_back(Item {Atom, {}, {token}, 0});
+			break;
 		}
+	}
 
-		// Process the items to find semicolons, and create statement items containing the group of items making
-		// up each statement.
-		items = CreateStatementItems(items);
+	while (!itemStack.empty())
+	{
+		vector<Item> parent = itemStack.top();
+		itemStack.pop();
+		parent.back().items.insert(parent.back().items.end(), items.begin(), items.end());
+		items = parent;
+	}
 
-		// Process the items to find assignment operators, and group up the source and destination items. This needs
-		// to be done before creating arguments to better handle multiple return value constructs.
-		items = CreateAssignmentOperatorGroups(items);
+	// Process the items to find semicolons, and create statement items containing the group of items making
+	// up each statement.
+	items = CreateStatementItems(items);
 
-		// Process the items to find commas, and create argument items containing the group of items making
-		// up each argument.
-		items = CreateArgumentItems(items, false);
+	// Process the items to find assignment operators, and group up the source and destination items. This needs
+	// to be done before creating arguments to better handle multiple return value constructs.
+	items = CreateAssignmentOperatorGroups(items);
 
-		// Process the items to find operators, and create group items containing the operands
-		items = CreateOperatorGroups(items);
+	// Process the items to find commas, and create argument items containing the group of items making
+	// up each argument.
+	items = CreateArgumentItems(items, false);
 
-		// Process the items to group operations by operator precedence
-		items = CreateOperatorPrecedenceGroups(items);
+	// Process the items to find operators, and create group items containing the operands
+	items = CreateOperatorGroups(items);
 
-		// Move start of container items to the last token of the previous item, and end of container items to
-		// the previous atom.
-		items = RelocateStartAndEndOfContainerItems(items);
+	// Process the items to group operations by operator precedence
+	items = CreateOperatorPrecedenceGroups(items);
 
-		// Now that items are done, compute widths for layout
-		for (auto& j : items)
-			j.CalculateWidth();
+	// Move start of container items to the last token of the previous item, and end of container items to
+	// the previous atom.
+	items = RelocateStartAndEndOfContainerItems(items);
 
-		DisassemblyTextLine outputLine = currentLine;
-		outputLine.tokens = indentationTokens;
-		size_t currentWidth = 0;
-		bool firstTokenOfLine = true;
+	// Now that items are done, compute widths for layout
+	for (auto& j : items)
+		j.CalculateWidth();
 
-		stack<ItemLayoutStackEntry> layoutStack;
-		layoutStack.push({items, additionalContinuationIndentation, desiredWidth, desiredContinuationWidth, false});
+	DisassemblyTextLine outputLine = currentLine;
+	outputLine.tokens = indentationTokens;
+	size_t currentWidth = 0;
+	bool firstTokenOfLine = true;
 
-		auto newLine = [&]() {
-			if (!firstTokenOfLine)
-			{
-				string lastTokenText = outputLine.tokens.back().text;
-				string trimmedText = TrimTrailingWhitespace(lastTokenText);
-				outputLine.tokens.back().width -= lastTokenText.size() - trimmedText.size();
-				outputLine.tokens.back().text = trimmedText;
-			}
-
-			result.push_back(outputLine);
-			outputLine.tokens = indentationTokens;
+	stack<ItemLayoutStackEntry> layoutStack;
+	layoutStack.push({items, additionalContinuationIndentation, desiredWidth, desiredContinuationWidth, false});
 
-			// Make sure any collapsible state indicators are set to padding so that the indicators don't
-			// show up more than once for a single scope.
-			for (auto& outToken : outputLine.tokens)
-			{
-				if (outToken.type == CollapseStateIndicatorToken)
-					outToken.context = ContentCollapsiblePadding;
-			}
+	auto newLine = [&]() {
+		if (!firstTokenOfLine)
+		{
+			string lastTokenText = outputLine.tokens.back().text;
+			string trimmedText = TrimTrailingWhitespace(lastTokenText);
+			outputLine.tokens.back().width -= lastTokenText.size() - trimmedText.size();
+			outputLine.tokens.back().text = trimmedText;
+		}
 
-			outputLine.tokens.emplace_back(TextToken, string(additionalContinuationIndentation, ' '));
-			currentWidth = 0;
-			desiredWidth = desiredContinuationWidth;
-			firstTokenOfLine = true;
-		};
+		output(DisassemblyTextLine(outputLine));
+		outputLine.tokens = indentationTokens;
 
-		while (!layoutStack.empty())
+		// Make sure any collapsible state indicators are set to padding so that the indicators don't
+		// show up more than once for a single scope.
+		for (auto& outToken : outputLine.tokens)
 		{
-			ItemLayoutStackEntry layoutStackEntry = layoutStack.top();
-			layoutStack.pop();
+			if (outToken.type == CollapseStateIndicatorToken)
+				outToken.context = ContentCollapsiblePadding;
+		}
 
-			items = layoutStackEntry.items;
-			additionalContinuationIndentation = layoutStackEntry.additionalContinuationIndentation;
-			desiredWidth = layoutStackEntry.desiredWidth;
-			desiredContinuationWidth = layoutStackEntry.desiredContinuationWidth;
+		outputLine.tokens.emplace_back(TextToken, string(additionalContinuationIndentation, ' '));
+		currentWidth = 0;
+		desiredWidth = desiredContinuationWidth;
+		firstTokenOfLine = true;
+	};
 
-			// Check to see if the scope we are returning to needs a new line. This is used when an argument
-			// spans multiple lines. The rest of the arguments are placed on separate lines from the long argument.
-			if (layoutStackEntry.newLineOnReenteringScope && currentWidth > 0)
-				newLine();
+	while (!layoutStack.empty())
+	{
+		ItemLayoutStackEntry layoutStackEntry = layoutStack.top();
+		layoutStack.pop();
+
+		items = layoutStackEntry.items;
+		additionalContinuationIndentation = layoutStackEntry.additionalContinuationIndentation;
+		desiredWidth = layoutStackEntry.desiredWidth;
+		desiredContinuationWidth = layoutStackEntry.desiredContinuationWidth;
 
-			for (auto item = items.begin(); item != items.end();)
+		// Check to see if the scope we are returning to needs a new line. This is used when an argument
+		// spans multiple lines. The rest of the arguments are placed on separate lines from the long argument.
+		if (layoutStackEntry.newLineOnReenteringScope && currentWidth > 0)
+			newLine();
+
+		for (auto item = items.begin(); item != items.end();)
+		{
+			if (currentWidth + item->width > desiredWidth)
 			{
-				if (currentWidth + item->width > desiredWidth)
+				// Current item is too wide to fit on the current line, will need to start a new line.
+				auto next = item;
+				++next;
+
+				// If we are already on a fresh line, or the item is too wide to fit on a new line of its
+				// own, we have to start emitting tokens and wrap in the middle of the item. If the item
+				// is a container, always use the splitting behavior.
+				if (currentWidth == 0 || item->width > desiredContinuationWidth || item->type == Container)
 				{
-					// Current item is too wide to fit on the current line, will need to start a new line.
-					auto next = item;
-					++next;
-
-					// If we are already on a fresh line, or the item is too wide to fit on a new line of its
-					// own, we have to start emitting tokens and wrap in the middle of the item. If the item
-					// is a container, always use the splitting behavior.
-					if (currentWidth == 0 || item->width > desiredContinuationWidth || item->type == Container)
+					if (item->type == Argument && currentWidth != 0)
 					{
-						if (item->type == Argument && currentWidth != 0)
+						// If an argument is too wide to show on a single line all by itself, start the argument
+						// on a new line, and add additional indentation for the continuation of the argument.
+						if (next != items.end())
 						{
-							// If an argument is too wide to show on a single line all by itself, start the argument
-							// on a new line, and add additional indentation for the continuation of the argument.
-							if (next != items.end())
-							{
-								layoutStack.push({vector(next, items.end()), additionalContinuationIndentation,
-									desiredWidth, desiredContinuationWidth, true});
-							}
-
-							newLine();
-
-							additionalContinuationIndentation += settings.tabWidth;
-							if (desiredContinuationWidth < settings.minimumContentLength + settings.tabWidth)
-								desiredContinuationWidth = settings.minimumContentLength;
-							else
-								desiredContinuationWidth -= settings.tabWidth;
-
-							layoutStack.push({item->items, additionalContinuationIndentation, desiredWidth,
-								desiredContinuationWidth, false});
-							break;
+							layoutStack.push({vector(next, items.end()), additionalContinuationIndentation,
+								desiredWidth, desiredContinuationWidth, true});
 						}
 
-						if (item->tokens.empty())
+						newLine();
+
+						additionalContinuationIndentation += settings.tabWidth;
+						if (desiredContinuationWidth < settings.minimumContentLength + settings.tabWidth)
+							desiredContinuationWidth = settings.minimumContentLength;
+						else
+							desiredContinuationWidth -= settings.tabWidth;
+
+						layoutStack.push({item->items, additionalContinuationIndentation, desiredWidth,
+							desiredContinuationWidth, false});
+						break;
+					}
+
+					if (item->tokens.empty())
+					{
+						// Item contains other items. Place the context onto the layout stack and resume processing.
+						if (next != items.end())
 						{
-							// Item contains other items. Place the context onto the layout stack and resume processing.
-							if (next != items.end())
-							{
-								layoutStack.push({vector(next, items.end()), additionalContinuationIndentation,
-									desiredWidth, desiredContinuationWidth, false});
-							}
-							layoutStack.push({item->items, additionalContinuationIndentation, desiredWidth,
-								desiredContinuationWidth, false});
-							break;
+							layoutStack.push({vector(next, items.end()), additionalContinuationIndentation,
+								desiredWidth, desiredContinuationWidth, false});
 						}
-
-						// Item is an atom. We just have to emit the tokens even though it is too wide.
-						item->AppendAllTokens(outputLine.tokens, firstTokenOfLine);
-						++item;
-						continue;
+						layoutStack.push({item->items, additionalContinuationIndentation, desiredWidth,
+							desiredContinuationWidth, false});
+						break;
 					}
 
-					// Start a new line and add the item on the fresh line.
-					newLine();
+					// Item is an atom. We just have to emit the tokens even though it is too wide.
+					item->AppendAllTokens(outputLine.tokens, firstTokenOfLine);
+					++item;
 					continue;
 				}
 
-				// Item fits, emit all tokens for it
-				item->AppendAllTokens(outputLine.tokens, firstTokenOfLine);
-				currentWidth += item->width;
-				++item;
+				// Start a new line and add the item on the fresh line.
+				newLine();
+				continue;
 			}
-		}
 
-		// Emit the last line if it had tokens
-		if (currentWidth > 0)
-			newLine();
+			// Item fits, emit all tokens for it
+			item->AppendAllTokens(outputLine.tokens, firstTokenOfLine);
+			currentWidth += item->width;
+			++item;
+		}
 	}
 
+	// Emit the last line if it had tokens
+	if (currentWidth > 0)
+		newLine();
+}
+
+
+vector<DisassemblyTextLine> GenericLineFormatter::FormatLines(
+	const vector<DisassemblyTextLine>& lines, const LineFormatterSettings& settings)
+{
+	vector<DisassemblyTextLine> result;
+	result.reserve(lines.size());
+	for (size_t i = 0; i < lines.size(); i++)
+	{
+		FormatLine(lines[i], (i + 1) < lines.size() ? &lines[i + 1] : nullptr, settings,
+			[&](DisassemblyTextLine&& line) { result.push_back(std::move(line)); });
+	}
 	return result;
 }
 
 
+GenericLineFormatter::Stream::Stream(
+	const LineFormatterSettings& settings, function<void(DisassemblyTextLine&&)> output) :
+	m_settings(settings), m_output(std::move(output))
+{
+}
+
+
+void GenericLineFormatter::Stream::Push(DisassemblyTextLine line)
+{
+	// The indentation of a line decides how the line before it wraps, so that line can be emitted now
+	if (m_pending)
+		FormatLine(*m_pending, &line, m_settings, m_output);
+	m_pending = std::move(line);
+}
+
+
+void GenericLineFormatter::Stream::Finish()
+{
+	if (m_pending)
+		FormatLine(*m_pending, nullptr, m_settings, m_output);
+	m_pending.reset();
+}
+
+
 extern "C"
 {
 	BN_DECLARE_CORE_ABI_VERSION
@@ -5,10 +5,32 @@
 
 class GenericLineFormatter: public BinaryNinja::LineFormatter
 {
+    static void FormatLine(const BinaryNinja::DisassemblyTextLine& line, const BinaryNinja::DisassemblyTextLine* nextLine,
+		const BinaryNinja::LineFormatterSettings& settings,
+		const std::function<void(BinaryNinja::DisassemblyTextLine&&)>& output);
+
 public:
     GenericLineFormatter();
 
     std::vector<BinaryNinja::DisassemblyTextLine> FormatLines(
         const std::vector<BinaryNinja::DisassemblyTextLine>& lines,
 		const BinaryNinja::LineFormatterSettings& settings) override;
+
+	/*! Formats lines as they are produced instead of all at once, for functions too large to hold twice.
+	    How a line wraps only depends on the indentation of the line after it, so a single line is held
+	    back until the next one is pushed or Finish is called.
+	*/
+	class Stream
+	{
+		BinaryNinja::LineFormatterSettings m_settings;
+		std::function<void(BinaryNinja::DisassemblyTextLine&&)> m_output;
+		std::optional<BinaryNinja::DisassemblyTextLine> m_pending;
+
+	public:
+		Stream(const BinaryNinja::LineFormatterSettings& settings,
+			std::function<void(BinaryNinja::DisassemblyTextLine&&)> output);
+
+		void Push(BinaryNinja::DisassemblyTextLine line);
+		void Finish();
+	};
 };
@@ -317,6 +317,79 @@ vector<Ref<BasicBlock>> Function::GetBasicBlocks() const
 }
 
 
+BorrowedList<BasicBlock> Function::BorrowBasicBlocks() const
+{
+	size_t count;
+	BNBasicBlock** blocks = BNGetFunctionBasicBlockList(m_object, &count);
+	return BorrowedList<BasicBlock>(blocks, count, BNFreeBasicBlockList);
+}
+
+
+shared_ptr<const DominatorTree> Function::GetDominatorTree(bool post, bool frontiers) const
+{
+	BorrowedList<BasicBlock> blocks = BorrowBasicBlocks();
+	unique_lock<mutex> lock(m_dominatorTreeMutex);
+	shared_ptr<const DominatorTree>& cached = m_dominatorTrees[post ? 1 : 0];
+	if (cached && (cached->hasFrontiers || !frontiers) && cached->blocks.size() == blocks.size())
+	{
+		// Blocks are replaced rather than updated when analysis changes them
+		bool current = true;
+		for (size_t i = 0; i < blocks.size() && current; i++)
+		{
+			size_t index = BNGetBasicBlockIndex(blocks.GetObject(i));
+			current = index < blocks.size() && cached->blocks[index]->GetObject() == blocks.GetObject(i);
+		}
+		if (current)
+			return cached;
+	}
+
+	auto tree = make_shared<DominatorTree>();
+	tree->blocks.resize(blocks.size());
+	for (size_t i = 0; i < blocks.size(); i++)
+	{
+		size_t index = BNGetBasicBlockIndex(blocks.GetObject(i));
+		if (index >= tree->blocks.size())
+			tree->blocks.resize(index + 1);
+		tree->blocks[index] = blocks[i];
+	}
+
+	tree->immediateDominators.resize(tree->blocks.size(), DominatorTree::NoBlock);
+	for (size_t i = 0; i < tree->blocks.size(); i++)
+	{
+		if (!tree->blocks[i])
+			continue;
+		BNBasicBlock* dominator = BNGetBasicBlockImmediateDominator(tree->blocks[i]->GetObject(), post);
+		if (!dominator)
+			continue;
+		tree->immediateDominators[i] = BNGetBasicBlockIndex(dominator);
+		BNFreeBasicBlock(dominator);
+	}
+
+	if (frontiers)
+	{
+		tree->frontierOffsets.reserve(tree->blocks.size() + 1);
+		tree->frontierOffsets.push_back(0);
+		for (size_t i = 0; i < tree->blocks.size(); i++)
+		{
+			if (tree->blocks[i])
+			{
+				size_t count;
+				BNBasicBlock** frontier = BNGetBasicBlockDominanceFrontier(tree->blocks[i]->GetObject(), &count, post);
+				for (size_t j = 0; j < count; j++)
+					tree->frontier.push_back(BNGetBasicBlockIndex(frontier[j]));
+				BNFreeBasicBlockList(frontier, count);
+				sort(tree->frontier.begin() + tree->frontierOffsets.back(), tree->frontier.end());
+			}
+			tree->frontierOffsets.push_back(tree->frontier.size());
+		}
+		tree->hasFrontiers = true;
+	}
+
+	cached = tree;
+	return tree;
+}
+
+
 Ref<BasicBlock> Function::GetBasicBlockAtAddress(Architecture* arch, uint64_t addr) const
 {
 	BNBasicBlock* block = BNGetFunctionBasicBlockAtAddress(m_object, arch->GetObject(), addr);
@@ -639,6 +712,33 @@ RegisterValue Function::GetRegisterValueAfterInstruction(Architecture* arch, uin
 }
 
 
+vector<RegisterValue> Function::GetRegisterValuesAtInstructions(
+	Architecture* arch, const vector<pair<uint64_t, uint32_t>>& queries, bool after)
+{
+	auto query = after ? BNGetRegisterValueAfterInstruction : BNGetRegisterValueAtInstruction;
+	BNArchitecture* archObject = arch->GetObject();
+	vector<RegisterValue> result;
+	result.reserve(queries.size());
+	for (auto& [addr, reg] : queries)
+		result.push_back(RegisterValue::FromAPIObject(query(m_object, archObject, addr, reg)));
+	return result;
+}
+
+
+vector<RegisterValue> Function::GetRegisterValuesAtInstructions(
+	Architecture* arch, const vector<uint64_t>& addrs, const vector<uint32_t>& regs, bool after)
+{
+	auto query = after ? BNGetRegisterValueAfterInstruction : BNGetRegisterValueAtInstruction;
+	BNArchitecture* archObject = arch->GetObject();
+	vector<RegisterValue> result;
+	result.reserve(addrs.size() * regs.size());
+	for (uint64_t addr : addrs)
+		for (uint32_t reg : regs)
+			result.push_back(RegisterValue::FromAPIObject(query(m_object, archObject, addr, reg)));
+	return result;
+}
+
+
 RegisterValue Function::GetStackContentsAtInstruction(Architecture* arch, uint64_t addr, int64_t offset, size_t size)
 {
 	BNRegisterValue value = BNGetStackContentsAtInstruction(m_object, arch->GetObject(), addr, offset, size);
@@ -1311,6 +1411,16 @@ map<int64_t, vector<VariableNameAndType>> Function::GetStackLayout()
 }
 
 
+shared_ptr<const vector<VariableNameAndType>> Function::GetStackLayoutSnapshot()
+{
+	size_t count;
+	BNVariableNameAndType* vars = BNGetStackLayout(m_object, &count);
+	auto result = GetCachedVariableList(vars, count, m_stackLayoutCache, true);
+	BNFreeVariableNameAndTypeList(vars, count);
+	return result;
+}
+
+
 void Function::CreateAutoStackVariable(int64_t offset, const Confidence<Ref<Type>>& type, const string& name)
 {
 	BNTypeWithConfidence tc;
@@ -1379,6 +1489,62 @@ map<Variable, VariableNameAndType> Function::GetVariables()
 }
 
 
+shared_ptr<const vector<VariableNameAndType>> Function::GetVariablesSnapshot()
+{
+	size_t count;
+	BNVariableNameAndType* vars = BNGetFunctionVariables(m_object, &count);
+	auto result = GetCachedVariableList(vars, count, m_variableCache, false);
+	BNFreeVariableNameAndTypeList(vars, count);
+	return result;
+}
+
+
+shared_ptr<const vector<VariableNameAndType>> Function::GetCachedVariableList(
+	BNVariableNameAndType* vars, size_t count, VariableListCache& cache, bool byStackOffset)
+{
+	unique_lock<mutex> lock(m_variableCacheMutex);
+	if (cache.variables && cache.positions.size() == count)
+	{
+		// Comparing against the core's list is much cheaper than wrapping every name and type again
+		bool current = true;
+		for (size_t i = 0; i < count && current; i++)
+		{
+			const VariableNameAndType& var = (*cache.variables)[cache.positions[i]];
+			current = var.var == Variable(vars[i].var) && var.type->GetObject() == vars[i].type
+				&& var.type.GetConfidence() == vars[i].typeConfidence && var.autoDefined == vars[i].autoDefined
+				&& var.name == vars[i].name;
+		}
+		if (current)
+			return cache.variables;
+	}
+
+	vector<size_t> order(count);
+	for (size_t i = 0; i < count; i++)
+		order[i] = i;
+	stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+		if (byStackOffset)
+			return vars[a].var.storage < vars[b].var.storage;
+		return Variable(vars[a].var) < Variable(vars[b].var);
+	});
+
+	auto result = make_shared<vector<VariableNameAndType>>();
+	result->reserve(count);
+	cache.positions.resize(count);
+	for (size_t i : order)
+	{
+		VariableNameAndType var;
+		var.name = vars[i].name;
+		var.type = Confidence<Ref<Type>>(new Type(BNNewTypeReference(vars[i].type)), vars[i].typeConfidence);
+		var.var = vars[i].var;
+		var.autoDefined = vars[i].autoDefined;
+		cache.positions[i] = result->size();
+		result->push_back(std::move(var));
+	}
+	cache.variables = result;
+	return result;
+}
+
+
 set<Variable> Function::GetMediumLevelILVariables()
 {
 	Ref<MediumLevelILFunction> mlil = this->GetMediumLevelIL();
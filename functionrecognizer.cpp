@@ -18,7 +18,9 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <algorithm>
 #include "binaryninjaapi.h"
+#include "lowlevelilinstruction.h"
 
 using namespace BinaryNinja;
 
@@ -78,3 +80,64 @@ bool FunctionRecognizer::RecognizeMediumLevelIL(BinaryView*, Function*, MediumLe
 {
 	return false;
 }
+
+
+static void SortUnique(std::vector<uint64_t>& values)
+{
+	std::sort(values.begin(), values.end());
+	values.erase(std::unique(values.begin(), values.end()), values.end());
+}
+
+
+std::shared_ptr<const LowLevelILFeatures> FunctionRecognizer::GetLowLevelILFeatures(LowLevelILFunction* il)
+{
+	// Holding the reference keeps the core from reusing the IL's address for another function while cached
+	thread_local Ref<LowLevelILFunction> cachedIL;
+	thread_local std::shared_ptr<const LowLevelILFeatures> cachedFeatures;
+
+	size_t count = il->GetInstructionCount();
+	if (cachedIL && cachedIL->GetObject() == il->GetObject() && cachedFeatures->instructionCount == count)
+		return cachedFeatures;
+
+	auto features = std::make_shared<LowLevelILFeatures>();
+	features->instructionCount = count;
+	auto addTarget = [&](const LowLevelILInstruction& dest, std::vector<uint64_t>& targets) {
+		if (dest.operation == LLIL_CONST_PTR || dest.operation == LLIL_CONST)
+			targets.push_back(dest.GetConstant());
+		else
+			features->hasIndirectBranch = true;
+	};
+
+	for (size_t i = 0; i < count; i++)
+	{
+		il->GetInstruction(i).VisitExprs([&](const LowLevelILInstruction& expr) {
+			switch (expr.operation)
+			{
+			case LLIL_CONST:
+			case LLIL_CONST_PTR:
+			case LLIL_EXTERN_PTR:
+				features->constants.push_back(expr.GetConstant());
+				break;
+			case LLIL_CALL:
+			case LLIL_CALL_STACK_ADJUST:
+			case LLIL_TAILCALL:
+				addTarget(expr.GetDestExpr(), features->callTargets);
+				break;
+			case LLIL_JUMP:
+			case LLIL_JUMP_TO:
+				addTarget(expr.GetDestExpr(), features->jumpTargets);
+				break;
+			default:
+				break;
+			}
+			return true;
+		});
+	}
+
+	SortUnique(features->callTargets);
+	SortUnique(features->jumpTargets);
+	SortUnique(features->constants);
+	cachedIL = il;
+	cachedFeatures = features;
+	return features;
+}
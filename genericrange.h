@@ -239,6 +239,166 @@ using namespace std;
 		}
 	};
 
+	// Interval tree over ranges sorted by start: an implicit balanced tree over the sorted array records the largest
+	// end in each subtree, so lookups are O(log n + k) for k results and overlapping ranges are allowed. The tree is
+	// immutable once built; see ConcurrentGenericRangeTree for one that can change under concurrent readers. Range
+	// values are inclusive.
+	template <typename T>
+	class GenericRangeTree
+	{
+	public:
+		struct Entry
+		{
+			uint64_t start;
+			uint64_t end;
+			T value;
+		};
+
+	private:
+		vector<Entry> m_entries;
+		// Largest end of the subtree rooted at each index, for the subtree over [lo, hi) rooted at (lo + hi) / 2
+		vector<uint64_t> m_maxEnd;
+
+		uint64_t build(size_t lo, size_t hi)
+		{
+			size_t mid = lo + (hi - lo) / 2;
+			uint64_t maxEnd = m_entries[mid].end;
+			if (lo < mid)
+				maxEnd = std::max(maxEnd, build(lo, mid));
+			if (mid + 1 < hi)
+				maxEnd = std::max(maxEnd, build(mid + 1, hi));
+			m_maxEnd[mid] = maxEnd;
+			return maxEnd;
+		}
+
+		// Visits the entries overlapping [start, end] in order of their start until func returns false
+		template <typename F>
+		bool visit(size_t lo, size_t hi, uint64_t start, uint64_t end, F& func) const
+		{
+			if (lo >= hi)
+				return true;
+			size_t mid = lo + (hi - lo) / 2;
+			if (m_maxEnd[mid] < start)
+				return true;
+			if (!visit(lo, mid, start, end, func))
+				return false;
+			// Everything from here on starts after the query
+			if (m_entries[mid].start > end)
+				return true;
+			if (m_entries[mid].end >= start && !func(m_entries[mid]))
+				return false;
+			return visit(mid + 1, hi, start, end, func);
+		}
+
+	public:
+		GenericRangeTree() = default;
+
+		// Builds the tree in O(n) if entries are already sorted by start, as they are when they come from another
+		// tree or a GenericRangeMap, and O(n log n) otherwise
+		GenericRangeTree(vector<Entry> entries) : m_entries(std::move(entries))
+		{
+			auto byStart = [](const Entry& a, const Entry& b) { return a.start < b.start; };
+			if (!std::is_sorted(m_entries.begin(), m_entries.end(), byStart))
+				std::stable_sort(m_entries.begin(), m_entries.end(), byStart);
+			m_maxEnd.resize(m_entries.size());
+			if (!m_entries.empty())
+				build(0, m_entries.size());
+		}
+
+		size_t size() const { return m_entries.size(); }
+		bool empty() const { return m_entries.empty(); }
+
+		// Entries sorted by start; entries with the same start keep the order they were given in
+		const vector<Entry>& GetEntries() const { return m_entries; }
+
+		// Calls func(const Entry&) for each entry overlapping [start, end], in order of start, until it returns false
+		template <typename F>
+		void ForEachOverlapping(uint64_t start, uint64_t end, F&& func) const
+		{
+			visit(0, m_entries.size(), start, end, func);
+		}
+
+		vector<const Entry*> GetOverlapping(uint64_t start, uint64_t end) const
+		{
+			vector<const Entry*> result;
+			ForEachOverlapping(start, end, [&](const Entry& entry) {
+				result.push_back(&entry);
+				return true;
+			});
+			return result;
+		}
+
+		vector<const Entry*> GetContaining(uint64_t addr) const { return GetOverlapping(addr, addr); }
+
+		// The entry containing addr with the greatest start, which is the innermost one when entries nest
+		const Entry* GetInnermostContaining(uint64_t addr) const
+		{
+			const Entry* result = nullptr;
+			ForEachOverlapping(addr, addr, [&](const Entry& entry) {
+				result = &entry;
+				return true;
+			});
+			return result;
+		}
+	};
+
+	// A GenericRangeTree that can be updated while other threads query it. Readers take a snapshot, which is an
+	// immutable tree that stays valid for as long as they hold it, without blocking on writers or each other.
+	// Writers rebuild the tree and publish it atomically, so updates are O(n) and batching them with Update is
+	// much cheaper than many single inserts; this suits address metadata that is written once during loading and
+	// read from every analysis thread afterwards.
+	template <typename T>
+	class ConcurrentGenericRangeTree
+	{
+	public:
+		using Tree = GenericRangeTree<T>;
+		using Entry = typename Tree::Entry;
+
+	private:
+		std::shared_ptr<const Tree> m_tree;
+		std::mutex m_writeMutex;
+
+	public:
+		ConcurrentGenericRangeTree() : m_tree(std::make_shared<const Tree>()) {}
+		ConcurrentGenericRangeTree(vector<Entry> entries) : m_tree(std::make_shared<const Tree>(std::move(entries))) {}
+
+		std::shared_ptr<const Tree> GetSnapshot() const { return std::atomic_load(&m_tree); }
+
+		// Replaces the entries with the result of func(vector<Entry>&) applied to a copy of the current ones
+		template <typename F>
+		void Update(F&& func)
+		{
+			std::unique_lock<std::mutex> lock(m_writeMutex);
+			vector<Entry> entries = std::atomic_load(&m_tree)->GetEntries();
+			func(entries);
+			std::atomic_store(&m_tree, std::shared_ptr<const Tree>(std::make_shared<const Tree>(std::move(entries))));
+		}
+
+		void Insert(uint64_t start, uint64_t end, const T& value)
+		{
+			Update([&](vector<Entry>& entries) {
+				auto pos = std::upper_bound(entries.begin(), entries.end(), start,
+					[](uint64_t start, const Entry& entry) { return start < entry.start; });
+				entries.insert(pos, Entry {start, end, value});
+			});
+		}
+
+		// Removes every entry for which predicate(const Entry&) returns true
+		template <typename F>
+		void RemoveIf(F&& predicate)
+		{
+			Update([&](vector<Entry>& entries) {
+				entries.erase(std::remove_if(entries.begin(), entries.end(), predicate), entries.end());
+			});
+		}
+
+		void Clear()
+		{
+			std::unique_lock<std::mutex> lock(m_writeMutex);
+			std::atomic_store(&m_tree, std::shared_ptr<const Tree>(std::make_shared<const Tree>()));
+		}
+	};
+
 #ifdef BINARYNINJACORE_LIBRARY
 }
 #endif
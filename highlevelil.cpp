@@ -75,12 +75,14 @@ HighLevelILInstruction HighLevelILFunction::GetRootExpr()
 
 void HighLevelILFunction::SetRootExpr(ExprId expr)
 {
+	ClearCaches();
 	BNSetHighLevelILRootExpr(m_object, expr);
 }
 
 
 void HighLevelILFunction::SetRootExpr(const HighLevelILInstruction& expr)
 {
+	ClearCaches();
 	BNSetHighLevelILRootExpr(m_object, expr.exprIndex);
 }
 
@@ -88,6 +90,7 @@ void HighLevelILFunction::SetRootExpr(const HighLevelILInstruction& expr)
 ExprId HighLevelILFunction::AddExpr(
     BNHighLevelILOperation operation, size_t size, ExprId a, ExprId b, ExprId c, ExprId d, ExprId e)
 {
+	ClearCaches();
 	return BNHighLevelILAddExpr(m_object, operation, size, a, b, c, d, e);
 }
 
@@ -95,6 +98,7 @@ ExprId HighLevelILFunction::AddExpr(
 ExprId HighLevelILFunction::AddExprWithLocation(BNHighLevelILOperation operation, uint64_t addr, uint32_t sourceOperand,
     size_t size, ExprId a, ExprId b, ExprId c, ExprId d, ExprId e)
 {
+	ClearCaches();
 	return BNHighLevelILAddExprWithLocation(m_object, operation, addr, sourceOperand, size, a, b, c, d, e);
 }
 
@@ -102,6 +106,7 @@ ExprId HighLevelILFunction::AddExprWithLocation(BNHighLevelILOperation operation
 ExprId HighLevelILFunction::AddExprWithLocation(BNHighLevelILOperation operation, const ILSourceLocation& loc,
     size_t size, ExprId a, ExprId b, ExprId c, ExprId d, ExprId e)
 {
+	ClearCaches();
 	if (loc.valid)
 	{
 		return BNHighLevelILAddExprWithLocation(
@@ -126,6 +131,7 @@ vector<uint64_t> HighLevelILFunction::GetOperandList(ExprId expr, size_t listOpe
 
 ExprId HighLevelILFunction::AddOperandList(const vector<ExprId>& operands)
 {
+	ClearCaches();
 	uint64_t* operandList = new uint64_t[operands.size()];
 	for (size_t i = 0; i < operands.size(); i++)
 		operandList[i] = operands[i];
@@ -137,6 +143,7 @@ ExprId HighLevelILFunction::AddOperandList(const vector<ExprId>& operands)
 
 ExprId HighLevelILFunction::AddIndexList(const vector<size_t>& operands)
 {
+	ClearCaches();
 	uint64_t* operandList = new uint64_t[operands.size()];
 	for (size_t i = 0; i < operands.size(); i++)
 		operandList[i] = operands[i];
@@ -148,6 +155,7 @@ ExprId HighLevelILFunction::AddIndexList(const vector<size_t>& operands)
 
 ExprId HighLevelILFunction::AddSSAVariableList(const vector<SSAVariable>& vars)
 {
+	ClearCaches();
 	uint64_t* operandList = new uint64_t[vars.size() * 2];
 	for (size_t i = 0; i < vars.size(); i++)
 	{
@@ -162,12 +170,16 @@ ExprId HighLevelILFunction::AddSSAVariableList(const vector<SSAVariable>& vars)
 
 BNHighLevelILInstruction HighLevelILFunction::GetRawExpr(size_t i) const
 {
+	if (m_exprArena && i < m_exprArena->exprs.size())
+		return m_exprArena->exprs[i];
 	return BNGetHighLevelILByIndex(m_object, i, true);
 }
 
 
 BNHighLevelILInstruction HighLevelILFunction::GetRawNonASTExpr(size_t i) const
 {
+	if (m_exprArena && i < m_exprArena->nonASTExprs.size())
+		return m_exprArena->nonASTExprs[i];
 	return BNGetHighLevelILByIndex(m_object, i, false);
 }
 
@@ -193,30 +205,141 @@ HighLevelILInstruction HighLevelILFunction::GetExpr(size_t i, bool asFullAst)
 }
 
 
+size_t HighLevelILFunction::GetInstructions(size_t start, size_t count, vector<HighLevelILInstruction>& result)
+{
+	size_t total = GetInstructionCount();
+	if (start >= total)
+		return 0;
+	count = min(count, total - start);
+	result.reserve(result.size() + count);
+	for (size_t i = start; i < start + count; i++)
+	{
+		size_t expr = GetIndexForInstruction(i);
+		result.emplace_back(this, GetRawNonASTExpr(expr), expr, false, i);
+	}
+	return count;
+}
+
+
+size_t HighLevelILFunction::GetExprs(size_t start, size_t count, vector<HighLevelILInstruction>& result, bool asFullAst)
+{
+	size_t total = GetExprCount();
+	if (start >= total)
+		return 0;
+	count = min(count, total - start);
+	result.reserve(result.size() + count);
+	for (size_t i = start; i < start + count; i++)
+	{
+		result.emplace_back(
+		    this, asFullAst ? GetRawExpr(i) : GetRawNonASTExpr(i), i, asFullAst, GetInstructionForExpr(i));
+	}
+	return count;
+}
+
+
 size_t HighLevelILFunction::GetIndexForInstruction(size_t i) const
 {
+	if (m_exprArena && i < m_exprArena->exprForInstruction.size())
+		return m_exprArena->exprForInstruction[i];
 	return BNGetHighLevelILIndexForInstruction(m_object, i);
 }
 
 
 size_t HighLevelILFunction::GetInstructionForExpr(size_t expr) const
 {
+	if (m_exprArena && expr < m_exprArena->instructionForExpr.size())
+		return m_exprArena->instructionForExpr[expr];
 	return BNGetHighLevelILInstructionForExpr(m_object, expr);
 }
 
 
 size_t HighLevelILFunction::GetInstructionCount() const
 {
+	if (m_exprArena)
+		return m_exprArena->exprForInstruction.size();
 	return BNGetHighLevelILInstructionCount(m_object);
 }
 
 
 size_t HighLevelILFunction::GetExprCount() const
 {
+	if (m_exprArena)
+		return m_exprArena->exprs.size();
 	return BNGetHighLevelILExprCount(m_object);
 }
 
 
+shared_ptr<const HighLevelILExprArena> HighLevelILFunction::GetExprArena()
+{
+	if (m_exprArena)
+		return m_exprArena;
+
+	auto arena = make_shared<HighLevelILExprArena>();
+	size_t exprCount = BNGetHighLevelILExprCount(m_object);
+	arena->exprs.reserve(exprCount);
+	arena->nonASTExprs.reserve(exprCount);
+	arena->instructionForExpr.reserve(exprCount);
+	for (size_t i = 0; i < exprCount; i++)
+	{
+		arena->exprs.push_back(BNGetHighLevelILByIndex(m_object, i, true));
+		arena->nonASTExprs.push_back(BNGetHighLevelILByIndex(m_object, i, false));
+		arena->instructionForExpr.push_back(BNGetHighLevelILInstructionForExpr(m_object, i));
+	}
+
+	size_t instrCount = BNGetHighLevelILInstructionCount(m_object);
+	arena->exprForInstruction.reserve(instrCount);
+	for (size_t i = 0; i < instrCount; i++)
+		arena->exprForInstruction.push_back(BNGetHighLevelILIndexForInstruction(m_object, i));
+
+	m_exprArena = arena;
+	return m_exprArena;
+}
+
+
+void HighLevelILFunction::ReleaseExprArena()
+{
+	m_exprArena.reset();
+}
+
+
+void HighLevelILFunction::ClearCaches()
+{
+	m_exprArena.reset();
+	m_structuralHashes.reset();
+}
+
+
+// Operand types of HLIL, for ILStructuralHashTable::AppendInstruction
+struct HighLevelILOperandKinds
+{
+	static constexpr HighLevelILOperandType Integer = IntegerHighLevelOperand;
+	static constexpr HighLevelILOperandType ConstantData = ConstantDataHighLevelOperand;
+	static constexpr HighLevelILOperandType Index = IndexHighLevelOperand;
+	static constexpr HighLevelILOperandType Intrinsic = IntrinsicHighLevelOperand;
+	static constexpr HighLevelILOperandType Expr = ExprHighLevelOperand;
+	static constexpr HighLevelILOperandType Variable = VariableHighLevelOperand;
+	static constexpr HighLevelILOperandType SSAVariable = SSAVariableHighLevelOperand;
+	static constexpr HighLevelILOperandType IndexList = IndexListHighLevelOperand;
+	static constexpr HighLevelILOperandType SSAVariableList = SSAVariableListHighLevelOperand;
+	static constexpr HighLevelILOperandType ExprList = ExprListHighLevelOperand;
+};
+
+
+shared_ptr<const ILStructuralHashTable> HighLevelILFunction::GetStructuralHashes()
+{
+	if (m_structuralHashes)
+		return m_structuralHashes;
+
+	m_structuralHashes = ILStructuralHashTable::Build(
+	    GetExprCount(), [&](size_t expr, vector<ILStructuralHashTable::Component>& out) {
+		    // Every HLIL operand type is one AppendInstruction knows
+		    ILStructuralHashTable::AppendInstruction<HighLevelILOperandKinds>(
+		        GetExpr(expr), out, [](const HighLevelILOperand&, vector<ILStructuralHashTable::Component>&) {});
+	    });
+	return m_structuralHashes;
+}
+
+
 vector<Ref<BasicBlock>> HighLevelILFunction::GetBasicBlocks() const
 {
 	size_t count;
@@ -438,30 +561,35 @@ set<size_t> HighLevelILFunction::GetMediumLevelILExprIndexes(size_t expr) const
 
 void HighLevelILFunction::UpdateInstructionOperand(size_t i, size_t operandIndex, ExprId value)
 {
+	ClearCaches();
 	BNUpdateHighLevelILOperand(m_object, i, operandIndex, value);
 }
 
 
 void HighLevelILFunction::ReplaceExpr(size_t expr, size_t newExpr)
 {
+	ClearCaches();
 	BNReplaceHighLevelILExpr(m_object, expr, newExpr);
 }
 
 
 void HighLevelILFunction::SetExprAttributes(size_t expr, uint32_t attributes)
 {
+	ClearCaches();
 	BNSetHighLevelILExprAttributes(m_object, expr, attributes);
 }
 
 
 void HighLevelILFunction::Finalize()
 {
+	ClearCaches();
 	BNFinalizeHighLevelILFunction(m_object);
 }
 
 
 void HighLevelILFunction::GenerateSSAForm(const set<Variable>& aliases)
 {
+	ClearCaches();
 	BNVariable* aliasList = new BNVariable[aliases.size()];
 
 	size_t i = 0;
@@ -534,6 +662,7 @@ Confidence<Ref<Type>> HighLevelILFunction::GetExprType(const HighLevelILInstruct
 
 void HighLevelILFunction::SetExprType(size_t expr, const Confidence<Ref<Type>>& type)
 {
+	ClearCaches();
 	BNTypeWithConfidence tc;
 	tc.type = type->GetObject();
 	tc.confidence = type.GetConfidence();
@@ -647,6 +776,38 @@ HighLevelILTokenEmitter::HighLevelILTokenEmitter(BNHighLevelILTokenEmitter* emit
 	m_object = emitter;
 }
 
+
+void HighLevelILTokenEmitter::AppendToken(const InstructionTextToken& token)
+{
+	// The core copies what it needs from the token, so it can borrow the strings instead of getting its own
+	// allocations. Most tokens have no type names, and the rest rarely have more than a few.
+	char* inlineNames[4];
+	vector<char*> namesStorage;
+	char** names = inlineNames;
+	if (token.typeNames.size() > 4)
+	{
+		namesStorage.resize(token.typeNames.size());
+		names = namesStorage.data();
+	}
+	for (size_t i = 0; i < token.typeNames.size(); i++)
+		names[i] = const_cast<char*>(token.typeNames[i].c_str());
+
+	BNInstructionTextToken converted;
+	converted.type = token.type;
+	converted.text = const_cast<char*>(token.text.c_str());
+	converted.value = token.value;
+	converted.width = token.width;
+	converted.size = token.size;
+	converted.operand = token.operand;
+	converted.context = token.context;
+	converted.confidence = token.confidence;
+	converted.address = token.address;
+	converted.typeNames = names;
+	converted.namesCount = token.typeNames.size();
+	converted.exprIndex = token.exprIndex;
+	BNHighLevelILTokenEmitterAppend(m_object, &converted);
+}
+
 void HighLevelILTokenEmitter::PrependCollapseIndicator()
 {
 	BNHighLevelILTokenPrependCollapseBlankIndicator(m_object);
@@ -1286,18 +1286,15 @@ void HighLevelILInstruction::CollectSubExprs(stack<size_t>& toProcess) const
 }
 
 
+HighLevelILInstruction HighLevelILInstruction::GetSubExpr(size_t expr) const
+{
+	return function->GetExpr(expr, ast);
+}
+
+
 void HighLevelILInstruction::VisitExprs(const std::function<bool(const HighLevelILInstruction& expr)>& func) const
 {
-	stack<size_t> toProcess;
-	toProcess.push(exprIndex);
-	while (!toProcess.empty())
-	{
-		HighLevelILInstruction cur = function->GetExpr(toProcess.top(), ast);
-		toProcess.pop();
-		if (!func(cur))
-			continue;
-		cur.CollectSubExprs(toProcess);
-	}
+	VisitExprs<const std::function<bool(const HighLevelILInstruction& expr)>&>(func);
 }
 
 
@@ -454,7 +454,27 @@ namespace BinaryNinja
 		HighLevelILInstruction(const HighLevelILInstructionBase& instr);
 
 		void CollectSubExprs(_STD_STACK<size_t>& toProcess) const;
+		// Fetch expression \c expr of this expression's function, in the same AST form as this one
+		HighLevelILInstruction GetSubExpr(size_t expr) const;
 		void VisitExprs(const std::function<bool(const HighLevelILInstruction& expr)>& func) const;
+
+		/*! Visit this expression and its subexpressions in pre-order using an explicit stack. Subexpressions of
+			an expression are skipped when \c func returns false for it. The callable is invoked directly
+			rather than through \c std::function, so prefer this overload for whole-function traversals.
+		*/
+		template <typename Func>
+		void VisitExprs(Func&& func) const
+		{
+			_STD_STACK<size_t> toProcess;
+			toProcess.push(exprIndex);
+			while (!toProcess.empty())
+			{
+				HighLevelILInstruction cur = GetSubExpr(toProcess.top());
+				toProcess.pop();
+				if (func(static_cast<const HighLevelILInstruction&>(cur)))
+					cur.CollectSubExprs(toProcess);
+			}
+		}
 		void VisitExprs(const std::function<bool(const HighLevelILInstruction& expr)>& preFunc,
 			const std::function<void(const HighLevelILInstruction& expr)>& postFunc) const;
 
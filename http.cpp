@@ -48,12 +48,14 @@ namespace BinaryNinja::Http
 	{
 		size_t uploadOffset;
 		size_t downloadLength;
+		size_t downloadOffset;
 		bool cancelled;
 		const Request& request;
 		Response& response;
 
 		RequestContext(const Request& request, Response& response) :
-		    uploadOffset(0), downloadLength(0), cancelled(false), request(request), response(response)
+		    uploadOffset(0), downloadLength(0), downloadOffset(0), cancelled(false), request(request),
+		    response(response)
 		{}
 	};
 
@@ -100,8 +102,7 @@ namespace BinaryNinja::Http
 	uint64_t HttpWriteCallback(uint8_t* data, uint64_t len, void* ctxt)
 	{
 		auto* request = reinterpret_cast<RequestContext*>(ctxt);
-		// copy can totally take pointers, pretty cool
-		copy(data, &data[len], back_inserter(request->response.body));
+		bool streaming = (bool)request->request.m_bodyCallback;
 
 		// Detect content length if it has not been found yet
 		if (request->downloadLength == 0)
@@ -111,7 +112,8 @@ namespace BinaryNinja::Http
 			if (found != headers.end())
 			{
 				request->downloadLength = strtoll(found->second.c_str(), nullptr, 10);
-				request->response.body.reserve(request->downloadLength);
+				if (!streaming)
+					request->response.body.reserve(request->downloadLength);
 			}
 			else
 			{
@@ -119,9 +121,24 @@ namespace BinaryNinja::Http
 			}
 		}
 
+		if (streaming)
+		{
+			if (!request->request.m_bodyCallback(data, len))
+			{
+				request->cancelled = true;
+				return 0;
+			}
+		}
+		else
+		{
+			// copy can totally take pointers, pretty cool
+			copy(data, &data[len], back_inserter(request->response.body));
+		}
+		request->downloadOffset += len;
+
 		if (request->request.m_downloadProgress)
 		{
-			if (!request->request.m_downloadProgress(request->response.body.size(), request->downloadLength))
+			if (!request->request.m_downloadProgress(request->downloadOffset, request->downloadLength))
 			{
 				// Signal error by returning non-len
 				request->cancelled = true;
@@ -415,6 +432,9 @@ namespace BinaryNinja::Http
 			response.error = instance->GetError();
 			if (retry == HTTP_MAX_RETRIES || context.cancelled)
 				break;
+			// A streaming sink can't take the body from the start again
+			if (request.m_bodyCallback && context.downloadOffset != 0)
+				break;
 			size_t backoff = 1000 * HTTP_BACKOFF_FACTOR * (2 * pow(2, retry - 1));
 			retry += 1;
 			LogWarn("Attempt %d to %s %s failed, trying again in %zums\n", retry, request.m_method.data(),
@@ -456,14 +476,21 @@ namespace BinaryNinja::Http
 	}
 
 
-	Json::Value Response::GetJson() const
+	// Parses the body in place instead of copying it to a string first, with a reader kept per thread since
+	// building one costs more than parsing a small response
+	static bool ParseJsonBody(const vector<uint8_t>& body, Json::Value& value, string& errors)
 	{
-		string str = GetString();
+		thread_local std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
+		const char* begin = reinterpret_cast<const char*>(body.data());
+		return reader->parse(begin, begin + body.size(), &value, &errors);
+	}
 
-		std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
+
+	Json::Value Response::GetJson() const
+	{
 		string errors;
 		Json::Value value;
-		if (!reader->parse(str.data(), str.data() + str.size(), &value, &errors))
+		if (!ParseJsonBody(body, value, errors))
 		{
 			throw std::runtime_error(std::string("Could not parse JSON: ") + errors.c_str());
 		}
@@ -473,10 +500,7 @@ namespace BinaryNinja::Http
 
 	bool Response::GetJson(Json::Value& value) const noexcept
 	{
-		string str = GetString();
-
-		std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
 		string errors;
-		return reader->parse(str.data(), str.data() + str.size(), &value, &errors);
+		return ParseJsonBody(body, value, errors);
 	}
 }  // namespace BinaryNinjaCore::Http
@@ -198,6 +198,14 @@ namespace BinaryNinja::Http
 		std::function<bool(size_t, size_t)> m_downloadProgress;
 		std::function<bool(size_t, size_t)> m_uploadProgress;
 
+		/*!
+		    Optional sink for the response body. When set, each chunk is passed to it as it arrives
+		    and Response::body stays empty, so large downloads never need to be held in memory.
+		    Return false to cancel the request. A request that has already streamed data is not
+		    retried, since the sink would see the start of the body again.
+		 */
+		std::function<bool(const uint8_t*, size_t)> m_bodyCallback;
+
 		/*!
 		    Construct an arbitrary HTTP request with an empty body
 		    \param method Request method eg GET
@@ -0,0 +1,255 @@
+#include "binaryninjaapi.h"
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+using namespace BinaryNinja;
+using namespace std;
+
+
+struct Instrumentation::Histogram
+{
+	string name;
+	string category;
+	atomic<uint64_t> count {0};
+	atomic<uint64_t> sum {0};
+	atomic<uint64_t> min {UINT64_MAX};
+	atomic<uint64_t> max {0};
+	atomic<uint64_t> buckets[65];
+
+	Histogram(const string& n) : name(n), category(n.substr(0, n.find('.')))
+	{
+		for (auto& bucket : buckets)
+			bucket = 0;
+	}
+};
+
+
+namespace
+{
+	struct InstrumentationTraceEvent
+	{
+		Instrumentation::Histogram* histogram;
+		size_t threadId;
+		uint64_t startUs;
+		uint64_t durationUs;
+	};
+
+	struct InstrumentationRegistry
+	{
+		mutex m;
+		map<string, unique_ptr<atomic<int64_t>>> counters;
+		map<string, unique_ptr<Instrumentation::Histogram>> histograms;
+
+		mutex traceMutex;
+		vector<InstrumentationTraceEvent> trace;
+		size_t traceLimit = 0;
+		chrono::steady_clock::time_point traceStart;
+	};
+}
+
+
+// Instruments are usually statics that keep pointers into the registry, so it is never destroyed and is created
+// on first use rather than depending on the order static initializers run in
+static InstrumentationRegistry& GetRegistry()
+{
+	static InstrumentationRegistry* registry = new InstrumentationRegistry;
+	return *registry;
+}
+
+
+atomic<bool> Instrumentation::s_enabled {getenv("BN_API_INSTRUMENTATION") != nullptr};
+atomic<bool> Instrumentation::s_tracing {false};
+
+
+void Instrumentation::SetEnabled(bool enabled)
+{
+	s_enabled = enabled;
+}
+
+
+void Instrumentation::SetTracingEnabled(bool enabled, size_t maxEvents)
+{
+	InstrumentationRegistry& registry = GetRegistry();
+	unique_lock<mutex> lock(registry.traceMutex);
+	if (enabled)
+	{
+		registry.trace.clear();
+		registry.traceLimit = maxEvents;
+		registry.traceStart = chrono::steady_clock::now();
+		s_enabled = true;
+	}
+	s_tracing = enabled;
+}
+
+
+atomic<int64_t>* Instrumentation::GetCounter(const string& name)
+{
+	InstrumentationRegistry& registry = GetRegistry();
+	unique_lock<mutex> lock(registry.m);
+	auto& counter = registry.counters[name];
+	if (!counter)
+		counter = make_unique<atomic<int64_t>>(0);
+	return counter.get();
+}
+
+
+Instrumentation::Histogram* Instrumentation::GetHistogram(const string& name)
+{
+	InstrumentationRegistry& registry = GetRegistry();
+	unique_lock<mutex> lock(registry.m);
+	auto& histogram = registry.histograms[name];
+	if (!histogram)
+		histogram = make_unique<Histogram>(name);
+	return histogram.get();
+}
+
+
+void Instrumentation::RecordHistogram(Histogram* histogram, uint64_t value)
+{
+	size_t bucket = 0;
+	for (uint64_t remaining = value; remaining != 0; remaining >>= 1)
+		bucket++;
+
+	histogram->count.fetch_add(1, memory_order_relaxed);
+	histogram->sum.fetch_add(value, memory_order_relaxed);
+	histogram->buckets[bucket].fetch_add(1, memory_order_relaxed);
+	uint64_t min = histogram->min.load(memory_order_relaxed);
+	while (value < min && !histogram->min.compare_exchange_weak(min, value, memory_order_relaxed))
+		;
+	uint64_t max = histogram->max.load(memory_order_relaxed);
+	while (value > max && !histogram->max.compare_exchange_weak(max, value, memory_order_relaxed))
+		;
+}
+
+
+void Instrumentation::RecordTraceEvent(
+    Histogram* histogram, chrono::steady_clock::time_point start, uint64_t durationNs)
+{
+	InstrumentationTraceEvent event;
+	event.histogram = histogram;
+	event.threadId = hash<thread::id> {}(this_thread::get_id());
+	event.durationUs = durationNs / 1000;
+
+	InstrumentationRegistry& registry = GetRegistry();
+	unique_lock<mutex> lock(registry.traceMutex);
+	if (!s_tracing || registry.trace.size() >= registry.traceLimit || start < registry.traceStart)
+		return;
+	event.startUs = chrono::duration_cast<chrono::microseconds>(start - registry.traceStart).count();
+	registry.trace.push_back(event);
+}
+
+
+InstrumentationSnapshot Instrumentation::GetSnapshot()
+{
+	InstrumentationRegistry& registry = GetRegistry();
+	unique_lock<mutex> lock(registry.m);
+	InstrumentationSnapshot result;
+	for (auto& [name, counter] : registry.counters)
+		result.counters[name] = counter->load();
+	for (auto& [name, histogram] : registry.histograms)
+	{
+		InstrumentationHistogramSnapshot entry;
+		entry.name = name;
+		entry.count = histogram->count;
+		if (entry.count == 0)
+			continue;
+		entry.sum = histogram->sum;
+		entry.min = histogram->min;
+		entry.max = histogram->max;
+		// Trailing empty buckets carry no information
+		size_t used = 0;
+		for (size_t i = 0; i < 65; i++)
+		{
+			if (histogram->buckets[i] != 0)
+				used = i + 1;
+		}
+		for (size_t i = 0; i < used; i++)
+			entry.buckets.push_back(histogram->buckets[i]);
+		result.histograms.push_back(std::move(entry));
+	}
+	return result;
+}
+
+
+static string WriteCompactJson(const Json::Value& value)
+{
+	Json::StreamWriterBuilder builder;
+	builder["indentation"] = "";
+	return Json::writeString(builder, value);
+}
+
+
+string Instrumentation::GetSnapshotJson()
+{
+	InstrumentationSnapshot snapshot = GetSnapshot();
+	Json::Value result(Json::objectValue);
+	result["counters"] = Json::Value(Json::objectValue);
+	for (auto& [name, value] : snapshot.counters)
+		result["counters"][name] = (Json::Int64)value;
+	result["histograms"] = Json::Value(Json::objectValue);
+	for (auto& histogram : snapshot.histograms)
+	{
+		Json::Value entry(Json::objectValue);
+		entry["count"] = (Json::UInt64)histogram.count;
+		entry["sum"] = (Json::UInt64)histogram.sum;
+		entry["min"] = (Json::UInt64)histogram.min;
+		entry["max"] = (Json::UInt64)histogram.max;
+		entry["buckets"] = Json::Value(Json::arrayValue);
+		for (uint64_t bucket : histogram.buckets)
+			entry["buckets"].append((Json::UInt64)bucket);
+		result["histograms"][histogram.name] = std::move(entry);
+	}
+	return WriteCompactJson(result);
+}
+
+
+string Instrumentation::GetTraceJson()
+{
+	InstrumentationRegistry& registry = GetRegistry();
+	Json::Value events(Json::arrayValue);
+	{
+		unique_lock<mutex> lock(registry.traceMutex);
+		for (auto& event : registry.trace)
+		{
+			Json::Value entry(Json::objectValue);
+			entry["name"] = event.histogram->name;
+			entry["cat"] = event.histogram->category;
+			entry["ph"] = "X";
+			entry["pid"] = 0;
+			entry["tid"] = (Json::UInt64)event.threadId;
+			entry["ts"] = (Json::UInt64)event.startUs;
+			entry["dur"] = (Json::UInt64)event.durationUs;
+			events.append(std::move(entry));
+		}
+	}
+
+	Json::Value trace(Json::objectValue);
+	trace["traceEvents"] = std::move(events);
+	trace["displayTimeUnit"] = "ms";
+	return WriteCompactJson(trace);
+}
+
+
+void Instrumentation::Reset()
+{
+	InstrumentationRegistry& registry = GetRegistry();
+	{
+		unique_lock<mutex> lock(registry.m);
+		for (auto& [name, counter] : registry.counters)
+			*counter = 0;
+		for (auto& [name, histogram] : registry.histograms)
+		{
+			histogram->count = 0;
+			histogram->sum = 0;
+			histogram->min = UINT64_MAX;
+			histogram->max = 0;
+			for (auto& bucket : histogram->buckets)
+				bucket = 0;
+		}
+	}
+
+	unique_lock<mutex> lock(registry.traceMutex);
+	registry.trace.clear();
+	registry.traceStart = chrono::steady_clock::now();
+}
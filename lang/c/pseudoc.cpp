@@ -6,6 +6,9 @@ using namespace std;
 using namespace BinaryNinja;
 
 
+thread_local PseudoCFunction::FieldCache* PseudoCFunction::s_fieldCache = nullptr;
+
+
 PseudoCFunction::PseudoCFunction(LanguageRepresentationFunctionType* type, Architecture* arch, Function* owner,
 	HighLevelILFunction* highLevelILFunction) :
 	LanguageRepresentationFunction(type, arch, owner, highLevelILFunction), m_highLevelIL(highLevelILFunction)
@@ -403,6 +406,12 @@ void PseudoCFunction::AppendTwoOperandFunctionWithCarry(const string& function,
 
 Ref<Type> PseudoCFunction::GetFieldType(const HighLevelILInstruction& var, bool deref)
 {
+	// Set up by GetExprText for the duration of the render
+	FieldCache& cache = *s_fieldCache;
+	auto i = cache.types.find({var.exprIndex, deref});
+	if (i != cache.types.end())
+		return i->second;
+
 	Ref<Type> type = var.GetType().GetValue();
 	if (deref && type && (type->GetClass() == PointerTypeClass))
 		type = type->GetChildType().GetValue();
@@ -410,29 +419,50 @@ Ref<Type> PseudoCFunction::GetFieldType(const HighLevelILInstruction& var, bool
 	if (type && (type->GetClass() == NamedTypeReferenceClass))
 		type = GetFunction()->GetView()->GetTypeByRef(type->GetNamedTypeReference());
 
+	cache.types.emplace(make_pair(var.exprIndex, deref), type);
 	return type;
 }
 
 
-PseudoCFunction::FieldDisplayType PseudoCFunction::GetFieldDisplayType(
+const PseudoCFunction::ResolvedField& PseudoCFunction::ResolveField(
 	Ref<Type> type, uint64_t offset, size_t memberIndex, bool deref)
 {
+	FieldCache& cache = *s_fieldCache;
+	const auto key = make_tuple(type ? type->GetObject() : nullptr, offset, memberIndex, deref);
+	auto i = cache.fields.find(key);
+	if (i != cache.fields.end())
+		return i->second;
+
+	// The type is kept with the result so the object the key points to stays alive
+	ResolvedField result {type, FieldDisplayNone, false, 0, {}};
 	if (type && (type->GetClass() == StructureTypeClass))
 	{
 		std::optional<size_t> memberIndexHint;
 		if (memberIndex != BN_INVALID_EXPR)
 			memberIndexHint = memberIndex;
 
+		result.displayType = FieldDisplayOffset;
 		if (type->GetStructure()->ResolveMemberOrBaseMember(GetFunction()->GetView(), offset, 0,
-				[&](NamedTypeReference*, Structure*, size_t, uint64_t, uint64_t, const StructureMember&) {}),
+				[&](NamedTypeReference*, Structure*, size_t, uint64_t structOffset, uint64_t,
+					const StructureMember& member) {
+					result.hasMember = true;
+					result.structOffset = structOffset;
+					result.member = member;
+				}),
 			memberIndexHint)
-			return FieldDisplayName;
-		return FieldDisplayOffset;
+			result.displayType = FieldDisplayName;
 	}
 	else if (deref || offset != 0)
-		return FieldDisplayMemberOffset;
-	else
-		return FieldDisplayNone;
+		result.displayType = FieldDisplayMemberOffset;
+
+	return cache.fields.emplace(key, std::move(result)).first->second;
+}
+
+
+PseudoCFunction::FieldDisplayType PseudoCFunction::GetFieldDisplayType(
+	Ref<Type> type, uint64_t offset, size_t memberIndex, bool deref)
+{
+	return ResolveField(type, offset, memberIndex, deref).displayType;
 }
 
 
@@ -440,33 +470,26 @@ void PseudoCFunction::AppendFieldTextTokens(const HighLevelILInstruction& var, u
 	size_t memberIndex, size_t size, HighLevelILTokenEmitter& tokens, bool deref, bool displayDeref)
 {
 	const auto type = GetFieldType(var, deref);
-	const auto fieldDisplayType = GetFieldDisplayType(type, offset, memberIndex, deref);
-	switch (fieldDisplayType)
+	const auto& field = ResolveField(type, offset, memberIndex, deref);
+	switch (field.displayType)
 	{
 		case FieldDisplayName:
 		{
-			std::optional<size_t> memberIndexHint;
-			if (memberIndex != BN_INVALID_EXPR)
-				memberIndexHint = memberIndex;
-
-			if (type->GetStructure()->ResolveMemberOrBaseMember(GetFunction()->GetView(), offset, 0,
-					[&](NamedTypeReference*, Structure* s, size_t memberIndex, uint64_t structOffset,
-						uint64_t adjustedOffset, const StructureMember& member) {
-						if (deref && displayDeref)
-							tokens.Append(OperationToken, "->");
-						else
-							tokens.Append(OperationToken, ".");
-						deref = false;
+			if (field.hasMember)
+			{
+				if (deref && displayDeref)
+					tokens.Append(OperationToken, "->");
+				else
+					tokens.Append(OperationToken, ".");
 
-						vector<string> nameList {member.name};
-						HighLevelILTokenEmitter::AddNamesForOuterStructureMembers(
-							GetFunction()->GetView(), type, var, nameList);
+				vector<string> nameList {field.member.name};
+				HighLevelILTokenEmitter::AddNamesForOuterStructureMembers(
+					GetFunction()->GetView(), type, var, nameList);
 
-						tokens.Append(FieldNameToken, member.name, structOffset + member.offset, 0, 0,
-							BN_FULL_CONFIDENCE, nameList);
-					}),
-				memberIndexHint)
+				tokens.Append(FieldNameToken, field.member.name, field.structOffset + field.member.offset, 0, 0,
+					BN_FULL_CONFIDENCE, nameList);
 				return;
+			}
 
 			// Part of structure but no defined field, use __offset syntax
 			if (deref && displayDeref)
@@ -503,9 +526,153 @@ void PseudoCFunction::AppendFieldTextTokens(const HighLevelILInstruction& var, u
 }
 
 
+// Settings that change how a statement renders, or nullopt when statements shouldn't be cached
+static optional<uint64_t> GetStatementCacheSettingsKey(DisassemblySettings* settings)
+{
+	if (!settings)
+		return 0;
+	// The debugging options emit tokens before the line is claimed, which replay doesn't reproduce
+	if (settings->IsOptionSet(ShowILTypes) || settings->IsOptionSet(ShowILOpcodes))
+		return nullopt;
+	return 2 | (settings->IsOptionSet(ShowTypeCasts) ? 4 : 0) | ((uint64_t)settings->GetCallParameterHints() << 3)
+		| ((uint64_t)settings->GetMaximumSymbolWidth() << 8);
+}
+
+
+// Statements that render onto a single line without opening scopes
+static bool IsSingleLineStatement(const HighLevelILInstruction& instr)
+{
+	switch (instr.operation)
+	{
+	case HLIL_ASSIGN:
+		return instr.GetDestExpr<HLIL_ASSIGN>().operation != HLIL_SPLIT;
+	case HLIL_ASSIGN_UNPACK:
+	case HLIL_CALL:
+	case HLIL_INTRINSIC:
+	case HLIL_RET:
+	case HLIL_NORET:
+		return true;
+	default:
+		return false;
+	}
+}
+
+
+// Tokens whose text only depends on the HLIL itself and local variable names. Anything naming a symbol,
+// type, field, string or label can change without the HLIL being regenerated, so it isn't cached.
+static bool IsCacheableStatementToken(const InstructionTextToken& token)
+{
+	switch (token.type)
+	{
+	case TextToken:
+	case OperandSeparatorToken:
+	case RegisterToken:
+	case IntegerToken:
+	case FloatingPointToken:
+	case CharacterConstantToken:
+	case BeginMemoryOperandToken:
+	case EndMemoryOperandToken:
+	case KeywordToken:
+	case OperationToken:
+	case BraceToken:
+	case LocalVariableToken:
+		return true;
+	default:
+		return false;
+	}
+}
+
+
+static vector<InstructionTextToken> WithoutCollapseIndicators(vector<InstructionTextToken> tokens)
+{
+	tokens.erase(remove_if(tokens.begin(), tokens.end(),
+		[](const InstructionTextToken& token) { return token.type == CollapseStateIndicatorToken; }), tokens.end());
+	return tokens;
+}
+
+
+bool PseudoCFunction::IsCachedStatementCurrent(const vector<InstructionTextToken>& tokens)
+{
+	// Local variables can be renamed in place, so check each name the statement shows
+	Ref<Function> function = m_highLevelIL->GetFunction();
+	for (auto& token : tokens)
+	{
+		if (token.type == LocalVariableToken
+			&& function->GetVariableNameOrDefault(Variable::FromIdentifier(token.value)) != token.text)
+			return false;
+	}
+	return true;
+}
+
+
+void PseudoCFunction::GetStatementText(const HighLevelILInstruction& instr, HighLevelILTokenEmitter& tokens,
+	DisassemblySettings* settings, optional<uint64_t> settingsKey)
+{
+	if (!settingsKey || !IsSingleLineStatement(instr))
+	{
+		GetExprTextInternal(instr, tokens, settings, TopLevelOperatorPrecedence, true);
+		return;
+	}
+
+	const pair<size_t, uint64_t> key(instr.exprIndex, *settingsKey | (instr.ast ? 1 : 0));
+	optional<vector<InstructionTextToken>> cached;
+	{
+		unique_lock<mutex> lock(m_statementCacheMutex);
+		auto i = m_statementCache.find(key);
+		if (i != m_statementCache.end())
+		{
+			if (!i->second.cacheable)
+			{
+				lock.unlock();
+				GetExprTextInternal(instr, tokens, settings, TopLevelOperatorPrecedence, true);
+				return;
+			}
+			cached = i->second.tokens;
+		}
+	}
+
+	if (cached && IsCachedStatementCurrent(*cached))
+	{
+		// Same steps GetExprTextInternal takes before emitting the statement's own tokens
+		auto exprGuard = tokens.SetCurrentExpr(instr);
+		if (instr.ast)
+			tokens.PrependCollapseIndicator(m_highLevelIL->GetFunction(), instr);
+		tokens.InitLine();
+		for (auto& token : *cached)
+			tokens.Append(token);
+		return;
+	}
+
+	// Only a statement that starts on an empty line can be told apart from what precedes it
+	bool cacheable = WithoutCollapseIndicators(tokens.GetCurrentTokens()).empty();
+	GetExprTextInternal(instr, tokens, settings, TopLevelOperatorPrecedence, true);
+
+	CachedStatement entry {cacheable, {}};
+	if (cacheable)
+	{
+		entry.tokens = WithoutCollapseIndicators(tokens.GetCurrentTokens());
+		entry.cacheable = all_of(entry.tokens.begin(), entry.tokens.end(), IsCacheableStatementToken);
+		if (!entry.cacheable)
+			entry.tokens.clear();
+	}
+	unique_lock<mutex> lock(m_statementCacheMutex);
+	m_statementCache[key] = std::move(entry);
+}
+
+
 void PseudoCFunction::GetExprText(const HighLevelILInstruction& instr, HighLevelILTokenEmitter& tokens,
 	DisassemblySettings* settings, BNOperatorPrecedence precedence, bool statement)
 {
+	// Field lookups are cached for this render only. The previous cache is restored on the way out in case
+	// rendering another function ends up nested inside this one.
+	struct FieldCacheScope
+	{
+		FieldCache cache;
+		FieldCache* outer;
+		FieldCacheScope() : outer(s_fieldCache) { s_fieldCache = &cache; }
+		~FieldCacheScope() { s_fieldCache = outer; }
+	} fieldCacheScope;
+
 	GetExprTextInternal(instr, tokens, settings, precedence, statement);
 }
 
@@ -554,6 +721,7 @@ void PseudoCFunction::GetExprTextInternal(const HighLevelILInstruction& instr, H
 	case HLIL_BLOCK:
 		[&]() {
 			const auto exprs = instr.GetBlockExprs<HLIL_BLOCK>();
+			const auto settingsKey = GetStatementCacheSettingsKey(settings);
 			bool needSeparator = false;
 			for (auto i = exprs.begin(); i != exprs.end(); ++i)
 			{
@@ -593,7 +761,7 @@ void PseudoCFunction::GetExprTextInternal(const HighLevelILInstruction& instr, H
 				needSeparator = hasBlocks;
 
 				// Emit the lines for the statement itself
-				GetExprTextInternal(*i, tokens, settings, TopLevelOperatorPrecedence, true);
+				GetStatementText(*i, tokens, settings, settingsKey);
 				tokens.NewLine();
 			}
 		}();
@@ -6,6 +6,16 @@ class PseudoCFunction: public BinaryNinja::LanguageRepresentationFunction
 {
 	BinaryNinja::Ref<BinaryNinja::HighLevelILFunction> m_highLevelIL;
 
+	// Tokens of single line statements, keyed by expression index and the settings that affect them.
+	// This object belongs to one HLIL function, so regenerating the HLIL starts a fresh cache.
+	struct CachedStatement
+	{
+		bool cacheable;
+		std::vector<BinaryNinja::InstructionTextToken> tokens;
+	};
+	std::mutex m_statementCacheMutex;
+	std::map<std::pair<size_t, uint64_t>, CachedStatement> m_statementCache;
+
 	enum FieldDisplayType
 	{
 		FieldDisplayName,
@@ -14,7 +24,26 @@ class PseudoCFunction: public BinaryNinja::LanguageRepresentationFunction
 		FieldDisplayNone
 	};
 
+	struct ResolvedField
+	{
+		BinaryNinja::Ref<BinaryNinja::Type> type;
+		FieldDisplayType displayType;
+		bool hasMember;
+		uint64_t structOffset;
+		BinaryNinja::StructureMember member;
+	};
+
+	// Field lookups made during one call to GetExprText. Types can change without the HLIL being
+	// regenerated, so nothing here outlives the call.
+	struct FieldCache
+	{
+		std::map<std::pair<size_t, bool>, BinaryNinja::Ref<BinaryNinja::Type>> types;
+		std::map<std::tuple<BNType*, uint64_t, size_t, bool>, ResolvedField> fields;
+	};
+	static thread_local FieldCache* s_fieldCache;
+
 	BinaryNinja::Ref<BinaryNinja::Type> GetFieldType(const BinaryNinja::HighLevelILInstruction& var, bool deref);
+	const ResolvedField& ResolveField(BinaryNinja::Ref<BinaryNinja::Type> type, uint64_t offset, size_t memberIndex, bool deref);
 	FieldDisplayType GetFieldDisplayType(BinaryNinja::Ref<BinaryNinja::Type> type, uint64_t offset, size_t memberIndex, bool deref);
 
 	BNSymbolDisplayResult AppendPointerTextToken(const BinaryNinja::HighLevelILInstruction& instr, int64_t val,
@@ -35,6 +64,10 @@ class PseudoCFunction: public BinaryNinja::LanguageRepresentationFunction
 		BinaryNinja::HighLevelILTokenEmitter& tokens, BinaryNinja::DisassemblySettings* settings);
 	void AppendFieldTextTokens(const BinaryNinja::HighLevelILInstruction& var, uint64_t offset, size_t memberIndex, size_t size,
 		BinaryNinja::HighLevelILTokenEmitter& tokens, bool deref, bool displayDeref = true);
+	bool IsCachedStatementCurrent(const std::vector<BinaryNinja::InstructionTextToken>& tokens);
+	void GetStatementText(const BinaryNinja::HighLevelILInstruction& instr,
+		BinaryNinja::HighLevelILTokenEmitter& tokens, BinaryNinja::DisassemblySettings* settings,
+		std::optional<uint64_t> settingsKey);
 	void GetExprTextInternal(const BinaryNinja::HighLevelILInstruction& instr,
 		BinaryNinja::HighLevelILTokenEmitter& tokens, BinaryNinja::DisassemblySettings* settings,
 		BNOperatorPrecedence precedence = TopLevelOperatorPrecedence, bool statement = false,
@@ -1,3 +1,8 @@
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include "binaryninjaapi.h"
 #include "highlevelilinstruction.h"
 
@@ -329,6 +334,95 @@ void LanguageRepresentationFunctionType::Register(LanguageRepresentationFunction
 }
 
 
+bool LanguageRepresentationFunctionType::RenderFunctions(const vector<Ref<Function>>& functions,
+	DisassemblySettings* settings, const function<bool(Function*, const vector<DisassemblyTextLine>&)>& writer,
+	size_t threads, size_t maxBufferedTokens)
+{
+	const string language = GetName();
+	auto render = [&](Function* func) {
+		Ref<LanguageRepresentationFunction> repr = func->GetLanguageRepresentation(language);
+		Ref<HighLevelILFunction> il = repr ? repr->GetHighLevelILFunction() : nullptr;
+		if (!il)
+			return vector<DisassemblyTextLine>();
+		return repr->GetLinearLines(il->GetRootExpr(), settings);
+	};
+
+	if (threads == 0)
+		threads = GetWorkerThreadCount();
+	threads = max<size_t>(1, min(threads, functions.size()));
+
+	// Rendered functions waiting to be written. A missing value means the function was too large to buffer.
+	mutex lock;
+	condition_variable produced, consumed;
+	map<size_t, optional<vector<DisassemblyTextLine>>> pending;
+	const size_t window = threads * 2;
+	size_t nextToRender = 0;
+	size_t nextToWrite = 0;
+	bool stopped = false;
+
+	auto worker = [&]() {
+		unique_lock<mutex> guard(lock);
+		while (true)
+		{
+			consumed.wait(guard, [&]() { return stopped || nextToRender < nextToWrite + window; });
+			if (stopped || nextToRender >= functions.size())
+				return;
+			size_t index = nextToRender++;
+			guard.unlock();
+
+			vector<DisassemblyTextLine> lines = render(functions[index]);
+			size_t tokenCount = 0;
+			for (auto& line : lines)
+				tokenCount += line.tokens.size();
+			optional<vector<DisassemblyTextLine>> result;
+			if (tokenCount <= maxBufferedTokens)
+				result = std::move(lines);
+
+			guard.lock();
+			pending.emplace(index, std::move(result));
+			produced.notify_all();
+		}
+	};
+
+	vector<thread> workers;
+	workers.reserve(threads);
+	for (size_t i = 0; i < threads; i++)
+		workers.emplace_back(worker);
+
+	bool completed = true;
+	for (size_t index = 0; index < functions.size(); index++)
+	{
+		optional<vector<DisassemblyTextLine>> lines;
+		{
+			unique_lock<mutex> guard(lock);
+			produced.wait(guard, [&]() { return pending.count(index) != 0; });
+			auto i = pending.find(index);
+			lines = std::move(i->second);
+			pending.erase(i);
+			nextToWrite = index + 1;
+		}
+		consumed.notify_all();
+
+		if (!lines)
+			lines = render(functions[index]);
+		if (!writer(functions[index], *lines))
+		{
+			completed = false;
+			break;
+		}
+	}
+
+	{
+		unique_lock<mutex> guard(lock);
+		stopped = true;
+	}
+	consumed.notify_all();
+	for (auto& i : workers)
+		i.join();
+	return completed;
+}
+
+
 BNLanguageRepresentationFunction* LanguageRepresentationFunctionType::CreateCallback(
 	void* ctxt, BNArchitecture* arch, BNFunction* owner, BNHighLevelILFunction* highLevelIL)
 {
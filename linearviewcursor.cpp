@@ -18,6 +18,7 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <list>
 #include "binaryninjaapi.h"
 
 using namespace std;
@@ -241,3 +242,356 @@ int LinearViewCursor::Compare(LinearViewCursor* a, LinearViewCursor* b)
 {
 	return BNCompareLinearViewCursors(a->GetObject(), b->GetObject());
 }
+
+
+struct LinearViewLineCache::State
+{
+	struct Entry
+	{
+		vector<LinearDisassemblyLine> lines;
+		// Union of the address ranges on the object's path; objects without any are dropped on every change
+		bool hasRange;
+		uint64_t start, end;
+		list<string>::iterator recent;
+	};
+
+	size_t maxObjects, prefetchAhead, prefetchBehind;
+
+	mutable std::mutex entriesMutex;
+	unordered_map<string, Entry> entries;
+	list<string> recent;
+	uint64_t hits = 0, misses = 0;
+
+	// Advanced by every invalidation, so prefetches started before one don't store stale lines
+	atomic<uint64_t> generation = 0;
+	// Advanced by every Prefetch, so older prefetches stop early
+	atomic<uint64_t> prefetchTicket = 0;
+
+	static string GetKey(const vector<LinearViewObjectIdentifier>& path, bool& hasRange, uint64_t& start, uint64_t& end)
+	{
+		string key;
+		hasRange = false;
+		start = UINT64_MAX;
+		end = 0;
+		for (auto& id : path)
+		{
+			key += id.name;
+			key += '\0';
+			key += to_string(id.type) + ":" + to_string(id.start) + ":" + to_string(id.end) + "/";
+			if (id.type == SingleLinearViewObject)
+				continue;
+			hasRange = true;
+			start = min(start, id.start);
+			end = max(end, id.type == AddressRangeLinearViewObject ? id.end : id.start + 1);
+		}
+		return key;
+	}
+
+	bool Lookup(const string& key, vector<LinearDisassemblyLine>& lines)
+	{
+		unique_lock<std::mutex> lock(entriesMutex);
+		auto i = entries.find(key);
+		if (i == entries.end())
+			return false;
+		recent.splice(recent.begin(), recent, i->second.recent);
+		lines = i->second.lines;
+		return true;
+	}
+
+	bool Contains(const string& key) const
+	{
+		unique_lock<std::mutex> lock(entriesMutex);
+		return entries.find(key) != entries.end();
+	}
+
+	void Store(const string& key, vector<LinearDisassemblyLine> lines, bool hasRange, uint64_t start, uint64_t end,
+	    uint64_t expectedGeneration)
+	{
+		unique_lock<std::mutex> lock(entriesMutex);
+		// Checked under the lock, which invalidation also takes, so a change can't slip in between
+		if (generation != expectedGeneration)
+			return;
+		auto [i, inserted] = entries.try_emplace(key);
+		if (inserted)
+		{
+			recent.push_front(key);
+			i->second.recent = recent.begin();
+		}
+		else
+		{
+			recent.splice(recent.begin(), recent, i->second.recent);
+		}
+		i->second.lines = std::move(lines);
+		i->second.hasRange = hasRange;
+		i->second.start = start;
+		i->second.end = end;
+
+		while (entries.size() > maxObjects)
+		{
+			entries.erase(recent.back());
+			recent.pop_back();
+		}
+	}
+
+	void Walk(Ref<LinearViewCursor> cursor, bool forward, size_t count, uint64_t ticket)
+	{
+		uint64_t startGeneration = generation;
+		for (size_t i = 0; i < count && prefetchTicket == ticket && generation == startGeneration; i++)
+		{
+			if (!(forward ? cursor->Next() : cursor->Previous()) || !cursor->IsValid())
+				return;
+			bool hasRange;
+			uint64_t start, end;
+			string key = GetKey(cursor->GetPath(), hasRange, start, end);
+			if (Contains(key))
+				continue;
+			Store(key, cursor->GetLines(), hasRange, start, end, startGeneration);
+		}
+	}
+};
+
+
+LinearViewLineCache::LinearViewLineCache(
+    BinaryView* view, size_t maxObjects, size_t prefetchAhead, size_t prefetchBehind) :
+    BinaryDataNotification(BinaryDataUpdates | FunctionUpdates | DataVariableUpdates | TagUpdates | SymbolUpdates
+        | TypeDefined | TypeUndefined | TypeReferenceChanged | SegmentUpdates | SectionUpdates),
+    m_state(make_shared<State>()), m_view(view)
+{
+	m_state->maxObjects = max<size_t>(maxObjects, 1);
+	m_state->prefetchAhead = prefetchAhead;
+	m_state->prefetchBehind = prefetchBehind;
+	m_view->RegisterNotification(this);
+}
+
+
+LinearViewLineCache::~LinearViewLineCache()
+{
+	m_view->UnregisterNotification(this);
+	// Background walks hold the state alive; this only makes them stop at the next object
+	m_state->prefetchTicket++;
+}
+
+
+vector<LinearDisassemblyLine> LinearViewLineCache::GetLines(LinearViewCursor* cursor)
+{
+	bool hasRange;
+	uint64_t start, end;
+	string key = State::GetKey(cursor->GetPath(), hasRange, start, end);
+
+	vector<LinearDisassemblyLine> lines;
+	bool hit = m_state->Lookup(key, lines);
+	{
+		unique_lock<mutex> lock(m_state->entriesMutex);
+		(hit ? m_state->hits : m_state->misses)++;
+	}
+	if (!hit)
+	{
+		uint64_t generation = m_state->generation;
+		lines = cursor->GetLines();
+		m_state->Store(key, lines, hasRange, start, end, generation);
+	}
+
+	Prefetch(cursor);
+	return lines;
+}
+
+
+void LinearViewLineCache::Prefetch(LinearViewCursor* cursor)
+{
+	uint64_t ticket = ++m_state->prefetchTicket;
+	shared_ptr<State> state = m_state;
+	// Each direction walks its own duplicate, since cursors can't be shared between threads
+	if (state->prefetchAhead)
+	{
+		Ref<LinearViewCursor> ahead = cursor->Duplicate();
+		WorkerEnqueue([=]() { state->Walk(ahead, true, state->prefetchAhead, ticket); }, "Linear View Prefetch");
+	}
+	if (state->prefetchBehind)
+	{
+		Ref<LinearViewCursor> behind = cursor->Duplicate();
+		WorkerEnqueue([=]() { state->Walk(behind, false, state->prefetchBehind, ticket); }, "Linear View Prefetch");
+	}
+}
+
+
+void LinearViewLineCache::Invalidate()
+{
+	unique_lock<mutex> lock(m_state->entriesMutex);
+	m_state->generation++;
+	m_state->entries.clear();
+	m_state->recent.clear();
+}
+
+
+void LinearViewLineCache::InvalidateRange(uint64_t start, uint64_t end)
+{
+	unique_lock<mutex> lock(m_state->entriesMutex);
+	m_state->generation++;
+	for (auto i = m_state->entries.begin(); i != m_state->entries.end();)
+	{
+		auto& entry = i->second;
+		if (!entry.hasRange || (entry.start < end && start < entry.end))
+		{
+			m_state->recent.erase(entry.recent);
+			i = m_state->entries.erase(i);
+		}
+		else
+		{
+			++i;
+		}
+	}
+}
+
+
+void LinearViewLineCache::GetStats(uint64_t& hits, uint64_t& misses) const
+{
+	unique_lock<mutex> lock(m_state->entriesMutex);
+	hits = m_state->hits;
+	misses = m_state->misses;
+}
+
+
+void LinearViewLineCache::OnBinaryDataWritten(BinaryView*, uint64_t offset, size_t len)
+{
+	InvalidateRange(offset, offset + len);
+}
+
+
+void LinearViewLineCache::OnBinaryDataInserted(BinaryView*, uint64_t, size_t)
+{
+	// Everything after the insertion moved, so no cached address is trustworthy
+	Invalidate();
+}
+
+
+void LinearViewLineCache::OnBinaryDataRemoved(BinaryView*, uint64_t, uint64_t)
+{
+	Invalidate();
+}
+
+
+void LinearViewLineCache::OnAnalysisFunctionAdded(BinaryView*, Function* func)
+{
+	InvalidateRange(func->GetLowestAddress(), func->GetHighestAddress() + 1);
+}
+
+
+void LinearViewLineCache::OnAnalysisFunctionRemoved(BinaryView*, Function* func)
+{
+	InvalidateRange(func->GetLowestAddress(), func->GetHighestAddress() + 1);
+}
+
+
+void LinearViewLineCache::OnAnalysisFunctionUpdated(BinaryView*, Function* func)
+{
+	InvalidateRange(func->GetLowestAddress(), func->GetHighestAddress() + 1);
+}
+
+
+void LinearViewLineCache::OnDataVariableAdded(BinaryView*, const DataVariable& var)
+{
+	InvalidateRange(var.address, var.address + (var.type.GetValue() ? max<uint64_t>(var.type->GetWidth(), 1) : 1));
+}
+
+
+void LinearViewLineCache::OnDataVariableRemoved(BinaryView*, const DataVariable& var)
+{
+	InvalidateRange(var.address, var.address + (var.type.GetValue() ? max<uint64_t>(var.type->GetWidth(), 1) : 1));
+}
+
+
+void LinearViewLineCache::OnDataVariableUpdated(BinaryView*, const DataVariable& var)
+{
+	InvalidateRange(var.address, var.address + (var.type.GetValue() ? max<uint64_t>(var.type->GetWidth(), 1) : 1));
+}
+
+
+void LinearViewLineCache::OnTagAdded(BinaryView*, const TagReference& tagRef)
+{
+	InvalidateRange(tagRef.addr, tagRef.addr + 1);
+}
+
+
+void LinearViewLineCache::OnTagRemoved(BinaryView*, const TagReference& tagRef)
+{
+	InvalidateRange(tagRef.addr, tagRef.addr + 1);
+}
+
+
+void LinearViewLineCache::OnTagUpdated(BinaryView*, const TagReference& tagRef)
+{
+	InvalidateRange(tagRef.addr, tagRef.addr + 1);
+}
+
+
+// Names and types can be rendered anywhere, so changes to them drop everything
+void LinearViewLineCache::OnSymbolAdded(BinaryView*, Symbol*)
+{
+	Invalidate();
+}
+
+
+void LinearViewLineCache::OnSymbolRemoved(BinaryView*, Symbol*)
+{
+	Invalidate();
+}
+
+
+void LinearViewLineCache::OnSymbolUpdated(BinaryView*, Symbol*)
+{
+	Invalidate();
+}
+
+
+void LinearViewLineCache::OnTypeDefined(BinaryView*, const QualifiedName&, Type*)
+{
+	Invalidate();
+}
+
+
+void LinearViewLineCache::OnTypeUndefined(BinaryView*, const QualifiedName&, Type*)
+{
+	Invalidate();
+}
+
+
+void LinearViewLineCache::OnTypeReferenceChanged(BinaryView*, const QualifiedName&, Type*)
+{
+	Invalidate();
+}
+
+
+void LinearViewLineCache::OnSegmentAdded(BinaryView*, Segment*)
+{
+	Invalidate();
+}
+
+
+void LinearViewLineCache::OnSegmentRemoved(BinaryView*, Segment*)
+{
+	Invalidate();
+}
+
+
+void LinearViewLineCache::OnSegmentUpdated(BinaryView*, Segment*)
+{
+	Invalidate();
+}
+
+
+void LinearViewLineCache::OnSectionAdded(BinaryView*, Section*)
+{
+	Invalidate();
+}
+
+
+void LinearViewLineCache::OnSectionRemoved(BinaryView*, Section*)
+{
+	Invalidate();
+}
+
+
+void LinearViewLineCache::OnSectionUpdated(BinaryView*, Section*)
+{
+	Invalidate();
+}
@@ -19,8 +19,12 @@
 // IN THE SOFTWARE.
 
 #define _CRT_SECURE_NO_WARNINGS
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include <thread>
 #include "binaryninjaapi.h"
 
@@ -75,8 +79,226 @@ void LogListener::UpdateLogListeners()
 }
 
 
+namespace
+{
+	// Single producer, single consumer ring. The owning thread advances tail and the dispatcher advances head.
+	struct LogQueue
+	{
+		std::vector<LogMessageEntry> entries;
+		std::vector<uint64_t> sequence;
+		std::atomic<size_t> head {0};
+		std::atomic<size_t> tail {0};
+		std::atomic<uint64_t> dropped {0};
+		// Expires when the owning thread exits, after which the queue can be discarded once drained
+		std::weak_ptr<int> owner;
+
+		LogQueue(size_t capacity) : entries(capacity), sequence(capacity) {}
+	};
+
+	struct ThreadLogQueues
+	{
+		std::shared_ptr<int> alive = std::make_shared<int>(0);
+		std::unordered_map<uint64_t, std::weak_ptr<LogQueue>> queues;
+	};
+
+	std::atomic<uint64_t> g_nextAsyncLogListenerId {0};
+}
+
+
+struct AsyncLogListener::State
+{
+	uint64_t id;
+	size_t capacity;
+	std::chrono::milliseconds interval;
+	std::atomic<uint64_t> sequence {0};
+	std::atomic<uint64_t> dropped {0};
+	std::atomic<bool> accepting {true};
+
+	std::mutex queuesMutex;
+	std::vector<std::shared_ptr<LogQueue>> queues;
+
+	std::mutex wakeMutex;
+	std::condition_variable wake;
+	bool stopping = false;
+	bool discard = false;
+	uint64_t flushRequested = 0;
+	uint64_t flushCompleted = 0;
+
+	std::once_flag stopOnce;
+	std::thread dispatcher;
+
+	void DeliverPending(AsyncLogListener* listener)
+	{
+		vector<shared_ptr<LogQueue>> current;
+		{
+			std::unique_lock<std::mutex> lock(queuesMutex);
+			queues.erase(remove_if(queues.begin(), queues.end(), [](const shared_ptr<LogQueue>& queue) {
+				return queue->owner.expired() && queue->head.load() == queue->tail.load();
+			}), queues.end());
+			current = queues;
+		}
+
+		vector<pair<uint64_t, LogMessageEntry>> pending;
+		uint64_t droppedCount = 0;
+		for (auto& queue : current)
+		{
+			size_t head = queue->head.load(std::memory_order_relaxed);
+			size_t tail = queue->tail.load(std::memory_order_acquire);
+			for (size_t i = head; i != tail; i++)
+			{
+				size_t slot = i % capacity;
+				pending.emplace_back(queue->sequence[slot], std::move(queue->entries[slot]));
+			}
+			queue->head.store(tail, std::memory_order_release);
+			droppedCount += queue->dropped.exchange(0);
+		}
+
+		if (discard || (pending.empty() && droppedCount == 0))
+			return;
+
+		sort(pending.begin(), pending.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+		vector<LogMessageEntry> messages;
+		messages.reserve(pending.size());
+		for (auto& entry : pending)
+			messages.push_back(std::move(entry.second));
+		listener->LogMessagesBatch(messages, droppedCount);
+	}
+
+	void Run(AsyncLogListener* listener)
+	{
+		while (true)
+		{
+			bool stop;
+			uint64_t flushTarget;
+			{
+				std::unique_lock<std::mutex> lock(wakeMutex);
+				wake.wait_for(lock, interval, [&]() { return stopping || flushRequested != flushCompleted; });
+				stop = stopping;
+				flushTarget = flushRequested;
+			}
+
+			DeliverPending(listener);
+
+			{
+				std::unique_lock<std::mutex> lock(wakeMutex);
+				flushCompleted = flushTarget;
+			}
+			wake.notify_all();
+			if (stop)
+				break;
+		}
+	}
+};
+
+
+AsyncLogListener::AsyncLogListener(size_t queueCapacity, uint32_t batchIntervalMs) : m_state(make_shared<State>())
+{
+	m_state->id = g_nextAsyncLogListenerId++;
+	m_state->capacity = std::max<size_t>(queueCapacity, 1);
+	m_state->interval = std::chrono::milliseconds(batchIntervalMs);
+	m_state->dispatcher = std::thread([this]() { m_state->Run(this); });
+}
+
+
+AsyncLogListener::~AsyncLogListener()
+{
+	{
+		// A subclass that didn't call Stop is already gone, so whatever is left can't be delivered
+		std::unique_lock<std::mutex> lock(m_state->wakeMutex);
+		m_state->discard = true;
+	}
+	Stop();
+}
+
+
+void AsyncLogListener::LogMessage(size_t session, BNLogLevel level, const string& msg, const string& logger_name, size_t tid)
+{
+	State* state = m_state.get();
+	if (!state->accepting.load(std::memory_order_relaxed))
+	{
+		state->dropped++;
+		return;
+	}
+
+	thread_local ThreadLogQueues threadQueues;
+	shared_ptr<LogQueue> queue = threadQueues.queues[state->id].lock();
+	if (!queue)
+	{
+		queue = make_shared<LogQueue>(state->capacity);
+		queue->owner = threadQueues.alive;
+		threadQueues.queues[state->id] = queue;
+		std::unique_lock<std::mutex> lock(state->queuesMutex);
+		state->queues.push_back(queue);
+	}
+
+	size_t tail = queue->tail.load(std::memory_order_relaxed);
+	if (tail - queue->head.load(std::memory_order_acquire) >= state->capacity)
+	{
+		queue->dropped++;
+		state->dropped++;
+		return;
+	}
+
+	size_t slot = tail % state->capacity;
+	LogMessageEntry& entry = queue->entries[slot];
+	entry.session = session;
+	entry.level = level;
+	entry.message = msg;
+	entry.loggerName = logger_name;
+	entry.threadId = tid;
+	queue->sequence[slot] = state->sequence++;
+	queue->tail.store(tail + 1, std::memory_order_release);
+}
+
+
+void AsyncLogListener::Flush()
+{
+	State* state = m_state.get();
+	std::unique_lock<std::mutex> lock(state->wakeMutex);
+	if (state->stopping)
+		return;
+	uint64_t target = ++state->flushRequested;
+	state->wake.notify_all();
+	state->wake.wait(lock, [&]() { return state->flushCompleted >= target; });
+}
+
+
+void AsyncLogListener::Stop()
+{
+	State* state = m_state.get();
+	std::call_once(state->stopOnce, [&]() {
+		state->accepting = false;
+		{
+			std::unique_lock<std::mutex> lock(state->wakeMutex);
+			state->stopping = true;
+		}
+		state->wake.notify_all();
+		if (state->dispatcher.joinable())
+			state->dispatcher.join();
+	});
+}
+
+
+uint64_t AsyncLogListener::GetDroppedMessageCount() const
+{
+	return m_state->dropped;
+}
+
+
 static void PerformLog(size_t session, BNLogLevel level, const string& logger_name, size_t tid, const char* fmt, va_list args)
 {
+	// Plain strings and the "%s" forwarding used by the fmt based overloads don't need a formatted copy
+	if (strcmp(fmt, "%s") == 0)
+	{
+		BNLog(session, level, logger_name.c_str(), tid, "%s", va_arg(args, const char*));
+		return;
+	}
+	if (!strchr(fmt, '%'))
+	{
+		BNLog(session, level, logger_name.c_str(), tid, "%s", fmt);
+		return;
+	}
+
 #if defined(_MSC_VER)
 	int len = _vscprintf(fmt, args);
 	if (len < 0)
@@ -171,8 +393,10 @@ void BinaryNinja::LogFV(BNLogLevel level, fmt::string_view format, fmt::format_a
 
 void BinaryNinja::LogTraceFV(fmt::string_view format, fmt::format_args args)
 {
+#ifdef _DEBUG
 	std::string value = fmt::vformat(format, args);
 	LogTrace("%s", value.c_str());
+#endif
 }
 
 
@@ -242,12 +466,20 @@ size_t Logger::GetThreadId() const
 Logger::Logger(BNLogger* logger)
 {
 	m_object = logger;
+	char* name = BNLoggerGetName(m_object);
+	m_name = name;
+	BNFreeString(name);
+	m_sessionId = BNLoggerGetSessionId(m_object);
 }
 
 
 Logger::Logger(const string& loggerName, size_t sessionId)
 {
 	m_object = BNLogCreateLogger(loggerName.c_str(), sessionId);
+	char* name = BNLoggerGetName(m_object);
+	m_name = name;
+	BNFreeString(name);
+	m_sessionId = BNLoggerGetSessionId(m_object);
 }
 
 
@@ -255,7 +487,7 @@ void Logger::Log(BNLogLevel level, const char* fmt, ...)
 {
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(GetSessionId(), level, GetName(), GetThreadId(), fmt, args);
+	PerformLog(m_sessionId, level, m_name, GetThreadId(), fmt, args);
 	va_end(args);
 }
 
@@ -265,7 +497,7 @@ void Logger::LogTrace(const char* fmt, ...)
 #ifdef _DEBUG
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(GetSessionId(), DebugLog, GetName(), GetThreadId(), fmt, args);
+	PerformLog(m_sessionId, DebugLog, m_name, GetThreadId(), fmt, args);
 	va_end(args);
 #endif
 }
@@ -275,7 +507,7 @@ void Logger::LogDebug(const char* fmt, ...)
 {
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(GetSessionId(), DebugLog, GetName(), GetThreadId(), fmt, args);
+	PerformLog(m_sessionId, DebugLog, m_name, GetThreadId(), fmt, args);
 	va_end(args);
 }
 
@@ -284,7 +516,7 @@ void Logger::LogInfo(const char* fmt, ...)
 {
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(GetSessionId(), InfoLog, GetName(), GetThreadId(), fmt, args);
+	PerformLog(m_sessionId, InfoLog, m_name, GetThreadId(), fmt, args);
 	va_end(args);
 }
 
@@ -293,7 +525,7 @@ void Logger::LogWarn(const char* fmt, ...)
 {
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(GetSessionId(), WarningLog, GetName(), GetThreadId(), fmt, args);
+	PerformLog(m_sessionId, WarningLog, m_name, GetThreadId(), fmt, args);
 	va_end(args);
 }
 
@@ -302,7 +534,7 @@ void Logger::LogError(const char* fmt, ...)
 {
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(GetSessionId(), ErrorLog, GetName(), GetThreadId(), fmt, args);
+	PerformLog(m_sessionId, ErrorLog, m_name, GetThreadId(), fmt, args);
 	va_end(args);
 }
 
@@ -311,7 +543,7 @@ void Logger::LogAlert(const char* fmt, ...)
 {
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(GetSessionId(), AlertLog, GetName(), GetThreadId(), fmt, args);
+	PerformLog(m_sessionId, AlertLog, m_name, GetThreadId(), fmt, args);
 	va_end(args);
 }
 
@@ -325,8 +557,10 @@ void Logger::LogFV(BNLogLevel level, fmt::string_view format, fmt::format_args a
 
 void Logger::LogTraceFV(fmt::string_view format, fmt::format_args args)
 {
+#ifdef _DEBUG
 	std::string value = fmt::vformat(format, args);
 	LogTrace("%s", value.c_str());
+#endif
 }
 
 
@@ -367,16 +601,13 @@ void Logger::LogAlertFV(fmt::string_view format, fmt::format_args args)
 
 string Logger::GetName()
 {
-	char* name = BNLoggerGetName(m_object);
-	string result = name;
-	BNFreeString(name);
-	return result;
+	return m_name;
 }
 
 
 size_t Logger::GetSessionId()
 {
-	return BNLoggerGetSessionId(m_object);
+	return m_sessionId;
 }
 
 
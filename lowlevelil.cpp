@@ -25,6 +25,360 @@ using namespace BinaryNinja;
 using namespace std;
 
 
+namespace
+{
+	// Which operands of an operation refer to expressions or lists created by the same lift
+	struct OperandRelocation
+	{
+		uint8_t exprs;
+		uint8_t rawLists;
+		uint8_t exprLists;
+	};
+}  // namespace
+
+
+// Operations whose operands can't be expressed relative to the current lift (labels, SSA) have no entry
+static const OperandRelocation* GetOperandRelocation(BNLowLevelILOperation operation)
+{
+	static const unordered_map<BNLowLevelILOperation, OperandRelocation> relocations = []() {
+		unordered_map<BNLowLevelILOperation, OperandRelocation> result;
+		for (auto& operation : LowLevelILInstructionBase::operationOperandUsage)
+		{
+			OperandRelocation relocation = {0, 0, 0};
+			bool supported = true;
+			auto& operandIndex = LowLevelILInstructionBase::operationOperandIndex[operation.first];
+			for (auto usage : operation.second)
+			{
+				size_t operand = operandIndex[usage];
+				switch (LowLevelILInstructionBase::operandTypeForUsage[usage])
+				{
+				case ExprLowLevelOperand:
+					relocation.exprs |= 1 << operand;
+					break;
+				case ExprListLowLevelOperand:
+					// Counted list when first, otherwise an LLIL_CALL_PARAM subexpression
+					if (operand == 0)
+						relocation.exprLists |= 1 << 1;
+					else
+						relocation.exprs |= 1 << operand;
+					break;
+				case RegisterOrFlagListLowLevelOperand:
+				case RegisterStackAdjustmentsLowLevelOperand:
+					relocation.rawLists |= 1 << (operand + 1);
+					break;
+				case IndexLowLevelOperand:
+					if (usage == TargetLowLevelOperandUsage || usage == TrueTargetLowLevelOperandUsage
+					    || usage == FalseTargetLowLevelOperandUsage)
+						supported = false;
+					break;
+				case IntegerLowLevelOperand:
+				case RegisterLowLevelOperand:
+				case RegisterStackLowLevelOperand:
+				case FlagLowLevelOperand:
+				case FlagConditionLowLevelOperand:
+				case IntrinsicLowLevelOperand:
+				case SemanticFlagClassLowLevelOperand:
+				case SemanticFlagGroupLowLevelOperand:
+					break;
+				default:
+					supported = false;
+					break;
+				}
+			}
+			if (supported)
+				result[operation.first] = relocation;
+		}
+		result[LLIL_CALL_PARAM] = {0, 0, 1 << 1};
+		return result;
+	}();
+
+	auto i = relocations.find(operation);
+	if (i == relocations.end())
+		return nullptr;
+	return &i->second;
+}
+
+
+namespace BinaryNinja
+{
+	/*! One lift recorded as the calls the lifter made on its LowLevelILFunction. Expressions and lists the lift
+		created are referred to by their position in the recording, so it can be replayed into any function.
+
+		ClearCaches counts every mutating call and only the recording ones are matched, so a lift that used
+		anything else (labels, SSA lists, ...) is never valid.
+	*/
+	struct LowLevelILLiftingTemplate
+	{
+		enum EntryKind : uint8_t
+		{
+			ExprEntry,
+			InstructionEntry,
+			ListEntry,
+			AttributesEntry,
+			SourceOperandEntry
+		};
+
+		enum ListContents : uint8_t
+		{
+			UnknownListContents,
+			RawListContents,
+			ExprListContents
+		};
+
+		struct Entry
+		{
+			EntryKind kind = ExprEntry;
+			BNLowLevelILOperation operation = LLIL_NOP;
+			bool hasLocation = false;
+			ListContents listContents = UnknownListContents;
+			// Bit i is set when operands[i] is the position of an earlier entry
+			uint8_t relocated = 0;
+			uint32_t sourceOperand = 0;
+			uint32_t flags = 0;
+			size_t size = 0;
+			uint64_t locationOffset = 0;
+			uint64_t operands[4] = {0, 0, 0, 0};
+			vector<uint64_t> list;
+
+			bool operator==(const Entry& other) const
+			{
+				return kind == other.kind && operation == other.operation && hasLocation == other.hasLocation
+				    && listContents == other.listContents && relocated == other.relocated
+				    && sourceOperand == other.sourceOperand && flags == other.flags && size == other.size
+				    && locationOffset == other.locationOffset && operands[0] == other.operands[0]
+				    && operands[1] == other.operands[1] && operands[2] == other.operands[2]
+				    && operands[3] == other.operands[3] && list == other.list;
+			}
+		};
+
+		uint64_t address = 0;
+		vector<Entry> entries;
+		unordered_map<ExprId, size_t> exprs;
+		unordered_map<ExprId, size_t> lists;
+		size_t mutations = 0;
+		size_t recorded = 0;
+		bool cacheable = true;
+
+		bool IsValid() const { return cacheable && mutations == recorded; }
+
+		bool Relocate(uint64_t& operand, size_t before)
+		{
+			auto i = exprs.find((ExprId)operand);
+			if (i == exprs.end() || i->second >= before)
+				return false;
+			operand = i->second;
+			return true;
+		}
+
+		bool RelocateList(uint64_t& operand, ListContents contents)
+		{
+			auto i = lists.find((ExprId)operand);
+			if (i == lists.end())
+				return false;
+			Entry& list = entries[i->second];
+			if (list.listContents == UnknownListContents)
+			{
+				if (contents == ExprListContents)
+				{
+					for (auto& value : list.list)
+					{
+						if (!Relocate(value, i->second))
+							return false;
+					}
+				}
+				list.listContents = contents;
+			}
+			else if (list.listContents != contents)
+			{
+				return false;
+			}
+			operand = i->second;
+			return true;
+		}
+
+		void RecordExpr(BNLowLevelILOperation operation, bool hasLocation, uint64_t location, uint32_t sourceOperand,
+		    size_t size, uint32_t flags, ExprId a, ExprId b, ExprId c, ExprId d, ExprId result)
+		{
+			recorded++;
+			if (!cacheable)
+				return;
+			const OperandRelocation* relocation = GetOperandRelocation(operation);
+			if (!relocation)
+			{
+				cacheable = false;
+				return;
+			}
+
+			Entry entry;
+			entry.operation = operation;
+			entry.hasLocation = hasLocation;
+			entry.locationOffset = hasLocation ? location - address : 0;
+			entry.sourceOperand = sourceOperand;
+			entry.size = size;
+			entry.flags = flags;
+			entry.operands[0] = a;
+			entry.operands[1] = b;
+			entry.operands[2] = c;
+			entry.operands[3] = d;
+			for (size_t i = 0; i < 4; i++)
+			{
+				bool relocated = true;
+				if (relocation->exprs & (1 << i))
+					relocated = Relocate(entry.operands[i], entries.size());
+				else if (relocation->exprLists & (1 << i))
+					relocated = RelocateList(entry.operands[i], ExprListContents);
+				else if (relocation->rawLists & (1 << i))
+					relocated = RelocateList(entry.operands[i], RawListContents);
+				else
+					continue;
+				if (!relocated)
+				{
+					cacheable = false;
+					return;
+				}
+				entry.relocated |= 1 << i;
+			}
+			exprs[result] = entries.size();
+			entries.push_back(std::move(entry));
+		}
+
+		void RecordList(const uint64_t* values, size_t count, ExprId result)
+		{
+			recorded++;
+			if (!cacheable)
+				return;
+			Entry entry;
+			entry.kind = ListEntry;
+			entry.list.assign(values, values + count);
+			lists[result] = entries.size();
+			entries.push_back(std::move(entry));
+		}
+
+		void RecordExprUse(EntryKind kind, ExprId expr, uint32_t value)
+		{
+			recorded++;
+			if (!cacheable)
+				return;
+			Entry entry;
+			entry.kind = kind;
+			entry.operands[0] = expr;
+			if (kind == SourceOperandEntry)
+				entry.sourceOperand = value;
+			else
+				entry.flags = value;
+			if (!Relocate(entry.operands[0], entries.size()))
+			{
+				cacheable = false;
+				return;
+			}
+			entry.relocated = 1;
+			entries.push_back(std::move(entry));
+		}
+
+		void Replay(LowLevelILFunction& il, uint64_t addr) const
+		{
+			vector<ExprId> ids(entries.size());
+			for (size_t i = 0; i < entries.size(); i++)
+			{
+				const Entry& entry = entries[i];
+				ExprId operands[4];
+				for (size_t j = 0; j < 4; j++)
+					operands[j] = (entry.relocated & (1 << j)) ? ids[entry.operands[j]] : (ExprId)entry.operands[j];
+
+				switch (entry.kind)
+				{
+				case ExprEntry:
+					if (entry.hasLocation)
+					{
+						ids[i] = il.AddExprWithLocation(entry.operation, addr + entry.locationOffset,
+						    entry.sourceOperand, entry.size, entry.flags, operands[0], operands[1], operands[2],
+						    operands[3]);
+					}
+					else
+					{
+						ids[i] = il.AddExpr(entry.operation, entry.size, entry.flags, operands[0], operands[1],
+						    operands[2], operands[3]);
+					}
+					break;
+				case InstructionEntry:
+					ids[i] = il.AddInstruction(operands[0]);
+					break;
+				case ListEntry:
+				{
+					vector<ExprId> values;
+					values.reserve(entry.list.size());
+					for (auto value : entry.list)
+						values.push_back(entry.listContents == ExprListContents ? ids[value] : (ExprId)value);
+					ids[i] = il.AddOperandList(values);
+					break;
+				}
+				case AttributesEntry:
+					il.SetExprAttributes(operands[0], entry.flags);
+					break;
+				case SourceOperandEntry:
+					il.Operand(entry.sourceOperand, operands[0]);
+					break;
+				}
+			}
+		}
+	};
+}  // namespace BinaryNinja
+
+
+namespace
+{
+	struct LiftingCacheKey
+	{
+		const Architecture* arch;
+		uint64_t context;
+		uint8_t bytes[16];
+
+		bool operator==(const LiftingCacheKey& other) const
+		{
+			return arch == other.arch && context == other.context && memcmp(bytes, other.bytes, sizeof(bytes)) == 0;
+		}
+	};
+
+	struct LiftingCacheKeyHash
+	{
+		size_t operator()(const LiftingCacheKey& key) const
+		{
+			uint64_t hash = 0xcbf29ce484222325 ^ (uint64_t)(uintptr_t)key.arch ^ (key.context << 32);
+			for (auto byte : key.bytes)
+				hash = (hash ^ byte) * 0x100000001b3;
+			return (size_t)hash;
+		}
+	};
+
+	struct LiftingCacheEntry
+	{
+		enum State
+		{
+			Unverified,
+			Verified,
+			Rejected
+		};
+
+		State state;
+		bool result;
+		size_t length;
+		LowLevelILLiftingTemplate lift;
+	};
+
+	struct LiftingCacheState
+	{
+		unordered_map<LiftingCacheKey, LiftingCacheEntry, LiftingCacheKeyHash> entries;
+		// Throwaway function that verification lifts go into, replaced before it grows too large
+		Ref<LowLevelILFunction> scratch;
+		const Architecture* scratchArch = nullptr;
+		size_t scratchLifts = 0;
+	};
+
+	static constexpr size_t LiftingCacheCapacity = 0x4000;
+	static constexpr size_t LiftingScratchCapacity = 0x400;
+}  // namespace
+
+
 LowLevelILLabel::LowLevelILLabel()
 {
 	BNLowLevelILInitLabel(this);
@@ -45,6 +399,8 @@ LowLevelILFunction::LowLevelILFunction(BNLowLevelILFunction* func)
 
 Ref<Function> LowLevelILFunction::GetFunction() const
 {
+	if (m_liftingTemplate)
+		m_liftingTemplate->cacheable = false;
 	BNFunction* func = BNGetLowLevelILOwnerFunction(m_object);
 	if (!func)
 		return nullptr;
@@ -63,12 +419,14 @@ Ref<Architecture> LowLevelILFunction::GetArchitecture() const
 
 void LowLevelILFunction::PrepareToCopyFunction(LowLevelILFunction* func)
 {
+	ClearCaches();
 	BNPrepareToCopyLowLevelILFunction(m_object, func->GetObject());
 }
 
 
 void LowLevelILFunction::PrepareToCopyBlock(BasicBlock* block)
 {
+	ClearCaches();
 	BNPrepareToCopyLowLevelILBasicBlock(m_object, block->GetObject());
 }
 
@@ -87,6 +445,8 @@ uint64_t LowLevelILFunction::GetCurrentAddress() const
 
 void LowLevelILFunction::SetCurrentAddress(Architecture* arch, uint64_t addr)
 {
+	if (m_liftingTemplate)
+		m_liftingTemplate->cacheable = false;
 	BNLowLevelILSetCurrentAddress(m_object, arch ? arch->GetObject() : nullptr, addr);
 }
 
@@ -99,6 +459,8 @@ size_t LowLevelILFunction::GetInstructionStart(Architecture* arch, uint64_t addr
 
 void LowLevelILFunction::ClearIndirectBranches()
 {
+	if (m_liftingTemplate)
+		m_liftingTemplate->cacheable = false;
 	BNLowLevelILClearIndirectBranches(m_object);
 }
 
@@ -111,11 +473,110 @@ void LowLevelILFunction::SetIndirectBranches(const vector<ArchAndAddr>& branches
 		branchList[i].arch = branches[i].arch->GetObject();
 		branchList[i].address = branches[i].address;
 	}
+	if (m_liftingTemplate)
+		m_liftingTemplate->cacheable = false;
 	BNLowLevelILSetIndirectBranches(m_object, branchList, branches.size());
 	delete[] branchList;
 }
 
 
+bool LowLevelILFunction::LiftInstructionWithTemplateCache(
+    Architecture* arch, const uint8_t* data, uint64_t addr, size_t& len)
+{
+	LiftingCacheKey key;
+	size_t keyLength = min(len, arch->GetMaxInstructionLength());
+	if (m_liftingTemplate || keyLength == 0 || keyLength > sizeof(key.bytes))
+		return arch->GetInstructionLowLevelIL(data, addr, len, *this);
+
+	auto liftAndRecord = [&](LowLevelILFunction& il, uint64_t liftAddr, size_t& liftLen,
+	                         LowLevelILLiftingTemplate& lift) {
+		lift.address = liftAddr;
+		il.m_liftingTemplate = &lift;
+		bool result;
+		try
+		{
+			result = arch->GetInstructionLowLevelIL(data, liftAddr, liftLen, il);
+		}
+		catch (...)
+		{
+			il.m_liftingTemplate = nullptr;
+			throw;
+		}
+		il.m_liftingTemplate = nullptr;
+		return result;
+	};
+
+	// The low address bits stay in the key for lifters that check alignment
+	key.arch = arch;
+	key.context = (addr & 0xf) | (keyLength << 8);
+	memset(key.bytes, 0, sizeof(key.bytes));
+	memcpy(key.bytes, data, keyLength);
+
+	thread_local LiftingCacheState state;
+	auto i = state.entries.find(key);
+	if (i == state.entries.end())
+	{
+		if (state.entries.size() >= LiftingCacheCapacity)
+			state.entries.clear();
+		LiftingCacheEntry entry;
+		bool result = liftAndRecord(*this, addr, len, entry.lift);
+		entry.result = result;
+		entry.length = len;
+		if (entry.lift.IsValid())
+		{
+			entry.state = LiftingCacheEntry::Unverified;
+			entry.lift.exprs.clear();
+			entry.lift.lists.clear();
+		}
+		else
+		{
+			entry.state = LiftingCacheEntry::Rejected;
+			entry.lift = LowLevelILLiftingTemplate();
+		}
+		state.entries.emplace(key, std::move(entry));
+		return result;
+	}
+
+	LiftingCacheEntry& entry = i->second;
+	if (entry.state == LiftingCacheEntry::Unverified)
+	{
+		// Lift the same bytes again at an address that only shares the low bits. If the recording comes out the
+		// same, the lift depends on nothing but the key and can be replayed anywhere.
+		if (!state.scratch || state.scratchArch != arch || state.scratchLifts >= LiftingScratchCapacity)
+		{
+			state.scratch = new LowLevelILFunction(arch);
+			state.scratchArch = arch;
+			state.scratchLifts = 0;
+		}
+		state.scratchLifts++;
+
+		size_t addressSize = arch->GetAddressSize();
+		uint64_t addressMask = addressSize >= 8 ? ~(uint64_t)0 : (((uint64_t)1 << (addressSize * 8)) - 1);
+		uint64_t probeAddr = addr ^ (~(uint64_t)0xfff & addressMask);
+		size_t probeLen = len;
+		LowLevelILLiftingTemplate probe;
+		bool probeResult = liftAndRecord(*state.scratch, probeAddr, probeLen, probe);
+		if (probe.IsValid() && probeResult == entry.result && probeLen == entry.length
+		    && probe.entries == entry.lift.entries)
+		{
+			entry.state = LiftingCacheEntry::Verified;
+		}
+		else
+		{
+			entry.state = LiftingCacheEntry::Rejected;
+			entry.lift = LowLevelILLiftingTemplate();
+		}
+	}
+
+	if (entry.state == LiftingCacheEntry::Rejected)
+		return arch->GetInstructionLowLevelIL(data, addr, len, *this);
+
+	entry.lift.Replay(*this, addr);
+	len = entry.length;
+	return entry.result;
+}
+
+
 std::vector<uint32_t> LowLevelILFunction::GetRegisters()
 {
 	std::vector<uint32_t> result;
@@ -299,37 +760,62 @@ std::vector<SSAFlag> LowLevelILFunction::GetSSAFlags()
 ExprId LowLevelILFunction::AddExpr(
     BNLowLevelILOperation operation, size_t size, uint32_t flags, ExprId a, ExprId b, ExprId c, ExprId d)
 {
-	return BNLowLevelILAddExpr(m_object, operation, size, flags, a, b, c, d);
+	ClearCaches();
+	ExprId result = BNLowLevelILAddExpr(m_object, operation, size, flags, a, b, c, d);
+	if (m_liftingTemplate)
+		m_liftingTemplate->RecordExpr(operation, false, 0, 0, size, flags, a, b, c, d, result);
+	return result;
 }
 
 
 ExprId LowLevelILFunction::AddExprWithLocation(BNLowLevelILOperation operation, uint64_t addr, uint32_t sourceOperand,
     size_t size, uint32_t flags, ExprId a, ExprId b, ExprId c, ExprId d)
 {
-	return BNLowLevelILAddExprWithLocation(m_object, addr, sourceOperand, operation, size, flags, a, b, c, d);
+	ClearCaches();
+	ExprId result =
+	    BNLowLevelILAddExprWithLocation(m_object, addr, sourceOperand, operation, size, flags, a, b, c, d);
+	if (m_liftingTemplate)
+		m_liftingTemplate->RecordExpr(operation, true, addr, sourceOperand, size, flags, a, b, c, d, result);
+	return result;
 }
 
 
 ExprId LowLevelILFunction::AddExprWithLocation(BNLowLevelILOperation operation, const ILSourceLocation& loc,
     size_t size, uint32_t flags, ExprId a, ExprId b, ExprId c, ExprId d)
 {
+	ClearCaches();
+	ExprId result;
 	if (loc.valid)
 	{
-		return BNLowLevelILAddExprWithLocation(
+		result = BNLowLevelILAddExprWithLocation(
 		    m_object, loc.address, loc.sourceOperand, operation, size, flags, a, b, c, d);
 	}
-	return BNLowLevelILAddExpr(m_object, operation, size, flags, a, b, c, d);
+	else
+	{
+		result = BNLowLevelILAddExpr(m_object, operation, size, flags, a, b, c, d);
+	}
+	if (m_liftingTemplate)
+	{
+		m_liftingTemplate->RecordExpr(
+		    operation, loc.valid, loc.address, loc.sourceOperand, size, flags, a, b, c, d, result);
+	}
+	return result;
 }
 
 
 ExprId LowLevelILFunction::AddInstruction(size_t expr)
 {
-	return BNLowLevelILAddInstruction(m_object, expr);
+	ClearCaches();
+	ExprId result = BNLowLevelILAddInstruction(m_object, expr);
+	if (m_liftingTemplate)
+		m_liftingTemplate->RecordExprUse(LowLevelILLiftingTemplate::InstructionEntry, expr, 0);
+	return result;
 }
 
 
 ExprId LowLevelILFunction::Goto(BNLowLevelILLabel& label, const ILSourceLocation& loc)
 {
+	ClearCaches();
 	if (loc.valid)
 		return BNLowLevelILGotoWithLocation(m_object, &label, loc.address, loc.sourceOperand);
 	return BNLowLevelILGoto(m_object, &label);
@@ -338,6 +824,7 @@ ExprId LowLevelILFunction::Goto(BNLowLevelILLabel& label, const ILSourceLocation
 
 ExprId LowLevelILFunction::If(ExprId operand, BNLowLevelILLabel& t, BNLowLevelILLabel& f, const ILSourceLocation& loc)
 {
+	ClearCaches();
 	if (loc.valid)
 		return BNLowLevelILIfWithLocation(m_object, operand, &t, &f, loc.address, loc.sourceOperand);
 	return BNLowLevelILIf(m_object, operand, &t, &f);
@@ -346,6 +833,7 @@ ExprId LowLevelILFunction::If(ExprId operand, BNLowLevelILLabel& t, BNLowLevelIL
 
 void LowLevelILFunction::MarkLabel(BNLowLevelILLabel& label)
 {
+	ClearCaches();
 	BNLowLevelILMarkLabel(m_object, &label);
 }
 
@@ -365,6 +853,7 @@ vector<uint64_t> LowLevelILFunction::GetOperandList(ExprId expr, size_t listOper
 
 ExprId LowLevelILFunction::AddLabelMap(const map<uint64_t, BNLowLevelILLabel*>& labels)
 {
+	ClearCaches();
 	uint64_t* valueList = new uint64_t[labels.size()];
 	BNLowLevelILLabel** labelList = new BNLowLevelILLabel*[labels.size()];
 	size_t i = 0;
@@ -382,10 +871,13 @@ ExprId LowLevelILFunction::AddLabelMap(const map<uint64_t, BNLowLevelILLabel*>&
 
 ExprId LowLevelILFunction::AddOperandList(const vector<ExprId> operands)
 {
+	ClearCaches();
 	uint64_t* operandList = new uint64_t[operands.size()];
 	for (size_t i = 0; i < operands.size(); i++)
 		operandList[i] = operands[i];
 	ExprId result = (ExprId)BNLowLevelILAddOperandList(m_object, operandList, operands.size());
+	if (m_liftingTemplate)
+		m_liftingTemplate->RecordList(operandList, operands.size(), result);
 	delete[] operandList;
 	return result;
 }
@@ -393,10 +885,13 @@ ExprId LowLevelILFunction::AddOperandList(const vector<ExprId> operands)
 
 ExprId LowLevelILFunction::AddIndexList(const vector<size_t> operands)
 {
+	ClearCaches();
 	uint64_t* operandList = new uint64_t[operands.size()];
 	for (size_t i = 0; i < operands.size(); i++)
 		operandList[i] = operands[i];
 	ExprId result = (ExprId)BNLowLevelILAddOperandList(m_object, operandList, operands.size());
+	if (m_liftingTemplate)
+		m_liftingTemplate->RecordList(operandList, operands.size(), result);
 	delete[] operandList;
 	return result;
 }
@@ -404,10 +899,13 @@ ExprId LowLevelILFunction::AddIndexList(const vector<size_t> operands)
 
 ExprId LowLevelILFunction::AddRegisterOrFlagList(const vector<RegisterOrFlag>& regs)
 {
+	ClearCaches();
 	uint64_t* operandList = new uint64_t[regs.size()];
 	for (size_t i = 0; i < regs.size(); i++)
 		operandList[i] = regs[i].ToIdentifier();
 	ExprId result = (ExprId)BNLowLevelILAddOperandList(m_object, operandList, regs.size());
+	if (m_liftingTemplate)
+		m_liftingTemplate->RecordList(operandList, regs.size(), result);
 	delete[] operandList;
 	return result;
 }
@@ -415,6 +913,7 @@ ExprId LowLevelILFunction::AddRegisterOrFlagList(const vector<RegisterOrFlag>& r
 
 ExprId LowLevelILFunction::AddSSARegisterList(const vector<SSARegister>& regs)
 {
+	ClearCaches();
 	uint64_t* operandList = new uint64_t[regs.size() * 2];
 	for (size_t i = 0; i < regs.size(); i++)
 	{
@@ -429,6 +928,7 @@ ExprId LowLevelILFunction::AddSSARegisterList(const vector<SSARegister>& regs)
 
 ExprId LowLevelILFunction::AddSSARegisterStackList(const vector<SSARegisterStack>& regStacks)
 {
+	ClearCaches();
 	uint64_t* operandList = new uint64_t[regStacks.size() * 2];
 	for (size_t i = 0; i < regStacks.size(); i++)
 	{
@@ -443,6 +943,7 @@ ExprId LowLevelILFunction::AddSSARegisterStackList(const vector<SSARegisterStack
 
 ExprId LowLevelILFunction::AddSSAFlagList(const vector<SSAFlag>& flags)
 {
+	ClearCaches();
 	uint64_t* operandList = new uint64_t[flags.size() * 2];
 	for (size_t i = 0; i < flags.size(); i++)
 	{
@@ -457,6 +958,7 @@ ExprId LowLevelILFunction::AddSSAFlagList(const vector<SSAFlag>& flags)
 
 ExprId LowLevelILFunction::AddSSARegisterOrFlagList(const vector<SSARegisterOrFlag>& regs)
 {
+	ClearCaches();
 	uint64_t* operandList = new uint64_t[regs.size() * 2];
 	for (size_t i = 0; i < regs.size(); i++)
 	{
@@ -527,13 +1029,18 @@ ExprId LowLevelILFunction::GetExprForRegisterOrConstantOperation(
 
 ExprId LowLevelILFunction::Operand(size_t n, ExprId expr)
 {
+	ClearCaches();
 	BNLowLevelILSetExprSourceOperand(m_object, expr, (uint32_t)n);
+	if (m_liftingTemplate)
+		m_liftingTemplate->RecordExprUse(LowLevelILLiftingTemplate::SourceOperandEntry, expr, (uint32_t)n);
 	return expr;
 }
 
 
 BNLowLevelILInstruction LowLevelILFunction::GetRawExpr(size_t i) const
 {
+	if (m_exprArena && i < m_exprArena->exprs.size())
+		return m_exprArena->exprs[i];
 	return BNGetLowLevelILByIndex(m_object, i);
 }
 
@@ -557,68 +1064,156 @@ LowLevelILInstruction LowLevelILFunction::GetExpr(size_t i)
 }
 
 
+size_t LowLevelILFunction::GetInstructions(size_t start, size_t count, vector<LowLevelILInstruction>& result)
+{
+	size_t total = GetInstructionCount();
+	if (start >= total)
+		return 0;
+	count = min(count, total - start);
+	result.reserve(result.size() + count);
+	for (size_t i = start; i < start + count; i++)
+	{
+		size_t expr = GetIndexForInstruction(i);
+		result.emplace_back(this, GetRawExpr(expr), expr, i);
+	}
+	return count;
+}
+
+
+size_t LowLevelILFunction::GetExprs(size_t start, size_t count, vector<LowLevelILInstruction>& result)
+{
+	size_t total = GetExprCount();
+	if (start >= total)
+		return 0;
+	count = min(count, total - start);
+	result.reserve(result.size() + count);
+	for (size_t i = start; i < start + count; i++)
+		result.emplace_back(this, GetRawExpr(i), i, GetInstructionForExpr(i));
+	return count;
+}
+
+
 size_t LowLevelILFunction::GetIndexForInstruction(size_t i) const
 {
+	if (m_exprArena && i < m_exprArena->exprForInstruction.size())
+		return m_exprArena->exprForInstruction[i];
 	return BNGetLowLevelILIndexForInstruction(m_object, i);
 }
 
 
 size_t LowLevelILFunction::GetInstructionForExpr(size_t expr) const
 {
+	if (m_exprArena && expr < m_exprArena->instructionForExpr.size())
+		return m_exprArena->instructionForExpr[expr];
 	return BNGetLowLevelILInstructionForExpr(m_object, expr);
 }
 
 
 size_t LowLevelILFunction::GetInstructionCount() const
 {
+	if (m_exprArena)
+		return m_exprArena->exprForInstruction.size();
 	return BNGetLowLevelILInstructionCount(m_object);
 }
 
 
 size_t LowLevelILFunction::GetExprCount() const
 {
+	if (m_exprArena)
+		return m_exprArena->exprs.size();
 	return BNGetLowLevelILExprCount(m_object);
 }
 
 
+shared_ptr<const LowLevelILExprArena> LowLevelILFunction::GetExprArena()
+{
+	if (m_exprArena)
+		return m_exprArena;
+
+	auto arena = make_shared<LowLevelILExprArena>();
+	size_t exprCount = BNGetLowLevelILExprCount(m_object);
+	arena->exprs.reserve(exprCount);
+	arena->instructionForExpr.reserve(exprCount);
+	for (size_t i = 0; i < exprCount; i++)
+	{
+		arena->exprs.push_back(BNGetLowLevelILByIndex(m_object, i));
+		arena->instructionForExpr.push_back(BNGetLowLevelILInstructionForExpr(m_object, i));
+	}
+
+	size_t instrCount = BNGetLowLevelILInstructionCount(m_object);
+	arena->exprForInstruction.reserve(instrCount);
+	for (size_t i = 0; i < instrCount; i++)
+		arena->exprForInstruction.push_back(BNGetLowLevelILIndexForInstruction(m_object, i));
+
+	m_exprArena = arena;
+	return m_exprArena;
+}
+
+
+void LowLevelILFunction::ReleaseExprArena()
+{
+	m_exprArena.reset();
+}
+
+
+void LowLevelILFunction::ClearCaches()
+{
+	m_exprArena.reset();
+	m_ssaRegisterDefUseTable.reset();
+	if (m_liftingTemplate)
+		m_liftingTemplate->mutations++;
+}
+
+
 void LowLevelILFunction::UpdateInstructionOperand(size_t i, size_t operandIndex, ExprId value)
 {
+	ClearCaches();
 	BNUpdateLowLevelILOperand(m_object, i, operandIndex, value);
 }
 
 
 void LowLevelILFunction::ReplaceExpr(size_t expr, size_t newExpr)
 {
+	ClearCaches();
 	BNReplaceLowLevelILExpr(m_object, expr, newExpr);
 }
 
 
 void LowLevelILFunction::SetExprAttributes(size_t expr, uint32_t attributes)
 {
+	ClearCaches();
 	BNSetLowLevelILExprAttributes(m_object, expr, attributes);
+	if (m_liftingTemplate)
+		m_liftingTemplate->RecordExprUse(LowLevelILLiftingTemplate::AttributesEntry, expr, attributes);
 }
 
 
 void LowLevelILFunction::AddLabelForAddress(Architecture* arch, uint64_t addr)
 {
+	if (m_liftingTemplate)
+		m_liftingTemplate->cacheable = false;
 	BNAddLowLevelILLabelForAddress(m_object, arch->GetObject(), addr);
 }
 
 
 BNLowLevelILLabel* LowLevelILFunction::GetLabelForAddress(Architecture* arch, uint64_t addr)
 {
+	if (m_liftingTemplate)
+		m_liftingTemplate->cacheable = false;
 	return BNGetLowLevelILLabelForAddress(m_object, arch->GetObject(), addr);
 }
 
 
 void LowLevelILFunction::Finalize()
 {
+	ClearCaches();
 	BNFinalizeLowLevelILFunction(m_object);
 }
 
 
 void LowLevelILFunction::GenerateSSAForm()
 {
+	ClearCaches();
 	BNGenerateLowLevelILSSAForm(m_object);
 }
 
@@ -762,6 +1357,37 @@ set<size_t> LowLevelILFunction::GetSSARegisterUses(const SSARegister& reg) const
 }
 
 
+shared_ptr<const LowLevelILSSARegisterDefUseTable> LowLevelILFunction::GetSSARegisterDefUseTable()
+{
+	if (m_ssaRegisterDefUseTable)
+		return m_ssaRegisterDefUseTable;
+
+	auto table = make_shared<LowLevelILSSARegisterDefUseTable>();
+	table->variables = GetSSARegisters();
+	sort(table->variables.begin(), table->variables.end());
+	table->variables.erase(unique(table->variables.begin(), table->variables.end()), table->variables.end());
+
+	table->definitions.reserve(table->variables.size());
+	table->useOffsets.reserve(table->variables.size() + 1);
+	table->useOffsets.push_back(0);
+	for (const SSARegister& reg : table->variables)
+	{
+		table->definitions.push_back(BNGetLowLevelILSSARegisterDefinition(m_object, reg.reg, reg.version));
+
+		size_t count;
+		size_t* instrs = BNGetLowLevelILSSARegisterUses(m_object, reg.reg, reg.version, &count);
+		size_t first = table->uses.size();
+		table->uses.insert(table->uses.end(), instrs, instrs + count);
+		BNFreeILInstructionList(instrs);
+		sort(table->uses.begin() + first, table->uses.end());
+		table->useOffsets.push_back(table->uses.size());
+	}
+
+	m_ssaRegisterDefUseTable = table;
+	return m_ssaRegisterDefUseTable;
+}
+
+
 set<size_t> LowLevelILFunction::GetSSAFlagUses(const SSAFlag& flag) const
 {
 	size_t count;
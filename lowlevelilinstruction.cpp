@@ -18,6 +18,7 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <algorithm>
 #include <cstring>
 #ifdef BINARYNINJACORE_LIBRARY
 	#include "lowlevelilfunction.h"
@@ -1840,107 +1841,106 @@ void LowLevelILInstructionBase::ClearAttribute(BNILInstructionAttribute attribut
 }
 
 
-void LowLevelILInstruction::VisitExprs(const std::function<bool(const LowLevelILInstruction& expr)>& func) const
+void LowLevelILInstruction::CollectSubExprs(vector<LowLevelILInstruction>& toProcess) const
 {
-	if (!func(*this))
-		return;
+	size_t first = toProcess.size();
 	switch (operation)
 	{
 	case LLIL_SET_REG:
-		GetSourceExpr<LLIL_SET_REG>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<LLIL_SET_REG>());
 		break;
 	case LLIL_SET_REG_SPLIT:
-		GetSourceExpr<LLIL_SET_REG_SPLIT>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<LLIL_SET_REG_SPLIT>());
 		break;
 	case LLIL_SET_REG_SSA:
-		GetSourceExpr<LLIL_SET_REG_SSA>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<LLIL_SET_REG_SSA>());
 		break;
 	case LLIL_SET_REG_SSA_PARTIAL:
-		GetSourceExpr<LLIL_SET_REG_SSA_PARTIAL>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<LLIL_SET_REG_SSA_PARTIAL>());
 		break;
 	case LLIL_SET_REG_SPLIT_SSA:
-		GetSourceExpr<LLIL_SET_REG_SPLIT_SSA>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<LLIL_SET_REG_SPLIT_SSA>());
 		break;
 	case LLIL_SET_REG_STACK_REL:
-		GetDestExpr<LLIL_SET_REG_STACK_REL>().VisitExprs(func);
-		GetSourceExpr<LLIL_SET_REG_STACK_REL>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<LLIL_SET_REG_STACK_REL>());
+		toProcess.push_back(GetSourceExpr<LLIL_SET_REG_STACK_REL>());
 		break;
 	case LLIL_REG_STACK_PUSH:
-		GetSourceExpr<LLIL_REG_STACK_PUSH>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<LLIL_REG_STACK_PUSH>());
 		break;
 	case LLIL_SET_REG_STACK_REL_SSA:
-		GetDestExpr<LLIL_SET_REG_STACK_REL_SSA>().VisitExprs(func);
-		GetSourceExpr<LLIL_SET_REG_STACK_REL_SSA>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<LLIL_SET_REG_STACK_REL_SSA>());
+		toProcess.push_back(GetSourceExpr<LLIL_SET_REG_STACK_REL_SSA>());
 		break;
 	case LLIL_SET_REG_STACK_ABS_SSA:
-		GetSourceExpr<LLIL_SET_REG_STACK_ABS_SSA>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<LLIL_SET_REG_STACK_ABS_SSA>());
 		break;
 	case LLIL_SET_FLAG:
-		GetSourceExpr<LLIL_SET_FLAG>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<LLIL_SET_FLAG>());
 		break;
 	case LLIL_SET_FLAG_SSA:
-		GetSourceExpr<LLIL_SET_FLAG_SSA>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<LLIL_SET_FLAG_SSA>());
 		break;
 	case LLIL_REG_STACK_REL:
-		GetSourceExpr<LLIL_REG_STACK_REL>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<LLIL_REG_STACK_REL>());
 		break;
 	case LLIL_REG_STACK_FREE_REL:
-		GetDestExpr<LLIL_REG_STACK_FREE_REL>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<LLIL_REG_STACK_FREE_REL>());
 		break;
 	case LLIL_REG_STACK_REL_SSA:
-		GetSourceExpr<LLIL_REG_STACK_REL_SSA>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<LLIL_REG_STACK_REL_SSA>());
 		break;
 	case LLIL_REG_STACK_FREE_REL_SSA:
-		GetDestExpr<LLIL_REG_STACK_FREE_REL_SSA>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<LLIL_REG_STACK_FREE_REL_SSA>());
 		break;
 	case LLIL_LOAD:
-		GetSourceExpr<LLIL_LOAD>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<LLIL_LOAD>());
 		break;
 	case LLIL_LOAD_SSA:
-		GetSourceExpr<LLIL_LOAD_SSA>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<LLIL_LOAD_SSA>());
 		break;
 	case LLIL_STORE:
-		GetDestExpr<LLIL_STORE>().VisitExprs(func);
-		GetSourceExpr<LLIL_STORE>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<LLIL_STORE>());
+		toProcess.push_back(GetSourceExpr<LLIL_STORE>());
 		break;
 	case LLIL_STORE_SSA:
-		GetDestExpr<LLIL_STORE_SSA>().VisitExprs(func);
-		GetSourceExpr<LLIL_STORE_SSA>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<LLIL_STORE_SSA>());
+		toProcess.push_back(GetSourceExpr<LLIL_STORE_SSA>());
 		break;
 	case LLIL_JUMP:
-		GetDestExpr<LLIL_JUMP>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<LLIL_JUMP>());
 		break;
 	case LLIL_JUMP_TO:
-		GetDestExpr<LLIL_JUMP_TO>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<LLIL_JUMP_TO>());
 		break;
 	case LLIL_IF:
-		GetConditionExpr<LLIL_IF>().VisitExprs(func);
+		toProcess.push_back(GetConditionExpr<LLIL_IF>());
 		break;
 	case LLIL_CALL:
-		GetDestExpr<LLIL_CALL>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<LLIL_CALL>());
 		break;
 	case LLIL_CALL_STACK_ADJUST:
-		GetDestExpr<LLIL_CALL_STACK_ADJUST>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<LLIL_CALL_STACK_ADJUST>());
 		break;
 	case LLIL_TAILCALL:
-		GetDestExpr<LLIL_TAILCALL>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<LLIL_TAILCALL>());
 		break;
 	case LLIL_CALL_SSA:
-		GetDestExpr<LLIL_CALL_SSA>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<LLIL_CALL_SSA>());
 		for (auto i : GetParameterExprs<LLIL_CALL_SSA>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case LLIL_SYSCALL_SSA:
 		for (auto i : GetParameterExprs<LLIL_SYSCALL_SSA>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case LLIL_TAILCALL_SSA:
-		GetDestExpr<LLIL_TAILCALL_SSA>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<LLIL_TAILCALL_SSA>());
 		for (auto i : GetParameterExprs<LLIL_TAILCALL_SSA>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case LLIL_RET:
-		GetDestExpr<LLIL_RET>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<LLIL_RET>());
 		break;
 	case LLIL_PUSH:
 	case LLIL_NEG:
@@ -1960,7 +1960,7 @@ void LowLevelILInstruction::VisitExprs(const std::function<bool(const LowLevelIL
 	case LLIL_FLOOR:
 	case LLIL_CEIL:
 	case LLIL_FTRUNC:
-		AsOneOperand().GetSourceExpr().VisitExprs(func);
+		toProcess.push_back(AsOneOperand().GetSourceExpr());
 		break;
 	case LLIL_ADD:
 	case LLIL_SUB:
@@ -2007,40 +2007,47 @@ void LowLevelILInstruction::VisitExprs(const std::function<bool(const LowLevelIL
 	case LLIL_FCMP_GT:
 	case LLIL_FCMP_O:
 	case LLIL_FCMP_UO:
-		AsTwoOperand().GetLeftExpr().VisitExprs(func);
-		AsTwoOperand().GetRightExpr().VisitExprs(func);
+		toProcess.push_back(AsTwoOperand().GetLeftExpr());
+		toProcess.push_back(AsTwoOperand().GetRightExpr());
 		break;
 	case LLIL_ADC:
 	case LLIL_SBB:
 	case LLIL_RLC:
 	case LLIL_RRC:
-		AsTwoOperandWithCarry().GetLeftExpr().VisitExprs(func);
-		AsTwoOperandWithCarry().GetRightExpr().VisitExprs(func);
-		AsTwoOperandWithCarry().GetCarryExpr().VisitExprs(func);
+		toProcess.push_back(AsTwoOperandWithCarry().GetLeftExpr());
+		toProcess.push_back(AsTwoOperandWithCarry().GetRightExpr());
+		toProcess.push_back(AsTwoOperandWithCarry().GetCarryExpr());
 		break;
 	case LLIL_INTRINSIC:
 		for (auto i : GetParameterExprs<LLIL_INTRINSIC>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case LLIL_INTRINSIC_SSA:
 		for (auto i : GetParameterExprs<LLIL_INTRINSIC_SSA>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case LLIL_MEMORY_INTRINSIC_SSA:
 		for (auto i : GetParameterExprs<LLIL_MEMORY_INTRINSIC_SSA>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case LLIL_SEPARATE_PARAM_LIST_SSA:
 		for (auto i : GetParameterExprs<LLIL_SEPARATE_PARAM_LIST_SSA>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case LLIL_SHARED_PARAM_SLOT_SSA:
 		for (auto i : GetParameterExprs<LLIL_SHARED_PARAM_SLOT_SSA>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	default:
 		break;
 	}
+	reverse(toProcess.begin() + first, toProcess.end());
+}
+
+
+void LowLevelILInstruction::VisitExprs(const std::function<bool(const LowLevelILInstruction& expr)>& func) const
+{
+	VisitExprs<const std::function<bool(const LowLevelILInstruction& expr)>&>(func);
 }
 
 
@@ -813,8 +813,30 @@ namespace BinaryNinja
 		    LowLevelILFunction* func, const BNLowLevelILInstruction& instr, size_t expr, size_t instrIdx);
 		LowLevelILInstruction(const LowLevelILInstructionBase& instr);
 
+		/*! Append the direct subexpressions of this expression to \c toProcess in reverse operand order, so
+			popping from the back yields them in operand order
+		*/
+		void CollectSubExprs(_STD_VECTOR<LowLevelILInstruction>& toProcess) const;
 		void VisitExprs(const std::function<bool(const LowLevelILInstruction& expr)>& func) const;
 
+		/*! Visit this expression and its subexpressions in pre-order using an explicit stack. Subexpressions of
+			an expression are skipped when \c func returns false for it. The callable is invoked directly
+			rather than through \c std::function, so prefer this overload for whole-function traversals.
+		*/
+		template <typename Func>
+		void VisitExprs(Func&& func) const
+		{
+			_STD_VECTOR<LowLevelILInstruction> toProcess;
+			toProcess.push_back(*this);
+			while (!toProcess.empty())
+			{
+				LowLevelILInstruction cur = std::move(toProcess.back());
+				toProcess.pop_back();
+				if (func(static_cast<const LowLevelILInstruction&>(cur)))
+					cur.CollectSubExprs(toProcess);
+			}
+		}
+
 		ExprId CopyTo(LowLevelILFunction* dest) const;
 		ExprId CopyTo(LowLevelILFunction* dest,
 		    const std::function<ExprId(const LowLevelILInstruction& subExpr)>& subExprHandler) const;
@@ -11,6 +11,25 @@ struct MainThreadActionContext
 };
 
 
+namespace
+{
+	struct CoalescedActionQueue
+	{
+		mutex queueMutex;
+		vector<function<void()>> actions;
+		unordered_map<string, size_t> keyedActions;
+		bool scheduled = false;
+	};
+}
+
+
+static CoalescedActionQueue& GetCoalescedActionQueue()
+{
+	static CoalescedActionQueue queue;
+	return queue;
+}
+
+
 MainThreadAction::MainThreadAction(BNMainThreadAction* action)
 {
 	m_object = action;
@@ -51,16 +70,14 @@ void BinaryNinja::RegisterMainThread(MainThreadActionHandler* handler)
 }
 
 
-static void ExecuteAction(void* ctxt)
+static void RunDetachedAction(const function<void()>& action)
 {
-	MainThreadActionContext* action = (MainThreadActionContext*)ctxt;
-
 	// We can't throw across a thread and *certainly* not across the api boundary
 	// But how do we deal with exceptions thrown in main thread callbacks if the caller doesn't wait for them?
 	// Likely the only good solution is abort()
 	try
 	{
-		action->action();
+		action();
 	}
 	catch (const std::exception& e)
 	{
@@ -74,6 +91,13 @@ static void ExecuteAction(void* ctxt)
 		fprintf(stderr, "Exception in main thread handler: <unknown exception>\n");
 		abort();
 	}
+}
+
+
+static void ExecuteAction(void* ctxt)
+{
+	MainThreadActionContext* action = (MainThreadActionContext*)ctxt;
+	RunDetachedAction(action->action);
 	delete action;
 }
 
@@ -87,6 +111,48 @@ Ref<MainThreadAction> BinaryNinja::ExecuteOnMainThread(const function<void()>& a
 }
 
 
+static void ExecuteCoalescedActions(void*)
+{
+	CoalescedActionQueue& queue = GetCoalescedActionQueue();
+	vector<function<void()>> actions;
+	{
+		unique_lock<mutex> lock(queue.queueMutex);
+		actions.swap(queue.actions);
+		queue.keyedActions.clear();
+		// Anything queued while these run gets a callback of its own
+		queue.scheduled = false;
+	}
+
+	for (auto& action : actions)
+		RunDetachedAction(action);
+}
+
+
+void BinaryNinja::ExecuteOnMainThreadCoalesced(const function<void()>& action, const string& key)
+{
+	CoalescedActionQueue& queue = GetCoalescedActionQueue();
+	{
+		unique_lock<mutex> lock(queue.queueMutex);
+		if (!key.empty())
+		{
+			auto [i, inserted] = queue.keyedActions.try_emplace(key, queue.actions.size());
+			if (!inserted)
+			{
+				queue.actions[i->second] = action;
+				return;
+			}
+		}
+		queue.actions.push_back(action);
+		if (queue.scheduled)
+			return;
+		queue.scheduled = true;
+	}
+
+	if (BNMainThreadAction* obj = BNExecuteOnMainThread(nullptr, ExecuteCoalescedActions))
+		BNFreeMainThreadAction(obj);
+}
+
+
 static void ExecuteActionLocal(void* ctxt)
 {
 	MainThreadActionContext* action = (MainThreadActionContext*)ctxt;
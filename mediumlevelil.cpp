@@ -81,12 +81,14 @@ size_t MediumLevelILFunction::GetInstructionStart(Architecture* arch, uint64_t a
 
 void MediumLevelILFunction::PrepareToCopyFunction(MediumLevelILFunction* func)
 {
+	ClearCaches();
 	BNPrepareToCopyMediumLevelILFunction(m_object, func->GetObject());
 }
 
 
 void MediumLevelILFunction::PrepareToCopyBlock(BasicBlock* block)
 {
+	ClearCaches();
 	BNPrepareToCopyMediumLevelILBasicBlock(m_object, block->GetObject());
 }
 
@@ -100,6 +102,7 @@ BNMediumLevelILLabel* MediumLevelILFunction::GetLabelForSourceInstruction(size_t
 ExprId MediumLevelILFunction::AddExpr(
     BNMediumLevelILOperation operation, size_t size, ExprId a, ExprId b, ExprId c, ExprId d, ExprId e)
 {
+	ClearCaches();
 	return BNMediumLevelILAddExpr(m_object, operation, size, a, b, c, d, e);
 }
 
@@ -107,6 +110,7 @@ ExprId MediumLevelILFunction::AddExpr(
 ExprId MediumLevelILFunction::AddExprWithLocation(BNMediumLevelILOperation operation, uint64_t addr,
     uint32_t sourceOperand, size_t size, ExprId a, ExprId b, ExprId c, ExprId d, ExprId e)
 {
+	ClearCaches();
 	return BNMediumLevelILAddExprWithLocation(m_object, operation, addr, sourceOperand, size, a, b, c, d, e);
 }
 
@@ -114,6 +118,7 @@ ExprId MediumLevelILFunction::AddExprWithLocation(BNMediumLevelILOperation opera
 ExprId MediumLevelILFunction::AddExprWithLocation(BNMediumLevelILOperation operation, const ILSourceLocation& loc,
     size_t size, ExprId a, ExprId b, ExprId c, ExprId d, ExprId e)
 {
+	ClearCaches();
 	if (loc.valid)
 	{
 		return BNMediumLevelILAddExprWithLocation(
@@ -125,12 +130,14 @@ ExprId MediumLevelILFunction::AddExprWithLocation(BNMediumLevelILOperation opera
 
 ExprId MediumLevelILFunction::AddInstruction(size_t expr)
 {
+	ClearCaches();
 	return BNMediumLevelILAddInstruction(m_object, expr);
 }
 
 
 ExprId MediumLevelILFunction::Goto(BNMediumLevelILLabel& label, const ILSourceLocation& loc)
 {
+	ClearCaches();
 	if (loc.valid)
 		return BNMediumLevelILGotoWithLocation(m_object, &label, loc.address, loc.sourceOperand);
 	return BNMediumLevelILGoto(m_object, &label);
@@ -140,6 +147,7 @@ ExprId MediumLevelILFunction::Goto(BNMediumLevelILLabel& label, const ILSourceLo
 ExprId MediumLevelILFunction::If(
     ExprId operand, BNMediumLevelILLabel& t, BNMediumLevelILLabel& f, const ILSourceLocation& loc)
 {
+	ClearCaches();
 	if (loc.valid)
 		return BNMediumLevelILIfWithLocation(m_object, operand, &t, &f, loc.address, loc.sourceOperand);
 	return BNMediumLevelILIf(m_object, operand, &t, &f);
@@ -148,6 +156,7 @@ ExprId MediumLevelILFunction::If(
 
 void MediumLevelILFunction::MarkLabel(BNMediumLevelILLabel& label)
 {
+	ClearCaches();
 	BNMediumLevelILMarkLabel(m_object, &label);
 }
 
@@ -167,6 +176,7 @@ vector<uint64_t> MediumLevelILFunction::GetOperandList(ExprId expr, size_t listO
 
 ExprId MediumLevelILFunction::AddLabelMap(const map<uint64_t, BNMediumLevelILLabel*>& labels)
 {
+	ClearCaches();
 	uint64_t* valueList = new uint64_t[labels.size()];
 	BNMediumLevelILLabel** labelList = new BNMediumLevelILLabel*[labels.size()];
 	size_t i = 0;
@@ -185,6 +195,7 @@ ExprId MediumLevelILFunction::AddLabelMap(const map<uint64_t, BNMediumLevelILLab
 
 ExprId MediumLevelILFunction::AddOperandList(const vector<ExprId> operands)
 {
+	ClearCaches();
 	uint64_t* operandList = new uint64_t[operands.size()];
 	for (size_t i = 0; i < operands.size(); i++)
 		operandList[i] = operands[i];
@@ -196,6 +207,7 @@ ExprId MediumLevelILFunction::AddOperandList(const vector<ExprId> operands)
 
 ExprId MediumLevelILFunction::AddIndexList(const vector<size_t>& operands)
 {
+	ClearCaches();
 	uint64_t* operandList = new uint64_t[operands.size()];
 	for (size_t i = 0; i < operands.size(); i++)
 		operandList[i] = operands[i];
@@ -207,6 +219,7 @@ ExprId MediumLevelILFunction::AddIndexList(const vector<size_t>& operands)
 
 ExprId MediumLevelILFunction::AddVariableList(const vector<Variable>& vars)
 {
+	ClearCaches();
 	uint64_t* operandList = new uint64_t[vars.size()];
 	for (size_t i = 0; i < vars.size(); i++)
 		operandList[i] = vars[i].ToIdentifier();
@@ -218,6 +231,7 @@ ExprId MediumLevelILFunction::AddVariableList(const vector<Variable>& vars)
 
 ExprId MediumLevelILFunction::AddSSAVariableList(const vector<SSAVariable>& vars)
 {
+	ClearCaches();
 	uint64_t* operandList = new uint64_t[vars.size() * 2];
 	for (size_t i = 0; i < vars.size(); i++)
 	{
@@ -232,6 +246,8 @@ ExprId MediumLevelILFunction::AddSSAVariableList(const vector<SSAVariable>& vars
 
 BNMediumLevelILInstruction MediumLevelILFunction::GetRawExpr(size_t i) const
 {
+	if (m_exprArena && i < m_exprArena->exprs.size())
+		return m_exprArena->exprs[i];
 	return BNGetMediumLevelILByIndex(m_object, i);
 }
 
@@ -255,62 +271,197 @@ MediumLevelILInstruction MediumLevelILFunction::GetExpr(size_t i)
 }
 
 
+size_t MediumLevelILFunction::GetInstructions(size_t start, size_t count, vector<MediumLevelILInstruction>& result)
+{
+	size_t total = GetInstructionCount();
+	if (start >= total)
+		return 0;
+	count = min(count, total - start);
+	result.reserve(result.size() + count);
+	for (size_t i = start; i < start + count; i++)
+	{
+		size_t expr = GetIndexForInstruction(i);
+		result.emplace_back(this, GetRawExpr(expr), expr, i);
+	}
+	return count;
+}
+
+
+size_t MediumLevelILFunction::GetExprs(size_t start, size_t count, vector<MediumLevelILInstruction>& result)
+{
+	size_t total = GetExprCount();
+	if (start >= total)
+		return 0;
+	count = min(count, total - start);
+	result.reserve(result.size() + count);
+	for (size_t i = start; i < start + count; i++)
+		result.emplace_back(this, GetRawExpr(i), i, GetInstructionForExpr(i));
+	return count;
+}
+
+
 size_t MediumLevelILFunction::GetIndexForInstruction(size_t i) const
 {
+	if (m_exprArena && i < m_exprArena->exprForInstruction.size())
+		return m_exprArena->exprForInstruction[i];
 	return BNGetMediumLevelILIndexForInstruction(m_object, i);
 }
 
 
 size_t MediumLevelILFunction::GetInstructionForExpr(size_t expr) const
 {
+	if (m_exprArena && expr < m_exprArena->instructionForExpr.size())
+		return m_exprArena->instructionForExpr[expr];
 	return BNGetMediumLevelILInstructionForExpr(m_object, expr);
 }
 
 
 size_t MediumLevelILFunction::GetInstructionCount() const
 {
+	if (m_exprArena)
+		return m_exprArena->exprForInstruction.size();
 	return BNGetMediumLevelILInstructionCount(m_object);
 }
 
 
 size_t MediumLevelILFunction::GetExprCount() const
 {
+	if (m_exprArena)
+		return m_exprArena->exprs.size();
 	return BNGetMediumLevelILExprCount(m_object);
 }
 
 
+shared_ptr<const MediumLevelILExprArena> MediumLevelILFunction::GetExprArena()
+{
+	if (m_exprArena)
+		return m_exprArena;
+
+	auto arena = make_shared<MediumLevelILExprArena>();
+	size_t exprCount = BNGetMediumLevelILExprCount(m_object);
+	arena->exprs.reserve(exprCount);
+	arena->instructionForExpr.reserve(exprCount);
+	for (size_t i = 0; i < exprCount; i++)
+	{
+		arena->exprs.push_back(BNGetMediumLevelILByIndex(m_object, i));
+		arena->instructionForExpr.push_back(BNGetMediumLevelILInstructionForExpr(m_object, i));
+	}
+
+	size_t instrCount = BNGetMediumLevelILInstructionCount(m_object);
+	arena->exprForInstruction.reserve(instrCount);
+	for (size_t i = 0; i < instrCount; i++)
+		arena->exprForInstruction.push_back(BNGetMediumLevelILIndexForInstruction(m_object, i));
+
+	m_exprArena = arena;
+	return m_exprArena;
+}
+
+
+void MediumLevelILFunction::ReleaseExprArena()
+{
+	m_exprArena.reset();
+}
+
+
+void MediumLevelILFunction::ClearCaches()
+{
+	m_exprArena.reset();
+	m_ssaVarDefUseTable.reset();
+	m_structuralHashes.reset();
+}
+
+
+// Operand types of MLIL, for ILStructuralHashTable::AppendInstruction
+struct MediumLevelILOperandKinds
+{
+	static constexpr MediumLevelILOperandType Integer = IntegerMediumLevelOperand;
+	static constexpr MediumLevelILOperandType ConstantData = ConstantDataMediumLevelOperand;
+	static constexpr MediumLevelILOperandType Index = IndexMediumLevelOperand;
+	static constexpr MediumLevelILOperandType Intrinsic = IntrinsicMediumLevelOperand;
+	static constexpr MediumLevelILOperandType Expr = ExprMediumLevelOperand;
+	static constexpr MediumLevelILOperandType Variable = VariableMediumLevelOperand;
+	static constexpr MediumLevelILOperandType SSAVariable = SSAVariableMediumLevelOperand;
+	static constexpr MediumLevelILOperandType IndexList = IndexListMediumLevelOperand;
+	static constexpr MediumLevelILOperandType SSAVariableList = SSAVariableListMediumLevelOperand;
+	static constexpr MediumLevelILOperandType ExprList = ExprListMediumLevelOperand;
+};
+
+
+// Operand types HLIL doesn't have, which AppendInstruction leaves to its caller
+static void AppendMediumLevelILOnlyOperand(
+    const MediumLevelILOperand& operand, vector<ILStructuralHashTable::Component>& out)
+{
+	switch (operand.GetType())
+	{
+	case IndexMapMediumLevelOperand:
+		for (auto i : operand.GetIndexMap())
+		{
+			out.push_back({false, i.first});
+			out.push_back({false, i.second});
+		}
+		break;
+	case VariableListMediumLevelOperand:
+		for (const Variable& var : operand.GetVariableList())
+			out.push_back({false, var.ToIdentifier()});
+		break;
+	default:
+		break;
+	}
+}
+
+
+shared_ptr<const ILStructuralHashTable> MediumLevelILFunction::GetStructuralHashes()
+{
+	if (m_structuralHashes)
+		return m_structuralHashes;
+
+	m_structuralHashes = ILStructuralHashTable::Build(
+	    GetExprCount(), [&](size_t expr, vector<ILStructuralHashTable::Component>& out) {
+		    ILStructuralHashTable::AppendInstruction<MediumLevelILOperandKinds>(
+		        GetExpr(expr), out, AppendMediumLevelILOnlyOperand);
+	    });
+	return m_structuralHashes;
+}
+
+
 void MediumLevelILFunction::UpdateInstructionOperand(size_t i, size_t operandIndex, ExprId value)
 {
+	ClearCaches();
 	BNUpdateMediumLevelILOperand(m_object, i, operandIndex, value);
 }
 
 
 void MediumLevelILFunction::MarkInstructionForRemoval(size_t i)
 {
+	ClearCaches();
 	BNMarkMediumLevelILInstructionForRemoval(m_object, i);
 }
 
 
 void MediumLevelILFunction::ReplaceInstruction(size_t i, ExprId expr)
 {
+	ClearCaches();
 	BNReplaceMediumLevelILInstruction(m_object, i, expr);
 }
 
 
 void MediumLevelILFunction::ReplaceExpr(size_t expr, size_t newExpr)
 {
+	ClearCaches();
 	BNReplaceMediumLevelILExpr(m_object, expr, newExpr);
 }
 
 
 void MediumLevelILFunction::SetExprAttributes(size_t expr, uint32_t attributes)
 {
+	ClearCaches();
 	BNSetMediumLevelILExprAttributes(m_object, expr, attributes);
 }
 
 
 void MediumLevelILFunction::Finalize()
 {
+	ClearCaches();
 	BNFinalizeMediumLevelILFunction(m_object);
 }
 
@@ -318,6 +469,7 @@ void MediumLevelILFunction::Finalize()
 void MediumLevelILFunction::GenerateSSAForm(bool analyzeConditionals, bool handleAliases,
     const set<Variable>& knownNotAliases, const set<Variable>& knownAliases)
 {
+	ClearCaches();
 	BNVariable* knownNotAlias = new BNVariable[knownNotAliases.size()];
 	BNVariable* knownAlias = new BNVariable[knownAliases.size()];
 
@@ -484,6 +636,53 @@ set<size_t> MediumLevelILFunction::GetSSAVarUses(const SSAVariable& var) const
 }
 
 
+shared_ptr<const MediumLevelILSSAVariableDefUseTable> MediumLevelILFunction::GetSSAVarDefUseTable()
+{
+	if (m_ssaVarDefUseTable)
+		return m_ssaVarDefUseTable;
+
+	auto table = make_shared<MediumLevelILSSAVariableDefUseTable>();
+	auto addVersions = [&](BNVariable* vars, size_t varCount) {
+		for (size_t i = 0; i < varCount; i++)
+		{
+			size_t versionCount;
+			size_t* versions = BNGetMediumLevelILVariableSSAVersions(m_object, &vars[i], &versionCount);
+			for (size_t j = 0; j < versionCount; j++)
+				table->variables.emplace_back(vars[i], versions[j]);
+			BNFreeILInstructionList(versions);
+		}
+		BNFreeVariableList(vars);
+	};
+
+	size_t varCount;
+	BNVariable* vars = BNGetMediumLevelILVariables(m_object, &varCount);
+	addVersions(vars, varCount);
+	vars = BNGetMediumLevelILAliasedVariables(m_object, &varCount);
+	addVersions(vars, varCount);
+	sort(table->variables.begin(), table->variables.end());
+	table->variables.erase(unique(table->variables.begin(), table->variables.end()), table->variables.end());
+
+	table->definitions.reserve(table->variables.size());
+	table->useOffsets.reserve(table->variables.size() + 1);
+	table->useOffsets.push_back(0);
+	for (const SSAVariable& var : table->variables)
+	{
+		table->definitions.push_back(BNGetMediumLevelILSSAVarDefinition(m_object, &var.var, var.version));
+
+		size_t count;
+		size_t* instrs = BNGetMediumLevelILSSAVarUses(m_object, &var.var, var.version, &count);
+		size_t first = table->uses.size();
+		table->uses.insert(table->uses.end(), instrs, instrs + count);
+		BNFreeILInstructionList(instrs);
+		sort(table->uses.begin() + first, table->uses.end());
+		table->useOffsets.push_back(table->uses.size());
+	}
+
+	m_ssaVarDefUseTable = table;
+	return m_ssaVarDefUseTable;
+}
+
+
 set<size_t> MediumLevelILFunction::GetSSAMemoryUses(size_t version) const
 {
 	size_t count;
@@ -876,6 +1075,7 @@ Confidence<Ref<Type>> MediumLevelILFunction::GetExprType(const MediumLevelILInst
 
 void MediumLevelILFunction::SetExprType(size_t expr, const Confidence<Ref<Type>>& type)
 {
+	ClearCaches();
 	BNTypeWithConfidence tc;
 	tc.type = type->GetObject();
 	tc.confidence = type.GetConfidence();
@@ -18,6 +18,7 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <algorithm>
 #include <cstring>
 #ifdef BINARYNINJACORE_LIBRARY
 	#include "mediumlevelilfunction.h"
@@ -1390,119 +1391,118 @@ void MediumLevelILInstructionBase::ClearAttribute(BNILInstructionAttribute attri
 }
 
 
-void MediumLevelILInstruction::VisitExprs(const std::function<bool(const MediumLevelILInstruction& expr)>& func) const
+void MediumLevelILInstruction::CollectSubExprs(vector<MediumLevelILInstruction>& toProcess) const
 {
-	if (!func(*this))
-		return;
+	size_t first = toProcess.size();
 	switch (operation)
 	{
 	case MLIL_SET_VAR:
-		GetSourceExpr<MLIL_SET_VAR>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<MLIL_SET_VAR>());
 		break;
 	case MLIL_SET_VAR_SSA:
-		GetSourceExpr<MLIL_SET_VAR_SSA>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<MLIL_SET_VAR_SSA>());
 		break;
 	case MLIL_SET_VAR_ALIASED:
-		GetSourceExpr<MLIL_SET_VAR_ALIASED>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<MLIL_SET_VAR_ALIASED>());
 		break;
 	case MLIL_SET_VAR_SPLIT:
-		GetSourceExpr<MLIL_SET_VAR_SPLIT>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<MLIL_SET_VAR_SPLIT>());
 		break;
 	case MLIL_SET_VAR_SPLIT_SSA:
-		GetSourceExpr<MLIL_SET_VAR_SPLIT_SSA>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<MLIL_SET_VAR_SPLIT_SSA>());
 		break;
 	case MLIL_SET_VAR_FIELD:
-		GetSourceExpr<MLIL_SET_VAR_FIELD>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<MLIL_SET_VAR_FIELD>());
 		break;
 	case MLIL_SET_VAR_SSA_FIELD:
-		GetSourceExpr<MLIL_SET_VAR_SSA_FIELD>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<MLIL_SET_VAR_SSA_FIELD>());
 		break;
 	case MLIL_SET_VAR_ALIASED_FIELD:
-		GetSourceExpr<MLIL_SET_VAR_ALIASED_FIELD>().VisitExprs(func);
+		toProcess.push_back(GetSourceExpr<MLIL_SET_VAR_ALIASED_FIELD>());
 		break;
 	case MLIL_CALL:
-		GetDestExpr<MLIL_CALL>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<MLIL_CALL>());
 		for (auto i : GetParameterExprs<MLIL_CALL>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case MLIL_CALL_UNTYPED:
-		GetDestExpr<MLIL_CALL_UNTYPED>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<MLIL_CALL_UNTYPED>());
 		for (auto i : GetParameterExprs<MLIL_CALL_UNTYPED>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case MLIL_CALL_SSA:
-		GetDestExpr<MLIL_CALL_SSA>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<MLIL_CALL_SSA>());
 		for (auto i : GetParameterExprs<MLIL_CALL_SSA>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case MLIL_CALL_UNTYPED_SSA:
-		GetDestExpr<MLIL_CALL_UNTYPED_SSA>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<MLIL_CALL_UNTYPED_SSA>());
 		for (auto i : GetParameterExprs<MLIL_CALL_UNTYPED_SSA>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case MLIL_SYSCALL:
 		for (auto i : GetParameterExprs<MLIL_SYSCALL>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case MLIL_SYSCALL_UNTYPED:
 		for (auto i : GetParameterExprs<MLIL_SYSCALL_UNTYPED>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case MLIL_SYSCALL_SSA:
 		for (auto i : GetParameterExprs<MLIL_SYSCALL_SSA>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case MLIL_SYSCALL_UNTYPED_SSA:
 		for (auto i : GetParameterExprs<MLIL_SYSCALL_UNTYPED_SSA>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case MLIL_TAILCALL:
-		GetDestExpr<MLIL_TAILCALL>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<MLIL_TAILCALL>());
 		for (auto i : GetParameterExprs<MLIL_TAILCALL>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case MLIL_TAILCALL_UNTYPED:
-		GetDestExpr<MLIL_TAILCALL_UNTYPED>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<MLIL_TAILCALL_UNTYPED>());
 		for (auto i : GetParameterExprs<MLIL_TAILCALL_UNTYPED>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case MLIL_TAILCALL_SSA:
-		GetDestExpr<MLIL_TAILCALL_SSA>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<MLIL_TAILCALL_SSA>());
 		for (auto i : GetParameterExprs<MLIL_TAILCALL_SSA>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case MLIL_TAILCALL_UNTYPED_SSA:
-		GetDestExpr<MLIL_TAILCALL_UNTYPED_SSA>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<MLIL_TAILCALL_UNTYPED_SSA>());
 		for (auto i : GetParameterExprs<MLIL_TAILCALL_UNTYPED_SSA>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case MLIL_SEPARATE_PARAM_LIST:
 		for (auto i : GetParameterExprs<MLIL_SEPARATE_PARAM_LIST>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case MLIL_SHARED_PARAM_SLOT:
 		for (auto i : GetParameterExprs<MLIL_SHARED_PARAM_SLOT>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case MLIL_RET:
 		for (auto i : GetSourceExprs<MLIL_RET>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case MLIL_STORE:
-		GetDestExpr<MLIL_STORE>().VisitExprs(func);
-		GetSourceExpr<MLIL_STORE>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<MLIL_STORE>());
+		toProcess.push_back(GetSourceExpr<MLIL_STORE>());
 		break;
 	case MLIL_STORE_STRUCT:
-		GetDestExpr<MLIL_STORE_STRUCT>().VisitExprs(func);
-		GetSourceExpr<MLIL_STORE_STRUCT>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<MLIL_STORE_STRUCT>());
+		toProcess.push_back(GetSourceExpr<MLIL_STORE_STRUCT>());
 		break;
 	case MLIL_STORE_SSA:
-		GetDestExpr<MLIL_STORE_SSA>().VisitExprs(func);
-		GetSourceExpr<MLIL_STORE_SSA>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<MLIL_STORE_SSA>());
+		toProcess.push_back(GetSourceExpr<MLIL_STORE_SSA>());
 		break;
 	case MLIL_STORE_STRUCT_SSA:
-		GetDestExpr<MLIL_STORE_STRUCT_SSA>().VisitExprs(func);
-		GetSourceExpr<MLIL_STORE_STRUCT_SSA>().VisitExprs(func);
+		toProcess.push_back(GetDestExpr<MLIL_STORE_STRUCT_SSA>());
+		toProcess.push_back(GetSourceExpr<MLIL_STORE_STRUCT_SSA>());
 		break;
 	case MLIL_NEG:
 	case MLIL_NOT:
@@ -1529,7 +1529,7 @@ void MediumLevelILInstruction::VisitExprs(const std::function<bool(const MediumL
 	case MLIL_FLOOR:
 	case MLIL_CEIL:
 	case MLIL_FTRUNC:
-		AsOneOperand().GetSourceExpr().VisitExprs(func);
+		toProcess.push_back(AsOneOperand().GetSourceExpr());
 		break;
 	case MLIL_ADD:
 	case MLIL_SUB:
@@ -1576,29 +1576,36 @@ void MediumLevelILInstruction::VisitExprs(const std::function<bool(const MediumL
 	case MLIL_FCMP_GT:
 	case MLIL_FCMP_O:
 	case MLIL_FCMP_UO:
-		AsTwoOperand().GetLeftExpr().VisitExprs(func);
-		AsTwoOperand().GetRightExpr().VisitExprs(func);
+		toProcess.push_back(AsTwoOperand().GetLeftExpr());
+		toProcess.push_back(AsTwoOperand().GetRightExpr());
 		break;
 	case MLIL_ADC:
 	case MLIL_SBB:
 	case MLIL_RLC:
 	case MLIL_RRC:
-		AsTwoOperandWithCarry().GetLeftExpr().VisitExprs(func);
-		AsTwoOperandWithCarry().GetRightExpr().VisitExprs(func);
-		AsTwoOperandWithCarry().GetCarryExpr().VisitExprs(func);
+		toProcess.push_back(AsTwoOperandWithCarry().GetLeftExpr());
+		toProcess.push_back(AsTwoOperandWithCarry().GetRightExpr());
+		toProcess.push_back(AsTwoOperandWithCarry().GetCarryExpr());
 		break;
 	case MLIL_INTRINSIC:
 		for (auto i : GetParameterExprs<MLIL_INTRINSIC>())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	case MLIL_INTRINSIC_SSA:
 	case MLIL_MEMORY_INTRINSIC_SSA:
 		for (auto i : GetParameterExprs())
-			i.VisitExprs(func);
+			toProcess.push_back(i);
 		break;
 	default:
 		break;
 	}
+	reverse(toProcess.begin() + first, toProcess.end());
+}
+
+
+void MediumLevelILInstruction::VisitExprs(const std::function<bool(const MediumLevelILInstruction& expr)>& func) const
+{
+	VisitExprs<const std::function<bool(const MediumLevelILInstruction& expr)>&>(func);
 }
 
 
@@ -570,8 +570,30 @@ namespace BinaryNinja
 		    MediumLevelILFunction* func, const BNMediumLevelILInstruction& instr, size_t expr, size_t instrIdx);
 		MediumLevelILInstruction(const MediumLevelILInstructionBase& instr);
 
+		/*! Append the direct subexpressions of this expression to \c toProcess in reverse operand order, so
+			popping from the back yields them in operand order
+		*/
+		void CollectSubExprs(_STD_VECTOR<MediumLevelILInstruction>& toProcess) const;
 		void VisitExprs(const std::function<bool(const MediumLevelILInstruction& expr)>& func) const;
 
+		/*! Visit this expression and its subexpressions in pre-order using an explicit stack. Subexpressions of
+			an expression are skipped when \c func returns false for it. The callable is invoked directly
+			rather than through \c std::function, so prefer this overload for whole-function traversals.
+		*/
+		template <typename Func>
+		void VisitExprs(Func&& func) const
+		{
+			_STD_VECTOR<MediumLevelILInstruction> toProcess;
+			toProcess.push_back(*this);
+			while (!toProcess.empty())
+			{
+				MediumLevelILInstruction cur = std::move(toProcess.back());
+				toProcess.pop_back();
+				if (func(static_cast<const MediumLevelILInstruction&>(cur)))
+					cur.CollectSubExprs(toProcess);
+			}
+		}
+
 		ExprId CopyTo(MediumLevelILFunction* dest) const;
 		ExprId CopyTo(MediumLevelILFunction* dest,
 		    const std::function<ExprId(const MediumLevelILInstruction& subExpr)>& subExprHandler) const;
@@ -40,40 +40,32 @@ Metadata::Metadata(MetadataType type)
 
 Metadata::Metadata(const vector<uint8_t>& data)
 {
-	auto input = new uint8_t[data.size()];
-	for (size_t i = 0; i < data.size(); i++)
-		input[i] = data[i];
-
-	m_object = BNCreateMetadataRawData(input, data.size());
-	delete[] input;
+	m_object = BNCreateMetadataRawData(data.data(), data.size());
 }
 
 Metadata::Metadata(const std::vector<Ref<Metadata>>& data)
 {
-	BNMetadata** dataList = new BNMetadata*[data.size()];
-	for (size_t i = 0; i < data.size(); i++)
-		dataList[i] = data[i]->m_object;
+	vector<BNMetadata*> dataList;
+	dataList.reserve(data.size());
+	for (auto& elm : data)
+		dataList.push_back(elm->m_object);
 
-	m_object = BNCreateMetadataArray(dataList, data.size());
-	delete[] dataList;
+	m_object = BNCreateMetadataArray(dataList.data(), dataList.size());
 }
 
 Metadata::Metadata(const std::map<std::string, Ref<Metadata>>& data)
 {
-	char** keys = new char*[data.size()];
-	BNMetadata** values = new BNMetadata*[data.size()];
-
-	size_t i = 0;
+	// The core copies the keys, so they can point straight into the map
+	vector<const char*> keys;
+	vector<BNMetadata*> values;
+	keys.reserve(data.size());
+	values.reserve(data.size());
 	for (auto& elm : data)
 	{
-		keys[i] = BNAllocString(elm.first.c_str());
-		values[i++] = elm.second->m_object;
+		keys.push_back(elm.first.c_str());
+		values.push_back(elm.second->m_object);
 	}
-	m_object = BNCreateMetadataValueStore((const char**)keys, values, data.size());
-	for (size_t j = 0; j < data.size(); j++)
-		BNFreeString(keys[j]);
-	delete[] keys;
-	delete[] values;
+	m_object = BNCreateMetadataValueStore(keys.data(), values.data(), data.size());
 }
 
 Metadata::Metadata(const std::vector<bool>& data)
@@ -88,32 +80,17 @@ Metadata::Metadata(const std::vector<bool>& data)
 
 Metadata::Metadata(const std::vector<uint64_t>& data)
 {
-	auto* list = new uint64_t[data.size()];
-	for (size_t i = 0; i < data.size(); i++)
-		list[i] = data[i];
-
-	m_object = BNCreateMetadataUnsignedIntegerListData(list, data.size());
-	delete[] list;
+	m_object = BNCreateMetadataUnsignedIntegerListData(const_cast<uint64_t*>(data.data()), data.size());
 }
 
 Metadata::Metadata(const std::vector<int64_t>& data)
 {
-	auto* list = new int64_t[data.size()];
-	for (size_t i = 0; i < data.size(); i++)
-		list[i] = data[i];
-
-	m_object = BNCreateMetadataSignedIntegerListData(list, data.size());
-	delete[] list;
+	m_object = BNCreateMetadataSignedIntegerListData(const_cast<int64_t*>(data.data()), data.size());
 }
 
 Metadata::Metadata(const std::vector<double>& data)
 {
-	auto* list = new double[data.size()];
-	for (size_t i = 0; i < data.size(); i++)
-		list[i] = data[i];
-
-	m_object = BNCreateMetadataDoubleListData(list, data.size());
-	delete[] list;
+	m_object = BNCreateMetadataDoubleListData(const_cast<double*>(data.data()), data.size());
 }
 
 Metadata::Metadata(const std::vector<std::string>& data)
@@ -410,3 +387,388 @@ bool Metadata::IsKeyValueStore() const
 {
 	return BNMetadataIsKeyValueStore(m_object);
 }
+
+// Encoding used by MetadataBuilder, all integers little endian:
+//   header: "BNMD", version byte
+//   value: type byte, then
+//     boolean: one byte
+//     unsigned, signed, double: eight bytes
+//     string, raw: LEB128 length, bytes
+//     array: u32 item count, u32 size of the items, items
+//     key-value store: u32 entry count, u32 size of the entries, entries of LEB128 key length, key, value
+static const char MetadataBlobMagic[4] = {'B', 'N', 'M', 'D'};
+static const uint8_t MetadataBlobVersion = 1;
+static const size_t MetadataBlobHeaderSize = sizeof(MetadataBlobMagic) + 1;
+static const size_t MetadataContainerHeaderSize = 1 + 4 + 4;
+
+MetadataBuilder::MetadataBuilder()
+{
+	AppendBytes(MetadataBlobMagic, sizeof(MetadataBlobMagic));
+	m_data.push_back(MetadataBlobVersion);
+}
+
+void MetadataBuilder::BeginValue(MetadataType type)
+{
+	if (m_open.empty())
+	{
+		if (m_data.size() != MetadataBlobHeaderSize)
+			throw std::logic_error("MetadataBuilder holds a single root value");
+	}
+	else
+	{
+		OpenContainer& container = m_open.back();
+		if (container.type == KeyValueDataType)
+		{
+			if (!container.hasKey)
+				throw std::logic_error("MetadataBuilder value in a key-value store without a key");
+			container.hasKey = false;
+		}
+		container.count++;
+	}
+	m_data.push_back((uint8_t)type);
+}
+
+void MetadataBuilder::AppendInteger(uint64_t value, size_t size)
+{
+	for (size_t i = 0; i < size; i++)
+		m_data.push_back((uint8_t)(value >> (i * 8)));
+}
+
+void MetadataBuilder::AppendLength(uint64_t length)
+{
+	do
+	{
+		uint8_t byte = length & 0x7f;
+		length >>= 7;
+		m_data.push_back(length ? (byte | 0x80) : byte);
+	} while (length);
+}
+
+void MetadataBuilder::AppendBytes(const void* data, size_t len)
+{
+	m_data.insert(m_data.end(), (const uint8_t*)data, (const uint8_t*)data + len);
+}
+
+void MetadataBuilder::BeginContainer(MetadataType type)
+{
+	size_t header = m_data.size();
+	BeginValue(type);
+	// Count and size are filled in when the container is closed
+	AppendInteger(0, 8);
+	m_open.push_back({type, header, 0, false});
+}
+
+void MetadataBuilder::EndContainer(MetadataType type)
+{
+	if (m_open.empty() || m_open.back().type != type)
+		throw std::logic_error("MetadataBuilder container closed without being opened");
+	OpenContainer container = m_open.back();
+	if (container.hasKey)
+		throw std::logic_error("MetadataBuilder key-value store closed after a key without a value");
+	m_open.pop_back();
+
+	uint64_t size = m_data.size() - container.header - MetadataContainerHeaderSize;
+	if (size > UINT32_MAX)
+		throw std::length_error("MetadataBuilder container is larger than 4GB");
+	for (size_t i = 0; i < 4; i++)
+	{
+		m_data[container.header + 1 + i] = (uint8_t)(container.count >> (i * 8));
+		m_data[container.header + 5 + i] = (uint8_t)(size >> (i * 8));
+	}
+}
+
+MetadataBuilder& MetadataBuilder::Boolean(bool value)
+{
+	BeginValue(BooleanDataType);
+	m_data.push_back(value ? 1 : 0);
+	return *this;
+}
+
+MetadataBuilder& MetadataBuilder::String(std::string_view value)
+{
+	BeginValue(StringDataType);
+	AppendLength(value.size());
+	AppendBytes(value.data(), value.size());
+	return *this;
+}
+
+MetadataBuilder& MetadataBuilder::UnsignedInteger(uint64_t value)
+{
+	BeginValue(UnsignedIntegerDataType);
+	AppendInteger(value, 8);
+	return *this;
+}
+
+MetadataBuilder& MetadataBuilder::SignedInteger(int64_t value)
+{
+	BeginValue(SignedIntegerDataType);
+	AppendInteger((uint64_t)value, 8);
+	return *this;
+}
+
+MetadataBuilder& MetadataBuilder::Double(double value)
+{
+	BeginValue(DoubleDataType);
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	AppendInteger(bits, 8);
+	return *this;
+}
+
+MetadataBuilder& MetadataBuilder::Raw(const void* data, size_t len)
+{
+	BeginValue(RawDataType);
+	AppendLength(len);
+	AppendBytes(data, len);
+	return *this;
+}
+
+MetadataBuilder& MetadataBuilder::BeginArray()
+{
+	BeginContainer(ArrayDataType);
+	return *this;
+}
+
+MetadataBuilder& MetadataBuilder::EndArray()
+{
+	EndContainer(ArrayDataType);
+	return *this;
+}
+
+MetadataBuilder& MetadataBuilder::BeginKeyValueStore()
+{
+	BeginContainer(KeyValueDataType);
+	return *this;
+}
+
+MetadataBuilder& MetadataBuilder::Key(std::string_view key)
+{
+	if (m_open.empty() || m_open.back().type != KeyValueDataType || m_open.back().hasKey)
+		throw std::logic_error("MetadataBuilder key outside of a key-value store");
+	AppendLength(key.size());
+	AppendBytes(key.data(), key.size());
+	m_open.back().hasKey = true;
+	return *this;
+}
+
+MetadataBuilder& MetadataBuilder::EndKeyValueStore()
+{
+	EndContainer(KeyValueDataType);
+	return *this;
+}
+
+Ref<Metadata> MetadataBuilder::Finalize() const
+{
+	if (!m_open.empty())
+		throw std::logic_error("MetadataBuilder finalized with an open container");
+	return new Metadata(BNCreateMetadataRawData(m_data.data(), m_data.size()));
+}
+
+static uint64_t ReadBlobInteger(const uint8_t* data, size_t size)
+{
+	uint64_t value = 0;
+	for (size_t i = 0; i < size; i++)
+		value |= (uint64_t)data[i] << (i * 8);
+	return value;
+}
+
+// Read a LEB128 length at data and advance past it, false if it runs past end
+static bool ReadBlobLength(const uint8_t*& data, const uint8_t* end, uint64_t& length)
+{
+	length = 0;
+	for (size_t shift = 0; data < end && shift < 64; shift += 7)
+	{
+		uint8_t byte = *data++;
+		length |= (uint64_t)(byte & 0x7f) << shift;
+		if ((byte & 0x80) == 0)
+			return true;
+	}
+	return false;
+}
+
+// Encoded size of the value at data, 0 if it is malformed or runs past end
+static size_t GetBlobValueSize(const uint8_t* data, const uint8_t* end)
+{
+	if (data >= end)
+		return 0;
+	size_t available = end - data;
+	size_t size = 0;
+	switch ((MetadataType)data[0])
+	{
+	case BooleanDataType:
+		size = 2;
+		break;
+	case UnsignedIntegerDataType:
+	case SignedIntegerDataType:
+	case DoubleDataType:
+		size = 9;
+		break;
+	case StringDataType:
+	case RawDataType:
+	{
+		const uint8_t* bytes = data + 1;
+		uint64_t length;
+		if (!ReadBlobLength(bytes, end, length) || length > (uint64_t)(end - bytes))
+			return 0;
+		size = (bytes - data) + length;
+		break;
+	}
+	case ArrayDataType:
+	case KeyValueDataType:
+		if (available < MetadataContainerHeaderSize)
+			return 0;
+		size = MetadataContainerHeaderSize + ReadBlobInteger(data + 5, 4);
+		break;
+	default:
+		return 0;
+	}
+	return size <= available ? size : 0;
+}
+
+MetadataType MetadataBlobValue::GetType() const
+{
+	return m_data ? (MetadataType)m_data[0] : InvalidDataType;
+}
+
+bool MetadataBlobValue::GetBoolean() const
+{
+	return GetType() == BooleanDataType && m_data[1] != 0;
+}
+
+std::string_view MetadataBlobValue::GetString() const
+{
+	if (GetType() != StringDataType)
+		return {};
+	const uint8_t* bytes = m_data + 1;
+	uint64_t length;
+	ReadBlobLength(bytes, m_data + m_length, length);
+	return std::string_view((const char*)bytes, length);
+}
+
+uint64_t MetadataBlobValue::GetUnsignedInteger() const
+{
+	return GetType() == UnsignedIntegerDataType ? ReadBlobInteger(m_data + 1, 8) : 0;
+}
+
+int64_t MetadataBlobValue::GetSignedInteger() const
+{
+	return GetType() == SignedIntegerDataType ? (int64_t)ReadBlobInteger(m_data + 1, 8) : 0;
+}
+
+double MetadataBlobValue::GetDouble() const
+{
+	if (GetType() != DoubleDataType)
+		return 0;
+	uint64_t bits = ReadBlobInteger(m_data + 1, 8);
+	double value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+std::string_view MetadataBlobValue::GetRaw() const
+{
+	if (GetType() != RawDataType)
+		return {};
+	const uint8_t* bytes = m_data + 1;
+	uint64_t length;
+	ReadBlobLength(bytes, m_data + m_length, length);
+	return std::string_view((const char*)bytes, length);
+}
+
+bool MetadataBlobValue::GetContainer(MetadataType type, uint32_t& count, const uint8_t*& items,
+	const uint8_t*& end) const
+{
+	if (GetType() != type)
+		return false;
+	count = (uint32_t)ReadBlobInteger(m_data + 1, 4);
+	items = m_data + MetadataContainerHeaderSize;
+	end = m_data + m_length;
+	return true;
+}
+
+size_t MetadataBlobValue::GetSize() const
+{
+	if (GetType() != ArrayDataType && GetType() != KeyValueDataType)
+		return 0;
+	return (size_t)ReadBlobInteger(m_data + 1, 4);
+}
+
+void MetadataBlobValue::ForEach(const std::function<bool(const MetadataBlobValue&)>& func) const
+{
+	uint32_t count;
+	const uint8_t* item;
+	const uint8_t* end;
+	if (!GetContainer(ArrayDataType, count, item, end))
+		return;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		size_t size = GetBlobValueSize(item, end);
+		if (size == 0 || !func(MetadataBlobValue(item, size)))
+			return;
+		item += size;
+	}
+}
+
+void MetadataBlobValue::ForEach(const std::function<bool(std::string_view, const MetadataBlobValue&)>& func) const
+{
+	uint32_t count;
+	const uint8_t* entry;
+	const uint8_t* end;
+	if (!GetContainer(KeyValueDataType, count, entry, end))
+		return;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		uint64_t keyLength;
+		if (!ReadBlobLength(entry, end, keyLength) || keyLength > (uint64_t)(end - entry))
+			return;
+		std::string_view key((const char*)entry, keyLength);
+		entry += keyLength;
+
+		size_t size = GetBlobValueSize(entry, end);
+		if (size == 0 || !func(key, MetadataBlobValue(entry, size)))
+			return;
+		entry += size;
+	}
+}
+
+MetadataBlobValue MetadataBlobValue::Get(std::string_view key) const
+{
+	MetadataBlobValue result;
+	ForEach([&](std::string_view entryKey, const MetadataBlobValue& value) {
+		if (entryKey != key)
+			return true;
+		result = value;
+		return false;
+	});
+	return result;
+}
+
+MetadataBlob::MetadataBlob(Ref<Metadata> metadata)
+{
+	if (metadata && metadata->IsRaw())
+		m_data = BNMetadataGetRaw(metadata->GetObject(), &m_length);
+}
+
+MetadataBlob::~MetadataBlob()
+{
+	if (m_data)
+		BNFreeMetadataRaw(m_data);
+}
+
+bool MetadataBlob::IsValid() const
+{
+	return m_data && m_length > MetadataBlobHeaderSize
+		&& memcmp(m_data, MetadataBlobMagic, sizeof(MetadataBlobMagic)) == 0
+		&& m_data[sizeof(MetadataBlobMagic)] == MetadataBlobVersion;
+}
+
+MetadataBlobValue MetadataBlob::GetRoot() const
+{
+	if (!IsValid())
+		return {};
+	const uint8_t* root = m_data + MetadataBlobHeaderSize;
+	size_t size = GetBlobValueSize(root, m_data + m_length);
+	if (size == 0)
+		return {};
+	return MetadataBlobValue(root, size);
+}
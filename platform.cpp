@@ -365,39 +365,78 @@ Ref<CallingConvention> Platform::GetSystemCallConvention() const
 }
 
 
+static std::shared_mutex g_callingConventionCacheMutex;
+static unordered_map<BNPlatform*, std::shared_ptr<const PlatformCallingConventions>> g_callingConventionCache;
+
+
+static void InvalidateCallingConventionCache(BNPlatform* platform)
+{
+	std::unique_lock<std::shared_mutex> lock(g_callingConventionCacheMutex);
+	g_callingConventionCache.erase(platform);
+}
+
+
+std::shared_ptr<const PlatformCallingConventions> Platform::GetCachedCallingConventions() const
+{
+	{
+		std::shared_lock<std::shared_mutex> lock(g_callingConventionCacheMutex);
+		auto i = g_callingConventionCache.find(m_object);
+		if (i != g_callingConventionCache.end())
+			return i->second;
+	}
+
+	auto result = std::make_shared<PlatformCallingConventions>();
+	result->defaultCallingConvention = GetDefaultCallingConvention();
+	result->cdeclCallingConvention = GetCdeclCallingConvention();
+	result->stdcallCallingConvention = GetStdcallCallingConvention();
+	result->fastcallCallingConvention = GetFastcallCallingConvention();
+	result->systemCallConvention = GetSystemCallConvention();
+	result->callingConventions = GetCallingConventions();
+
+	std::unique_lock<std::shared_mutex> lock(g_callingConventionCacheMutex);
+	return g_callingConventionCache.try_emplace(m_object, std::move(result)).first->second;
+}
+
+
 void Platform::RegisterCallingConvention(CallingConvention* cc)
 {
 	BNRegisterPlatformCallingConvention(m_object, cc->GetObject());
+	InvalidateCallingConventionCache(m_object);
 }
 
 
 void Platform::RegisterDefaultCallingConvention(CallingConvention* cc)
 {
 	BNRegisterPlatformDefaultCallingConvention(m_object, cc->GetObject());
+	InvalidateCallingConventionCache(m_object);
 }
 
 
 void Platform::RegisterCdeclCallingConvention(CallingConvention* cc)
 {
 	BNRegisterPlatformCdeclCallingConvention(m_object, cc->GetObject());
+	InvalidateCallingConventionCache(m_object);
 }
 
 
 void Platform::RegisterStdcallCallingConvention(CallingConvention* cc)
 {
 	BNRegisterPlatformStdcallCallingConvention(m_object, cc->GetObject());
+	InvalidateCallingConventionCache(m_object);
 }
 
 
 void Platform::RegisterFastcallCallingConvention(CallingConvention* cc)
 {
 	BNRegisterPlatformFastcallCallingConvention(m_object, cc->GetObject());
+	InvalidateCallingConventionCache(m_object);
 }
 
 
 void Platform::SetSystemCallConvention(CallingConvention* cc)
 {
 	BNSetPlatformSystemCallConvention(m_object, cc ? cc->GetObject() : nullptr);
+	InvalidateCallingConventionCache(m_object);
 }
 
 
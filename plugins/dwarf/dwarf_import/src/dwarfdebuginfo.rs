@@ -14,6 +14,7 @@
 
 use crate::{
     helpers::{get_uid, resolve_specification, DieReference},
+    unwind::CfaOffsets,
     ReaderType,
 };
 
@@ -34,10 +35,18 @@ use binaryninja::confidence::Conf;
 use binaryninja::variable::{Variable, VariableSourceType};
 use indexmap::{map::Values, IndexMap};
 use log::{debug, error, warn};
-use std::{cmp::Ordering, collections::HashMap, hash::Hash};
+use std::{
+    cmp::Ordering,
+    collections::{HashMap, HashSet},
+    hash::Hash,
+    sync::{Arc, Mutex},
+};
 
 pub(crate) type TypeUID = usize;
 
+/// Name, width and member layout hash of a named structure definition, see [`DebugInfoBuilder::odr_definition`].
+pub(crate) type OdrKey = (String, u64, u64);
+
 /////////////////////////
 // FunctionInfoBuilder
 
@@ -201,7 +210,11 @@ pub(crate) struct DebugInfoBuilder {
     full_function_name_indices: HashMap<String, usize>,
     types: IndexMap<TypeUID, DebugType>,
     data_variables: HashMap<u64, (Option<String>, TypeUID)>,
-    range_data_offsets: iset::IntervalMap<u64, i64>,
+    range_data_offsets: Arc<CfaOffsets>,
+    // Named structure definitions of this builder and all of its fragments, see `odr_definition`
+    odr_index: Arc<Mutex<HashMap<OdrKey, TypeUID>>>,
+    // The definitions this builder parsed itself, a fragment that lost a race to another one drops its copy in `merge`
+    odr_definitions: Vec<(OdrKey, TypeUID)>,
 }
 
 impl DebugInfoBuilder {
@@ -212,12 +225,73 @@ impl DebugInfoBuilder {
             full_function_name_indices: HashMap::new(),
             types: IndexMap::new(),
             data_variables: HashMap::new(),
-            range_data_offsets: iset::IntervalMap::new(),
+            range_data_offsets: Arc::new(CfaOffsets::default()),
+            odr_index: Arc::new(Mutex::new(HashMap::new())),
+            odr_definitions: vec![],
         }
     }
 
-    pub(crate) fn set_range_data_offsets(&mut self, offsets: iset::IntervalMap<u64, i64>) {
-        self.range_data_offsets = offsets
+    pub(crate) fn set_range_data_offsets(&mut self, offsets: CfaOffsets) {
+        self.range_data_offsets = Arc::new(offsets)
+    }
+
+    /// An empty builder sharing this one's unwind info and structure definitions, for parsing some units on
+    /// another thread. Fold it back in with [`Self::merge`].
+    pub(crate) fn fragment(&self) -> Self {
+        Self {
+            range_data_offsets: self.range_data_offsets.clone(),
+            odr_index: self.odr_index.clone(),
+            ..Self::new()
+        }
+    }
+
+    /// Merge a fragment as if its units had been parsed by this builder after the ones already in it.
+    ///
+    /// Types this builder already has win, the same as a unit finding an already parsed type. Functions
+    /// are inserted again so that they combine with earlier declarations by name.
+    pub(crate) fn merge(&mut self, fragment: DebugInfoBuilder) {
+        // Units parsed at the same time can both define a structure, only the copy in the index is kept.
+        //  References to it go through the name
+        let mut duplicate_definitions = HashSet::new();
+        {
+            let odr_index = self.odr_index.lock().unwrap();
+            for (key, type_uid) in fragment.odr_definitions {
+                if odr_index.get(&key) == Some(&type_uid) {
+                    self.odr_definitions.push((key, type_uid));
+                } else {
+                    duplicate_definitions.insert(type_uid);
+                }
+            }
+        }
+
+        for (type_uid, debug_type) in fragment.types {
+            if !self.contains_type(type_uid) && !duplicate_definitions.contains(&type_uid) {
+                self.types.insert(type_uid, debug_type);
+            }
+        }
+
+        for function in fragment.functions {
+            let Some(fn_idx) = self.insert_function(
+                function.full_name,
+                function.raw_name,
+                function.return_type,
+                function.address,
+                &function.parameters,
+                function.variable_arguments,
+                function.use_cfa,
+            ) else {
+                continue;
+            };
+            self.functions[fn_idx]
+                .stack_variables
+                .extend(function.stack_variables);
+        }
+
+        let mut data_variables: Vec<_> = fragment.data_variables.into_iter().collect();
+        data_variables.sort_unstable_by_key(|(address, _)| *address);
+        for (address, (name, type_uid)) in data_variables {
+            self.add_data_variable(address, name, type_uid);
+        }
     }
 
     #[allow(clippy::too_many_arguments)]
@@ -361,6 +435,26 @@ impl DebugInfoBuilder {
         self.types.contains_key(&type_uid)
     }
 
+    /// The already parsed definition of the named structure with this name, width and member layout, if any.
+    ///
+    /// Every unit that uses a C++ class carries its own copy of the definition, and by the one definition
+    /// rule they are all the same type. Units after the first can refer to the existing definition by
+    /// name instead of parsing all of its members again and handing the core another copy to compare.
+    /// Different types that happen to share a name have different layouts, so they are still parsed.
+    /// The index is shared with every fragment, so this also finds definitions from units other threads parsed.
+    pub(crate) fn odr_definition(&self, key: &OdrKey) -> Option<TypeUID> {
+        self.odr_index.lock().unwrap().get(key).copied()
+    }
+
+    pub(crate) fn add_odr_definition(&mut self, key: OdrKey, type_uid: TypeUID) {
+        self.odr_index
+            .lock()
+            .unwrap()
+            .entry(key.clone())
+            .or_insert(type_uid);
+        self.odr_definitions.push((key, type_uid));
+    }
+
     pub(crate) fn add_stack_variable(
         &mut self,
         fn_idx: Option<usize>,
@@ -411,16 +505,16 @@ impl DebugInfoBuilder {
             .and_then(|block_ranges| {
                 block_ranges
                     .unsorted_iter()
-                    .find_map(|x| self.range_data_offsets.values_overlap(x.start).next())
+                    .find_map(|x| self.range_data_offsets.offset_at(x.start))
             })
             .or_else(|| {
                 // Try using the offset at the adjustment 4 bytes after the function start, in case the function starts with a stack adjustment
                 // TODO: This is a decent heuristic but not perfect, since further adjustments could still be made
-                self.range_data_offsets.values_overlap(func_addr + 4).next()
+                self.range_data_offsets.offset_at(func_addr + 4)
             })
             .or_else(|| {
                 // If all else fails, use the function start address
-                self.range_data_offsets.values_overlap(func_addr).next()
+                self.range_data_offsets.offset_at(func_addr)
             })
         else {
             // Unknown why, but this is happening with MachO + external dSYM
@@ -435,9 +529,7 @@ impl DebugInfoBuilder {
             offset + adjustment_at_variable_lifetime_start
         } else {
             // If it's using SP, we know the SP offset is <SP offset> + (<entry SP CFA offset> - <SP CFA offset>)
-            let Some(adjustment_at_entry) =
-                self.range_data_offsets.values_overlap(func_addr).next()
-            else {
+            let Some(adjustment_at_entry) = self.range_data_offsets.offset_at(func_addr) else {
                 // Unknown why, but this is happening with MachO + external dSYM
                 debug!("Refusing to add a local variable ({}@{}) to function at {} without a known CIE offset for function start.", name, offset, func_addr);
                 return;
@@ -501,8 +593,8 @@ impl DebugInfoBuilder {
                     continue;
                 };
 
-                let mut skip_adding_type = false;
-                if stored_debug_type.ty != debug_type.ty {
+                let mut skip_adding_type = stored_debug_type.ty == debug_type.ty;
+                if !skip_adding_type {
                     // We already stored a type with this name and it's a different type, deconflict the name and try again
                     let mut i = 1;
                     loop {
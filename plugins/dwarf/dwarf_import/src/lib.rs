@@ -17,13 +17,17 @@ mod dwarfdebuginfo;
 mod functions;
 mod helpers;
 mod types;
+mod unwind;
 
-use std::collections::HashMap;
+use std::sync::atomic::{AtomicBool, AtomicUsize, Ordering};
+use std::sync::Mutex;
+use std::time::Duration;
 
 use crate::dwarfdebuginfo::{DebugInfoBuilder, DebugInfoBuilderContext};
 use crate::functions::parse_function_entry;
 use crate::helpers::{get_attr_die, get_name, get_uid, DieReference};
 use crate::types::parse_variable;
+use crate::unwind::{eh_frame_hdr_index, CfaOffsets};
 
 use binaryninja::binary_view::BinaryViewBase;
 use binaryninja::{
@@ -38,13 +42,12 @@ use dwarfreader::{
 
 use functions::parse_lexical_block;
 use gimli::{
-    constants, CfaRule, DebuggingInformationEntry, Dwarf, DwarfFileType, Reader, Section,
-    SectionId, Unit, UnwindContext, UnwindSection,
+    constants, DebuggingInformationEntry, Dwarf, DwarfFileType, Reader, Section, SectionId, Unit,
 };
 
 use binaryninja::logger::Logger;
 use helpers::{get_build_id, load_debug_info_for_build_id};
-use log::{debug, error, warn};
+use log::{error, warn};
 
 trait ReaderType: Reader<Offset = usize> {}
 impl<T: Reader<Offset = usize>> ReaderType for T {}
@@ -365,13 +368,112 @@ fn parse_unit<R: ReaderType>(
     }
 }
 
-fn parse_unwind_section<R: Reader, U: UnwindSection<R>>(
-    view: &BinaryView,
-    unwind_section: U,
-) -> gimli::Result<iset::IntervalMap<u64, i64>>
-where
-    <U as UnwindSection<R>>::Offset: std::hash::Hash,
-{
+// Units are parsed on worker threads, each into its own fragment of the builder. The fragments are merged
+//  back in unit order (supplementary units first), so the result is the same as parsing them one by one
+fn parse_units<R: ReaderType + Send + Sync>(
+    dwarf: &Dwarf<R>,
+    debug_info_builder_context: &DebugInfoBuilderContext<R>,
+    debug_info_builder: &mut DebugInfoBuilder,
+    progress: &dyn Fn(usize, usize) -> Result<(), ()>,
+) {
+    let mut units: Vec<(&Dwarf<R>, &Unit<R>)> = vec![];
+    if let Some(sup_dwarf) = dwarf.sup() {
+        units.extend(
+            debug_info_builder_context
+                .sup_units()
+                .iter()
+                .map(|unit| (sup_dwarf, unit)),
+        );
+    }
+    units.extend(
+        debug_info_builder_context
+            .units()
+            .iter()
+            .map(|unit| (dwarf, unit)),
+    );
+    if units.is_empty() {
+        return;
+    }
+
+    let thread_count = std::thread::available_parallelism()
+        .map_or(1, |n| n.get())
+        .min(units.len());
+    let template = debug_info_builder.fragment();
+    let next_unit = AtomicUsize::new(0);
+    let parsed_die_count = AtomicUsize::new(0);
+    let finished_thread_count = AtomicUsize::new(0);
+    let cancelled = AtomicBool::new(false);
+    let fragments: Mutex<Vec<Option<DebugInfoBuilder>>> =
+        Mutex::new((0..units.len()).map(|_| None).collect());
+
+    std::thread::scope(|scope| {
+        for _ in 0..thread_count {
+            scope.spawn(|| {
+                // The real progress callback may only be called from the parsing thread, so workers just count
+                let die_progress = |_: usize, _: usize| {
+                    parsed_die_count.fetch_add(1, Ordering::Relaxed);
+                    if cancelled.load(Ordering::Relaxed) {
+                        Err(())
+                    } else {
+                        Ok(())
+                    }
+                };
+                loop {
+                    let unit_index = next_unit.fetch_add(1, Ordering::Relaxed);
+                    if unit_index >= units.len() || cancelled.load(Ordering::Relaxed) {
+                        break;
+                    }
+                    let (unit_dwarf, unit) = units[unit_index];
+                    let mut fragment = template.fragment();
+                    let mut unit_die_number = 0;
+                    parse_unit(
+                        unit_dwarf,
+                        unit,
+                        debug_info_builder_context,
+                        &mut fragment,
+                        &die_progress,
+                        &mut unit_die_number,
+                    );
+                    fragments.lock().unwrap()[unit_index] = Some(fragment);
+                }
+                finished_thread_count.fetch_add(1, Ordering::Release);
+            });
+        }
+
+        let mut next_merge = 0;
+        loop {
+            // Checked before draining so the last fragments are still merged after the workers finish
+            let finished = finished_thread_count.load(Ordering::Acquire) == thread_count;
+
+            let mut ready = vec![];
+            {
+                let mut fragments = fragments.lock().unwrap();
+                while let Some(fragment) = fragments.get_mut(next_merge).and_then(Option::take) {
+                    ready.push(fragment);
+                    next_merge += 1;
+                }
+            }
+            for fragment in ready {
+                debug_info_builder.merge(fragment);
+            }
+
+            if progress(
+                parsed_die_count.load(Ordering::Relaxed),
+                debug_info_builder_context.total_die_count,
+            )
+            .is_err()
+            {
+                cancelled.store(true, Ordering::Relaxed);
+            }
+            if finished {
+                break;
+            }
+            std::thread::sleep(Duration::from_millis(20));
+        }
+    });
+}
+
+fn unwind_bases(view: &BinaryView) -> gimli::BaseAddresses {
     let mut bases = gimli::BaseAddresses::default();
 
     if let Some(section) = view
@@ -407,73 +509,7 @@ where
         bases = bases.set_got(section.start());
     }
 
-    let mut cies = HashMap::new();
-    let mut cfa_offsets = iset::IntervalMap::new();
-
-    let mut entries = unwind_section.entries(&bases);
-    let mut unwind_context = UnwindContext::new();
-    loop {
-        match entries.next()? {
-            None => return Ok(cfa_offsets),
-            Some(gimli::CieOrFde::Cie(_cie)) => {
-                // TODO: do we want to do anything with standalone CIEs?
-            }
-            Some(gimli::CieOrFde::Fde(partial)) => {
-                let fde = match partial.parse(|_, bases, o| {
-                    cies.entry(o)
-                        .or_insert_with(|| unwind_section.cie_from_offset(bases, o))
-                        .clone()
-                }) {
-                    Ok(fde) => fde,
-                    Err(e) => {
-                        error!("Failed to parse FDE: {}", e);
-                        continue;
-                    }
-                };
-
-                if fde.len() == 0 {
-                    // This FDE is a terminator
-                    return Ok(cfa_offsets);
-                }
-
-                if fde.initial_address().overflowing_add(fde.len()).1 {
-                    warn!(
-                        "FDE at offset {:?} exceeds bounds of memory space! {:#x} + length {:#x}",
-                        fde.offset(),
-                        fde.initial_address(),
-                        fde.len()
-                    );
-                } else {
-                    // Walk the FDE table rows and store their CFA
-                    let mut fde_table = fde.rows(&unwind_section, &bases, &mut unwind_context)?;
-
-                    while let Some(row) = fde_table.next_row()? {
-                        match row.cfa() {
-                            CfaRule::RegisterAndOffset {
-                                register: _,
-                                offset,
-                            } => {
-                                // TODO: we should store offsets by register
-                                if row.start_address() < row.end_address() {
-                                    cfa_offsets
-                                        .insert(row.start_address()..row.end_address(), *offset);
-                                } else {
-                                    debug!(
-                                        "Invalid FDE table row addresses: {:#x}..{:#x}",
-                                        row.start_address(),
-                                        row.end_address()
-                                    );
-                                }
-                            }
-                            CfaRule::Expression(_) => {
-                                debug!("Unhandled CFA expression when determining offset");
-                            }
-                        };
-                    }
-                }
-            }
-        }
-    }
+    bases
 }
 
 fn get_supplementary_build_id(bv: &BinaryView) -> Option<String> {
@@ -554,9 +590,19 @@ fn parse_dwarf(
         let eh_frame_section_reader = |section_id: SectionId| -> _ {
             create_section_reader(section_id, view, eh_frame_endian, dwo_file)
         };
-        let mut eh_frame = gimli::EhFrame::load(eh_frame_section_reader).unwrap();
+        let mut eh_frame = gimli::EhFrame::load(&eh_frame_section_reader).unwrap();
         eh_frame.set_address_size(view.address_size() as u8);
-        range_data_offsets = parse_unwind_section(view, eh_frame)
+        let bases = unwind_bases(view);
+        let hdr_index = if view.section_by_name(".eh_frame_hdr").is_some()
+            || view.section_by_name("__eh_frame_hdr").is_some()
+        {
+            gimli::EhFrameHdr::load(&eh_frame_section_reader)
+                .ok()
+                .and_then(|hdr| eh_frame_hdr_index(&hdr, &bases, view.address_size() as u8))
+        } else {
+            None
+        };
+        range_data_offsets = CfaOffsets::new(eh_frame, bases, hdr_index)
             .map_err(|e| error!("Error parsing .eh_frame: {}", e))?;
     } else if view.section_by_name(".debug_frame").is_some()
         || view.section_by_name("__debug_frame").is_some()
@@ -567,7 +613,7 @@ fn parse_dwarf(
         };
         let mut debug_frame = gimli::DebugFrame::load(debug_frame_section_reader).unwrap();
         debug_frame.set_address_size(view.address_size() as u8);
-        range_data_offsets = parse_unwind_section(view, debug_frame)
+        range_data_offsets = CfaOffsets::new(debug_frame, unwind_bases(view), None)
             .map_err(|e| error!("Error parsing .debug_frame: {}", e))?;
     } else {
         range_data_offsets = Default::default();
@@ -594,29 +640,12 @@ fn parse_dwarf(
         }
 
         // Parse all the compilation units
-        let mut current_die_number = 0;
-
-        for unit in debug_info_builder_context.sup_units() {
-            parse_unit(
-                dwarf.sup().unwrap(),
-                unit,
-                &debug_info_builder_context,
-                &mut debug_info_builder,
-                &parse_progress,
-                &mut current_die_number,
-            );
-        }
-
-        for unit in debug_info_builder_context.units() {
-            parse_unit(
-                &dwarf,
-                unit,
-                &debug_info_builder_context,
-                &mut debug_info_builder,
-                &parse_progress,
-                &mut current_die_number,
-            );
-        }
+        parse_units(
+            &dwarf,
+            &debug_info_builder_context,
+            &mut debug_info_builder,
+            &parse_progress,
+        );
     }
 
     Ok(debug_info_builder)
@@ -755,3 +784,97 @@ pub extern "C" fn CorePluginInit() -> bool {
     DebugInfoParser::register("DWARF", DWARFParser {});
     true
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use binaryninja::file_metadata::FileMetadata;
+    use binaryninja::headless::Session;
+    use gimli::write::{self, EndianVec, LineProgram, Sections};
+    use gimli::{Encoding, EndianArcSlice, Format, RunTimeEndian};
+    use std::sync::Arc;
+
+    // Two units that each carry the definition of `struct point`, as every unit including its header would
+    fn two_unit_dwarf() -> Dwarf<EndianArcSlice<RunTimeEndian>> {
+        let encoding = Encoding {
+            format: Format::Dwarf32,
+            version: 4,
+            address_size: 8,
+        };
+        let mut dwarf = write::Dwarf::new();
+        for _ in 0..2 {
+            let unit_id = dwarf
+                .units
+                .add(write::Unit::new(encoding, LineProgram::none()));
+            let unit = dwarf.units.get_mut(unit_id);
+            let root = unit.root();
+
+            let int_id = unit.add(root, constants::DW_TAG_base_type);
+            let int = unit.get_mut(int_id);
+            int.set(
+                constants::DW_AT_name,
+                write::AttributeValue::String(b"int".to_vec()),
+            );
+            int.set(constants::DW_AT_byte_size, write::AttributeValue::Udata(4));
+            int.set(
+                constants::DW_AT_encoding,
+                write::AttributeValue::Encoding(constants::DW_ATE_signed),
+            );
+
+            let point_id = unit.add(root, constants::DW_TAG_structure_type);
+            let point = unit.get_mut(point_id);
+            point.set(
+                constants::DW_AT_name,
+                write::AttributeValue::String(b"point".to_vec()),
+            );
+            point.set(constants::DW_AT_byte_size, write::AttributeValue::Udata(8));
+            for (name, offset) in [("x", 0), ("y", 4)] {
+                let member_id = unit.add(point_id, constants::DW_TAG_member);
+                let member = unit.get_mut(member_id);
+                member.set(
+                    constants::DW_AT_name,
+                    write::AttributeValue::String(name.as_bytes().to_vec()),
+                );
+                member.set(
+                    constants::DW_AT_type,
+                    write::AttributeValue::UnitRef(int_id),
+                );
+                member.set(
+                    constants::DW_AT_data_member_location,
+                    write::AttributeValue::Udata(offset),
+                );
+            }
+        }
+
+        let mut sections = Sections::new(EndianVec::new(RunTimeEndian::Little));
+        dwarf.write(&mut sections).expect("Failed to write DWARF");
+        Dwarf::load(|id| -> Result<_, gimli::Error> {
+            let data = sections.get(id).map_or(&[][..], |section| section.slice());
+            Ok(EndianArcSlice::new(Arc::from(data), RunTimeEndian::Little))
+        })
+        .expect("Failed to load DWARF")
+    }
+
+    #[test]
+    fn test_structure_defined_in_two_units() {
+        let _session = Session::new().expect("Failed to initialize session");
+        let view =
+            BinaryView::from_data(&FileMetadata::new(), &[0; 16]).expect("Failed to create view");
+        let dwarf = two_unit_dwarf();
+        let mut context =
+            DebugInfoBuilderContext::new(&view, &dwarf).expect("Failed to read units");
+        calculate_total_unit_bytes(&dwarf, &mut context);
+        let no_progress = |_: usize, _: usize| -> Result<(), ()> { Ok(()) };
+        assert!(recover_names(&dwarf, &mut context, &no_progress));
+
+        let mut debug_info_builder = DebugInfoBuilder::new();
+        parse_units(&dwarf, &context, &mut debug_info_builder, &no_progress);
+
+        // The second unit either skipped the members or its copy was dropped when merging
+        let definitions = debug_info_builder
+            .types()
+            .filter(|debug_type| debug_type.commit && debug_type.name == "point")
+            .count();
+        assert_eq!(definitions, 1);
+    }
+}
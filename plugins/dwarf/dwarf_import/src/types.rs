@@ -27,6 +27,8 @@ use gimli::{constants, AttributeValue, DebuggingInformationEntry, Dwarf, Operati
 
 use log::{debug, error, warn};
 
+use std::hash::{DefaultHasher, Hash, Hasher};
+
 pub(crate) fn parse_variable<R: ReaderType>(
     dwarf: &Dwarf<R>,
     unit: &Unit<R>,
@@ -92,6 +94,72 @@ pub(crate) fn parse_variable<R: ReaderType>(
     }
 }
 
+// Hash of the members of a structure DIE, so that definitions can be compared across units before parsing them.
+//  Member types are hashed by name, or by tag and size through unnamed modifiers, as their offsets differ per unit
+fn member_layout_hash<R: ReaderType>(
+    dwarf: &Dwarf<R>,
+    unit: &Unit<R>,
+    entry: &DebuggingInformationEntry<R>,
+    debug_info_builder_context: &DebugInfoBuilderContext<R>,
+) -> u64 {
+    let mut hasher = DefaultHasher::new();
+    let Ok(mut tree) = unit.entries_tree(Some(entry.offset())) else {
+        return hasher.finish();
+    };
+    let Ok(root) = tree.root() else {
+        return hasher.finish();
+    };
+    let mut children = root.children();
+    while let Ok(Some(child)) = children.next() {
+        let member = child.entry();
+        if member.tag() != constants::DW_TAG_member {
+            continue;
+        }
+        debug_info_builder_context
+            .get_name(dwarf, unit, member)
+            .hash(&mut hasher);
+        if let Ok(Some(location)) = member.attr(constants::DW_AT_data_member_location) {
+            get_attr_as_u64(&location)
+                .or_else(|| get_expr_value(unit, location))
+                .hash(&mut hasher);
+        }
+        get_size_as_u64(member).hash(&mut hasher);
+
+        let mut type_die = get_attr_die(
+            dwarf,
+            unit,
+            member,
+            debug_info_builder_context,
+            constants::DW_AT_type,
+        );
+        for _ in 0..8 {
+            let Some(DieReference::UnitAndOffset((type_dwarf, type_unit, type_offset))) = type_die
+            else {
+                break;
+            };
+            let Ok(type_entry) = type_unit.entry(type_offset) else {
+                break;
+            };
+            type_entry.tag().0.hash(&mut hasher);
+            get_size_as_u64(&type_entry).hash(&mut hasher);
+            if let Some(type_name) =
+                debug_info_builder_context.get_name(type_dwarf, type_unit, &type_entry)
+            {
+                type_name.hash(&mut hasher);
+                break;
+            }
+            type_die = get_attr_die(
+                type_dwarf,
+                type_unit,
+                &type_entry,
+                debug_info_builder_context,
+                constants::DW_AT_type,
+            );
+        }
+    }
+    hasher.finish()
+}
+
 fn do_structure_parse<R: ReaderType>(
     dwarf: &Dwarf<R>,
     structure_type: StructureType,
@@ -151,6 +219,16 @@ fn do_structure_parse<R: ReaderType>(
         .width(size)
         .structure_type(structure_type);
 
+    // Definitions that share a name but not a layout are kept apart, and committed under deconflicted names
+    let odr_key = match &full_name {
+        Some(full_name) if size != 0 => Some((
+            full_name.to_owned(),
+            size,
+            member_layout_hash(dwarf, unit, entry, debug_info_builder_context),
+        )),
+        _ => None,
+    };
+
     // This reference type will be used by any children to grab while we're still building this type
     //  it will also be how any other types refer to this struct
     if let Some(full_name) = &full_name {
@@ -162,6 +240,14 @@ fn do_structure_parse<R: ReaderType>(
             ntr,
             false,
         );
+
+        // Another unit already defined this type, the reference by name is all this one needs
+        if odr_key
+            .as_ref()
+            .is_some_and(|key| debug_info_builder.odr_definition(key).is_some())
+        {
+            return Some(get_uid(dwarf, unit, entry));
+        }
     } else {
         // We _need_ to have initial typedefs or else we can enter infinite parsing loops
         // These get overwritten in the last step with the actual type, however, so this
@@ -231,12 +317,11 @@ fn do_structure_parse<R: ReaderType>(
 
     let finalized_structure = Type::structure(&structure_builder.finalize());
     if let Some(full_name) = full_name {
-        debug_info_builder.add_type(
-            get_uid(dwarf, unit, entry) + 1, // TODO : This is super broke (uid + 1 is not guaranteed to be unique)
-            full_name,
-            finalized_structure,
-            true,
-        );
+        let definition_uid = get_uid(dwarf, unit, entry) + 1; // TODO : This is super broke (uid + 1 is not guaranteed to be unique)
+        if let Some(odr_key) = odr_key {
+            debug_info_builder.add_odr_definition(odr_key, definition_uid);
+        }
+        debug_info_builder.add_type(definition_uid, full_name, finalized_structure, true);
     } else {
         debug_info_builder.add_type(
             get_uid(dwarf, unit, entry),
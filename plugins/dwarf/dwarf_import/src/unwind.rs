@@ -0,0 +1,232 @@
+// Copyright 2021-2024 Vector 35 Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+use std::collections::HashMap;
+use std::sync::OnceLock;
+
+use gimli::{BaseAddresses, CfaRule, EhFrameHdr, Reader, UnwindContext, UnwindSection};
+use log::{debug, error, warn};
+
+/// Rows of one FDE as (start, end, CFA offset), in address order
+type FdeRows = Vec<(u64, u64, i64)>;
+
+type DecodeFde = dyn Fn(usize) -> Option<(u64, FdeRows)> + Send + Sync;
+
+/// CFA offsets from an unwind section, looked up by address.
+///
+/// Only the address and offset of every FDE are read up front. A FDE's rows are decoded the first time an
+/// address inside it is looked up, which is only done for functions that have stack variables, so binaries
+/// with hundreds of thousands of FDEs don't pay for walking and storing all of their rows.
+#[derive(Default)]
+pub(crate) struct CfaOffsets {
+    /// (initial address, section offset) of every FDE, sorted by address
+    fdes: Vec<(u64, usize)>,
+    /// (end address, rows) of the FDE with the same index, once decoded
+    rows: Vec<OnceLock<Option<(u64, FdeRows)>>>,
+    decode: Option<Box<DecodeFde>>,
+}
+
+impl CfaOffsets {
+    /// Index the FDEs in `unwind_section`, using `hdr_index` instead of walking the section when given.
+    pub(crate) fn new<R, U>(
+        unwind_section: U,
+        bases: BaseAddresses,
+        hdr_index: Option<Vec<(u64, usize)>>,
+    ) -> gimli::Result<Self>
+    where
+        R: Reader<Offset = usize> + Send + Sync + 'static,
+        U: UnwindSection<R> + Send + Sync + 'static,
+        <U as UnwindSection<R>>::Offset: std::hash::Hash,
+    {
+        let mut fdes = match hdr_index {
+            Some(fdes) => fdes,
+            None => index_fdes(&unwind_section, &bases)?,
+        };
+        fdes.sort_unstable();
+        fdes.dedup_by_key(|(start, _)| *start);
+
+        let rows = (0..fdes.len()).map(|_| OnceLock::new()).collect();
+        let decode = move |offset: usize| decode_fde(&unwind_section, &bases, offset);
+        Ok(Self {
+            fdes,
+            rows,
+            decode: Some(Box::new(decode)),
+        })
+    }
+
+    /// The CFA offset in effect at `address`, if it is covered by an FDE.
+    pub(crate) fn offset_at(&self, address: u64) -> Option<i64> {
+        let decode = self.decode.as_ref()?;
+        let index = self
+            .fdes
+            .partition_point(|(start, _)| *start <= address)
+            .checked_sub(1)?;
+        let (end, rows) = self.rows[index]
+            .get_or_init(|| decode(self.fdes[index].1))
+            .as_ref()?;
+        if address >= *end {
+            return None;
+        }
+
+        let row = rows
+            .partition_point(|(start, _, _)| *start <= address)
+            .checked_sub(1)?;
+        let (_, row_end, offset) = rows[row];
+        (address < row_end).then_some(offset)
+    }
+}
+
+/// The FDEs listed in the binary search table of `.eh_frame_hdr`, if it has one.
+pub(crate) fn eh_frame_hdr_index<R: Reader<Offset = usize>>(
+    eh_frame_hdr: &EhFrameHdr<R>,
+    bases: &BaseAddresses,
+    address_size: u8,
+) -> Option<Vec<(u64, usize)>> {
+    let parsed = eh_frame_hdr
+        .parse(bases, address_size)
+        .map_err(|e| debug!("Failed to parse .eh_frame_hdr: {}", e))
+        .ok()?;
+    let table = parsed.table()?;
+
+    let mut fdes = Vec::new();
+    let mut entries = table.iter(bases);
+    loop {
+        match entries.next() {
+            Ok(Some((initial_address, fde))) => {
+                let (Ok(initial_address), Ok(offset)) =
+                    (initial_address.direct(), table.pointer_to_offset(fde))
+                else {
+                    // Indirect pointers would need memory reads, walk the section instead
+                    return None;
+                };
+                fdes.push((initial_address, offset.0));
+            }
+            Ok(None) => return Some(fdes),
+            Err(e) => {
+                debug!("Failed to read .eh_frame_hdr table: {}", e);
+                return None;
+            }
+        }
+    }
+}
+
+/// Walk every entry of the section, parsing only the FDE headers.
+fn index_fdes<R, U>(unwind_section: &U, bases: &BaseAddresses) -> gimli::Result<Vec<(u64, usize)>>
+where
+    R: Reader<Offset = usize>,
+    U: UnwindSection<R>,
+    <U as UnwindSection<R>>::Offset: std::hash::Hash,
+{
+    let mut cies = HashMap::new();
+    let mut fdes = Vec::new();
+
+    let mut entries = unwind_section.entries(bases);
+    loop {
+        match entries.next()? {
+            None => return Ok(fdes),
+            Some(gimli::CieOrFde::Cie(_cie)) => {
+                // TODO: do we want to do anything with standalone CIEs?
+            }
+            Some(gimli::CieOrFde::Fde(partial)) => {
+                let fde = match partial.parse(|_, bases, o| {
+                    cies.entry(o)
+                        .or_insert_with(|| unwind_section.cie_from_offset(bases, o))
+                        .clone()
+                }) {
+                    Ok(fde) => fde,
+                    Err(e) => {
+                        error!("Failed to parse FDE: {}", e);
+                        continue;
+                    }
+                };
+
+                if fde.len() == 0 {
+                    // This FDE is a terminator
+                    return Ok(fdes);
+                }
+
+                if fde.initial_address().overflowing_add(fde.len()).1 {
+                    warn!(
+                        "FDE at offset {:?} exceeds bounds of memory space! {:#x} + length {:#x}",
+                        fde.offset(),
+                        fde.initial_address(),
+                        fde.len()
+                    );
+                } else {
+                    fdes.push((fde.initial_address(), fde.offset()));
+                }
+            }
+        }
+    }
+}
+
+/// Walk the table rows of the FDE at `offset` and collect their CFA.
+fn decode_fde<R, U>(
+    unwind_section: &U,
+    bases: &BaseAddresses,
+    offset: usize,
+) -> Option<(u64, FdeRows)>
+where
+    R: Reader<Offset = usize>,
+    U: UnwindSection<R>,
+{
+    let fde = unwind_section
+        .fde_from_offset(bases, U::Offset::from(offset), |section, bases, o| {
+            section.cie_from_offset(bases, o)
+        })
+        .map_err(|e| error!("Failed to parse FDE: {}", e))
+        .ok()?;
+    if fde.initial_address().overflowing_add(fde.len()).1 {
+        return None;
+    }
+
+    let mut rows = Vec::new();
+    let mut unwind_context = UnwindContext::new();
+    let mut fde_table = fde
+        .rows(unwind_section, bases, &mut unwind_context)
+        .map_err(|e| error!("Failed to parse FDE rows: {}", e))
+        .ok()?;
+    loop {
+        let row = match fde_table.next_row() {
+            Ok(Some(row)) => row,
+            Ok(None) => break,
+            Err(e) => {
+                error!("Failed to parse FDE rows: {}", e);
+                break;
+            }
+        };
+        match row.cfa() {
+            CfaRule::RegisterAndOffset {
+                register: _,
+                offset,
+            } => {
+                // TODO: we should store offsets by register
+                if row.start_address() < row.end_address() {
+                    rows.push((row.start_address(), row.end_address(), *offset));
+                } else {
+                    debug!(
+                        "Invalid FDE table row addresses: {:#x}..{:#x}",
+                        row.start_address(),
+                        row.end_address()
+                    );
+                }
+            }
+            CfaRule::Expression(_) => {
+                debug!("Unhandled CFA expression when determining offset");
+            }
+        };
+    }
+
+    Some((fde.end_address(), rows))
+}
@@ -12,7 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-use gimli::{EndianRcSlice, Endianity, RunTimeEndian, SectionId};
+use gimli::{EndianArcSlice, Endianity, RunTimeEndian, SectionId};
 
 use binaryninja::{
     binary_view::{BinaryView, BinaryViewBase, BinaryViewExt},
@@ -21,7 +21,7 @@ use binaryninja::{
 };
 
 use binaryninja::settings::QueryOptions;
-use std::rc::Rc;
+use std::sync::Arc;
 //////////////////////
 // Dwarf Validation
 
@@ -94,7 +94,7 @@ pub fn create_section_reader<'a, Endian: 'a + Endianity>(
     view: &'a BinaryView,
     endian: Endian,
     dwo_file: bool,
-) -> Result<EndianRcSlice<Endian>, Error> {
+) -> Result<EndianArcSlice<Endian>, Error> {
     let section_name = if dwo_file && section_id.dwo_name().is_some() {
         section_id.dwo_name().unwrap()
     } else {
@@ -147,13 +147,13 @@ pub fn create_section_reader<'a, Endian: 'a + Endianity>(
                         if let Ok(buffer) = view.read_buffer(offset, len) {
                             match ch_type {
                                 1 => {
-                                    return Ok(EndianRcSlice::new(
+                                    return Ok(EndianArcSlice::new(
                                         buffer.zlib_decompress().get_data().into(),
                                         endian,
                                     ));
                                 }
                                 2 => {
-                                    return Ok(EndianRcSlice::new(
+                                    return Ok(EndianArcSlice::new(
                                         zstd::decode_all(buffer.get_data())?.as_slice().into(),
                                         endian,
                                     ));
@@ -170,19 +170,19 @@ pub fn create_section_reader<'a, Endian: 'a + Endianity>(
         let offset = section.start();
         let len = section.len();
         if len == 0 {
-            Ok(EndianRcSlice::new(Rc::from([]), endian))
+            Ok(EndianArcSlice::new(Arc::from([]), endian))
         } else {
-            Ok(EndianRcSlice::new(
-                Rc::from(view.read_vec(offset, len).as_slice()),
+            Ok(EndianArcSlice::new(
+                Arc::from(view.read_vec(offset, len).as_slice()),
                 endian,
             ))
         }
     } else if let Some(section) = view.section_by_name("__".to_string() + &section_name[1..]) {
-        Ok(EndianRcSlice::new(
-            Rc::from(view.read_vec(section.start(), section.len()).as_slice()),
+        Ok(EndianArcSlice::new(
+            Arc::from(view.read_vec(section.start(), section.len()).as_slice()),
             endian,
         ))
     } else {
-        Ok(EndianRcSlice::new(Rc::from([]), endian))
+        Ok(EndianArcSlice::new(Arc::from([]), endian))
     }
 }
@@ -73,36 +73,12 @@ impl CustomDebugInfoParser for TILDebugInfoParser {
     }
 }
 
-struct BinaryViewReader<'a> {
-    bv: &'a BinaryView,
-    offset: u64,
-}
-impl std::io::Read for BinaryViewReader<'_> {
-    fn read(&mut self, buf: &mut [u8]) -> std::io::Result<usize> {
-        if !self.bv.offset_valid(self.offset) {
-            return Err(std::io::Error::new(std::io::ErrorKind::UnexpectedEof, ""));
-        }
-        let len = self.bv.read(buf, self.offset);
-        self.offset += u64::try_from(len).unwrap();
-        Ok(len)
-    }
-}
-
-impl std::io::Seek for BinaryViewReader<'_> {
-    fn seek(&mut self, pos: std::io::SeekFrom) -> std::io::Result<u64> {
-        let new_offset = match pos {
-            std::io::SeekFrom::Start(offset) => Some(offset),
-            std::io::SeekFrom::End(end) => self.bv.len().checked_add_signed(end),
-            std::io::SeekFrom::Current(next) => self.offset.checked_add_signed(next),
-        };
-        let new_offset =
-            new_offset.ok_or_else(|| std::io::Error::new(std::io::ErrorKind::UnexpectedEof, ""))?;
-        if !self.bv.offset_valid(new_offset) {
-            return Err(std::io::Error::new(std::io::ErrorKind::UnexpectedEof, ""));
-        }
-        self.offset = new_offset;
-        Ok(new_offset)
-    }
+/// The whole file read in one go.
+///
+/// The parsers seek around a lot and read in small pieces, going through `BinaryView::read` for each of
+/// those is far slower than reading the file once, even for large databases.
+fn read_debug_file(debug_file: &BinaryView) -> std::io::Cursor<Vec<u8>> {
+    std::io::Cursor::new(debug_file.read_vec(0, debug_file.len() as usize))
 }
 
 fn parse_idb_info(
@@ -112,12 +88,8 @@ fn parse_idb_info(
     progress: Box<dyn Fn(usize, usize) -> Result<(), ()>>,
 ) -> Result<()> {
     trace!("Opening a IDB file");
-    let file = BinaryViewReader {
-        bv: debug_file,
-        offset: 0,
-    };
+    let file = read_debug_file(debug_file);
     trace!("Parsing a IDB file");
-    let file = std::io::BufReader::new(file);
     let mut parser = idb_rs::IDBParser::new(file)?;
     if let Some(til_section) = parser.til_section_offset() {
         trace!("Parsing the TIL section");
@@ -142,11 +114,7 @@ fn parse_til_info(
     progress: Box<dyn Fn(usize, usize) -> Result<(), ()>>,
 ) -> Result<()> {
     trace!("Opening a TIL file");
-    let file = BinaryViewReader {
-        bv: debug_file,
-        offset: 0,
-    };
-    let mut file = std::io::BufReader::new(file);
+    let mut file = read_debug_file(debug_file);
     trace!("Parsing the TIL section");
     let til = TILSection::read(&mut file, idb_rs::IDBSectionCompression::None)?;
     import_til_section(debug_info, debug_file, &til, progress)
@@ -238,11 +206,11 @@ fn parse_id0_section_info(
             ty,
         } = info;
         // TODO set comments to address here
-        for function in &bv.functions_containing(addr) {
-            function.set_comment_at(
-                addr,
-                String::from_utf8_lossy(&comments.join(&b"\n"[..])).to_string(),
-            );
+        if !comments.is_empty() {
+            let comment = String::from_utf8_lossy(&comments.join(&b"\n"[..])).to_string();
+            for function in &bv.functions_containing(addr) {
+                function.set_comment_at(addr, &comment);
+            }
         }
 
         let bnty = ty
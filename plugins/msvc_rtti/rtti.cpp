@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
 #include "rtti.h"
 
 using namespace BinaryNinja;
@@ -6,6 +9,11 @@ constexpr int COL_SIG_REV0 = 0;
 constexpr int COL_SIG_REV1 = 1;
 constexpr int RTTI_CONFIDENCE = 100;
 
+// Segments are read and scanned for complete object locators in blocks of this size.
+constexpr size_t COL_SCAN_BLOCK_SIZE = 0x100000;
+// Bytes past a candidate's address that the scan looks at, the block read is extended by this much.
+constexpr size_t COL_SCAN_OVERLAP = 0x18;
+
 constexpr int BCD_HASPCHD = 0x40;
 
 ClassHierarchyDescriptor::ClassHierarchyDescriptor(BinaryView *view, uint64_t address)
@@ -73,13 +81,14 @@ CompleteObjectLocator::CompleteObjectLocator(BinaryView *view, uint64_t address)
 }
 
 
-std::optional<CompleteObjectLocator> ReadCompleteObjectorLocator(BinaryView *view, uint64_t address)
+std::optional<CompleteObjectLocator> ReadCompleteObjectorLocator(BinaryView *view, const SegmentMapSnapshot &regions,
+    uint64_t address)
 {
     auto coLocator = CompleteObjectLocator(view, address);
     uint64_t startAddr = view->GetOriginalImageBase();
 
     auto outsideSection = [&](uint64_t addr) {
-        return view->GetSectionsAt(addr).empty();
+        return regions.GetSectionAt(addr) == nullptr;
     };
 
     if (coLocator.signature > 1)
@@ -111,6 +120,84 @@ std::optional<CompleteObjectLocator> ReadCompleteObjectorLocator(BinaryView *vie
 }
 
 
+static uint32_t ReadLE32(const uint8_t *data)
+{
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+           (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+
+// Addresses in [start, end) that look like complete object locators, in address order.
+static std::vector<uint64_t> FindCoLocatorCandidates(BinaryView *view, const SegmentMapSnapshot &regions,
+    uint64_t start, uint64_t end, size_t addrSize)
+{
+    std::vector<uint64_t> candidates;
+    uint64_t imageBase = view->GetOriginalImageBase();
+    uint64_t viewEnd = view->GetEnd();
+    BinaryReader reader = BinaryReader(view);
+    std::vector<uint8_t> block(end - start + COL_SCAN_OVERLAP);
+    size_t blockLen = view->Read(block.data(), start, block.size());
+
+    for (size_t offset = 0; offset + COL_SCAN_OVERLAP <= blockLen && start + offset < end; offset += addrSize)
+    {
+        // Most slots hold neither signature, test that first before decoding anything else.
+        uint32_t sigVal = ReadLE32(&block[offset]);
+        if (sigVal > COL_SIG_REV1)
+            continue;
+
+        uint64_t coLocatorAddr = start + offset;
+        if (sigVal == COL_SIG_REV1)
+        {
+            // Check for self reference
+            if (ReadLE32(&block[offset + 20]) == coLocatorAddr - imageBase)
+                candidates.push_back(coLocatorAddr);
+            continue;
+        }
+
+        // Check ?AV
+        uint64_t typeDescNameAddr = static_cast<uint32_t>(ReadLE32(&block[offset + 12]) + 8);
+        if (typeDescNameAddr <= imageBase || typeDescNameAddr >= viewEnd)
+            continue;
+        // Make sure we do not read across segment boundary.
+        auto typeDescSegment = regions.GetSegmentAt(typeDescNameAddr);
+        if (typeDescSegment == nullptr || typeDescSegment->GetEnd() - typeDescNameAddr <= 4)
+            continue;
+        try
+        {
+            reader.Seek(typeDescNameAddr);
+            auto typeDescNameStart = reader.ReadString(4);
+            if (typeDescNameStart == ".?AV" || typeDescNameStart == ".?AU" || typeDescNameStart == ".?AW")
+                candidates.push_back(coLocatorAddr);
+        }
+        catch (ReadException &)
+        {
+        }
+    }
+    return candidates;
+}
+
+
+// Call `scan(i)` for every i in [0, count) from a pool of threads, returning the results in index order.
+template <typename Result, typename Scan>
+static std::vector<Result> ScanInParallel(size_t count, Scan &&scan)
+{
+    std::vector<Result> results(count);
+    std::atomic<size_t> next = 0;
+    auto worker = [&]() {
+        for (size_t i = next++; i < count; i = next++)
+            results[i] = scan(i);
+    };
+    size_t threadCount = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), count);
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < threadCount; i++)
+        workers.emplace_back(worker);
+    worker();
+    for (auto &thread: workers)
+        thread.join();
+    return results;
+}
+
+
 Ref<Type> GetPMDType(BinaryView *view)
 {
     auto typeId = Type::GenerateAutoTypeId("msvc_rtti", QualifiedName("PMD"));
@@ -439,10 +526,10 @@ std::optional<std::string> MicrosoftRTTIProcessor::DemangleName(const std::strin
 }
 
 
-std::optional<ClassInfo> MicrosoftRTTIProcessor::ProcessRTTI(uint64_t coLocatorAddr)
+std::optional<ClassInfo> MicrosoftRTTIProcessor::ProcessRTTI(uint64_t coLocatorAddr, const SegmentMapSnapshot &regions)
 {
     // Get complete object locator then check to see if its valid.
-    auto coLocator = ReadCompleteObjectorLocator(m_view, coLocatorAddr);
+    auto coLocator = ReadCompleteObjectorLocator(m_view, regions, coLocatorAddr);
     if (!coLocator.has_value())
         return std::nullopt;
 
@@ -571,38 +658,49 @@ std::optional<ClassInfo> MicrosoftRTTIProcessor::ProcessRTTI(uint64_t coLocatorA
 }
 
 
-std::optional<VirtualFunctionTableInfo> MicrosoftRTTIProcessor::ProcessVFT(uint64_t vftAddr, const ClassInfo &classInfo)
+// Function pointers at the start of the virtual function table at `vftAddr`, along with their analysis function if
+// one exists yet. This only reads the view, so tables can be read from any thread.
+static std::vector<std::pair<uint64_t, Ref<Function>>> ReadVirtualFunctionTable(BinaryView *view,
+    const SegmentMapSnapshot &regions, uint64_t vftAddr)
 {
-    VirtualFunctionTableInfo vftInfo = {vftAddr};
-    // Gather all virtual functions
-    BinaryReader reader = BinaryReader(m_view);
+    std::vector<std::pair<uint64_t, Ref<Function>>> virtualFunctions = {};
+    BinaryReader reader = BinaryReader(view);
     reader.Seek(vftAddr);
-    // Virtual functions and the analysis object of it, if it exists.
-    std::vector<std::pair<uint64_t, std::optional<Ref<Function>>>> virtualFunctions = {};
-    while (true)
+    try
     {
-        uint64_t vFuncAddr = reader.ReadPointer();
-        auto funcs = m_view->GetAnalysisFunctionsForAddress(vFuncAddr);
-        if (funcs.empty())
+        while (true)
         {
-            Ref<Segment> segment = m_view->GetSegmentAt(vFuncAddr);
-            if (segment == nullptr || !(segment->GetFlags() & (SegmentExecutable | SegmentDenyWrite)))
+            uint64_t vFuncAddr = reader.ReadPointer();
+            auto funcs = view->GetAnalysisFunctionsForAddress(vFuncAddr);
+            if (funcs.empty())
+            {
+                Segment *segment = regions.GetSegmentAt(vFuncAddr);
+                if (segment == nullptr || !(segment->GetFlags() & (SegmentExecutable | SegmentDenyWrite)))
+                {
+                    // Last CompleteObjectLocator or hit the next CompleteObjectLocator
+                    break;
+                }
+                virtualFunctions.emplace_back(vFuncAddr, nullptr);
+            }
+            else
             {
-                // Last CompleteObjectLocator or hit the next CompleteObjectLocator
-                break;
+                // Only ever add one function.
+                virtualFunctions.emplace_back(vFuncAddr, funcs.front());
             }
-            // TODO: Is likely a function check here?
-            m_logger->LogDebug("Discovered function from virtual function table... %llx", vFuncAddr);
-            auto vFunc = m_view->AddFunctionForAnalysis(m_view->GetDefaultPlatform(), vFuncAddr, true);
-            virtualFunctions.emplace_back(vFuncAddr, vFunc ? std::optional(vFunc) : std::nullopt);
-        }
-        else
-        {
-            // Only ever add one function.
-            virtualFunctions.emplace_back(vFuncAddr, funcs.front());
         }
     }
+    catch (ReadException &)
+    {
+        // Table runs up to the end of the view
+    }
+    return virtualFunctions;
+}
 
+
+std::optional<VirtualFunctionTableInfo> MicrosoftRTTIProcessor::ProcessVFT(uint64_t vftAddr, const ClassInfo &classInfo,
+    std::vector<std::pair<uint64_t, std::optional<Ref<Function>>>> virtualFunctions, VFTDefinitions &definitions)
+{
+    VirtualFunctionTableInfo vftInfo = {vftAddr};
     if (virtualFunctions.empty())
     {
         m_logger->LogDebug("Skipping empty virtual function table... %llx", vftAddr);
@@ -623,7 +721,7 @@ std::optional<VirtualFunctionTableInfo> MicrosoftRTTIProcessor::ProcessVFT(uint6
     auto typeId = Type::GenerateAutoDebugTypeId(vftTypeName);
     Ref<Type> vftType = m_view->GetTypeById(typeId);
 
-    if (vftType == nullptr)
+    if (vftType == nullptr && definitions.typeIds.insert(typeId).second)
     {
         size_t addrSize = m_view->GetAddressSize();
         StructureBuilder vftBuilder = {};
@@ -680,15 +778,15 @@ std::optional<VirtualFunctionTableInfo> MicrosoftRTTIProcessor::ProcessVFT(uint6
                 Type::PointerType(addrSize, vFunc.has_value() ? vFunc.value()->GetType() : Type::VoidType(), true), vFuncName, vFuncOffset);
             vFuncIdx++;
         }
-        m_view->DefineType(typeId, vftTypeName,
-                           Confidence(TypeBuilder::StructureType(vftBuilder.Finalize()).Finalize(), RTTI_CONFIDENCE));
+        definitions.types.emplace_back(
+            typeId, QualifiedNameAndType(vftTypeName, TypeBuilder::StructureType(vftBuilder.Finalize()).Finalize()));
     }
 
     auto vftName = fmt::format("{}::`vftable'", classInfo.className);
     if (classInfo.baseClassName.has_value())
         vftName += fmt::format("{{for `{}'}}", classInfo.baseClassName.value());
-    m_view->DefineAutoSymbol(new Symbol{DataSymbol, vftName, vftAddr});
-    m_view->DefineDataVariable(vftAddr, Confidence(Type::NamedType(m_view, vftTypeName), RTTI_CONFIDENCE));
+    definitions.symbols.push_back(SymbolSpec{DataSymbol, vftName, vftAddr});
+    definitions.dataVariables.emplace_back(vftAddr, vftTypeName);
     return vftInfo;
 }
 
@@ -711,68 +809,60 @@ MicrosoftRTTIProcessor::MicrosoftRTTIProcessor(const Ref<BinaryView> &view, bool
 }
 
 
-void MicrosoftRTTIProcessor::ProcessRTTI()
+std::vector<std::pair<uint64_t, uint64_t>> MicrosoftRTTIProcessor::GetScanBlocks()
 {
-    auto start_time = std::chrono::high_resolution_clock::now();
-    uint64_t startAddr = m_view->GetOriginalImageBase();
-    uint64_t endAddr = m_view->GetEnd();
-    BinaryReader optReader = BinaryReader(m_view);
-    auto addrSize = m_view->GetAddressSize();
-
-    auto scan = [&](const Ref<Segment> &segment) {
-        for (uint64_t coLocatorAddr = segment->GetStart(); coLocatorAddr < segment->GetEnd() - 0x18;
-             coLocatorAddr += addrSize)
-        {
-            optReader.Seek(coLocatorAddr);
-            uint32_t sigVal = optReader.Read32();
-            if (sigVal == COL_SIG_REV1)
-            {
-                // Check for self reference
-                optReader.SeekRelative(16);
-                if (optReader.Read32() == coLocatorAddr - startAddr)
-                {
-                    if (auto classInfo = ProcessRTTI(coLocatorAddr))
-                        m_classInfo[coLocatorAddr] = classInfo.value();
-                }
-            }
-            else if (sigVal == COL_SIG_REV0)
-            {
-                // Check ?AV
-                optReader.SeekRelative(8);
-                uint64_t typeDescNameAddr = optReader.Read32() + 8;
-                if (typeDescNameAddr > startAddr && typeDescNameAddr < endAddr)
-                {
-                    // Make sure we do not read across segment boundary.
-                    auto typeDescSegment = m_view->GetSegmentAt(typeDescNameAddr);
-                    if (typeDescSegment != nullptr && typeDescSegment->GetEnd() - typeDescNameAddr > 4)
-                    {
-                        optReader.Seek(typeDescNameAddr);
-                        auto typeDescNameStart = optReader.ReadString(4);
-                        if (typeDescNameStart == ".?AV" || typeDescNameStart == ".?AU" || typeDescNameStart == ".?AW")
-                        {
-                            if (auto classInfo = ProcessRTTI(coLocatorAddr))
-                                m_classInfo[coLocatorAddr] = classInfo.value();
-                        }
-                    }
-                }
-            }
-        }
+    // Split the data segments into blocks, each scanned independently.
+    std::vector<std::pair<uint64_t, uint64_t>> blocks;
+    auto addBlocks = [&](const Ref<Segment> &segment) {
+        if (segment->GetEnd() - segment->GetStart() <= COL_SCAN_OVERLAP)
+            return;
+        uint64_t scanEnd = segment->GetEnd() - COL_SCAN_OVERLAP;
+        for (uint64_t blockStart = segment->GetStart(); blockStart < scanEnd; blockStart += COL_SCAN_BLOCK_SIZE)
+            blocks.emplace_back(blockStart, std::min<uint64_t>(blockStart + COL_SCAN_BLOCK_SIZE, scanEnd));
     };
 
-    // Scan data sections for colocators.
+    // Scan data sections for colocators and virtual function tables.
     auto rdataSection = m_view->GetSectionByName(".rdata");
     for (const Ref<Segment> &segment: m_view->GetSegments())
     {
         if (segment->GetFlags() == (SegmentReadable | SegmentContainsData))
         {
             m_logger->LogDebug("Attempting to find VirtualFunctionTables in segment %llx", segment->GetStart());
-            scan(segment);
+            addBlocks(segment);
         }
         else if (checkWritableRData && rdataSection && rdataSection->GetStart() == segment->GetStart())
         {
             m_logger->LogDebug("Attempting to find VirtualFunctionTables in writable rdata segment %llx",
                                segment->GetStart());
-            scan(segment);
+            addBlocks(segment);
+        }
+    }
+    return blocks;
+}
+
+
+void MicrosoftRTTIProcessor::ProcessRTTI()
+{
+    auto start_time = std::chrono::high_resolution_clock::now();
+    auto addrSize = m_view->GetAddressSize();
+
+    // Every candidate pointer is checked against the segments and sections, which don't change while the RTTI
+    // is defined, so they are copied once up front.
+    SegmentMapSnapshot regions(m_view);
+
+    // Finding candidates only reads the view, so blocks are handed out to a pool of threads.
+    auto blocks = GetScanBlocks();
+    auto blockCandidates = ScanInParallel<std::vector<uint64_t>>(blocks.size(), [&](size_t i) {
+        return FindCoLocatorCandidates(m_view, regions, blocks[i].first, blocks[i].second, addrSize);
+    });
+
+    // Defining the RTTI structures changes the view, that stays on this thread and in address order.
+    for (const auto &candidates: blockCandidates)
+    {
+        for (uint64_t coLocatorAddr: candidates)
+        {
+            if (auto classInfo = ProcessRTTI(coLocatorAddr, regions))
+                m_classInfo[coLocatorAddr] = classInfo.value();
         }
     }
 
@@ -798,47 +888,73 @@ void MicrosoftRTTIProcessor::ProcessVFT()
 
     if (virtualFunctionTableSweep)
     {
-        BinaryReader optReader = BinaryReader(m_view);
         auto addrSize = m_view->GetAddressSize();
-        auto scan = [&](const Ref<Segment> &segment) {
-            uint64_t startAddr = segment->GetStart();
-            uint64_t endAddr = segment->GetEnd();
-            for (uint64_t vtableAddr = startAddr; vtableAddr < endAddr - 0x18; vtableAddr += addrSize)
+        auto blocks = GetScanBlocks();
+        // (colocator, vtable) for every slot pointing at a colocator, in address order
+        auto blockRefs = ScanInParallel<std::vector<std::pair<uint64_t, uint64_t>>>(blocks.size(), [&](size_t i) {
+            auto [start, end] = blocks[i];
+            std::vector<std::pair<uint64_t, uint64_t>> refs;
+            std::vector<uint8_t> block(end - start + COL_SCAN_OVERLAP);
+            size_t blockLen = m_view->Read(block.data(), start, block.size());
+            for (size_t offset = 0; offset + COL_SCAN_OVERLAP <= blockLen && start + offset < end; offset += addrSize)
             {
-                optReader.Seek(vtableAddr);
-                uint64_t coLocatorAddr = optReader.ReadPointer();
-                auto coLocator = m_classInfo.find(coLocatorAddr);
-                if (coLocator == m_classInfo.end())
+                uint64_t coLocatorAddr = ReadLE32(&block[offset]);
+                if (addrSize == 8)
+                    coLocatorAddr |= static_cast<uint64_t>(ReadLE32(&block[offset + 4])) << 32;
+                if (m_classInfo.find(coLocatorAddr) == m_classInfo.end())
                     continue;
                 // Found a vtable reference to colocator.
-                vftMap[coLocatorAddr] = vtableAddr + addrSize;
+                refs.emplace_back(coLocatorAddr, start + offset + addrSize);
             }
-        };
+            return refs;
+        });
+        for (const auto &refs: blockRefs)
+            for (const auto &[coLocatorAddr, vftAddr]: refs)
+                vftMap[coLocatorAddr] = vftAddr;
+    }
 
-        // Scan data sections for virtual function tables.
-        auto rdataSection = m_view->GetSectionByName(".rdata");
-        for (const Ref<Segment> &segment: m_view->GetSegments())
+    // Read every table's slots in parallel, then add the functions found in them from this thread.
+    std::vector<uint64_t> vftAddrs;
+    for (const auto &[_, vftAddr]: vftMap)
+        vftAddrs.push_back(vftAddr);
+    std::sort(vftAddrs.begin(), vftAddrs.end());
+    vftAddrs.erase(std::unique(vftAddrs.begin(), vftAddrs.end()), vftAddrs.end());
+    SegmentMapSnapshot regions(m_view);
+    auto vftSlots = ScanInParallel<std::vector<std::pair<uint64_t, Ref<Function>>>>(vftAddrs.size(),
+        [&](size_t i) { return ReadVirtualFunctionTable(m_view, regions, vftAddrs[i]); });
+
+    std::map<uint64_t, std::vector<std::pair<uint64_t, std::optional<Ref<Function>>>>> vftFunctions = {};
+    for (size_t i = 0; i < vftAddrs.size(); i++)
+    {
+        auto &virtualFunctions = vftFunctions[vftAddrs[i]];
+        for (auto &[vFuncAddr, vFunc]: vftSlots[i])
         {
-            if (segment->GetFlags() == (SegmentReadable | SegmentContainsData))
-            {
-                m_logger->LogDebug("Attempting to find VirtualFunctionTables in segment %llx", segment->GetStart());
-                scan(segment);
-            }
-            else if (checkWritableRData && rdataSection && rdataSection->GetStart() == segment->GetStart())
+            if (!vFunc)
             {
-                m_logger->LogDebug("Attempting to find VirtualFunctionTables in writable rdata segment %llx",
-                                   segment->GetStart());
-                scan(segment);
+                // An earlier table may have added it already.
+                auto funcs = m_view->GetAnalysisFunctionsForAddress(vFuncAddr);
+                if (!funcs.empty())
+                {
+                    virtualFunctions.emplace_back(vFuncAddr, funcs.front());
+                    continue;
+                }
+                // TODO: Is likely a function check here?
+                m_logger->LogDebug("Discovered function from virtual function table... %llx", vFuncAddr);
+                vFunc = m_view->AddFunctionForAnalysis(m_view->GetDefaultPlatform(), vFuncAddr, true);
+                virtualFunctions.emplace_back(vFuncAddr, vFunc ? std::optional(vFunc) : std::nullopt);
+                continue;
             }
+            virtualFunctions.emplace_back(vFuncAddr, vFunc);
         }
     }
 
+    VFTDefinitions definitions;
     auto GetCachedVFTInfo = [&](uint64_t vftAddr, const ClassInfo& classInfo) {
         // Check in the cache so that we don't process vfts more than once.
         auto cachedVftInfo = vftFinishedMap.find(vftAddr);
         if (cachedVftInfo != vftFinishedMap.end())
             return cachedVftInfo->second;
-        auto vftInfo = ProcessVFT(vftAddr, classInfo);
+        auto vftInfo = ProcessVFT(vftAddr, classInfo, vftFunctions[vftAddr], definitions);
         vftFinishedMap[vftAddr] = vftInfo;
         return vftInfo;
     };
@@ -851,10 +967,10 @@ void MicrosoftRTTIProcessor::ProcessVFT()
             // Process base vtable and add it to the class info.
             for (auto& [baseCoLocAddr, baseClassInfo] : m_classInfo)
             {
-                if (baseClassInfo.className == classInfo.baseClassName.value())
+                auto baseVft = vftMap.find(baseCoLocAddr);
+                if (baseVft != vftMap.end() && baseClassInfo.className == classInfo.baseClassName.value())
                 {
-                    uint64_t baseVftAddr = vftMap[baseCoLocAddr];
-                    if (auto baseVftInfo = GetCachedVFTInfo(baseVftAddr, baseClassInfo))
+                    if (auto baseVftInfo = GetCachedVFTInfo(baseVft->second, baseClassInfo))
                     {
                         classInfo.baseVft = baseVftInfo.value();
                         break;
@@ -868,6 +984,13 @@ void MicrosoftRTTIProcessor::ProcessVFT()
             classInfo.vft = vftInfo.value();
         }
     }
+
+    // The tables only refer to their types by name, so everything is defined in bulk once the types exist.
+    if (!definitions.types.empty())
+        m_view->DefineTypes(definitions.types);
+    m_view->DefineAutoSymbols(definitions.symbols);
+    for (const auto &[vftAddr, vftTypeName]: definitions.dataVariables)
+        m_view->DefineDataVariable(vftAddr, Confidence(Type::NamedType(m_view, vftTypeName), RTTI_CONFIDENCE));
     
     auto end_time = std::chrono::high_resolution_clock::now();
     std::chrono::duration<double> elapsed_time = end_time - start_time;
@@ -107,9 +107,22 @@ namespace BinaryNinja {
 
 		std::optional<std::string> DemangleName(const std::string &mangledName);
 
-		std::optional<ClassInfo> ProcessRTTI(uint64_t coLocatorAddr);
-
-		std::optional<VirtualFunctionTableInfo> ProcessVFT(uint64_t vftAddr, const ClassInfo &classInfo);
+		std::optional<ClassInfo> ProcessRTTI(uint64_t coLocatorAddr, const SegmentMapSnapshot &regions);
+
+		std::vector<std::pair<uint64_t, uint64_t>> GetScanBlocks();
+
+		// Types, symbols and data variables of the processed virtual function tables, defined together at the end.
+		struct VFTDefinitions
+		{
+			std::vector<std::pair<std::string, QualifiedNameAndType>> types;
+			std::set<std::string> typeIds;
+			std::vector<SymbolSpec> symbols;
+			std::vector<std::pair<uint64_t, std::string>> dataVariables;
+		};
+
+		std::optional<VirtualFunctionTableInfo> ProcessVFT(uint64_t vftAddr, const ClassInfo &classInfo,
+			std::vector<std::pair<uint64_t, std::optional<Ref<Function>>>> virtualFunctions,
+			VFTDefinitions &definitions);
 
 	public:
 		MicrosoftRTTIProcessor(const Ref<BinaryView> &view, bool useMangled = true, bool checkRData = true, bool vftSweep = true, bool allowAnonymous = true);
@@ -16,6 +16,7 @@
 use std::collections::HashMap;
 use std::env::{current_dir, current_exe, temp_dir};
 use std::io::Cursor;
+use std::ops::Deref;
 use std::path::PathBuf;
 use std::str::FromStr;
 use std::sync::mpsc;
@@ -23,6 +24,7 @@ use std::{env, fs};
 
 use anyhow::{anyhow, Result};
 use log::{debug, error, info};
+use memmap2::Mmap;
 use pdb::PDB;
 
 use binaryninja::binary_view::{BinaryView, BinaryViewBase, BinaryViewExt};
@@ -162,11 +164,41 @@ fn parse_sym_srv(symbol_path: &str, default_store: String) -> Result<impl Iterat
     Ok(sym_srv_results.into_iter())
 }
 
-fn read_from_sym_store(bv: &BinaryView, path: &str) -> Result<(bool, Vec<u8>)> {
+/// Contents of a PDB file, mapped when it is local since those can be several gigabytes
+enum PdbContents {
+    Mapped(Mmap),
+    Owned(Vec<u8>),
+}
+
+impl PdbContents {
+    fn open(path: &str) -> Result<Self> {
+        let file = fs::File::open(path)?;
+        // SAFETY: The file is only read while parsing, same as if it had been read in all at once.
+        //  Should it be truncated underneath us, that is no different than any other mapped file.
+        match unsafe { Mmap::map(&file) } {
+            Ok(mmap) => Ok(PdbContents::Mapped(mmap)),
+            // Some filesystems can't be mapped, fall back to reading the whole file
+            Err(_) => Ok(PdbContents::Owned(fs::read(path)?)),
+        }
+    }
+}
+
+impl Deref for PdbContents {
+    type Target = [u8];
+
+    fn deref(&self) -> &[u8] {
+        match self {
+            PdbContents::Mapped(mmap) => mmap,
+            PdbContents::Owned(bytes) => bytes,
+        }
+    }
+}
+
+fn read_from_sym_store(bv: &BinaryView, path: &str) -> Result<(bool, PdbContents)> {
     if !path.contains("://") {
         // Local file
         info!("Read local file: {}", path);
-        let conts = fs::read(path)?;
+        let conts = PdbContents::open(path)?;
         return Ok((false, conts));
     }
 
@@ -215,7 +247,7 @@ fn read_from_sym_store(bv: &BinaryView, path: &str) -> Result<(bool, Vec<u8>)> {
         }
     }
 
-    let mut data = vec![];
+    let mut data = Vec::with_capacity(expected_length.unwrap_or(0));
     while let Ok(packet) = rx.try_recv() {
         data.extend(packet.into_iter());
     }
@@ -230,14 +262,14 @@ fn read_from_sym_store(bv: &BinaryView, path: &str) -> Result<(bool, Vec<u8>)> {
         }
     }
 
-    Ok((true, data))
+    Ok((true, PdbContents::Owned(data)))
 }
 
 fn search_sym_store(
     bv: &BinaryView,
     store_path: String,
     pdb_info: &PDBInfo,
-) -> Result<Option<Vec<u8>>> {
+) -> Result<Option<PdbContents>> {
     // https://www.technlg.net/windows/symbol-server-path-windbg-debugging/
     // For symbol servers, to identify the files path easily, Windbg uses the format
     // binaryname.pdb/GUID
@@ -265,7 +297,7 @@ fn search_sym_store(
 
     let file_ptr = base_path.clone() + "/" + "file.ptr";
     if let Ok((_remote, conts)) = read_from_sym_store(bv, &file_ptr) {
-        let path = String::from_utf8(conts)?;
+        let path = std::str::from_utf8(&conts)?;
         // PATH:https://full/path
         if let Some(stripped) = path.strip_prefix("PATH:") {
             if let Ok((_remote, conts)) = read_from_sym_store(bv, stripped) {
@@ -353,14 +385,14 @@ struct PDBParser;
 impl PDBParser {
     fn load_from_file(
         &self,
-        conts: &Vec<u8>,
+        conts: &[u8],
         debug_info: &mut DebugInfo,
         view: &BinaryView,
         progress: &dyn Fn(usize, usize) -> Result<(), ()>,
         check_guid: bool,
         did_download: bool,
     ) -> Result<()> {
-        let mut pdb = PDB::open(Cursor::new(&conts))?;
+        let mut pdb = PDB::open(Cursor::new(conts))?;
 
         let settings = Settings::new();
         let mut settings_query_opts = QueryOptions::new_with_view(view);
@@ -598,7 +630,7 @@ impl CustomDebugInfoParser for PDBParser {
 
             // Does the raw path just exist?
             if PathBuf::from(&info.path).exists() {
-                match fs::read(&info.path) {
+                match PdbContents::open(&info.path) {
                     Ok(conts) => match self
                         .load_from_file(&conts, debug_info, view, &progress, true, false)
                     {
@@ -616,7 +648,7 @@ impl CustomDebugInfoParser for PDBParser {
             potential_path.pop();
             potential_path.push(&info.file_name);
             if potential_path.exists() {
-                match fs::read(
+                match PdbContents::open(
                     potential_path
                         .to_str()
                         .expect("Potential path is a real string"),
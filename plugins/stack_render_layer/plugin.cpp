@@ -8,7 +8,11 @@ using namespace BinaryNinja;
 class StackRenderLayer: public RenderLayer
 {
 public:
-	StackRenderLayer(): RenderLayer("Annotate Stack Offset") {}
+	StackRenderLayer(): RenderLayer("Annotate Stack Offset")
+	{
+		// Offsets only change when the function is reanalyzed, which creates new blocks
+		SetBlockCacheSize(4096);
+	}
 
 	void ApplyToLines(
 		Ref<BasicBlock> block,
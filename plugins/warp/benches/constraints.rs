@@ -0,0 +1,56 @@
+use criterion::{black_box, criterion_group, criterion_main, Criterion};
+use std::collections::HashSet;
+use warp_ninja::constraints::intersection_count;
+
+// Small deterministic generator so the bench doesn't need an extra dependency.
+fn keys(seed: u64, count: usize) -> Vec<u64> {
+    let mut state = seed;
+    (0..count)
+        .map(|_| {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            // Keep the key space small enough for the sets to overlap.
+            state % 4096
+        })
+        .collect()
+}
+
+pub fn constraints_benchmark(c: &mut Criterion) {
+    // Roughly a stub with many GUID collisions: lots of candidates, each with a handful of constraints.
+    let observed = keys(1, 64);
+    let candidates: Vec<Vec<u64>> = (0..256).map(|i| keys(i + 2, 64)).collect();
+
+    let observed_set: HashSet<u64> = observed.iter().copied().collect();
+    c.bench_function("constraints hashset intersection", |b| {
+        b.iter(|| {
+            candidates
+                .iter()
+                .map(|candidate| {
+                    let candidate_set: HashSet<u64> = candidate.iter().copied().collect();
+                    observed_set.intersection(&candidate_set).count()
+                })
+                .max()
+        })
+    });
+
+    let sort = |list: &[u64]| {
+        let mut list = list.to_vec();
+        list.sort_unstable();
+        list.dedup();
+        list
+    };
+    let observed_sorted = sort(&observed);
+    let candidates_sorted: Vec<Vec<u64>> = candidates.iter().map(|c| sort(c)).collect();
+    c.bench_function("constraints sorted intersection", |b| {
+        b.iter(|| {
+            candidates_sorted
+                .iter()
+                .map(|candidate| intersection_count(black_box(&observed_sorted), candidate))
+                .max()
+        })
+    });
+}
+
+criterion_group!(benches, constraints_benchmark);
+criterion_main!(benches);
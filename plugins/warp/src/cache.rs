@@ -17,6 +17,7 @@ use dashmap::mapref::one::Ref;
 use dashmap::DashMap;
 use std::collections::HashSet;
 use std::hash::{DefaultHasher, Hash, Hasher};
+use std::sync::atomic::{AtomicU64, AtomicUsize, Ordering};
 use std::sync::OnceLock;
 use warp::r#type::ComputedType;
 use warp::signature::function::constraints::FunctionConstraint;
@@ -28,6 +29,57 @@ pub static FUNCTION_CACHE: OnceLock<DashMap<ViewID, FunctionCache>> = OnceLock::
 pub static GUID_CACHE: OnceLock<DashMap<ViewID, GUIDCache>> = OnceLock::new();
 pub static TYPE_REF_CACHE: OnceLock<DashMap<ViewID, TypeRefCache>> = OnceLock::new();
 
+/// Most entries a single view's matched function or function cache may hold.
+static MAX_ENTRIES_PER_VIEW: AtomicUsize = AtomicUsize::new(1 << 20);
+/// Approximate bytes all bounded caches together may hold, zero for no limit.
+static MEMORY_BUDGET: AtomicUsize = AtomicUsize::new(0);
+/// Approximate bytes currently held by all bounded caches.
+static TOTAL_CACHE_BYTES: AtomicUsize = AtomicUsize::new(0);
+
+/// Set the limits for the per-view caches, a `memory_budget` of zero means no global limit.
+///
+/// Limits are enforced as entries get inserted, so lowering them does not shrink the caches right away.
+/// The type reference cache is not bounded as it also records the types a created signature file needs.
+/// The GUID cache is not bounded either, constraints and the find command look GUIDs up without the LLIL
+/// needed to recompute them, so an evicted GUID would silently change their results.
+pub fn set_cache_limits(max_entries_per_view: usize, memory_budget: usize) {
+    MAX_ENTRIES_PER_VIEW.store(max_entries_per_view.max(1), Ordering::Relaxed);
+    MEMORY_BUDGET.store(memory_budget, Ordering::Relaxed);
+}
+
+/// Approximate bytes held by the bounded caches of every view.
+pub fn total_cache_bytes() -> usize {
+    TOTAL_CACHE_BYTES.load(Ordering::Relaxed)
+}
+
+/// Sizes and hit rates of a view's caches.
+#[derive(Copy, Clone, Debug, Default)]
+pub struct ViewCacheStats {
+    pub matched_functions: CacheStats,
+    pub functions: CacheStats,
+    /// Only `entries` is tracked for the GUID and type reference caches.
+    pub guids: CacheStats,
+    pub type_refs: CacheStats,
+}
+
+pub fn cache_stats(view: &BinaryView) -> ViewCacheStats {
+    let view_id = ViewID::from(view);
+    let mut stats = ViewCacheStats::default();
+    if let Some(cache) = MATCHED_FUNCTION_CACHE.get().and_then(|c| c.get(&view_id)) {
+        stats.matched_functions = cache.cache.stats();
+    }
+    if let Some(cache) = FUNCTION_CACHE.get().and_then(|c| c.get(&view_id)) {
+        stats.functions = cache.cache.stats();
+    }
+    if let Some(cache) = GUID_CACHE.get().and_then(|c| c.get(&view_id)) {
+        stats.guids.entries = cache.cache.len();
+    }
+    if let Some(cache) = TYPE_REF_CACHE.get().and_then(|c| c.get(&view_id)) {
+        stats.type_refs.entries = cache.cache.len();
+    }
+    stats
+}
+
 pub fn register_cache_destructor() {
     pub static mut CACHE_DESTRUCTOR: CacheDestructor = CacheDestructor;
     #[allow(static_mut_refs)]
@@ -46,10 +98,10 @@ where
     let function_id = FunctionID::from(function);
     let function_cache = MATCHED_FUNCTION_CACHE.get_or_init(Default::default);
     match function_cache.get(&view_id) {
-        Some(cache) => cache.get_or_insert(&function_id, f).to_owned(),
+        Some(cache) => cache.get_or_insert(&function_id, f),
         None => {
             let cache = MatchedFunctionCache::default();
-            let matched = cache.get_or_insert(&function_id, f).to_owned();
+            let matched = cache.get_or_insert(&function_id, f);
             function_cache.insert(view_id, cache);
             matched
         }
@@ -61,11 +113,7 @@ pub fn try_cached_function_match(function: &BNFunction) -> Option<Function> {
     let view_id = ViewID::from(view);
     let function_id = FunctionID::from(function);
     let function_cache = MATCHED_FUNCTION_CACHE.get_or_init(Default::default);
-    function_cache
-        .get(&view_id)?
-        .get(&function_id)?
-        .value()
-        .to_owned()
+    function_cache.get(&view_id)?.get(&function_id)?
 }
 
 pub fn cached_function<A: Architecture>(
@@ -173,32 +221,29 @@ pub fn cached_type_references(view: &BinaryView) -> Option<Ref<ViewID, TypeRefCa
 
 #[derive(Clone, Debug, Default)]
 pub struct MatchedFunctionCache {
-    pub cache: DashMap<FunctionID, Option<Function>>,
+    pub cache: BoundedCache<FunctionID, Option<Function>>,
 }
 
 impl MatchedFunctionCache {
-    pub fn get_or_insert<F>(
-        &self,
-        function_id: &FunctionID,
-        f: F,
-    ) -> Ref<'_, FunctionID, Option<Function>>
+    pub fn get_or_insert<F>(&self, function_id: &FunctionID, f: F) -> Option<Function>
     where
         F: FnOnce() -> Option<Function>,
     {
         self.cache.get(function_id).unwrap_or_else(|| {
-            self.cache.insert(*function_id, f());
-            self.cache.get(function_id).unwrap()
+            let matched = f();
+            self.cache.insert(*function_id, matched.clone());
+            matched
         })
     }
 
-    pub fn get(&self, function_id: &FunctionID) -> Option<Ref<'_, FunctionID, Option<Function>>> {
+    pub fn get(&self, function_id: &FunctionID) -> Option<Option<Function>> {
         self.cache.get(function_id)
     }
 }
 
 #[derive(Clone, Debug, Default)]
 pub struct FunctionCache {
-    pub cache: DashMap<FunctionID, Function>,
+    pub cache: BoundedCache<FunctionID, Function>,
 }
 
 impl FunctionCache {
@@ -209,7 +254,7 @@ impl FunctionCache {
     ) -> Function {
         let function_id = FunctionID::from(function);
         match self.cache.get(&function_id) {
-            Some(function) => function.value().to_owned(),
+            Some(function) => function,
             None => {
                 let function = build_function(function, llil);
                 self.cache.insert(function_id, function.clone());
@@ -389,6 +434,191 @@ impl TypeRefCache {
     }
 }
 
+/// Approximate heap and inline size of a cached value, for the memory budget.
+pub trait CacheWeight {
+    fn cache_weight(&self) -> usize;
+}
+
+impl CacheWeight for Function {
+    fn cache_weight(&self) -> usize {
+        // The type is left out, walking it on every insert would cost more than the estimate is worth.
+        let constraint_count = self.constraints.adjacent.len() + self.constraints.call_sites.len();
+        std::mem::size_of::<Self>()
+            + self.symbol.name.len()
+            + constraint_count * std::mem::size_of::<FunctionConstraint>()
+    }
+}
+
+impl<T: CacheWeight> CacheWeight for Option<T> {
+    fn cache_weight(&self) -> usize {
+        self.as_ref()
+            .map_or(std::mem::size_of::<Self>(), CacheWeight::cache_weight)
+    }
+}
+
+#[derive(Copy, Clone, Debug, Default)]
+pub struct CacheStats {
+    pub entries: usize,
+    /// Approximate, see [`CacheWeight`].
+    pub bytes: usize,
+    pub hits: u64,
+    pub misses: u64,
+    pub evictions: u64,
+}
+
+impl CacheStats {
+    pub fn hit_rate(&self) -> f64 {
+        match self.hits + self.misses {
+            0 => 0.0,
+            lookups => self.hits as f64 / lookups as f64,
+        }
+    }
+}
+
+#[derive(Debug)]
+struct BoundedEntry<V> {
+    value: V,
+    weight: usize,
+    last_used: AtomicU64,
+}
+
+/// A concurrent map that evicts its least recently used entries once it goes over
+/// [`set_cache_limits`], counting hits and approximate memory as it goes.
+#[derive(Debug)]
+pub struct BoundedCache<K: Eq + Hash, V> {
+    entries: DashMap<K, BoundedEntry<V>>,
+    clock: AtomicU64,
+    bytes: AtomicUsize,
+    /// Inserts since the last eviction, see [`BoundedCache::insert`].
+    inserts_since_evict: AtomicUsize,
+    hits: AtomicU64,
+    misses: AtomicU64,
+    evictions: AtomicU64,
+}
+
+impl<K: Eq + Hash, V> Default for BoundedCache<K, V> {
+    fn default() -> Self {
+        Self {
+            entries: DashMap::new(),
+            clock: AtomicU64::new(0),
+            bytes: AtomicUsize::new(0),
+            inserts_since_evict: AtomicUsize::new(0),
+            hits: AtomicU64::new(0),
+            misses: AtomicU64::new(0),
+            evictions: AtomicU64::new(0),
+        }
+    }
+}
+
+impl<K: Eq + Hash + Clone, V: Clone + CacheWeight> Clone for BoundedCache<K, V> {
+    fn clone(&self) -> Self {
+        let cache = Self::default();
+        for entry in self.entries.iter() {
+            cache.insert(entry.key().clone(), entry.value.clone());
+        }
+        cache
+    }
+}
+
+impl<K: Eq + Hash, V> Drop for BoundedCache<K, V> {
+    fn drop(&mut self) {
+        TOTAL_CACHE_BYTES.fetch_sub(*self.bytes.get_mut(), Ordering::Relaxed);
+    }
+}
+
+impl<K: Eq + Hash + Clone, V: Clone + CacheWeight> BoundedCache<K, V> {
+    pub fn get(&self, key: &K) -> Option<V> {
+        match self.entries.get(key) {
+            Some(entry) => {
+                self.hits.fetch_add(1, Ordering::Relaxed);
+                let now = self.clock.fetch_add(1, Ordering::Relaxed);
+                entry.last_used.store(now, Ordering::Relaxed);
+                Some(entry.value.clone())
+            }
+            None => {
+                self.misses.fetch_add(1, Ordering::Relaxed);
+                None
+            }
+        }
+    }
+
+    pub fn insert(&self, key: K, value: V) {
+        let weight = std::mem::size_of::<K>() + value.cache_weight();
+        let entry = BoundedEntry {
+            value,
+            weight,
+            last_used: AtomicU64::new(self.clock.fetch_add(1, Ordering::Relaxed)),
+        };
+        self.add_bytes(weight);
+        if let Some(old) = self.entries.insert(key, entry) {
+            self.sub_bytes(old.weight);
+        }
+
+        // Eviction scans every entry, so for the global budget only do it once an eighth of the cache has been
+        // inserted since the last one. Otherwise a cache would rescan on every insert while other views keep the
+        // budget exceeded. Going over the entry limit already implies that many inserts since the last eviction.
+        let inserts = self.inserts_since_evict.fetch_add(1, Ordering::Relaxed) + 1;
+        let len = self.entries.len();
+        let max_entries = MAX_ENTRIES_PER_VIEW.load(Ordering::Relaxed);
+        let budget = MEMORY_BUDGET.load(Ordering::Relaxed);
+        let over_budget = budget != 0 && total_cache_bytes() > budget;
+        if len > max_entries || (over_budget && inserts >= (len / 8).max(1)) {
+            self.inserts_since_evict.store(0, Ordering::Relaxed);
+            self.evict(max_entries);
+        }
+    }
+
+    pub fn len(&self) -> usize {
+        self.entries.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.entries.is_empty()
+    }
+
+    pub fn stats(&self) -> CacheStats {
+        CacheStats {
+            entries: self.entries.len(),
+            bytes: self.bytes.load(Ordering::Relaxed),
+            hits: self.hits.load(Ordering::Relaxed),
+            misses: self.misses.load(Ordering::Relaxed),
+            evictions: self.evictions.load(Ordering::Relaxed),
+        }
+    }
+
+    /// Drop the least recently used eighth of the entries, or enough to get back under `max_entries`.
+    fn evict(&self, max_entries: usize) {
+        let mut ages: Vec<(u64, K)> = self
+            .entries
+            .iter()
+            .map(|entry| (entry.last_used.load(Ordering::Relaxed), entry.key().clone()))
+            .collect();
+        let count = (ages.len() / 8)
+            .max(ages.len().saturating_sub(max_entries))
+            .max(1)
+            .min(ages.len());
+        if count < ages.len() {
+            ages.select_nth_unstable_by_key(count, |(age, _)| *age);
+        }
+        for (_, key) in ages.into_iter().take(count) {
+            if let Some((_, old)) = self.entries.remove(&key) {
+                self.sub_bytes(old.weight);
+                self.evictions.fetch_add(1, Ordering::Relaxed);
+            }
+        }
+    }
+
+    fn add_bytes(&self, bytes: usize) {
+        self.bytes.fetch_add(bytes, Ordering::Relaxed);
+        TOTAL_CACHE_BYTES.fetch_add(bytes, Ordering::Relaxed);
+    }
+
+    fn sub_bytes(&self, bytes: usize) {
+        self.bytes.fetch_sub(bytes, Ordering::Relaxed);
+        TOTAL_CACHE_BYTES.fetch_sub(bytes, Ordering::Relaxed);
+    }
+}
+
 /// A unique view ID, used for caching.
 #[derive(Copy, Clone, Debug, Hash, PartialEq, Eq, PartialOrd, Ord)]
 pub struct ViewID(u64);
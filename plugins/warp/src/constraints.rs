@@ -0,0 +1,95 @@
+//! Function constraints reduced to sorted 64-bit keys.
+//!
+//! Matching a function with many candidates used to build a fresh `HashSet` per candidate per
+//! constraint kind just to count the overlap with the observed constraints. Reducing each kind to a
+//! sorted, deduplicated `u64` array once turns that into a linear merge with no allocation.
+
+use std::hash::{DefaultHasher, Hash, Hasher};
+use warp::signature::function::constraints::FunctionConstraint;
+use warp::signature::function::{Function, FunctionGUID};
+
+/// The constraints of one function, split by kind and keyed for [`intersection_count`].
+#[derive(Debug, Clone, Default, PartialEq, Eq)]
+pub struct ConstraintKeys {
+    pub adjacent_symbols: Vec<u64>,
+    pub adjacent_guids: Vec<u64>,
+    pub call_site_symbols: Vec<u64>,
+    pub call_site_guids: Vec<u64>,
+}
+
+impl ConstraintKeys {
+    pub fn new<'a>(
+        adjacent: impl IntoIterator<Item = &'a FunctionConstraint>,
+        call_sites: impl IntoIterator<Item = &'a FunctionConstraint>,
+    ) -> Self {
+        let mut keys = Self::default();
+        for constraint in adjacent {
+            push_constraint(
+                constraint,
+                &mut keys.adjacent_symbols,
+                &mut keys.adjacent_guids,
+            );
+        }
+        for constraint in call_sites {
+            push_constraint(
+                constraint,
+                &mut keys.call_site_symbols,
+                &mut keys.call_site_guids,
+            );
+        }
+        for list in [
+            &mut keys.adjacent_symbols,
+            &mut keys.adjacent_guids,
+            &mut keys.call_site_symbols,
+            &mut keys.call_site_guids,
+        ] {
+            list.sort_unstable();
+            list.dedup();
+        }
+        keys
+    }
+
+    pub fn from_function(function: &Function) -> Self {
+        Self::new(
+            &function.constraints.adjacent,
+            &function.constraints.call_sites,
+        )
+    }
+}
+
+fn push_constraint(constraint: &FunctionConstraint, symbols: &mut Vec<u64>, guids: &mut Vec<u64>) {
+    if let Some(symbol) = &constraint.symbol {
+        symbols.push(symbol_key(&symbol.name));
+    }
+    if let Some(guid) = &constraint.guid {
+        guids.push(guid_key(guid));
+    }
+}
+
+pub fn symbol_key(name: &str) -> u64 {
+    let mut hasher = DefaultHasher::new();
+    name.hash(&mut hasher);
+    hasher.finish()
+}
+
+pub fn guid_key(guid: &FunctionGUID) -> u64 {
+    // GUIDs are already uniformly distributed, folding the halves keeps that.
+    let bytes = guid.guid.as_bytes();
+    let (high, low) = bytes.split_at(8);
+    u64::from_le_bytes(high.try_into().unwrap()) ^ u64::from_le_bytes(low.try_into().unwrap())
+}
+
+/// Number of keys in both sorted, deduplicated slices.
+///
+/// The merge advances both cursors without data dependent branches so it vectorizes and doesn't suffer
+/// from mispredictions on the random-looking keys.
+pub fn intersection_count(a: &[u64], b: &[u64]) -> usize {
+    let (mut i, mut j, mut count) = (0, 0, 0);
+    while i < a.len() && j < b.len() {
+        let (x, y) = (a[i], b[j]);
+        count += (x == y) as usize;
+        i += (x <= y) as usize;
+        j += (y <= x) as usize;
+    }
+    count
+}
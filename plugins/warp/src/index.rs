@@ -0,0 +1,255 @@
+//! On-disk, memory mapped index of a signature file's functions keyed by [`FunctionGUID`].
+//!
+//! Decoding an entire signature file up front costs both startup time and memory for functions that
+//! will never be looked up. The index stores every function as its own small record, sorted by GUID,
+//! so a lookup is a binary search over the mapped entry table and only the matching records get decoded.
+//!
+//! Layout (all integers little endian):
+//!
+//! ```text
+//! header:  magic [u8; 8], source_len u64, source_modified u64, entry_count u64,
+//!          types_offset u64, types_len u64, source_path_len u64, source_path [u8]
+//! entries: entry_count * (guid [u8; 16], record_offset u64, record_len u64), sorted by guid
+//! records: one serialized `Data` per function, then one `Data` holding all the types
+//! ```
+//!
+//! An index is keyed by the source file path and rebuilt whenever its size or modification time changes.
+
+use memmap2::Mmap;
+use std::fs::File;
+use std::hash::{DefaultHasher, Hash, Hasher};
+use std::io::Write;
+use std::path::{Path, PathBuf};
+use std::time::UNIX_EPOCH;
+use warp::r#type::ComputedType;
+use warp::signature::function::{Function, FunctionGUID};
+use warp::signature::Data;
+
+const INDEX_MAGIC: &[u8; 8] = b"WARPIDX1";
+const HEADER_LEN: usize = 56;
+const ENTRY_LEN: usize = 32;
+
+#[derive(Debug)]
+enum IndexBytes {
+    Mapped(Mmap),
+    /// Used when the index could not be written out, so the signatures still load.
+    Owned(Vec<u8>),
+}
+
+impl std::ops::Deref for IndexBytes {
+    type Target = [u8];
+
+    fn deref(&self) -> &[u8] {
+        match self {
+            IndexBytes::Mapped(mmap) => mmap,
+            IndexBytes::Owned(bytes) => bytes,
+        }
+    }
+}
+
+#[derive(Debug)]
+pub struct SignatureIndex {
+    bytes: IndexBytes,
+    entry_count: usize,
+    entries_offset: usize,
+}
+
+impl SignatureIndex {
+    /// Directory the indexes for signature files are kept in.
+    pub fn index_dir() -> PathBuf {
+        binaryninja::user_directory().join("warp/index")
+    }
+
+    /// Open the index for the signature file at `source`, building it first if it is missing or stale.
+    pub fn open_or_build(source: &Path) -> Option<Self> {
+        let (source_len, source_modified) = source_stamp(source)?;
+        let index_path = index_path_for(source);
+        if let Some(index) = Self::open(&index_path) {
+            if index.is_for(source, source_len, source_modified) {
+                return Some(index);
+            }
+        }
+
+        let contents = std::fs::read(source).ok()?;
+        let data = Data::from_bytes(&contents)?;
+        let bytes = Self::build(source, source_len, source_modified, data);
+        match write_atomically(&index_path, &bytes) {
+            Ok(()) => Self::open(&index_path),
+            Err(err) => {
+                // Still usable for this session, it just gets rebuilt next time.
+                log::warn!("Failed to write signature index {:?}: {}", index_path, err);
+                Self::from_bytes(IndexBytes::Owned(bytes))
+            }
+        }
+    }
+
+    /// Map an existing index file, checking that its tables fit within the file.
+    pub fn open(path: &Path) -> Option<Self> {
+        let file = File::open(path).ok()?;
+        // SAFETY: Index files are only ever replaced by rename, never modified in place.
+        let mmap = unsafe { Mmap::map(&file) }.ok()?;
+        Self::from_bytes(IndexBytes::Mapped(mmap))
+    }
+
+    fn from_bytes(bytes: IndexBytes) -> Option<Self> {
+        if bytes.len() < HEADER_LEN || &bytes[0..8] != INDEX_MAGIC {
+            return None;
+        }
+        let entry_count = read_u64(&bytes, 24)? as usize;
+        let types_offset = read_u64(&bytes, 32)? as usize;
+        let types_len = read_u64(&bytes, 40)? as usize;
+        let path_len = read_u64(&bytes, 48)? as usize;
+        let entries_offset = HEADER_LEN.checked_add(path_len)?;
+        let entries_end = entry_count
+            .checked_mul(ENTRY_LEN)?
+            .checked_add(entries_offset)?;
+        if entries_end > bytes.len() || types_offset.checked_add(types_len)? > bytes.len() {
+            return None;
+        }
+        Some(Self {
+            bytes,
+            entry_count,
+            entries_offset,
+        })
+    }
+
+    /// Serialize `data` into the index format.
+    pub fn build(source: &Path, source_len: u64, source_modified: u64, data: Data) -> Vec<u8> {
+        let source_path = source.to_string_lossy();
+        let entries_offset = HEADER_LEN + source_path.len();
+        let records_offset = entries_offset + data.functions.len() * ENTRY_LEN;
+
+        let mut entries = Vec::with_capacity(data.functions.len());
+        let mut records = Vec::new();
+        for func in data.functions {
+            let guid = *func.guid.guid.as_bytes();
+            let mut record = Data::default();
+            record.functions.push(func);
+            let record = record.to_bytes();
+            entries.push((guid, records_offset + records.len(), record.len()));
+            records.extend_from_slice(&record);
+        }
+        entries.sort_by(|a, b| a.0.cmp(&b.0));
+
+        let mut types = Data::default();
+        types.types = data.types;
+        let types = types.to_bytes();
+        let types_offset = records_offset + records.len();
+
+        let mut bytes = Vec::with_capacity(types_offset + types.len());
+        bytes.extend_from_slice(INDEX_MAGIC);
+        bytes.extend_from_slice(&source_len.to_le_bytes());
+        bytes.extend_from_slice(&source_modified.to_le_bytes());
+        bytes.extend_from_slice(&(entries.len() as u64).to_le_bytes());
+        bytes.extend_from_slice(&(types_offset as u64).to_le_bytes());
+        bytes.extend_from_slice(&(types.len() as u64).to_le_bytes());
+        bytes.extend_from_slice(&(source_path.len() as u64).to_le_bytes());
+        bytes.extend_from_slice(source_path.as_bytes());
+        for (guid, offset, len) in entries {
+            bytes.extend_from_slice(&guid);
+            bytes.extend_from_slice(&(offset as u64).to_le_bytes());
+            bytes.extend_from_slice(&(len as u64).to_le_bytes());
+        }
+        bytes.extend_from_slice(&records);
+        bytes.extend_from_slice(&types);
+        bytes
+    }
+
+    /// Number of functions in the index.
+    pub fn len(&self) -> usize {
+        self.entry_count
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.entry_count == 0
+    }
+
+    /// Decode only the functions with the given GUID.
+    pub fn functions(&self, guid: &FunctionGUID) -> Vec<Function> {
+        let key = guid.guid.as_bytes();
+        let first = partition_point(self.entry_count, |i| self.entry_guid(i) < &key[..]);
+        (first..self.entry_count)
+            .take_while(|&i| self.entry_guid(i) == &key[..])
+            .filter_map(|i| {
+                let entry = self.entries_offset + i * ENTRY_LEN;
+                let offset = read_u64(&self.bytes, entry + 16)? as usize;
+                let len = read_u64(&self.bytes, entry + 24)? as usize;
+                let record = self.bytes.get(offset..offset.checked_add(len)?)?;
+                Data::from_bytes(record)?.functions.pop()
+            })
+            .collect()
+    }
+
+    /// Decode the types stored alongside the functions.
+    pub fn types(&self) -> Vec<ComputedType> {
+        let (Some(offset), Some(len)) = (read_u64(&self.bytes, 32), read_u64(&self.bytes, 40))
+        else {
+            return Vec::new();
+        };
+        self.bytes
+            .get(offset as usize..offset.saturating_add(len) as usize)
+            .and_then(Data::from_bytes)
+            .map(|data| data.types)
+            .unwrap_or_default()
+    }
+
+    fn is_for(&self, source: &Path, source_len: u64, source_modified: u64) -> bool {
+        let path_len = self.entries_offset - HEADER_LEN;
+        read_u64(&self.bytes, 8) == Some(source_len)
+            && read_u64(&self.bytes, 16) == Some(source_modified)
+            && self.bytes[HEADER_LEN..HEADER_LEN + path_len] == *source.to_string_lossy().as_bytes()
+    }
+
+    fn entry_guid(&self, index: usize) -> &[u8] {
+        let entry = self.entries_offset + index * ENTRY_LEN;
+        &self.bytes[entry..entry + 16]
+    }
+}
+
+fn partition_point(len: usize, pred: impl Fn(usize) -> bool) -> usize {
+    let (mut low, mut high) = (0, len);
+    while low < high {
+        let mid = low + (high - low) / 2;
+        if pred(mid) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    low
+}
+
+fn read_u64(bytes: &[u8], offset: usize) -> Option<u64> {
+    let slice = bytes.get(offset..offset.checked_add(8)?)?;
+    Some(u64::from_le_bytes(slice.try_into().ok()?))
+}
+
+fn source_stamp(source: &Path) -> Option<(u64, u64)> {
+    let metadata = std::fs::metadata(source).ok()?;
+    let modified = metadata
+        .modified()
+        .ok()?
+        .duration_since(UNIX_EPOCH)
+        .ok()?
+        .as_nanos() as u64;
+    Some((metadata.len(), modified))
+}
+
+fn index_path_for(source: &Path) -> PathBuf {
+    // The hash only picks the file name, the full source path is checked from the header.
+    let mut hasher = DefaultHasher::new();
+    source.hash(&mut hasher);
+    SignatureIndex::index_dir().join(format!("{:016x}.idx", hasher.finish()))
+}
+
+fn write_atomically(path: &Path, bytes: &[u8]) -> std::io::Result<()> {
+    if let Some(parent) = path.parent() {
+        std::fs::create_dir_all(parent)?;
+    }
+    let partial = path.with_extension("idx.part");
+    let mut file = File::create(&partial)?;
+    file.write_all(bytes)?;
+    file.sync_all()?;
+    drop(file);
+    std::fs::rename(&partial, path)
+}
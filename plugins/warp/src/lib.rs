@@ -24,7 +24,9 @@ use warp::signature::function::constraints::FunctionConstraints;
 use warp::signature::function::{Function, FunctionGUID};
 
 pub mod cache;
+pub mod constraints;
 pub mod convert;
+mod index;
 mod matcher;
 /// Only used when compiled for cdylib target.
 mod plugin;
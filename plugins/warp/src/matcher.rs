@@ -4,13 +4,16 @@ use binaryninja::function::Function as BNFunction;
 use binaryninja::platform::Platform;
 use binaryninja::rc::Guard;
 use binaryninja::rc::Ref as BNRef;
+use dashmap::mapref::one::Ref;
 use dashmap::DashMap;
+use rayon::prelude::*;
 use serde_json::json;
+use std::cell::Cell;
 use std::cmp::Ordering;
 use std::collections::{HashMap, HashSet};
-use std::hash::{DefaultHasher, Hash, Hasher};
+use std::hash::{DefaultHasher, Hasher};
 use std::path::PathBuf;
-use std::sync::OnceLock;
+use std::sync::{Arc, OnceLock};
 use walkdir::{DirEntry, WalkDir};
 use warp::r#type::class::TypeClass;
 use warp::r#type::guid::TypeGUID;
@@ -19,10 +22,12 @@ use warp::signature::function::{Function, FunctionGUID};
 use warp::signature::Data;
 
 use crate::cache::{
-    cached_adjacency_constraints, cached_call_site_constraints, cached_function_match,
-    try_cached_function_guid,
+    cached_adjacency_constraints, cached_call_site_constraints, cached_function_guid,
+    cached_function_match, try_cached_function_guid,
 };
+use crate::constraints::{intersection_count, ConstraintKeys};
 use crate::convert::to_bn_type;
+use crate::index::SignatureIndex;
 use crate::plugin::on_matched_function;
 use crate::{core_signature_dir, user_signature_dir};
 
@@ -42,6 +47,50 @@ pub fn cached_function_matcher(function: &BNFunction) {
     }
 }
 
+/// Match every function in the view.
+///
+/// GUIDs and matches are computed for all functions in parallel, then the matches and the types they
+/// reference are applied from the calling thread, each type only once. The caller is expected to wrap
+/// this in a single undo action and analysis update.
+pub fn match_view_functions(view: &BinaryView) -> usize {
+    let functions = view.functions();
+
+    // Build each platform's matcher up front so the parallel pass only ever reads the cache.
+    let matcher_cache = PLAT_MATCHER_CACHE.get_or_init(Default::default);
+    for function in functions.iter() {
+        let platform = function.platform();
+        let platform_id = PlatformID::from(platform.as_ref());
+        if !matcher_cache.contains_key(&platform_id) {
+            matcher_cache.insert(platform_id, Matcher::from_platform(platform));
+        }
+    }
+
+    let matches: Vec<_> = functions
+        .par_iter()
+        .filter_map(|function| {
+            if try_cached_function_guid(&function).is_none() {
+                let llil = function.low_level_il().ok()?;
+                cached_function_guid(&function, &llil);
+            }
+            let platform_id = PlatformID::from(function.platform());
+            let matcher = matcher_cache.get(&platform_id)?;
+            let (matched, is_new) = matcher.find_match(&function)?;
+            Some((function.to_owned(), platform_id, matched, is_new))
+        })
+        .collect();
+
+    let mut added_types = HashSet::new();
+    for (function, platform_id, matched, is_new) in &matches {
+        if *is_new {
+            if let Some(matcher) = matcher_cache.get(platform_id) {
+                matcher.resolve_function_types(function, matched, &mut added_types);
+            }
+        }
+        on_matched_function(function, matched);
+    }
+    matches.len()
+}
+
 // TODO: Maybe just clear individual platforms? This works well enough either way.
 pub fn invalidate_function_matcher_cache() {
     let matcher_cache = PLAT_MATCHER_CACHE.get_or_init(Default::default);
@@ -54,6 +103,12 @@ pub struct Matcher {
     // TODO: If we want scoped or view settings they must be moved out.
     pub settings: MatcherSettings,
     pub functions: DashMap<FunctionGUID, Vec<Function>>,
+    /// Signature file indexes, searched in addition to `functions` and only decoded on lookup.
+    pub indexes: Vec<Arc<SignatureIndex>>,
+    /// Every GUID looked up so far, combining `functions` with what the indexes had for it.
+    decoded: DashMap<FunctionGUID, Vec<Function>>,
+    /// Constraint keys of the candidates for a GUID, in the same order as the candidates.
+    constraint_keys: DashMap<FunctionGUID, Arc<Vec<ConstraintKeys>>>,
     pub types: DashMap<TypeGUID, Type>,
     pub named_types: DashMap<String, Type>,
 }
@@ -66,14 +121,41 @@ impl Matcher {
         // Get core and user signatures.
         // TODO: Separate each file into own bucket for filtering?
         let plat_core_sig_dir = core_signature_dir().join(&platform_name);
-        let mut data = get_data_from_dir(&plat_core_sig_dir);
+        let mut indexes = get_indexes_from_dir(&plat_core_sig_dir);
         let plat_user_sig_dir = user_signature_dir().join(&platform_name);
-        let user_data = get_data_from_dir(&plat_user_sig_dir);
+        let user_indexes = get_indexes_from_dir(&plat_user_sig_dir);
 
-        data.extend(user_data);
-        let merged_data = Data::merge(data.values().cloned().collect::<Vec<_>>());
-        log::debug!("Loaded signatures: {:?}", data.keys());
-        Matcher::from_data(merged_data)
+        indexes.extend(user_indexes);
+        log::debug!("Loaded signatures: {:?}", indexes.keys());
+        Matcher::from_indexes(indexes.into_values().collect())
+    }
+
+    /// Create a matcher that decodes functions from the indexes only as they are looked up.
+    ///
+    /// Types are small next to the functions and are needed whole to resolve references, so they are
+    /// still decoded up front.
+    pub fn from_indexes(indexes: Vec<Arc<SignatureIndex>>) -> Self {
+        let types = DashMap::new();
+        let named_types = DashMap::new();
+        for index in &indexes {
+            for ty in index.types() {
+                if let Some(name) = ty.ty.name.to_owned() {
+                    named_types.insert(name, ty.ty.clone());
+                }
+                types.insert(ty.guid, ty.ty);
+            }
+        }
+
+        Self {
+            // NOTE: Settings will be retrieved from global state every time this is called.
+            settings: MatcherSettings::global(),
+            functions: DashMap::new(),
+            indexes,
+            decoded: DashMap::new(),
+            constraint_keys: DashMap::new(),
+            types,
+            named_types,
+        }
     }
 
     pub fn from_data(data: Data) -> Self {
@@ -99,6 +181,9 @@ impl Matcher {
             // NOTE: Settings will be retrieved from global state every time this is called.
             settings: MatcherSettings::global(),
             functions,
+            indexes: Vec::new(),
+            decoded: DashMap::new(),
+            constraint_keys: DashMap::new(),
             types,
             named_types,
         }
@@ -106,6 +191,10 @@ impl Matcher {
 
     pub fn extend_with_matcher(&mut self, matcher: Matcher) {
         self.functions.extend(matcher.functions);
+        self.indexes.extend(matcher.indexes);
+        // Earlier lookups did not see the new functions.
+        self.decoded.clear();
+        self.constraint_keys.clear();
         self.types.extend(matcher.types);
         self.named_types.extend(matcher.named_types);
     }
@@ -195,23 +284,43 @@ impl Matcher {
     }
 
     pub fn match_function(&self, function: &BNFunction) {
-        // Call this the first time you matched on the function.
-        let resolve_new_types = |matched: &Function| {
-            // We also want to resolve the types here.
-            if let TypeClass::Function(c) = matched.ty.class.as_ref() {
-                // Recursively go through the function type and resolve referrers
-                let view = function.view();
-                let arch = function.arch();
-                for out_member in &c.out_members {
-                    self.add_type_to_view(&view, &arch, &out_member.ty);
-                }
-                for in_member in &c.in_members {
-                    self.add_type_to_view(&view, &arch, &in_member.ty);
+        if let Some((matched_function, is_new)) = self.find_match(function) {
+            // Only resolve the types the first time we matched on the function.
+            if is_new {
+                self.resolve_function_types(function, &matched_function, &mut HashSet::new());
+            }
+            on_matched_function(function, &matched_function);
+        }
+    }
+
+    /// Add the types referenced by the matched function's type to the view.
+    ///
+    /// Types already in `added` are skipped, pass the same set to share that work between functions.
+    pub fn resolve_function_types(
+        &self,
+        function: &BNFunction,
+        matched: &Function,
+        added: &mut HashSet<TypeGUID>,
+    ) {
+        if let TypeClass::Function(c) = matched.ty.class.as_ref() {
+            // Recursively go through the function type and resolve referrers
+            let view = function.view();
+            let arch = function.arch();
+            for member_ty in c.out_members.iter().chain(&c.in_members).map(|m| &m.ty) {
+                if added.insert(TypeGUID::from(member_ty)) {
+                    self.add_type_to_view(&view, &arch, member_ty);
                 }
             }
-        };
+        }
+    }
 
-        if let Some(matched_function) = cached_function_match(function, || {
+    /// Find the signature matching the function without applying anything.
+    ///
+    /// Returns the match and whether this is the first time the function was matched.
+    pub fn find_match(&self, function: &BNFunction) -> Option<(Function, bool)> {
+        let is_new = Cell::new(false);
+        let matched = cached_function_match(function, || {
+            is_new.set(true);
             // We have yet to match on this function.
             let function_len = function.highest_address() - function.lowest_address();
             let is_function_trivial = { function_len < self.settings.trivial_function_len };
@@ -220,22 +329,53 @@ impl Matcher {
                     && function_len < self.settings.maximum_function_len.unwrap_or(u64::MAX)
             };
             let warp_func_guid = try_cached_function_guid(function)?;
-            match self.functions.get(&warp_func_guid) {
+            match self.functions_for_guid(&warp_func_guid) {
                 _ if !is_function_allowed => None,
                 Some(matched) if matched.len() == 1 && !is_function_trivial => {
-                    resolve_new_types(&matched[0]);
                     Some(matched[0].to_owned())
                 }
                 Some(matched) => {
                     let matched_on = self.match_function_from_constraints(function, &matched)?;
-                    resolve_new_types(matched_on);
                     Some(matched_on.to_owned())
                 }
                 None => None,
             }
-        }) {
-            on_matched_function(function, &matched_function);
+        })?;
+        Some((matched, is_new.get()))
+    }
+
+    /// Functions with the given GUID, decoding them from the indexes the first time it is looked up.
+    pub fn functions_for_guid(
+        &self,
+        guid: &FunctionGUID,
+    ) -> Option<Ref<'_, FunctionGUID, Vec<Function>>> {
+        if self.indexes.is_empty() {
+            return self.functions.get(guid);
+        }
+        // Misses are kept as empty lists so they aren't searched for again.
+        let funcs = self
+            .decoded
+            .entry(*guid)
+            .or_insert_with(|| self.collect_functions(guid))
+            .downgrade();
+        (!funcs.is_empty()).then_some(funcs)
+    }
+
+    fn collect_functions(&self, guid: &FunctionGUID) -> Vec<Function> {
+        let mut funcs = self
+            .functions
+            .get(guid)
+            .map(|funcs| funcs.clone())
+            .unwrap_or_default();
+        for index in &self.indexes {
+            // The same function is often in more than one signature file, keep a single copy like `Data::merge`.
+            for func in index.functions(guid) {
+                if !funcs.contains(&func) {
+                    funcs.push(func);
+                }
+            }
         }
+        funcs
     }
 
     pub fn match_function_from_constraints<'a>(
@@ -256,20 +396,19 @@ impl Matcher {
         let adjacent = cached_adjacency_constraints(function, adjacent_function_filter);
 
         // "common" being the intersection between the observed and matched.
-        fn find_highest_common_count<'a, F, T>(
-            observed_items: &HashSet<T>,
+        fn find_highest_common_count<'a, F>(
+            observed_keys: &[u64],
             matched_functions: &'a [Function],
-            extract_items: F,
+            matched_keys: &[ConstraintKeys],
+            extract_keys: F,
         ) -> (usize, Option<&'a Function>)
         where
-            F: Fn(&Function) -> HashSet<T>,
-            T: Hash + Eq,
+            F: Fn(&ConstraintKeys) -> &[u64],
         {
             let mut highest_count = 0;
             let mut matched_func = None;
-            for matched in matched_functions {
-                let matched_items = extract_items(matched);
-                let common_count = observed_items.intersection(&matched_items).count();
+            for (matched, keys) in matched_functions.iter().zip(matched_keys) {
+                let common_count = intersection_count(observed_keys, extract_keys(keys));
                 match common_count.cmp(&highest_count) {
                     Ordering::Equal => matched_func = None,
                     Ordering::Greater => {
@@ -282,51 +421,35 @@ impl Matcher {
             (highest_count, matched_func)
         }
 
-        let call_site_guids: HashSet<_> = call_sites.iter().filter_map(|c| c.guid).collect();
-        let call_site_symbol_names: HashSet<_> = call_sites
-            .into_iter()
-            .filter_map(|c| c.symbol.map(|s| s.name))
-            .collect();
-        let adjacent_guids: HashSet<_> = adjacent.iter().filter_map(|c| c.guid).collect();
-        let adjacent_symbol_names: HashSet<_> = adjacent
-            .into_iter()
-            .filter_map(|c| c.symbol.map(|s| s.name))
-            .collect();
+        let observed = ConstraintKeys::new(&adjacent, &call_sites);
+        let matched_keys = self.candidate_constraint_keys(matched_functions);
 
         // Ordered from the lowest confidence to the highest confidence constraint.
         let checked_constraints = [
-            find_highest_common_count(&adjacent_symbol_names, matched_functions, |matched| {
-                matched
-                    .constraints
-                    .adjacent
-                    .iter()
-                    .filter_map(|c| c.symbol.to_owned().map(|s| s.name))
-                    .collect()
-            }),
-            find_highest_common_count(&adjacent_guids, matched_functions, |matched| {
-                matched
-                    .constraints
-                    .adjacent
-                    .iter()
-                    .filter_map(|c| c.guid)
-                    .collect()
-            }),
-            find_highest_common_count(&call_site_symbol_names, matched_functions, |matched| {
-                matched
-                    .constraints
-                    .call_sites
-                    .iter()
-                    .filter_map(|c| c.symbol.to_owned().map(|s| s.name))
-                    .collect()
-            }),
-            find_highest_common_count(&call_site_guids, matched_functions, |matched| {
-                matched
-                    .constraints
-                    .call_sites
-                    .iter()
-                    .filter_map(|c| c.guid)
-                    .collect()
-            }),
+            find_highest_common_count(
+                &observed.adjacent_symbols,
+                matched_functions,
+                &matched_keys,
+                |keys| &keys.adjacent_symbols,
+            ),
+            find_highest_common_count(
+                &observed.adjacent_guids,
+                matched_functions,
+                &matched_keys,
+                |keys| &keys.adjacent_guids,
+            ),
+            find_highest_common_count(
+                &observed.call_site_symbols,
+                matched_functions,
+                &matched_keys,
+                |keys| &keys.call_site_symbols,
+            ),
+            find_highest_common_count(
+                &observed.call_site_guids,
+                matched_functions,
+                &matched_keys,
+                |keys| &keys.call_site_guids,
+            ),
         ];
 
         // If there is a tie, the last one wins, which should be call_site guid.
@@ -336,20 +459,49 @@ impl Matcher {
             .filter(|&(count, _)| count >= self.settings.minimum_matched_constraints)
             .and_then(|(_, func)| func)
     }
+
+    /// Keys for the constraints of every candidate, computed once per GUID.
+    fn candidate_constraint_keys(
+        &self,
+        matched_functions: &[Function],
+    ) -> Arc<Vec<ConstraintKeys>> {
+        let build = || {
+            Arc::new(
+                matched_functions
+                    .iter()
+                    .map(ConstraintKeys::from_function)
+                    .collect(),
+            )
+        };
+        let Some(first) = matched_functions.first() else {
+            return Arc::new(Vec::new());
+        };
+        // Candidates normally all share a GUID, anything else is just not cached.
+        if matched_functions.iter().any(|f| f.guid != first.guid) {
+            return build();
+        }
+        let keys = self
+            .constraint_keys
+            .entry(first.guid)
+            .or_insert_with(build)
+            .clone();
+        if keys.len() == matched_functions.len() {
+            keys
+        } else {
+            build()
+        }
+    }
 }
 
-fn get_data_from_dir(dir: &PathBuf) -> HashMap<PathBuf, Data> {
-    let data_from_entry = |entry: DirEntry| {
-        let path = entry.path();
-        let contents = std::fs::read(path).ok()?;
-        Data::from_bytes(&contents)
-    };
+fn get_indexes_from_dir(dir: &PathBuf) -> HashMap<PathBuf, Arc<SignatureIndex>> {
+    let index_from_entry =
+        |entry: &DirEntry| SignatureIndex::open_or_build(entry.path()).map(Arc::new);
 
     WalkDir::new(dir)
         .into_iter()
         .filter_map(|e| e.ok())
         .filter(|e| e.file_type().is_file())
-        .filter_map(|e| Some((e.clone().into_path(), data_from_entry(e)?)))
+        .filter_map(|e| Some((e.path().to_path_buf(), index_from_entry(&e)?)))
         .collect()
 }
 
@@ -1,6 +1,4 @@
-use crate::cache::{
-    register_cache_destructor, ViewID, FUNCTION_CACHE, GUID_CACHE, MATCHED_FUNCTION_CACHE,
-};
+use crate::cache::register_cache_destructor;
 use crate::convert::{to_bn_symbol_at_address, to_bn_type};
 use crate::matcher::{
     invalidate_function_matcher_cache, Matcher, MatcherSettings, PlatformID, PLAT_MATCHER_CACHE,
@@ -88,7 +86,7 @@ impl FunctionCommand for DebugMatcher {
         let matcher = Matcher::from_platform(platform);
         let func = build_function(function, &llil);
         // TODO: Clean this up.
-        if let Some(possible_matches) = matcher.functions.get(&func.guid) {
+        if let Some(possible_matches) = matcher.functions_for_guid(&func.guid) {
             let print_constraint = |prefix: &str, constraint: &FunctionConstraint| {
                 log::info!(
                     "    {} {} ({})",
@@ -130,21 +128,22 @@ struct DebugCache;
 
 impl Command for DebugCache {
     fn action(&self, view: &BinaryView) {
-        let view_id = ViewID::from(view);
-        let function_cache = FUNCTION_CACHE.get_or_init(Default::default);
-        if let Some(cache) = function_cache.get(&view_id) {
-            log::info!("View functions: {}", cache.cache.len());
-        }
-
-        let matched_function_cache = MATCHED_FUNCTION_CACHE.get_or_init(Default::default);
-        if let Some(cache) = matched_function_cache.get(&view_id) {
-            log::info!("View matched functions: {}", cache.cache.len());
-        }
-
-        let function_guid_cache = GUID_CACHE.get_or_init(Default::default);
-        if let Some(cache) = function_guid_cache.get(&view_id) {
-            log::info!("View function guids: {}", cache.cache.len());
-        }
+        let stats = cache::cache_stats(view);
+        let log_stats = |name: &str, stats: &cache::CacheStats| {
+            log::info!(
+                "View {}: {} (~{} bytes, {:.1}% hits, {} evicted)",
+                name,
+                stats.entries,
+                stats.bytes,
+                stats.hit_rate() * 100.0,
+                stats.evictions
+            );
+        };
+        log_stats("functions", &stats.functions);
+        log_stats("matched functions", &stats.matched_functions);
+        log::info!("View function guids: {}", stats.guids.entries);
+        log::info!("View type references: {}", stats.type_refs.entries);
+        log::info!("All views: ~{} bytes", cache::total_cache_bytes());
 
         let plat_cache = PLAT_MATCHER_CACHE.get_or_init(Default::default);
         if let Some(plat) = view.default_platform() {
@@ -1,13 +1,12 @@
 use crate::cache::{cached_function, cached_type_references};
 use crate::matcher::invalidate_function_matcher_cache;
 use crate::user_signature_dir;
+use binaryninja::background_task::BackgroundTaskProgress;
 use binaryninja::binary_view::{BinaryView, BinaryViewExt};
 use binaryninja::command::Command;
 use binaryninja::function::Function;
 use binaryninja::rc::Guard;
 use rayon::prelude::*;
-use std::sync::atomic::AtomicUsize;
-use std::sync::atomic::Ordering::Relaxed;
 use std::thread;
 use std::time::Instant;
 
@@ -29,11 +28,15 @@ impl Command for CreateSignatureFile {
         let view = view.to_owned();
         thread::spawn(move || {
             let total_functions = view.functions().len();
-            let done_functions = AtomicUsize::default();
             let background_task = binaryninja::background_task::BackgroundTask::new(
                 format!("Generating signatures... ({}/{})", 0, total_functions),
                 true,
             );
+            let progress = BackgroundTaskProgress::new(
+                background_task.clone(),
+                "Generating signatures...",
+                total_functions as u64,
+            );
 
             let start = Instant::now();
 
@@ -41,14 +44,7 @@ impl Command for CreateSignatureFile {
             data.functions.par_extend(
                 view.functions()
                     .par_iter()
-                    .inspect(|_| {
-                        done_functions.fetch_add(1, Relaxed);
-                        background_task.set_progress_text(format!(
-                            "Generating signatures... ({}/{})",
-                            done_functions.load(Relaxed),
-                            total_functions
-                        ))
-                    })
+                    .inspect(|_| progress.add(1))
                     .filter(is_function_named)
                     .filter(|f| !f.analysis_skipped())
                     .filter_map(|func| {
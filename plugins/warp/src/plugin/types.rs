@@ -1,6 +1,7 @@
 use crate::convert::to_bn_type;
 use binaryninja::binary_view::{BinaryView, BinaryViewExt};
 use binaryninja::command::Command;
+use binaryninja::types::QualifiedNameTypeAndId;
 use std::time::Instant;
 
 pub struct LoadTypes;
@@ -40,11 +41,22 @@ impl Command for LoadTypes {
             );
 
             let start = Instant::now();
-            for comp_ty in data.types {
-                let ty_id = comp_ty.guid.to_string();
-                let ty_name = comp_ty.ty.name.to_owned().unwrap_or_else(|| ty_id.clone());
-                view.define_auto_type_with_id(ty_name, ty_id, &to_bn_type(&arch, &comp_ty.ty));
-            }
+            // Define everything in one bulk call so the core resolves references and sends
+            // notifications once for the whole set instead of after every type.
+            let types = data.types.iter().map(|comp_ty| {
+                let id = comp_ty.guid.to_string();
+                let name = comp_ty.ty.name.to_owned().unwrap_or_else(|| id.clone());
+                QualifiedNameTypeAndId {
+                    name: name.into(),
+                    ty: to_bn_type(&arch, &comp_ty.ty),
+                    id,
+                }
+            });
+            view.define_auto_types_with_progress(types, |progress, total| {
+                background_task
+                    .set_progress_text(format!("Applying types... {}/{}", progress, total));
+                !background_task.is_cancelled()
+            });
 
             log::info!("Type application took {:?}", start.elapsed());
             background_task.finish();
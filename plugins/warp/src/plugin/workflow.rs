@@ -1,5 +1,5 @@
 use crate::cache::cached_function_guid;
-use crate::matcher::cached_function_matcher;
+use crate::matcher::match_view_functions;
 use binaryninja::background_task::BackgroundTask;
 use binaryninja::binary_view::{BinaryView, BinaryViewExt};
 use binaryninja::command::Command;
@@ -39,10 +39,12 @@ impl Command for RunMatcher {
             let undo_id = view.file().begin_undo_actions(true);
             let background_task = BackgroundTask::new("Matching on functions...", false);
             let start = Instant::now();
-            view.functions()
-                .iter()
-                .for_each(|function| cached_function_matcher(&function));
-            log::info!("Function matching took {:?}", start.elapsed());
+            let matched = match_view_functions(&view);
+            log::info!(
+                "Function matching took {:?} ({} matched)",
+                start.elapsed(),
+                matched
+            );
             background_task.finish();
             view.file().commit_undo_actions(undo_id);
             // Now we want to trigger re-analysis.
@@ -61,10 +63,12 @@ pub fn insert_workflow() {
         let undo_id = view.file().begin_undo_actions(true);
         let background_task = BackgroundTask::new("Matching on functions...", false);
         let start = Instant::now();
-        view.functions()
-            .iter()
-            .for_each(|function| cached_function_matcher(&function));
-        log::info!("Function matching took {:?}", start.elapsed());
+        let matched = match_view_functions(&view);
+        log::info!(
+            "Function matching took {:?} ({} matched)",
+            start.elapsed(),
+            matched
+        );
         background_task.finish();
         view.file().commit_undo_actions(undo_id);
         // Now we want to trigger re-analysis.
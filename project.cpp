@@ -17,13 +17,67 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
 #include "binaryninjaapi.h"
 #include "binaryninjacore.h"
 
 using namespace BinaryNinja;
 
 
+namespace
+{
+	// Read the whole file in fixed size pieces, hashing as it goes so the contents are only walked once
+	bool ReadAndHashFile(const std::string& path, std::vector<uint8_t>& contents, std::pair<uint64_t, uint64_t>& hash)
+	{
+		std::ifstream in(path, std::ios::binary | std::ios::ate);
+		if (!in)
+			return false;
+		std::streamoff size = in.tellg();
+		if (size < 0)
+			return false;
+		in.seekg(0);
+		contents.resize((size_t)size);
+
+		uint64_t a = 0x9e3779b97f4a7c15 ^ (uint64_t)size;
+		uint64_t b = 0xc2b2ae3d27d4eb4f;
+		constexpr size_t pieceSize = 1024 * 1024;
+		for (size_t offset = 0; offset < contents.size(); offset += pieceSize)
+		{
+			size_t len = std::min(pieceSize, contents.size() - offset);
+			if (!in.read((char*)contents.data() + offset, len))
+				return false;
+
+			const uint8_t* data = contents.data() + offset;
+			size_t i = 0;
+			for (; i + 8 <= len; i += 8)
+			{
+				uint64_t word;
+				memcpy(&word, data + i, sizeof(word));
+				a = (a ^ word) * 0xff51afd7ed558ccd;
+				a ^= a >> 32;
+				b = (b + word) * 0x87c37b91114253d5;
+				b = (b << 31) | (b >> 33);
+			}
+			for (; i < len; i++)
+			{
+				a = (a ^ data[i]) * 0x100000001b3;
+				b = (b + data[i]) * 0xc4ceb9fe1a85ec53;
+			}
+		}
+		hash = {a ^ (a >> 29), b ^ (b >> 31)};
+		return true;
+	}
+}
+
+
 bool ProjectNotification::BeforeOpenProjectCallback(void* ctxt, BNProject* object)
 {
 	ProjectNotification* notify = (ProjectNotification*)ctxt;
@@ -451,6 +505,127 @@ Ref<ProjectFile> Project::CreateFileUnsafe(const std::vector<uint8_t>& contents,
 }
 
 
+std::vector<Ref<ProjectFile>> Project::CreateFilesFromPaths(const std::vector<ProjectFileImport>& imports,
+	const std::function<bool(size_t progress, size_t total)>& progressCallback, size_t threads)
+{
+	struct ReadFile
+	{
+		size_t index;
+		bool ok;
+		std::vector<uint8_t> contents;
+		std::pair<uint64_t, uint64_t> hash;
+	};
+
+	// Bounds how much file data the readers may hold before the registering thread catches up
+	constexpr size_t maxBytesInFlight = 256 * 1024 * 1024;
+
+	std::mutex mutex;
+	std::condition_variable readyCond, spaceCond;
+	std::deque<ReadFile> ready;
+	size_t bytesInFlight = 0;
+	std::atomic<size_t> cursor {0};
+	std::atomic<bool> cancelled {false};
+
+	auto reader = [&]() {
+		while (!cancelled)
+		{
+			size_t index = cursor++;
+			if (index >= imports.size())
+				break;
+
+			ReadFile file;
+			file.index = index;
+			file.ok = ReadAndHashFile(imports[index].path, file.contents, file.hash);
+			if (!file.ok)
+				file.contents.clear();
+
+			std::unique_lock<std::mutex> lock(mutex);
+			// A file larger than the whole budget still goes through once nothing else is pending
+			spaceCond.wait(lock, [&]() {
+				return cancelled || bytesInFlight == 0 || bytesInFlight + file.contents.size() <= maxBytesInFlight;
+			});
+			if (cancelled)
+				break;
+			bytesInFlight += file.contents.size();
+			ready.push_back(std::move(file));
+			readyCond.notify_one();
+		}
+	};
+
+	if (threads == 0)
+		threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	threads = std::min(threads, std::max<size_t>(imports.size(), 1));
+	std::vector<std::thread> readers;
+	for (size_t i = 0; i < threads; i++)
+		readers.emplace_back(reader);
+
+	std::vector<Ref<ProjectFile>> result(imports.size());
+	std::map<std::pair<uint64_t, uint64_t>, std::vector<std::pair<size_t, Ref<ProjectFile>>>> byHash;
+	ProgressContext cb;
+
+	BeginBulkOperation();
+	for (size_t done = 0; done < imports.size(); done++)
+	{
+		ReadFile file;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			readyCond.wait(lock, [&]() { return !ready.empty(); });
+			file = std::move(ready.front());
+			ready.pop_front();
+		}
+
+		if (file.ok)
+		{
+			const ProjectFileImport& import = imports[file.index];
+			// The hash only picks candidates; identical contents are confirmed against the first copy's size
+			Ref<ProjectFile> existing;
+			for (auto& [size, candidate] : byHash[file.hash])
+			{
+				if (size == file.contents.size())
+				{
+					existing = candidate;
+					break;
+				}
+			}
+
+			if (existing)
+			{
+				result[file.index] = existing;
+			}
+			else
+			{
+				BNProjectFile* created = BNProjectCreateFile(m_object, file.contents.data(), file.contents.size(),
+					import.folder ? import.folder->m_object : nullptr, import.name.c_str(), import.description.c_str(),
+					&cb, ProgressCallback);
+				if (created)
+				{
+					result[file.index] = new ProjectFile(created);
+					byHash[file.hash].emplace_back(file.contents.size(), result[file.index]);
+				}
+			}
+		}
+
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			bytesInFlight -= file.contents.size();
+		}
+		spaceCond.notify_all();
+
+		if (progressCallback && !progressCallback(done + 1, imports.size()))
+		{
+			cancelled = true;
+			spaceCond.notify_all();
+			break;
+		}
+	}
+
+	for (auto& thread : readers)
+		thread.join();
+	EndBulkOperation();
+	return result;
+}
+
+
 std::vector<Ref<ProjectFile>> Project::GetFiles() const
 {
 	size_t count;
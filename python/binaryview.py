@@ -226,6 +226,8 @@ class BinaryDataNotification:
 	By default, a `BinaryDataNotification` instance receives notifications for all available notification types. It
 	is recommended for users of this interface to initialize the `BinaryDataNotification` base class with specific
 	callbacks of interest by passing the appropriate `NotificationType` flags into the `__init__` constructor.
+	Without flags, only the handlers the instance overrides are registered with the core, so events nobody handles
+	don't have to take the GIL.
 
 	Handlers provided by the user should aim to limit the amount of processing within the callback. The
 	callback context holds a global lock, preventing other threads from making progress during the callback phase.
@@ -649,56 +651,107 @@ class BinaryDataNotificationCallbacks:
 		self._cb = core.BNBinaryDataNotification()
 		self._cb.context = 0
 		if (not hasattr(notify, 'notifications')) or (hasattr(notify, 'notifications') and notify.notifications is None):
+			# Only the handlers the notification overrides are registered; every other event would take the GIL just to
+			# call a method that does nothing
+			def overridden(name: str) -> bool:
+				base = getattr(BinaryDataNotification, name)
+				return name in getattr(notify, '__dict__', {}) or getattr(type(notify), name, base) is not base
+
 			self._cb.notificationBarrier = self._cb.notificationBarrier
-			self._cb.dataWritten = self._cb.dataWritten.__class__(self._data_written)
-			self._cb.dataInserted = self._cb.dataInserted.__class__(self._data_inserted)
-			self._cb.dataRemoved = self._cb.dataRemoved.__class__(self._data_removed)
-			self._cb.functionAdded = self._cb.functionAdded.__class__(self._function_added)
-			self._cb.functionRemoved = self._cb.functionRemoved.__class__(self._function_removed)
-			self._cb.functionUpdated = self._cb.functionUpdated.__class__(self._function_updated)
-			self._cb.functionUpdateRequested = self._cb.functionUpdateRequested.__class__(self._function_update_requested)
-			self._cb.dataVariableAdded = self._cb.dataVariableAdded.__class__(self._data_var_added)
-			self._cb.dataVariableRemoved = self._cb.dataVariableRemoved.__class__(self._data_var_removed)
-			self._cb.dataVariableUpdated = self._cb.dataVariableUpdated.__class__(self._data_var_updated)
-			self._cb.dataMetadataUpdated = self._cb.dataMetadataUpdated.__class__(self._data_metadata_updated)
-			self._cb.tagTypeUpdated = self._cb.tagTypeUpdated.__class__(self._tag_type_updated)
-			self._cb.tagAdded = self._cb.tagAdded.__class__(self._tag_added)
-			self._cb.tagRemoved = self._cb.tagRemoved.__class__(self._tag_removed)
-			self._cb.tagUpdated = self._cb.tagUpdated.__class__(self._tag_updated)
-
-			self._cb.symbolAdded = self._cb.symbolAdded.__class__(self._symbol_added)
-			self._cb.symbolRemoved = self._cb.symbolRemoved.__class__(self._symbol_removed)
-			self._cb.symbolUpdated = self._cb.symbolUpdated.__class__(self._symbol_updated)
-			self._cb.stringFound = self._cb.stringFound.__class__(self._string_found)
-			self._cb.stringRemoved = self._cb.stringRemoved.__class__(self._string_removed)
-			self._cb.typeDefined = self._cb.typeDefined.__class__(self._type_defined)
-			self._cb.typeUndefined = self._cb.typeUndefined.__class__(self._type_undefined)
-			self._cb.typeReferenceChanged = self._cb.typeReferenceChanged.__class__(self._type_ref_changed)
-			self._cb.typeFieldReferenceChanged = self._cb.typeFieldReferenceChanged.__class__(self._type_field_ref_changed)
-			self._cb.segmentAdded = self._cb.segmentAdded.__class__(self._segment_added)
-			self._cb.segmentRemoved = self._cb.segmentRemoved.__class__(self._segment_removed)
-			self._cb.segmentUpdated = self._cb.segmentUpdated.__class__(self._segment_updated)
-
-			self._cb.sectionAdded = self._cb.sectionAdded.__class__(self._section_added)
-			self._cb.sectionRemoved = self._cb.sectionRemoved.__class__(self._section_removed)
-			self._cb.sectionUpdated = self._cb.sectionUpdated.__class__(self._section_updated)
-			self._cb.componentNameUpdated = self._cb.componentNameUpdated.__class__(self._component_name_updated)
-			self._cb.componentAdded = self._cb.componentAdded.__class__(self._component_added)
-			self._cb.componentRemoved = self._cb.componentRemoved.__class__(self._component_removed)
-			self._cb.componentMoved = self._cb.componentMoved.__class__(self._component_moved)
-			self._cb.componentFunctionAdded = self._cb.componentFunctionAdded.__class__(self._component_function_added)
-			self._cb.componentFunctionRemoved = self._cb.componentFunctionRemoved.__class__(self._component_function_removed)
-			self._cb.componentDataVariableAdded = self._cb.componentDataVariableAdded.__class__(self._component_data_variable_added)
-			self._cb.componentDataVariableRemoved = self._cb.componentDataVariableRemoved.__class__(self._component_data_variable_removed)
-
-			self._cb.typeArchiveAttached = self._cb.typeArchiveAttached.__class__(self._type_archive_attached)
-			self._cb.typeArchiveDetached = self._cb.typeArchiveDetached.__class__(self._type_archive_detached)
-			self._cb.typeArchiveConnected = self._cb.typeArchiveConnected.__class__(self._type_archive_connected)
-			self._cb.typeArchiveDisconnected = self._cb.typeArchiveDisconnected.__class__(self._type_archive_disconnected)
-
-			self._cb.undoEntryAdded = self._cb.undoEntryAdded.__class__(self._undo_entry_added)
-			self._cb.undoEntryTaken = self._cb.undoEntryTaken.__class__(self._undo_entry_taken)
-			self._cb.redoEntryTaken = self._cb.redoEntryTaken.__class__(self._redo_entry_taken)
+			if overridden('data_written'):
+				self._cb.dataWritten = self._cb.dataWritten.__class__(self._data_written)
+			if overridden('data_inserted'):
+				self._cb.dataInserted = self._cb.dataInserted.__class__(self._data_inserted)
+			if overridden('data_removed'):
+				self._cb.dataRemoved = self._cb.dataRemoved.__class__(self._data_removed)
+			if overridden('function_added'):
+				self._cb.functionAdded = self._cb.functionAdded.__class__(self._function_added)
+			if overridden('function_removed'):
+				self._cb.functionRemoved = self._cb.functionRemoved.__class__(self._function_removed)
+			if overridden('function_updated'):
+				self._cb.functionUpdated = self._cb.functionUpdated.__class__(self._function_updated)
+			if overridden('function_update_requested'):
+				self._cb.functionUpdateRequested = self._cb.functionUpdateRequested.__class__(self._function_update_requested)
+			if overridden('data_var_added'):
+				self._cb.dataVariableAdded = self._cb.dataVariableAdded.__class__(self._data_var_added)
+			if overridden('data_var_removed'):
+				self._cb.dataVariableRemoved = self._cb.dataVariableRemoved.__class__(self._data_var_removed)
+			if overridden('data_var_updated'):
+				self._cb.dataVariableUpdated = self._cb.dataVariableUpdated.__class__(self._data_var_updated)
+			if overridden('data_metadata_updated'):
+				self._cb.dataMetadataUpdated = self._cb.dataMetadataUpdated.__class__(self._data_metadata_updated)
+			if overridden('tag_type_updated'):
+				self._cb.tagTypeUpdated = self._cb.tagTypeUpdated.__class__(self._tag_type_updated)
+			if overridden('tag_added'):
+				self._cb.tagAdded = self._cb.tagAdded.__class__(self._tag_added)
+			if overridden('tag_removed'):
+				self._cb.tagRemoved = self._cb.tagRemoved.__class__(self._tag_removed)
+			if overridden('tag_updated'):
+				self._cb.tagUpdated = self._cb.tagUpdated.__class__(self._tag_updated)
+
+			if overridden('symbol_added'):
+				self._cb.symbolAdded = self._cb.symbolAdded.__class__(self._symbol_added)
+			if overridden('symbol_removed'):
+				self._cb.symbolRemoved = self._cb.symbolRemoved.__class__(self._symbol_removed)
+			if overridden('symbol_updated'):
+				self._cb.symbolUpdated = self._cb.symbolUpdated.__class__(self._symbol_updated)
+			if overridden('string_found'):
+				self._cb.stringFound = self._cb.stringFound.__class__(self._string_found)
+			if overridden('string_removed'):
+				self._cb.stringRemoved = self._cb.stringRemoved.__class__(self._string_removed)
+			if overridden('type_defined'):
+				self._cb.typeDefined = self._cb.typeDefined.__class__(self._type_defined)
+			if overridden('type_undefined'):
+				self._cb.typeUndefined = self._cb.typeUndefined.__class__(self._type_undefined)
+			if overridden('type_ref_changed'):
+				self._cb.typeReferenceChanged = self._cb.typeReferenceChanged.__class__(self._type_ref_changed)
+			if overridden('type_field_ref_changed'):
+				self._cb.typeFieldReferenceChanged = self._cb.typeFieldReferenceChanged.__class__(self._type_field_ref_changed)
+			if overridden('segment_added'):
+				self._cb.segmentAdded = self._cb.segmentAdded.__class__(self._segment_added)
+			if overridden('segment_removed'):
+				self._cb.segmentRemoved = self._cb.segmentRemoved.__class__(self._segment_removed)
+			if overridden('segment_updated'):
+				self._cb.segmentUpdated = self._cb.segmentUpdated.__class__(self._segment_updated)
+
+			if overridden('section_added'):
+				self._cb.sectionAdded = self._cb.sectionAdded.__class__(self._section_added)
+			if overridden('section_removed'):
+				self._cb.sectionRemoved = self._cb.sectionRemoved.__class__(self._section_removed)
+			if overridden('section_updated'):
+				self._cb.sectionUpdated = self._cb.sectionUpdated.__class__(self._section_updated)
+			if overridden('component_name_updated'):
+				self._cb.componentNameUpdated = self._cb.componentNameUpdated.__class__(self._component_name_updated)
+			if overridden('component_added'):
+				self._cb.componentAdded = self._cb.componentAdded.__class__(self._component_added)
+			if overridden('component_removed'):
+				self._cb.componentRemoved = self._cb.componentRemoved.__class__(self._component_removed)
+			if overridden('component_moved'):
+				self._cb.componentMoved = self._cb.componentMoved.__class__(self._component_moved)
+			if overridden('component_function_added'):
+				self._cb.componentFunctionAdded = self._cb.componentFunctionAdded.__class__(self._component_function_added)
+			if overridden('component_function_removed'):
+				self._cb.componentFunctionRemoved = self._cb.componentFunctionRemoved.__class__(self._component_function_removed)
+			if overridden('component_data_var_added'):
+				self._cb.componentDataVariableAdded = self._cb.componentDataVariableAdded.__class__(self._component_data_variable_added)
+			if overridden('component_data_var_removed'):
+				self._cb.componentDataVariableRemoved = self._cb.componentDataVariableRemoved.__class__(self._component_data_variable_removed)
+
+			if overridden('type_archive_attached'):
+				self._cb.typeArchiveAttached = self._cb.typeArchiveAttached.__class__(self._type_archive_attached)
+			if overridden('type_archive_detached'):
+				self._cb.typeArchiveDetached = self._cb.typeArchiveDetached.__class__(self._type_archive_detached)
+			if overridden('type_archive_connected'):
+				self._cb.typeArchiveConnected = self._cb.typeArchiveConnected.__class__(self._type_archive_connected)
+			if overridden('type_archive_disconnected'):
+				self._cb.typeArchiveDisconnected = self._cb.typeArchiveDisconnected.__class__(self._type_archive_disconnected)
+
+			if overridden('undo_entry_added'):
+				self._cb.undoEntryAdded = self._cb.undoEntryAdded.__class__(self._undo_entry_added)
+			if overridden('undo_entry_taken'):
+				self._cb.undoEntryTaken = self._cb.undoEntryTaken.__class__(self._undo_entry_taken)
+			if overridden('redo_entry_taken'):
+				self._cb.redoEntryTaken = self._cb.redoEntryTaken.__class__(self._redo_entry_taken)
 		else:
 			if notify.notifications & NotificationType.NotificationBarrier:
 				self._cb.notificationBarrier = self._cb.notificationBarrier.__class__(self._notification_barrier)
@@ -4421,6 +4474,33 @@ class BinaryView:
 		buf = databuffer.DataBuffer(handle=core.BNReadViewBuffer(self.handle, addr, length))
 		return bytes(buf)
 
+	def read_into(self, addr: int, buffer) -> int:
+		r"""
+		``read_into`` reads bytes from virtual address ``addr`` directly into ``buffer``, filling as much of it as
+		possible. Unlike :py:func:`read` no intermediate ``DataBuffer`` or ``bytes`` object is created, so the same
+		buffer can be reused across reads.
+
+		:param int addr: virtual address to read from.
+		:param buffer: writable object supporting the buffer protocol, such as a ``bytearray``, ``memoryview`` or \
+		NumPy array
+		:return: the number of bytes read
+		:rtype: int
+		:Example:
+
+			>>> buf = bytearray(4)
+			>>> bv.read_into(bv.start, buf)
+			4
+		"""
+		if addr < 0:
+			raise ValueError("address must be positive")
+		view = memoryview(buffer).cast("B")
+		if view.readonly:
+			raise TypeError("buffer must be writable")
+		if len(view) == 0:
+			return 0
+		dest = (ctypes.c_uint8 * len(view)).from_buffer(view)
+		return core.BNReadViewData(self.handle, dest, addr, len(view))
+
 	def read_int(self, address: int, size: int, sign: bool = True, endian: Optional[Endianness] = None) -> int:
 		_endian = self.endianness
 		if endian is not None:
@@ -8933,12 +9013,14 @@ to a the type "tagRECT" found in the typelibrary "winX64common"
 			return self
 
 		def __next__(self):
+			# Blocks with the GIL released while nothing is queued, rather than spinning on it and starving the
+			# search thread's match callbacks and every other Python thread
 			while True:
-				if not self.results.empty():
-					return self.results.get()
-
-				if (not self.thread.is_alive()) and self.results.empty():
-					raise StopIteration
+				try:
+					return self.results.get(timeout=0.05)
+				except queue.Empty:
+					if (not self.thread.is_alive()) and self.results.empty():
+						raise StopIteration
 
 	def find_all_data(
 	    self, start: int, end: int, data: bytes, flags: FindFlag = FindFlag.FindCaseSensitive,
@@ -1,6 +1,6 @@
 import ctypes
 import inspect
-from typing import Generator, Optional, List, Tuple, Union, Mapping, Any, Dict, Iterator
+from typing import Generator, Optional, List, Tuple, Union, Mapping, Any, Dict, Iterator, Iterable
 from dataclasses import dataclass
 
 from . import binaryview
@@ -134,6 +134,46 @@ class Component:
     def remove_data_variable(self, data_variable):
         return core.BNComponentRemoveDataVariable(self.handle, data_variable.address)
 
+    def add_functions(self, funcs: Iterable['function.Function']) -> int:
+        """
+        Add several functions to this component as one undo action.
+
+        :param funcs: Functions to add
+        :return: Number of functions that were added
+        """
+        with self.view.undoable_transaction():
+            return sum(1 for func in funcs if core.BNComponentAddFunctionReference(self.handle, func.handle))
+
+    def remove_functions(self, funcs: Iterable['function.Function']) -> int:
+        """
+        Remove several functions from this component as one undo action.
+
+        :param funcs: Functions to remove
+        :return: Number of functions that were removed
+        """
+        with self.view.undoable_transaction():
+            return sum(1 for func in funcs if core.BNComponentRemoveFunctionReference(self.handle, func.handle))
+
+    def add_data_variables(self, data_variables) -> int:
+        """
+        Add several data variables to this component as one undo action.
+
+        :param data_variables: Data variables to add
+        :return: Number of data variables that were added
+        """
+        with self.view.undoable_transaction():
+            return sum(1 for var in data_variables if core.BNComponentAddDataVariable(self.handle, var.address))
+
+    def remove_data_variables(self, data_variables) -> int:
+        """
+        Remove several data variables from this component as one undo action.
+
+        :param data_variables: Data variables to remove
+        :return: Number of data variables that were removed
+        """
+        with self.view.undoable_transaction():
+            return sum(1 for var in data_variables if core.BNComponentRemoveDataVariable(self.handle, var.address))
+
     @property
     def display_name(self) -> str:
         """Original Name of the component (read-only)"""
@@ -20,6 +20,7 @@
 
 import traceback
 import ctypes
+from typing import Iterable
 
 import binaryninja
 from . import _binaryninjacore as core
@@ -66,9 +67,15 @@ class DataRenderer:
 	a "type specific" renderer. For instance there is a generic struct render which renders any struct that hasn't
 	been explicitly overridden by a "type specific" renderer.
 
+	The core asks every registered renderer about every piece of data that is rendered. A renderer that only
+	handles some types should list them in `handled_type_classes` or `handled_struct_names`, so that other types
+	are turned down without wrapping them and calling `perform_is_valid_for_data`. Renderers that list nothing are
+	asked about everything.
+
 	In the below example we create a data renderer that overrides the default display for `struct BAR`::
 
 		class BarDataRenderer(DataRenderer):
+			handled_struct_names = ["BAR"]
 			def __init__(self):
 				DataRenderer.__init__(self)
 			def perform_is_valid_for_data(self, ctxt, view, addr, type, context):
@@ -84,6 +91,8 @@ class DataRenderer:
 	Note that the formatting is sub-optimal to work around an issue with Sphinx and reStructured text
 	"""
 	_registered_renderers = []
+	handled_type_classes: Iterable['enums.TypeClass'] = ()
+	handled_struct_names: Iterable['types.QualifiedNameType'] = ()
 
 	def __init__(self, context=None):
 		self._cb = core.BNCustomDataRenderer()
@@ -93,6 +102,8 @@ class DataRenderer:
 		self._cb.getLinesForData = self._cb.getLinesForData.__class__(self._get_lines_for_data)
 		self._cb.freeLines = self._cb.freeLines.__class__(self._free_lines)
 		self.handle = core.BNCreateDataRenderer(self._cb)
+		self._handled_type_classes = frozenset(int(c) for c in self.handled_type_classes)
+		self._handled_struct_names = frozenset(str(types.QualifiedName(n)) for n in self.handled_struct_names)
 
 	@staticmethod
 	def is_type_of_struct_name(t, name, context):
@@ -115,8 +126,33 @@ class DataRenderer:
 		except:
 			log_error(traceback.format_exc())
 
+	def _might_handle(self, type, context, ctxCount) -> bool:
+		if not self._handled_type_classes and not self._handled_struct_names:
+			return True
+		# Checked on the core handles, before any of the objects perform_is_valid_for_data takes are made
+		type_class = core.BNGetTypeClass(type)
+		if type_class in self._handled_type_classes:
+			return True
+		if not self._handled_struct_names or type_class != enums.TypeClass.StructureTypeClass or ctxCount == 0:
+			return False
+		parent = context[ctxCount - 1].type
+		if core.BNGetTypeClass(parent) != enums.TypeClass.NamedTypeReferenceClass:
+			return False
+		ntr = core.BNGetTypeNamedTypeReference(parent)
+		if not ntr:
+			return False
+		try:
+			name = core.BNGetTypeReferenceName(ntr)
+			result = str(types.QualifiedName._from_core_struct(name)) in self._handled_struct_names
+			core.BNFreeQualifiedName(name)
+			return result
+		finally:
+			core.BNFreeNamedTypeReference(ntr)
+
 	def _is_valid_for_data(self, ctxt, view, addr, type, context, ctxCount):
 		try:
+			if not self._might_handle(type, context, ctxCount):
+				return False
 			file_metadata = filemetadata.FileMetadata(handle=core.BNGetFileForView(view))
 			view = binaryview.BinaryView(file_metadata=file_metadata, handle=core.BNNewViewReference(view))
 			type = types.Type.create(handle=core.BNNewTypeReference(type))
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+# Copyright (c) 2015-2024 Vector 35 Inc
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+
+# Analyze the functions of a large binary in several worker processes.
+#
+# The coordinator finds the functions and the call graph with a cheap control flow pass, saves the result to a
+# database and then analyzes the functions in rounds, callees before their callers. Every worker of a round opens
+# the database from the previous round, skips the analysis of every function outside its share and reports back
+# the types of the functions it analyzed. The coordinator applies those types and saves them, which is how the
+# next round's workers see the signatures of the functions they call even though another process analyzed them.
+#
+# Workers only need the database path, so the pool can be swapped for one spread over machines sharing a file
+# system.
+#
+#   distributed_analysis.py <input> <output.bndb> [--workers N]
+
+import argparse
+import multiprocessing
+import sys
+import time
+
+from binaryninja import LogLevel, load, log_to_stdout
+
+
+def call_graph_rounds(bv):
+	"""
+	Group function starts so that each function comes in a later round than everything it calls. Functions on a
+	call graph cycle can't satisfy that and end up in the round where the cycle was first entered.
+	"""
+	callees = {func.start: [callee.start for callee in func.callees] for func in bv.functions}
+	depth = {}
+	for root in callees:
+		if root in depth:
+			continue
+		# Iterative post order, as the call graph of a large binary is far deeper than the recursion limit
+		depth[root] = 0
+		stack = [(root, iter(callees[root]))]
+		while stack:
+			start, pending = stack[-1]
+			callee = next(pending, None)
+			if callee is None:
+				stack.pop()
+				if stack:
+					caller = stack[-1][0]
+					depth[caller] = max(depth[caller], depth[start] + 1)
+			elif callee in callees and callee not in depth:
+				depth[callee] = 0
+				stack.append((callee, iter(callees[callee])))
+			elif callee in depth and callee != start:
+				depth[start] = max(depth[start], depth[callee] + 1)
+
+	rounds = [[] for _ in range(max(depth.values(), default=-1) + 1)]
+	for start, level in depth.items():
+		rounds[level].append(start)
+	return rounds
+
+
+def analyze_shard(args):
+	"""Worker: analyze the given functions of a database and return (start, type string) of each"""
+	database, starts = args
+	shard = set(starts)
+	bv = load(database, update_analysis=False, options={"analysis.mode": "full"})
+	try:
+		for func in bv.functions:
+			if func.start not in shard:
+				func.analysis_skipped = True
+		bv.update_analysis_and_wait()
+		return [(func.start, str(func.type)) for func in bv.functions if func.start in shard]
+	finally:
+		bv.file.close()
+
+
+def main():
+	parser = argparse.ArgumentParser(description="Analyze a binary's functions in parallel worker processes")
+	parser.add_argument("input")
+	parser.add_argument("output", help="database to write the results to")
+	parser.add_argument("--workers", type=int, default=multiprocessing.cpu_count())
+	args = parser.parse_args()
+	log_to_stdout(LogLevel.WarningLog)
+
+	start_time = time.time()
+	bv = load(args.input, options={"analysis.mode": "controlFlow"})
+	if not bv.create_database(args.output):
+		print(f"Failed to create {args.output}", file=sys.stderr)
+		return 1
+	rounds = call_graph_rounds(bv)
+	print(f"{len(bv.functions)} functions in {len(rounds)} rounds ({time.time() - start_time:.1f}s)")
+
+	# The core can't be forked once it is initialized, so workers start from a fresh interpreter
+	with multiprocessing.get_context("spawn").Pool(args.workers) as pool:
+		for level, starts in enumerate(rounds):
+			round_time = time.time()
+			# Interleave the shards so each worker gets a mix of small and large functions
+			shards = [starts[i::args.workers] for i in range(args.workers) if starts[i::args.workers]]
+			failed = 0
+			for results in pool.imap_unordered(analyze_shard, [(args.output, shard) for shard in shards]):
+				for start, type_string in results:
+					func = bv.get_function_at(start)
+					try:
+						func.apply_auto_discovered_type(bv.parse_type_string(type_string)[0])
+					except (SyntaxError, AttributeError):
+						failed += 1
+			bv.file.save_auto_snapshot()
+			print(f"Round {level}: {len(starts)} functions, {failed} types not applied ({time.time() - round_time:.1f}s)")
+
+	bv.file.close()
+	print(f"Done in {time.time() - start_time:.1f}s")
+	return 0
+
+
+if __name__ == "__main__":
+	sys.exit(main())
@@ -2839,6 +2839,45 @@ class HighLevelILFunction:
 
 		return HighLevelILInstruction.create(self, index, as_ast)
 
+	def get_expr_records(self, start: int = 0, count: Optional[int] = None, as_ast: bool = True) -> ctypes.Array:
+		"""
+		``get_expr_records`` copies the raw ``BNHighLevelILInstruction`` records for a range of expression indices
+
+		This skips building a :py:class:`HighLevelILInstruction` and its operands per expression, so scripts that walk
+		every expression in bulk can work on the records directly. The returned ctypes array supports the buffer
+		protocol, so ``memoryview(records)`` and ``numpy.ctypeslib.as_array(records)`` view it without a copy.
+
+		.. warning :: Not all IL expressions are valid, even if their index is within the returned value from
+		              :py:func:`get_expr_count`, they might not contain properly structured data.
+
+		:param start: First expression index to copy
+		:param count: Number of expressions to copy, defaults to every expression from ``start``
+		:param as_ast: Whether to copy the expressions as a full AST or as single instructions (defaults to AST)
+		:return: Array of ``BNHighLevelILInstruction`` indexed by expression index minus ``start``
+		"""
+		total = self.get_expr_count()
+		if count is None:
+			count = total - start
+		if start < 0 or count < 0 or start + count > total:
+			raise IndexError("expression range out of bounds")
+		records = (core.BNHighLevelILInstruction * count)()
+		for i in range(count):
+			records[i] = core.BNGetHighLevelILByIndex(self.handle, start + i, as_ast)
+		return records
+
+	def get_instruction_expr_indices(self) -> ctypes.Array:
+		"""
+		``get_instruction_expr_indices`` gives the expression index of every instruction, for use with
+		:py:func:`get_expr_records`
+
+		:return: Array of expression indices indexed by instruction index
+		"""
+		count = len(self)
+		indices = (ctypes.c_size_t * count)()
+		for i in range(count):
+			indices[i] = core.BNGetHighLevelILIndexForInstruction(self.handle, i)
+		return indices
+
 	def copy_expr(self, original: HighLevelILInstruction) -> ExpressionIndex:
 		"""
 		``copy_expr`` adds an expression to the function which is equivalent to the given expression
@@ -0,0 +1,202 @@
+# Copyright (c) 2015-2024 Vector 35 Inc
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+
+"""
+Reader for the binary IL export format written by the ``il_export`` example (see
+``examples/il_export/src/il_export.cpp`` for the layout).
+
+The file is memory mapped and every column is returned as a ``memoryview`` of the mapping without being
+copied, so they can be handed directly to ``numpy.frombuffer`` or similar. This module doesn't need the core
+and can be used on machines without Binary Ninja installed.
+"""
+
+import mmap
+import struct
+import weakref
+from enum import IntEnum
+from typing import Iterator, List, Optional
+
+FORMAT_VERSION = 1
+
+
+class ILExportLevel(IntEnum):
+	LowLevelIL = 0
+	MediumLevelIL = 1
+
+
+class ILExportOperandKind(IntEnum):
+	Integer = 0
+	Index = 1
+	Expr = 2
+	Register = 3
+	RegisterStack = 4
+	Flag = 5
+	FlagCondition = 6
+	Intrinsic = 7
+	SemanticFlagClass = 8
+	SemanticFlagGroup = 9
+	Version = 10
+	List = 11
+	Variable = 12
+	Type = 13
+	ConstantState = 14
+
+
+_STRING_KINDS = frozenset({
+    ILExportOperandKind.Register, ILExportOperandKind.RegisterStack, ILExportOperandKind.Flag,
+    ILExportOperandKind.Intrinsic, ILExportOperandKind.SemanticFlagClass, ILExportOperandKind.SemanticFlagGroup,
+    ILExportOperandKind.Variable, ILExportOperandKind.Type
+})
+
+
+def _align(offset: int) -> int:
+	return (offset + 7) & ~7
+
+
+class ILExportFunction:
+	"""
+	Columns of one exported function. Expressions are numbered in post order, so ``Expr`` operands always refer
+	to an earlier expression of the same function.
+	"""
+	def __init__(self, export: 'ILExportFile', offset: int):
+		self._export = export
+		export._functions.add(self)
+		data = export._data
+		(self.start, self._name, self._arch, instruction_count, expr_count,
+		 operand_count, _) = struct.unpack_from("<QIIIIII", data, offset)
+		offset += 32
+
+		def column(fmt: str, size: int, count: int) -> memoryview:
+			nonlocal offset
+			view = data[offset:offset + size * count].cast(fmt)
+			offset += size * count
+			return view
+
+		self.instructions = column("I", 4, instruction_count)
+		offset = _align(offset)
+		self.addresses = column("Q", 8, expr_count)
+		self.operand_starts = column("I", 4, expr_count + 1)
+		self.operations = column("H", 2, expr_count)
+		self.sizes = column("B", 1, expr_count)
+		offset = _align(offset)
+		self.operand_values = column("Q", 8, operand_count)
+		self.operand_kinds = column("B", 1, operand_count)
+
+	def _release(self) -> None:
+		for name in (
+		    "instructions", "addresses", "operand_starts", "operations", "sizes", "operand_values", "operand_kinds"
+		):
+			view: Optional[memoryview] = getattr(self, name, None)
+			if view is not None:
+				view.release()
+
+	def __repr__(self) -> str:
+		return f"<ILExportFunction: {self.name or hex(self.start)}, {len(self.instructions)} instructions>"
+
+	@property
+	def name(self) -> str:
+		return self._export.get_string(self._name)
+
+	@property
+	def arch(self) -> str:
+		return self._export.get_string(self._arch)
+
+	def operands(self, expr: int) -> List[tuple]:
+		"""Operands of expression ``expr`` as ``(kind, value)``, with string table entries already looked up"""
+		result = []
+		for i in range(self.operand_starts[expr], self.operand_starts[expr + 1]):
+			kind = ILExportOperandKind(self.operand_kinds[i])
+			value = self.operand_values[i]
+			if kind in _STRING_KINDS:
+				value = self._export.get_string(value)
+			result.append((kind, value))
+		return result
+
+
+class ILExportFile:
+	"""
+	A memory mapped IL export. Functions are read lazily, so opening a large export only reads its header,
+	string table offsets and function index.
+
+	:Example:
+		>>> with ILExportFile("out.bnil") as export:
+		...     for func in export:
+		...         print(func.name, len(func.operations))
+	"""
+	def __init__(self, path: str):
+		# Every column is a view of the mapping, which can't be closed while any of them are still alive
+		self._functions: 'weakref.WeakSet[ILExportFunction]' = weakref.WeakSet()
+		with open(path, "rb") as f:
+			self._mmap = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+		self._data = memoryview(self._mmap)
+		magic, version, level, function_count, strings_offset, index_offset = struct.unpack_from(
+		    "<4sIIIQQ", self._data, 0
+		)
+		if magic != b"BNIL":
+			self.close()
+			raise ValueError(f"{path} is not an IL export")
+		if version != FORMAT_VERSION:
+			self.close()
+			raise ValueError(f"{path} has unsupported IL export version {version}")
+		self.level = ILExportLevel(level)
+
+		string_count = struct.unpack_from("<I", self._data, strings_offset)[0]
+		self._string_offsets = self._data[strings_offset + 8:strings_offset + 8 + (string_count + 1) * 8].cast("Q")
+		self._string_data = strings_offset + 8 + (string_count + 1) * 8
+		self._function_offsets = self._data[index_offset:index_offset + function_count * 8].cast("Q")
+
+	def close(self) -> None:
+		"""
+		Release the mapping. Columns of functions read from this file can't be used after this, and buffers
+		made from them, such as numpy arrays, have to be dropped before calling it.
+		"""
+		for func in list(self._functions):
+			func._release()
+		for name in ("_string_offsets", "_function_offsets", "_data"):
+			view: Optional[memoryview] = getattr(self, name, None)
+			if view is not None:
+				view.release()
+		self._mmap.close()
+
+	def __enter__(self) -> 'ILExportFile':
+		return self
+
+	def __exit__(self, *args) -> None:
+		self.close()
+
+	def __len__(self) -> int:
+		return len(self._function_offsets)
+
+	def __getitem__(self, i: int) -> ILExportFunction:
+		"""Function ``i``, in the order of their start addresses"""
+		return ILExportFunction(self, self._function_offsets[i])
+
+	def __iter__(self) -> Iterator[ILExportFunction]:
+		for offset in self._function_offsets:
+			yield ILExportFunction(self, offset)
+
+	@property
+	def string_count(self) -> int:
+		return len(self._string_offsets) - 1
+
+	def get_string(self, i: int) -> str:
+		start = self._string_data + self._string_offsets[i]
+		end = self._string_data + self._string_offsets[i + 1]
+		return str(self._data[start:end], "utf-8")
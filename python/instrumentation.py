@@ -0,0 +1,222 @@
+# Copyright (c) 2015-2024 Vector 35 Inc
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+
+
+"""
+Named counters, histograms and scoped timers for Python plugins, matching the ``Instrumentation`` classes of the
+C++ API. Instruments record nothing until :py:func:`set_enabled` is called or the ``BN_API_INSTRUMENTATION``
+environment variable is set, so leaving them in hot code costs a single check while they are disabled.
+
+:Example:
+	>>> decode_time = Histogram("arch.myarch.decode")
+	>>> def get_instruction_info(self, data, addr):
+	...     with decode_time.scope():
+	...         ...
+
+Traces from :py:func:`get_trace_json` use the Chrome trace event format, the same as
+``Instrumentation::GetTraceJson`` in C++ and ``instrumentation::trace_json`` in Rust, and can be combined
+with :py:func:`merge_traces`.
+"""
+
+import json
+import os
+import threading
+import time
+from contextlib import contextmanager
+from typing import Dict, Iterator, List, Optional
+
+_enabled = "BN_API_INSTRUMENTATION" in os.environ
+_tracing = False
+_lock = threading.Lock()
+_counters: Dict[str, 'Counter'] = {}
+_histograms: Dict[str, 'Histogram'] = {}
+
+_trace_lock = threading.Lock()
+_trace: List[tuple] = []
+_trace_limit = 0
+_trace_start = time.perf_counter_ns()
+
+
+def is_enabled() -> bool:
+	return _enabled
+
+
+def set_enabled(enabled: bool) -> None:
+	global _enabled
+	_enabled = enabled
+
+
+def is_tracing_enabled() -> bool:
+	return _tracing
+
+
+def set_tracing_enabled(enabled: bool, max_events: int = 1000000) -> None:
+	"""Record every :py:meth:`Histogram.scope` as a trace event. Enabling discards previously recorded events."""
+	global _enabled, _tracing, _trace_limit, _trace_start
+	with _trace_lock:
+		if enabled:
+			_trace.clear()
+			_trace_limit = max_events
+			_trace_start = time.perf_counter_ns()
+			_enabled = True
+		_tracing = enabled
+
+
+class Counter:
+	"""A named value to add to. Counters with the same name share their value."""
+	def __new__(cls, name: str) -> 'Counter':
+		with _lock:
+			counter = _counters.get(name)
+			if counter is None:
+				counter = super().__new__(cls)
+				counter.name = name
+				counter.value = 0
+				counter._lock = threading.Lock()
+				_counters[name] = counter
+			return counter
+
+	def __repr__(self) -> str:
+		return f"<Counter: {self.name} = {self.value}>"
+
+	def add(self, value: int = 1) -> None:
+		if _enabled:
+			with self._lock:
+				self.value += value
+
+
+class Histogram:
+	"""
+	Distribution of values in power of two buckets: ``buckets[i]`` counts the values ``v`` with
+	``2 ** (i - 1) <= v < 2 ** i`` and ``buckets[0]`` counts zeroes. Histograms with the same name share their values.
+	"""
+	def __new__(cls, name: str) -> 'Histogram':
+		with _lock:
+			histogram = _histograms.get(name)
+			if histogram is None:
+				histogram = super().__new__(cls)
+				histogram.name = name
+				histogram.category = name.split(".", 1)[0]
+				histogram._lock = threading.Lock()
+				histogram._reset()
+				_histograms[name] = histogram
+			return histogram
+
+	def __repr__(self) -> str:
+		return f"<Histogram: {self.name}, {self.count} values>"
+
+	def _reset(self) -> None:
+		self.count = 0
+		self.sum = 0
+		self.min: Optional[int] = None
+		self.max = 0
+		self.buckets = [0] * 65
+
+	def record(self, value: int) -> None:
+		if _enabled:
+			self._record(value)
+
+	def _record(self, value: int) -> None:
+		with self._lock:
+			self.count += 1
+			self.sum += value
+			self.min = value if self.min is None else min(self.min, value)
+			self.max = max(self.max, value)
+			self.buckets[min(value.bit_length(), 64)] += 1
+
+	@contextmanager
+	def scope(self) -> Iterator[None]:
+		"""Record the time spent in the ``with`` block, in nanoseconds, and a trace event for it if tracing"""
+		if not _enabled:
+			yield
+			return
+		start = time.perf_counter_ns()
+		try:
+			yield
+		finally:
+			duration = time.perf_counter_ns() - start
+			self._record(duration)
+			if _tracing:
+				_record_trace_event(self, start, duration)
+
+
+def _record_trace_event(histogram: Histogram, start: int, duration: int) -> None:
+	with _trace_lock:
+		if not _tracing or len(_trace) >= _trace_limit or start < _trace_start:
+			return
+		_trace.append((histogram, threading.get_ident(), (start - _trace_start) // 1000, duration // 1000))
+
+
+def get_snapshot() -> dict:
+	"""
+	Current values, in the same layout as ``Instrumentation::GetSnapshotJson`` in C++: ``counters`` maps names
+	to values and ``histograms`` maps names to dicts of ``count``, ``sum``, ``min``, ``max`` and ``buckets``.
+	"""
+	with _lock:
+		counters = {name: counter.value for name, counter in sorted(_counters.items())}
+		histograms = {}
+		for name, histogram in sorted(_histograms.items()):
+			with histogram._lock:
+				if histogram.count == 0:
+					continue
+				buckets = histogram.buckets[:]
+				while buckets and buckets[-1] == 0:
+					buckets.pop()
+				histograms[name] = {
+				    "count": histogram.count, "sum": histogram.sum, "min": histogram.min, "max": histogram.max,
+				    "buckets": buckets
+				}
+	return {"counters": counters, "histograms": histograms}
+
+
+def get_trace_json() -> str:
+	"""Recorded trace events in the Chrome trace event format, for chrome://tracing or Perfetto"""
+	with _trace_lock:
+		events = [{
+		    "name": histogram.name, "cat": histogram.category, "ph": "X", "pid": 0, "tid": tid, "ts": ts, "dur": dur
+		} for histogram, tid, ts, dur in _trace]
+	return json.dumps({"traceEvents": events, "displayTimeUnit": "ms"})
+
+
+def merge_traces(*traces: str) -> str:
+	"""
+	Combine traces from this module, the C++ API and the Rust API into one. Each source gets its own process id so
+	their threads are shown apart; timestamps are relative to when each source enabled tracing.
+	"""
+	events = []
+	for pid, trace in enumerate(traces):
+		for event in json.loads(trace).get("traceEvents", []):
+			event["pid"] = pid
+			events.append(event)
+	return json.dumps({"traceEvents": events, "displayTimeUnit": "ms"})
+
+
+def reset() -> None:
+	"""Zero every counter and histogram and discard recorded trace events"""
+	global _trace_start
+	with _lock:
+		for counter in _counters.values():
+			with counter._lock:
+				counter.value = 0
+		for histogram in _histograms.values():
+			with histogram._lock:
+				histogram._reset()
+	with _trace_lock:
+		_trace.clear()
+		_trace_start = time.perf_counter_ns()
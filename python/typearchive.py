@@ -220,6 +220,25 @@ class TypeArchive:
 		finally:
 			core.BNFreeStringList(ids, count.value)
 
+	def diff_snapshots(self, from_snapshot: Optional[str], to_snapshot: str) -> Tuple[List[str], List[str], List[str]]:
+		"""
+		Find the types that were added, changed or removed going from one snapshot to another. Snapshots can't be
+		modified, so a caller that remembers the snapshot it last synced from can use this to process just the
+		types that have changed since.
+
+		:param from_snapshot: Earlier snapshot id, or None to treat every type in ``to_snapshot`` as added
+		:param to_snapshot: Later snapshot id
+		:return: Sorted lists of the added, changed and removed type ids
+		"""
+		if from_snapshot == to_snapshot:
+			return [], [], []
+		before = {} if from_snapshot is None else self.get_types_and_ids(from_snapshot)
+		after = self.get_types_and_ids(to_snapshot)
+		added = sorted(id for id in after if id not in before)
+		changed = sorted(id for id, value in after.items() if id in before and before[id] != value)
+		removed = sorted(id for id in before if id not in after)
+		return added, changed, removed
+
 	def add_type(self, name: '_types.QualifiedNameType', type: '_types.Type') -> None:
 		"""
 		Add named types to the type archive. Type must have all dependent named types added
@@ -44,6 +44,21 @@ RelocationHandler::RelocationHandler()
 }
 
 
+// The core calls the handler once per relocation, and almost always for the same architecture in a row.
+// Architectures are never freed, so the wrapper of the last one seen on each thread can be reused.
+static Ref<Architecture> GetCallbackArchitecture(BNArchitecture* arch)
+{
+	thread_local BNArchitecture* lastArch = nullptr;
+	thread_local Ref<Architecture> lastArchObj;
+	if (arch != lastArch)
+	{
+		lastArchObj = new CoreArchitecture(arch);
+		lastArch = arch;
+	}
+	return lastArchObj;
+}
+
+
 void RelocationHandler::FreeCallback(void* ctxt)
 {
 	RelocationHandler* handler = (RelocationHandler*)ctxt;
@@ -56,13 +71,12 @@ bool RelocationHandler::GetRelocationInfoCallback(
 {
 	CallbackRef<RelocationHandler> handler(ctxt);
 	Ref<BinaryView> viewObj = new BinaryView(BNNewViewReference(view));
-	Ref<Architecture> archObj = new CoreArchitecture(arch);
+	Ref<Architecture> archObj = GetCallbackArchitecture(arch);
 	if (!result)
 		return false;
 	vector<BNRelocationInfo> resultVector(&result[0], &result[resultCount]);
 	bool success = handler->GetRelocationInfo(viewObj, archObj, resultVector);
-	for (size_t i = 0; i < resultCount; i++)
-		result[i] = resultVector[i];
+	copy(resultVector.begin(), resultVector.begin() + min(resultVector.size(), resultCount), result);
 	return success;
 }
 
@@ -71,7 +85,8 @@ bool RelocationHandler::ApplyRelocationCallback(
     void* ctxt, BNBinaryView* view, BNArchitecture* arch, BNRelocation* reloc, uint8_t* dest, size_t len)
 {
 	CallbackRef<RelocationHandler> handler(ctxt);
-	Ref<Architecture> archObj = new CoreArchitecture(arch);
+	Ref<Architecture> archObj = GetCallbackArchitecture(arch);
+	// The view is wrapped every time: a cached reference would keep a closed view alive on this thread
 	Ref<BinaryView> viewObj = new BinaryView(BNNewViewReference(view));
 	Ref<Relocation> relocObj = new Relocation(BNNewRelocationReference(reloc));
 	return handler->ApplyRelocation(viewObj, archObj, relocObj, dest, len);
@@ -132,15 +147,8 @@ bool CoreRelocationHandler::ApplyRelocation(
 bool CoreRelocationHandler::GetRelocationInfo(
     Ref<BinaryView> view, Ref<Architecture> arch, std::vector<BNRelocationInfo>& result)
 {
-	BNRelocationInfo* results = new BNRelocationInfo[result.size()];
-	for (size_t i = 0; i < result.size(); i++)
-		results[i] = result[i];
-	bool status =
-	    BNRelocationHandlerGetRelocationInfo(m_object, view->GetObject(), arch->GetObject(), results, result.size());
-	for (size_t i = 0; i < result.size(); i++)
-		result[i] = results[i];
-	delete[] results;
-	return status;
+	return BNRelocationHandlerGetRelocationInfo(
+	    m_object, view->GetObject(), arch->GetObject(), result.data(), result.size());
 }
 
 
@@ -18,6 +18,7 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <list>
 #include "binaryninjaapi.h"
 #include "ffi.h"
 
@@ -27,13 +28,84 @@ using namespace std;
 std::unordered_map<BNRenderLayer*, RenderLayer*> RenderLayer::g_registeredInstances;
 
 
-RenderLayer::RenderLayer(const std::string& name): m_nameForRegister(name)
+struct RenderLayer::BlockCache
+{
+	// One entry per block, replaced when the block's input lines change
+	struct Entry
+	{
+		// Held so the block's address can't be reused by a newer block while the entry exists
+		Ref<BasicBlock> block;
+		uint64_t inputHash;
+		vector<DisassemblyTextLine> lines;
+		list<BNBasicBlock*>::iterator recent;
+	};
+
+	std::mutex mutex;
+	atomic<size_t> maxBlocks = 0;
+	unordered_map<BNBasicBlock*, Entry> entries;
+	list<BNBasicBlock*> recent;
+
+	void Trim()
+	{
+		while (entries.size() > maxBlocks)
+		{
+			entries.erase(recent.back());
+			recent.pop_back();
+		}
+	}
+
+	static uint64_t HashLines(const vector<DisassemblyTextLine>& lines)
+	{
+		uint64_t hash = 0xcbf29ce484222325ull;
+		auto mix = [&](uint64_t value) {
+			hash = (hash ^ value) * 0x100000001b3ull;
+		};
+		for (auto& line : lines)
+		{
+			mix(line.addr);
+			mix(line.instrIndex);
+			mix(line.highlight.style);
+			mix(line.highlight.color);
+			mix(line.highlight.mixColor);
+			mix(((uint64_t)line.highlight.mix << 32) | ((uint64_t)line.highlight.r << 24)
+			    | ((uint64_t)line.highlight.g << 16) | ((uint64_t)line.highlight.b << 8) | line.highlight.alpha);
+			mix(line.tags.size());
+			for (auto& tag : line.tags)
+				mix((uint64_t)(uintptr_t)tag->GetObject());
+			mix(line.typeInfo.hasTypeInfo);
+			mix((uint64_t)(uintptr_t)(line.typeInfo.parentType ? line.typeInfo.parentType->GetObject() : nullptr));
+			mix(line.typeInfo.fieldIndex);
+			mix(line.typeInfo.offset);
+			mix(line.tokens.size());
+			for (auto& token : line.tokens)
+			{
+				mix(token.type);
+				mix(std::hash<string>()(token.text));
+				mix(token.value);
+				mix(token.width);
+				mix(token.size);
+				mix(token.operand);
+				mix(token.context);
+				mix(token.confidence);
+				mix(token.address);
+				mix(token.exprIndex);
+				mix(token.typeNames.size());
+				for (auto& typeName : token.typeNames)
+					mix(std::hash<string>()(typeName));
+			}
+		}
+		return hash;
+	}
+};
+
+
+RenderLayer::RenderLayer(const std::string& name): m_nameForRegister(name), m_blockCache(make_shared<BlockCache>())
 {
 
 }
 
 
-RenderLayer::RenderLayer(BNRenderLayer* layer)
+RenderLayer::RenderLayer(BNRenderLayer* layer): m_blockCache(make_shared<BlockCache>())
 {
 	m_object = layer;
 }
@@ -162,16 +234,107 @@ void RenderLayer::ApplyToBlock(
 }
 
 
+void RenderLayer::ApplyToBlocks(std::vector<RenderLayerBlockLines>& blocks)
+{
+	for (auto& block: blocks)
+	{
+		ApplyToBlock(block.block, block.lines);
+	}
+}
+
+
+void RenderLayer::SetBlockCacheSize(size_t maxBlocks)
+{
+	std::unique_lock<std::mutex> lock(m_blockCache->mutex);
+	m_blockCache->maxBlocks = maxBlocks;
+	m_blockCache->Trim();
+}
+
+
+void RenderLayer::ClearBlockCache()
+{
+	std::unique_lock<std::mutex> lock(m_blockCache->mutex);
+	m_blockCache->entries.clear();
+	m_blockCache->recent.clear();
+}
+
+
+void RenderLayer::ApplyToBlocksCached(std::vector<RenderLayerBlockLines>& blocks)
+{
+	BlockCache& cache = *m_blockCache;
+	if (cache.maxBlocks == 0)
+	{
+		ApplyToBlocks(blocks);
+		return;
+	}
+
+	std::vector<uint64_t> hashes;
+	std::vector<size_t> missIndices;
+	std::vector<RenderLayerBlockLines> misses;
+	hashes.reserve(blocks.size());
+	{
+		std::unique_lock<std::mutex> lock(cache.mutex);
+		for (size_t i = 0; i < blocks.size(); i++)
+		{
+			hashes.push_back(BlockCache::HashLines(blocks[i].lines));
+			auto entry = cache.entries.find(blocks[i].block->GetObject());
+			if (entry == cache.entries.end() || entry->second.inputHash != hashes[i])
+			{
+				missIndices.push_back(i);
+				misses.push_back(blocks[i]);
+				continue;
+			}
+			cache.recent.splice(cache.recent.begin(), cache.recent, entry->second.recent);
+			blocks[i].lines = entry->second.lines;
+		}
+	}
+	if (misses.empty())
+		return;
+
+	// The layer runs without the lock held, so it can take as long as it likes
+	ApplyToBlocks(misses);
+
+	std::unique_lock<std::mutex> lock(cache.mutex);
+	for (size_t i = 0; i < missIndices.size() && i < misses.size(); i++)
+	{
+		size_t index = missIndices[i];
+		BNBasicBlock* key = blocks[index].block->GetObject();
+		auto [entry, inserted] = cache.entries.try_emplace(key);
+		if (inserted)
+		{
+			cache.recent.push_front(key);
+			entry->second.recent = cache.recent.begin();
+			entry->second.block = blocks[index].block;
+		}
+		else
+		{
+			cache.recent.splice(cache.recent.begin(), cache.recent, entry->second.recent);
+		}
+		entry->second.inputHash = hashes[index];
+		entry->second.lines = misses[i].lines;
+		blocks[index].lines = std::move(misses[i].lines);
+	}
+	cache.Trim();
+}
+
+
 void RenderLayer::ApplyToFlowGraph(Ref<FlowGraph> graph)
 {
+	std::vector<Ref<FlowGraphNode>> nodes;
+	std::vector<RenderLayerBlockLines> blocks;
 	for (auto node: graph->GetNodes())
 	{
-		auto lines = node->GetLines();
-		if (node->GetBasicBlock())
+		if (Ref<BasicBlock> block = node->GetBasicBlock())
 		{
-			ApplyToBlock(node->GetBasicBlock(), lines);
+			nodes.push_back(node);
+			blocks.push_back({block, node->GetLines()});
 		}
-		node->SetLines(lines);
+	}
+
+	ApplyToBlocksCached(blocks);
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		nodes[i]->SetLines(blocks[i].lines);
 	}
 }
 
@@ -193,98 +356,91 @@ void RenderLayer::ApplyToLinearViewObject(
 		return;
 	}
 
-	std::vector<LinearDisassemblyLine> blockLines;
-	std::vector<LinearDisassemblyLine> finalLines;
-	Ref<BasicBlock> lastBlock;
+	// Split the lines into runs. Code lines of a block go to ApplyToBlocks in one batch for the whole
+	// object, anything else to ApplyToMiscLinearLines so we preserve line information. The runs are
+	// put back together in their original order afterwards.
+	struct Run
+	{
+		std::vector<LinearDisassemblyLine> lines;
+		// Index into blocks for code runs, SIZE_MAX for misc runs
+		size_t blockIndex = SIZE_MAX;
+		Ref<Function> function;
+	};
+	std::vector<Run> runs;
+	std::vector<RenderLayerBlockLines> blocks;
 
-	auto finishBlock = [&]()
+	for (size_t i = 0; i < lines.size();)
 	{
-		if (!blockLines.empty())
+		// Assume we've finished a block when the line's block changes
+		Ref<BasicBlock> block = lines[i].block;
+		size_t blockEnd = i;
+		while (blockEnd < lines.size() && lines[blockEnd].block == block)
 		{
-			if (lastBlock)
-			{
-				// Convert linear lines to disassembly lines for the apply()
-				// and then convert back for linear view
-				std::vector<LinearDisassemblyLine> newBlockLines;
-				std::vector<DisassemblyTextLine> disasmLines;
-				std::vector<LinearDisassemblyLine> miscLines;
-
-				auto processDisasm = [&]()
-				{
-					if (!disasmLines.empty())
-					{
-						ApplyToBlock(lastBlock, disasmLines);
-						Ref<Function> func = blockLines[0].function;
-						Ref<BasicBlock> block = blockLines[0].block;
-						for (auto& blockLine: disasmLines)
-						{
-							LinearDisassemblyLine newLine;
-							newLine.type = CodeDisassemblyLineType;
-							newLine.function = func;
-							newLine.block = block;
-							newLine.contents = blockLine;
-							newBlockLines.push_back(newLine);
-						}
-						disasmLines.clear();
-					}
-				};
-
-				auto processMisc = [&]()
-				{
-					if (!miscLines.empty())
-					{
-						ApplyToMiscLinearLines(obj, prev, next, miscLines);
-						std::move(
-							miscLines.begin(),
-							miscLines.end(),
-							std::back_inserter(newBlockLines)
-						);
-						miscLines.clear();
-					}
-				};
+			blockEnd++;
+		}
 
-				for (auto& blockLine: blockLines)
+		if (!block)
+		{
+			Run run;
+			run.lines.assign(lines.begin() + i, lines.begin() + blockEnd);
+			run.blockIndex = SIZE_MAX;
+			run.function = nullptr;
+			runs.push_back(std::move(run));
+		}
+		else
+		{
+			Ref<Function> func = lines[i].function;
+			for (size_t j = i; j < blockEnd; j++)
+			{
+				bool code = lines[j].type == CodeDisassemblyLineType;
+				bool extend = !runs.empty() && j != i && (runs.back().blockIndex != SIZE_MAX) == code;
+				if (!extend)
 				{
-					// Lines in the block get sent to processDisasm, anything else goes
-					// to processMisc so we preserve line information
-					if (blockLine.type == CodeDisassemblyLineType)
-					{
-						processMisc();
-						disasmLines.push_back(blockLine.contents);
-					}
-					else
+					Run run;
+					if (code)
 					{
-						processDisasm();
-						miscLines.push_back(blockLine);
+						run.blockIndex = blocks.size();
+						run.function = func;
+						blocks.push_back({block, {}});
 					}
+					runs.push_back(std::move(run));
 				}
-				// At the end, zero or one of these has lines in it
-				processMisc();
-				processDisasm();
-				blockLines = newBlockLines;
-			}
-			else
-			{
-				ApplyToMiscLinearLines(obj, prev, next, blockLines);
+				if (code)
+					blocks[runs.back().blockIndex].lines.push_back(lines[j].contents);
+				else
+					runs.back().lines.push_back(lines[j]);
 			}
 		}
-		std::move(blockLines.begin(), blockLines.end(), std::back_inserter(finalLines));
-	};
+		i = blockEnd;
+	}
+
+	ApplyToBlocksCached(blocks);
 
-	for (auto& line: lines)
+	std::vector<LinearDisassemblyLine> finalLines;
+	finalLines.reserve(lines.size());
+	for (auto& run: runs)
 	{
-		// Assume we've finished a block when the line's block changes
-		if (line.block != lastBlock)
+		if (run.blockIndex == SIZE_MAX)
+		{
+			ApplyToMiscLinearLines(obj, prev, next, run.lines);
+			std::move(run.lines.begin(), run.lines.end(), std::back_inserter(finalLines));
+			continue;
+		}
+
+		// Convert the disassembly lines back for linear view
+		RenderLayerBlockLines& block = blocks[run.blockIndex];
+		for (auto& blockLine: block.lines)
 		{
-			finishBlock();
+			LinearDisassemblyLine newLine;
+			newLine.type = CodeDisassemblyLineType;
+			newLine.function = run.function;
+			newLine.block = block.block;
+			newLine.contents = std::move(blockLine);
+			finalLines.push_back(std::move(newLine));
 		}
-		blockLines.push_back(line);
-		lastBlock = line.block;
 	}
-	// And we've finished a block when we're done with every line
-	finishBlock();
 
-	lines = finalLines;
+	lines = std::move(finalLines);
 }
 
 
@@ -0,0 +1,23 @@
+use binaryninja::binary_view::{BinaryViewBase, BinaryViewExt};
+
+// Long lived worker for batch jobs, paths to analyze are read from stdin one per line.
+//
+//   $ printf '/bin/cat\n/bin/ls\n' | cargo run --example worker
+fn main() {
+    eprintln!("Starting session...");
+    // Plugins are loaded once here instead of once per sample
+    let headless_session =
+        binaryninja::headless::Session::new().expect("Failed to initialize session");
+
+    eprintln!("Waiting for jobs...");
+    headless_session
+        .serve(std::io::stdin().lock(), std::io::stdout(), |bv| {
+            format!(
+                "{}\t{:#x}\t{}",
+                bv.file().filename(),
+                bv.len(),
+                bv.functions().len()
+            )
+        })
+        .expect("Failed to read jobs");
+}
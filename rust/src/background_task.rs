@@ -17,6 +17,8 @@
 use binaryninjacore_sys::*;
 
 use std::result;
+use std::sync::atomic::{AtomicU64, Ordering::Relaxed};
+use std::time::{Duration, Instant};
 
 use crate::rc::*;
 use crate::string::*;
@@ -128,3 +130,90 @@ impl ToOwned for BackgroundTask {
 
 unsafe impl Send for BackgroundTask {}
 unsafe impl Sync for BackgroundTask {}
+
+/// Numeric progress of a [`BackgroundTask`] for loops that report every item, from any number of threads.
+///
+/// The counts are only stored in atomics, and the progress text is composed as `description (current/total)`
+/// and sent to the core at most once per [`BackgroundTaskProgress::UPDATE_INTERVAL`], so most updates don't
+/// allocate or take a lock.
+pub struct BackgroundTaskProgress {
+    task: Ref<BackgroundTask>,
+    description: String,
+    current: AtomicU64,
+    total: AtomicU64,
+    created: Instant,
+    /// Nanoseconds after `created` from which the next text may be sent.
+    next_update: AtomicU64,
+}
+
+impl BackgroundTaskProgress {
+    pub const UPDATE_INTERVAL: Duration = Duration::from_millis(100);
+
+    pub fn new(task: Ref<BackgroundTask>, description: impl Into<String>, total: u64) -> Self {
+        Self {
+            task,
+            description: description.into(),
+            current: AtomicU64::new(0),
+            total: AtomicU64::new(total),
+            created: Instant::now(),
+            next_update: AtomicU64::new(0),
+        }
+    }
+
+    pub fn task(&self) -> &BackgroundTask {
+        &self.task
+    }
+
+    pub fn set(&self, current: u64) {
+        self.current.store(current, Relaxed);
+        self.publish(false);
+    }
+
+    /// Add `count` to the items done.
+    pub fn add(&self, count: u64) {
+        self.current.fetch_add(count, Relaxed);
+        self.publish(false);
+    }
+
+    pub fn set_total(&self, total: u64) {
+        self.total.store(total, Relaxed);
+        self.publish(false);
+    }
+
+    pub fn current(&self) -> u64 {
+        self.current.load(Relaxed)
+    }
+
+    pub fn text(&self) -> String {
+        format!(
+            "{} ({}/{})",
+            self.description,
+            self.current.load(Relaxed),
+            self.total.load(Relaxed)
+        )
+    }
+
+    /// Send the current counts now, regardless of when they were last sent.
+    pub fn flush(&self) {
+        self.publish(true);
+    }
+
+    fn publish(&self, force: bool) {
+        let now = self.created.elapsed().as_nanos() as u64;
+        let next = self.next_update.load(Relaxed);
+        if !force && now < next {
+            return;
+        }
+        // Only the thread that moves the deadline on sends the text, the others carry on.
+        let deadline = now + Self::UPDATE_INTERVAL.as_nanos() as u64;
+        if self
+            .next_update
+            .compare_exchange(next, deadline, Relaxed, Relaxed)
+            .is_err()
+            && !force
+        {
+            return;
+        }
+        self.task.set_progress_text(self.text());
+    }
+}
@@ -17,11 +17,13 @@ use crate::{
     license_path, set_bundled_plugin_directory, set_license, string::IntoJson,
 };
 use std::io;
+use std::io::{BufRead, Write};
 use std::path::{Path, PathBuf};
 use std::sync::atomic::AtomicUsize;
 use std::sync::atomic::Ordering::SeqCst;
 use thiserror::Error;
 
+use crate::binary_view::BinaryViewExt;
 use crate::enterprise::release_license;
 use crate::main_thread::{MainThreadAction, MainThreadHandler};
 use crate::progress::ProgressCallback;
@@ -30,7 +32,7 @@ use binaryninjacore_sys::{BNInitPlugins, BNInitRepoPlugins};
 use std::sync::mpsc::Sender;
 use std::sync::Mutex;
 use std::thread::JoinHandle;
-use std::time::Duration;
+use std::time::{Duration, Instant};
 
 static MAIN_THREAD_HANDLE: Mutex<Option<JoinHandle<()>>> = Mutex::new(None);
 
@@ -222,12 +224,18 @@ pub fn init_with_opts(options: InitializationOptions) -> Result<(), Initializati
 
     set_bundled_plugin_directory(options.bundled_plugin_directory);
 
-    unsafe {
-        BNInitPlugins(options.user_plugins);
-        if options.repo_plugins {
-            // We are allowed to initialize repo plugins, so do it!
-            BNInitRepoPlugins();
-        }
+    // Startup time is dominated by plugin initialization, report it so slow starts can be narrowed down.
+    let plugins_start = Instant::now();
+    unsafe { BNInitPlugins(options.user_plugins) };
+    log::debug!("Initialized plugins in {:?}", plugins_start.elapsed());
+    if options.repo_plugins {
+        // We are allowed to initialize repo plugins, so do it!
+        let repo_plugins_start = Instant::now();
+        unsafe { BNInitRepoPlugins() };
+        log::debug!(
+            "Initialized repository plugins in {:?}",
+            repo_plugins_start.elapsed()
+        );
     }
 
     if !is_license_validated() {
@@ -406,6 +414,51 @@ impl Session {
             progress,
         )
     }
+
+    /// Keep this session alive as a worker, analyzing one file per line read from `jobs`.
+    ///
+    /// Each file is loaded and analyzed, handed to `job`, and closed again before the next line is read, so
+    /// nothing from one job is kept around for the next while plugins, type libraries and platforms are only
+    /// initialized once for the whole process. The line returned by `job` is written to `results` and flushed,
+    /// a file that fails to load writes `error: ...` instead. Returns once `jobs` reaches end of input.
+    ///
+    /// ```no_run
+    /// use binaryninja::binary_view::BinaryViewExt;
+    ///
+    /// let headless_session = binaryninja::headless::Session::new().unwrap();
+    ///
+    /// let stdin = std::io::stdin().lock();
+    /// headless_session
+    ///     .serve(stdin, std::io::stdout(), |bv| bv.functions().len().to_string())
+    ///     .expect("Worker pipe closed");
+    /// ```
+    pub fn serve(
+        &self,
+        jobs: impl BufRead,
+        mut results: impl Write,
+        mut job: impl FnMut(&binary_view::BinaryView) -> String,
+    ) -> io::Result<()> {
+        for line in jobs.lines() {
+            let line = line?;
+            let file_path = line.trim();
+            if file_path.is_empty() {
+                continue;
+            }
+
+            let result = match self.load(file_path) {
+                Some(bv) => {
+                    let result = job(&bv);
+                    bv.file().close();
+                    result
+                }
+                None => format!("error: failed to load {}", file_path),
+            };
+            // Results are line delimited, keep a multi-line result from splitting into several jobs.
+            writeln!(results, "{}", result.replace('\n', " "))?;
+            results.flush()?;
+        }
+        Ok(())
+    }
 }
 
 impl Drop for Session {
@@ -0,0 +1,352 @@
+//! Reader for the binary IL export format written by the `il_export` example.
+//!
+//! See `examples/il_export/src/il_export.cpp` for the layout. The reader borrows the bytes of the export
+//! instead of copying them, so a memory mapped file can be read without loading it, and it doesn't need the
+//! core to be initialized.
+//!
+//! ```no_run
+//! # use binaryninja::il_export::ILExport;
+//! let bytes = std::fs::read("out.bnil").unwrap();
+//! let export = ILExport::new(&bytes).unwrap();
+//! for function in export.functions() {
+//!     let function = function.unwrap();
+//!     println!("{} has {} expressions", function.name(), function.expr_count());
+//! }
+//! ```
+
+use std::ops::Range;
+use thiserror::Error;
+
+pub const FORMAT_VERSION: u32 = 1;
+
+#[derive(Error, Debug, Clone, PartialEq, Eq)]
+pub enum ILExportError {
+    #[error("not an IL export")]
+    InvalidMagic,
+    #[error("unsupported IL export version {0}")]
+    UnsupportedVersion(u32),
+    #[error("IL export is truncated or has an invalid offset")]
+    OutOfBounds,
+}
+
+#[derive(Clone, Copy, Debug, PartialEq, Eq, Hash)]
+pub enum ILExportLevel {
+    LowLevelIL,
+    MediumLevelIL,
+}
+
+#[derive(Clone, Copy, Debug, PartialEq, Eq, Hash)]
+pub enum ILExportOperandKind {
+    Integer,
+    Index,
+    /// Index of an earlier expression of the same function.
+    Expr,
+    Register,
+    RegisterStack,
+    Flag,
+    FlagCondition,
+    Intrinsic,
+    SemanticFlagClass,
+    SemanticFlagGroup,
+    /// SSA version of the operand before it.
+    Version,
+    /// The value is the number of operands after this one that are the elements of the list.
+    List,
+    /// Followed by the [`ILExportOperandKind::Type`] of the variable.
+    Variable,
+    Type,
+    /// A `BNRegisterValueType`, followed by the value and size of the constant.
+    ConstantState,
+    Unknown(u8),
+}
+
+impl ILExportOperandKind {
+    fn from_raw(kind: u8) -> Self {
+        match kind {
+            0 => Self::Integer,
+            1 => Self::Index,
+            2 => Self::Expr,
+            3 => Self::Register,
+            4 => Self::RegisterStack,
+            5 => Self::Flag,
+            6 => Self::FlagCondition,
+            7 => Self::Intrinsic,
+            8 => Self::SemanticFlagClass,
+            9 => Self::SemanticFlagGroup,
+            10 => Self::Version,
+            11 => Self::List,
+            12 => Self::Variable,
+            13 => Self::Type,
+            14 => Self::ConstantState,
+            kind => Self::Unknown(kind),
+        }
+    }
+
+    /// Whether the value of the operand is an index into the string table.
+    pub fn is_string(&self) -> bool {
+        matches!(
+            self,
+            Self::Register
+                | Self::RegisterStack
+                | Self::Flag
+                | Self::Intrinsic
+                | Self::SemanticFlagClass
+                | Self::SemanticFlagGroup
+                | Self::Variable
+                | Self::Type
+        )
+    }
+}
+
+fn read_u32(data: &[u8], offset: usize) -> u32 {
+    u32::from_le_bytes(data[offset..offset + 4].try_into().unwrap())
+}
+
+fn read_u64(data: &[u8], offset: usize) -> u64 {
+    u64::from_le_bytes(data[offset..offset + 8].try_into().unwrap())
+}
+
+fn align(offset: usize) -> usize {
+    (offset + 7) & !7
+}
+
+/// A little endian column of fixed size values inside the export.
+#[derive(Clone, Copy)]
+pub struct Column<'a, const N: usize> {
+    data: &'a [u8],
+}
+
+impl<'a, const N: usize> Column<'a, N> {
+    fn new(data: &'a [u8], offset: &mut usize, count: usize) -> Result<Self, ILExportError> {
+        let end = count
+            .checked_mul(N)
+            .and_then(|len| offset.checked_add(len))
+            .filter(|end| *end <= data.len())
+            .ok_or(ILExportError::OutOfBounds)?;
+        let column = Self {
+            data: &data[*offset..end],
+        };
+        *offset = end;
+        Ok(column)
+    }
+
+    pub fn len(&self) -> usize {
+        self.data.len() / N
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.data.is_empty()
+    }
+
+    /// The raw little endian bytes of the column.
+    pub fn as_bytes(&self) -> &'a [u8] {
+        self.data
+    }
+
+    fn get_raw(&self, i: usize) -> u64 {
+        let bytes = &self.data[i * N..(i + 1) * N];
+        let mut value = [0u8; 8];
+        value[..N].copy_from_slice(bytes);
+        u64::from_le_bytes(value)
+    }
+}
+
+impl Column<'_, 1> {
+    pub fn get(&self, i: usize) -> u8 {
+        self.data[i]
+    }
+}
+
+impl Column<'_, 2> {
+    pub fn get(&self, i: usize) -> u16 {
+        self.get_raw(i) as u16
+    }
+}
+
+impl Column<'_, 4> {
+    pub fn get(&self, i: usize) -> u32 {
+        self.get_raw(i) as u32
+    }
+}
+
+impl Column<'_, 8> {
+    pub fn get(&self, i: usize) -> u64 {
+        self.get_raw(i)
+    }
+}
+
+/// A read only view of an IL export.
+pub struct ILExport<'a> {
+    data: &'a [u8],
+    level: ILExportLevel,
+    string_offsets: Column<'a, 8>,
+    string_data: usize,
+    function_offsets: Column<'a, 8>,
+}
+
+impl<'a> ILExport<'a> {
+    pub fn new(data: &'a [u8]) -> Result<Self, ILExportError> {
+        if data.len() < 32 {
+            return Err(ILExportError::OutOfBounds);
+        }
+        if &data[0..4] != b"BNIL" {
+            return Err(ILExportError::InvalidMagic);
+        }
+        let version = read_u32(data, 4);
+        if version != FORMAT_VERSION {
+            return Err(ILExportError::UnsupportedVersion(version));
+        }
+        let level = match read_u32(data, 8) {
+            0 => ILExportLevel::LowLevelIL,
+            _ => ILExportLevel::MediumLevelIL,
+        };
+        let function_count = read_u32(data, 12) as usize;
+        let strings_offset = read_u64(data, 16) as usize;
+        let index_offset = read_u64(data, 24) as usize;
+
+        if strings_offset
+            .checked_add(8)
+            .map_or(true, |end| end > data.len())
+        {
+            return Err(ILExportError::OutOfBounds);
+        }
+        let string_count = read_u32(data, strings_offset) as usize;
+        let mut offset = strings_offset + 8;
+        let string_offsets = Column::new(data, &mut offset, string_count + 1)?;
+        let string_data = offset;
+        let mut offset = index_offset;
+        let function_offsets = Column::new(data, &mut offset, function_count)?;
+        Ok(Self {
+            data,
+            level,
+            string_offsets,
+            string_data,
+            function_offsets,
+        })
+    }
+
+    pub fn level(&self) -> ILExportLevel {
+        self.level
+    }
+
+    pub fn function_count(&self) -> usize {
+        self.function_offsets.len()
+    }
+
+    /// Function `i`, in the order of their start addresses.
+    pub fn function(&self, i: usize) -> Result<ILExportFunction<'a, '_>, ILExportError> {
+        ILExportFunction::new(self, self.function_offsets.get(i) as usize)
+    }
+
+    pub fn functions(
+        &self,
+    ) -> impl Iterator<Item = Result<ILExportFunction<'a, '_>, ILExportError>> + '_ {
+        (0..self.function_count()).map(|i| self.function(i))
+    }
+
+    pub fn string_count(&self) -> usize {
+        self.string_offsets.len() - 1
+    }
+
+    /// String `i` of the string table, or an empty string if it is out of range or not valid UTF-8.
+    pub fn string(&self, i: usize) -> &'a str {
+        if i >= self.string_count() {
+            return "";
+        }
+        let range = self.string_range(i);
+        self.data
+            .get(range)
+            .and_then(|bytes| std::str::from_utf8(bytes).ok())
+            .unwrap_or("")
+    }
+
+    fn string_range(&self, i: usize) -> Range<usize> {
+        let start = self.string_data + self.string_offsets.get(i) as usize;
+        let end = self.string_data + self.string_offsets.get(i + 1) as usize;
+        start..end
+    }
+}
+
+/// The columns of one exported function.
+///
+/// Expressions are numbered in post order, so the operands of an expression only refer to expressions
+/// before it.
+pub struct ILExportFunction<'a, 'b> {
+    export: &'b ILExport<'a>,
+    pub start: u64,
+    name: u32,
+    arch: u32,
+    pub instructions: Column<'a, 4>,
+    pub addresses: Column<'a, 8>,
+    pub operand_starts: Column<'a, 4>,
+    pub operations: Column<'a, 2>,
+    pub sizes: Column<'a, 1>,
+    pub operand_values: Column<'a, 8>,
+    pub operand_kinds: Column<'a, 1>,
+}
+
+impl<'a, 'b> ILExportFunction<'a, 'b> {
+    fn new(export: &'b ILExport<'a>, offset: usize) -> Result<Self, ILExportError> {
+        let data = export.data;
+        if offset.checked_add(32).map_or(true, |end| end > data.len()) {
+            return Err(ILExportError::OutOfBounds);
+        }
+        let start = read_u64(data, offset);
+        let name = read_u32(data, offset + 8);
+        let arch = read_u32(data, offset + 12);
+        let instruction_count = read_u32(data, offset + 16) as usize;
+        let expr_count = read_u32(data, offset + 20) as usize;
+        let operand_count = read_u32(data, offset + 24) as usize;
+
+        let mut offset = offset + 32;
+        let instructions = Column::new(data, &mut offset, instruction_count)?;
+        offset = align(offset);
+        let addresses = Column::new(data, &mut offset, expr_count)?;
+        let operand_starts = Column::new(data, &mut offset, expr_count + 1)?;
+        let operations = Column::new(data, &mut offset, expr_count)?;
+        let sizes = Column::new(data, &mut offset, expr_count)?;
+        offset = align(offset);
+        let operand_values = Column::new(data, &mut offset, operand_count)?;
+        let operand_kinds = Column::new(data, &mut offset, operand_count)?;
+        Ok(Self {
+            export,
+            start,
+            name,
+            arch,
+            instructions,
+            addresses,
+            operand_starts,
+            operations,
+            sizes,
+            operand_values,
+            operand_kinds,
+        })
+    }
+
+    pub fn name(&self) -> &'a str {
+        self.export.string(self.name as usize)
+    }
+
+    pub fn arch(&self) -> &'a str {
+        self.export.string(self.arch as usize)
+    }
+
+    pub fn expr_count(&self) -> usize {
+        self.operations.len()
+    }
+
+    /// Indices into the operand columns of the operands of expression `expr`.
+    pub fn operand_range(&self, expr: usize) -> Range<usize> {
+        self.operand_starts.get(expr) as usize..self.operand_starts.get(expr + 1) as usize
+    }
+
+    /// The operands of expression `expr` as (kind, value).
+    pub fn operands(&self, expr: usize) -> impl Iterator<Item = (ILExportOperandKind, u64)> + '_ {
+        self.operand_range(expr).map(|i| {
+            (
+                ILExportOperandKind::from_raw(self.operand_kinds.get(i)),
+                self.operand_values.get(i),
+            )
+        })
+    }
+}
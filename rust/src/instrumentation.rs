@@ -0,0 +1,392 @@
+//! Named counters, histograms and scoped timers, matching the `Instrumentation` classes of the C++ API.
+//!
+//! Instruments are declared as statics and record nothing until [`set_enabled`] is called or the
+//! `BN_API_INSTRUMENTATION` environment variable is set, so leaving them in hot code costs a single relaxed load
+//! while they are disabled. This module doesn't need the core to be initialized.
+//!
+//! ```
+//! use binaryninja::instrumentation::Histogram;
+//!
+//! static DECODE_TIME: Histogram = Histogram::new("arch.myarch.decode");
+//!
+//! fn decode() {
+//!     let _scope = DECODE_TIME.scope();
+//!     // ...
+//! }
+//! ```
+//!
+//! Traces from [`trace_json`] use the Chrome trace event format, the same as `Instrumentation::GetTraceJson`
+//! in C++ and `get_trace_json` in the Python `instrumentation` module.
+
+use std::collections::hash_map::DefaultHasher;
+use std::collections::BTreeMap;
+use std::hash::{Hash, Hasher};
+use std::sync::atomic::{AtomicI64, AtomicU64, AtomicU8, Ordering};
+use std::sync::{LazyLock, Mutex, OnceLock};
+use std::time::Instant;
+
+const UNKNOWN: u8 = 0;
+const DISABLED: u8 = 1;
+const ENABLED: u8 = 2;
+
+static STATE: AtomicU8 = AtomicU8::new(UNKNOWN);
+static TRACING: AtomicU8 = AtomicU8::new(DISABLED);
+
+struct HistogramData {
+    name: String,
+    count: AtomicU64,
+    sum: AtomicU64,
+    min: AtomicU64,
+    max: AtomicU64,
+    buckets: [AtomicU64; 65],
+}
+
+impl HistogramData {
+    fn new(name: &str) -> Self {
+        Self {
+            name: name.to_string(),
+            count: AtomicU64::new(0),
+            sum: AtomicU64::new(0),
+            min: AtomicU64::new(u64::MAX),
+            max: AtomicU64::new(0),
+            buckets: std::array::from_fn(|_| AtomicU64::new(0)),
+        }
+    }
+
+    fn category(&self) -> &str {
+        self.name.split('.').next().unwrap_or_default()
+    }
+
+    fn record(&self, value: u64) {
+        let bucket = (u64::BITS - value.leading_zeros()) as usize;
+        self.count.fetch_add(1, Ordering::Relaxed);
+        self.sum.fetch_add(value, Ordering::Relaxed);
+        self.buckets[bucket].fetch_add(1, Ordering::Relaxed);
+        self.min.fetch_min(value, Ordering::Relaxed);
+        self.max.fetch_max(value, Ordering::Relaxed);
+    }
+
+    fn reset(&self) {
+        self.count.store(0, Ordering::Relaxed);
+        self.sum.store(0, Ordering::Relaxed);
+        self.min.store(u64::MAX, Ordering::Relaxed);
+        self.max.store(0, Ordering::Relaxed);
+        for bucket in &self.buckets {
+            bucket.store(0, Ordering::Relaxed);
+        }
+    }
+}
+
+// Instruments keep references into the registry, so its entries are leaked and live for the whole process
+#[derive(Default)]
+struct Registry {
+    counters: BTreeMap<String, &'static AtomicI64>,
+    histograms: BTreeMap<String, &'static HistogramData>,
+}
+
+static REGISTRY: LazyLock<Mutex<Registry>> = LazyLock::new(Default::default);
+
+struct TraceEvent {
+    histogram: &'static HistogramData,
+    thread: u64,
+    start_us: u64,
+    duration_us: u64,
+}
+
+struct Trace {
+    events: Vec<TraceEvent>,
+    limit: usize,
+    start: Instant,
+}
+
+static TRACE: LazyLock<Mutex<Trace>> = LazyLock::new(|| {
+    Mutex::new(Trace {
+        events: Vec::new(),
+        limit: 0,
+        start: Instant::now(),
+    })
+});
+
+pub fn is_enabled() -> bool {
+    match STATE.load(Ordering::Relaxed) {
+        ENABLED => true,
+        DISABLED => false,
+        _ => {
+            let enabled = std::env::var_os("BN_API_INSTRUMENTATION").is_some();
+            let _ = STATE.compare_exchange(
+                UNKNOWN,
+                if enabled { ENABLED } else { DISABLED },
+                Ordering::Relaxed,
+                Ordering::Relaxed,
+            );
+            STATE.load(Ordering::Relaxed) == ENABLED
+        }
+    }
+}
+
+pub fn set_enabled(enabled: bool) {
+    STATE.store(if enabled { ENABLED } else { DISABLED }, Ordering::Relaxed);
+}
+
+pub fn is_tracing_enabled() -> bool {
+    TRACING.load(Ordering::Relaxed) == ENABLED
+}
+
+/// Record every [`Scope`] as a trace event. Enabling discards any previously recorded events and enables
+/// instrumentation if needed; events beyond `max_events` are not recorded.
+pub fn set_tracing_enabled(enabled: bool, max_events: usize) {
+    let mut trace = TRACE.lock().unwrap();
+    if enabled {
+        trace.events.clear();
+        trace.limit = max_events;
+        trace.start = Instant::now();
+        set_enabled(true);
+    }
+    TRACING.store(if enabled { ENABLED } else { DISABLED }, Ordering::Relaxed);
+}
+
+/// A named value to add to. Counters with the same name share their value.
+pub struct Counter {
+    name: &'static str,
+    value: OnceLock<&'static AtomicI64>,
+}
+
+impl Counter {
+    pub const fn new(name: &'static str) -> Self {
+        Self {
+            name,
+            value: OnceLock::new(),
+        }
+    }
+
+    fn value(&self) -> &'static AtomicI64 {
+        self.value.get_or_init(|| {
+            let mut registry = REGISTRY.lock().unwrap();
+            registry
+                .counters
+                .entry(self.name.to_string())
+                .or_insert_with(|| Box::leak(Box::new(AtomicI64::new(0))))
+        })
+    }
+
+    pub fn add(&self, value: i64) {
+        if is_enabled() {
+            self.value().fetch_add(value, Ordering::Relaxed);
+        }
+    }
+
+    pub fn increment(&self) {
+        self.add(1)
+    }
+
+    pub fn get(&self) -> i64 {
+        self.value().load(Ordering::Relaxed)
+    }
+}
+
+/// Distribution of values, such as sizes or durations, in power of two buckets. Histograms with the same name
+/// share their values.
+pub struct Histogram {
+    name: &'static str,
+    data: OnceLock<&'static HistogramData>,
+}
+
+impl Histogram {
+    pub const fn new(name: &'static str) -> Self {
+        Self {
+            name,
+            data: OnceLock::new(),
+        }
+    }
+
+    fn data(&self) -> &'static HistogramData {
+        self.data.get_or_init(|| {
+            let mut registry = REGISTRY.lock().unwrap();
+            registry
+                .histograms
+                .entry(self.name.to_string())
+                .or_insert_with(|| Box::leak(Box::new(HistogramData::new(self.name))))
+        })
+    }
+
+    pub fn record(&self, value: u64) {
+        if is_enabled() {
+            self.data().record(value);
+        }
+    }
+
+    /// Time until the returned guard is dropped, recorded in nanoseconds.
+    pub fn scope(&self) -> Scope {
+        Scope {
+            started: is_enabled().then(|| (self.data(), Instant::now())),
+        }
+    }
+}
+
+/// Records the time since it was created into a histogram, and as a trace event while tracing, when dropped.
+#[must_use = "the time is recorded when the scope is dropped"]
+pub struct Scope {
+    started: Option<(&'static HistogramData, Instant)>,
+}
+
+impl Drop for Scope {
+    fn drop(&mut self) {
+        let Some((data, start)) = self.started else {
+            return;
+        };
+        let duration = start.elapsed().as_nanos() as u64;
+        data.record(duration);
+        if !is_tracing_enabled() {
+            return;
+        }
+
+        let mut hasher = DefaultHasher::new();
+        std::thread::current().id().hash(&mut hasher);
+        let mut trace = TRACE.lock().unwrap();
+        if !is_tracing_enabled() || trace.events.len() >= trace.limit || start < trace.start {
+            return;
+        }
+        let start_us = (start - trace.start).as_micros() as u64;
+        trace.events.push(TraceEvent {
+            histogram: data,
+            thread: hasher.finish(),
+            start_us,
+            duration_us: duration / 1000,
+        });
+    }
+}
+
+#[derive(Clone, Debug, Default, PartialEq, Eq)]
+pub struct HistogramSnapshot {
+    pub count: u64,
+    pub sum: u64,
+    pub min: u64,
+    pub max: u64,
+    /// `buckets[i]` counts the values `v` with `2^(i-1) <= v < 2^i`; `buckets[0]` counts zeroes.
+    pub buckets: Vec<u64>,
+}
+
+#[derive(Clone, Debug, Default, PartialEq, Eq)]
+pub struct Snapshot {
+    pub counters: BTreeMap<String, i64>,
+    /// Histograms that have recorded at least one value.
+    pub histograms: BTreeMap<String, HistogramSnapshot>,
+}
+
+pub fn snapshot() -> Snapshot {
+    let registry = REGISTRY.lock().unwrap();
+    let counters = registry
+        .counters
+        .iter()
+        .map(|(name, value)| (name.clone(), value.load(Ordering::Relaxed)))
+        .collect();
+    let histograms = registry
+        .histograms
+        .iter()
+        .filter(|(_, data)| data.count.load(Ordering::Relaxed) != 0)
+        .map(|(name, data)| {
+            let mut buckets: Vec<u64> = data
+                .buckets
+                .iter()
+                .map(|bucket| bucket.load(Ordering::Relaxed))
+                .collect();
+            // Trailing empty buckets carry no information
+            while buckets.last() == Some(&0) {
+                buckets.pop();
+            }
+            let histogram = HistogramSnapshot {
+                count: data.count.load(Ordering::Relaxed),
+                sum: data.sum.load(Ordering::Relaxed),
+                min: data.min.load(Ordering::Relaxed),
+                max: data.max.load(Ordering::Relaxed),
+                buckets,
+            };
+            (name.clone(), histogram)
+        })
+        .collect();
+    Snapshot {
+        counters,
+        histograms,
+    }
+}
+
+fn push_json_string(out: &mut String, value: &str) {
+    out.push('"');
+    for c in value.chars() {
+        match c {
+            '"' => out.push_str("\\\""),
+            '\\' => out.push_str("\\\\"),
+            c if (c as u32) < 0x20 => out.push_str(&format!("\\u{:04x}", c as u32)),
+            c => out.push(c),
+        }
+    }
+    out.push('"');
+}
+
+/// The snapshot as JSON, in the same layout as `Instrumentation::GetSnapshotJson` in C++.
+pub fn snapshot_json() -> String {
+    let snapshot = snapshot();
+    let mut out = String::from("{\"counters\":{");
+    for (i, (name, value)) in snapshot.counters.iter().enumerate() {
+        if i != 0 {
+            out.push(',');
+        }
+        push_json_string(&mut out, name);
+        out.push_str(&format!(":{value}"));
+    }
+    out.push_str("},\"histograms\":{");
+    for (i, (name, histogram)) in snapshot.histograms.iter().enumerate() {
+        if i != 0 {
+            out.push(',');
+        }
+        push_json_string(&mut out, name);
+        let buckets: Vec<String> = histogram.buckets.iter().map(u64::to_string).collect();
+        out.push_str(&format!(
+            ":{{\"buckets\":[{}],\"count\":{},\"max\":{},\"min\":{},\"sum\":{}}}",
+            buckets.join(","),
+            histogram.count,
+            histogram.max,
+            histogram.min,
+            histogram.sum
+        ));
+    }
+    out.push_str("}}");
+    out
+}
+
+/// Recorded trace events in the Chrome trace event format, for chrome://tracing or Perfetto.
+pub fn trace_json() -> String {
+    let trace = TRACE.lock().unwrap();
+    let mut out = String::from("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (i, event) in trace.events.iter().enumerate() {
+        if i != 0 {
+            out.push(',');
+        }
+        out.push_str("{\"cat\":");
+        push_json_string(&mut out, event.histogram.category());
+        out.push_str(&format!(",\"dur\":{},\"name\":", event.duration_us));
+        push_json_string(&mut out, &event.histogram.name);
+        out.push_str(&format!(
+            ",\"ph\":\"X\",\"pid\":0,\"tid\":{},\"ts\":{}}}",
+            event.thread, event.start_us
+        ));
+    }
+    out.push_str("]}");
+    out
+}
+
+/// Zero every counter and histogram and discard recorded trace events.
+pub fn reset() {
+    {
+        let registry = REGISTRY.lock().unwrap();
+        for value in registry.counters.values() {
+            value.store(0, Ordering::Relaxed);
+        }
+        for data in registry.histograms.values() {
+            data.reset();
+        }
+    }
+    let mut trace = TRACE.lock().unwrap();
+    trace.events.clear();
+    trace.start = Instant::now();
+}
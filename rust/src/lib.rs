@@ -55,6 +55,8 @@ pub mod function;
 pub mod function_recognizer;
 pub mod headless;
 pub mod high_level_il;
+pub mod il_export;
+pub mod instrumentation;
 pub mod interaction;
 pub mod linear_view;
 pub mod logger;
@@ -1595,7 +1595,10 @@ fn get_var_ssa(id: u64, version: usize) -> SSAVariable {
     SSAVariable::new(get_var(id), version)
 }
 
-fn get_call_output(function: &MediumLevelILFunction, idx: usize) -> impl Iterator<Item = Variable> {
+fn get_call_output(
+    function: &MediumLevelILFunction,
+    idx: usize,
+) -> impl Iterator<Item = Variable> + '_ {
     let op = get_raw_operation(function, idx);
     assert_eq!(op.operation, BNMediumLevelILOperation::MLIL_CALL_OUTPUT);
     OperandIter::new(function, op.operands[1] as usize, op.operands[0] as usize).vars()
@@ -1604,7 +1607,7 @@ fn get_call_output(function: &MediumLevelILFunction, idx: usize) -> impl Iterato
 fn get_call_params(
     function: &MediumLevelILFunction,
     idx: usize,
-) -> impl Iterator<Item = MediumLevelILInstruction> {
+) -> impl Iterator<Item = MediumLevelILInstruction> + '_ {
     let op = get_raw_operation(function, idx);
     assert_eq!(op.operation, BNMediumLevelILOperation::MLIL_CALL_PARAM);
     OperandIter::new(function, op.operands[1] as usize, op.operands[0] as usize).exprs()
@@ -1613,7 +1616,7 @@ fn get_call_params(
 fn get_call_output_ssa(
     function: &MediumLevelILFunction,
     idx: usize,
-) -> impl Iterator<Item = SSAVariable> {
+) -> impl Iterator<Item = SSAVariable> + '_ {
     let op = get_raw_operation(function, idx);
     assert_eq!(op.operation, BNMediumLevelILOperation::MLIL_CALL_OUTPUT_SSA);
     OperandIter::new(function, op.operands[2] as usize, op.operands[1] as usize).ssa_vars()
@@ -1622,7 +1625,7 @@ fn get_call_output_ssa(
 fn get_call_params_ssa(
     function: &MediumLevelILFunction,
     idx: usize,
-) -> impl Iterator<Item = MediumLevelILInstruction> {
+) -> impl Iterator<Item = MediumLevelILInstruction> + '_ {
     let op = get_raw_operation(function, idx);
     assert_eq!(op.operation, BNMediumLevelILOperation::MLIL_CALL_PARAM_SSA);
     OperandIter::new(function, op.operands[2] as usize, op.operands[1] as usize).exprs()
@@ -9,7 +9,7 @@ use crate::high_level_il::{
 use crate::medium_level_il::{
     MediumLevelILFunction, MediumLevelILInstruction, MediumLevelInstructionIndex,
 };
-use crate::rc::{Ref, RefCountable};
+use crate::rc::RefCountable;
 use crate::variable::{SSAVariable, Variable};
 
 // TODO: This code needs to go away IMO, we have the facilities to do this for each IL already!
@@ -54,44 +54,45 @@ impl ILFunction for HighLevelILFunction {
     }
 }
 
-pub struct OperandIter<F: ILFunction + RefCountable> {
-    function: Ref<F>,
+/// Operand list of an expression, borrowing the function it belongs to so iterating doesn't take a reference.
+pub struct OperandIter<'a, F: ILFunction + RefCountable> {
+    function: &'a F,
     remaining: usize,
     next_iter_idx: Option<usize>,
     current_iter: OperandIterInner,
 }
 
-impl<F: ILFunction + RefCountable> OperandIter<F> {
-    pub(crate) fn new(function: &F, idx: usize, number: usize) -> Self {
+impl<'a, F: ILFunction + RefCountable> OperandIter<'a, F> {
+    pub(crate) fn new(function: &'a F, idx: usize, number: usize) -> Self {
         // Zero-length lists immediately finish iteration
         let next_iter_idx = if number > 0 { Some(idx) } else { None };
         Self {
-            function: function.to_owned(),
+            function,
             remaining: number,
             next_iter_idx,
             current_iter: OperandIterInner::empty(),
         }
     }
 
-    pub fn pairs(self) -> OperandPairIter<F> {
+    pub fn pairs(self) -> OperandPairIter<'a, F> {
         assert_eq!(self.len() % 2, 0);
         OperandPairIter(self)
     }
 
-    pub fn exprs(self) -> OperandExprIter<F> {
+    pub fn exprs(self) -> OperandExprIter<'a, F> {
         OperandExprIter(self)
     }
 
-    pub fn vars(self) -> OperandVarIter<F> {
+    pub fn vars(self) -> OperandVarIter<'a, F> {
         OperandVarIter(self)
     }
 
-    pub fn ssa_vars(self) -> OperandSSAVarIter<F> {
+    pub fn ssa_vars(self) -> OperandSSAVarIter<'a, F> {
         OperandSSAVarIter(self.pairs())
     }
 }
 
-impl<F: ILFunction + RefCountable> Iterator for OperandIter<F> {
+impl<F: ILFunction + RefCountable> Iterator for OperandIter<'_, F> {
     type Item = u64;
 
     fn next(&mut self) -> Option<Self::Item> {
@@ -118,7 +119,7 @@ impl<F: ILFunction + RefCountable> Iterator for OperandIter<F> {
     }
 }
 
-impl<F: ILFunction + RefCountable> ExactSizeIterator for OperandIter<F> {
+impl<F: ILFunction + RefCountable> ExactSizeIterator for OperandIter<'_, F> {
     fn len(&self) -> usize {
         self.remaining + self.current_iter.len()
     }
@@ -166,9 +167,9 @@ impl ExactSizeIterator for OperandIterInner {
     }
 }
 
-pub struct OperandPairIter<F: ILFunction + RefCountable>(OperandIter<F>);
+pub struct OperandPairIter<'a, F: ILFunction + RefCountable>(OperandIter<'a, F>);
 
-impl<F: ILFunction + RefCountable> Iterator for OperandPairIter<F> {
+impl<F: ILFunction + RefCountable> Iterator for OperandPairIter<'_, F> {
     type Item = (u64, u64);
 
     fn next(&mut self) -> Option<Self::Item> {
@@ -177,15 +178,15 @@ impl<F: ILFunction + RefCountable> Iterator for OperandPairIter<F> {
         Some((first, second))
     }
 }
-impl<F: ILFunction + RefCountable> ExactSizeIterator for OperandPairIter<F> {
+impl<F: ILFunction + RefCountable> ExactSizeIterator for OperandPairIter<'_, F> {
     fn len(&self) -> usize {
         self.0.len() / 2
     }
 }
 
-pub struct OperandExprIter<F: ILFunction + RefCountable>(OperandIter<F>);
+pub struct OperandExprIter<'a, F: ILFunction + RefCountable>(OperandIter<'a, F>);
 
-impl<F: ILFunction + RefCountable> Iterator for OperandExprIter<F> {
+impl<F: ILFunction + RefCountable> Iterator for OperandExprIter<'_, F> {
     type Item = F::Instruction;
 
     fn next(&mut self) -> Option<Self::Item> {
@@ -196,30 +197,30 @@ impl<F: ILFunction + RefCountable> Iterator for OperandExprIter<F> {
     }
 }
 
-impl<F: ILFunction + RefCountable> ExactSizeIterator for OperandExprIter<F> {
+impl<F: ILFunction + RefCountable> ExactSizeIterator for OperandExprIter<'_, F> {
     fn len(&self) -> usize {
         self.0.len()
     }
 }
 
-pub struct OperandVarIter<F: ILFunction + RefCountable>(OperandIter<F>);
+pub struct OperandVarIter<'a, F: ILFunction + RefCountable>(OperandIter<'a, F>);
 
-impl<F: ILFunction + RefCountable> Iterator for OperandVarIter<F> {
+impl<F: ILFunction + RefCountable> Iterator for OperandVarIter<'_, F> {
     type Item = Variable;
 
     fn next(&mut self) -> Option<Self::Item> {
         self.0.next().map(Variable::from_identifier)
     }
 }
-impl<F: ILFunction + RefCountable> ExactSizeIterator for OperandVarIter<F> {
+impl<F: ILFunction + RefCountable> ExactSizeIterator for OperandVarIter<'_, F> {
     fn len(&self) -> usize {
         self.0.len()
     }
 }
 
-pub struct OperandSSAVarIter<F: ILFunction + RefCountable>(OperandPairIter<F>);
+pub struct OperandSSAVarIter<'a, F: ILFunction + RefCountable>(OperandPairIter<'a, F>);
 
-impl<F: ILFunction + RefCountable> Iterator for OperandSSAVarIter<F> {
+impl<F: ILFunction + RefCountable> Iterator for OperandSSAVarIter<'_, F> {
     type Item = SSAVariable;
 
     fn next(&mut self) -> Option<Self::Item> {
@@ -230,7 +231,7 @@ impl<F: ILFunction + RefCountable> Iterator for OperandSSAVarIter<F> {
     }
 }
 
-impl<F: ILFunction + RefCountable> ExactSizeIterator for OperandSSAVarIter<F> {
+impl<F: ILFunction + RefCountable> ExactSizeIterator for OperandSSAVarIter<'_, F> {
     fn len(&self) -> usize {
         self.0.len()
     }
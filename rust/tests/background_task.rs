@@ -47,3 +47,16 @@ fn test_background_task_progress(_session: &Session) {
     assert_eq!(second_progress, "new progress");
     task.finish();
 }
+
+#[rstest]
+fn test_background_task_numeric_progress(_session: &Session) {
+    let task = BackgroundTask::new("test numeric progress", false);
+    let progress = BackgroundTaskProgress::new(task.clone(), "Counting", 10);
+    progress.add(1);
+    assert_eq!(task.progress_text().as_str(), "Counting (1/10)");
+    progress.set(5);
+    assert_eq!(progress.current(), 5);
+    progress.flush();
+    assert_eq!(task.progress_text().as_str(), "Counting (5/10)");
+    task.finish();
+}
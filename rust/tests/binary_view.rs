@@ -67,3 +67,28 @@ fn test_binary_saving_database(_session: &Session) {
         .expect("Failed to get entry point function");
     assert_eq!(new_entry_function.symbol().raw_name().as_str(), "test");
 }
+
+#[rstest]
+fn test_session_serve(session: &Session) {
+    let out_dir = env!("OUT_DIR").parse::<PathBuf>().unwrap();
+    let jobs = format!(
+        "{}\n\n{}\n{}\n",
+        out_dir.join("atox.obj").display(),
+        out_dir.join("missing.obj").display(),
+        out_dir.join("atox.obj").display()
+    );
+    let mut results = Vec::new();
+    session
+        .serve(jobs.as_bytes(), &mut results, |bv| {
+            bv.functions().len().to_string()
+        })
+        .expect("Failed to serve jobs");
+
+    let results = String::from_utf8(results).unwrap();
+    let lines: Vec<&str> = results.lines().collect();
+    assert_eq!(lines.len(), 3);
+    // Each job starts from a freshly loaded view, so the same file gives the same result.
+    assert_eq!(lines[0], lines[2]);
+    assert_ne!(lines[0], "0");
+    assert!(lines[1].starts_with("error: "));
+}
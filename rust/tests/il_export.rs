@@ -0,0 +1,111 @@
+use binaryninja::il_export::{ILExport, ILExportError, ILExportLevel, ILExportOperandKind};
+
+fn pad(data: &mut Vec<u8>) {
+    while data.len() % 8 != 0 {
+        data.push(0);
+    }
+}
+
+/// An export with one function `main` made of `eax = 1`, laid out the way the exporter writes it.
+fn build_export() -> Vec<u8> {
+    let strings = ["main", "x86_64", "eax"];
+    let mut data = vec![0u8; 32];
+
+    let function_offset = data.len() as u64;
+    data.extend_from_slice(&0x1000u64.to_le_bytes());
+    // name, arch, instructions, expressions, operands, reserved
+    for value in [0u32, 1, 1, 2, 2, 0] {
+        data.extend_from_slice(&value.to_le_bytes());
+    }
+    data.extend_from_slice(&1u32.to_le_bytes());
+    pad(&mut data);
+    for _ in 0..2 {
+        data.extend_from_slice(&0x1000u64.to_le_bytes());
+    }
+    for start in [0u32, 1, 2] {
+        data.extend_from_slice(&start.to_le_bytes());
+    }
+    // LLIL_CONST, LLIL_SET_REG
+    for operation in [9u16, 1] {
+        data.extend_from_slice(&operation.to_le_bytes());
+    }
+    data.extend_from_slice(&[4, 4]);
+    pad(&mut data);
+    // The constant, then the index of "eax" in the string table
+    for value in [1u64, 2] {
+        data.extend_from_slice(&value.to_le_bytes());
+    }
+    data.extend_from_slice(&[0, 3]);
+    pad(&mut data);
+
+    let strings_offset = data.len() as u64;
+    data.extend_from_slice(&(strings.len() as u32).to_le_bytes());
+    data.extend_from_slice(&0u32.to_le_bytes());
+    let mut offset = 0u64;
+    for string in strings {
+        data.extend_from_slice(&offset.to_le_bytes());
+        offset += string.len() as u64;
+    }
+    data.extend_from_slice(&offset.to_le_bytes());
+    for string in strings {
+        data.extend_from_slice(string.as_bytes());
+    }
+    pad(&mut data);
+
+    let index_offset = data.len() as u64;
+    data.extend_from_slice(&function_offset.to_le_bytes());
+
+    data[0..4].copy_from_slice(b"BNIL");
+    data[4..8].copy_from_slice(&1u32.to_le_bytes());
+    data[8..12].copy_from_slice(&0u32.to_le_bytes());
+    data[12..16].copy_from_slice(&1u32.to_le_bytes());
+    data[16..24].copy_from_slice(&strings_offset.to_le_bytes());
+    data[24..32].copy_from_slice(&index_offset.to_le_bytes());
+    data
+}
+
+#[test]
+fn test_read_export() {
+    let data = build_export();
+    let export = ILExport::new(&data).expect("Failed to read export");
+    assert_eq!(export.level(), ILExportLevel::LowLevelIL);
+    assert_eq!(export.function_count(), 1);
+    assert_eq!(export.string_count(), 3);
+
+    let function = export.function(0).expect("Failed to read function");
+    assert_eq!(function.start, 0x1000);
+    assert_eq!(function.name(), "main");
+    assert_eq!(function.arch(), "x86_64");
+    assert_eq!(function.instructions.len(), 1);
+    assert_eq!(function.instructions.get(0), 1);
+    assert_eq!(function.expr_count(), 2);
+    assert_eq!(function.operations.get(1), 1);
+    assert_eq!(
+        function.operands(0).collect::<Vec<_>>(),
+        vec![(ILExportOperandKind::Integer, 1)]
+    );
+
+    let (kind, value) = function.operands(1).next().unwrap();
+    assert_eq!(kind, ILExportOperandKind::Register);
+    assert!(kind.is_string());
+    assert_eq!(export.string(value as usize), "eax");
+}
+
+#[test]
+fn test_invalid_export() {
+    let mut data = build_export();
+    assert_eq!(
+        ILExport::new(&data[..16]).err(),
+        Some(ILExportError::OutOfBounds)
+    );
+    data[4] = 2;
+    assert_eq!(
+        ILExport::new(&data).err(),
+        Some(ILExportError::UnsupportedVersion(2))
+    );
+    data[0] = b'X';
+    assert_eq!(
+        ILExport::new(&data).err(),
+        Some(ILExportError::InvalidMagic)
+    );
+}
@@ -0,0 +1,44 @@
+use binaryninja::instrumentation::{self, Counter, Histogram};
+
+static COUNTER: Counter = Counter::new("test.counter");
+static HISTOGRAM: Histogram = Histogram::new("test.histogram");
+
+#[test]
+fn test_instrumentation() {
+    // Nothing is recorded until instrumentation is enabled
+    instrumentation::set_enabled(false);
+    COUNTER.add(5);
+    HISTOGRAM.record(5);
+    assert_eq!(COUNTER.get(), 0);
+    assert!(!instrumentation::snapshot()
+        .histograms
+        .contains_key("test.histogram"));
+
+    instrumentation::set_tracing_enabled(true, 16);
+    COUNTER.increment();
+    COUNTER.add(2);
+    for value in [0, 1, 5, 8] {
+        HISTOGRAM.record(value);
+    }
+    drop(HISTOGRAM.scope());
+
+    let snapshot = instrumentation::snapshot();
+    assert_eq!(snapshot.counters["test.counter"], 3);
+    let histogram = &snapshot.histograms["test.histogram"];
+    assert_eq!(histogram.count, 5);
+    assert_eq!(histogram.min, 0);
+    assert_eq!(histogram.buckets[..5], [1, 1, 0, 1, 1]);
+
+    let trace = instrumentation::trace_json();
+    assert!(trace.contains("\"name\":\"test.histogram\""));
+    assert!(trace.contains("\"cat\":\"test\""));
+    assert!(instrumentation::snapshot_json().contains("\"test.counter\":3"));
+
+    instrumentation::reset();
+    assert_eq!(COUNTER.get(), 0);
+    assert!(instrumentation::snapshot().histograms.is_empty());
+    assert_eq!(
+        instrumentation::trace_json(),
+        "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[]}"
+    );
+}
@@ -1,4 +1,5 @@
 #include "binaryninjaapi.h"
+#include "ffi.h"
 #include <cstring>
 
 using namespace BinaryNinja;
@@ -155,20 +156,8 @@ bool Settings::UpdateProperty(const std::string& key, const std::string& propert
 bool Settings::UpdateProperty(
     const std::string& key, const std::string& property, const std::vector<std::string>& value)
 {
-	char** buffer = new char*[value.size()];
-	if (!buffer)
-		return false;
-
-	for (size_t i = 0; i < value.size(); i++)
-		buffer[i] = BNAllocString(value[i].c_str());
-
-	bool result =
-	    BNSettingsUpdateStringListProperty(m_object, key.c_str(), property.c_str(), (const char**)buffer, value.size());
-
-	for (size_t i = 0; i < value.size(); i++)
-		BNFreeString(buffer[i]);
-	delete[] buffer;
-	return result;
+	vector<const char*> buffer = BorrowApiStringList(value);
+	return BNSettingsUpdateStringListProperty(m_object, key.c_str(), property.c_str(), buffer.data(), value.size());
 }
 
 
@@ -322,20 +311,9 @@ bool Settings::Set(const string& key, const string& value, Ref<BinaryView> view,
 
 bool Settings::Set(const string& key, const vector<string>& value, Ref<BinaryView> view, BNSettingsScope scope)
 {
-	char** buffer = new char*[value.size()];
-	if (!buffer)
-		return false;
-
-	for (size_t i = 0; i < value.size(); i++)
-		buffer[i] = BNAllocString(value[i].c_str());
-
-	bool result = BNSettingsSetStringList(
-	    m_object, view ? view->GetObject() : nullptr, nullptr, scope, key.c_str(), (const char**)buffer, value.size());
-
-	for (size_t i = 0; i < value.size(); i++)
-		BNFreeString(buffer[i]);
-	delete[] buffer;
-	return result;
+	vector<const char*> buffer = BorrowApiStringList(value);
+	return BNSettingsSetStringList(
+	    m_object, view ? view->GetObject() : nullptr, nullptr, scope, key.c_str(), buffer.data(), value.size());
 }
 
 
@@ -480,20 +458,9 @@ bool Settings::Set(const string& key, const string& value, Ref<Function> func, B
 
 bool Settings::Set(const string& key, const vector<string>& value, Ref<Function> func, BNSettingsScope scope)
 {
-	char** buffer = new char*[value.size()];
-	if (!buffer)
-		return false;
-
-	for (size_t i = 0; i < value.size(); i++)
-		buffer[i] = BNAllocString(value[i].c_str());
-
-	bool result = BNSettingsSetStringList(
-	    m_object, nullptr, func ? func->GetObject() : nullptr, scope, key.c_str(), (const char**)buffer, value.size());
-
-	for (size_t i = 0; i < value.size(); i++)
-		BNFreeString(buffer[i]);
-	delete[] buffer;
-	return result;
+	vector<const char*> buffer = BorrowApiStringList(value);
+	return BNSettingsSetStringList(
+	    m_object, nullptr, func ? func->GetObject() : nullptr, scope, key.c_str(), buffer.data(), value.size());
 }
 
 
@@ -219,6 +219,62 @@ bool Transform::Encode(const DataBuffer&, DataBuffer&, const map<string, DataBuf
 }
 
 
+static constexpr size_t StreamChunkSize = 1024 * 1024;
+
+
+static DataBuffer ReadWholeStream(const Transform::StreamInput& input)
+{
+	DataBuffer result;
+	size_t used = 0;
+	while (true)
+	{
+		if (result.GetLength() - used < StreamChunkSize)
+			result.SetSize(max(result.GetLength() * 2, used + StreamChunkSize));
+		size_t read = input((uint8_t*)result.GetData() + used, StreamChunkSize);
+		if (read == 0)
+			break;
+		used += min(read, StreamChunkSize);
+	}
+	result.SetSize(used);
+	return result;
+}
+
+
+static bool WriteWholeStream(const DataBuffer& data, const Transform::StreamOutput& output)
+{
+	const uint8_t* bytes = (const uint8_t*)data.GetData();
+	for (size_t offset = 0; offset < data.GetLength(); offset += StreamChunkSize)
+	{
+		if (!output(bytes + offset, min(StreamChunkSize, data.GetLength() - offset)))
+			return false;
+	}
+	return true;
+}
+
+
+bool Transform::DecodeStream(
+    const StreamInput& input, const StreamOutput& output, const map<string, DataBuffer>& params)
+{
+	if (GetType() == InvertingTransform)
+		return EncodeStream(input, output, params);
+
+	DataBuffer outputBuf;
+	if (!Decode(ReadWholeStream(input), outputBuf, params))
+		return false;
+	return WriteWholeStream(outputBuf, output);
+}
+
+
+bool Transform::EncodeStream(
+    const StreamInput& input, const StreamOutput& output, const map<string, DataBuffer>& params)
+{
+	DataBuffer outputBuf;
+	if (!Encode(ReadWholeStream(input), outputBuf, params))
+		return false;
+	return WriteWholeStream(outputBuf, output);
+}
+
+
 CoreTransform::CoreTransform(BNTransform* xform) : Transform(xform) {}
 
 
@@ -545,6 +545,48 @@ bool Type::operator!=(const Type& other)
 }
 
 
+uint64_t Type::GetStructuralHash() const
+{
+	// Only fields that any two equal types must agree on are mixed in, and named type references are not
+	// followed, so the walk always terminates
+	uint64_t hash = 0xcbf29ce484222325;
+	auto mix = [&](uint64_t value) {
+		hash ^= value + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+	};
+
+	BNTypeClass cls = GetClass();
+	mix(cls);
+	mix(GetWidth());
+	mix(GetAlignment());
+	switch (cls)
+	{
+	case IntegerTypeClass:
+	case EnumerationTypeClass:
+		mix(IsSigned().GetValue());
+		break;
+	case PointerTypeClass:
+		mix(BNTypeGetReferenceType(m_object));
+		mix(GetChildType()->GetStructuralHash());
+		break;
+	case ArrayTypeClass:
+		mix(GetElementCount());
+		mix(GetChildType()->GetStructuralHash());
+		break;
+	case FunctionTypeClass:
+		mix(GetChildType()->GetStructuralHash());
+		mix(GetParameters().size());
+		mix(HasVariableArguments().GetValue());
+		break;
+	case NamedTypeReferenceClass:
+		mix(std::hash<string>()(GetNamedTypeReference()->GetName().GetString()));
+		break;
+	default:
+		break;
+	}
+	return hash;
+}
+
+
 BNTypeClass Type::GetClass() const
 {
 	return BNGetTypeClass(m_object);
@@ -961,6 +1003,123 @@ Ref<Type> Type::ArrayType(const Confidence<Ref<Type>>& type, uint64_t elem)
 }
 
 
+Ref<Type> TypeInterner::InternLocked(Type* type, uint64_t hash)
+{
+	auto& bucket = m_types[hash];
+	for (auto& existing : bucket)
+	{
+		if (*existing == *type)
+			return existing;
+	}
+	bucket.push_back(type);
+	return type;
+}
+
+
+Ref<Type> TypeInterner::Intern(Type* type)
+{
+	uint64_t hash = type->GetStructuralHash();
+	std::unique_lock<std::mutex> lock(m_mutex);
+	return InternLocked(type, hash);
+}
+
+
+Ref<Type> TypeInterner::IntegerType(size_t width, const Confidence<bool>& sign, const string& altName)
+{
+	auto key = std::make_tuple(width, sign.GetValue(), sign.GetConfidence(), altName);
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		auto i = m_integerTypes.find(key);
+		if (i != m_integerTypes.end())
+			return i->second;
+	}
+
+	Ref<Type> type = Type::IntegerType(width, sign, altName);
+	uint64_t hash = type->GetStructuralHash();
+	std::unique_lock<std::mutex> lock(m_mutex);
+	type = InternLocked(type, hash);
+	return m_integerTypes.emplace(key, type).first->second;
+}
+
+
+Ref<Type> TypeInterner::PointerType(Architecture* arch, const Confidence<Ref<Type>>& type,
+    const Confidence<bool>& cnst, const Confidence<bool>& vltl, BNReferenceType refType)
+{
+	auto key = std::make_tuple(type->GetObject(), type.GetConfidence(), arch->GetObject(), (size_t)0,
+	    cnst.GetValue(), cnst.GetConfidence(), vltl.GetValue(), vltl.GetConfidence(), refType);
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		auto i = m_pointerTypes.find(key);
+		if (i != m_pointerTypes.end())
+			return i->second.second;
+	}
+
+	Ref<Type> result = Type::PointerType(arch, type, cnst, vltl, refType);
+	uint64_t hash = result->GetStructuralHash();
+	std::unique_lock<std::mutex> lock(m_mutex);
+	result = InternLocked(result, hash);
+	return m_pointerTypes.emplace(key, std::make_pair(type.GetValue(), result)).first->second.second;
+}
+
+
+Ref<Type> TypeInterner::PointerType(size_t width, const Confidence<Ref<Type>>& type,
+    const Confidence<bool>& cnst, const Confidence<bool>& vltl, BNReferenceType refType)
+{
+	auto key = std::make_tuple(type->GetObject(), type.GetConfidence(), (BNArchitecture*)nullptr, width,
+	    cnst.GetValue(), cnst.GetConfidence(), vltl.GetValue(), vltl.GetConfidence(), refType);
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		auto i = m_pointerTypes.find(key);
+		if (i != m_pointerTypes.end())
+			return i->second.second;
+	}
+
+	Ref<Type> result = Type::PointerType(width, type, cnst, vltl, refType);
+	uint64_t hash = result->GetStructuralHash();
+	std::unique_lock<std::mutex> lock(m_mutex);
+	result = InternLocked(result, hash);
+	return m_pointerTypes.emplace(key, std::make_pair(type.GetValue(), result)).first->second.second;
+}
+
+
+Ref<Type> TypeInterner::ArrayType(const Confidence<Ref<Type>>& type, uint64_t elem)
+{
+	auto key = std::make_tuple(type->GetObject(), type.GetConfidence(), elem);
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		auto i = m_arrayTypes.find(key);
+		if (i != m_arrayTypes.end())
+			return i->second.second;
+	}
+
+	Ref<Type> result = Type::ArrayType(type, elem);
+	uint64_t hash = result->GetStructuralHash();
+	std::unique_lock<std::mutex> lock(m_mutex);
+	result = InternLocked(result, hash);
+	return m_arrayTypes.emplace(key, std::make_pair(type.GetValue(), result)).first->second.second;
+}
+
+
+size_t TypeInterner::GetCount()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	size_t count = 0;
+	for (auto& bucket : m_types)
+		count += bucket.second.size();
+	return count;
+}
+
+
+void TypeInterner::Clear()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_types.clear();
+	m_integerTypes.clear();
+	m_pointerTypes.clear();
+	m_arrayTypes.clear();
+}
+
+
 Ref<Type> Type::FunctionType(const Confidence<Ref<Type>>& returnValue,
     const Confidence<Ref<CallingConvention>>& callingConvention, const std::vector<FunctionParameter>& params,
     const Confidence<bool>& varArg, const Confidence<int64_t>& stackAdjust)
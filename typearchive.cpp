@@ -223,6 +223,37 @@ std::vector<std::string> TypeArchive::GetSnapshotChildIds(const std::string& id)
 }
 
 
+TypeArchiveSnapshotDiff TypeArchive::DiffSnapshots(const std::string& from, const std::string& to) const
+{
+	TypeArchiveSnapshotDiff result;
+	if (from == to)
+		return result;
+
+	std::unordered_map<std::string, QualifiedNameAndType> before;
+	if (!from.empty())
+		before = GetTypes(from);
+	std::unordered_map<std::string, QualifiedNameAndType> after = GetTypes(to);
+	for (auto& [id, type] : after)
+	{
+		auto i = before.find(id);
+		if (i == before.end())
+			result.added.push_back(id);
+		else if ((i->second.name != type.name) || !(*i->second.type == *type.type))
+			result.changed.push_back(id);
+	}
+	for (auto& [id, type] : before)
+	{
+		if (after.find(id) == after.end())
+			result.removed.push_back(id);
+	}
+
+	std::sort(result.added.begin(), result.added.end());
+	std::sort(result.changed.begin(), result.changed.end());
+	std::sort(result.removed.begin(), result.removed.end());
+	return result;
+}
+
+
 TypeContainer TypeArchive::GetTypeContainer() const
 {
 	return TypeContainer(BNGetTypeArchiveTypeContainer(m_object));
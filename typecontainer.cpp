@@ -18,11 +18,29 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <algorithm>
+#include <cctype>
 #include "binaryninjaapi.h"
 
 using namespace BinaryNinja;
 
 
+static std::string LowercaseName(const std::string& name)
+{
+	std::string result = name;
+	for (char& c : result)
+		c = (char)tolower((unsigned char)c);
+	return result;
+}
+
+
+static void AppendTrigrams(const std::string& key, std::vector<uint32_t>& trigrams)
+{
+	for (size_t i = 0; i + 3 <= key.size(); i++)
+		trigrams.push_back(((uint32_t)(uint8_t)key[i] << 16) | ((uint32_t)(uint8_t)key[i + 1] << 8) | (uint8_t)key[i + 2]);
+}
+
+
 TypeContainer::TypeContainer(BNTypeContainer* container): m_object(container)
 {
 
@@ -484,3 +502,116 @@ bool TypeContainer::ParseTypesFromSource(
 		errors
 	);
 }
+
+
+TypeNameIndex::TypeNameIndex(const TypeContainer& container, bool fuzzy): m_fuzzy(fuzzy)
+{
+	Refresh(container);
+}
+
+
+bool TypeNameIndex::Refresh(const TypeContainer& container)
+{
+	m_entries.clear();
+	m_trigrams.clear();
+
+	char** resultIds;
+	BNQualifiedName* resultNames;
+	size_t resultCount;
+	if (!BNTypeContainerGetTypeNamesAndIds(container.GetObject(), &resultIds, &resultNames, &resultCount))
+		return false;
+
+	m_entries.reserve(resultCount);
+	for (size_t i = 0; i < resultCount; i++)
+	{
+		QualifiedName name = QualifiedName::FromAPIObject(&resultNames[i]);
+		std::string key = LowercaseName(name.GetString());
+		m_entries.push_back({std::move(key), resultIds[i], std::move(name)});
+	}
+	BNFreeStringList(resultIds, resultCount);
+	BNFreeTypeNameList(resultNames, resultCount);
+
+	std::sort(m_entries.begin(), m_entries.end(), [](const Entry& a, const Entry& b) { return a.key < b.key; });
+
+	if (m_fuzzy)
+	{
+		std::vector<uint32_t> trigrams;
+		for (size_t i = 0; i < m_entries.size(); i++)
+		{
+			trigrams.clear();
+			AppendTrigrams(m_entries[i].key, trigrams);
+			for (uint32_t trigram : trigrams)
+				m_trigrams.emplace_back(trigram, (uint32_t)i);
+		}
+		std::sort(m_trigrams.begin(), m_trigrams.end());
+		m_trigrams.erase(std::unique(m_trigrams.begin(), m_trigrams.end()), m_trigrams.end());
+	}
+	return true;
+}
+
+
+std::vector<TypeNameIndex::Match> TypeNameIndex::FindByPrefix(const std::string& prefix, size_t maxResults) const
+{
+	std::string key = LowercaseName(prefix);
+	auto it = std::lower_bound(m_entries.begin(), m_entries.end(), key,
+		[](const Entry& entry, const std::string& key) { return entry.key < key; });
+
+	std::vector<Match> result;
+	for (; it != m_entries.end() && result.size() < maxResults && it->key.compare(0, key.size(), key) == 0; ++it)
+		result.push_back({it->typeId, it->name});
+	return result;
+}
+
+
+std::vector<TypeNameIndex::Match> TypeNameIndex::FindFuzzy(const std::string& query, size_t maxResults) const
+{
+	std::vector<Match> result;
+	if (!m_fuzzy)
+		return result;
+
+	std::string key = LowercaseName(query);
+	std::vector<uint32_t> trigrams;
+	AppendTrigrams(key, trigrams);
+	if (trigrams.empty())
+	{
+		for (auto& entry : m_entries)
+		{
+			if (result.size() >= maxResults)
+				break;
+			if (entry.key.find(key) != std::string::npos)
+				result.push_back({entry.typeId, entry.name});
+		}
+		return result;
+	}
+	std::sort(trigrams.begin(), trigrams.end());
+	trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+
+	// Count the query's trigrams in each name through the posting list of each one
+	std::unordered_map<uint32_t, uint32_t> scores;
+	for (uint32_t trigram : trigrams)
+	{
+		auto it = std::lower_bound(m_trigrams.begin(), m_trigrams.end(), std::make_pair(trigram, (uint32_t)0));
+		for (; it != m_trigrams.end() && it->first == trigram; ++it)
+			scores[it->second]++;
+	}
+
+	// Names need at least half of the query's trigrams; ties go to the shorter name
+	std::vector<std::pair<uint32_t, uint32_t>> ranked;
+	for (auto& [entry, score] : scores)
+		if (score * 2 >= trigrams.size())
+			ranked.emplace_back(score, entry);
+	auto better = [&](const std::pair<uint32_t, uint32_t>& a, const std::pair<uint32_t, uint32_t>& b) {
+		if (a.first != b.first)
+			return a.first > b.first;
+		if (m_entries[a.second].key.size() != m_entries[b.second].key.size())
+			return m_entries[a.second].key.size() < m_entries[b.second].key.size();
+		return a.second < b.second;
+	};
+	size_t count = std::min(maxResults, ranked.size());
+	std::partial_sort(ranked.begin(), ranked.begin() + count, ranked.end(), better);
+
+	result.reserve(count);
+	for (size_t i = 0; i < count; i++)
+		result.push_back({m_entries[ranked[i].second].typeId, m_entries[ranked[i].second].name});
+	return result;
+}
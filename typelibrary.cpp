@@ -183,6 +183,25 @@ std::vector<QualifiedNameAndType> TypeLibrary::GetNamedTypes()
 }
 
 
+std::vector<QualifiedName> TypeLibrary::GetNamedTypeNames()
+{
+	BNTypeContainer* container = BNGetTypeLibraryTypeContainer(m_object);
+	BNQualifiedName* names = nullptr;
+	size_t count = 0;
+	bool ok = BNTypeContainerGetTypeNames(container, &names, &count);
+	BNFreeTypeContainer(container);
+	if (!ok)
+		return {};
+
+	std::vector<QualifiedName> result;
+	result.reserve(count);
+	for (size_t i = 0; i < count; i ++)
+		result.push_back(QualifiedName::FromAPIObject(&names[i]));
+	BNFreeTypeNameList(names, count);
+	return result;
+}
+
+
 void TypeLibrary::SetName(const std::string& name)
 {
 	BNSetTypeLibraryName(m_object, name.c_str());
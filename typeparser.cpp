@@ -1,10 +1,35 @@
 #include "binaryninjaapi.h"
+#include <algorithm>
 #include <filesystem>
+#include <thread>
 
 using namespace BinaryNinja;
 using namespace std;
 namespace fs = std::filesystem;
 
+// Results of ParseTypesFromSourceCached, keyed by everything that was passed to the parser
+struct CachedParse
+{
+	TypeParserResult result;
+	vector<TypeParserError> errors;
+};
+
+static constexpr size_t MaxCachedParses = 256;
+
+
+static mutex& GetParseCacheMutex()
+{
+	static mutex cacheMutex;
+	return cacheMutex;
+}
+
+
+static unordered_map<string, shared_ptr<const CachedParse>>& GetParseCache()
+{
+	static unordered_map<string, shared_ptr<const CachedParse>> cache;
+	return cache;
+}
+
 
 TypeParser::TypeParser(const string& name) : m_nameForRegister(name) {}
 
@@ -348,10 +373,7 @@ void TypeParser::FreeErrorListCallback(void* ctxt, BNTypeParserError* errors, si
 }
 
 
-bool TypeParser::ParseTypesFromSourceFile(const string& fileName, Ref<Platform> platform,
-	std::optional<TypeContainer> existingTypes, const vector<string>& options,
-	const vector<string>& includeDirs, const string& autoTypeSource, TypeParserResult& result,
-	vector<TypeParserError>& errors)
+static bool ReadSourceFile(const string& fileName, string& source, vector<TypeParserError>& errors)
 {
 	if (!fs::is_regular_file(fileName))
 	{
@@ -388,9 +410,116 @@ bool TypeParser::ParseTypesFromSourceFile(const string& fileName, Ref<Platform>
 	data[size] = 0;
 	fclose(fp);
 
-	bool ok = ParseTypesFromSource(data, fileName, platform, existingTypes, options, includeDirs, autoTypeSource, result, errors);
+	source = data;
 	delete[] data;
-	return ok;
+	return true;
+}
+
+
+bool TypeParser::ParseTypesFromSourceFile(const string& fileName, Ref<Platform> platform,
+	std::optional<TypeContainer> existingTypes, const vector<string>& options,
+	const vector<string>& includeDirs, const string& autoTypeSource, TypeParserResult& result,
+	vector<TypeParserError>& errors)
+{
+	string source;
+	if (!ReadSourceFile(fileName, source, errors))
+		return false;
+	return ParseTypesFromSource(
+		source, fileName, platform, existingTypes, options, includeDirs, autoTypeSource, result, errors);
+}
+
+
+bool TypeParser::ParseTypesFromSourceCached(const string& source, const string& fileName, Ref<Platform> platform,
+	std::optional<TypeContainer> existingTypes, const vector<string>& options,
+	const vector<string>& includeDirs, const string& autoTypeSource, TypeParserResult& result,
+	vector<TypeParserError>& errors)
+{
+	// Fields are separated by NUL, which can't appear in any of them; the source itself is only hashed
+	string key = GetName();
+	for (const string& field : {platform->GetName(), existingTypes ? existingTypes->GetId() : string(), fileName,
+		autoTypeSource, to_string(hash<string>()(source)), to_string(source.size())})
+	{
+		key.push_back('\0');
+		key += field;
+	}
+	for (const vector<string>* list : {&options, &includeDirs})
+	{
+		key.push_back('\0');
+		for (const string& item : *list)
+		{
+			key.push_back('\1');
+			key += item;
+		}
+	}
+
+	{
+		unique_lock<mutex> lock(GetParseCacheMutex());
+		auto cached = GetParseCache().find(key);
+		if (cached != GetParseCache().end())
+		{
+			result = cached->second->result;
+			errors.insert(errors.end(), cached->second->errors.begin(), cached->second->errors.end());
+			return true;
+		}
+	}
+
+	auto parse = make_shared<CachedParse>();
+	if (!ParseTypesFromSource(source, fileName, platform, existingTypes, options, includeDirs, autoTypeSource,
+		parse->result, parse->errors))
+	{
+		errors.insert(errors.end(), parse->errors.begin(), parse->errors.end());
+		return false;
+	}
+	result = parse->result;
+	errors.insert(errors.end(), parse->errors.begin(), parse->errors.end());
+
+	unique_lock<mutex> lock(GetParseCacheMutex());
+	if (GetParseCache().size() >= MaxCachedParses)
+		GetParseCache().clear();
+	GetParseCache()[key] = parse;
+	return true;
+}
+
+
+bool TypeParser::ParseTypesFromSourceFiles(const vector<string>& fileNames, Ref<Platform> platform,
+	std::optional<TypeContainer> existingTypes, const vector<string>& options,
+	const vector<string>& includeDirs, const string& autoTypeSource, vector<TypeParserResult>& results,
+	vector<TypeParserError>& errors)
+{
+	results.assign(fileNames.size(), TypeParserResult());
+	vector<vector<TypeParserError>> fileErrors(fileNames.size());
+	vector<char> succeeded(fileNames.size(), false);
+	atomic<size_t> next = 0;
+	auto worker = [&]() {
+		for (size_t i = next++; i < fileNames.size(); i = next++)
+		{
+			string source;
+			if (!ReadSourceFile(fileNames[i], source, fileErrors[i]))
+				continue;
+			succeeded[i] = ParseTypesFromSourceCached(source, fileNames[i], platform, existingTypes, options,
+				includeDirs, autoTypeSource, results[i], fileErrors[i]);
+		}
+	};
+
+	size_t threadCount = min<size_t>(max<unsigned>(thread::hardware_concurrency(), 1), fileNames.size());
+	vector<thread> threads;
+	for (size_t i = 1; i < threadCount; i++)
+		threads.emplace_back(worker);
+	worker();
+	for (auto& t : threads)
+		t.join();
+
+	// Errors are reported in file order regardless of which file finished first
+	for (auto& errorList : fileErrors)
+		errors.insert(errors.end(), errorList.begin(), errorList.end());
+	return all_of(succeeded.begin(), succeeded.end(), [](char ok) { return ok; });
+}
+
+
+void TypeParser::ClearParseCache()
+{
+	unique_lock<mutex> lock(GetParseCacheMutex());
+	GetParseCache().clear();
 }
 
 
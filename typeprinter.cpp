@@ -492,3 +492,85 @@ std::string CoreTypePrinter::PrintAllTypes(
 	BNFreeString(resultStr);
 	return result;
 }
+
+
+TypeLinesCache::TypeLinesCache(BinaryView* view) :
+    BinaryDataNotification(TypeDefined | TypeUndefined | TypeReferenceChanged), m_view(view)
+{
+	m_view->RegisterNotification(this);
+}
+
+
+TypeLinesCache::~TypeLinesCache()
+{
+	m_view->UnregisterNotification(this);
+}
+
+
+shared_ptr<const vector<TypeDefinitionLine>> TypeLinesCache::GetTypeLines(TypePrinter* printer,
+	const string& typeId, int paddingCols, bool collapsed, BNTokenEscapingType escaping)
+{
+	// Printers are registered for the life of the process, so their handle identifies them
+	string key = fmt::format("{} {} {} {} ", fmt::ptr(printer->GetObject()), paddingCols, collapsed, (int)escaping);
+	key += typeId;
+
+	uint64_t generation;
+	{
+		unique_lock<mutex> lock(m_mutex);
+		auto cached = m_lines.find(key);
+		if (cached != m_lines.end())
+			return cached->second;
+		generation = m_generation;
+	}
+
+	Ref<Type> type = m_view->GetTypeById(typeId);
+	if (!type)
+		return nullptr;
+	auto lines = make_shared<const vector<TypeDefinitionLine>>(printer->GetTypeLines(
+		type, m_view->GetTypeContainer(), m_view->GetTypeNameById(typeId), paddingCols, collapsed, escaping));
+
+	// Lines printed while the types changed may already be stale
+	unique_lock<mutex> lock(m_mutex);
+	if (generation == m_generation)
+		m_lines[key] = lines;
+	return lines;
+}
+
+
+void TypeLinesCache::PrintTypesInDependencyOrder(TypePrinter* printer,
+	const function<bool(const QualifiedName&, const vector<TypeDefinitionLine>&)>& callback, int paddingCols,
+	bool collapsed, BNTokenEscapingType escaping)
+{
+	for (auto& [name, type] : m_view->GetDependencySortedTypes())
+	{
+		auto lines = GetTypeLines(printer, m_view->GetTypeId(name), paddingCols, collapsed, escaping);
+		if (lines && !callback(name, *lines))
+			return;
+	}
+}
+
+
+void TypeLinesCache::Invalidate()
+{
+	unique_lock<mutex> lock(m_mutex);
+	m_lines.clear();
+	m_generation++;
+}
+
+
+void TypeLinesCache::OnTypeDefined(BinaryView*, const QualifiedName&, Type*)
+{
+	Invalidate();
+}
+
+
+void TypeLinesCache::OnTypeUndefined(BinaryView*, const QualifiedName&, Type*)
+{
+	Invalidate();
+}
+
+
+void TypeLinesCache::OnTypeReferenceChanged(BinaryView*, const QualifiedName&, Type*)
+{
+	Invalidate();
+}
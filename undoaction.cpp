@@ -85,3 +85,64 @@ uint64_t UndoEntry::GetTimestamp()
 {
 	return BNUndoEntryGetTimestamp(m_object);
 }
+
+
+UndoBatch::UndoBatch(FileMetadata* file, size_t maxItems) :
+	m_file(file), m_maxItems(maxItems), m_uncaughtExceptions(std::uncaught_exceptions())
+{
+	m_id = m_file->BeginUndoActions(false);
+}
+
+
+UndoBatch::~UndoBatch()
+{
+	if (m_finished)
+		return;
+	if (std::uncaught_exceptions() > m_uncaughtExceptions && m_recording)
+		Revert();
+	else
+		Commit();
+}
+
+
+void UndoBatch::Add(size_t count)
+{
+	m_items += count;
+	m_chunkItems += count;
+	if (m_finished || m_maxItems == 0 || m_chunkItems < m_maxItems)
+		return;
+
+	if (m_recording)
+	{
+		LogWarn("Undo batch exceeded %zu items, the rest of it will not be undoable", m_maxItems);
+		m_recording = false;
+	}
+
+	// Drop what has been recorded so far and keep going in a new chunk
+	m_file->ForgetUndoActions(m_id);
+	m_id = m_file->BeginUndoActions(false);
+	m_chunkItems = 0;
+}
+
+
+void UndoBatch::Commit()
+{
+	if (m_finished)
+		return;
+	m_finished = true;
+	if (m_recording)
+		m_file->CommitUndoActions(m_id);
+	else
+		m_file->ForgetUndoActions(m_id);
+}
+
+
+void UndoBatch::Revert()
+{
+	if (m_finished)
+		return;
+	if (!m_recording)
+		throw std::logic_error("UndoBatch can't be reverted after its undo state was dropped");
+	m_finished = true;
+	m_file->RevertUndoActions(m_id);
+}
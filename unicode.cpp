@@ -18,14 +18,146 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <algorithm>
 #include "binaryninjaapi.h"
 #include "ffi.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+	#include <emmintrin.h>
+	#define UNICODE_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#include <arm_neon.h>
+	#define UNICODE_NEON
+#endif
+
+
+// The conversions below are done here instead of in the core for text that has exactly one UTF-8 encoding, which
+// is all of it in practice. Anything else (unpaired surrogates, code points past U+10FFFF, odd lengths) is passed
+// to the core so that it keeps deciding how invalid input is rendered. Like the core, conversion stops at the
+// first NUL since the result used to be read back from a C string.
+
+static void AppendCodePoint(uint32_t cp, char*& out)
+{
+	if (cp < 0x80)
+	{
+		*out++ = (char)cp;
+	}
+	else if (cp < 0x800)
+	{
+		*out++ = (char)(0xc0 | (cp >> 6));
+		*out++ = (char)(0x80 | (cp & 0x3f));
+	}
+	else if (cp < 0x10000)
+	{
+		*out++ = (char)(0xe0 | (cp >> 12));
+		*out++ = (char)(0x80 | ((cp >> 6) & 0x3f));
+		*out++ = (char)(0x80 | (cp & 0x3f));
+	}
+	else
+	{
+		*out++ = (char)(0xf0 | (cp >> 18));
+		*out++ = (char)(0x80 | ((cp >> 12) & 0x3f));
+		*out++ = (char)(0x80 | ((cp >> 6) & 0x3f));
+		*out++ = (char)(0x80 | (cp & 0x3f));
+	}
+}
+
+
+// Narrow the run of non-NUL ASCII code units at the start of `in` (little endian), 8 at a time. Returns the
+// number of units copied, which is a multiple of 8.
+static size_t CopyASCIIUTF16(const uint8_t* in, size_t units, char* out)
+{
+	size_t i = 0;
+#if defined(UNICODE_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i nonASCII = _mm_set1_epi16((short)0xff80);
+	for (; i + 8 <= units; i += 8)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*)(in + i * 2));
+		__m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(v, nonASCII), zero);
+		__m128i nul = _mm_cmpeq_epi16(v, zero);
+		if (_mm_movemask_epi8(_mm_andnot_si128(nul, ascii)) != 0xffff)
+			break;
+		_mm_storel_epi64((__m128i*)(out + i), _mm_packus_epi16(v, v));
+	}
+#elif defined(UNICODE_NEON)
+	const uint16x8_t one = vdupq_n_u16(1);
+	const uint16x8_t limit = vdupq_n_u16(0x7f);
+	for (; i + 8 <= units; i += 8)
+	{
+		uint16x8_t v = vreinterpretq_u16_u8(vld1q_u8(in + i * 2));
+		// 1..0x7f is the only range where v - 1 < 0x7f
+		if (vminvq_u16(vcltq_u16(vsubq_u16(v, one), limit)) != 0xffff)
+			break;
+		vst1_u8((uint8_t*)(out + i), vmovn_u16(v));
+	}
+#else
+	(void)in;
+	(void)units;
+	(void)out;
+#endif
+	return i;
+}
+
+
+// Convert little endian UTF-16 to UTF-8, returning false if the input needs the core to decide how to render it
+static bool TryUTF16ToUTF8(const uint8_t* utf16, size_t len, std::string& result)
+{
+	if (len % 2 != 0)
+		return false;
+
+	size_t units = len / 2;
+	// Every unit is at most 3 bytes of UTF-8, and a surrogate pair is 4 bytes for 2 units
+	result.resize(units * 3);
+	char* start = result.data();
+	char* out = start;
+	size_t i = 0;
+	while (i < units)
+	{
+		size_t copied = CopyASCIIUTF16(utf16 + i * 2, units - i, out);
+		i += copied;
+		out += copied;
+		if (i >= units)
+			break;
+
+		uint32_t unit = utf16[i * 2] | ((uint32_t)utf16[i * 2 + 1] << 8);
+		if (unit == 0)
+			break;
+		if (unit >= 0xdc00 && unit < 0xe000)
+			return false;
+		if (unit >= 0xd800 && unit < 0xdc00)
+		{
+			if (i + 1 >= units)
+				return false;
+			uint32_t low = utf16[i * 2 + 2] | ((uint32_t)utf16[i * 2 + 3] << 8);
+			if (low < 0xdc00 || low >= 0xe000)
+				return false;
+			AppendCodePoint(0x10000 + ((unit - 0xd800) << 10) + (low - 0xdc00), out);
+			i += 2;
+			continue;
+		}
+		AppendCodePoint(unit, out);
+		i++;
+	}
+	result.resize(out - start);
+	return true;
+}
+
+
+static bool IsUnambiguousCodePoint(uint32_t cp)
+{
+	return cp < 0x110000 && (cp < 0xd800 || cp >= 0xe000);
+}
+
 
 std::string BinaryNinja::Unicode::UTF16ToUTF8(const uint8_t* utf16, const size_t len)
 {
+	std::string result;
+	if (TryUTF16ToUTF8(utf16, len, result))
+		return result;
+
 	char* value = BNUnicodeUTF16ToUTF8(utf16, len);
-	std::string result(value);
+	result = value;
 	BNFreeString(value);
 	return result;
 }
@@ -33,6 +165,17 @@ std::string BinaryNinja::Unicode::UTF16ToUTF8(const uint8_t* utf16, const size_t
 
 std::string BinaryNinja::Unicode::UTF32ToUTF8(const uint8_t* utf32)
 {
+	uint32_t cp = utf32[0] | ((uint32_t)utf32[1] << 8) | ((uint32_t)utf32[2] << 16) | ((uint32_t)utf32[3] << 24);
+	if (cp == 0)
+		return {};
+	if (IsUnambiguousCodePoint(cp))
+	{
+		char buffer[4];
+		char* out = buffer;
+		AppendCodePoint(cp, out);
+		return std::string(buffer, out);
+	}
+
 	char* value = BNUnicodeUTF32ToUTF8(utf32);
 	std::string result(value);
 	BNFreeString(value);
@@ -40,6 +183,86 @@ std::string BinaryNinja::Unicode::UTF32ToUTF8(const uint8_t* utf32)
 }
 
 
+std::vector<std::string> BinaryNinja::Unicode::GetStringContents(
+	BinaryView* view, const std::vector<BNStringReference>& strings)
+{
+	// Strings found by analysis are mostly packed together, so nearby ones are read with a single call to the
+	// view instead of one each
+	static constexpr size_t MaxReadGap = 256;
+	static constexpr size_t MaxReadLength = 0x10000;
+
+	std::vector<size_t> order(strings.size());
+	for (size_t i = 0; i < order.size(); i++)
+		order[i] = i;
+	std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return strings[a].start < strings[b].start; });
+
+	std::vector<std::string> result(strings.size());
+	std::vector<uint8_t> buffer;
+	for (size_t first = 0; first < order.size();)
+	{
+		uint64_t readStart = strings[order[first]].start;
+		uint64_t readEnd = readStart + strings[order[first]].length;
+		size_t last = first + 1;
+		for (; last < order.size(); last++)
+		{
+			const BNStringReference& next = strings[order[last]];
+			uint64_t nextEnd = std::max(readEnd, next.start + next.length);
+			if (next.start > readEnd + MaxReadGap || (nextEnd - readStart) > MaxReadLength)
+				break;
+			readEnd = nextEnd;
+		}
+
+		buffer.resize(readEnd - readStart);
+		buffer.resize(view->Read(buffer.data(), readStart, buffer.size()));
+
+		for (size_t i = first; i < last; i++)
+		{
+			const BNStringReference& ref = strings[order[i]];
+			size_t offset = ref.start - readStart;
+			if (offset >= buffer.size())
+				continue;
+			const uint8_t* data = buffer.data() + offset;
+			size_t length = std::min(ref.length, buffer.size() - offset);
+			std::string& text = result[order[i]];
+			switch (ref.type)
+			{
+			case Utf16String:
+				text = UTF16ToUTF8(data, length & ~(size_t)1);
+				break;
+			case Utf32String:
+			{
+				text.resize(length);
+				char* out = text.data();
+				size_t j = 0;
+				for (; j + 4 <= length; j += 4)
+				{
+					uint32_t cp = data[j] | ((uint32_t)data[j + 1] << 8) | ((uint32_t)data[j + 2] << 16)
+						| ((uint32_t)data[j + 3] << 24);
+					if (cp == 0 || !IsUnambiguousCodePoint(cp))
+						break;
+					AppendCodePoint(cp, out);
+				}
+				text.resize(out - text.data());
+				for (; j + 4 <= length; j += 4)
+				{
+					std::string next = UTF32ToUTF8(data + j);
+					if (next.empty())
+						break;
+					text += next;
+				}
+				break;
+			}
+			default:
+				text.assign((const char*)data, length);
+				break;
+			}
+		}
+		first = last;
+	}
+	return result;
+}
+
+
 bool BinaryNinja::Unicode::GetBlockRange(const std::string& name, std::pair<uint32_t, uint32_t>& range)
 {
 	return BNUnicodeGetBlockRange(name.c_str(), &range.first, &range.second);
@@ -48,17 +271,14 @@ bool BinaryNinja::Unicode::GetBlockRange(const std::string& name, std::pair<uint
 
 std::vector<std::vector<std::pair<uint32_t, uint32_t>>> BinaryNinja::Unicode::GetBlocksForNames(const std::vector<std::string>& names)
 {
-	char** nameList;
-	size_t nameCount;
-	AllocApiStringList(names, &nameList, &nameCount);
+	std::vector<const char*> nameList = BorrowApiStringList(names);
+	size_t nameCount = names.size();
 
 	uint32_t** blockStarts;
 	uint32_t** blockEnds;
 	size_t* blockCounts;
 	size_t blockListCounts;
-	BNUnicodeGetBlocksForNames(nameList, nameCount, &blockStarts, &blockEnds, &blockCounts, &blockListCounts);
-
-	FreeApiStringList(nameList, nameCount);
+	BNUnicodeGetBlocksForNames(nameList.data(), nameCount, &blockStarts, &blockEnds, &blockCounts, &blockListCounts);
 
 	std::vector<std::vector<std::pair<uint32_t, uint32_t>>> result;
 	for (size_t i = 0; i < blockListCounts; i ++)
@@ -109,40 +329,60 @@ std::map<std::string, std::pair<uint32_t, uint32_t>> BinaryNinja::Unicode::GetBl
 }
 
 
-std::string BinaryNinja::Unicode::GetUTF8String(
-	const std::vector<std::vector<std::pair<uint32_t, uint32_t>>>& unicodeBlocks,
-	const uint8_t* data,
-	const size_t offset,
-	const size_t dataLen
-)
+namespace
+{
+// Block ranges split into the parallel arrays the core takes, without a copy of every list
+struct UnicodeBlockLists
 {
-	std::vector<std::vector<uint32_t>> starts;
-	std::vector<std::vector<uint32_t>> ends;
+	std::vector<uint32_t> starts;
+	std::vector<uint32_t> ends;
+	std::vector<uint32_t*> startPtrs;
+	std::vector<uint32_t*> endPtrs;
+	std::vector<size_t> counts;
 
-	for (size_t i = 0; i < unicodeBlocks.size(); i ++)
+	UnicodeBlockLists(const std::vector<std::vector<std::pair<uint32_t, uint32_t>>>& unicodeBlocks)
 	{
-		std::vector<uint32_t> blockStarts;
-		std::vector<uint32_t> blockEnds;
-		for (size_t j = 0; j < unicodeBlocks[i].size(); j ++)
+		size_t total = 0;
+		for (auto& blockList : unicodeBlocks)
+			total += blockList.size();
+		starts.reserve(total);
+		ends.reserve(total);
+		for (auto& blockList : unicodeBlocks)
 		{
-			blockStarts.push_back(unicodeBlocks[i][j].first);
-			blockEnds.push_back(unicodeBlocks[i][j].second);
+			for (auto& block : blockList)
+			{
+				starts.push_back(block.first);
+				ends.push_back(block.second);
+			}
 		}
-		starts.push_back(blockStarts);
-		ends.push_back(blockEnds);
-	}
 
-	std::vector<uint32_t*> startPtrs;
-	std::vector<uint32_t*> endPtrs;
-	std::vector<size_t> counts;
-	for (size_t i = 0; i < unicodeBlocks.size(); i ++)
-	{
-		startPtrs.push_back(starts[i].data());
-		endPtrs.push_back(ends[i].data());
-		counts.push_back(starts[i].size());
+		size_t index = 0;
+		startPtrs.reserve(unicodeBlocks.size());
+		endPtrs.reserve(unicodeBlocks.size());
+		counts.reserve(unicodeBlocks.size());
+		for (auto& blockList : unicodeBlocks)
+		{
+			startPtrs.push_back(starts.data() + index);
+			endPtrs.push_back(ends.data() + index);
+			counts.push_back(blockList.size());
+			index += blockList.size();
+		}
 	}
+};
+}  // namespace
+
+
+std::string BinaryNinja::Unicode::GetUTF8String(
+	const std::vector<std::vector<std::pair<uint32_t, uint32_t>>>& unicodeBlocks,
+	const uint8_t* data,
+	const size_t offset,
+	const size_t dataLen
+)
+{
+	UnicodeBlockLists blocks(unicodeBlocks);
 
-	char* value = BNUnicodeGetUTF8String(startPtrs.data(), endPtrs.data(), counts.data(), unicodeBlocks.size(), data, offset, dataLen);
+	char* value = BNUnicodeGetUTF8String(
+		blocks.startPtrs.data(), blocks.endPtrs.data(), blocks.counts.data(), unicodeBlocks.size(), data, offset, dataLen);
 	std::string result(value);
 	BNFreeString(value);
 	return result;
@@ -156,33 +396,10 @@ std::string BinaryNinja::Unicode::ToEscapedString(
 	const size_t dataLen
 )
 {
-	std::vector<std::vector<uint32_t>> starts;
-	std::vector<std::vector<uint32_t>> ends;
-
-	for (size_t i = 0; i < unicodeBlocks.size(); i ++)
-	{
-		std::vector<uint32_t> blockStarts;
-		std::vector<uint32_t> blockEnds;
-		for (size_t j = 0; j < unicodeBlocks[i].size(); j ++)
-		{
-			blockStarts.push_back(unicodeBlocks[i][j].first);
-			blockEnds.push_back(unicodeBlocks[i][j].second);
-		}
-		starts.push_back(blockStarts);
-		ends.push_back(blockEnds);
-	}
-
-	std::vector<uint32_t*> startPtrs;
-	std::vector<uint32_t*> endPtrs;
-	std::vector<size_t> counts;
-	for (size_t i = 0; i < unicodeBlocks.size(); i ++)
-	{
-		startPtrs.push_back(starts[i].data());
-		endPtrs.push_back(ends[i].data());
-		counts.push_back(starts[i].size());
-	}
+	UnicodeBlockLists blocks(unicodeBlocks);
 
-	char* value = BNUnicodeToEscapedString(startPtrs.data(), endPtrs.data(), counts.data(), unicodeBlocks.size(), utf8Enabled, data, dataLen);
+	char* value = BNUnicodeToEscapedString(blocks.startPtrs.data(), blocks.endPtrs.data(), blocks.counts.data(),
+		unicodeBlocks.size(), utf8Enabled, data, dataLen);
 	std::string result(value);
 	BNFreeString(value);
 	return result;
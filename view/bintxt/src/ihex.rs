@@ -11,22 +11,83 @@ use binaryninja::segment::SegmentBuilder;
 use binaryninja::settings::{QueryOptions, Settings};
 use ihex::Record;
 
-fn parse_ihex(string: &str) -> Result<(Vec<u8>, IHexViewData)> {
-    let mut reader = ihex::Reader::new(&string);
+const INVALID_HEX: u8 = 0xff;
+
+// Value of every ASCII hex digit, `INVALID_HEX` for any other byte
+const HEX_VALUES: [u8; 256] = {
+    let mut values = [INVALID_HEX; 256];
+    let mut i = 0;
+    while i < 10 {
+        values[b'0' as usize + i] = i as u8;
+        i += 1;
+    }
+    let mut i = 0;
+    while i < 6 {
+        values[b'a' as usize + i] = 0xa + i as u8;
+        values[b'A' as usize + i] = 0xa + i as u8;
+        i += 1;
+    }
+    values
+};
+
+/// Decode the hex digit pairs of `digits` into `out`, which must be half as long.
+fn decode_hex(digits: &[u8], out: &mut [u8]) -> Option<()> {
+    for (pair, byte) in digits.chunks_exact(2).zip(out.iter_mut()) {
+        let high = HEX_VALUES[pair[0] as usize];
+        let low = HEX_VALUES[pair[1] as usize];
+        if (high | low) == INVALID_HEX {
+            return None;
+        }
+        *byte = high << 4 | low;
+    }
+    Some(())
+}
+
+/// Decode one `:LLAAAATT<data>CC` record into `buf`, returning (record type, offset, data).
+fn parse_record<'a>(line: &[u8], buf: &'a mut [u8; 260]) -> Option<(u8, u16, &'a [u8])> {
+    let digits = line.strip_prefix(b":")?;
+    if digits.len() % 2 != 0 || digits.len() < 10 || digits.len() > buf.len() * 2 {
+        return None;
+    }
+    let record = &mut buf[..digits.len() / 2];
+    decode_hex(digits, record)?;
+    let [data_len, offset_high, offset_low, record_type, rest @ ..] = &*record else {
+        return None;
+    };
+    // the checksum makes all the record bytes sum up to zero
+    if rest.len() != usize::from(*data_len) + 1
+        || record.iter().fold(0u8, |sum, byte| sum.wrapping_add(*byte)) != 0
+    {
+        return None;
+    }
+    let offset = u16::from_be_bytes([*offset_high, *offset_low]);
+    Some((*record_type, offset, &record[4..record.len() - 1]))
+}
+
+/// Parse the Intel HEX records straight from the file bytes.
+///
+/// Data records are decoded into a buffer on the stack and appended to the segment they extend, so the only
+/// allocations are the segments themselves.
+fn parse_ihex(input: &[u8]) -> Result<(Vec<u8>, IHexViewData)> {
     let mut unmerged_data: Vec<UnmergedSegment> = vec![];
     let mut start = None;
     let mut offset = None;
-    while let Some(record) = reader.next() {
-        let record = record.map_err(|e| {
-            log::error!("Unable to parse record: {e}");
-            ()
-        })?;
-        match record {
-            ihex::Record::EndOfFile => break,
-            ihex::Record::Data {
-                offset: data_offset,
-                value,
-            } => {
+    let mut record_buf = [0u8; 260];
+    let mut lines = input
+        .split(|byte| *byte == b'\n')
+        .map(|line| line.strip_suffix(b"\r").unwrap_or(line))
+        .filter(|line| !line.is_empty());
+    for line in lines.by_ref() {
+        let (record_type, data_offset, value) =
+            parse_record(line, &mut record_buf).ok_or_else(|| {
+                log::error!(
+                    "Unable to parse record: {}",
+                    String::from_utf8_lossy(&line[..line.len().min(32)])
+                );
+            })?;
+        match (record_type, value) {
+            (0x01, []) => break,
+            (0x00, value) => {
                 let address = match offset {
                     Some(IHexOffset::Segment(offset)) => {
                         u64::from(offset) * 16 + u64::from(data_offset)
@@ -39,38 +100,48 @@ fn parse_ihex(string: &str) -> Result<(Vec<u8>, IHexViewData)> {
                 // check if the block is just extending the previous one
                 match unmerged_data.last_mut() {
                     // check if the block is just extending the previous one, merge both
-                    Some(last) if last.end() == address => last.data.extend(value),
+                    Some(last) if last.end() == address => last.data.extend_from_slice(value),
                     // otherwise just add a new block
                     _ => unmerged_data.push(UnmergedSegment {
                         address,
-                        data: value,
+                        data: value.to_vec(),
                     }),
                 }
             }
-            ihex::Record::StartSegmentAddress { cs, ip } => {
+            (0x03, &[cs_high, cs_low, ip_high, ip_low]) => {
                 if start.is_some() {
                     log::error!("Multiple Start Address defined");
                     return Err(());
                 }
-                start = Some(IHexStart::Segment { _cs: cs, ip });
+                start = Some(IHexStart::Segment {
+                    _cs: u16::from_be_bytes([cs_high, cs_low]),
+                    ip: u16::from_be_bytes([ip_high, ip_low]),
+                });
             }
-            ihex::Record::StartLinearAddress(offset) => {
+            (0x05, &[b1, b2, b3, b4]) => {
                 if start.is_some() {
                     log::error!("Multiple Start Address defined");
                     return Err(());
                 }
-                start = Some(IHexStart::Linear(offset));
+                start = Some(IHexStart::Linear(u32::from_be_bytes([b1, b2, b3, b4])));
+            }
+            (0x02, &[high, low]) => {
+                offset = Some(IHexOffset::Segment(u16::from_be_bytes([high, low])))
             }
-            ihex::Record::ExtendedSegmentAddress(segment_offset) => {
-                offset = Some(IHexOffset::Segment(segment_offset))
+            (0x04, &[high, low]) => {
+                offset = Some(IHexOffset::Linear(u16::from_be_bytes([high, low])))
             }
-            ihex::Record::ExtendedLinearAddress(linear_offset) => {
-                offset = Some(IHexOffset::Linear(linear_offset))
+            (record_type, value) => {
+                log::error!(
+                    "Invalid record type {record_type:#04x} with {} bytes of data",
+                    value.len()
+                );
+                return Err(());
             }
         }
     }
     // can't have other record after the EoF record
-    if reader.next().is_some() {
+    if lines.next().is_some() {
         log::error!("Found record after EoF record");
         return Err(());
     }
@@ -101,18 +172,17 @@ impl CustomBinaryViewType for IHexViewConstructor {
         parent: &BinaryView,
         builder: CustomViewBuilder<'builder, Self>,
     ) -> Result<CustomView<'builder>> {
-        let bytes = parent.len() as usize;
-        let mut buf = vec![0; bytes];
-        let bytes_read = parent.read(&mut buf, 0);
-        if bytes_read != bytes {
-            log::error!("IHex file is too small");
-            return Err(());
-        }
-        let string = String::from_utf8(buf).map_err(|_| {
-            log::error!("File contains invalid UTF8 characters");
-        })?;
-
-        let (data, segments) = parse_ihex(&string)?;
+        let (data, segments) = {
+            let bytes = parent.len() as usize;
+            let mut buf = vec![0; bytes];
+            let bytes_read = parent.read(&mut buf, 0);
+            if bytes_read != bytes {
+                log::error!("IHex file is too small");
+                return Err(());
+            }
+            // the text isn't needed once decoded, don't keep it alive next to the view data
+            parse_ihex(&buf)?
+        };
 
         let parent_bin = BinaryView::from_data(&parent.file(), &data)?;
         builder.create::<IHexView>(&parent_bin, segments)
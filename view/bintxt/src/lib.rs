@@ -78,14 +78,28 @@ fn sort_and_merge_segments(mut unmerged_data: Vec<UnmergedSegment>) -> Result<Me
     // sort segments by address and len, so we can detect overlaps
     unmerged_data.sort_unstable_by_key(|segment| (segment.address, segment.data.len()));
 
-    let mut data: Vec<u8> =
-        Vec::with_capacity(unmerged_data.iter().map(|sector| sector.data.len()).sum());
+    let total_len: usize = unmerged_data.iter().map(|sector| sector.data.len()).sum();
     let mut segments: Vec<MergedSegment> = Vec::with_capacity(unmerged_data.len());
-    for segment in unmerged_data.into_iter() {
+    let mut unmerged_data = unmerged_data.into_iter().peekable();
+    // Files are mostly one contiguous block, so grow the first one into the data pool instead of copying
+    // it into a new allocation of the same size
+    let mut data = match unmerged_data.peek_mut() {
+        Some(first) => std::mem::take(&mut first.data),
+        None => vec![],
+    };
+    data.reserve_exact(total_len - data.len());
+    for (i, segment) in unmerged_data.enumerate() {
         // add the data to the data poll
-        let data_offset = u64::try_from(data.len()).unwrap();
-        let segment_len = u64::try_from(segment.data.len()).unwrap();
-        data.extend(segment.data);
+        let (data_offset, segment_len) = if i == 0 {
+            (0, u64::try_from(data.len()).unwrap())
+        } else {
+            let data_offset = u64::try_from(data.len()).unwrap();
+            data.extend(segment.data);
+            (
+                data_offset,
+                u64::try_from(data.len()).unwrap() - data_offset,
+            )
+        };
         match segments.last_mut() {
             // if have a last segment and the current chunk just extend it, merge both
             Some(last) if segment.address == last.end() => last.len += segment_len,
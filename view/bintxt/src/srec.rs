@@ -212,17 +212,19 @@ impl CustomBinaryViewType for SRecViewConstructor {
         parent: &BinaryView,
         builder: CustomViewBuilder<'builder, Self>,
     ) -> Result<CustomView<'builder>, ()> {
-        let bytes = parent.len() as usize;
-        let mut buf = vec![0; bytes];
-        let bytes_read = parent.read(&mut buf, 0);
-        if bytes_read != bytes {
-            log::error!("IHex file is too small");
-            return Err(());
-        }
-        let string = String::from_utf8(buf).map_err(|_| {
-            log::error!("File contains invalid UTF8 characters");
-        })?;
-        let (data, regs) = parse_srec(&string)?;
+        let (data, regs) = {
+            let bytes = parent.len() as usize;
+            let mut buf = vec![0; bytes];
+            let bytes_read = parent.read(&mut buf, 0);
+            if bytes_read != bytes {
+                log::error!("IHex file is too small");
+                return Err(());
+            }
+            let string = String::from_utf8(buf).map_err(|_| {
+                log::error!("File contains invalid UTF8 characters");
+            })?;
+            parse_srec(&string)?
+        };
 
         let parent_bin = BinaryView::from_data(&parent.file(), &data)?;
         builder.create::<SRecView>(&parent_bin, regs)
@@ -172,14 +172,16 @@ impl CustomBinaryViewType for TiTxtViewConstructor {
         parent: &BinaryView,
         builder: CustomViewBuilder<'builder, Self>,
     ) -> Result<CustomView<'builder>, ()> {
-        let bytes = parent.len() as usize;
-        let mut buf = vec![0; bytes];
-        let bytes_read = parent.read(&mut buf, 0);
-        if bytes_read != bytes {
-            log::error!("IHex file is too small");
-            return Err(());
-        }
-        let sectors = parse_ti_txt(&buf)?;
+        let sectors = {
+            let bytes = parent.len() as usize;
+            let mut buf = vec![0; bytes];
+            let bytes_read = parent.read(&mut buf, 0);
+            if bytes_read != bytes {
+                log::error!("IHex file is too small");
+                return Err(());
+            }
+            parse_ti_txt(&buf)?
+        };
 
         let parent_bin = BinaryView::from_data(&parent.file(), &sectors.data)?;
         builder.create::<TiTxtView>(&parent_bin, sectors.segments)
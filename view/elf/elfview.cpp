@@ -3,9 +3,15 @@
 #include <cxxabi.h>
 #endif
 #include <inttypes.h>
+#include <algorithm>
+#include <thread>
 #include "elfview.h"
 
 #define STRING_READ_CHUNK_SIZE 32
+// Symbol tables with at least this many entries are decoded on multiple threads
+#define PARALLEL_SYMBOL_DECODE_THRESHOLD 0x10000
+// Size of the window read at once when filling relocation data caches
+#define RELOCATION_DATA_WINDOW_SIZE 0x10000
 
 using namespace BinaryNinja;
 using namespace std;
@@ -14,6 +20,30 @@ using namespace std;
 static ElfViewType* g_elfViewType = nullptr;
 
 
+static inline uint16_t ReadBufferU16(const uint8_t* p, bool bigEndian)
+{
+	uint16_t value;
+	memcpy(&value, p, sizeof(value));
+	return bigEndian ? ToBE16(value) : ToLE16(value);
+}
+
+
+static inline uint32_t ReadBufferU32(const uint8_t* p, bool bigEndian)
+{
+	uint32_t value;
+	memcpy(&value, p, sizeof(value));
+	return bigEndian ? ToBE32(value) : ToLE32(value);
+}
+
+
+static inline uint64_t ReadBufferU64(const uint8_t* p, bool bigEndian)
+{
+	uint64_t value;
+	memcpy(&value, p, sizeof(value));
+	return bigEndian ? ToBE64(value) : ToLE64(value);
+}
+
+
 void BinaryNinja::InitElfViewType()
 {
 	static ElfViewType type;
@@ -373,12 +403,12 @@ bool ElfView::ParseSymbolTableEntry(BinaryReader& reader, ElfSymbolTableEntry& e
 		{
 			if (entry.section < m_elfSections.size())
 			{
-				entry.name = ReadStringTable(reader, m_sectionStringTable, m_elfSections[entry.section].name);
+				entry.name = ReadStringTableView(reader, m_sectionStringTable, m_elfSections[entry.section].name);
 			}
 		}
 		else
 		{
-			entry.name = ReadStringTable(reader, stringTable, entry.nameOffset);
+			entry.name = ReadStringTableView(reader, stringTable, entry.nameOffset);
 		}
 	}
 	catch (ReadException&)
@@ -395,7 +425,7 @@ bool ElfView::ParseSymbolTableEntry(BinaryReader& reader, ElfSymbolTableEntry& e
 		"\tsection    = %#04x\n"
 		"\tvalue      = %#012lx\n"
 		"\tsize       = %#012lx\n"
-		"\tname       = %#s",
+		"\tname       = %.*s",
 		sym, symbolTable.offset, stringTable.offset,
 		entry.nameOffset,
 		entry.type,
@@ -404,7 +434,7 @@ bool ElfView::ParseSymbolTableEntry(BinaryReader& reader, ElfSymbolTableEntry& e
 		entry.section,
 		entry.value,
 		entry.size,
-		entry.name.c_str());
+		(int)entry.name.size(), entry.name.data());
 	return true;
 }
 
@@ -415,9 +445,39 @@ void ElfView::GetRelocEntries(BinaryReader& reader, const vector<Elf64SectionHea
 	if (!implicit)
 		relocSize += m_elf32 ? 4 : 8;
 
+	bool bigEndian = m_endian == BigEndian;
 	for (auto& section : sections)
 	{
-		for (uint64_t j = 0; j < section.size / relocSize; j++)
+		uint64_t count = section.size / relocSize;
+		result.reserve(result.size() + count);
+
+		// Read the whole table at once and decode from memory when possible
+		DataBuffer table;
+		bool tableRead = false;
+		if (count * relocSize <= GetParentView()->GetLength())
+		{
+			reader.Seek(section.offset);
+			tableRead = reader.TryRead(table, count * relocSize);
+		}
+		if (tableRead)
+		{
+			const uint8_t* data = (const uint8_t*)table.GetData();
+			for (uint64_t j = 0; j < count; j++)
+			{
+				const uint8_t* p = data + (j * relocSize);
+				uint64_t ofs = m_elf32 ? ReadBufferU32(p, bigEndian) : ReadBufferU64(p, bigEndian);
+				uint64_t info = m_elf32 ? ReadBufferU32(p + 4, bigEndian) : ReadBufferU64(p + 8, bigEndian);
+				uint64_t addend = 0;
+				if (!implicit)
+					addend = m_elf32 ? ReadBufferU32(p + 8, bigEndian) : ReadBufferU64(p + 16, bigEndian);
+
+				result.push_back(ELFRelocEntry(ofs, info >> (m_elf32 ? 8 : 32), info & (m_elf32 ? 0xff : 0xffffffff),
+					addend, section.info, implicit));
+			}
+			continue;
+		}
+
+		for (uint64_t j = 0; j < count; j++)
 		{
 			reader.Seek(section.offset + (j * relocSize));
 			uint64_t ofs = m_elf32 ? reader.Read32() : reader.Read64();
@@ -442,6 +502,8 @@ static bool In(const string& str, const vector<string>& list)
 
 bool ElfView::Init()
 {
+	static InstrumentationHistogram histogram("view.elf.init");
+	InstrumentationScope scope(histogram);
 	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
 	// Add segments for the program headers
 	BinaryReader reader(GetParentView());
@@ -763,7 +825,7 @@ bool ElfView::Init()
 	// Finished for parse only mode
 	if (m_parseOnly)
 	{
-		m_stringTableCache.clear();
+		ReleaseStringTables();
 		return true;
 	}
 
@@ -1385,6 +1447,28 @@ bool ElfView::Init()
 	{
 		try
 		{
+			// Relocation tables are mostly sorted by address, so the data caches are filled from a window
+			// that is read once and reused by all of the relocations that fall inside it.
+			DataBuffer relocationWindow;
+			uint64_t relocationWindowStart = 0;
+			auto readRelocationData = [&](uint64_t address, uint8_t* dest) {
+				if ((address < relocationWindowStart) || (address + MAX_RELOCATION_SIZE > relocationWindowStart + relocationWindow.GetLength()))
+				{
+					relocationWindowStart = address;
+					virtualReader.Seek(address);
+					if (!virtualReader.TryRead(relocationWindow, RELOCATION_DATA_WINDOW_SIZE))
+					{
+						// Window crosses the end of mapped data, read just this relocation
+						relocationWindow.SetSize(0);
+						virtualReader.Seek(address);
+						virtualReader.TryRead(dest, MAX_RELOCATION_SIZE);
+						return;
+					}
+				}
+				memcpy(dest, (const uint8_t*)relocationWindow.GetData() + (address - relocationWindowStart), MAX_RELOCATION_SIZE);
+			};
+
+			m_relocationInfo.reserve(m_relocationInfo.size() + relocs.size());
 			for (auto& reloc: relocs)
 			{
 				BNRelocationInfo relocInfo;
@@ -1407,9 +1491,8 @@ bool ElfView::Init()
 				relocInfo.addend = reloc.addend;
 				relocInfo.implicitAddend = reloc.implicit;
 				relocInfo.base = baseAddress;
-				virtualReader.Seek(relocInfo.address);
 				memset(relocInfo.relocationDataCache, 0, sizeof(relocInfo.relocationDataCache));
-				virtualReader.TryRead(relocInfo.relocationDataCache, MAX_RELOCATION_SIZE);
+				readRelocationData(relocInfo.address, relocInfo.relocationDataCache);
 				m_relocationInfo.push_back(relocInfo);
 
 				if (isArmV7)
@@ -1458,7 +1541,7 @@ bool ElfView::Init()
 						if (entry.type == ELF_STT_SECTION)
 						{
 							// Section relative relocation
-							if (auto section = GetSectionByName(entry.name); section)
+							if (auto section = GetSectionByName(string(entry.name)); section)
 							{
 								DefineRelocation(m_arch, relocInfo, section->GetStart(), relocInfo.address);
 								continue;
@@ -1469,39 +1552,40 @@ bool ElfView::Init()
 							// handle anonymous symbol generation
 							if (!entry.name.size())
 							{
-								entry.name = "anonymous_";
+								string anonymousName = "anonymous_";
 								if (entry.type == ELF_STT_FUNC)
-									entry.name += "func";
+									anonymousName += "func";
 								else if (entry.type == ELF_STT_OBJECT)
-									entry.name += "object";
+									anonymousName += "object";
 								else
-									entry.name += "data";
-								entry.name += "_";
+									anonymousName += "data";
+								anonymousName += "_";
 
 								switch(entry.binding)
 								{
 									case NoBinding:
-										entry.name += "bind_none";
+										anonymousName += "bind_none";
 										break;
 									case LocalBinding:
-										entry.name += "bind_local";
+										anonymousName += "bind_local";
 										break;
 									case GlobalBinding:
-										entry.name += "bind_global";
+										anonymousName += "bind_global";
 										break;
 									case WeakBinding:
-										entry.name += "bind_weak";
+										anonymousName += "bind_weak";
 										break;
 									default:
 										break;
 								}
-								entry.name += "_";
-								entry.name += std::to_string(anonymousEntryCount++);
+								anonymousName += "_";
+								anonymousName += std::to_string(anonymousEntryCount++);
+								entry.name = InternSymbolName(anonymousName);
 								DefineElfSymbol(ExternalSymbol, entry.name, 0, false, entry.binding, entry.size);
 							}
 
 							// section undefined so query for external symbol directly
-							auto symbol = GetSymbolByRawName(entry.name, GetExternalNameSpace());
+							auto symbol = GetSymbolByRawName(string(entry.name), GetExternalNameSpace());
 							if (symbol)
 							{
 								DefineRelocation(m_arch, relocInfo, symbol, relocInfo.address);
@@ -1521,7 +1605,7 @@ bool ElfView::Init()
 						}
 
 						// retrieve first symbol that is not a symbol relocation
-						auto symbols = GetSymbolsByName(entry.name);
+						auto symbols = GetSymbolsByName(string(entry.name));
 						for (const auto& symbol : symbols)
 						{
 							if (symbol->GetAddress() == relocInfo.address)
@@ -1881,15 +1965,19 @@ bool ElfView::Init()
 	Ref<Type> rawElfHeaderType = Type::StructureType(rawElfHeaderStruct);
 	QualifiedName rawHeaderName = GetParentView()->DefineType(headerTypeId, headerName, rawElfHeaderType);
 
+	// Structural header symbols are defined in one batch once all of the header types are applied
+	vector<SymbolSpec> headerSymbols;
+	vector<SymbolSpec> parentHeaderSymbols;
+
 	// Define variable for ELF header
 	uint64_t addr;
 	if (GetAddressForDataOffset(0, addr))
 	{
 		DefineDataVariable(addr, Type::NamedType(this, elfHeaderName));
-		DefineAutoSymbol(new Symbol(DataSymbol, "__elf_header", addr, LocalBinding));
+		headerSymbols.push_back({DataSymbol, "__elf_header", addr, LocalBinding});
 	}
 	GetParentView()->DefineDataVariable(0, Type::NamedType(GetParentView(), rawHeaderName));
-	GetParentView()->DefineAutoSymbol(new Symbol(DataSymbol, "__elf_header", 0, LocalBinding));
+	parentHeaderSymbols.push_back({DataSymbol, "__elf_header", 0, LocalBinding});
 
 
 	// Create enum for ELF program header type
@@ -1988,11 +2076,11 @@ bool ElfView::Init()
 		{
 			DefineDataVariable(addr, Type::ArrayType(Type::NamedType(this, elfProgramHeaderName),
 				m_programHeaderCount));
-			DefineAutoSymbol(new Symbol(DataSymbol, "__elf_program_headers", addr, LocalBinding));
+			headerSymbols.push_back({DataSymbol, "__elf_program_headers", addr, LocalBinding});
 		}
 		GetParentView()->DefineDataVariable(m_programHeaderOffset, Type::ArrayType(Type::NamedType(
 			GetParentView(), rawProgramHeaderName), m_programHeaderCount));
-		GetParentView()->DefineAutoSymbol(new Symbol(DataSymbol, "__elf_program_headers", m_programHeaderOffset, LocalBinding));
+		parentHeaderSymbols.push_back({DataSymbol, "__elf_program_headers", m_programHeaderOffset, LocalBinding});
 	}
 
 	// Create enum for ELF section header type
@@ -2135,10 +2223,10 @@ bool ElfView::Init()
 		if (GetAddressForDataOffset(m_sectionHeaderOffset, addr))
 		{
 			DefineDataVariable(addr, Type::ArrayType(Type::NamedType(this, elfSectionHeaderName), sectionCount));
-			DefineAutoSymbol(new Symbol(DataSymbol, "__elf_section_headers", addr, LocalBinding));
+			headerSymbols.push_back({DataSymbol, "__elf_section_headers", addr, LocalBinding});
 		}
 		GetParentView()->DefineDataVariable(m_sectionHeaderOffset, Type::ArrayType(Type::NamedType(GetParentView(), rawSectionHeaderName), sectionCount));
-		GetParentView()->DefineAutoSymbol(new Symbol(DataSymbol, "__elf_section_headers", m_sectionHeaderOffset, LocalBinding));
+		parentHeaderSymbols.push_back({DataSymbol, "__elf_section_headers", m_sectionHeaderOffset, LocalBinding});
 	}
 
 	// Add types for dynamic table
@@ -2247,7 +2335,7 @@ bool ElfView::Init()
 		QualifiedName dynEntryTypeName = DefineType(dynEntryTypeId, dynEntryName, dynEntryType);
 		uint64_t adjustedVirtualAddr = m_dynamicTable.virtualAddress + imageBaseAdjustment;
 		DefineDataVariable(adjustedVirtualAddr, Type::ArrayType(Type::NamedType(this, dynEntryTypeName), m_numDynamicTableEntries));
-		DefineAutoSymbol(new Symbol(DataSymbol, "__elf_dynamic_table", adjustedVirtualAddr, NoBinding));
+		headerSymbols.push_back({DataSymbol, "__elf_dynamic_table", adjustedVirtualAddr, NoBinding});
 	}
 
 	if (m_auxSymbolTable.size || m_symbolTableSection.offset)
@@ -2292,7 +2380,7 @@ bool ElfView::Init()
 		{
 			QualifiedName symTableTypeName = GetParentView()->DefineType(symTableTypeId, symTableName, symTableType);
 			GetParentView()->DefineDataVariable(m_symbolTableSection.offset, Type::ArrayType(Type::NamedType(this, symTableTypeName), m_symbolTableSection.size / m_auxSymbolTableEntrySize));
-			GetParentView()->DefineAutoSymbol(new Symbol(DataSymbol, "__elf_symbol_table", m_symbolTableSection.offset, NoBinding));
+			parentHeaderSymbols.push_back({DataSymbol, "__elf_symbol_table", m_symbolTableSection.offset, NoBinding});
 		}
 	}
 
@@ -2317,7 +2405,7 @@ bool ElfView::Init()
 		QualifiedName relocTableTypeName = DefineType(relocationTableTypeId, relocationTableName, relocationTableType);
 		DefineDataVariable(m_relocSection.offset,
 			Type::ArrayType(Type::NamedType(this, relocTableTypeName), m_relocSection.size / m_relocSection.entrySize));
-		DefineAutoSymbol(new Symbol(DataSymbol, "__elf_rel_table", m_relocSection.offset, NoBinding));
+		headerSymbols.push_back({DataSymbol, "__elf_rel_table", m_relocSection.offset, NoBinding});
 	}
 
 	if (m_relocaSection.size && m_relocaSection.entrySize > 0)
@@ -2345,8 +2433,10 @@ bool ElfView::Init()
 		DefineDataVariable(m_relocaSection.offset,
 			Type::ArrayType(
 				Type::NamedType(this, relocaTableTypeName), m_relocaSection.size / m_relocaSection.entrySize));
-		DefineAutoSymbol(new Symbol(DataSymbol, "__elf_rela_table", m_relocaSection.offset, NoBinding));
+		headerSymbols.push_back({DataSymbol, "__elf_rela_table", m_relocaSection.offset, NoBinding});
 	}
+	DefineAutoSymbols(headerSymbols);
+	GetParentView()->DefineAutoSymbols(parentHeaderSymbols);
 
 	// In 32-bit mips with .got, add .extern symbol "RTL_Resolve"
 	if (gotStart && In(m_arch->GetName(), {"mips32", "mipsel32", "mips64", "nanomips"}))
@@ -2415,19 +2505,19 @@ bool ElfView::Init()
 	std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now();
 	double t = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count() / 1000.0;
 	m_logger->LogInfo("ELF parsing took %.3f seconds\n", t);
-	m_stringTableCache.clear();
+	ReleaseStringTables();
 	return true;
 }
 
 
-void ElfView::DefineElfSymbol(BNSymbolType type, const string& incomingName, uint64_t addr, bool gotEntry,
+void ElfView::DefineElfSymbol(BNSymbolType type, string_view incomingName, uint64_t addr, bool gotEntry,
 	BNSymbolBinding binding, size_t size, Ref<Type> typeObj)
 {
 	// Ensure symbol is within the executable
 	if (type != ExternalSymbol && !IsValidOffset(addr))
 		return;
 
-	string name = incomingName;
+	string name(incomingName);
 	Ref<Type> symbolTypeRef;
 	if ((type == ExternalSymbol) || (type == ImportAddressSymbol) || (type == ImportedDataSymbol))
 	{
@@ -2605,18 +2695,15 @@ void ElfView::ApplyTypesToStringTable(const Elf64SectionHeader& section, const i
 }
 
 
-string ElfView::ReadStringTable(BinaryReader& reader, const Elf64SectionHeader& section, uint64_t offset)
+const vector<char>* ElfView::GetStringTable(BinaryReader& reader, const Elf64SectionHeader& section)
 {
-	if (offset == 0 || offset > section.size)
-		return "";
-
 	auto itr = m_stringTableCache.find(section.offset);
 	if (itr == m_stringTableCache.end())
 	{
 		if (section.size > GetParentView()->GetLength())
 		{
 			m_logger->LogError("Unable to read string table with section offset: 0x%" PRIx64 " size: 0x%" PRIx64, section.offset, section.size);
-			return "";
+			return nullptr;
 		}
 
 		std::vector<char>& tableCache = m_stringTableCache[section.offset];
@@ -2625,9 +2712,49 @@ string ElfView::ReadStringTable(BinaryReader& reader, const Elf64SectionHeader&
 		reader.Read(tableCache.data(), section.size);
 		itr = m_stringTableCache.find(section.offset);
 	}
+	return &itr->second;
+}
+
+
+static string_view StringTableEntry(const vector<char>* table, uint64_t offset)
+{
+	if (!table || offset == 0 || offset >= table->size())
+		return string_view();
+	return string_view(table->data() + offset, strnlen(table->data() + offset, table->size() - offset));
+}
+
+
+string ElfView::ReadStringTable(BinaryReader& reader, const Elf64SectionHeader& section, uint64_t offset)
+{
+	return string(ReadStringTableView(reader, section, offset));
+}
+
+
+string_view ElfView::ReadStringTableView(BinaryReader& reader, const Elf64SectionHeader& section, uint64_t offset)
+{
+	if (offset == 0 || offset > section.size)
+		return string_view();
+
+	return StringTableEntry(GetStringTable(reader, section), offset);
+}
+
+
+string_view ElfView::InternSymbolName(string_view name)
+{
+	if (auto itr = m_symbolNameIndex.find(name); itr != m_symbolNameIndex.end())
+		return *itr;
+	string_view stored = m_symbolNameArena.emplace_back(name);
+	m_symbolNameIndex.insert(stored);
+	return stored;
+}
 
-	const std::vector<char>& tableCache = itr->second;
-	return std::string(&tableCache[offset], strlen(tableCache.data() + offset));
+
+void ElfView::ReleaseStringTables()
+{
+	// Symbol table entries hold views into these, so this must only run once they are all consumed
+	m_stringTableCache.clear();
+	m_symbolNameIndex.clear();
+	m_symbolNameArena.clear();
 }
 
 
@@ -2693,33 +2820,138 @@ void ElfView::ParseMiniDebugInfo()
 }
 
 
+// Reads the whole symbol table and its string tables once and decodes all entries from memory,
+// rather than issuing several reads per entry. Returns false if the table can't be read in one piece.
+bool ElfView::DecodeSymbolTable(BinaryReader& reader, const Elf64SectionHeader& symbolSection,
+	const Elf64SectionHeader& stringSection, bool dynamic, size_t startEntry, vector<ElfSymbolTableEntry>& result)
+{
+	size_t entrySize = m_elf32 ? 16 : 24;
+	size_t count = (size_t)symbolSection.size / entrySize;
+	if (startEntry >= count)
+		return true;
+	count -= startEntry;
+	if (count * entrySize > GetParentView()->GetLength())
+		return false;
+
+	DataBuffer table;
+	const vector<char>* strings;
+	const vector<char>* sectionStrings;
+	try
+	{
+		reader.Seek(symbolSection.offset + (startEntry * entrySize));
+		table = reader.Read(count * entrySize);
+		// Load both string tables up front so the decode below never touches the cache
+		strings = GetStringTable(reader, stringSection);
+		sectionStrings = GetStringTable(reader, m_sectionStringTable);
+	}
+	catch (ReadException&)
+	{
+		return false;
+	}
+
+	const uint8_t* data = (const uint8_t*)table.GetData();
+	bool bigEndian = m_endian == BigEndian;
+	auto read16 = [bigEndian](const uint8_t* p) { return ReadBufferU16(p, bigEndian); };
+	auto read32 = [bigEndian](const uint8_t* p) { return ReadBufferU32(p, bigEndian); };
+	auto read64 = [bigEndian](const uint8_t* p) { return ReadBufferU64(p, bigEndian); };
+
+	result.resize(count);
+	auto decodeRange = [&](size_t start, size_t end) {
+		for (size_t i = start; i < end; i++)
+		{
+			const uint8_t* p = data + (i * entrySize);
+			ElfSymbolTableEntry& entry = result[i];
+			entry.dynamic = dynamic;
+			uint8_t info;
+			if (m_elf32)
+			{
+				entry.nameOffset = read32(p);
+				entry.value = read32(p + 4);
+				entry.size = read32(p + 8);
+				info = p[12];
+				entry.other = p[13];
+				entry.section = read16(p + 14);
+			}
+			else
+			{
+				entry.nameOffset = read32(p);
+				info = p[4];
+				entry.other = p[5];
+				entry.section = read16(p + 6);
+				entry.value = read64(p + 8);
+				entry.size = read64(p + 16);
+			}
+			entry.type = ELF_ST_TYPE(info);
+			entry.binding = TranslateELFBindingType(ELF_ST_BIND(info));
+
+			if (entry.type == ELF_STT_SECTION)
+			{
+				if (entry.section < m_elfSections.size() && m_elfSections[entry.section].name <= m_sectionStringTable.size)
+					entry.name = StringTableEntry(sectionStrings, m_elfSections[entry.section].name);
+			}
+			else if (entry.nameOffset <= stringSection.size)
+			{
+				entry.name = StringTableEntry(strings, entry.nameOffset);
+			}
+		}
+	};
+
+	size_t threadCount = std::min<size_t>(std::thread::hardware_concurrency(), count / PARALLEL_SYMBOL_DECODE_THRESHOLD);
+	if (threadCount <= 1)
+	{
+		decodeRange(0, count);
+		return true;
+	}
+
+	vector<thread> threads;
+	size_t chunk = (count + threadCount - 1) / threadCount;
+	for (size_t start = chunk; start < count; start += chunk)
+		threads.emplace_back(decodeRange, start, std::min(start + chunk, count));
+	decodeRange(0, chunk);
+	for (auto& t : threads)
+		t.join();
+	return true;
+}
+
+
 vector<ElfSymbolTableEntry> ElfView::ParseSymbolTable(BinaryReader& reader, const Elf64SectionHeader& symbolSection,
 	const Elf64SectionHeader& stringSection, bool dynamic, size_t startEntry)
 {
-	size_t size = (size_t)symbolSection.size / (m_elf32 ? 16 : 24);
-	vector<ElfSymbolTableEntry> result;
-	for (size_t i = startEntry; i < size; i++)
+	vector<ElfSymbolTableEntry> entries;
+	if (!DecodeSymbolTable(reader, symbolSection, stringSection, dynamic, startEntry, entries))
 	{
-		ElfSymbolTableEntry entry;
-		if (!ParseSymbolTableEntry(reader, entry, i, symbolSection, stringSection, dynamic))
-			break;
+		// Fall back to reading entry by entry, keeping everything up to the first unreadable entry
+		entries.clear();
+		size_t size = (size_t)symbolSection.size / (m_elf32 ? 16 : 24);
+		for (size_t i = startEntry; i < size; i++)
+		{
+			ElfSymbolTableEntry entry;
+			if (!ParseSymbolTableEntry(reader, entry, i, symbolSection, stringSection, dynamic))
+				break;
+			entries.push_back(std::move(entry));
+		}
+	}
 
+	vector<ElfSymbolTableEntry> result;
+	result.reserve(entries.size());
+	for (auto& entry : entries)
+	{
 		/* TODO: PPC64 specific symbol handling to be moved to architecture extension for ELF */
 		if (m_commonHeader.arch == EM_PPC64 && entry.type == ELF_STT_FUNC)
 		{
 			uint64_t func_start;
 			if (DerefPpc64Descriptor(reader, entry.value, func_start))
 			{
-				if (entry.name[0] != '.')
+				if (entry.name.empty() || entry.name[0] != '.')
 				{
 					/* new symbol with function entry as address */
 					ElfSymbolTableEntry entry2 = entry;
-					entry2.name = "." + entry2.name;
+					entry2.name = InternSymbolName("." + string(entry2.name));
 					entry2.value = func_start;
 					result.push_back(entry2);
 
-					m_logger->LogDebug("PPC64 symbol %s=%016x to %s=%016x\n", entry.name.c_str(), entry.value,
-						entry2.name.c_str(), entry2.value);
+					m_logger->LogDebug("PPC64 symbol %.*s=%016x to %.*s=%016x\n", (int)entry.name.size(), entry.name.data(),
+						entry.value, (int)entry2.name.size(), entry2.name.data(), entry2.value);
 
 					/* force the descriptor to a data symbol */
 					entry.type = ELF_STT_OBJECT;
@@ -2727,7 +2959,7 @@ vector<ElfSymbolTableEntry> ElfView::ParseSymbolTable(BinaryReader& reader, cons
 			}
 		}
 
-		result.push_back(entry);
+		result.push_back(std::move(entry));
 	}
 
 	return result;
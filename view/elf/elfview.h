@@ -2,6 +2,9 @@
 
 #include "binaryninjaapi.h"
 #include <exception>
+#include <deque>
+#include <string_view>
+#include <unordered_set>
 
 #define ELF_PT_NULL    0
 #define ELF_PT_LOAD    1
@@ -462,7 +465,8 @@ namespace BinaryNinja
 		uint16_t section;
 		uint64_t value;
 		uint64_t size;
-		std::string name;
+		// Points into a cached string table or the view's symbol name arena, valid until Init returns
+		std::string_view name;
 		bool dynamic;
 	};
 
@@ -496,6 +500,9 @@ namespace BinaryNinja
 		bool m_simplifyTemplates;
 		bool m_relocatable = false;
 		std::map<uint64_t, std::vector<char>> m_stringTableCache;
+		// Names that are not backed by a string table (synthesized or rewritten), stored once each
+		std::unordered_set<std::string_view> m_symbolNameIndex;
+		std::deque<std::string> m_symbolNameArena;
 
 		// Section and program headers, internally use 64-bit form as it is a superset of 32-bit
 		std::vector<Elf64SectionHeader> m_elfSections;
@@ -517,14 +524,20 @@ namespace BinaryNinja
 
 		SymbolQueue* m_symbolQueue = nullptr;
 
-		void DefineElfSymbol(BNSymbolType type, const std::string& name, uint64_t addr, bool gotEntry,
+		void DefineElfSymbol(BNSymbolType type, std::string_view name, uint64_t addr, bool gotEntry,
 			BNSymbolBinding binding, size_t size=0, Ref<Type> typeObj=nullptr);
 
 		void ApplyTypesToParentStringTable(const Elf64SectionHeader& section, const bool offset = true);
 		void ApplyTypesToStringTable(const Elf64SectionHeader& section, const int64_t imageBaseAdjustment, const bool offset = true);
+		const std::vector<char>* GetStringTable(BinaryReader& reader, const Elf64SectionHeader& section);
 		std::string ReadStringTable(BinaryReader& view, const Elf64SectionHeader& section, uint64_t offset);
+		std::string_view ReadStringTableView(BinaryReader& view, const Elf64SectionHeader& section, uint64_t offset);
+		std::string_view InternSymbolName(std::string_view name);
+		void ReleaseStringTables();
 		bool ParseSymbolTableEntry(BinaryReader& reader, ElfSymbolTableEntry& entry, uint64_t sym,
 			const Elf64SectionHeader& symbolTable, const Elf64SectionHeader& stringTable, bool dynamic);
+		bool DecodeSymbolTable(BinaryReader& reader, const Elf64SectionHeader& symbolTable,
+			const Elf64SectionHeader& stringTable, bool dynamic, size_t startEntry, std::vector<ElfSymbolTableEntry>& result);
 
 		std::vector<ElfSymbolTableEntry> ParseSymbolTable(BinaryReader& reader, const Elf64SectionHeader& symbolTableSection,
 			const Elf64SectionHeader& section, bool dynamic, size_t startEntry=0);
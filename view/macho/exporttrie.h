@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "binaryninjaapi.h"
+
+#ifndef EXPORT_SYMBOL_FLAGS_REEXPORT
+	#define EXPORT_SYMBOL_FLAGS_REEXPORT 0x08
+#endif
+
+namespace BinaryNinja
+{
+	// Walks a Mach-O export trie in [begin, end) without recursion.
+	//
+	// One prefix buffer is shared by the whole walk: each edge appends its label and is truncated back
+	// once its subtree is done, so no per-node strings are built. `onTerminal(name, flags, imageOffset)`
+	// is called for every exported symbol that is not a re-export; `name` is only valid for the call.
+	//
+	// Throws ReadException on malformed tries, including ones whose edges form a cycle.
+	template <typename Callback>
+	void WalkExportTrie(const uint8_t* begin, const uint8_t* end, Callback&& onTerminal)
+	{
+		auto readULEB128 = [end](const uint8_t*& cursor) {
+			uint64_t result = 0;
+			int bit = 0;
+			do
+			{
+				if (cursor >= end || bit > 63)
+					throw ReadException();
+				result |= (uint64_t)(*cursor & 0x7f) << bit;
+				bit += 7;
+			} while (*cursor++ & 0x80);
+			return result;
+		};
+
+		struct Frame
+		{
+			// Position of the next child edge to visit
+			const uint8_t* cursor;
+			uint8_t remainingChildren;
+			size_t prefixLength;
+		};
+
+		if (begin >= end)
+			return;
+
+		std::string prefix;
+		prefix.reserve(256);
+		std::vector<Frame> stack;
+		// Every node takes at least two bytes, so a well formed trie can't have more nodes than that.
+		size_t nodeBudget = (size_t)(end - begin) / 2 + 1;
+
+		auto visitNode = [&](const uint8_t* node) {
+			if (node >= end || nodeBudget-- == 0)
+				throw ReadException();
+
+			const uint8_t* cursor = node;
+			uint64_t terminalSize = readULEB128(cursor);
+			if (terminalSize > (uint64_t)(end - cursor))
+				throw ReadException();
+			const uint8_t* children = cursor + terminalSize;
+			if (terminalSize != 0)
+			{
+				uint64_t flags = readULEB128(cursor);
+				if (!(flags & EXPORT_SYMBOL_FLAGS_REEXPORT))
+				{
+					uint64_t imageOffset = readULEB128(cursor);
+					onTerminal(std::string_view(prefix), flags, imageOffset);
+				}
+			}
+			if (children >= end)
+				throw ReadException();
+			stack.push_back({children + 1, *children, prefix.size()});
+		};
+
+		visitNode(begin);
+		while (!stack.empty())
+		{
+			Frame& frame = stack.back();
+			prefix.resize(frame.prefixLength);
+			if (frame.remainingChildren == 0)
+			{
+				stack.pop_back();
+				continue;
+			}
+			frame.remainingChildren--;
+
+			const uint8_t* label = frame.cursor;
+			while (label < end && *label != 0)
+				label++;
+			if (label >= end)
+				throw ReadException();
+			prefix.append((const char*)frame.cursor, label - frame.cursor);
+			const uint8_t* cursor = label + 1;
+			uint64_t next = readULEB128(cursor);
+			if (next == 0 || next >= (uint64_t)(end - begin))
+				throw ReadException();
+			frame.cursor = cursor;
+
+			// May reallocate the stack, so `frame` must not be used past this point
+			visitNode(begin + next);
+		}
+	}
+}
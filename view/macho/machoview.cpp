@@ -4,7 +4,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <inttypes.h>
+#include <thread>
 #include <tuple>
+#include <unordered_set>
 #ifndef _MSC_VER
 #include <cxxabi.h>
 #endif
@@ -13,6 +15,10 @@
 #include "universalview.h"
 #include "lowlevelilinstruction.h"
 #include "rapidjsonwrapper.h"
+#include "exporttrie.h"
+
+// Segments with at least this many pages per thread have their chained fixups decoded in parallel
+#define PARALLEL_CHAINED_FIXUP_PAGE_THRESHOLD 64
 
 enum {
 	N_STAB = 0xe0,
@@ -271,7 +277,6 @@ MachOHeader MachoView::HeaderForAddress(BinaryView* data, uint64_t address, bool
 	header.isMainHeader = isMainHeader;
 
 	header.identifierPrefix = identifierPrefix;
-	header.stringList = new DataBuffer();
 
 	std::string errorMsg;
 	if (isMainHeader) {
@@ -614,8 +619,9 @@ MachOHeader MachoView::HeaderForAddress(BinaryView* data, uint64_t address, bool
 				header.symtab.nsyms   = reader.Read32();
 				header.symtab.stroff  = reader.Read32();
 				header.symtab.strsize = reader.Read32();
-				reader.Seek(header.symtab.stroff);
-				header.stringList->Append(reader.Read(header.symtab.strsize));
+				header.stringList = data->MapBuffer(m_universalImageOffset + header.symtab.stroff, header.symtab.strsize);
+				if (header.stringList.GetLength() < header.symtab.strsize)
+					throw ReadException();
 				header.stringListSize = header.symtab.strsize;
 				m_logger->LogDebug("\tstrsize: %08x\n" \
 					"\tstroff: %08x\n" \
@@ -1069,6 +1075,8 @@ bool MachoView::ParseRelocationEntry(const relocation_info& info, uint64_t start
 
 bool MachoView::Init()
 {
+	static InstrumentationHistogram histogram("view.macho.init");
+	InstrumentationScope scope(histogram);
 	Ref<Settings> settings = GetLoadSettings(GetTypeName());
 	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
 	BinaryReader reader(GetParentView());
@@ -2225,6 +2233,7 @@ bool MachoView::InitializeHeader(MachOHeader& header, bool isMainHeader, uint64_
 	}
 
 	// Apply Mach-O header types
+	vector<SymbolSpec> headerSymbols;
 	for (auto [imageBase, imageDesc] : machoHeaderStarts)
 	{
 		string errorMsg;
@@ -2235,7 +2244,7 @@ bool MachoView::InitializeHeader(MachOHeader& header, bool isMainHeader, uint64_
 			continue;
 
 		DefineDataVariable(imageBase, Type::NamedType(this, m_typeNames.headerQualName));
-		DefineAutoSymbol(new Symbol(DataSymbol, "__macho_header" + imageDesc, imageBase, LocalBinding));
+		headerSymbols.push_back({DataSymbol, "__macho_header" + imageDesc, imageBase, LocalBinding});
 
 		try
 		{
@@ -2259,7 +2268,7 @@ bool MachoView::InitializeHeader(MachOHeader& header, bool isMainHeader, uint64_
 					for (size_t j = 0; j < numSections; j++)
 					{
 							DefineDataVariable(virtualReader.GetOffset(), Type::NamedType(this, m_typeNames.sectionQualName));
-							DefineAutoSymbol(new Symbol(DataSymbol, "__macho_section" + imageDesc + "_[" + to_string(sectionNum++) + "]", virtualReader.GetOffset(), LocalBinding));
+							headerSymbols.push_back({DataSymbol, "__macho_section" + imageDesc + "_[" + to_string(sectionNum++) + "]", virtualReader.GetOffset(), LocalBinding});
 							virtualReader.SeekRelative((8 * 8) + 4);
 					}
 					break;
@@ -2273,7 +2282,7 @@ bool MachoView::InitializeHeader(MachOHeader& header, bool isMainHeader, uint64_
 					for (size_t j = 0; j < numSections; j++)
 					{
 							DefineDataVariable(virtualReader.GetOffset(), Type::NamedType(this, m_typeNames.section64QualName));
-							DefineAutoSymbol(new Symbol(DataSymbol, "__macho_section_64" + imageDesc + "_[" + to_string(sectionNum++) + "]", virtualReader.GetOffset(), LocalBinding));
+							headerSymbols.push_back({DataSymbol, "__macho_section_64" + imageDesc + "_[" + to_string(sectionNum++) + "]", virtualReader.GetOffset(), LocalBinding});
 							virtualReader.SeekRelative(10 * 8);
 					}
 					break;
@@ -2326,7 +2335,7 @@ bool MachoView::InitializeHeader(MachOHeader& header, bool isMainHeader, uint64_
 					break;
 				}
 
-				DefineAutoSymbol(new Symbol(DataSymbol, "__macho_load_command" + imageDesc + "_[" + to_string(i) + "]", curOffset, LocalBinding));
+				headerSymbols.push_back({DataSymbol, "__macho_load_command" + imageDesc + "_[" + to_string(i) + "]", curOffset, LocalBinding});
 				virtualReader.Seek(nextOffset);
 			}
 		}
@@ -2335,6 +2344,7 @@ bool MachoView::InitializeHeader(MachOHeader& header, bool isMainHeader, uint64_
 			LogError("Error when applying Mach-O header types at %" PRIx64, imageBase);
 		}
 	}
+	DefineAutoSymbols(headerSymbols);
 
 	if (parseCFStrings)
 	{
@@ -2504,51 +2514,31 @@ bool MachoView::GetSectionPermissions(MachOHeader& header, uint64_t address, uin
 void MachoView::ParseExportTrie(BinaryReader& reader, linkedit_data_command exportTrie)
 {
 	try {
-		uint32_t endGuard = exportTrie.datasize;
-		DataBuffer buffer = GetParentView()->ReadBuffer(m_universalImageOffset + exportTrie.dataoff, exportTrie.datasize);
+		ViewBuffer buffer = GetParentView()->MapBuffer(m_universalImageOffset + exportTrie.dataoff, exportTrie.datasize);
 
-		ReadExportNode(GetStart(), buffer, "", 0, endGuard);
-	}
-	catch (ReadException&)
-	{
-		m_logger->LogError("Error while parsing Export Trie");
-	}
-}
+		std::vector<std::pair<uint64_t, std::string>> exports;
+		WalkExportTrie(buffer.begin(), buffer.end(), [&](std::string_view name, uint64_t, uint64_t imageOffset) {
+			exports.emplace_back(imageOffset, std::string(name));
+		});
+		if (exports.empty())
+			return;
 
-void MachoView::ReadExportNode(uint64_t viewStart, DataBuffer& buffer, const std::string& currentText, size_t cursor, uint32_t endGuard)
-{
-	if (cursor > endGuard)
-		throw ReadException();
+		// Look up function starts once rather than querying analysis for every export
+		std::unordered_set<uint64_t> functionStarts;
+		for (const auto& func : GetAnalysisFunctionList())
+			functionStarts.insert(func->GetStart());
 
-	uint64_t terminalSize = readValidULEB128(buffer, cursor);
-	uint64_t childOffset = cursor + terminalSize;
-	if (terminalSize != 0) {
-		uint64_t imageOffset = 0;
-		uint64_t flags = readValidULEB128(buffer, cursor);
-		if (!(flags & EXPORT_SYMBOL_FLAGS_REEXPORT))
+		uint64_t viewStart = GetStart();
+		for (const auto& [imageOffset, name] : exports)
 		{
-			imageOffset = readValidULEB128(buffer, cursor);
-			auto symbolType = GetAnalysisFunctionsForAddress(viewStart + imageOffset).size() ? FunctionSymbol : DataSymbol;
-			DefineMachoSymbol(symbolType, currentText, imageOffset + viewStart, GlobalBinding, true);
+			uint64_t address = viewStart + imageOffset;
+			auto symbolType = functionStarts.count(address) ? FunctionSymbol : DataSymbol;
+			DefineMachoSymbol(symbolType, name, address, GlobalBinding, true);
 		}
 	}
-	cursor = childOffset;
-	uint8_t childCount = buffer[cursor];
-	cursor++;
-	if (cursor > endGuard)
-		throw ReadException();
-	for (uint8_t i = 0; i < childCount; ++i)
+	catch (ReadException&)
 	{
-		std::string childText;
-		while (buffer[cursor] != 0 & cursor <= endGuard)
-			childText.push_back(buffer[cursor++]);
-		cursor++;
-		if (cursor > endGuard)
-			throw ReadException();
-		auto next = readValidULEB128(buffer, cursor);
-		if (next == 0)
-			throw ReadException();
-		ReadExportNode(viewStart, buffer, currentText + childText, next, endGuard);
+		m_logger->LogError("Error while parsing Export Trie");
 	}
 }
 
@@ -2939,7 +2929,8 @@ void MachoView::ParseSymbolTable(BinaryReader& reader, MachOHeader& header, cons
 			if (sym.n_strx >= symtab.strsize || ((sym.n_type & N_TYPE) == N_INDR))
 				continue;
 
-			string symbol((char*)header.stringList->GetDataAt(sym.n_strx));
+			const char* symbolName = (const char*)header.stringList.GetDataAt(sym.n_strx);
+			string symbol(symbolName, strnlen(symbolName, header.stringList.GetLength() - sym.n_strx));
 			m_symbols.push_back(symbol);
 			//otool ignores symbols that end with ".o", startwith "ltmp" or are "gcc_compiled." so do we
 			if (symbol == "gcc_compiled." ||
@@ -3084,7 +3075,6 @@ void MachoView::ParseChainedFixups(MachOHeader& header, linkedit_data_command ch
 	bool processBinds = true;
 
 	BinaryReader parentReader(GetParentView());
-	BinaryReader mappedReader(this);
 
 	try {
 		dyld_chained_fixups_header fixupsHeader {};
@@ -3275,187 +3265,229 @@ void MachoView::ParseChainedFixups(MachOHeader& header, linkedit_data_command ch
 				}
 			}
 
-			int i = -1;
-			for (auto pageStarts : pageStartOffsets)
-			{
-				i++;
-				uint64_t pageAddress = m_universalImageOffset + starts.segment_offset + (i * starts.page_size);
-				for (uint16_t start : pageStarts)
+			// Chains never cross a page boundary, so every page can be walked independently straight out of
+			// one read of the segment. Decoding happens in parallel; the results are applied in page order.
+			uint64_t segmentAddress = GetStart() + starts.segment_offset;
+			DataBuffer segmentData = ReadBuffer(segmentAddress, (uint64_t)starts.page_count * starts.page_size);
+			const uint8_t* segmentBytes = (const uint8_t*)segmentData.GetData();
+			size_t segmentLength = segmentData.GetLength();
+			size_t pointerSize = (format == Generic32FixupFormat || format == Firmware32FixupFormat) ? 4 : 8;
+
+			vector<vector<DecodedChainedFixup>> decodedPages(pageStartOffsets.size());
+			auto decodePages = [&](size_t first, size_t last) {
+				for (size_t page = first; page < last; page++)
 				{
-					if (start == DYLD_CHAINED_PTR_START_NONE)
-						continue;
-
-					uint64_t chainEntryAddress = pageAddress + start;
-
-					bool fixupsDone = false;
-
-					while (!fixupsDone)
+					uint64_t pageOffset = page * starts.page_size;
+					vector<DecodedChainedFixup>& decoded = decodedPages[page];
+					for (uint16_t start : pageStartOffsets[page])
 					{
-						ChainedFixupPointer pointer;
-						parentReader.Seek(chainEntryAddress);
-						mappedReader.Seek(chainEntryAddress - m_universalImageOffset + GetStart());
-						if (format == Generic32FixupFormat || format == Firmware32FixupFormat)
-							pointer.raw32 = (uint32_t)(uintptr_t)mappedReader.Read32();
-						else
-							pointer.raw64 = (uintptr_t)mappedReader.Read64();
-
-						bool bind = false;
-						uint64_t nextEntryStrideCount;
+						if (start == DYLD_CHAINED_PTR_START_NONE)
+							continue;
 
-						switch (format)
+						uint64_t chainEntryOffset = pageOffset + start;
+						bool fixupsDone = false;
+						while (!fixupsDone)
 						{
-						case Generic32FixupFormat:
-							bind = pointer.generic32.bind.bind;
-							nextEntryStrideCount = pointer.generic32.rebase.next;
-							break;
-						case Generic64FixupFormat:
-							bind = pointer.generic64.bind.bind;
-							nextEntryStrideCount = pointer.generic64.rebase.next;
-							break;
-						case GenericArm64eFixupFormat:
-							bind = pointer.arm64e.bind.bind;
-							nextEntryStrideCount = pointer.arm64e.rebase.next;
-							break;
-						case Firmware32FixupFormat:
-							nextEntryStrideCount = pointer.firmware32.next;
-							bind = false;
-							break;
-						}
+							if (chainEntryOffset + pointerSize > segmentLength)
+							{
+								m_logger->LogError("Chained Fixups: Pointer at %llx is outside of the segment",
+									segmentAddress + chainEntryOffset);
+								break;
+							}
 
-						m_logger->LogTrace("Chained Fixups: @ 0x%llx ( 0x%llx ) - %d 0x%llx", chainEntryAddress,
-							GetStart() + (chainEntryAddress - m_universalImageOffset),
-							bind, nextEntryStrideCount);
+							ChainedFixupPointer pointer;
+							if (pointerSize == 4)
+							{
+								uint32_t raw;
+								memcpy(&raw, segmentBytes + chainEntryOffset, sizeof(raw));
+								pointer.raw32 = ToLE32(raw);
+							}
+							else
+							{
+								uint64_t raw;
+								memcpy(&raw, segmentBytes + chainEntryOffset, sizeof(raw));
+								pointer.raw64 = ToLE64(raw);
+							}
 
-						if (bind && processBinds)
-						{
-							uint64_t ordinal;
+							bool bind = false;
+							uint64_t nextEntryStrideCount;
 
-							switch (starts.pointer_format)
+							switch (format)
 							{
-							case DYLD_CHAINED_PTR_64:
-							case DYLD_CHAINED_PTR_64_OFFSET:
-								ordinal = pointer.generic64.bind.ordinal;
+							case Generic32FixupFormat:
+								bind = pointer.generic32.bind.bind;
+								nextEntryStrideCount = pointer.generic32.rebase.next;
 								break;
-							// case DYLD_CHAINED_PTR_ARM64E_OFFSET: ; old _KERNEL name.
-							case DYLD_CHAINED_PTR_ARM64E:
-							case DYLD_CHAINED_PTR_ARM64E_USERLAND24:
-							case DYLD_CHAINED_PTR_ARM64E_KERNEL:
-								if (pointer.arm64e.bind.auth)
-									ordinal = starts.pointer_format == DYLD_CHAINED_PTR_ARM64E_USERLAND24
-										? pointer.arm64e.authBind24.ordinal : pointer.arm64e.authBind.ordinal;
-								else
-									ordinal = starts.pointer_format == DYLD_CHAINED_PTR_ARM64E_USERLAND24
-										? pointer.arm64e.bind24.ordinal : pointer.arm64e.bind.ordinal;
+							case Generic64FixupFormat:
+								bind = pointer.generic64.bind.bind;
+								nextEntryStrideCount = pointer.generic64.rebase.next;
 								break;
-							case DYLD_CHAINED_PTR_32:
-								ordinal = pointer.generic32.bind.ordinal;
+							case GenericArm64eFixupFormat:
+								bind = pointer.arm64e.bind.bind;
+								nextEntryStrideCount = pointer.arm64e.rebase.next;
+								break;
+							case Firmware32FixupFormat:
+								nextEntryStrideCount = pointer.firmware32.next;
+								bind = false;
 								break;
-							default:
-								m_logger->LogWarn("Chained Fixups: Unknown Bind Pointer Format at %llx",
-									GetStart() + (chainEntryAddress - m_universalImageOffset));
-
-								chainEntryAddress += (nextEntryStrideCount * strideSize);
-								if (chainEntryAddress > pageAddress + starts.page_size)
-								{
-									m_logger->LogDebug("Chained Fixups: Pointer at %llx left page",
-										GetStart() + ((chainEntryAddress - (nextEntryStrideCount * strideSize))) - m_universalImageOffset);
-									fixupsDone = true;
-								}
-								if (nextEntryStrideCount == 0)
-									fixupsDone = true;
-
-								continue;
 							}
 
-							if (ordinal < importTable.size())
+							uint64_t entryAddress = segmentAddress + chainEntryOffset;
+							bool leftPageIsError = true;
+							if (bind && processBinds)
 							{
-								import_entry entry = importTable.at(ordinal);
-								uint64_t targetAddress = GetStart() + (chainEntryAddress - m_universalImageOffset);
+								uint64_t ordinal;
+								bool knownFormat = true;
 
-								if (!entry.name.empty())
-								{
-									reloc.address = targetAddress;
-									DefineMachoSymbol(ImportAddressSymbol, entry.name,
-										targetAddress,
-										entry.weak ? WeakBinding : GlobalBinding, true);
-
-									BNRelocationInfo externReloc;
-									memset(&externReloc, 0, sizeof(externReloc));
-									externReloc.nativeType = BINARYNINJA_MANUAL_RELOCATION;
-									externReloc.address = targetAddress;
-									externReloc.size = m_addressSize;
-									externReloc.pcRelative = false;
-									externReloc.external = true;
-									header.externalRelocations.emplace_back(externReloc, entry.name);
-								}
-								else
+								switch (starts.pointer_format)
 								{
-									m_logger->LogWarn("Chained Fixups: Import Table entry %llx has no symbol; "
-										"Unable to bind item at %llx", ordinal, targetAddress);
+								case DYLD_CHAINED_PTR_64:
+								case DYLD_CHAINED_PTR_64_OFFSET:
+									ordinal = pointer.generic64.bind.ordinal;
+									break;
+								// case DYLD_CHAINED_PTR_ARM64E_OFFSET: ; old _KERNEL name.
+								case DYLD_CHAINED_PTR_ARM64E:
+								case DYLD_CHAINED_PTR_ARM64E_USERLAND24:
+								case DYLD_CHAINED_PTR_ARM64E_KERNEL:
+									if (pointer.arm64e.bind.auth)
+										ordinal = starts.pointer_format == DYLD_CHAINED_PTR_ARM64E_USERLAND24
+											? pointer.arm64e.authBind24.ordinal : pointer.arm64e.authBind.ordinal;
+									else
+										ordinal = starts.pointer_format == DYLD_CHAINED_PTR_ARM64E_USERLAND24
+											? pointer.arm64e.bind24.ordinal : pointer.arm64e.bind.ordinal;
+									break;
+								case DYLD_CHAINED_PTR_32:
+									ordinal = pointer.generic32.bind.ordinal;
+									break;
+								default:
+									m_logger->LogWarn("Chained Fixups: Unknown Bind Pointer Format at %llx", entryAddress);
+									knownFormat = false;
+									leftPageIsError = false;
+									break;
 								}
+
+								if (knownFormat)
+									decoded.push_back({entryAddress, true, ordinal});
 							}
-						}
-						else if (!bind)
-						{
-							uint64_t entryOffset;
-							switch (starts.pointer_format)
-							{
-							case DYLD_CHAINED_PTR_ARM64E:
-							case DYLD_CHAINED_PTR_ARM64E_KERNEL:
-							case DYLD_CHAINED_PTR_ARM64E_USERLAND:
-							case DYLD_CHAINED_PTR_ARM64E_USERLAND24:
+							else if (!bind)
 							{
-								if (pointer.arm64e.bind.auth)
-									entryOffset = pointer.arm64e.authRebase.target;
-								else
-									entryOffset = pointer.arm64e.rebase.target;
+								uint64_t entryOffset;
+								switch (starts.pointer_format)
+								{
+								case DYLD_CHAINED_PTR_ARM64E:
+								case DYLD_CHAINED_PTR_ARM64E_KERNEL:
+								case DYLD_CHAINED_PTR_ARM64E_USERLAND:
+								case DYLD_CHAINED_PTR_ARM64E_USERLAND24:
+								{
+									if (pointer.arm64e.bind.auth)
+										entryOffset = pointer.arm64e.authRebase.target;
+									else
+										entryOffset = pointer.arm64e.rebase.target;
 
-								if ( starts.pointer_format != DYLD_CHAINED_PTR_ARM64E || pointer.arm64e.bind.auth)
-									entryOffset += GetStart();
+									if ( starts.pointer_format != DYLD_CHAINED_PTR_ARM64E || pointer.arm64e.bind.auth)
+										entryOffset += GetStart();
 
-								break;
-							}
-							case DYLD_CHAINED_PTR_64:
-								entryOffset = pointer.generic64.rebase.target;
-								break;
-							case DYLD_CHAINED_PTR_64_OFFSET:
-								entryOffset = pointer.generic64.rebase.target + GetStart();
-								break;
-							case DYLD_CHAINED_PTR_64_KERNEL_CACHE:
-							case DYLD_CHAINED_PTR_X86_64_KERNEL_CACHE:
-								entryOffset = pointer.kernel64.target;
-								break;
-							case DYLD_CHAINED_PTR_32:
-							case DYLD_CHAINED_PTR_32_CACHE:
-								entryOffset = pointer.generic32.rebase.target;
-								break;
-							case DYLD_CHAINED_PTR_32_FIRMWARE:
-								entryOffset = pointer.firmware32.target;
-								break;
+									break;
+								}
+								case DYLD_CHAINED_PTR_64:
+									entryOffset = pointer.generic64.rebase.target;
+									break;
+								case DYLD_CHAINED_PTR_64_OFFSET:
+									entryOffset = pointer.generic64.rebase.target + GetStart();
+									break;
+								case DYLD_CHAINED_PTR_64_KERNEL_CACHE:
+								case DYLD_CHAINED_PTR_X86_64_KERNEL_CACHE:
+									entryOffset = pointer.kernel64.target;
+									break;
+								case DYLD_CHAINED_PTR_32:
+								case DYLD_CHAINED_PTR_32_CACHE:
+									entryOffset = pointer.generic32.rebase.target;
+									break;
+								case DYLD_CHAINED_PTR_32_FIRMWARE:
+									entryOffset = pointer.firmware32.target;
+									break;
+								}
+
+								decoded.push_back({entryAddress, false, entryOffset});
 							}
 
-							reloc.address = GetStart() + (chainEntryAddress - m_universalImageOffset);
-							DefineRelocation(m_arch, reloc, entryOffset, reloc.address);
+							chainEntryOffset += (nextEntryStrideCount * strideSize);
 
-							if (m_objcProcessor)
+							if (chainEntryOffset > pageOffset + starts.page_size)
 							{
-								m_objcProcessor->AddRelocatedPointer(reloc.address, entryOffset);
+								// Something is seriously wrong here. likely malformed binary, or our parsing failed elsewhere.
+								// This will log the pointer in mapped memory.
+								if (leftPageIsError)
+									m_logger->LogError("Chained Fixups: Pointer at %llx left page", entryAddress);
+								else
+									m_logger->LogDebug("Chained Fixups: Pointer at %llx left page", entryAddress);
+								fixupsDone = true;
 							}
+
+							if (nextEntryStrideCount == 0)
+								fixupsDone = true;
 						}
+					}
+				}
+			};
 
-						chainEntryAddress += (nextEntryStrideCount * strideSize);
+			size_t pageCount = decodedPages.size();
+			size_t threadCount = std::min<size_t>(std::thread::hardware_concurrency(),
+				pageCount / PARALLEL_CHAINED_FIXUP_PAGE_THRESHOLD);
+			if (threadCount <= 1)
+			{
+				decodePages(0, pageCount);
+			}
+			else
+			{
+				vector<thread> threads;
+				size_t chunk = (pageCount + threadCount - 1) / threadCount;
+				for (size_t first = chunk; first < pageCount; first += chunk)
+					threads.emplace_back(decodePages, first, std::min(first + chunk, pageCount));
+				decodePages(0, chunk);
+				for (auto& t : threads)
+					t.join();
+			}
+
+			for (const auto& decoded : decodedPages)
+			{
+				for (const DecodedChainedFixup& fixup : decoded)
+				{
+					if (fixup.bind)
+					{
+						if (fixup.value >= importTable.size())
+							continue;
 
-						if (chainEntryAddress > pageAddress + starts.page_size)
+						const import_entry& entry = importTable[fixup.value];
+						if (!entry.name.empty())
+						{
+							DefineMachoSymbol(ImportAddressSymbol, entry.name, fixup.address,
+								entry.weak ? WeakBinding : GlobalBinding, true);
+
+							BNRelocationInfo externReloc;
+							memset(&externReloc, 0, sizeof(externReloc));
+							externReloc.nativeType = BINARYNINJA_MANUAL_RELOCATION;
+							externReloc.address = fixup.address;
+							externReloc.size = m_addressSize;
+							externReloc.pcRelative = false;
+							externReloc.external = true;
+							header.externalRelocations.emplace_back(externReloc, entry.name);
+						}
+						else
 						{
-							// Something is seriously wrong here. likely malformed binary, or our parsing failed elsewhere.
-							// This will log the pointer in mapped memory.
-							m_logger->LogError("Chained Fixups: Pointer at %llx left page",
-								GetStart() + ((chainEntryAddress - (nextEntryStrideCount * strideSize))) - m_universalImageOffset);
-							fixupsDone = true;
+							m_logger->LogWarn("Chained Fixups: Import Table entry %llx has no symbol; "
+								"Unable to bind item at %llx", fixup.value, fixup.address);
 						}
+					}
+					else
+					{
+						reloc.address = fixup.address;
+						DefineRelocation(m_arch, reloc, fixup.value, reloc.address);
 
-						if (nextEntryStrideCount == 0)
-							fixupsDone = true;
+						if (m_objcProcessor)
+						{
+							m_objcProcessor->AddRelocatedPointer(reloc.address, fixup.value);
+						}
 					}
 				}
 			}
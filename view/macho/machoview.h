@@ -1191,6 +1191,15 @@ namespace BinaryNinja
 		dyld_chained_ptr_32_cache_rebase             cache32;
 	};
 
+	// A chained fixup decoded from a segment, before it is applied to the view.
+	// `value` is the import ordinal for binds and the target address for rebases.
+	struct DecodedChainedFixup
+	{
+		uint64_t address;
+		bool bind;
+		uint64_t value;
+	};
+
 	// values for dyld_chained_fixups_header.imports_format
 	enum {
 		DYLD_CHAINED_IMPORT          = 1,
@@ -1273,7 +1282,7 @@ namespace BinaryNinja
 		linkedit_data_command chainedFixups {};
 		section_64 chainStarts {};
 
-		DataBuffer* stringList;
+		ViewBuffer stringList;
 		size_t stringListSize = 0;
 
 		uint64_t relocationBase = 0;
@@ -1367,8 +1376,6 @@ namespace BinaryNinja
 		bool ParseRelocationEntry(const relocation_info& info, uint64_t start, BNRelocationInfo& result);
 
 		void ParseExportTrie(BinaryReader& reader, linkedit_data_command exportTrie);
-		void ReadExportNode(uint64_t viewStart, DataBuffer& buffer, const std::string& currentText,
-			size_t cursor, uint32_t endGuard);
 
 		void ParseRebaseTable(BinaryReader& reader, MachOHeader& header, uint32_t tableOffset, uint32_t tableSize);
 		void ParseDynamicTable(BinaryReader& reader, MachOHeader& header, BNSymbolType type, uint32_t tableOffset, uint32_t tableSize,
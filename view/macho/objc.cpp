@@ -1,11 +1,16 @@
 #include "objc.h"
 #include "machoview.h"
 #include "inttypes.h"
+#include <shared_mutex>
+#include <thread>
 #include "rapidjson/rapidjson.h"
 #include "rapidjson/document.h"
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/prettywriter.h"
 
+// Class lists with at least this many entries are decoded on multiple threads
+#define PARALLEL_OBJC_CLASS_DECODE_THRESHOLD 256
+
 using namespace BinaryNinja;
 
 Ref<Metadata> ObjCProcessor::SerializeMethod(uint64_t loc, const Method& method)
@@ -100,7 +105,8 @@ Ref<Metadata> ObjCProcessor::SerializeMetadata()
 	return new Metadata(viewMeta);
 }
 
-std::vector<QualifiedNameOrType> ObjCProcessor::ParseEncodedType(const std::string& encodedType)
+std::vector<QualifiedNameOrType> ObjCProcessor::ParseEncodedTypeUncached(
+	const std::string& encodedType, size_t addressSize)
 {
 	std::vector<QualifiedNameOrType> result;
 	int pointerDepth = 0;
@@ -167,7 +173,7 @@ std::vector<QualifiedNameOrType> ObjCProcessor::ParseEncodedType(const std::stri
 			if (readingStructDepth == 0)
 			{
 				// TODO: Emit real struct types
-				nameOrType.type = Type::PointerType(m_data->GetAddressSize(), Type::VoidType());
+				nameOrType.type = Type::PointerType(addressSize, Type::VoidType());
 				break;
 			}
 			last = c;
@@ -217,7 +223,7 @@ std::vector<QualifiedNameOrType> ObjCProcessor::ParseEncodedType(const std::stri
 			qualifiedName = "CGFloat";
 			break;
 		case '*':
-			nameOrType.type = Type::PointerType(m_data->GetAddressSize(), Type::IntegerType(1, true));
+			nameOrType.type = Type::PointerType(addressSize, Type::IntegerType(1, true));
 			break;
 		case '@':
 			qualifiedName = "id";
@@ -265,6 +271,28 @@ std::vector<QualifiedNameOrType> ObjCProcessor::ParseEncodedType(const std::stri
 	return result;
 }
 
+std::shared_ptr<const std::vector<QualifiedNameOrType>> ObjCProcessor::ParseEncodedType(
+	const std::string& encodedType)
+{
+	// The same few encodings show up across every class and image, and a parse only depends on the
+	// encoding and the address size. Results are immutable, so they're shared by the whole process.
+	static std::shared_mutex cacheMutex;
+	static std::unordered_map<std::string, std::shared_ptr<const std::vector<QualifiedNameOrType>>> cache;
+
+	size_t addressSize = m_data->GetAddressSize();
+	std::string key = std::to_string(addressSize) + ":" + encodedType;
+	{
+		std::shared_lock<std::shared_mutex> lock(cacheMutex);
+		if (auto it = cache.find(key); it != cache.end())
+			return it->second;
+	}
+
+	auto parsed =
+		std::make_shared<const std::vector<QualifiedNameOrType>>(ParseEncodedTypeUncached(encodedType, addressSize));
+	std::unique_lock<std::shared_mutex> lock(cacheMutex);
+	return cache.emplace(std::move(key), std::move(parsed)).first->second;
+}
+
 void ObjCProcessor::DefineObjCSymbol(
 	BNSymbolType type, QualifiedName typeName, const std::string& name, uint64_t addr, bool deferred)
 {
@@ -333,210 +361,293 @@ void ObjCProcessor::DefineObjCSymbol(
 	}
 }
 
-void ObjCProcessor::LoadClasses(BinaryReader* reader, Ref<Section> classPtrSection)
+bool ObjCProcessor::DecodeClass(BinaryReader* reader, view_ptr_t classPointerLocation, Ref<Type> classPointerType,
+	Ref<Type> protocolListType, std::unordered_map<uint64_t, std::string>& selectorCache, DecodedClass& result)
 {
-	if (!classPtrSection)
-		return;
-	auto size = classPtrSection->GetEnd() - classPtrSection->GetStart();
-	if (size == 0)
-		return;
-	auto ptrSize = m_data->GetAddressSize();
-	auto ptrCount = size / ptrSize;
+	view_ptr_t classPtr;
+	class_t clsStruct;
+	class_ro_t classRO;
 
-	auto classPtrSectionStart = classPtrSection->GetStart();
-	for (size_t i = 0; i < ptrCount; i++)
+	bool hasValidMetaClass = false;
+	bool hasValidMetaClassRO = false;
+	class_t metaClsStruct;
+	class_ro_t metaClassRO;
+
+	reader->Seek(classPointerLocation);
+
+	classPtr = ReadPointerAccountingForRelocations(reader);
+	reader->Seek(classPtr);
+	try
+	{
+		clsStruct.isa = ReadPointerAccountingForRelocations(reader);
+		clsStruct.super = reader->ReadPointer();
+		clsStruct.cache = reader->ReadPointer();
+		clsStruct.vtable = reader->ReadPointer();
+		clsStruct.data = ReadPointerAccountingForRelocations(reader);
+	}
+	catch (ReadException& ex)
+	{
+		m_logger->LogError("Failed to read class data at 0x%llx pointed to by @ 0x%llx", reader->GetOffset(),
+			classPointerLocation);
+		return false;
+	}
+	if (clsStruct.data & 1)
+	{
+		m_logger->LogInfo("Skipping class at 0x%llx as it contains swift types", classPtr);
+		return false;
+	}
+	// unset first two bits
+	view_ptr_t classROPtr = clsStruct.data & ~3;
+	reader->Seek(classROPtr);
+	try
+	{
+		classRO.flags = reader->Read32();
+		classRO.instanceStart = reader->Read32();
+		classRO.instanceSize = reader->Read32();
+		if (m_data->GetAddressSize() == 8)
+			classRO.reserved = reader->Read32();
+		classRO.ivarLayout = ReadPointerAccountingForRelocations(reader);
+		classRO.name = ReadPointerAccountingForRelocations(reader);
+		classRO.baseMethods = ReadPointerAccountingForRelocations(reader);
+		classRO.baseProtocols = ReadPointerAccountingForRelocations(reader);
+		classRO.ivars = ReadPointerAccountingForRelocations(reader);
+		classRO.weakIvarLayout = ReadPointerAccountingForRelocations(reader);
+		classRO.baseProperties = ReadPointerAccountingForRelocations(reader);
+	}
+	catch (ReadException& ex)
 	{
-		Class cls;
+		m_logger->LogError("Failed to read class RO data at 0x%llx. 0x%llx, objc_class_t @ 0x%llx",
+			reader->GetOffset(), classPointerLocation, classROPtr);
+		return false;
+	}
 
-		view_ptr_t classPtr;
-		class_t clsStruct;
-		class_ro_t classRO;
+	auto namePtr = classRO.name;
 
-		bool hasValidMetaClass = false;
-		bool hasValidMetaClassRO = false;
-		class_t metaClsStruct;
-		class_ro_t metaClassRO;
+	std::string name;
 
-		view_ptr_t classPointerLocation = classPtrSectionStart + (i * m_data->GetAddressSize());
-		reader->Seek(classPointerLocation);
+	reader->Seek(namePtr);
+	try
+	{
+		name = reader->ReadCString(500);
+	}
+	catch (ReadException& ex)
+	{
+		m_logger->LogWarn(
+			"Failed to read class name at 0x%llx. Class has been given the placeholder name \"0x%llx\" ", namePtr,
+			classPtr);
+		char hexString[9];
+		hexString[8] = 0;
+		snprintf(hexString, sizeof(hexString), "%" PRIx64, classPtr);
+		name = "0x" + std::string(hexString);
+	}
 
-		classPtr = ReadPointerAccountingForRelocations(reader);
-		reader->Seek(classPtr);
-		try
+	Class& cls = result.cls;
+	DecodedObjCMetadata& metadata = result.metadata;
+	result.classPtr = classPtr;
+	cls.name = name;
+
+	metadata.DefineSymbol(BNSymbolType::DataSymbol, classPointerType, "clsPtr_" + name, classPointerLocation);
+	metadata.DefineSymbol(BNSymbolType::DataSymbol, m_typeNames.cls, "cls_" + name, classPtr);
+	metadata.DefineSymbol(BNSymbolType::DataSymbol, m_typeNames.classRO, "cls_ro_" + name, classROPtr);
+	metadata.DefineSymbol(BNSymbolType::DataSymbol, Type::ArrayType(Type::IntegerType(1, true), name.size() + 1),
+		"clsName_" + name, classRO.name);
+	if (classRO.baseProtocols)
+	{
+		metadata.DefineSymbol(
+			BNSymbolType::DataSymbol, protocolListType, "clsProtocols_" + name, classRO.baseProtocols);
+		reader->Seek(classRO.baseProtocols);
+		uint32_t count = reader->Read64();
+		view_ptr_t addr = reader->GetOffset();
+		auto ptrSize = m_data->GetAddressSize();
+		for (uint32_t j = 0; j < count; j++)
 		{
-			clsStruct.isa = ReadPointerAccountingForRelocations(reader);
-			clsStruct.super = reader->ReadPointer();
-			clsStruct.cache = reader->ReadPointer();
-			clsStruct.vtable = reader->ReadPointer();
-			clsStruct.data = ReadPointerAccountingForRelocations(reader);
+			metadata.protocolPointers.push_back(addr);
+			addr += ptrSize;
 		}
-		catch (ReadException& ex)
+	}
+
+	if (clsStruct.isa)
+	{
+		reader->Seek(clsStruct.isa);
+		try
 		{
-			m_logger->LogError("Failed to read class data at 0x%llx pointed to by @ 0x%llx", reader->GetOffset(),
-				classPointerLocation);
-			continue;
+			metaClsStruct.isa = ReadPointerAccountingForRelocations(reader);
+			metaClsStruct.super = reader->ReadPointer();
+			metaClsStruct.cache = reader->ReadPointer();
+			metaClsStruct.vtable = reader->ReadPointer();
+			metaClsStruct.data = ReadPointerAccountingForRelocations(reader) & ~1;
+			metadata.DefineSymbol(BNSymbolType::DataSymbol, m_typeNames.cls, "metacls_" + name, clsStruct.isa);
+			hasValidMetaClass = true;
 		}
-		if (clsStruct.data & 1)
+		catch (ReadException& ex)
 		{
-			m_logger->LogInfo("Skipping class at 0x%llx as it contains swift types", classPtr);
-			continue;
+			m_logger->LogWarn("Failed to read metaclass data at 0x%llx pointed to by objc_class_t @ 0x%llx",
+				reader->GetOffset(), classPtr);
 		}
-		// unset first two bits
-		view_ptr_t classROPtr = clsStruct.data & ~3;
-		reader->Seek(classROPtr);
+	}
+	if (hasValidMetaClass && (metaClsStruct.data & 1))
+	{
+		m_logger->LogInfo("Skipping metaclass at 0x%llx as it contains swift types", classPtr);
+		hasValidMetaClass = false;
+	}
+	if (hasValidMetaClass)
+	{
+		reader->Seek(metaClsStruct.data);
 		try
 		{
-			classRO.flags = reader->Read32();
-			classRO.instanceStart = reader->Read32();
-			classRO.instanceSize = reader->Read32();
+			metaClassRO.flags = reader->Read32();
+			metaClassRO.instanceStart = reader->Read32();
+			metaClassRO.instanceSize = reader->Read32();
 			if (m_data->GetAddressSize() == 8)
-				classRO.reserved = reader->Read32();
-			classRO.ivarLayout = ReadPointerAccountingForRelocations(reader);
-			classRO.name = ReadPointerAccountingForRelocations(reader);
-			classRO.baseMethods = ReadPointerAccountingForRelocations(reader);
-			classRO.baseProtocols = ReadPointerAccountingForRelocations(reader);
-			classRO.ivars = ReadPointerAccountingForRelocations(reader);
-			classRO.weakIvarLayout = ReadPointerAccountingForRelocations(reader);
-			classRO.baseProperties = ReadPointerAccountingForRelocations(reader);
+				metaClassRO.reserved = reader->Read32();
+			metaClassRO.ivarLayout = ReadPointerAccountingForRelocations(reader);
+			metaClassRO.name = ReadPointerAccountingForRelocations(reader);
+			metaClassRO.baseMethods = ReadPointerAccountingForRelocations(reader);
+			metaClassRO.baseProtocols = ReadPointerAccountingForRelocations(reader);
+			metaClassRO.ivars = ReadPointerAccountingForRelocations(reader);
+			metaClassRO.weakIvarLayout = ReadPointerAccountingForRelocations(reader);
+			metaClassRO.baseProperties = ReadPointerAccountingForRelocations(reader);
+			metadata.DefineSymbol(
+				BNSymbolType::DataSymbol, m_typeNames.classRO, "metacls_ro_" + name, metaClsStruct.data);
+			hasValidMetaClassRO = true;
 		}
 		catch (ReadException& ex)
 		{
-			m_logger->LogError("Failed to read class RO data at 0x%llx. 0x%llx, objc_class_t @ 0x%llx",
-				reader->GetOffset(), classPointerLocation, classROPtr);
-			continue;
+			m_logger->LogWarn("Failed to read metaclass RO data at 0x%llx pointed to by meta objc_class_t @ 0x%llx",
+				reader->GetOffset(), clsStruct.isa);
 		}
+	}
 
-		auto namePtr = classRO.name;
-
-		std::string name;
-
-		reader->Seek(namePtr);
+	if (classRO.baseMethods)
+	{
 		try
 		{
-			name = reader->ReadCString(500);
+			ReadMethodList(reader, cls.instanceClass, name, classRO.baseMethods, selectorCache, metadata);
 		}
 		catch (ReadException& ex)
 		{
-			m_logger->LogWarn(
-				"Failed to read class name at 0x%llx. Class has been given the placeholder name \"0x%llx\" ", namePtr,
-				classPtr);
-			char hexString[9];
-			hexString[8] = 0;
-			snprintf(hexString, sizeof(hexString), "%" PRIx64, classPtr);
-			name = "0x" + std::string(hexString);
-		}
-
-		cls.name = name;
-
-		DefineObjCSymbol(BNSymbolType::DataSymbol,
-			Type::PointerType(m_data->GetAddressSize(), m_data->GetTypeByName(m_typeNames.cls)), "clsPtr_" + name,
-			classPointerLocation, true);
-		DefineObjCSymbol(BNSymbolType::DataSymbol, m_typeNames.cls, "cls_" + name, classPtr, true);
-		DefineObjCSymbol(BNSymbolType::DataSymbol, m_typeNames.classRO, "cls_ro_" + name, classROPtr, true);
-		DefineObjCSymbol(BNSymbolType::DataSymbol, Type::ArrayType(Type::IntegerType(1, true), name.size() + 1),
-			"clsName_" + name, classRO.name, true);
-		if (classRO.baseProtocols)
-		{
-			DefineObjCSymbol(BNSymbolType::DataSymbol, Type::NamedType(m_data, m_typeNames.protocolList),
-				"clsProtocols_" + name, classRO.baseProtocols, true);
-			reader->Seek(classRO.baseProtocols);
-			uint32_t count = reader->Read64();
-			view_ptr_t addr = reader->GetOffset();
-			for (uint32_t j = 0; j < count; j++)
-			{
-				m_data->DefineDataVariable(
-					addr, Type::PointerType(ptrSize, Type::NamedType(m_data, m_typeNames.protocol)));
-				addr += ptrSize;
-			}
-		}
-
-		if (clsStruct.isa)
-		{
-			reader->Seek(clsStruct.isa);
-			try
-			{
-				metaClsStruct.isa = ReadPointerAccountingForRelocations(reader);
-				metaClsStruct.super = reader->ReadPointer();
-				metaClsStruct.cache = reader->ReadPointer();
-				metaClsStruct.vtable = reader->ReadPointer();
-				metaClsStruct.data = ReadPointerAccountingForRelocations(reader) & ~1;
-				DefineObjCSymbol(BNSymbolType::DataSymbol, m_typeNames.cls, "metacls_" + name, clsStruct.isa, true);
-				hasValidMetaClass = true;
-			}
-			catch (ReadException& ex)
-			{
-				m_logger->LogWarn("Failed to read metaclass data at 0x%llx pointed to by objc_class_t @ 0x%llx",
-					reader->GetOffset(), classPtr);
-			}
+			m_logger->LogError("Failed to read the method list for class pointed to by 0x%llx", clsStruct.data);
 		}
-		if (hasValidMetaClass && (metaClsStruct.data & 1))
+	}
+	if (hasValidMetaClassRO && metaClassRO.baseMethods)
+	{
+		try
 		{
-			m_logger->LogInfo("Skipping metaclass at 0x%llx as it contains swift types", classPtr);
-			hasValidMetaClass = false;
+			ReadMethodList(reader, cls.metaClass, name, metaClassRO.baseMethods, selectorCache, metadata);
 		}
-		if (hasValidMetaClass)
+		catch (ReadException& ex)
 		{
-			reader->Seek(metaClsStruct.data);
-			try
-			{
-				metaClassRO.flags = reader->Read32();
-				metaClassRO.instanceStart = reader->Read32();
-				metaClassRO.instanceSize = reader->Read32();
-				if (m_data->GetAddressSize() == 8)
-					metaClassRO.reserved = reader->Read32();
-				metaClassRO.ivarLayout = ReadPointerAccountingForRelocations(reader);
-				metaClassRO.name = ReadPointerAccountingForRelocations(reader);
-				metaClassRO.baseMethods = ReadPointerAccountingForRelocations(reader);
-				metaClassRO.baseProtocols = ReadPointerAccountingForRelocations(reader);
-				metaClassRO.ivars = ReadPointerAccountingForRelocations(reader);
-				metaClassRO.weakIvarLayout = ReadPointerAccountingForRelocations(reader);
-				metaClassRO.baseProperties = ReadPointerAccountingForRelocations(reader);
-				DefineObjCSymbol(
-					BNSymbolType::DataSymbol, m_typeNames.classRO, "metacls_ro_" + name, metaClsStruct.data, true);
-				hasValidMetaClassRO = true;
-			}
-			catch (ReadException& ex)
-			{
-				m_logger->LogWarn("Failed to read metaclass RO data at 0x%llx pointed to by meta objc_class_t @ 0x%llx",
-					reader->GetOffset(), clsStruct.isa);
-			}
+			m_logger->LogError("Failed to read the method list for metaclass pointed to by 0x%llx", clsStruct.data);
 		}
+	}
 
-		if (classRO.baseMethods)
+	if (classRO.ivars)
+	{
+		try
 		{
-			try
-			{
-				ReadMethodList(reader, cls.instanceClass, name, classRO.baseMethods);
-			}
-			catch (ReadException& ex)
-			{
-				m_logger->LogError("Failed to read the method list for class pointed to by 0x%llx", clsStruct.data);
-			}
+			ReadIvarList(reader, cls.instanceClass, name, classRO.ivars, metadata);
 		}
-		if (hasValidMetaClassRO && metaClassRO.baseMethods)
+		catch (ReadException& ex)
 		{
-			try
-			{
-				ReadMethodList(reader, cls.metaClass, name, metaClassRO.baseMethods);
-			}
-			catch (ReadException& ex)
-			{
-				m_logger->LogError("Failed to read the method list for metaclass pointed to by 0x%llx", clsStruct.data);
-			}
+			m_logger->LogError("Failed to process ivars for class at 0x%llx", clsStruct.data);
 		}
+	}
+	return true;
+}
 
-		if (classRO.ivars)
+void ObjCProcessor::ApplyDecodedMetadata(DecodedObjCMetadata& metadata)
+{
+	for (auto& symbol : metadata.symbols)
+	{
+		if (symbol.type)
+			DefineObjCSymbol(symbol.symbolType, symbol.type, symbol.name, symbol.address, true);
+		else
+			DefineObjCSymbol(symbol.symbolType, symbol.typeName, symbol.name, symbol.address, true);
+	}
+	if (!metadata.protocolPointers.empty())
+	{
+		auto protocolPointerType =
+			Type::PointerType(m_data->GetAddressSize(), Type::NamedType(m_data, m_typeNames.protocol));
+		for (auto addr : metadata.protocolPointers)
+			m_data->DefineDataVariable(addr, protocolPointerType);
+	}
+	// workflow objc support
+	for (const auto& [selAddr, imp] : metadata.selectorImplementations)
+		m_selToImplementations[selAddr].push_back(imp);
+	for (const auto& [selRefAddr, imp] : metadata.selectorRefImplementations)
+		m_selRefToImplementations[selRefAddr].push_back(imp);
+	// --
+	for (auto& [cursor, method] : metadata.methods)
+		m_localMethods[cursor] = std::move(method);
+}
+
+void ObjCProcessor::LoadClasses(BinaryReader* reader, Ref<Section> classPtrSection)
+{
+	if (!classPtrSection)
+		return;
+	auto size = classPtrSection->GetEnd() - classPtrSection->GetStart();
+	if (size == 0)
+		return;
+	auto ptrSize = m_data->GetAddressSize();
+	auto ptrCount = size / ptrSize;
+
+	auto classPtrSectionStart = classPtrSection->GetStart();
+	// Resolved up front so decoding never has to look types up in the view
+	auto classPointerType = Type::PointerType(ptrSize, m_data->GetTypeByName(m_typeNames.cls));
+	auto protocolListType = Type::NamedType(m_data, m_typeNames.protocolList);
+
+	// Decoding only reads from the view, so classes are decoded concurrently into plain structs and
+	// then applied in list order. This keeps symbol definition order the same as a serial load.
+	std::vector<DecodedClass> decoded(ptrCount);
+	std::vector<uint8_t> decodedValid(ptrCount, 0);
+	size_t threadCount = std::min<size_t>(std::thread::hardware_concurrency(),
+		ptrCount / PARALLEL_OBJC_CLASS_DECODE_THRESHOLD);
+	if (threadCount == 0)
+		threadCount = 1;
+	size_t chunk = (ptrCount + threadCount - 1) / threadCount;
+	std::vector<std::unordered_map<uint64_t, std::string>> selectorCaches(threadCount);
+	auto decodeChunk = [&](size_t chunkIndex) {
+		BinaryReader threadReader(m_data);
+		threadReader.SetEndianness(reader->GetEndianness());
+		auto& selectorCache = selectorCaches[chunkIndex];
+		size_t end = std::min(ptrCount, (chunkIndex + 1) * chunk);
+		for (size_t i = chunkIndex * chunk; i < end; i++)
 		{
+			view_ptr_t classPointerLocation = classPtrSectionStart + (i * ptrSize);
 			try
 			{
-				ReadIvarList(reader, cls.instanceClass, name, classRO.ivars);
+				decodedValid[i] = DecodeClass(&threadReader, classPointerLocation, classPointerType, protocolListType,
+					selectorCache, decoded[i]);
 			}
-			catch (ReadException& ex)
+			catch (ReadException&)
 			{
-				m_logger->LogError("Failed to process ivars for class at 0x%llx", clsStruct.data);
+				m_logger->LogError("Failed to read class pointed to by 0x%llx", classPointerLocation);
 			}
 		}
-		m_classes[classPtr] = cls;
+	};
+
+	if (threadCount <= 1)
+	{
+		decodeChunk(0);
+	}
+	else
+	{
+		std::vector<std::thread> threads;
+		for (size_t chunkIndex = 1; chunkIndex < threadCount; chunkIndex++)
+			threads.emplace_back(decodeChunk, chunkIndex);
+		decodeChunk(0);
+		for (auto& t : threads)
+			t.join();
+	}
+
+	for (auto& selectorCache : selectorCaches)
+		m_selectorCache.merge(selectorCache);
+	for (size_t i = 0; i < ptrCount; i++)
+	{
+		if (!decodedValid[i])
+			continue;
+		ApplyDecodedMetadata(decoded[i].metadata);
+		m_classes[decoded[i].classPtr] = std::move(decoded[i].cls);
 	}
 }
 
@@ -557,6 +668,7 @@ void ObjCProcessor::LoadCategories(BinaryReader* reader, Ref<Section> classPtrSe
 	for (size_t i = classPtrSectionStart; i < classPtrSectionEnd; i += ptrSize)
 	{
 		Class category;
+		DecodedObjCMetadata metadata;
 		category_t cat;
 
 		reader->Seek(i);
@@ -615,14 +727,15 @@ void ObjCProcessor::LoadCategories(BinaryReader* reader, Ref<Section> classPtrSe
 			categoryAdditionsName = std::to_string(catLocation);
 		}
 		category.name = categoryBaseClassName + " (" + categoryAdditionsName + ")";
-		DefineObjCSymbol(BNSymbolType::DataSymbol, ptrType, "categoryPtr_" + category.name, i, true);
-		DefineObjCSymbol(BNSymbolType::DataSymbol, catType, "category_" + category.name, catLocation, true);
+		metadata.DefineSymbol(BNSymbolType::DataSymbol, ptrType, "categoryPtr_" + category.name, i);
+		metadata.DefineSymbol(BNSymbolType::DataSymbol, catType, "category_" + category.name, catLocation);
 
 		if (cat.instanceMethods)
 		{
 			try
 			{
-				ReadMethodList(reader, category.instanceClass, category.name, cat.instanceMethods);
+				ReadMethodList(reader, category.instanceClass, category.name, cat.instanceMethods,
+					m_selectorCache, metadata);
 			}
 			catch (ReadException& ex)
 			{
@@ -634,7 +747,7 @@ void ObjCProcessor::LoadCategories(BinaryReader* reader, Ref<Section> classPtrSe
 		{
 			try
 			{
-				ReadMethodList(reader, category.metaClass, category.name, cat.classMethods);
+				ReadMethodList(reader, category.metaClass, category.name, cat.classMethods, m_selectorCache, metadata);
 			}
 			catch (ReadException& ex)
 			{
@@ -642,6 +755,7 @@ void ObjCProcessor::LoadCategories(BinaryReader* reader, Ref<Section> classPtrSe
 					"Failed to read the class method list for category pointed to by 0x%llx", catLocation);
 			}
 		}
+		ApplyDecodedMetadata(metadata);
 		m_categories[catLocation] = category;
 	}
 }
@@ -663,6 +777,7 @@ void ObjCProcessor::LoadProtocols(BinaryReader* reader, Ref<Section> listSection
 	for (size_t i = listSectionStart; i < listSectionEnd; i += ptrSize)
 	{
 		protocol_t protocol;
+		DecodedObjCMetadata metadata;
 		reader->Seek(i);
 		auto protocolLocation = ReadPointerAccountingForRelocations(reader);
 		reader->Seek(protocolLocation);
@@ -689,9 +804,9 @@ void ObjCProcessor::LoadProtocols(BinaryReader* reader, Ref<Section> listSection
 		{
 			reader->Seek(protocol.mangledName);
 			protocolName = reader->ReadCString();
-			DefineObjCSymbol(BNSymbolType::DataSymbol,
+			metadata.DefineSymbol(BNSymbolType::DataSymbol,
 				Type::ArrayType(Type::IntegerType(1, true), protocolName.size() + 1), "protocolName_" + protocolName,
-				protocol.mangledName, true);
+				protocol.mangledName);
 		}
 		catch (ReadException& ex)
 		{
@@ -703,19 +818,18 @@ void ObjCProcessor::LoadProtocols(BinaryReader* reader, Ref<Section> listSection
 
 		Protocol protocolClass;
 		protocolClass.name = protocolName;
-		DefineObjCSymbol(BNSymbolType::DataSymbol, ptrType, "protocolPtr_" + protocolName, i, true);
-		DefineObjCSymbol(BNSymbolType::DataSymbol, protocolType, "protocol_" + protocolName, protocolLocation, true);
+		metadata.DefineSymbol(BNSymbolType::DataSymbol, ptrType, "protocolPtr_" + protocolName, i);
+		metadata.DefineSymbol(BNSymbolType::DataSymbol, protocolType, "protocol_" + protocolName, protocolLocation);
 		if (protocol.protocols)
 		{
-			DefineObjCSymbol(BNSymbolType::DataSymbol, Type::NamedType(m_data, m_typeNames.protocolList),
-				"protoProtocols_" + protocolName, protocol.protocols, true);
+			metadata.DefineSymbol(BNSymbolType::DataSymbol, Type::NamedType(m_data, m_typeNames.protocolList),
+				"protoProtocols_" + protocolName, protocol.protocols);
 			reader->Seek(protocol.protocols);
 			uint32_t count = reader->Read64();
 			view_ptr_t addr = reader->GetOffset();
 			for (uint32_t j = 0; j < count; j++)
 			{
-				m_data->DefineDataVariable(
-					addr, Type::PointerType(ptrSize, Type::NamedType(m_data, m_typeNames.protocol)));
+				metadata.protocolPointers.push_back(addr);
 				addr += ptrSize;
 			}
 		}
@@ -724,7 +838,8 @@ void ObjCProcessor::LoadProtocols(BinaryReader* reader, Ref<Section> listSection
 		{
 			try
 			{
-				ReadMethodList(reader, protocolClass.instanceMethods, protocolName, protocol.instanceMethods);
+				ReadMethodList(reader, protocolClass.instanceMethods, protocolName, protocol.instanceMethods,
+					m_selectorCache, metadata);
 			}
 			catch (ReadException& ex)
 			{
@@ -736,7 +851,8 @@ void ObjCProcessor::LoadProtocols(BinaryReader* reader, Ref<Section> listSection
 		{
 			try
 			{
-				ReadMethodList(reader, protocolClass.classMethods, protocolName, protocol.classMethods);
+				ReadMethodList(reader, protocolClass.classMethods, protocolName, protocol.classMethods,
+					m_selectorCache, metadata);
 			}
 			catch (ReadException& ex)
 			{
@@ -748,8 +864,8 @@ void ObjCProcessor::LoadProtocols(BinaryReader* reader, Ref<Section> listSection
 		{
 			try
 			{
-				ReadMethodList(
-					reader, protocolClass.optionalInstanceMethods, protocolName, protocol.optionalInstanceMethods);
+				ReadMethodList(reader, protocolClass.optionalInstanceMethods, protocolName,
+					protocol.optionalInstanceMethods, m_selectorCache, metadata);
 			}
 			catch (ReadException& ex)
 			{
@@ -761,7 +877,8 @@ void ObjCProcessor::LoadProtocols(BinaryReader* reader, Ref<Section> listSection
 		{
 			try
 			{
-				ReadMethodList(reader, protocolClass.optionalClassMethods, protocolName, protocol.optionalClassMethods);
+				ReadMethodList(reader, protocolClass.optionalClassMethods, protocolName, protocol.optionalClassMethods,
+					m_selectorCache, metadata);
 			}
 			catch (ReadException& ex)
 			{
@@ -769,11 +886,13 @@ void ObjCProcessor::LoadProtocols(BinaryReader* reader, Ref<Section> listSection
 					protocolLocation);
 			}
 		}
+		ApplyDecodedMetadata(metadata);
 		m_protocols[protocolLocation] = protocolClass;
 	}
 }
 
-void ObjCProcessor::ReadMethodList(BinaryReader* reader, ClassBase& cls, std::string name, view_ptr_t start)
+void ObjCProcessor::ReadMethodList(BinaryReader* reader, ClassBase& cls, std::string name, view_ptr_t start,
+	std::unordered_map<uint64_t, std::string>& selectorCache, DecodedObjCMetadata& metadata)
 {
 	reader->Seek(start);
 	method_list_t head;
@@ -783,7 +902,7 @@ void ObjCProcessor::ReadMethodList(BinaryReader* reader, ClassBase& cls, std::st
 	bool relativeOffsets = (head.entsizeAndFlags & 0xFFFF0000) & 0x80000000;
 	bool directSelectors = (head.entsizeAndFlags & 0xFFFF0000) & 0x40000000;
 	auto methodSize = relativeOffsets ? 12 : pointerSize * 3;
-	DefineObjCSymbol(DataSymbol, m_typeNames.methodList, "method_list_" + name, start, true);
+	metadata.DefineSymbol(DataSymbol, m_typeNames.methodList, "method_list_" + name, start);
 
 	for (unsigned i = 0; i < head.count; i++)
 	{
@@ -816,10 +935,10 @@ void ObjCProcessor::ReadMethodList(BinaryReader* reader, ClassBase& cls, std::st
 				method.name = reader->ReadCString();
 				reader->Seek(meth.types);
 				method.types = reader->ReadCString();
-				DefineObjCSymbol(DataSymbol, Type::ArrayType(Type::IntegerType(1, true), method.name.size() + 1),
-					"sel_" + method.name, meth.name, true);
-				DefineObjCSymbol(DataSymbol, Type::ArrayType(Type::IntegerType(1, true), method.types.size() + 1),
-					"selTypes_" + method.name, meth.types, true);
+				metadata.DefineSymbol(DataSymbol, Type::ArrayType(Type::IntegerType(1, true), method.name.size() + 1),
+					"sel_" + method.name, meth.name);
+				metadata.DefineSymbol(DataSymbol, Type::ArrayType(Type::IntegerType(1, true), method.types.size() + 1),
+					"selTypes_" + method.name, meth.types);
 			}
 			else
 			{
@@ -831,33 +950,33 @@ void ObjCProcessor::ReadMethodList(BinaryReader* reader, ClassBase& cls, std::st
 				reader->Seek(meth.types);
 				method.types = reader->ReadCString();
 				selAddr = selRef;
-				if (const auto& it = m_selectorCache.find(selRef); it != m_selectorCache.end())
+				if (const auto& it = selectorCache.find(selRef); it != selectorCache.end())
 					method.name = it->second;
 				else
 				{
 					reader->Seek(selRef);
 					method.name = reader->ReadCString(selRef);
-					m_selectorCache[selRef] = method.name;
+					selectorCache[selRef] = method.name;
 				}
 				auto selType = Type::ArrayType(Type::IntegerType(1, true), method.name.size() + 1);
-				DefineObjCSymbol(DataSymbol, selType, "sel_" + method.name, selRef, true);
-				DefineObjCSymbol(DataSymbol, Type::ArrayType(Type::IntegerType(1, true), method.types.size() + 1),
-					"selTypes_" + method.name, meth.types, true);
-				DefineObjCSymbol(DataSymbol, Type::PointerType(m_data->GetAddressSize(), selType),
-					"selRef_" + method.name, meth.name, true);
+				metadata.DefineSymbol(DataSymbol, selType, "sel_" + method.name, selRef);
+				metadata.DefineSymbol(DataSymbol, Type::ArrayType(Type::IntegerType(1, true), method.types.size() + 1),
+					"selTypes_" + method.name, meth.types);
+				metadata.DefineSymbol(DataSymbol, Type::PointerType(m_data->GetAddressSize(), selType),
+					"selRef_" + method.name, meth.name);
 			}
 			// workflow objc support
 			if (selAddr)
-				m_selToImplementations[selAddr].push_back(meth.imp);
+				metadata.selectorImplementations.emplace_back(selAddr, meth.imp);
 			if (selRefAddr)
-				m_selRefToImplementations[selRefAddr].push_back(meth.imp);
+				metadata.selectorRefImplementations.emplace_back(selRefAddr, meth.imp);
 			// --
 
-			DefineObjCSymbol(DataSymbol, relativeOffsets ? m_typeNames.methodEntry : m_typeNames.method,
-				"method_" + method.name, cursor, true);
+			metadata.DefineSymbol(DataSymbol, relativeOffsets ? m_typeNames.methodEntry : m_typeNames.method,
+				"method_" + method.name, cursor);
 			method.imp = meth.imp;
 			cls.methodList[cursor] = method;
-			m_localMethods[cursor] = method;
+			metadata.methods.emplace_back(cursor, method);
 		}
 		catch (ReadException& ex)
 		{
@@ -867,14 +986,15 @@ void ObjCProcessor::ReadMethodList(BinaryReader* reader, ClassBase& cls, std::st
 	}
 }
 
-void ObjCProcessor::ReadIvarList(BinaryReader* reader, ClassBase& cls, std::string name, view_ptr_t start)
+void ObjCProcessor::ReadIvarList(BinaryReader* reader, ClassBase& cls, std::string name, view_ptr_t start,
+	DecodedObjCMetadata& metadata)
 {
 	reader->Seek(start);
 	ivar_list_t head;
 	head.entsizeAndFlags = reader->Read32();
 	head.count = reader->Read32();
 	auto addressSize = m_data->GetAddressSize();
-	DefineObjCSymbol(DataSymbol, m_typeNames.ivarList, "ivar_list_" + name, start, true);
+	metadata.DefineSymbol(DataSymbol, m_typeNames.ivarList, "ivar_list_" + name, start);
 	for (unsigned i = 0; i < head.count; i++)
 	{
 		try
@@ -896,11 +1016,11 @@ void ObjCProcessor::ReadIvarList(BinaryReader* reader, ClassBase& cls, std::stri
 			reader->Seek(ivarStruct.type);
 			ivar.type = reader->ReadCString();
 
-			DefineObjCSymbol(DataSymbol, m_typeNames.ivar, "ivar_" + ivar.name, cursor, true);
-			DefineObjCSymbol(DataSymbol, Type::ArrayType(Type::IntegerType(1, true), ivar.name.size() + 1),
-				"ivarName_" + ivar.name, ivarStruct.name, true);
-			DefineObjCSymbol(DataSymbol, Type::ArrayType(Type::IntegerType(1, true), ivar.type.size() + 1),
-				"ivarType_" + ivar.name, ivarStruct.type, true);
+			metadata.DefineSymbol(DataSymbol, m_typeNames.ivar, "ivar_" + ivar.name, cursor);
+			metadata.DefineSymbol(DataSymbol, Type::ArrayType(Type::IntegerType(1, true), ivar.name.size() + 1),
+				"ivarName_" + ivar.name, ivarStruct.name);
+			metadata.DefineSymbol(DataSymbol, Type::ArrayType(Type::IntegerType(1, true), ivar.type.size() + 1),
+				"ivarType_" + ivar.name, ivarStruct.type);
 
 			cls.ivarList[cursor] = ivar;
 		}
@@ -961,12 +1081,12 @@ void ObjCProcessor::GenerateClassTypes()
 		for (const auto& [ivarLoc, ivar] : cls.instanceClass.ivarList)
 		{
 			auto encodedTypeList = ParseEncodedType(ivar.type);
-			if (encodedTypeList.empty())
+			if (encodedTypeList->empty())
 			{
 				failedToDecodeType = true;
 				break;
 			}
-			auto encodedType = encodedTypeList.at(0);
+			auto encodedType = encodedTypeList->at(0);
 
 			Ref<Type> type;
 
@@ -997,6 +1117,16 @@ void ObjCProcessor::GenerateClassTypes()
 
 bool ObjCProcessor::ApplyMethodType(Class& cls, Method& method, bool isInstanceMethod)
 {
+	// Prototypes only differ by self type, selector and encoding, so identical ones share one type
+	std::string prototypeKey = cls.associatedName.GetString() + "\n" + method.name + "\n" + method.types;
+	std::string prefix = isInstanceMethod ? "-" : "+";
+	auto name = prefix + "[" + cls.name + " " + method.name + "]";
+	if (auto it = m_methodTypeCache.find(prototypeKey); it != m_methodTypeCache.end())
+	{
+		DefineObjCSymbol(FunctionSymbol, it->second, name, method.imp, true);
+		return true;
+	}
+
 	std::stringstream r(method.name);
 
 	std::string token;
@@ -1004,7 +1134,8 @@ bool ObjCProcessor::ApplyMethodType(Class& cls, Method& method, bool isInstanceM
 	while (std::getline(r, token, ':'))
 		selectorTokens.push_back(token);
 
-	std::vector<QualifiedNameOrType> typeTokens = ParseEncodedType(method.types);
+	auto parsedTypeTokens = ParseEncodedType(method.types);
+	const auto& typeTokens = *parsedTypeTokens;
 	if (typeTokens.empty())
 		return false;
 
@@ -1052,11 +1183,9 @@ bool ObjCProcessor::ApplyMethodType(Class& cls, Method& method, bool isInstanceM
 	}
 
 	auto funcType = BinaryNinja::Type::FunctionType(retType, cc, params);
+	m_methodTypeCache.emplace(std::move(prototypeKey), funcType);
 
 	// Search for the method's implementation function; apply the type if found.
-	std::string prefix = isInstanceMethod ? "-" : "+";
-	auto name = prefix + "[" + cls.name + " " + method.name + "]";
-
 	DefineObjCSymbol(FunctionSymbol, funcType, name, method.imp, true);
 
 	return true;
@@ -1380,6 +1509,7 @@ void ObjCProcessor::ProcessObjCData()
 	m_data->StoreMetadata("Objective-C", meta, true);
 
 	m_relocationPointerRewrites.clear();
+	m_methodTypeCache.clear();
 }
 
 
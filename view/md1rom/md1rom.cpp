@@ -81,6 +81,64 @@ Md1romView::Md1romView(BinaryNinja::BinaryView* data, bool parseOnly): BinaryVie
 	}
 }
 
+Md1romCompressedSection::Md1romCompressedSection(BinaryView* data, Logger* logger, const Md1romSegment& segment,
+	uint64_t uncompressedSize): m_data(data), m_logger(logger), m_segment(segment), m_uncompressedSize(uncompressedSize)
+{
+}
+
+
+bool Md1romCompressedSection::IsCompressed(BinaryView* data, const Md1romSegment& segment, uint64_t& uncompressedSize)
+{
+	// LZMA alone header: properties byte, 32-bit dictionary size, 64-bit uncompressed size
+	DataBuffer header = data->ReadBuffer(segment.dataStart, 13);
+	if (header.GetLength() != 13 || segment.length <= 13)
+		return false;
+
+	const uint8_t* bytes = (const uint8_t*)header.GetData();
+	if (bytes[0] >= 9 * 5 * 5)
+		return false;
+
+	uint32_t dictionarySize = 0;
+	for (size_t i = 0; i < 4; i++)
+		dictionarySize |= (uint32_t)bytes[1 + i] << (i * 8);
+	if (dictionarySize < 0x1000)
+		return false;
+
+	// Streams that end with a marker instead of recording their size can't be described before decompressing
+	uncompressedSize = 0;
+	for (size_t i = 0; i < 8; i++)
+		uncompressedSize |= (uint64_t)bytes[5 + i] << (i * 8);
+	return uncompressedSize != 0 && uncompressedSize < 0x100000000;
+}
+
+
+const DataBuffer& Md1romCompressedSection::Materialize()
+{
+	std::call_once(m_decompressOnce, [this]() {
+		DataBuffer data = m_data->ReadBuffer(m_segment.dataStart, m_segment.length);
+		if (data.GetLength() != m_segment.length || !data.LzmaDecompress(m_decompressed))
+		{
+			m_logger->LogWarn("failed to decompress segment %s", m_segment.name.c_str());
+			m_decompressed = DataBuffer();
+			return;
+		}
+		m_logger->LogDebug("decompressed segment %s: 0x%zx bytes", m_segment.name.c_str(), m_decompressed.GetLength());
+	});
+	return m_decompressed;
+}
+
+
+size_t Md1romCompressedSection::Read(void* dest, uint64_t offset, size_t len)
+{
+	const DataBuffer& data = Materialize();
+	if (offset >= data.GetLength())
+		return 0;
+	len = std::min<uint64_t>(len, data.GetLength() - offset);
+	memcpy(dest, data.GetDataAt(offset), len);
+	return len;
+}
+
+
 Md1romView::~Md1romView()
 {
 
@@ -194,6 +252,41 @@ bool Md1romView::Init()
 		GetParentView()->AddAutoSection(seg.name + "_data", seg.dataStart, seg.length);
 	}
 
+	// Compressed segments are mapped after the main ROM, their contents are decompressed on first read
+	uint64_t regionStart = m_mainRomFound ? m_entryPoint + m_mainRom.length : MAIN_ROM_BASE;
+	for (const auto& seg: m_segments)
+	{
+		uint64_t uncompressedSize;
+		if (seg.name == "md1rom" || !Md1romCompressedSection::IsCompressed(GetParentView(), seg, uncompressedSize))
+			continue;
+
+		regionStart = (regionStart + 0xfff) & ~0xfffULL;
+		auto section = make_shared<Md1romCompressedSection>(GetParentView(), m_logger, seg, uncompressedSize);
+		if (!GetMemoryMap()->AddRemoteMemoryRegion(seg.name, regionStart, section.get(), SegmentReadable | SegmentDenyWrite))
+		{
+			m_logger->LogWarn("failed to map compressed segment %s", seg.name.c_str());
+			continue;
+		}
+		AddAutoSection(seg.name, regionStart, uncompressedSize, ReadOnlyDataSectionSemantics);
+		m_logger->LogDebug("compressed segment %s mapped at 0x%llx, 0x%llx bytes", seg.name.c_str(),
+			(unsigned long long)regionStart, (unsigned long long)uncompressedSize);
+
+		m_compressedSections.push_back(section);
+		if (seg.name == "md1_dbginfo")
+			m_dbgInfoSection = section;
+		regionStart += uncompressedSize;
+	}
+
+	// Full analysis reads all of them anyway, so decompress the independent segments in parallel up front
+	if (Settings::Instance()->Get<string>("analysis.mode", this) == "full")
+	{
+		for (const auto& section: m_compressedSections)
+		{
+			if (section != m_dbgInfoSection)
+				WorkerEnqueue([section]() { section->Materialize(); }, "md1rom decompress " + section->GetSegment().name);
+		}
+	}
+
 	m_symbolQueue = new SymbolQueue();
 	ParseDebugInfo();
 	// This does not seem to work, see
@@ -247,18 +340,29 @@ void Md1romView::ParseDebugInfo()
 	if (!m_dbgInfoFound)
 		return;
 
-	DataBuffer data = GetParentView()->ReadBuffer(m_dbgInfoSeg.dataStart, m_dbgInfoSeg.length);
-	if (data.GetLength() != m_dbgInfoSeg.length)
-		return;
+	// The debug info is parsed right away, reuse the bytes of the mapped section when there is one
+	DataBuffer fallback;
+	const DataBuffer* decompressed = &fallback;
+	if (m_dbgInfoSection)
+	{
+		decompressed = &m_dbgInfoSection->Materialize();
+		if (decompressed->GetLength() == 0)
+			return;
+	}
+	else
+	{
+		DataBuffer data = GetParentView()->ReadBuffer(m_dbgInfoSeg.dataStart, m_dbgInfoSeg.length);
+		if (data.GetLength() != m_dbgInfoSeg.length)
+			return;
 
-	DataBuffer decompressed;
-	if (!data.LzmaDecompress(decompressed))
-		return;
+		if (!data.LzmaDecompress(fallback))
+			return;
+	}
 
-	m_logger->LogDebug("The size of decompressed buffer: 0x%zx", decompressed.GetLength());
+	m_logger->LogDebug("The size of decompressed buffer: 0x%zx", decompressed->GetLength());
 
 	Ref<FileMetadata> file = new FileMetadata;
-	Ref<BinaryView> view = new BinaryData(file, decompressed);
+	Ref<BinaryView> view = new BinaryData(file, *decompressed);
 	BinaryReader reader(view);
 
 	reader.Seek(0x1c);
@@ -1,4 +1,5 @@
 #include "binaryninjaapi.h"
+#include <mutex>
 
 namespace BinaryNinja
 {
@@ -43,6 +44,34 @@ namespace BinaryNinja
 		uint32_t uncompressedSize;
 	};
 
+	// A compressed segment that is mapped into the view up front but only decompressed when its bytes are first
+	// read, so opening a large image doesn't pay for the regions nobody looks at
+	class Md1romCompressedSection: public FileAccessor
+	{
+		Ref<BinaryView> m_data;
+		Ref<Logger> m_logger;
+		Md1romSegment m_segment;
+		uint64_t m_uncompressedSize;
+		std::once_flag m_decompressOnce;
+		DataBuffer m_decompressed;
+
+	public:
+		Md1romCompressedSection(BinaryView* data, Logger* logger, const Md1romSegment& segment,
+			uint64_t uncompressedSize);
+
+		// Whether the data of segment starts with an LZMA header that records the uncompressed size
+		static bool IsCompressed(BinaryView* data, const Md1romSegment& segment, uint64_t& uncompressedSize);
+
+		const Md1romSegment& GetSegment() const { return m_segment; }
+		// Decompress the segment the first time this is called, later calls return the same buffer
+		const DataBuffer& Materialize();
+
+		virtual bool IsValid() const override { return true; }
+		virtual uint64_t GetLength() const override { return m_uncompressedSize; }
+		virtual size_t Read(void* dest, uint64_t offset, size_t len) override;
+		virtual size_t Write(uint64_t, const void*, size_t) override { return 0; }
+	};
+
 	class Md1romView: public BinaryView
 	{
 		bool m_parseOnly;
@@ -62,6 +91,10 @@ namespace BinaryNinja
 		bool m_mainRomFound = false, m_dbgInfoFound = false, m_dbgDbFound = false;
 		Md1romSegment m_mainRom, m_dbgInfoSeg, m_dbgDatabaseSeg;
 
+		// The memory map reads these through their callbacks, so they live as long as the view
+		std::vector<std::shared_ptr<Md1romCompressedSection>> m_compressedSections;
+		std::shared_ptr<Md1romCompressedSection> m_dbgInfoSection;
+
 		SymbolQueue* m_symbolQueue = nullptr;
 
 		virtual uint64_t PerformGetEntryPoint() const override;
@@ -1,6 +1,7 @@
 use std::collections::HashMap;
 use std::ops::Range;
 
+use binaryninja::data_buffer::DataBuffer;
 use binaryninja::section::Section;
 use binaryninja::segment::Segment;
 use log::{debug, error, info, warn};
@@ -117,7 +118,7 @@ impl MinidumpBinaryView {
 
     fn init(&self) -> BinaryViewResult<()> {
         let parent_view = self.parent_view().ok_or(())?;
-        let read_buffer = parent_view.read_buffer(0, parent_view.len() as usize)?;
+        let read_buffer = MinidumpBinaryView::read_metadata(&parent_view)?;
 
         if let Ok(minidump_obj) = Minidump::read(read_buffer.get_data()) {
             // Architecture, platform information
@@ -148,29 +149,38 @@ impl MinidumpBinaryView {
             // Memory segments in a full memory dump (MinidumpMemory64List)
             // Grab the shared base RVA for all entries in the MinidumpMemory64List,
             // since the minidump crate doesn't expose this to us
+            // The descriptors are read straight from the raw stream as well, since the minidump crate
+            // would want the memory they describe, which `read_metadata` leaves out
             if let Ok(raw_stream) = minidump_obj.get_raw_stream(MinidumpMemory64List::STREAM_TYPE) {
-                if let Ok(base_rva_array) = raw_stream[8..16].try_into() {
-                    let base_rva = u64::from_le_bytes(base_rva_array);
+                if let Some(base_rva) = read_u64_le(raw_stream, 8) {
                     debug!("Found BaseRVA value {:#x}", base_rva);
 
-                    if let Ok(minidump_memory_list) =
-                        minidump_obj.get_stream::<MinidumpMemory64List>()
-                    {
-                        let mut current_rva = base_rva;
-                        for memory_segment in minidump_memory_list.iter() {
-                            debug!(
+                    let descriptor_count = read_u64_le(raw_stream, 0).unwrap_or(0);
+                    let mut current_rva = base_rva;
+                    for index in 0..descriptor_count as usize {
+                        let descriptor = 16 + index * 16;
+                        let (Some(base_address), Some(size)) = (
+                            read_u64_le(raw_stream, descriptor),
+                            read_u64_le(raw_stream, descriptor + 8),
+                        ) else {
+                            error!(
+                                "MinidumpMemory64List stream is truncated after {} of {} entries",
+                                index, descriptor_count
+                            );
+                            break;
+                        };
+                        debug!(
                             "Found memory segment at RVA {:#x} with virtual address {:#x} and size {:#x}",
                             current_rva,
-                            memory_segment.base_address,
-                            memory_segment.size,
+                            base_address,
+                            size,
                         );
-                            segment_data.push(SegmentData::from_addresses_and_size(
-                                current_rva,
-                                memory_segment.base_address,
-                                memory_segment.size,
-                            ));
-                            current_rva += memory_segment.size;
-                        }
+                        segment_data.push(SegmentData::from_addresses_and_size(
+                            current_rva,
+                            base_address,
+                            size,
+                        ));
+                        current_rva += size;
                     }
                 } else {
                     error!("Could not parse BaseRVA value shared by all entries in the MinidumpMemory64List stream")
@@ -291,6 +301,59 @@ impl MinidumpBinaryView {
         Ok(())
     }
 
+    /// Read everything in the dump except the memory of a full memory dump.
+    ///
+    /// The memory listed by a MinidumpMemory64List is stored contiguously from its BaseRVA to the end of
+    /// the file, after every other stream. Segments are backed by the parent view, so that memory is only
+    /// read when it is accessed, and there is no need to read multiple gigabytes up front just to parse the
+    /// streams. Dumps laid out any other way are read whole.
+    fn read_metadata(parent_view: &BinaryView) -> BinaryViewResult<DataBuffer> {
+        const STREAM_TYPE_MEMORY64_LIST: u32 = 9;
+
+        let file_len = parent_view.len();
+        let whole_file = || parent_view.read_buffer(0, file_len as usize);
+
+        let header = parent_view.read_vec(0, 16);
+        let (Some(stream_count), Some(directory_rva)) =
+            (read_u32_le(&header, 8), read_u32_le(&header, 12))
+        else {
+            return whole_file();
+        };
+        let directory_end = directory_rva as u64 + stream_count as u64 * 12;
+        if directory_end > file_len {
+            return whole_file();
+        }
+
+        let directory = parent_view.read_vec(directory_rva as u64, stream_count as usize * 12);
+        let mut memory_start = None;
+        let mut metadata_end = directory_end;
+        for entry in directory.chunks_exact(12) {
+            let (Some(stream_type), Some(data_size), Some(rva)) = (
+                read_u32_le(entry, 0),
+                read_u32_le(entry, 4),
+                read_u32_le(entry, 8),
+            ) else {
+                return whole_file();
+            };
+            metadata_end = metadata_end.max(rva as u64 + data_size as u64);
+            if stream_type == STREAM_TYPE_MEMORY64_LIST && data_size >= 16 {
+                memory_start = read_u64_le(&parent_view.read_vec(rva as u64 + 8, 8), 0);
+            }
+        }
+
+        match memory_start {
+            Some(memory_start) if memory_start >= metadata_end && memory_start <= file_len => {
+                debug!(
+                    "Reading {:#x} bytes of minidump metadata, leaving {:#x} bytes of memory in place",
+                    memory_start,
+                    file_len - memory_start
+                );
+                parent_view.read_buffer(0, memory_start as usize)
+            }
+            _ => whole_file(),
+        }
+    }
+
     fn translate_minidump_platform(
         minidump_cpu_arch: minidump::system_info::Cpu,
         minidump_endian: minidump::Endian,
@@ -400,3 +463,13 @@ unsafe impl CustomBinaryView for MinidumpBinaryView {
         MinidumpBinaryView::init(self)
     }
 }
+
+fn read_u32_le(bytes: &[u8], offset: usize) -> Option<u32> {
+    let slice = bytes.get(offset..offset.checked_add(4)?)?;
+    Some(u32::from_le_bytes(slice.try_into().ok()?))
+}
+
+fn read_u64_le(bytes: &[u8], offset: usize) -> Option<u64> {
+    let slice = bytes.get(offset..offset.checked_add(8)?)?;
+    Some(u64::from_le_bytes(slice.try_into().ok()?))
+}
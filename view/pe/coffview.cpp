@@ -66,8 +66,56 @@ COFFView::COFFView(BinaryView* data, bool parseOnly): BinaryView("COFF", data->G
 	m_logger = CreateLogger("BinaryView.COFFView");
 }
 
+// Decode the symbol record at data. The name is left as stored, only its long form fields are byte swapped.
+static COFFSymbol DecodeCOFFSymbol(const uint8_t* data, bool isBigCOFF)
+{
+	COFFSymbol symbol;
+	memset(&symbol, 0, sizeof(symbol));
+	memcpy(&symbol.name, data, sizeof(symbol.name));
+	symbol.name.longName.zeroes = ToLE32(symbol.name.longName.zeroes);
+	symbol.name.longName.offset = ToLE32(symbol.name.longName.offset);
+	data += sizeof(symbol.name);
+	memcpy(&symbol.value, data, sizeof(symbol.value));
+	symbol.value = ToLE32(symbol.value);
+	data += sizeof(symbol.value);
+	if (!isBigCOFF)
+	{
+		uint16_t sectionNumber;
+		memcpy(&sectionNumber, data, sizeof(sectionNumber));
+		symbol.sectionNumber.i16 = (int16_t)ToLE16(sectionNumber);
+		data += sizeof(sectionNumber);
+	}
+	else
+	{
+		uint32_t sectionNumber;
+		memcpy(&sectionNumber, data, sizeof(sectionNumber));
+		symbol.sectionNumber.i32 = (int32_t)ToLE32(sectionNumber);
+		data += sizeof(sectionNumber);
+	}
+	memcpy(&symbol.type, data, sizeof(symbol.type));
+	symbol.type = ToLE16(symbol.type);
+	data += sizeof(symbol.type);
+	symbol.storageClass = data[0];
+	symbol.numberOfAuxSymbols = data[1];
+	return symbol;
+}
+
+
+// A relocation whose symbol is kept until its section has been through the relocation handler
+struct PendingRelocation
+{
+	const string* symbolName;
+	uint32_t value;
+	int sectionIndex;
+	uint8_t storageClass;
+	uint64_t relocationOffset;
+};
+
+
 bool COFFView::Init()
 {
+	static InstrumentationHistogram histogram("view.coff.init");
+	InstrumentationScope scope(histogram);
 	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
 	map<string, size_t> usedSectionNames;
 
@@ -689,7 +737,11 @@ bool COFFView::Init()
 
 	// The offset of the symbol table after adjusting for the alignment of the sections that precede it
 	uint64_t symbolTableAdjustedOffset = 0;
+	// The symbol table is read once and kept for the relocations, which look their symbols up by index
+	ViewBuffer symbolTable;
+	vector<string> symbolStructNames;
 
+	BeginBulkModifySymbols();
 	try
 	{
 		// Process COFF symbol table
@@ -914,16 +966,29 @@ bool COFFView::Init()
 
 			DefineAutoSymbol(new Symbol(DataSymbol, "__strtab", m_imageBase + stringTableBase + 4, NoBinding));
 
+			// Symbol names are looked up straight out of one read of the string table
+			ViewBuffer stringTable = GetParentView()->MapBuffer(stringTableBaseRaw, stringTableSize);
+
+			// Large static library members have hundreds of thousands of records, so they are decoded from a
+			// single read of the table rather than seeking the reader for every field
+			symbolTable = GetParentView()->MapBuffer(header.coffSymbolTable, symbolTableSize);
+			symbolStructNames.resize(header.coffSymbolCount);
+
 			for (size_t i = 0; i < header.coffSymbolCount; i++)
 			{
-				reader.Seek(header.coffSymbolTable + (i * sizeofCOFFSymbol));
-				uint32_t e_zeroes = reader.Read32();
-				uint32_t e_offset = reader.Read32();
-				uint32_t e_value = reader.Read32();
-				uint32_t e_scnum = !isBigCOFF ? (uint32_t)reader.Read16() : reader.Read32();
-				uint16_t e_type = reader.Read16();
-				uint8_t e_sclass = reader.Read8();
-				uint8_t e_numaux = reader.Read8();
+				if ((i + 1) * sizeofCOFFSymbol > symbolTable.GetLength())
+					throw COFFFormatException("truncated COFF symbol table");
+
+				const uint8_t* record = symbolTable.GetDataAt(i * sizeofCOFFSymbol);
+				COFFSymbol coffSymbol = DecodeCOFFSymbol(record, isBigCOFF);
+				uint32_t e_zeroes = coffSymbol.name.longName.zeroes;
+				uint32_t e_offset = coffSymbol.name.longName.offset;
+				uint32_t e_value = coffSymbol.value;
+				uint32_t e_scnum = !isBigCOFF ? (uint32_t)(uint16_t)coffSymbol.sectionNumber.i16
+					: (uint32_t)coffSymbol.sectionNumber.i32;
+				uint16_t e_type = coffSymbol.type;
+				uint8_t e_sclass = coffSymbol.storageClass;
+				uint8_t e_numaux = coffSymbol.numberOfAuxSymbols;
 
 				uint64_t virtualAddress = 0;
 				switch (e_scnum)
@@ -942,9 +1007,13 @@ bool COFFView::Init()
 				string symbolName;
 				if (e_zeroes)
 				{
-					stringReader.Seek(header.coffSymbolTable + (i * sizeofCOFFSymbol));
-					symbolName = stringReader.ReadCString(8);
-					symbolName = symbolName.substr(0, strlen(symbolName.c_str()));
+					const char* name = (const char*)record;
+					symbolName = string(name, strnlen(name, sizeof(coffSymbol.name.shortName)));
+				}
+				else if (e_offset < stringTable.GetLength())
+				{
+					const char* name = (const char*)stringTable.GetDataAt(e_offset);
+					symbolName = string(name, strnlen(name, stringTable.GetLength() - e_offset));
 				}
 				else
 				{
@@ -1018,6 +1087,7 @@ bool COFFView::Init()
 				DefineDataVariable(m_imageBase + symbolVirtualAddress, Type::NamedType(this, coffSymbolTypeName));
 				string symbolStructName = "__symbol(" + symbolName + ")";
 				DefineAutoSymbol(new Symbol(DataSymbol, symbolStructName, m_imageBase + symbolVirtualAddress, NoBinding));
+				symbolStructNames[i] = symbolStructName;
 
 				if (e_zeroes == 0)
 				{
@@ -1088,6 +1158,7 @@ bool COFFView::Init()
 	{
 		m_logger->LogError("Failed to parse COFF symbol table: %s\n", e.what());
 	}
+	EndBulkModifySymbols();
 
 	// From elfview.cpp:
 	// Sometimes ELF will specify Thumb entry points w/o the bottom bit set
@@ -1111,6 +1182,7 @@ bool COFFView::Init()
 			AddEntryPointForAnalysis(platform, entryPoint);
 	}
 
+	BeginBulkModifySymbols();
 	try
 	{
 		if (sectionCount)
@@ -1221,6 +1293,8 @@ bool COFFView::Init()
 			QualifiedName coffRelocTypeName = DefineType(coffRelocTypeId, coffRelocName, coffRelocStructType);
 
 			auto relocHandler = m_arch->GetRelocationHandler("COFF");
+			Ref<Type> coffRelocType = Type::NamedType(this, coffRelocTypeName);
+			unordered_map<string, Ref<Symbol>> externSymbols;
 			BeginBulkAddSegments();
 
 			for (uint32_t i = 0; i < sectionCount; i++)
@@ -1234,18 +1308,25 @@ bool COFFView::Init()
 						i, section.relocCount, section.pointerToRawData, relocsFileOffset, relocsVirtualOffset, m_imageBase + relocsVirtualOffset));
 					AddAutoSegment(m_imageBase + relocsVirtualOffset, section.relocCount * sizeof(COFFRelocation), relocsFileOffset, section.relocCount * sizeof(COFFRelocation), SegmentReadable);
 
+					ViewBuffer relocTable = GetParentView()->MapBuffer(relocsFileOffset,
+						section.relocCount * sizeof(COFFRelocation));
+					if (relocTable.GetLength() < section.relocCount * sizeof(COFFRelocation))
+						throw COFFFormatException("truncated COFF relocation table");
+
+					vector<BNRelocationInfo> relocs;
+					vector<PendingRelocation> pending;
 					for (auto j = 0; j < section.relocCount; j++)
 					{
 						uint64_t relocationOffset = relocsVirtualOffset + j * sizeof(COFFRelocation);
-						uint64_t relocationFileOffset = relocsFileOffset + j * sizeof(COFFRelocation);
 
-						reader.Seek(relocationFileOffset);
-						auto virtualAddress = reader.Read32();
-						auto symbolTableIndex = reader.Read32();
-						auto relocType = reader.Read16();
+						const uint8_t* entry = relocTable.GetDataAt(j * sizeof(COFFRelocation));
+						COFFRelocation relocation;
+						memcpy(&relocation, entry, sizeof(relocation));
+						auto virtualAddress = ToLE32(relocation.virtualAddress);
+						auto symbolTableIndex = ToLE32(relocation.symbolTableIndex);
+						auto relocType = ToLE16(relocation.type);
 
-						Ref<Type> type = Type::NamedType(this, coffRelocTypeName);
-						DefineDataVariable(m_imageBase + relocationOffset, type);
+						DefineDataVariable(m_imageBase + relocationOffset, coffRelocType);
 
 						uint64_t itemAddress = section.virtualAddress + virtualAddress;
 
@@ -1258,28 +1339,17 @@ bool COFFView::Init()
 
 						DEBUG_COFF(AddUserDataReference(m_imageBase + relocationOffset, m_imageBase + symbolOffset));
 
-						const auto symbol = GetSymbolByAddress(m_imageBase + symbolOffset);
-						if (!symbol)
+						// Auxiliary records and indices past the table have no symbol
+						if (symbolTableIndex >= symbolStructNames.size() || symbolStructNames[symbolTableIndex].empty())
 						{
 							m_logger->LogWarn("COFF: skipping relocation at 0x%" PRIx64 " with invalid symbol address 0x%" PRIx64,
 								relocationOffset, m_imageBase + symbolOffset);
 							continue;
 						}
-						string symbolName = symbol->GetRawName();
+						const string& symbolName = symbolStructNames[symbolTableIndex];
 
-						auto valueOffset = !isBigCOFF ? offsetof(COFFSymbol16, value) : offsetof(COFFSymbol32, value);
-						auto valueFileOffset = header.coffSymbolTable + (symbolTableIndex * sizeofCOFFSymbol) + valueOffset;
-						reader.Seek(valueFileOffset);
-
-						COFFSymbol coffSymbol;
-						memset(&coffSymbol, 0, sizeof(coffSymbol));
-						coffSymbol.value = reader.Read32();
-						if (!isBigCOFF)
-							coffSymbol.sectionNumber.i16 = reader.Read16();
-						else
-							coffSymbol.sectionNumber.i32 = reader.Read32();
-						coffSymbol.type = reader.Read16();
-						coffSymbol.storageClass = reader.Read8();
+						COFFSymbol coffSymbol = DecodeCOFFSymbol(
+							symbolTable.GetDataAt(symbolTableIndex * sizeofCOFFSymbol), isBigCOFF);
 
 						DEBUG_COFF(AddUserDataReference(m_imageBase + itemAddress, m_imageBase + symbolOffset));
 						DEBUG_COFF(m_logger->LogDebug("COFF: CREATING RELOC SYMBOL REF from 0x%" PRIx64 " to 0x%" PRIx64 " for \"%s\"", m_imageBase + itemAddress, m_imageBase + symbolOffset, symbolName.c_str()));
@@ -1305,55 +1375,67 @@ bool COFFView::Init()
 						DEBUG_COFF(if (sectionIndex <= 0) m_logger->LogDebug("COFF: sectionIndex <= 0 (%d) at 0x%" PRIx64 " for symbol at 0x%" PRIx64, sectionIndex, m_imageBase + relocationOffset,  m_imageBase + symbolOffset));
 						if (coffSymbol.storageClass == IMAGE_SYM_CLASS_EXTERNAL || coffSymbol.storageClass == IMAGE_SYM_CLASS_STATIC)
 						{
-							vector<BNRelocationInfo> relocs;
 							relocs.push_back(reloc);
-							relocHandler->GetRelocationInfo(this, m_arch, relocs);
-							reloc = relocs[0];
-							if (sectionIndex > 0)
-							{
-								uint64_t relocTargetOffset = m_sections[reloc.sectionIndex].virtualAddress + coffSymbol.value;
+							pending.push_back({&symbolName, coffSymbol.value, sectionIndex, coffSymbol.storageClass,
+								relocationOffset});
+						}
+					}
 
-								DEBUG_COFF(m_logger->LogError("COFF: CREATING RELOC (%d) REF from 0x%" PRIx64 " to 0x%" PRIx64 " for %s", relocType, m_imageBase + itemAddress, m_imageBase + relocTargetOffset, symbolName.c_str()));
-								DEBUG_COFF(AddUserDataReference(m_imageBase + itemAddress, m_imageBase + relocTargetOffset));
+					// The whole section goes through the relocation handler at once
+					if (!relocs.empty())
+						relocHandler->GetRelocationInfo(this, m_arch, relocs);
 
-								DefineRelocation(m_arch, reloc, m_imageBase + relocTargetOffset, m_imageBase + reloc.address);
+					for (size_t j = 0; j < relocs.size(); j++)
+					{
+						BNRelocationInfo& reloc = relocs[j];
+						const PendingRelocation& relocation = pending[j];
+						const string& symbolName = *relocation.symbolName;
+						if (relocation.sectionIndex > 0)
+						{
+							uint64_t relocTargetOffset = m_sections[reloc.sectionIndex].virtualAddress + relocation.value;
 
-								DEBUG_COFF(AddUserDataReference(m_imageBase + relocTargetOffset, m_imageBase + itemAddress));
-								DEBUG_COFF(m_logger->LogError("COFF: DEFINED RELOCATION for 0x%" PRIx64 ":0x%" PRIx64 " to 0x%" PRIx64 " reloc type %#04x", reloc.base, reloc.address, m_imageBase + relocTargetOffset, reloc.nativeType));
-							}
-							else if (coffSymbol.storageClass == IMAGE_SYM_CLASS_EXTERNAL)
+							DEBUG_COFF(m_logger->LogError("COFF: CREATING RELOC (%d) REF from 0x%" PRIx64 " to 0x%" PRIx64 " for %s", reloc.nativeType, m_imageBase + reloc.address, m_imageBase + relocTargetOffset, symbolName.c_str()));
+							DEBUG_COFF(AddUserDataReference(m_imageBase + reloc.address, m_imageBase + relocTargetOffset));
+
+							DefineRelocation(m_arch, reloc, m_imageBase + relocTargetOffset, m_imageBase + reloc.address);
+
+							DEBUG_COFF(AddUserDataReference(m_imageBase + relocTargetOffset, m_imageBase + reloc.address));
+							DEBUG_COFF(m_logger->LogError("COFF: DEFINED RELOCATION for 0x%" PRIx64 ":0x%" PRIx64 " to 0x%" PRIx64 " reloc type %#04x", reloc.base, reloc.address, m_imageBase + relocTargetOffset, reloc.nativeType));
+						}
+						else if (relocation.storageClass == IMAGE_SYM_CLASS_EXTERNAL)
+						{
+							DEBUG_COFF(m_logger->LogDebug("COFF: EXTERNAL RELOCATION for 0x%" PRIx64 ":0x%" PRIx64 " reloc type %#04x", reloc.base, reloc.address, reloc.nativeType));
+							reloc.external = true;
+							reloc.size = m_is64 ? 8 : 4;
+
+							// Objects reference the same imports from many places, only search for each one once
+							auto target = externSymbols.find(symbolName);
+							if (target == externSymbols.end())
 							{
-								DEBUG_COFF(m_logger->LogDebug("COFF: EXTERNAL RELOCATION for 0x%" PRIx64 ":0x%" PRIx64 " reloc type %#04x", reloc.base, reloc.address, reloc.nativeType));
-								reloc.external = true;
 								Ref<Symbol> targetSymbol;
-								reloc.size = m_is64 ? 8 : 4;
-								for (const auto& symbol : GetSymbols(m_imageBase + symbolOffset, reloc.size))
+								string externName = symbolName.substr(strlen("__symbol("));
+								externName = externName.substr(0, externName.size() - 1);
+								for (const auto& externSymbol : GetSymbolsByName(externName))
 								{
-									string name = symbol->GetRawName();
-									if (name.find("__symbol(") == 0 && name.back() == ')')
+									auto type = externSymbol->GetType();
+									if (type == ExternalSymbol || type == ImportedFunctionSymbol || type == ImportedDataSymbol || type == ImportAddressSymbol)
 									{
-										string symbolName = name.substr(strlen("__symbol("));
-										symbolName = symbolName.substr(0, symbolName.size() - 1);
-										for (const auto& externSymbol : GetSymbolsByName(symbolName))
-										{
-											auto type = externSymbol->GetType();
-											if (type == ExternalSymbol || type == ImportedFunctionSymbol || type == ImportedDataSymbol || type == ImportAddressSymbol)
-											{
-												targetSymbol = externSymbol;
-												DefineRelocation(m_arch, reloc, targetSymbol, m_imageBase + reloc.address);
-												DEBUG_COFF(m_logger->LogDebug("COFF: created external relocation at %#" PRIx64 " for %#" PRIx64 ": %s", m_imageBase + relocationOffset, m_imageBase + reloc.address, name.c_str()));
-												break;
-											}
-										}
-									}
-									if (targetSymbol)
+										targetSymbol = externSymbol;
 										break;
+									}
 								}
-								if (! targetSymbol)
-								{
-									// TODO: determine whether this is actually worth logging -- may only be happening for NB (non-based) relocations?
-									m_logger->LogError("COFF: no defined external symbol found for relocation at %#" PRIx64 " for symbol %s", m_imageBase + relocationOffset, symbolName.c_str());
-								}
+								target = externSymbols.emplace(symbolName, targetSymbol).first;
+							}
+
+							if (target->second)
+							{
+								DefineRelocation(m_arch, reloc, target->second, m_imageBase + reloc.address);
+								DEBUG_COFF(m_logger->LogDebug("COFF: created external relocation at %#" PRIx64 " for %#" PRIx64 ": %s", m_imageBase + relocation.relocationOffset, m_imageBase + reloc.address, symbolName.c_str()));
+							}
+							else
+							{
+								// TODO: determine whether this is actually worth logging -- may only be happening for NB (non-based) relocations?
+								m_logger->LogError("COFF: no defined external symbol found for relocation at %#" PRIx64 " for symbol %s", m_imageBase + relocation.relocationOffset, symbolName.c_str());
 							}
 						}
 					}
@@ -1367,6 +1449,7 @@ bool COFFView::Init()
 	{
 		m_logger->LogError("Failed to parse COFF relocations: %s\n", e.what());
 	}
+	EndBulkModifySymbols();
 
 	// Add a symbol for the entry point
 	// if (entryPointAddress)
@@ -1532,8 +1615,7 @@ void COFFView::AddCOFFSymbol(BNSymbolType type, const string& dll, const string&
 	{
 		QualifiedName demangledName;
 		Ref<Type> demangledType;
-		bool simplify = Settings::Instance()->Get<bool>("analysis.types.templateSimplifier", this);
-		if (DemangleGeneric(m_arch, rawName, demangledType, demangledName, this, simplify))
+		if (DemangleGeneric(m_arch, rawName, demangledType, demangledName, this, m_simplifyTemplates))
 		{
 			shortName = demangledName.GetString();
 			fullName = shortName;
@@ -8,6 +8,7 @@
 #include <mutex>
 #include <sstream>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include "peview.h"
 #include "coffview.h"
@@ -18,6 +19,47 @@
 using namespace BinaryNinja;
 using namespace std;
 
+using PEOrdinalNames = unordered_map<uint16_t, string>;
+
+
+// Ordinal export names from a system DLL's type library. These are parsed once per type library and
+// shared between every view that imports from it; a rebuilt DLL ships in a type library with a new GUID.
+static shared_ptr<const PEOrdinalNames> GetTypeLibraryOrdinals(Ref<TypeLibrary> typeLib)
+{
+	static mutex cacheMutex;
+	static unordered_map<string, shared_ptr<const PEOrdinalNames>> cache;
+
+	string key = typeLib->GetGuid() + ":" + typeLib->GetName();
+	{
+		lock_guard<mutex> lock(cacheMutex);
+		auto it = cache.find(key);
+		if (it != cache.end())
+			return it->second;
+	}
+
+	Ref<Metadata> ordinals = typeLib->QueryMetadata("ordinals");
+	if (ordinals && ordinals->IsString())
+		ordinals = typeLib->QueryMetadata(ordinals->GetString());
+
+	shared_ptr<PEOrdinalNames> result;
+	if (ordinals && ordinals->IsKeyValueStore())
+	{
+		result = make_shared<PEOrdinalNames>();
+		for (const auto& [ordString, ordInfo] : ordinals->GetKeyValueStore())
+		{
+			if (!ordInfo || !ordInfo->IsString())
+				continue;
+			unsigned long ordinal = strtoul(ordString.c_str(), nullptr, 10);
+			if ((ordinal > 0xffff) || (to_string(ordinal) != ordString))
+				continue;
+			(*result)[(uint16_t)ordinal] = ordInfo->GetString();
+		}
+	}
+
+	lock_guard<mutex> lock(cacheMutex);
+	return cache.emplace(key, result).first->second;
+}
+
 
 static PEViewType* g_peViewType = nullptr;
 static const char* imageDirName[] = { "exportTable", "importTable", "resourceTable", "exceptionTable", "certificateTable", "baseRelocationTable", "debug", "architecture", "globalPtr", "tlsTable", "loadConfigTable", "boundImport", "iat", "delayImportDescriptor", "clrRuntimeHeader", "reserved"};
@@ -402,6 +444,8 @@ PEView::PEView(BinaryView* data, bool parseOnly) : BinaryView("PE", data->GetFil
 
 bool PEView::Init()
 {
+	static InstrumentationHistogram histogram("view.pe.init");
+	InstrumentationScope scope(histogram);
 	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
 	map<string, size_t> usedSectionNames;
 
@@ -419,20 +463,6 @@ bool PEView::Init()
 		reader.Seek(0x3c);
 		uint32_t peOfs = reader.Read32();
 
-		// Read Rich header
-		vector<pair<uint32_t, uint32_t>> richValues;
-		const uint32_t richHeaderBase = 0x80;
-		if (peOfs > richHeaderBase)
-		{
-			reader.Seek(richHeaderBase);
-			for (uint32_t i = 0; i < ((peOfs - richHeaderBase) / 8); i++)
-			{
-				uint32_t var1 = reader.Read32();
-				uint32_t var2 = reader.Read32();
-				richValues.push_back({var1, var2});
-			}
-		}
-
 		// Read PE header
 		reader.Seek(peOfs);
 		header.magic = reader.Read32();
@@ -600,6 +630,9 @@ bool PEView::Init()
 		settings = GetLoadSettings(GetTypeName());
 		if (settings)
 		{
+			if (settings->Contains("loader.pe.deferInformationalHeaders"))
+				m_deferInformationalParsing = settings->Get<bool>("loader.pe.deferInformationalHeaders", this);
+
 			if (settings->Contains("loader.imageBase"))
 				m_imageBase = settings->Get<uint64_t>("loader.imageBase", this);
 
@@ -950,78 +983,15 @@ bool PEView::Init()
 		DefineDataVariable(m_imageBase + 0x40, Type::VoidType());
 		DefineAutoSymbol(new Symbol(DataSymbol, "__dos_stub", m_imageBase + 0x40, NoBinding));
 
-		// Create Rich Header Type
-		// TODO move decoded rich info to comments once comments work with linear view
-		if (richValues.size() >= 4)
+		// The Rich header is informational only, so it can be decoded off the load path
+		if (m_deferInformationalParsing)
 		{
-			bool validRichHeader = false;
-			uint32_t xorKey = richValues[0].second;
-			uint32_t entryIdx;
-			vector<uint64_t> richMetadataLookupIdentifiers;
-			vector<string> richMetadataLookupNames;
-			for (const auto& [id, name] : ProductMap)
-			{
-				richMetadataLookupIdentifiers.push_back(id);
-				richMetadataLookupNames.push_back(name);
-			}
-			StoreMetadata("RichHeaderLookupIdentifiers", new Metadata(richMetadataLookupIdentifiers), true);
-			StoreMetadata("RichHeaderLookupNames", new Metadata(richMetadataLookupNames), true);
-
-			vector<Ref<Metadata>> richMetadata;
-			for (entryIdx = 0; entryIdx < richValues.size(); entryIdx++)
-			{
-				if ((richValues[entryIdx].first == 0x68636952) && (richValues[entryIdx].second == xorKey))
-				{
-					validRichHeader = true;
-					break;
-				}
-
-				richValues[entryIdx].first ^= xorKey;
-				richValues[entryIdx].second ^= xorKey;
-				if (entryIdx > 1) // Skip the first 2 entries as they don't contain interesting information
-				{
-					map<string, Ref<Metadata>> entryMetadata = {
-						{string("ObjectTypeValue"), new Metadata((uint64_t)richValues[entryIdx].first >> 16)},
-						{string("ObjectTypeName"), new Metadata(GetRichObjectType(richValues[entryIdx].first >> 16))},
-						{string("ObjectVersionValue"), new Metadata((uint64_t)richValues[entryIdx].first & 0xffff)},
-						{string("ObjectVersionName"), new Metadata(GetRichProductName(richValues[entryIdx].first & 0xffff))},
-						{string("ObjectCount"), new Metadata((uint64_t)richValues[entryIdx].second)}
-						};
-					richMetadata.push_back(new Metadata(entryMetadata));
-				}
-				if (!entryIdx && richValues[entryIdx].first != 0x536e6144)
-					break;
-			}
-
-			if (validRichHeader)
-			{
-				StoreMetadata("RichHeader", new Metadata(richMetadata), true);
-				StructureBuilder richHeaderBuilder;
-				richHeaderBuilder.AddMember(Type::IntegerType(4, false), "e_magic__DanS");
-				richHeaderBuilder.AddMember(Type::ArrayType(Type::IntegerType(4, false), 3), "e_align");
-
-				for (uint32_t i = 2; i < entryIdx; i++)
-				{
-					stringstream ss;
-					ss << "e_entry_id" << std::dec << i-2 << "__" << std::hex << std::setw(8) << std::setfill('0') << richValues[i].first;
-					richHeaderBuilder.AddMember(Type::IntegerType(4, false), ss.str());
-					ss.str("");
-					ss.clear();
-					ss << "e_entry_count" << std::dec << i-2 << "__" << richValues[i].second;
-					richHeaderBuilder.AddMember(Type::IntegerType(4, false), ss.str());
-				}
-
-				richHeaderBuilder.AddMember(Type::ArrayType(Type::IntegerType(1, true), 4), "e_magic");
-				richHeaderBuilder.AddMember(Type::IntegerType(4, false), "e_checksum");
-
-				Ref<Structure> richHeaderStruct = richHeaderBuilder.Finalize();
-				Ref<Type> richHeaderType = Type::StructureType(richHeaderStruct);
-				QualifiedName richHeaderName = string("Rich_Header");
-				string richHeaderTypeId = Type::GenerateAutoTypeId("pe", richHeaderName);
-				QualifiedName richHeaderTypeName = DefineType(richHeaderTypeId, richHeaderName, richHeaderType);
-				DefineDataVariable(m_imageBase + richHeaderBase, Type::NamedType(this, richHeaderTypeName));
-				DefineAutoSymbol(new Symbol(DataSymbol, "__rich_header", m_imageBase + richHeaderBase, NoBinding));
-			}
+			Ref<PEView> self = this;
+			WorkerEnqueue([self, peOfs]() { self->ParseRichHeader(peOfs); }, "PE Rich Header");
+		}
+		else
+		{
+			ParseRichHeader(peOfs);
 		}
 
 		// Create COFF Header Type
@@ -1415,6 +1385,8 @@ bool PEView::Init()
 		m_logger->LogError("Failed to parse COFF symbol table: %s\n", e.what());
 	}
 
+	// Import directory structure symbols are plain data symbols, collect them and define them in one batch
+	vector<SymbolSpec> importDataSymbols;
 	try
 	{
 		PEDataDirectory dir;
@@ -1479,20 +1451,13 @@ bool PEView::Init()
 						typeLib->GetName().c_str(), typeLib->GetGuid().c_str());
 				}
 
-				Ref<Metadata> ordinals;
+				shared_ptr<const PEOrdinalNames> ordinals;
 				if (typeLibs.size())
 				{
 					for (const auto& typeLib : typeLibs)
 					{
-						char ordinal_subsystem[64];
-						snprintf(ordinal_subsystem, sizeof(ordinal_subsystem), "ordinals_%hu_%hu", opt.majorOSVersion, opt.minorOSVersion);
-						ordinals = typeLib->QueryMetadata("ordinals");
+						ordinals = GetTypeLibraryOrdinals(typeLib);
 						libraryFound.push_back(new Metadata(string(typeLib->GetName())));
-						if (ordinals && ordinals->IsString())
-							ordinals = typeLib->QueryMetadata(ordinals->GetString());
-
-						if (ordinals && !ordinals->IsKeyValueStore())
-							ordinals = nullptr;
 					}
 				}
 				else
@@ -1508,7 +1473,7 @@ bool PEView::Init()
 
 				// Create Import DLL Name Type
 				DefineDataVariable(m_imageBase + importDirEntry.nameAddress, Type::ArrayType(Type::IntegerType(1, true), importDirEntry.name.size() + 1));
-				DefineAutoSymbol(new Symbol(DataSymbol, "__import_dll_name(" + dllName + ")", m_imageBase + importDirEntry.nameAddress, NoBinding));
+				importDataSymbols.push_back({DataSymbol, "__import_dll_name(" + dllName + ")", m_imageBase + importDirEntry.nameAddress, NoBinding});
 
 				// Parse list of imported functions
 				uint32_t entryOffset = importDirEntry.lookup;
@@ -1549,14 +1514,8 @@ bool PEView::Init()
 					if (isOrdinal)
 					{
 						ordinal = (uint16_t)entry;
-						string ordString = to_string(ordinal);
-						Ref<Metadata> ordInfo = nullptr;
-
-						if (ordinals)
-							ordInfo = ordinals->Get(ordString);
-
-						if (ordInfo && ordInfo->IsString())
-							func = ordInfo->GetString();
+						if (ordinals && ordinals->count(ordinal))
+							func = ordinals->at(ordinal);
 						else
 							func = "Ordinal_" + dllName + "_" + to_string((int)entry);
 					}
@@ -1565,10 +1524,10 @@ bool PEView::Init()
 						ordinal = Read16(entry);
 						func = ReadString(entry + 2);
 						DefineDataVariable(m_imageBase + entry, Type::IntegerType(2, false));
-						DefineAutoSymbol(new Symbol(DataSymbol, "__export_name_ptr_table_" + to_string(numImportEntries) + "(" + dllName + ":" + func + ")", m_imageBase + entry, NoBinding));
+						importDataSymbols.push_back({DataSymbol, "__export_name_ptr_table_" + to_string(numImportEntries) + "(" + dllName + ":" + func + ")", m_imageBase + entry, NoBinding});
 						DefineDataVariable(m_imageBase + entry + 2, Type::ArrayType(Type::IntegerType(1, true), func.size() + 1));
-						DefineAutoSymbol(new Symbol(DataSymbol, "__import_name_" + to_string(numImportEntries) + "(" + dllName + ":" + func + ")", m_imageBase + entry + 2, NoBinding));
-						DefineAutoSymbol(new Symbol(DataSymbol, "__import_lookup_table_" + to_string(numImportEntries) + "(" + dllName + ":" + func + ")", m_imageBase + entryOffset, NoBinding));
+						importDataSymbols.push_back({DataSymbol, "__import_name_" + to_string(numImportEntries) + "(" + dllName + ":" + func + ")", m_imageBase + entry + 2, NoBinding});
+						importDataSymbols.push_back({DataSymbol, "__import_lookup_table_" + to_string(numImportEntries) + "(" + dllName + ":" + func + ")", m_imageBase + entryOffset, NoBinding});
 					}
 					m_logger->LogDebug("FuncString: %s\n", func.c_str());
 					AddPESymbol(ImportAddressSymbol, dllName, func, iatOffset, NoBinding, ordinal, typeLibs);
@@ -1619,6 +1578,7 @@ bool PEView::Init()
 	{
 		m_logger->LogWarn("Failed to parse import directory: %s\n", e.what());
 	}
+	DefineAutoSymbols(importDataSymbols);
 
 	try
 	{
@@ -1671,11 +1631,14 @@ bool PEView::Init()
 			QualifiedName exceptionEntryName = string("Exception_Directory_Entry");
 			string exceptionEntryTypeId = Type::GenerateAutoTypeId("pe", exceptionEntryName);
 			QualifiedName exceptionEntryTypeName = DefineType(exceptionEntryTypeId, exceptionEntryName, exceptionEntryType);
+			vector<SymbolSpec> exceptionEntrySymbols;
+			exceptionEntrySymbols.reserve(numExceptionEntries);
 			for (size_t i = 0; i < numExceptionEntries; i++)
 			{
 				DefineDataVariable(m_imageBase + m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXCEPTION].virtualAddress + (entrySize * i), Type::NamedType(this, exceptionEntryTypeName));
-				DefineAutoSymbol(new Symbol(DataSymbol, "__exception_directory_entries(" + string(std::to_string(i)) + ")", m_imageBase + m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXCEPTION].virtualAddress + (entrySize * i), NoBinding));
+				exceptionEntrySymbols.push_back({DataSymbol, "__exception_directory_entries(" + string(std::to_string(i)) + ")", m_imageBase + m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXCEPTION].virtualAddress + (entrySize * i), NoBinding});
 			}
+			DefineAutoSymbols(exceptionEntrySymbols);
 
 			// parse exception table and add functions
 			bool processExceptionTable = true;
@@ -1695,18 +1658,21 @@ bool PEView::Init()
 				string unwindInfoTypeId = Type::GenerateAutoTypeId("pe", unwindInfoName);
 				QualifiedName unwindInfo = DefineType(unwindInfoTypeId, unwindInfoName, unwindInfoStructType);
 
+				// Every entry starts with BeginAddress; AMD64 and IA64 entries follow it with EndAddress and the
+				// unwind information RVA. Decode the whole table from one read.
+				vector<uint32_t> exceptionWords = Read32Table(m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXCEPTION].virtualAddress,
+					(numExceptionEntries * entrySize) / sizeof(uint32_t));
+				size_t wordsPerEntry = entrySize / sizeof(uint32_t);
 				BinaryReader unwindReader(GetParentView(), LittleEndian);
 				for (size_t i = 0; i < numExceptionEntries; i++)
 				{
-					reader.Seek(RVAToFileOffset(m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXCEPTION].virtualAddress + (i * entrySize)));
-					uint32_t beginAddress = reader.Read32();
+					uint32_t beginAddress = exceptionWords[i * wordsPerEntry];
 					switch (header.machine)
 					{
 						case IMAGE_FILE_MACHINE_AMD64:
 						case IMAGE_FILE_MACHINE_IA64:
 						{
-							reader.SeekRelative(4);  // EndAddress
-							uint32_t unwindRva = reader.Read32();
+							uint32_t unwindRva = exceptionWords[(i * wordsPerEntry) + 2];
 							DefineDataVariable(m_imageBase + unwindRva, Type::NamedType(this, unwindInfo));
 							unwindReader.Seek(RVAToFileOffset(unwindRva));
 							uint32_t unwindInformation = unwindReader.Read32();
@@ -1735,141 +1701,49 @@ bool PEView::Init()
 						default:
 							break;
 					}
-					uint64_t exceptionEntry = m_imageBase + beginAddress;
-					Ref<Platform> targetPlatform = platform->GetAssociatedPlatformByAddress(exceptionEntry);
-					AddFunctionForAnalysis(targetPlatform, exceptionEntry);
+					m_exceptionFunctionStarts.push_back(beginAddress);
 				}
-			}
-		}
-	}
-	catch (std::exception& e)
-	{
-		m_logger->LogWarn("Failed to parse exception directory: %s\n", e.what());
-	}
 
-	try
-	{
-		if (m_dataDirs.size() > IMAGE_DIRECTORY_ENTRY_DEBUG)
-		{
-			PEDataDirectory dir = m_dataDirs[IMAGE_DIRECTORY_ENTRY_DEBUG];
-			if (dir.size >= sizeof(DebugDirectory))
-			{
+				sort(m_exceptionFunctionStarts.begin(), m_exceptionFunctionStarts.end());
+				m_exceptionFunctionStarts.erase(unique(m_exceptionFunctionStarts.begin(), m_exceptionFunctionStarts.end()),
+					m_exceptionFunctionStarts.end());
 
-				m_logger->LogDebug("Parsing IMAGE_DIRECTORY_ENTRY_DEBUG: %08x", dir.size);
-				for (uint32_t i = 0; i < dir.size / sizeof(DebugDirectory); i++)
+				uint64_t batchSize = 0;
+				if (settings && settings->Contains("loader.pe.exceptionTableBatchSize"))
+					batchSize = settings->Get<uint64_t>("loader.pe.exceptionTableBatchSize", this);
+				if (batchSize)
 				{
-					reader.Seek(RVAToFileOffset(dir.virtualAddress + i * sizeof(DebugDirectory)));
-					DebugDirectory debugDir;
-					reader.Read(&debugDir, sizeof(DebugDirectory));
-
-					m_logger->LogDebug(
-						"DebugDirectory:\n"
-						"\tcharacteristics:  %08x\n"
-						"\ttimeDateStamp:    %08x\n"
-						"\tmajorVersion:     %08x\n"
-						"\tminorVersion:     %08x\n"
-						"\ttype:             %08x\n"
-						"\tsizeOfData:       %08x\n"
-						"\taddressOfRawData: %08x\n"
-						"\tpointerToRawData: %08x\n",
-						debugDir.characteristics,
-						debugDir.timeDateStamp,
-						debugDir.majorVersion,
-						debugDir.minorVersion,
-						debugDir.type,
-						debugDir.sizeOfData,
-						RVAToFileOffset(debugDir.addressOfRawData, false),
-						debugDir.pointerToRawData
-					);
-
-					if (!debugDir.addressOfRawData)
-						continue;
-
-					if (debugDir.type == IMAGE_DEBUG_TYPE_CODEVIEW)  // PDB Information
-					{
-						auto type = TypeBuilder::IntegerType(4, false);
-						type.SetIntegerTypeDisplayType(CharacterConstantDisplayType);
-						DefineDataVariable(m_imageBase + debugDir.addressOfRawData, type.Finalize());
-						DefineAutoSymbol(new Symbol(DataSymbol, "debugInfoType", m_imageBase + debugDir.addressOfRawData, NoBinding));
-
-
-						reader.Seek(RVAToFileOffset(debugDir.addressOfRawData));
-						uint32_t signature = reader.Read32();
-						StoreMetadata("DEBUG_INFO_TYPE", new Metadata((uint64_t)signature), true);
-						if (signature == 0x53445352) // SDSR
-						{
-							vector<uint8_t> guid(16);
-							reader.Read(&guid[0], 16);
-							uint32_t age = reader.Read32();
-							StoreMetadata("PDB_GUID", new Metadata(guid), true);
-							StoreMetadata("PDB_AGE", new Metadata((uint64_t)age), true);
-							string pdbFileName = reader.ReadCString();
-							StoreMetadata("PDB_FILENAME", new Metadata(pdbFileName), true);
-							m_logger->LogInfo("PDBFileName: %s\n", pdbFileName.c_str());
-
-							DefineDataVariable(m_imageBase + debugDir.addressOfRawData + 4, Type::ArrayType(Type::IntegerType(1, false), 16));
-							DefineAutoSymbol(new Symbol(DataSymbol, "PDBGuid", m_imageBase + debugDir.addressOfRawData + 4, NoBinding));
-							DefineDataVariable(m_imageBase + debugDir.addressOfRawData + 20, Type::IntegerType(4, false));
-							DefineAutoSymbol(new Symbol(DataSymbol, "PDBAge", m_imageBase + debugDir.addressOfRawData + 20, NoBinding));
-							DefineDataVariable(m_imageBase + debugDir.addressOfRawData + 24, Type::ArrayType(Type::IntegerType(1, true), pdbFileName.size() + 1));
-							DefineAutoSymbol(new Symbol(DataSymbol, "PDBFileName", m_imageBase + debugDir.addressOfRawData + 24, NoBinding));
-						}
-					}
-					else if (debugDir.type == IMAGE_DEBUG_TYPE_RESERVED10)
-					{
-						DefineDataVariable(m_imageBase + debugDir.addressOfRawData, Type::IntegerType(4, false));
-						DefineAutoSymbol(new Symbol(DataSymbol, "debugTypeReserved", m_imageBase + debugDir.addressOfRawData, NoBinding));
-					}
-					else
+					// Feed these to analysis after the entry point and exports, see AddExceptionFunctionStarts
+					m_exceptionFunctionBatchSize = batchSize;
+				}
+				else
+				{
+					for (uint32_t start : m_exceptionFunctionStarts)
 					{
-						DefineDataVariable(m_imageBase + debugDir.addressOfRawData, Type::ArrayType(Type::IntegerType(1, false), debugDir.sizeOfData));
-						string name = GetDebugTypeName(debugDir.type);
-						DefineAutoSymbol(new Symbol(DataSymbol, name, m_imageBase + debugDir.addressOfRawData, NoBinding));
+						uint64_t exceptionEntry = m_imageBase + start;
+						Ref<Platform> targetPlatform = platform->GetAssociatedPlatformByAddress(exceptionEntry);
+						AddFunctionForAnalysis(targetPlatform, exceptionEntry);
 					}
+					m_exceptionFunctionStarts.clear();
 				}
-
-				// Create Debug Directory Type
-				StructureBuilder debugDirBuilder;
-				debugDirBuilder.AddMember(Type::IntegerType(4, false), "characteristics");
-				debugDirBuilder.AddMember(Type::IntegerType(4, false), "timeDateStamp");
-				debugDirBuilder.AddMember(Type::IntegerType(2, false), "majorVersion");
-				debugDirBuilder.AddMember(Type::IntegerType(2, false), "minorVersion");
-				EnumerationBuilder debugType;
-				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_UNKNOWN", IMAGE_DEBUG_TYPE_UNKNOWN);
-				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_COFF", IMAGE_DEBUG_TYPE_COFF);
-				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_CODEVIEW", IMAGE_DEBUG_TYPE_CODEVIEW);
-				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_FPO", IMAGE_DEBUG_TYPE_FPO);
-				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_MISC", IMAGE_DEBUG_TYPE_MISC);
-				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_EXCEPTION", IMAGE_DEBUG_TYPE_EXCEPTION);
-				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_FIXUP", IMAGE_DEBUG_TYPE_FIXUP);
-				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_OMAP_TO_SRC", IMAGE_DEBUG_TYPE_OMAP_TO_SRC);
-				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_OMAP_FROM_SRC", IMAGE_DEBUG_TYPE_OMAP_FROM_SRC);
-				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_BORLAND", IMAGE_DEBUG_TYPE_BORLAND);
-				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_RESERVED10", IMAGE_DEBUG_TYPE_RESERVED10);
-				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_CLSID", IMAGE_DEBUG_TYPE_CLSID);
-				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_VC_FEATURE", IMAGE_DEBUG_TYPE_VC_FEATURE);
-				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_POGO", IMAGE_DEBUG_TYPE_POGO);
-				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_ILTCG", IMAGE_DEBUG_TYPE_ILTCG);
-				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_MPX", IMAGE_DEBUG_TYPE_MPX);
-				debugDirBuilder.AddMember(Type::EnumerationType(debugType.Finalize(), 4), "type");
-				debugDirBuilder.AddMember(Type::IntegerType(4, false), "sizeOfData");
-				debugDirBuilder.AddMember(Type::IntegerType(4, false), "addressOfRawData");
-				debugDirBuilder.AddMember(Type::IntegerType(4, false), "pointerToRawData");
-
-				size_t numDebugEntries = dir.size / 24;
-				Ref<Structure> debugDirStruct = debugDirBuilder.Finalize();
-				Ref<Type> debugDirType = Type::StructureType(debugDirStruct);
-				QualifiedName debugDirName = string("Debug_Directory_Table");
-				string debugDirTypeId = Type::GenerateAutoTypeId("pe", debugDirName);
-				QualifiedName debugDirTypeName = DefineType(debugDirTypeId, debugDirName, debugDirType);
-				DefineDataVariable(m_imageBase + m_dataDirs[IMAGE_DIRECTORY_ENTRY_DEBUG].virtualAddress, Type::ArrayType(Type::NamedType(this, debugDirTypeName), numDebugEntries));
-				DefineAutoSymbol(new Symbol(DataSymbol, "__debug_directory_entries", m_imageBase + m_dataDirs[IMAGE_DIRECTORY_ENTRY_DEBUG].virtualAddress, NoBinding));
 			}
 		}
 	}
 	catch (std::exception& e)
 	{
-		m_logger->LogWarn("Failed to parse debug directory: %s\n", e.what());
+		m_logger->LogWarn("Failed to parse exception directory: %s\n", e.what());
+	}
+
+	if (m_deferInformationalParsing)
+	{
+		// Build the RVA index now so the background job never rebuilds it concurrently with Init
+		BuildSectionIndex();
+		Ref<PEView> self = this;
+		WorkerEnqueue([self]() { self->ParseDebugDirectory(); }, "PE Debug Directory");
+	}
+	else
+	{
+		ParseDebugDirectory();
 	}
 
 	try
@@ -2056,11 +1930,9 @@ bool PEView::Init()
 						typeLib->GetName().c_str(), typeLib->GetGuid().c_str());
 				}
 
-				Ref<Metadata> ordinals;
+				shared_ptr<const PEOrdinalNames> ordinals;
 				for (const auto& typeLib : typeLibs)
-					ordinals = typeLib->QueryMetadata("ordinals");
-				if (ordinals && !ordinals->IsKeyValueStore())
-					ordinals = nullptr;
+					ordinals = GetTypeLibraryOrdinals(typeLib);
 
 				size_t dotPos = entryName.rfind('.');
 				string dllName;
@@ -2107,14 +1979,8 @@ bool PEView::Init()
 					if (isOrdinal)
 					{
 						ordinal = (uint16_t)entry;
-						string ordString = to_string(ordinal);
-						Ref<Metadata> ordInfo = nullptr;
-
-						if (ordinals)
-							ordInfo = ordinals->Get(ordString);
-
-						if (ordInfo && ordInfo->IsString())
-							func = ordInfo->GetString();
+						if (ordinals && ordinals->count(ordinal))
+							func = ordinals->at(ordinal);
 						else
 							func = "Ordinal_" + dllName + "_" + to_string((int)entry);
 					}
@@ -2480,11 +2346,7 @@ bool PEView::Init()
 			DefineDataVariable(m_imageBase + dir.addressOfFunctions, Type::ArrayType(Type::IntegerType(4, false), dir.functionCount));
 			DefineAutoSymbol(new Symbol(DataSymbol, tableName, m_imageBase + dir.addressOfFunctions, NoBinding));
 
-			vector<uint32_t> funcs;
-			reader.Seek(RVAToFileOffset(dir.addressOfFunctions));
-			funcs.reserve(dir.functionCount);
-			for (uint32_t i = 0; i < dir.functionCount; i++)
-				funcs.push_back(reader.Read32());
+			vector<uint32_t> funcs = Read32Table(dir.addressOfFunctions, dir.functionCount);
 
 			vector<uint32_t> nameAddrs;
 			if (dir.addressOfNames != 0)
@@ -2493,10 +2355,7 @@ bool PEView::Init()
 				DefineDataVariable(m_imageBase + dir.addressOfNames, Type::ArrayType(Type::IntegerType(4, false), dir.nameCount));
 				DefineAutoSymbol(new Symbol(DataSymbol, tableName, m_imageBase + dir.addressOfNames, NoBinding));
 
-				nameAddrs.reserve(dir.nameCount);
-				reader.Seek(RVAToFileOffset(dir.addressOfNames));
-				for (uint32_t i = 0; i < dir.nameCount; i++)
-					nameAddrs.push_back(reader.Read32());
+				nameAddrs = Read32Table(dir.addressOfNames, dir.nameCount);
 			}
 
 			vector<uint16_t> nameOrdinals;
@@ -2506,10 +2365,7 @@ bool PEView::Init()
 				DefineDataVariable(m_imageBase + dir.addressOfNameOrdinals, Type::ArrayType(Type::IntegerType(2, false), dir.nameCount));
 				DefineAutoSymbol(new Symbol(DataSymbol, tableName, m_imageBase + dir.addressOfNameOrdinals, NoBinding));
 
-				nameOrdinals.reserve(dir.nameCount);
-				reader.Seek(RVAToFileOffset(dir.addressOfNameOrdinals));
-				for (uint32_t i = 0; i < dir.nameCount; i++)
-					nameOrdinals.push_back(reader.Read16());
+				nameOrdinals = Read16Table(dir.addressOfNameOrdinals, dir.nameCount);
 			}
 
 			map<uint16_t, string> namesByOrdinal;
@@ -2821,6 +2677,11 @@ bool PEView::Init()
 	// Add a symbol for the entry point
 	if (m_entryPoint)
 		DefineAutoSymbol(new Symbol(FunctionSymbol, "_start", m_imageBase + m_entryPoint));
+
+	// Exception table function starts go last, so the entry point and exports are analyzed first
+	if (!m_exceptionFunctionStarts.empty())
+		AddExceptionFunctionStarts(platform, 0);
+
 	std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now();
 	double t = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count() / 1000.0;
 	m_logger->LogInfo("PE parsing took %.3f seconds\n", t);
@@ -2829,32 +2690,79 @@ bool PEView::Init()
 }
 
 
-uint64_t PEView::RVAToFileOffset(uint64_t offset, bool except)
+void PEView::BuildSectionIndex()
 {
-	for (auto& i : m_sections)
+	m_sectionsByRVA.clear();
+	for (size_t i = 0; i < m_sections.size(); i++)
 	{
-		if ((offset >= i.virtualAddress) &&
-			(offset < (i.virtualAddress + i.sizeOfRawData)) && (i.virtualSize != 0))
+		if (m_sections[i].virtualSize != 0)
+			m_sectionsByRVA.push_back(i);
+	}
+	sort(m_sectionsByRVA.begin(), m_sectionsByRVA.end(), [&](size_t a, size_t b) {
+		return m_sections[a].virtualAddress < m_sections[b].virtualAddress;
+	});
+
+	// Overlapping sections need the first match in header order, which only a linear scan gives
+	m_sectionsOverlap = false;
+	for (size_t i = 1; i < m_sectionsByRVA.size(); i++)
+	{
+		const PESection& prev = m_sections[m_sectionsByRVA[i - 1]];
+		uint64_t prevEnd = (uint64_t)prev.virtualAddress + max(prev.virtualSize, prev.sizeOfRawData);
+		if (prevEnd > m_sections[m_sectionsByRVA[i]].virtualAddress)
 		{
-			uint64_t progOfs = offset - i.virtualAddress;
-			return i.pointerToRawData + progOfs;
+			m_sectionsOverlap = true;
+			break;
 		}
 	}
-
-	if (!except)
-		return offset;
-
-	throw PEFormatException("encountered invalid offset");
+	m_sectionIndexSize = m_sections.size();
 }
 
 
-uint32_t PEView::GetRVACharacteristics(uint64_t offset)
+const PESection* PEView::FindSectionForRVA(uint64_t rva, bool useRawSize)
 {
-	for (auto& i : m_sections)
+	auto contains = [&](const PESection& section) {
+		return (rva >= section.virtualAddress) && (section.virtualSize != 0) &&
+			(rva < (section.virtualAddress + (useRawSize ? section.sizeOfRawData : section.virtualSize)));
+	};
+
+	if (m_sectionIndexSize != m_sections.size())
+		BuildSectionIndex();
+
+	if (m_sectionsOverlap)
 	{
-		if ((offset >= i.virtualAddress) && (offset < (i.virtualAddress + i.virtualSize)) && (i.virtualSize != 0))
-			return i.characteristics;
+		for (auto& i : m_sections)
+		{
+			if (contains(i))
+				return &i;
+		}
+		return nullptr;
 	}
+
+	auto it = upper_bound(m_sectionsByRVA.begin(), m_sectionsByRVA.end(), rva,
+		[&](uint64_t value, size_t index) { return value < m_sections[index].virtualAddress; });
+	if (it == m_sectionsByRVA.begin())
+		return nullptr;
+	const PESection& section = m_sections[*(it - 1)];
+	return contains(section) ? &section : nullptr;
+}
+
+
+uint64_t PEView::RVAToFileOffset(uint64_t offset, bool except)
+{
+	if (const PESection* section = FindSectionForRVA(offset, true))
+		return section->pointerToRawData + (offset - section->virtualAddress);
+
+	if (!except)
+		return offset;
+
+	throw PEFormatException("encountered invalid offset");
+}
+
+
+uint32_t PEView::GetRVACharacteristics(uint64_t offset)
+{
+	if (const PESection* section = FindSectionForRVA(offset, false))
+		return section->characteristics;
 	return 0;
 }
 
@@ -2913,6 +2821,37 @@ uint64_t PEView::Read64(uint64_t rva)
 }
 
 
+vector<uint16_t> PEView::Read16Table(uint64_t rva, size_t count)
+{
+	DataBuffer data = GetParentView()->ReadBuffer(RVAToFileOffset(rva), count * sizeof(uint16_t));
+	if (data.GetLength() < count * sizeof(uint16_t))
+		throw ReadException();
+
+	vector<uint16_t> result(count);
+	const uint8_t* bytes = (const uint8_t*)data.GetData();
+	for (size_t i = 0; i < count; i++)
+		result[i] = bytes[i * 2] | ((uint16_t)bytes[i * 2 + 1] << 8);
+	return result;
+}
+
+
+vector<uint32_t> PEView::Read32Table(uint64_t rva, size_t count)
+{
+	DataBuffer data = GetParentView()->ReadBuffer(RVAToFileOffset(rva), count * sizeof(uint32_t));
+	if (data.GetLength() < count * sizeof(uint32_t))
+		throw ReadException();
+
+	vector<uint32_t> result(count);
+	const uint8_t* bytes = (const uint8_t*)data.GetData();
+	for (size_t i = 0; i < count; i++)
+	{
+		const uint8_t* entry = bytes + (i * 4);
+		result[i] = entry[0] | ((uint32_t)entry[1] << 8) | ((uint32_t)entry[2] << 16) | ((uint32_t)entry[3] << 24);
+	}
+	return result;
+}
+
+
 // The addr is RVA
 void PEView::AddPESymbol(BNSymbolType type, const string& dll, const string& name, uint64_t addr,
 		BNSymbolBinding binding, uint64_t ordinal, vector<Ref<TypeLibrary>> libs)
@@ -3005,6 +2944,260 @@ void PEView::AddPESymbol(BNSymbolType type, const string& dll, const string& nam
 }
 
 
+void PEView::ParseRichHeader(uint32_t peOfs)
+{
+	BinaryReader reader(GetParentView(), LittleEndian);
+	try
+	{
+		// Read Rich header
+		vector<pair<uint32_t, uint32_t>> richValues;
+		const uint32_t richHeaderBase = 0x80;
+		if (peOfs > richHeaderBase)
+		{
+			reader.Seek(richHeaderBase);
+			for (uint32_t i = 0; i < ((peOfs - richHeaderBase) / 8); i++)
+			{
+				uint32_t var1 = reader.Read32();
+				uint32_t var2 = reader.Read32();
+				richValues.push_back({var1, var2});
+			}
+		}
+
+		// Create Rich Header Type
+		// TODO move decoded rich info to comments once comments work with linear view
+		if (richValues.size() >= 4)
+		{
+			bool validRichHeader = false;
+			uint32_t xorKey = richValues[0].second;
+			uint32_t entryIdx;
+			vector<uint64_t> richMetadataLookupIdentifiers;
+			vector<string> richMetadataLookupNames;
+			for (const auto& [id, name] : ProductMap)
+			{
+				richMetadataLookupIdentifiers.push_back(id);
+				richMetadataLookupNames.push_back(name);
+			}
+			StoreMetadata("RichHeaderLookupIdentifiers", new Metadata(richMetadataLookupIdentifiers), true);
+			StoreMetadata("RichHeaderLookupNames", new Metadata(richMetadataLookupNames), true);
+
+			vector<Ref<Metadata>> richMetadata;
+			for (entryIdx = 0; entryIdx < richValues.size(); entryIdx++)
+			{
+				if ((richValues[entryIdx].first == 0x68636952) && (richValues[entryIdx].second == xorKey))
+				{
+					validRichHeader = true;
+					break;
+				}
+
+				richValues[entryIdx].first ^= xorKey;
+				richValues[entryIdx].second ^= xorKey;
+				if (entryIdx > 1) // Skip the first 2 entries as they don't contain interesting information
+				{
+					map<string, Ref<Metadata>> entryMetadata = {
+						{string("ObjectTypeValue"), new Metadata((uint64_t)richValues[entryIdx].first >> 16)},
+						{string("ObjectTypeName"), new Metadata(GetRichObjectType(richValues[entryIdx].first >> 16))},
+						{string("ObjectVersionValue"), new Metadata((uint64_t)richValues[entryIdx].first & 0xffff)},
+						{string("ObjectVersionName"), new Metadata(GetRichProductName(richValues[entryIdx].first & 0xffff))},
+						{string("ObjectCount"), new Metadata((uint64_t)richValues[entryIdx].second)}
+						};
+					richMetadata.push_back(new Metadata(entryMetadata));
+				}
+				if (!entryIdx && richValues[entryIdx].first != 0x536e6144)
+					break;
+			}
+
+			if (validRichHeader)
+			{
+				StoreMetadata("RichHeader", new Metadata(richMetadata), true);
+				StructureBuilder richHeaderBuilder;
+				richHeaderBuilder.AddMember(Type::IntegerType(4, false), "e_magic__DanS");
+				richHeaderBuilder.AddMember(Type::ArrayType(Type::IntegerType(4, false), 3), "e_align");
+
+				for (uint32_t i = 2; i < entryIdx; i++)
+				{
+					stringstream ss;
+					ss << "e_entry_id" << std::dec << i-2 << "__" << std::hex << std::setw(8) << std::setfill('0') << richValues[i].first;
+					richHeaderBuilder.AddMember(Type::IntegerType(4, false), ss.str());
+					ss.str("");
+					ss.clear();
+					ss << "e_entry_count" << std::dec << i-2 << "__" << richValues[i].second;
+					richHeaderBuilder.AddMember(Type::IntegerType(4, false), ss.str());
+				}
+
+				richHeaderBuilder.AddMember(Type::ArrayType(Type::IntegerType(1, true), 4), "e_magic");
+				richHeaderBuilder.AddMember(Type::IntegerType(4, false), "e_checksum");
+
+				Ref<Structure> richHeaderStruct = richHeaderBuilder.Finalize();
+				Ref<Type> richHeaderType = Type::StructureType(richHeaderStruct);
+				QualifiedName richHeaderName = string("Rich_Header");
+				string richHeaderTypeId = Type::GenerateAutoTypeId("pe", richHeaderName);
+				QualifiedName richHeaderTypeName = DefineType(richHeaderTypeId, richHeaderName, richHeaderType);
+				DefineDataVariable(m_imageBase + richHeaderBase, Type::NamedType(this, richHeaderTypeName));
+				DefineAutoSymbol(new Symbol(DataSymbol, "__rich_header", m_imageBase + richHeaderBase, NoBinding));
+			}
+		}
+	}
+	catch (std::exception& e)
+	{
+		m_logger->LogWarn("Failed to parse Rich header: %s\n", e.what());
+	}
+}
+
+
+void PEView::ParseDebugDirectory()
+{
+	BinaryReader reader(GetParentView(), LittleEndian);
+	try
+	{
+		if (m_dataDirs.size() > IMAGE_DIRECTORY_ENTRY_DEBUG)
+		{
+			PEDataDirectory dir = m_dataDirs[IMAGE_DIRECTORY_ENTRY_DEBUG];
+			if (dir.size >= sizeof(DebugDirectory))
+			{
+
+				m_logger->LogDebug("Parsing IMAGE_DIRECTORY_ENTRY_DEBUG: %08x", dir.size);
+				for (uint32_t i = 0; i < dir.size / sizeof(DebugDirectory); i++)
+				{
+					reader.Seek(RVAToFileOffset(dir.virtualAddress + i * sizeof(DebugDirectory)));
+					DebugDirectory debugDir;
+					reader.Read(&debugDir, sizeof(DebugDirectory));
+
+					m_logger->LogDebug(
+						"DebugDirectory:\n"
+						"\tcharacteristics:  %08x\n"
+						"\ttimeDateStamp:    %08x\n"
+						"\tmajorVersion:     %08x\n"
+						"\tminorVersion:     %08x\n"
+						"\ttype:             %08x\n"
+						"\tsizeOfData:       %08x\n"
+						"\taddressOfRawData: %08x\n"
+						"\tpointerToRawData: %08x\n",
+						debugDir.characteristics,
+						debugDir.timeDateStamp,
+						debugDir.majorVersion,
+						debugDir.minorVersion,
+						debugDir.type,
+						debugDir.sizeOfData,
+						RVAToFileOffset(debugDir.addressOfRawData, false),
+						debugDir.pointerToRawData
+					);
+
+					if (!debugDir.addressOfRawData)
+						continue;
+
+					if (debugDir.type == IMAGE_DEBUG_TYPE_CODEVIEW)  // PDB Information
+					{
+						auto type = TypeBuilder::IntegerType(4, false);
+						type.SetIntegerTypeDisplayType(CharacterConstantDisplayType);
+						DefineDataVariable(m_imageBase + debugDir.addressOfRawData, type.Finalize());
+						DefineAutoSymbol(new Symbol(DataSymbol, "debugInfoType", m_imageBase + debugDir.addressOfRawData, NoBinding));
+
+
+						reader.Seek(RVAToFileOffset(debugDir.addressOfRawData));
+						uint32_t signature = reader.Read32();
+						StoreMetadata("DEBUG_INFO_TYPE", new Metadata((uint64_t)signature), true);
+						if (signature == 0x53445352) // SDSR
+						{
+							vector<uint8_t> guid(16);
+							reader.Read(&guid[0], 16);
+							uint32_t age = reader.Read32();
+							StoreMetadata("PDB_GUID", new Metadata(guid), true);
+							StoreMetadata("PDB_AGE", new Metadata((uint64_t)age), true);
+							string pdbFileName = reader.ReadCString();
+							StoreMetadata("PDB_FILENAME", new Metadata(pdbFileName), true);
+							m_logger->LogInfo("PDBFileName: %s\n", pdbFileName.c_str());
+
+							DefineDataVariable(m_imageBase + debugDir.addressOfRawData + 4, Type::ArrayType(Type::IntegerType(1, false), 16));
+							DefineAutoSymbol(new Symbol(DataSymbol, "PDBGuid", m_imageBase + debugDir.addressOfRawData + 4, NoBinding));
+							DefineDataVariable(m_imageBase + debugDir.addressOfRawData + 20, Type::IntegerType(4, false));
+							DefineAutoSymbol(new Symbol(DataSymbol, "PDBAge", m_imageBase + debugDir.addressOfRawData + 20, NoBinding));
+							DefineDataVariable(m_imageBase + debugDir.addressOfRawData + 24, Type::ArrayType(Type::IntegerType(1, true), pdbFileName.size() + 1));
+							DefineAutoSymbol(new Symbol(DataSymbol, "PDBFileName", m_imageBase + debugDir.addressOfRawData + 24, NoBinding));
+						}
+					}
+					else if (debugDir.type == IMAGE_DEBUG_TYPE_RESERVED10)
+					{
+						DefineDataVariable(m_imageBase + debugDir.addressOfRawData, Type::IntegerType(4, false));
+						DefineAutoSymbol(new Symbol(DataSymbol, "debugTypeReserved", m_imageBase + debugDir.addressOfRawData, NoBinding));
+					}
+					else
+					{
+						DefineDataVariable(m_imageBase + debugDir.addressOfRawData, Type::ArrayType(Type::IntegerType(1, false), debugDir.sizeOfData));
+						string name = GetDebugTypeName(debugDir.type);
+						DefineAutoSymbol(new Symbol(DataSymbol, name, m_imageBase + debugDir.addressOfRawData, NoBinding));
+					}
+				}
+
+				// Create Debug Directory Type
+				StructureBuilder debugDirBuilder;
+				debugDirBuilder.AddMember(Type::IntegerType(4, false), "characteristics");
+				debugDirBuilder.AddMember(Type::IntegerType(4, false), "timeDateStamp");
+				debugDirBuilder.AddMember(Type::IntegerType(2, false), "majorVersion");
+				debugDirBuilder.AddMember(Type::IntegerType(2, false), "minorVersion");
+				EnumerationBuilder debugType;
+				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_UNKNOWN", IMAGE_DEBUG_TYPE_UNKNOWN);
+				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_COFF", IMAGE_DEBUG_TYPE_COFF);
+				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_CODEVIEW", IMAGE_DEBUG_TYPE_CODEVIEW);
+				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_FPO", IMAGE_DEBUG_TYPE_FPO);
+				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_MISC", IMAGE_DEBUG_TYPE_MISC);
+				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_EXCEPTION", IMAGE_DEBUG_TYPE_EXCEPTION);
+				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_FIXUP", IMAGE_DEBUG_TYPE_FIXUP);
+				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_OMAP_TO_SRC", IMAGE_DEBUG_TYPE_OMAP_TO_SRC);
+				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_OMAP_FROM_SRC", IMAGE_DEBUG_TYPE_OMAP_FROM_SRC);
+				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_BORLAND", IMAGE_DEBUG_TYPE_BORLAND);
+				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_RESERVED10", IMAGE_DEBUG_TYPE_RESERVED10);
+				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_CLSID", IMAGE_DEBUG_TYPE_CLSID);
+				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_VC_FEATURE", IMAGE_DEBUG_TYPE_VC_FEATURE);
+				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_POGO", IMAGE_DEBUG_TYPE_POGO);
+				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_ILTCG", IMAGE_DEBUG_TYPE_ILTCG);
+				debugType.AddMemberWithValue("IMAGE_DEBUG_TYPE_MPX", IMAGE_DEBUG_TYPE_MPX);
+				debugDirBuilder.AddMember(Type::EnumerationType(debugType.Finalize(), 4), "type");
+				debugDirBuilder.AddMember(Type::IntegerType(4, false), "sizeOfData");
+				debugDirBuilder.AddMember(Type::IntegerType(4, false), "addressOfRawData");
+				debugDirBuilder.AddMember(Type::IntegerType(4, false), "pointerToRawData");
+
+				size_t numDebugEntries = dir.size / 24;
+				Ref<Structure> debugDirStruct = debugDirBuilder.Finalize();
+				Ref<Type> debugDirType = Type::StructureType(debugDirStruct);
+				QualifiedName debugDirName = string("Debug_Directory_Table");
+				string debugDirTypeId = Type::GenerateAutoTypeId("pe", debugDirName);
+				QualifiedName debugDirTypeName = DefineType(debugDirTypeId, debugDirName, debugDirType);
+				DefineDataVariable(m_imageBase + m_dataDirs[IMAGE_DIRECTORY_ENTRY_DEBUG].virtualAddress, Type::ArrayType(Type::NamedType(this, debugDirTypeName), numDebugEntries));
+				DefineAutoSymbol(new Symbol(DataSymbol, "__debug_directory_entries", m_imageBase + m_dataDirs[IMAGE_DIRECTORY_ENTRY_DEBUG].virtualAddress, NoBinding));
+			}
+		}
+	}
+	catch (std::exception& e)
+	{
+		m_logger->LogWarn("Failed to parse debug directory: %s\n", e.what());
+	}
+}
+
+
+void PEView::AddExceptionFunctionStarts(Ref<Platform> platform, size_t next)
+{
+	size_t end = min(next + m_exceptionFunctionBatchSize, m_exceptionFunctionStarts.size());
+	for (size_t i = next; i < end; i++)
+	{
+		uint64_t exceptionEntry = m_imageBase + m_exceptionFunctionStarts[i];
+		Ref<Platform> targetPlatform = platform->GetAssociatedPlatformByAddress(exceptionEntry);
+		AddFunctionForAnalysis(targetPlatform, exceptionEntry);
+	}
+
+	if (end < m_exceptionFunctionStarts.size())
+	{
+		Ref<PEView> self = this;
+		WorkerEnqueue([self, platform, end]() { self->AddExceptionFunctionStarts(platform, end); },
+			"PE Exception Table Function Starts");
+		return;
+	}
+
+	m_logger->LogDebug("Added %zu function starts from the exception table", m_exceptionFunctionStarts.size());
+	m_exceptionFunctionStarts.clear();
+	m_exceptionFunctionStarts.shrink_to_fit();
+}
+
+
 uint64_t PEView::PerformGetEntryPoint() const
 {
 	return m_imageBase + m_entryPoint;
@@ -3124,6 +3317,24 @@ Ref<Settings> PEViewType::GetLoadSettingsForData(BinaryView* data)
 			"description" : "Add function starts sourced from the Exception Handling table (.pdata) to the core for analysis."
 			})");
 
+	settings->RegisterSetting("loader.pe.deferInformationalHeaders",
+			R"({
+			"title" : "Defer PE Informational Header Parsing",
+			"type" : "boolean",
+			"default" : false,
+			"description" : "Decode the Rich header and the debug directory in the background after loading instead of before the view becomes available. Their metadata (RichHeader, PDB_GUID, PDB_FILENAME, ...) is stored once parsing finishes."
+			})");
+
+	settings->RegisterSetting("loader.pe.exceptionTableBatchSize",
+			R"({
+			"title" : "PE Exception Table Function Start Batch Size",
+			"type" : "number",
+			"default" : 0,
+			"minValue" : 0,
+			"maxValue" : 4294967295,
+			"description" : "When non-zero, function starts from the Exception Handling table (.pdata) are added to analysis in batches of this size in the background, after the entry point and exports, instead of all at once while the file is loading."
+			})");
+
 	settings->RegisterSetting("loader.pe.processSehTable",
 			R"({
 			"title" : "Process PE Structured Exception Handling Table",
@@ -465,12 +465,29 @@ namespace BinaryNinja
 
 		Ref<Metadata> m_symExternMappingMetadata;
 
+		// Sorted, unique BeginAddress RVAs from .pdata still waiting to be added to analysis
+		std::vector<uint32_t> m_exceptionFunctionStarts;
+		size_t m_exceptionFunctionBatchSize = 0;
+		bool m_deferInformationalParsing = false;
+
+		// Indices into m_sections sorted by virtual address, rebuilt whenever the section list grows
+		std::vector<size_t> m_sectionsByRVA;
+		size_t m_sectionIndexSize = 0;
+		bool m_sectionsOverlap = false;
+
+		void BuildSectionIndex();
+		const PESection* FindSectionForRVA(uint64_t rva, bool useRawSize);
 		uint64_t RVAToFileOffset(uint64_t rva, bool except = true);
 		uint32_t GetRVACharacteristics(uint64_t rva);
 		std::string ReadString(uint64_t rva);
 		uint16_t Read16(uint64_t rva);
 		uint32_t Read32(uint64_t rva);
 		uint64_t Read64(uint64_t rva);
+		std::vector<uint16_t> Read16Table(uint64_t rva, size_t count);
+		std::vector<uint32_t> Read32Table(uint64_t rva, size_t count);
+		void AddExceptionFunctionStarts(Ref<Platform> platform, size_t next);
+		void ParseRichHeader(uint32_t peOfs);
+		void ParseDebugDirectory();
 		void AddPESymbol(BNSymbolType type, const std::string& dll, const std::string& name, uint64_t addr,
 			BNSymbolBinding binding = NoBinding, uint64_t ordinal = 0, std::vector<Ref<TypeLibrary>> lib = {});
 
@@ -206,6 +206,8 @@ TEView::TEView(BinaryView* bv, bool parseOnly) : BinaryView("TE", bv->GetFile(),
 
 bool TEView::Init()
 {
+	static InstrumentationHistogram histogram("view.te.init");
+	InstrumentationScope scope(histogram);
 	BinaryReader reader(GetParentView(), LittleEndian);
 	struct TEImageHeader header;
 	Ref<Platform> platform;
@@ -26,6 +26,15 @@ namespace SharedCacheAPI {
 		return BNDSCViewLoadImageWithInstallName(m_object, str, skipObjC);
 	}
 
+	bool SharedCache::LoadImagesWithInstallNames(const std::vector<std::string>& installNames, bool skipObjC)
+	{
+		std::vector<const char*> names;
+		names.reserve(installNames.size());
+		for (const auto& installName : installNames)
+			names.push_back(installName.c_str());
+		return BNDSCViewLoadImagesWithInstallNames(m_object, names.data(), names.size(), skipObjC);
+	}
+
 	bool SharedCache::LoadSectionAtAddress(uint64_t addr)
 	{
 		return BNDSCViewLoadSectionAtAddress(m_object, addr);
@@ -55,6 +64,26 @@ namespace SharedCacheAPI {
 		return result;
 	}
 
+	std::vector<DSCImageSummary> SharedCache::GetImageSummaries()
+	{
+		size_t count;
+		BNDSCImageSummary* value = BNDSCViewGetImageSummaries(m_object, &count);
+		if (value == nullptr)
+		{
+			return {};
+		}
+
+		std::vector<DSCImageSummary> result;
+		result.reserve(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			result.push_back({value[i].name, value[i].headerAddress, value[i].size, value[i].segmentCount});
+		}
+
+		BNDSCViewFreeImageSummaries(value, count);
+		return result;
+	}
+
 	void SharedCache::ProcessObjCSectionsForImageWithInstallName(std::string installName)
 	{
 		char* str = BNAllocString(installName.c_str());
@@ -124,6 +124,13 @@ namespace SharedCacheAPI {
 		std::vector<DSCImageMemoryMapping> mappings;
 	};
 
+	struct DSCImageSummary {
+		std::string name;
+		uint64_t headerAddress;
+		uint64_t size;
+		size_t segmentCount;
+	};
+
 	struct DSCSymbol {
 		uint64_t address;
 		std::string name;
@@ -258,9 +265,12 @@ namespace SharedCacheAPI {
 		static uint64_t FastGetBackingCacheCount(Ref<BinaryView> view);
 
 		bool LoadImageWithInstallName(std::string installName, bool skipObjC = false);
+		bool LoadImagesWithInstallNames(const std::vector<std::string>& installNames, bool skipObjC = false);
 		bool LoadSectionAtAddress(uint64_t addr);
 		bool LoadImageContainingAddress(uint64_t addr, bool skipObjC = false);
 		std::vector<std::string> GetAvailableImages();
+		// Name, address and size of every image, without fetching their full headers.
+		std::vector<DSCImageSummary> GetImageSummaries();
 	
 		void ProcessObjCSectionsForImageWithInstallName(std::string installName);
 		void ProcessAllObjCSections();
@@ -83,6 +83,13 @@ extern "C"
 		size_t mappingCount;
 	} BNDSCImage;
 
+	typedef struct BNDSCImageSummary {
+		char* name;
+		uint64_t headerAddress;
+		uint64_t size;
+		size_t segmentCount;
+	} BNDSCImageSummary;
+
 	typedef struct BNDSCMappedMemoryRegion {
 		uint64_t vmAddress;
 		uint64_t size;
@@ -105,6 +112,11 @@ extern "C"
 	typedef struct BNDSCMemoryUsageInfo {
 		uint64_t sharedCacheRefs;
 		uint64_t mmapRefs;
+		uint64_t mmapLimit;
+		uint64_t mmapHits;
+		uint64_t mmapOpens;
+		uint64_t mmapRemaps;
+		uint64_t mmapEvictions;
 	} BNDSCMemoryUsageInfo;
 
 	typedef struct BNDSCSymbolRep {
@@ -119,8 +131,11 @@ extern "C"
 	SHAREDCACHE_FFI_API void BNFreeSharedCacheReference(BNSharedCache* cache);
 
 	SHAREDCACHE_FFI_API char** BNDSCViewGetInstallNames(BNSharedCache* cache, size_t* count);
+	SHAREDCACHE_FFI_API BNDSCImageSummary* BNDSCViewGetImageSummaries(BNSharedCache* cache, size_t* count);
+	SHAREDCACHE_FFI_API void BNDSCViewFreeImageSummaries(BNDSCImageSummary* summaries, size_t count);
 
 	SHAREDCACHE_FFI_API bool BNDSCViewLoadImageWithInstallName(BNSharedCache* cache, char* name, bool skipObjC);
+	SHAREDCACHE_FFI_API bool BNDSCViewLoadImagesWithInstallNames(BNSharedCache* cache, const char** names, size_t count, bool skipObjC);
 	SHAREDCACHE_FFI_API bool BNDSCViewLoadSectionAtAddress(BNSharedCache* cache, uint64_t name);
 	SHAREDCACHE_FFI_API bool BNDSCViewLoadImageContainingAddress(BNSharedCache* cache, uint64_t address, bool skipObjC);
 	
@@ -48,6 +48,8 @@ enum DSCPlatform {
 
 bool DSCView::Init()
 {
+	static InstrumentationHistogram histogram("view.sharedcache.init");
+	InstrumentationScope scope(histogram);
 	std::string os;
 	std::string arch;
 
@@ -600,14 +602,11 @@ bool DSCView::Init()
 	DefineType(filesetEntryCommandTypeId, filesetEntryCommandName, filesetEntryCommandType);
 
 	std::vector<SharedCacheCore::MemoryRegion> regionsMappedIntoMemory;
-	if (auto meta = GetParentView()->QueryMetadata(SharedCacheCore::SharedCacheMetadataTag))
+	// The full state record followed by the deltas stored on top of it.
+	auto documents = SharedCacheCore::SharedCache::LoadMetadataDocuments(GetParentView());
+	if (!documents.empty())
 	{
-		std::string data = GetParentView()->GetStringMetadata(SharedCacheCore::SharedCacheMetadataTag);
-		std::stringstream ss;
-		ss.str(data);
-		rapidjson::Document result(rapidjson::kObjectType);
-
-		result.Parse(data.c_str());
+		rapidjson::Document& result = documents.front();
 
 		if (result.HasMember("metadataVersion"))
 		{
@@ -623,11 +622,14 @@ bool DSCView::Init()
 			LogError("Shared cache metadata version not found");
 			return false;
 		}
-		for (auto& imgV : result["regionsMappedIntoMemory"].GetArray())
+		for (auto& document : documents)
 		{
-			SharedCacheCore::MemoryRegion region;
-			region.LoadFromValue(imgV);
-			regionsMappedIntoMemory.push_back(region);
+			for (auto& imgV : document["regionsMappedIntoMemory"].GetArray())
+			{
+				SharedCacheCore::MemoryRegion region;
+				region.LoadFromValue(imgV);
+				regionsMappedIntoMemory.push_back(region);
+			}
 		}
 
 		std::unordered_map<uint64_t, std::string> imageStartToInstallName;
@@ -639,18 +641,22 @@ bool DSCView::Init()
 			imageStartToInstallName[addr] = name;
 		}
 
-		std::vector<std::pair<uint64_t, std::vector<std::pair<uint64_t, std::pair<BNSymbolType, std::string>>>>> exportInfos;
+		// Later documents replace the export list of an image rather than adding to it.
+		std::map<uint64_t, std::vector<std::pair<uint64_t, std::pair<BNSymbolType, std::string>>>> exportInfos;
 
-		for (const auto& obj1 : result["exportInfos"].GetArray())
+		for (auto& document : documents)
 		{
-			std::vector<std::pair<uint64_t, std::pair<BNSymbolType, std::string>>> innerVec;
-			for (const auto& obj2 : obj1["value"].GetArray())
+			for (const auto& obj1 : document["exportInfos"].GetArray())
 			{
-				std::pair<BNSymbolType, std::string> innerPair = { (BNSymbolType)obj2["val1"].GetUint64(), obj2["val2"].GetString() };
-				innerVec.push_back({ obj2["key"].GetUint64(), innerPair });
-			}
+				std::vector<std::pair<uint64_t, std::pair<BNSymbolType, std::string>>> innerVec;
+				for (const auto& obj2 : obj1["value"].GetArray())
+				{
+					std::pair<BNSymbolType, std::string> innerPair = { (BNSymbolType)obj2["val1"].GetUint64(), obj2["val2"].GetString() };
+					innerVec.push_back({ obj2["key"].GetUint64(), innerPair });
+				}
 
-			exportInfos.push_back({obj1["key"].GetUint64(), innerVec});
+				exportInfos[obj1["key"].GetUint64()] = std::move(innerVec);
+			}
 		}
 
 		BeginBulkModifySymbols();
@@ -798,6 +804,14 @@ Ref<Settings> DSCViewType::GetLoadSettingsForData(BinaryView* data)
 		"description" : "Allow mapping __LINKEDIT segments. These are large regions of symbol data that are automatically processed by BinaryNinja without the need for mapping. On newer caches, __LINKEDIT for all images may end up merged and be >300MB in size. This will likely cause severe performance degradation with _zero_ benefit."
 		})");
 
+	settings->RegisterSetting("loader.dsc.cacheSlidImages",
+		R"({
+			"title" : "Cache Slid Images On Disk",
+			"type" : "boolean",
+			"default" : false,
+			"description" : "Store a copy of each cache file with slide info applied in the user directory and map it directly on future loads, skipping slide info processing. Each copy is as large as the original cache file."
+			})");
+
 	settings->RegisterSetting("loader.dsc.processFunctionStarts",
 		R"({
 			"title" : "Process Mach-O Function Starts Tables",
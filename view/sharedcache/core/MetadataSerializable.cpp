@@ -2,6 +2,267 @@
 
 namespace SharedCacheCore {
 
+// Binary format: the magic and format version, followed by one token per JSON event.
+static constexpr uint8_t BinaryMagic[4] = {'B', 'N', 'M', 'S'};
+static constexpr uint8_t BinaryFormatVersion = 1;
+// Strings up to this length are deduplicated; longer ones are rarely repeated and would only bloat the table.
+static constexpr size_t MaxInternedStringLength = 256;
+
+enum BinaryTag : uint8_t
+{
+	BinaryTagStartObject = 1,
+	BinaryTagEndObject,
+	BinaryTagStartArray,
+	BinaryTagEndArray,
+	BinaryTagFalse,
+	BinaryTagTrue,
+	BinaryTagUint,
+	// Zigzag encoded.
+	BinaryTagInt,
+	// Inline string, added to the string table if short enough.
+	BinaryTagString,
+	// Index into the string table.
+	BinaryTagStringRef,
+};
+
+MetadataWriter::MetadataWriter(SerializationFormat format, rapidjson::StringBuffer& buffer) :
+	m_format(format), m_json(buffer)
+{
+	if (m_format == SerializationFormat::Binary)
+	{
+		m_binary.insert(m_binary.end(), std::begin(BinaryMagic), std::end(BinaryMagic));
+		m_binary.push_back(BinaryFormatVersion);
+	}
+}
+
+void MetadataWriter::WriteVarint(uint64_t value)
+{
+	do
+	{
+		uint8_t byte = value & 0x7f;
+		value >>= 7;
+		if (value)
+			byte |= 0x80;
+		m_binary.push_back(byte);
+	} while (value);
+}
+
+bool MetadataWriter::StartObject()
+{
+	if (m_format == SerializationFormat::Json)
+		return m_json.StartObject();
+	WriteTag(BinaryTagStartObject);
+	return true;
+}
+
+bool MetadataWriter::EndObject()
+{
+	if (m_format == SerializationFormat::Json)
+		return m_json.EndObject();
+	WriteTag(BinaryTagEndObject);
+	return true;
+}
+
+bool MetadataWriter::StartArray()
+{
+	if (m_format == SerializationFormat::Json)
+		return m_json.StartArray();
+	WriteTag(BinaryTagStartArray);
+	return true;
+}
+
+bool MetadataWriter::EndArray()
+{
+	if (m_format == SerializationFormat::Json)
+		return m_json.EndArray();
+	WriteTag(BinaryTagEndArray);
+	return true;
+}
+
+bool MetadataWriter::String(const char* str, size_t length)
+{
+	if (m_format == SerializationFormat::Json)
+		return m_json.String(str, length);
+
+	if (length <= MaxInternedStringLength)
+	{
+		auto [it, inserted] = m_strings.try_emplace(std::string(str, length), (uint32_t)m_strings.size());
+		if (!inserted)
+		{
+			WriteTag(BinaryTagStringRef);
+			WriteVarint(it->second);
+			return true;
+		}
+	}
+	WriteTag(BinaryTagString);
+	WriteVarint(length);
+	m_binary.insert(m_binary.end(), str, str + length);
+	return true;
+}
+
+bool MetadataWriter::Bool(bool b)
+{
+	if (m_format == SerializationFormat::Json)
+		return m_json.Bool(b);
+	WriteTag(b ? BinaryTagTrue : BinaryTagFalse);
+	return true;
+}
+
+bool MetadataWriter::Int64(int64_t value)
+{
+	if (m_format == SerializationFormat::Json)
+		return m_json.Int64(value);
+	WriteTag(BinaryTagInt);
+	WriteVarint(((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+	return true;
+}
+
+bool MetadataWriter::Uint64(uint64_t value)
+{
+	if (m_format == SerializationFormat::Json)
+		return m_json.Uint64(value);
+	WriteTag(BinaryTagUint);
+	WriteVarint(value);
+	return true;
+}
+
+namespace {
+
+// Replays a binary token stream into a rapidjson SAX handler (here, `Document::Populate`).
+class BinaryDocumentGenerator
+{
+	const uint8_t* m_cursor;
+	const uint8_t* m_end;
+
+	bool ReadVarint(uint64_t& value)
+	{
+		value = 0;
+		for (unsigned shift = 0; shift < 64; shift += 7)
+		{
+			if (m_cursor == m_end)
+				return false;
+			uint8_t byte = *m_cursor++;
+			value |= (uint64_t)(byte & 0x7f) << shift;
+			if (!(byte & 0x80))
+				return true;
+		}
+		return false;
+	}
+
+public:
+	BinaryDocumentGenerator(const uint8_t* data, size_t length) : m_cursor(data), m_end(data + length) {}
+
+	template <typename Handler>
+	bool operator()(Handler& handler)
+	{
+		// Element counts of the open containers. Object counts include keys, as `EndObject` wants pairs.
+		std::vector<rapidjson::SizeType> counts;
+		std::vector<std::string_view> strings;
+		do
+		{
+			if (m_cursor == m_end)
+				return false;
+			uint8_t tag = *m_cursor++;
+			if (!counts.empty() && tag != BinaryTagEndObject && tag != BinaryTagEndArray)
+				counts.back()++;
+
+			uint64_t value;
+			switch (tag)
+			{
+			case BinaryTagStartObject:
+				handler.StartObject();
+				counts.push_back(0);
+				break;
+			case BinaryTagStartArray:
+				handler.StartArray();
+				counts.push_back(0);
+				break;
+			case BinaryTagEndObject:
+				if (counts.empty() || counts.back() % 2)
+					return false;
+				handler.EndObject(counts.back() / 2);
+				counts.pop_back();
+				break;
+			case BinaryTagEndArray:
+				if (counts.empty())
+					return false;
+				handler.EndArray(counts.back());
+				counts.pop_back();
+				break;
+			case BinaryTagFalse:
+			case BinaryTagTrue:
+				handler.Bool(tag == BinaryTagTrue);
+				break;
+			case BinaryTagUint:
+				if (!ReadVarint(value))
+					return false;
+				handler.Uint64(value);
+				break;
+			case BinaryTagInt:
+				if (!ReadVarint(value))
+					return false;
+				handler.Int64((int64_t)(value >> 1) ^ -(int64_t)(value & 1));
+				break;
+			case BinaryTagString:
+			{
+				if (!ReadVarint(value) || value > (uint64_t)(m_end - m_cursor))
+					return false;
+				std::string_view str((const char*)m_cursor, value);
+				m_cursor += value;
+				if (str.size() <= MaxInternedStringLength)
+					strings.push_back(str);
+				handler.String(str.data(), (rapidjson::SizeType)str.size(), true);
+				break;
+			}
+			case BinaryTagStringRef:
+				if (!ReadVarint(value) || value >= strings.size())
+					return false;
+				handler.String(strings[value].data(), (rapidjson::SizeType)strings[value].size(), true);
+				break;
+			default:
+				return false;
+			}
+		} while (!counts.empty());
+		return true;
+	}
+};
+
+}
+
+bool ParseBinaryDocument(const uint8_t* data, size_t length, rapidjson::Document& doc)
+{
+	if (length < sizeof(BinaryMagic) + 1 || memcmp(data, BinaryMagic, sizeof(BinaryMagic)) != 0
+		|| data[sizeof(BinaryMagic)] != BinaryFormatVersion)
+		return false;
+
+	BinaryDocumentGenerator generator(data + sizeof(BinaryMagic) + 1, length - sizeof(BinaryMagic) - 1);
+	doc.SetNull();
+	doc.Populate(generator);
+	return !doc.IsNull();
+}
+
+bool ParseMetadataDocument(const Ref<Metadata>& meta, rapidjson::Document& doc)
+{
+	bool parsed = false;
+	if (meta && meta->IsRaw())
+	{
+		auto data = meta->GetRaw();
+		parsed = ParseBinaryDocument(data.data(), data.size(), doc);
+	}
+	else if (meta && meta->IsString())
+	{
+		doc.Parse(meta->GetString().c_str());
+		parsed = !doc.HasParseError();
+	}
+
+	if (!parsed || !doc.IsObject())
+	{
+		doc.SetObject();
+		return false;
+	}
+	return true;
+}
+
 void Serialize(SerializationContext& context, std::string_view str) {
 	context.writer.String(str.data(), str.length());
 }
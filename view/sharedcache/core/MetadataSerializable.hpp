@@ -32,12 +32,15 @@
  *
  * Other ser/deser formats (rapidjson objects, strings) also exist. You can use these to achieve nesting, but probably
  avoid that.
+ *
+ * `AsMetadata()` uses a compact binary encoding of the same document (see `SerializationFormat::Binary`), stored as raw
+ metadata. `LoadFromMetadata()` accepts both that and the older JSON string metadata.
  * */
 
 #include "binaryninjaapi.h"
 #include "rapidjson/document.h"
 #include "rapidjson/stringbuffer.h"
-#include "rapidjson/prettywriter.h"
+#include "rapidjson/writer.h"
 #include "../api/sharedcachecore.h"
 #include "view/macho/machoview.h"
 
@@ -57,12 +60,52 @@ using namespace BinaryNinja;
 
 struct DeserializationContext;
 
+enum class SerializationFormat : uint8_t
+{
+	Json,
+	// Tagged token stream mirroring the JSON document, with LEB128 integers and deduplicated strings.
+	Binary,
+};
+
+/*
+ * Writes either JSON text or the binary token stream. Exposes the subset of the `rapidjson::Writer` interface the
+ * serializers use, so `Store` implementations do not need to care which format they are producing.
+ */
+class SHAREDCACHE_FFI_API MetadataWriter
+{
+	SerializationFormat m_format;
+	rapidjson::Writer<rapidjson::StringBuffer> m_json;
+	std::vector<uint8_t> m_binary;
+	std::unordered_map<std::string, uint32_t> m_strings;
+
+	void WriteTag(uint8_t tag) { m_binary.push_back(tag); }
+	void WriteVarint(uint64_t value);
+
+public:
+	MetadataWriter(SerializationFormat format, rapidjson::StringBuffer& buffer);
+
+	bool StartObject();
+	bool EndObject();
+	bool StartArray();
+	bool EndArray();
+	bool String(const char* str, size_t length);
+	bool Bool(bool b);
+	bool Int(int32_t value) { return Int64(value); }
+	bool Uint(uint32_t value) { return Uint64(value); }
+	bool Int64(int64_t value);
+	bool Uint64(uint64_t value);
+
+	std::vector<uint8_t>& Binary() { return m_binary; }
+};
+
 struct SerializationContext {
+	SerializationFormat format;
 	rapidjson::StringBuffer buffer;
-	rapidjson::PrettyWriter<rapidjson::StringBuffer> writer;
+	MetadataWriter writer;
 
-	SerializationContext() : buffer(), writer(buffer) {
-	}
+	SerializationContext(SerializationFormat format = SerializationFormat::Json) :
+		format(format), buffer(), writer(format, buffer)
+	{}
 
 	template <typename T>
 	void store(std::string_view x, const T& y)
@@ -83,6 +126,11 @@ struct DeserializationContext {
 	}
 };
 
+// Rebuilds the document produced by `SerializationFormat::Binary`. Returns false if the data is malformed.
+SHAREDCACHE_FFI_API bool ParseBinaryDocument(const uint8_t* data, size_t length, rapidjson::Document& doc);
+// Parses document metadata in either format, leaving `doc` as an empty object on failure.
+SHAREDCACHE_FFI_API bool ParseMetadataDocument(const Ref<Metadata>& meta, rapidjson::Document& doc);
+
 template <typename Derived>
 class MetadataSerializable
 {
@@ -109,15 +157,24 @@ public:
 		AsDerived().Load(context);
 	}
 
+	std::vector<uint8_t> AsBinary() const
+	{
+		SerializationContext context(SerializationFormat::Binary);
+		Store(context);
+
+		return std::move(context.writer.Binary());
+	}
+
 	Ref<Metadata> AsMetadata() {
-		return new Metadata(AsString());
+		return new Metadata(AsBinary());
 	}
 
 	bool LoadFromMetadata(const Ref<Metadata>& meta)
 	{
-		if (!meta->IsString())
+		DeserializationContext context;
+		if (!ParseMetadataDocument(meta, context.doc))
 			return false;
-		LoadFromString(meta->GetString());
+		AsDerived().Load(context);
 		return true;
 	}
 
@@ -154,6 +154,45 @@ namespace DSCObjC {
 		ClassBase optionalClassMethods;
 	};
 
+	// A symbol recorded while decoding, defined later by the processor. Exactly one of `type` and
+	// `typeName` is used; named types are resolved against the view when the symbol is applied.
+	struct ObjCSymbolDefinition {
+		BNSymbolType symbolType;
+		Ref<Type> type;
+		QualifiedName typeName;
+		std::string name;
+		uint64_t address;
+	};
+
+	// Everything a decoded class, category or protocol contributes to the view. Decoding fills this
+	// without touching the view or the processor's tables, so it can run off the main thread.
+	struct DecodedObjCMetadata {
+		std::vector<ObjCSymbolDefinition> symbols;
+		// Addresses to define as objc_protocol_t pointers
+		std::vector<uint64_t> protocolPointers;
+		// workflow_objc support
+		std::vector<std::pair<uint64_t, uint64_t>> selectorImplementations;
+		std::vector<std::pair<uint64_t, uint64_t>> selectorRefImplementations;
+		// --
+		std::vector<std::pair<uint64_t, Method>> methods;
+
+		void DefineSymbol(BNSymbolType symbolType, Ref<Type> type, std::string name, uint64_t address)
+		{
+			symbols.push_back({symbolType, std::move(type), {}, std::move(name), address});
+		}
+
+		void DefineSymbol(BNSymbolType symbolType, const QualifiedName& typeName, std::string name, uint64_t address)
+		{
+			symbols.push_back({symbolType, nullptr, typeName, std::move(name), address});
+		}
+	};
+
+	struct DecodedClass {
+		view_ptr_t classPtr = 0;
+		Class cls;
+		DecodedObjCMetadata metadata;
+	};
+
 	struct QualifiedNameOrType {
 		BinaryNinja::Ref<BinaryNinja::Type> type = nullptr;
 		BinaryNinja::QualifiedName name;
@@ -197,6 +236,8 @@ namespace DSCObjC {
 		std::map<uint64_t, Protocol> m_protocols;
 		std::unordered_map<uint64_t, std::string> m_selectorCache;
 		std::unordered_map<uint64_t, Method> m_localMethods;
+		// Function types built by ApplyMethodType, keyed by self type, selector and type encoding
+		std::unordered_map<std::string, Ref<Type>> m_methodTypeCache;
 
 		// Required for workflow_objc type heuristics, should be removed when that is no longer a thing.
 		std::map<uint64_t, std::string> m_selRefToName;
@@ -206,21 +247,30 @@ namespace DSCObjC {
 
 
 		std::optional<uint64_t> m_customRelativeMethodSelectorBase = std::nullopt;
+		std::shared_ptr<const SharedCacheCore::ObjCSelectorTable> m_selectorTable;
 		SharedCacheCore::SharedCache* m_cache;
 
 		uint64_t ReadPointerAccountingForRelocations(VMReader* reader);
+		std::string ReadSelectorName(VMReader* reader, view_ptr_t address);
 		std::unordered_map<uint64_t, uint64_t> m_relocationPointerRewrites;
 
 		static Ref<Metadata> SerializeMethod(uint64_t loc, const Method& method);
 		static Ref<Metadata> SerializeClass(uint64_t loc, const Class& cls);
 
 		Ref<Metadata> SerializeMetadata();
-		std::vector<QualifiedNameOrType> ParseEncodedType(const std::string& type);
+		static std::vector<QualifiedNameOrType> ParseEncodedTypeUncached(const std::string& type, size_t addressSize);
+		std::shared_ptr<const std::vector<QualifiedNameOrType>> ParseEncodedType(const std::string& type);
 		void DefineObjCSymbol(BNSymbolType symbolType, QualifiedName typeName, const std::string& name, uint64_t addr, bool deferred);
 		void DefineObjCSymbol(BNSymbolType symbolType, Ref<Type> type, const std::string& name, uint64_t addr, bool deferred);
-		void ReadIvarList(VMReader* reader, ClassBase& cls, std::string_view name, view_ptr_t start);
-		void ReadMethodList(VMReader* reader, ClassBase& cls, std::string_view name, view_ptr_t start);
-		void ReadListOfMethodLists(VMReader* reader, ClassBase& cls, std::string_view name, view_ptr_t start);
+		void ReadIvarList(VMReader* reader, ClassBase& cls, std::string_view name, view_ptr_t start,
+			DecodedObjCMetadata& metadata);
+		void ReadMethodList(VMReader* reader, ClassBase& cls, std::string_view name, view_ptr_t start,
+			std::unordered_map<uint64_t, std::string>& selectorCache, DecodedObjCMetadata& metadata);
+		void ReadListOfMethodLists(VMReader* reader, ClassBase& cls, std::string_view name, view_ptr_t start,
+			std::unordered_map<uint64_t, std::string>& selectorCache, DecodedObjCMetadata& metadata);
+		bool DecodeClass(VMReader* reader, view_ptr_t classPointerLocation, Ref<Type> classPointerType,
+			Ref<Type> protocolListType, std::unordered_map<uint64_t, std::string>& selectorCache, DecodedClass& result);
+		void ApplyDecodedMetadata(DecodedObjCMetadata& metadata);
 		void LoadClasses(VMReader* reader, Ref<Section> listSection);
 		void LoadCategories(VMReader* reader, Ref<Section> listSection);
 		void LoadProtocols(VMReader* reader, Ref<Section> listSection);
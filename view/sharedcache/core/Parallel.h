@@ -0,0 +1,80 @@
+#ifndef SHAREDCACHE_PARALLEL_H
+#define SHAREDCACHE_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * Minimal fork/join helper for the embarrassingly parallel parts of shared cache processing.
+ *
+ * `ParallelFor(count, func)` calls `func(i)` for every i in [0, count) across a bounded set of
+ * threads and returns once all calls have completed. The first exception thrown by any call is
+ * rethrown on the calling thread after all threads have joined.
+ *
+ * Nested calls (a `ParallelFor` issued from inside another one) run serially on the calling
+ * thread, so parallel stages can be composed without oversubscribing the machine.
+ */
+
+namespace SharedCacheCore {
+
+	inline thread_local bool g_inParallelFor = false;
+
+	inline size_t ParallelThreadCount()
+	{
+		return std::max<size_t>(1, std::thread::hardware_concurrency());
+	}
+
+	template <typename Func>
+	void ParallelFor(size_t count, Func&& func)
+	{
+		size_t threadCount = std::min(count, ParallelThreadCount());
+		if (threadCount <= 1 || g_inParallelFor)
+		{
+			for (size_t i = 0; i < count; i++)
+				func(i);
+			return;
+		}
+
+		std::atomic<size_t> next = 0;
+		std::exception_ptr firstException;
+		std::mutex exceptionMutex;
+
+		auto worker = [&]() {
+			g_inParallelFor = true;
+			for (size_t i = next++; i < count; i = next++)
+			{
+				try
+				{
+					func(i);
+				}
+				catch (...)
+				{
+					std::unique_lock<std::mutex> lock(exceptionMutex);
+					if (!firstException)
+						firstException = std::current_exception();
+					// Stop handing out work; in-flight calls on other threads still finish.
+					next = count;
+				}
+			}
+			g_inParallelFor = false;
+		};
+
+		std::vector<std::thread> threads;
+		threads.reserve(threadCount - 1);
+		for (size_t i = 1; i < threadCount; i++)
+			threads.emplace_back(worker);
+		worker();
+		for (auto& thread : threads)
+			thread.join();
+
+		if (firstException)
+			std::rethrow_exception(firstException);
+	}
+
+}
+
+#endif //SHAREDCACHE_PARALLEL_H
@@ -26,8 +26,13 @@
 
 #include "SharedCache.h"
 #include "ObjC.h"
+#include "Parallel.h"
+#include "view/macho/exporttrie.h"
+#include "genericrange.h"
 #include <filesystem>
 #include <mutex>
+#include <set>
+#include <shared_mutex>
 #include <unordered_map>
 #include <utility>
 #include <fcntl.h>
@@ -82,6 +87,32 @@ struct SharedCache::State
 	DSCViewState viewState = DSCViewStateUnloaded;
 };
 
+// Address ranges of every image segment and section and every non-image region.
+// Headers, images and regions are fixed once the initial load is done, so this is built once per view.
+struct SharedCache::AddressIndex
+{
+	struct Range
+	{
+		// Key into `State::headers` for segments and sections, unused for regions.
+		uint64_t header;
+		// `prettyName` for regions, `<identifierPrefix>::<sectname>` for sections.
+		std::string name;
+	};
+	using Ranges = GenericRangeTree<Range>;
+
+	Ranges regions;
+	Ranges segments;
+	Ranges sections;
+
+	// Ranges can overlap (stub islands inside dyld data, for example), in which case the innermost one wins.
+	static const Range* Find(const Ranges& ranges, uint64_t address)
+	{
+		if (auto entry = ranges.GetInnermostContaining(address))
+			return &entry->value;
+		return nullptr;
+	}
+};
+
 struct SharedCache::ViewSpecificState {
 	std::mutex typeLibraryMutex;
 	std::unordered_map<std::string, Ref<TypeLibrary>> typeLibraries;
@@ -92,8 +123,42 @@ struct SharedCache::ViewSpecificState {
 
 	std::mutex stateMutex;
 	std::shared_ptr<struct SharedCache::State> cachedState;
+
+	// The state as currently stored in the view's metadata (the full record plus its deltas),
+	// and the number of delta records stored since the full record was last written.
+	std::shared_ptr<struct SharedCache::State> persistedState;
+	size_t persistedDeltaCount = 0;
+
+	std::mutex symbolIndexMutex;
+	std::shared_ptr<const SymbolIndex> symbolIndex;
+
+	std::mutex addressIndexMutex;
+	std::shared_ptr<const SharedCache::AddressIndex> addressIndex;
+
+	std::mutex objcSelectorTableMutex;
+	std::shared_ptr<const ObjCSelectorTable> objcSelectorTable;
+
+	// Export at each address FindSymbolAtAddrAndApplyToAddr has resolved, or nullopt when there is none, so
+	// popular call targets are only looked up once. Cleared whenever an image or section is loaded.
+	struct ResolvedExport
+	{
+		BNSymbolType type;
+		std::string name;
+		std::string installName;
+	};
+	std::shared_mutex resolvedExportsMutex;
+	std::unordered_map<uint64_t, std::optional<ResolvedExport>> resolvedExports;
+
+	void ClearResolvedExports()
+	{
+		std::unique_lock lock(resolvedExportsMutex);
+		resolvedExports.clear();
+	}
 };
 
+// Once this many delta records have accumulated they are compacted into a new full record.
+static constexpr size_t MaxMetadataDeltaCount = 32;
+
 
 std::shared_ptr<SharedCache::ViewSpecificState> ViewSpecificStateForId(uint64_t viewIdentifier, bool insertIfNeeded = true) {
 	static std::mutex viewSpecificStateMutex;
@@ -272,6 +337,8 @@ uint64_t SharedCache::FastGetBackingCacheCount(BinaryNinja::Ref<BinaryNinja::Bin
 
 void SharedCache::PerformInitialLoad()
 {
+	static InstrumentationHistogram histogram("sharedcache.initial_load");
+	InstrumentationScope scope(histogram);
 	m_logger->LogInfo("Performing initial load of Shared Cache");
 	auto path = m_dscView->GetFile()->GetOriginalFilename();
 	auto baseFile = MMappedFileAccessor::Open(m_dscView, m_dscView->GetFile()->GetSessionId(), path)->lock();
@@ -280,6 +347,11 @@ void SharedCache::PerformInitialLoad()
 
 	WillMutateState();
 
+	{
+		std::lock_guard lock(m_viewSpecificState->addressIndexMutex);
+		m_viewSpecificState->addressIndex.reset();
+	}
+
 	MutableState().baseFilePath = path;
 
 	DataBuffer sig = baseFile->ReadBuffer(0, 4);
@@ -776,6 +848,7 @@ void SharedCache::PerformInitialLoad()
 		m_logger->LogError("Failed to map VM pages for Shared Cache on initial load, this is fatal.");
 		return;
 	}
+	ApplySlideInfoForAllFiles(vm);
 	for (const auto& start : State().imageStarts)
 	{
 		try {
@@ -969,12 +1042,137 @@ void SharedCache::PerformInitialLoad()
 	m_viewSpecificState->progress = LoadProgressFinished;
 }
 
+std::string to_hex_string(uint64_t value)
+{
+	std::stringstream ss;
+	ss << std::hex << value;
+	return ss.str();
+}
+
+
+uint64_t SharedCache::SlideBaseAddress() const
+{
+	uint64_t base = UINT64_MAX;
+	for (const auto& backingCache : State().backingCaches)
+	{
+		for (const auto& mapping : backingCache.mappings)
+		{
+			if (mapping.address < base)
+			{
+				base = mapping.address;
+				break;
+			}
+		}
+	}
+	return base;
+}
+
+
+bool SharedCache::SlidImageCachingEnabled() const
+{
+	auto settings = m_dscView->GetLoadSettings(VIEW_NAME);
+	return settings && settings->Contains("loader.dsc.cacheSlidImages")
+		&& settings->Get<bool>("loader.dsc.cacheSlidImages", m_dscView);
+}
+
+
+// Slid images are keyed by the UUID of the individual cache file and the value slide info rebases against,
+// which together fully determine the contents of the slid file.
+static std::string SlidImageCachePath(const dyld_cache_header& header, uint64_t base)
+{
+	static const char hexDigits[] = "0123456789abcdef";
+	std::string name;
+	for (auto byte : header.uuid)
+	{
+		name += hexDigits[byte >> 4];
+		name += hexDigits[byte & 0xf];
+	}
+	name += "-" + to_hex_string(base) + ".slid";
+	return (std::filesystem::path(GetUserDirectory()) / "dsc_slid_images" / name).string();
+}
+
+
+void SharedCache::RegisterCachedSlidImages()
+{
+	// Only look each backing file up once per process; the lookup requires reading its header from disk.
+	static std::mutex checkedMutex;
+	static std::set<std::string> checked;
+
+	uint64_t base = SlideBaseAddress();
+	for (const auto& cache : State().backingCaches)
+	{
+		auto path = ResolveFilePath(m_dscView, cache.path);
+		{
+			std::scoped_lock<std::mutex> lock(checkedMutex);
+			if (!checked.insert(path).second)
+				continue;
+		}
+
+		dyld_cache_header header {};
+		FILE* fp = fopen(path.c_str(), "rb");
+		if (!fp)
+			continue;
+		bool readHeader = fread(&header, sizeof(header), 1, fp) == 1;
+		fclose(fp);
+		if (!readHeader)
+			continue;
+
+		std::error_code ec;
+		auto slidImagePath = SlidImageCachePath(header, base);
+		auto slidSize = std::filesystem::file_size(slidImagePath, ec);
+		if (ec || slidSize != std::filesystem::file_size(path, ec) || ec)
+			continue;
+
+		m_logger->LogDebug("Using cached slid image %s for %s", slidImagePath.c_str(), path.c_str());
+		MMappedFileAccessor::RegisterSlidImage(path, slidImagePath);
+	}
+}
+
+
+void SharedCache::StoreSlidImage(std::shared_ptr<MMappedFileAccessor> file, const dyld_cache_header& header, uint64_t base)
+{
+	auto slidImagePath = SlidImageCachePath(header, base);
+	auto tempPath = slidImagePath + ".tmp";
+	std::error_code ec;
+	std::filesystem::create_directories(std::filesystem::path(slidImagePath).parent_path(), ec);
+	if (ec)
+	{
+		m_logger->LogWarn("Failed to create slid image cache directory: %s", ec.message().c_str());
+		return;
+	}
+
+	// Write to a temporary file and rename it into place so concurrent sessions never map a partial image.
+	FILE* fp = fopen(tempPath.c_str(), "wb");
+	if (!fp)
+	{
+		m_logger->LogWarn("Failed to write slid image %s", tempPath.c_str());
+		return;
+	}
+	bool written = fwrite(file->Data(), 1, file->Length(), fp) == file->Length();
+	written = (fclose(fp) == 0) && written;
+	if (written)
+		std::filesystem::rename(tempPath, slidImagePath, ec);
+	if (!written || ec)
+	{
+		m_logger->LogWarn("Failed to write slid image %s", slidImagePath.c_str());
+		std::filesystem::remove(tempPath, ec);
+		return;
+	}
+
+	m_logger->LogDebug("Cached slid image for %s at %s", file->Path().c_str(), slidImagePath.c_str());
+	MMappedFileAccessor::RegisterSlidImage(file->Path(), slidImagePath);
+}
+
+
 std::shared_ptr<VM> SharedCache::GetVMMap(bool mapPages)
 {
 	std::shared_ptr<VM> vm = std::make_shared<VM>(0x1000);
 
 	if (mapPages)
 	{
+		if (SlidImageCachingEnabled())
+			RegisterCachedSlidImages();
+
 		for (const auto& cache : State().backingCaches)
 		{
 			for (const auto& mapping : cache.mappings)
@@ -1004,7 +1202,32 @@ void SharedCache::DeserializeFromRawView()
 		}
 		else
 		{
-			LoadFromString(m_dscView->GetStringMetadata(SharedCacheMetadataTag));
+			LoadFromMetadata(m_dscView->QueryMetadata(SharedCacheMetadataTag));
+
+			size_t deltaCount = 0;
+			if (m_metadataValid)
+			{
+				if (auto count = m_dscView->QueryMetadata(SharedCacheDeltaCountMetadataTag); count && count->IsUnsignedInteger())
+					deltaCount = count->GetUnsignedInteger();
+			}
+			for (size_t i = 0; i < deltaCount && m_metadataValid; i++)
+			{
+				DeserializationContext context;
+				if (!ParseMetadataDocument(m_dscView->QueryMetadata(SharedCacheDeltaMetadataTagPrefix + std::to_string(i)), context.doc))
+				{
+					m_metadataValid = false;
+					break;
+				}
+				LoadDelta(context);
+			}
+
+			if (m_metadataValid)
+			{
+				m_stateIsShared = true;
+				m_viewSpecificState->cachedState = m_state;
+				m_viewSpecificState->persistedState = m_state;
+				m_viewSpecificState->persistedDeltaCount = deltaCount;
+			}
 		}
 		if (!m_metadataValid)
 		{
@@ -1023,11 +1246,33 @@ void SharedCache::DeserializeFromRawView()
 }
 
 
-std::string to_hex_string(uint64_t value)
+void SharedCache::ApplySlideInfoForAllFiles(std::shared_ptr<VM> vm)
 {
-	std::stringstream ss;
-	ss << std::hex << value;
-	return ss.str();
+	// Slide info is otherwise applied lazily the first time each backing file is touched, which
+	// serializes it behind whichever image header happens to be read first. Sliding every backing
+	// file up front lets the work run in parallel across files.
+	std::vector<std::shared_ptr<LazyMappedFileAccessor>> accessors;
+	for (const auto& cache : State().backingCaches)
+	{
+		if (cache.mappings.empty() || !vm->AddressIsMapped(cache.mappings[0].address))
+			continue;
+		accessors.push_back(vm->MappingAtAddress(cache.mappings[0].address).first.fileAccessor);
+	}
+
+	// If we can't keep every file open at once, pre-applying would just evict files we already slid.
+	if (accessors.size() > MMappedFileAccessor::MaxOpenFileCount())
+	{
+		m_logger->LogDebug("Not pre-applying slide info: %zu backing files exceed the open file limit", accessors.size());
+		return;
+	}
+
+	Ref<BackgroundTask> task = new BackgroundTask("Applying slide info...", false);
+	std::atomic<size_t> filesDone = 0;
+	ParallelFor(accessors.size(), [&](size_t i) {
+		accessors[i]->lock();
+		task->SetProgress(++filesDone, accessors.size());
+	});
+	task->Finish();
 }
 
 
@@ -1036,23 +1281,9 @@ void SharedCache::ParseAndApplySlideInfoForFile(std::shared_ptr<MMappedFileAcces
 	if (file->SlideInfoWasApplied())
 		return;
 
-	WillMutateState();
-	std::vector<std::pair<uint64_t, uint64_t>> rewrites;
-
 	dyld_cache_header baseHeader;
 	file->Read(&baseHeader, 0, sizeof(dyld_cache_header));
-	uint64_t base = UINT64_MAX;
-	for (const auto& backingCache : State().backingCaches)
-	{
-		for (const auto& mapping : backingCache.mappings)
-		{
-			if (mapping.address < base)
-			{
-				base = mapping.address;
-				break;
-			}
-		}
-	}
+	uint64_t base = SlideBaseAddress();
 
 	std::vector<std::pair<uint64_t, MappingInfo>> mappings;
 
@@ -1144,6 +1375,22 @@ void SharedCache::ParseAndApplySlideInfoForFile(std::shared_ptr<MMappedFileAcces
 		return;
 	}
 
+	// Every page's rebase chain is self contained, so pages are processed in parallel chunks, each
+	// collecting its own rewrites. Nothing is written back until all chunks are done reading.
+	constexpr size_t pagesPerChunk = 256;
+	std::vector<std::vector<std::pair<uint64_t, uint64_t>>> chunkRewrites;
+	auto rebasePages = [&](size_t pageStartCount, const auto& rebasePage) {
+		size_t chunkCount = (pageStartCount + pagesPerChunk - 1) / pagesPerChunk;
+		size_t firstChunk = chunkRewrites.size();
+		chunkRewrites.resize(firstChunk + chunkCount);
+		ParallelFor(chunkCount, [&](size_t chunk) {
+			auto& chunkOutput = chunkRewrites[firstChunk + chunk];
+			size_t end = std::min(pageStartCount, (chunk + 1) * pagesPerChunk);
+			for (size_t i = chunk * pagesPerChunk; i < end; i++)
+				rebasePage(i, chunkOutput);
+		});
+	};
+
 	for (const auto& [off, mapping] : mappings)
 	{
 		m_logger->LogDebug("Slide Info Version: %d", mapping.slideInfoVersion);
@@ -1158,16 +1405,15 @@ void SharedCache::ParseAndApplySlideInfoForFile(std::shared_ptr<MMappedFileAcces
 			pageStartCount = mapping.slideInfoV2.page_starts_count;
 			pageSize = mapping.slideInfoV2.page_size;
 			extrasOffset += mapping.slideInfoV2.page_extras_offset;
-			auto cursor = pageStartsOffset;
 
-			for (size_t i = 0; i < pageStartCount; i++)
+			rebasePages(pageStartCount, [&](size_t i, std::vector<std::pair<uint64_t, uint64_t>>& rewrites)
 			{
+				auto cursor = pageStartsOffset + (i * sizeof(uint16_t));
 				try
 				{
 					uint16_t start = mapping.file->ReadUShort(cursor);
-					cursor += sizeof(uint16_t);
 					if (start == DYLD_CACHE_SLIDE_PAGE_ATTR_NO_REBASE)
-						continue;
+						return;
 
 					auto rebaseChain = [&](const dyld_cache_slide_info_v2& slideInfo, uint64_t pageContent, uint16_t startOffset)
 					{
@@ -1240,23 +1486,22 @@ void SharedCache::ParseAndApplySlideInfoForFile(std::shared_ptr<MMappedFileAcces
 				{
 					m_logger->LogError("Failed to read v2 slide info at 0x%llx\n", cursor);
 				}
-			}
+			});
 		}
 		else if (mapping.slideInfoVersion == 3) {
 			// Slide Info Version 3 Logic
 			pageStartsOffset += sizeof(dyld_cache_slide_info_v3);
 			pageStartCount = mapping.slideInfoV3.page_starts_count;
 			pageSize = mapping.slideInfoV3.page_size;
-			auto cursor = pageStartsOffset;
 
-			for (size_t i = 0; i < pageStartCount; i++)
+			rebasePages(pageStartCount, [&](size_t i, std::vector<std::pair<uint64_t, uint64_t>>& rewrites)
 			{
+				auto cursor = pageStartsOffset + (i * sizeof(uint16_t));
 				try
 				{
 					uint16_t delta = mapping.file->ReadUShort(cursor);
-					cursor += sizeof(uint16_t);
 					if (delta == DYLD_CACHE_SLIDE_V3_PAGE_ATTR_NO_REBASE)
-						continue;
+						return;
 
 					delta = delta/sizeof(uint64_t); // initial offset is byte based
 					uint64_t loc = mapping.mappingInfo.fileOffset + (pageSize * i);
@@ -1295,23 +1540,22 @@ void SharedCache::ParseAndApplySlideInfoForFile(std::shared_ptr<MMappedFileAcces
 				{
 					m_logger->LogError("Failed to read v3 slide info at 0x%llx\n", cursor);
 				}
-			}
+			});
 		}
 		else if (mapping.slideInfoVersion == 5)
 		{
 			pageStartsOffset += sizeof(dyld_cache_slide_info5);
 			pageStartCount = mapping.slideInfoV5.page_starts_count;
 			pageSize = mapping.slideInfoV5.page_size;
-			auto cursor = pageStartsOffset;
 
-			for (size_t i = 0; i < pageStartCount; i++)
+			rebasePages(pageStartCount, [&](size_t i, std::vector<std::pair<uint64_t, uint64_t>>& rewrites)
 			{
+				auto cursor = pageStartsOffset + (i * sizeof(uint16_t));
 				try
 				{
 					uint16_t delta = mapping.file->ReadUShort(cursor);
-					cursor += sizeof(uint16_t);
 					if (delta == DYLD_CACHE_SLIDE_V5_PAGE_ATTR_NO_REBASE)
-						continue;
+						return;
 
 					delta = delta/sizeof(uint64_t); // initial offset is byte based
 					uint64_t loc = mapping.mappingInfo.fileOffset + (pageSize * i);
@@ -1345,9 +1589,19 @@ void SharedCache::ParseAndApplySlideInfoForFile(std::shared_ptr<MMappedFileAcces
 				{
 					m_logger->LogError("Failed to read v5 slide info at 0x%llx\n", cursor);
 				}
-			}
+			});
 		}
 	}
+
+	std::vector<std::pair<uint64_t, uint64_t>> rewrites;
+	size_t rewriteCount = 0;
+	for (const auto& chunk : chunkRewrites)
+		rewriteCount += chunk.size();
+	rewrites.reserve(rewriteCount);
+	for (auto& chunk : chunkRewrites)
+		rewrites.insert(rewrites.end(), chunk.begin(), chunk.end());
+	chunkRewrites.clear();
+
 	for (const auto& [loc, value] : rewrites)
 	{
 		file->WritePointer(loc, value);
@@ -1376,6 +1630,9 @@ void SharedCache::ParseAndApplySlideInfoForFile(std::shared_ptr<MMappedFileAcces
 	}
 	m_logger->LogDebug("Applied slide info for %s (0x%llx rewrites)", file->Path().c_str(), rewrites.size());
 	file->SetSlideInfoWasApplied(true);
+
+	if (!rewrites.empty() && SlidImageCachingEnabled())
+		StoreSlidImage(file, baseHeader, base);
 }
 
 
@@ -1451,76 +1708,92 @@ SharedCache* SharedCache::GetFromDSCView(BinaryNinja::Ref<BinaryNinja::BinaryVie
 
 std::optional<uint64_t> SharedCache::GetImageStart(std::string installName)
 {
-	for (const auto& [name, start] : State().imageStarts)
-	{
-		if (name == installName)
-		{
-			return start;
-		}
-	}
+	if (auto it = State().imageStarts.find(installName); it != State().imageStarts.end())
+		return it->second;
 	return {};
 }
 
-std::optional<SharedCacheMachOHeader> SharedCache::HeaderForAddress(uint64_t address)
+std::shared_ptr<const SharedCache::AddressIndex> SharedCache::GetAddressIndex()
 {
-	// We _could_ mark each page with the image start? :grimacing emoji:
-	// But that'd require mapping pages :grimacing emoji: :grimacing emoji:
-	// There's not really any other hacks that could make this faster, that I can think of...
-	for (const auto& [start, header] : State().headers)
+	std::lock_guard lock(m_viewSpecificState->addressIndexMutex);
+	if (m_viewSpecificState->addressIndex)
+		return m_viewSpecificState->addressIndex;
+
+	std::vector<AddressIndex::Ranges::Entry> regions, segments, sections;
+	for (const auto* regionList : {&State().stubIslandRegions, &State().dyldDataRegions, &State().nonImageRegions})
 	{
-		for (const auto& segment : header.segments)
+		for (const auto& region : *regionList)
 		{
-			if (segment.vmaddr <= address && segment.vmaddr + segment.vmsize > address)
-			{
-				return header;
-			}
+			if (region.size)
+				regions.push_back({region.start, region.start + region.size - 1, {0, region.prettyName}});
 		}
 	}
-	return {};
-}
-
-std::string SharedCache::NameForAddress(uint64_t address)
-{
-	for (const auto& stubIsland : State().stubIslandRegions)
+	for (const auto& [start, header] : State().headers)
 	{
-		if (stubIsland.start <= address && stubIsland.start + stubIsland.size > address)
+		for (const auto& segment : header.segments)
 		{
-			return stubIsland.prettyName;
+			if (segment.vmsize)
+				segments.push_back({segment.vmaddr, segment.vmaddr + segment.vmsize - 1, {start, {}}});
 		}
-	}
-	for (const auto& dyldData : State().dyldDataRegions)
-	{
-		if (dyldData.start <= address && dyldData.start + dyldData.size > address)
+		for (const auto& section : header.sections)
 		{
-			return dyldData.prettyName;
+			if (!section.size)
+				continue;
+			char sectionName[17];
+			strncpy(sectionName, section.sectname, 16);
+			sectionName[16] = '\0';
+			sections.push_back({section.addr, section.addr + section.size - 1,
+				{start, header.identifierPrefix + "::" + sectionName}});
 		}
 	}
-	for (const auto& nonImageRegion : State().nonImageRegions)
+
+	auto index = std::make_shared<AddressIndex>();
+	index->regions = AddressIndex::Ranges(std::move(regions));
+	index->segments = AddressIndex::Ranges(std::move(segments));
+	index->sections = AddressIndex::Ranges(std::move(sections));
+
+	// Only cache once the headers are known; before that the index would be empty.
+	if (!State().headers.empty())
+		m_viewSpecificState->addressIndex = index;
+	return index;
+}
+
+const SharedCacheMachOHeader* SharedCache::FindHeaderForAddress(uint64_t address)
+{
+	auto index = GetAddressIndex();
+	if (auto segment = AddressIndex::Find(index->segments, address))
 	{
-		if (nonImageRegion.start <= address && nonImageRegion.start + nonImageRegion.size > address)
-		{
-			return nonImageRegion.prettyName;
-		}
+		if (auto it = State().headers.find(segment->header); it != State().headers.end())
+			return &it->second;
 	}
-	if (auto header = HeaderForAddress(address))
+	return nullptr;
+}
+
+std::optional<SharedCacheMachOHeader> SharedCache::HeaderForAddress(uint64_t address)
+{
+	if (auto header = FindHeaderForAddress(address))
+		return *header;
+	return {};
+}
+
+std::string SharedCache::NameForAddress(uint64_t address)
+{
+	auto index = GetAddressIndex();
+	if (auto region = AddressIndex::Find(index->regions, address))
+		return region->name;
+	// A section only counts if its image's segments also cover the address, as with `HeaderForAddress`.
+	if (auto section = AddressIndex::Find(index->sections, address))
 	{
-		for (const auto& section : header->sections)
-		{
-			if (section.addr <= address && section.addr + section.size > address)
-			{
-				char sectionName[17];
-				strncpy(sectionName, section.sectname, 16);
-				sectionName[16] = '\0';
-				return header->identifierPrefix + "::" + sectionName;
-			}
-		}
+		auto segment = AddressIndex::Find(index->segments, address);
+		if (segment && segment->header == section->header)
+			return section->name;
 	}
 	return "";
 }
 
 std::string SharedCache::ImageNameForAddress(uint64_t address)
 {
-	if (auto header = HeaderForAddress(address))
+	if (auto header = FindHeaderForAddress(address))
 	{
 		return header->identifierPrefix;
 	}
@@ -1689,6 +1962,8 @@ bool SharedCache::LoadSectionAtAddress(uint64_t address)
 		SharedCache::InitializeHeader(m_dscView, vm.get(), targetHeader, {targetSegment});
 	}
 
+	m_viewSpecificState->ClearResolvedExports();
+
 	m_dscView->AddAnalysisOption("linearsweep");
 	m_dscView->UpdateAnalysis();
 
@@ -1774,91 +2049,123 @@ void SharedCache::ProcessAllObjCSections()
 
 bool SharedCache::LoadImageWithInstallName(std::string installName, bool skipObjC)
 {
+	return LoadImagesWithInstallNames({std::move(installName)}, skipObjC);
+}
+
+bool SharedCache::LoadImagesWithInstallNames(const std::vector<std::string>& installNames, bool skipObjC)
+{
+	static InstrumentationHistogram histogram("sharedcache.load_images");
+	InstrumentationScope scope(histogram);
 	auto settings = m_dscView->GetLoadSettings(VIEW_NAME);
 
+	bool allowLoadingLinkedit = false;
+	if (settings && settings->Contains("loader.dsc.allowLoadingLinkeditSegments"))
+		allowLoadingLinkedit = settings->Get<bool>("loader.dsc.allowLoadingLinkeditSegments", m_dscView);
+
 	std::unique_lock lock(m_viewSpecificState->viewOperationsThatInfluenceMetadataMutex);
 
 	DeserializeFromRawView();
 	WillMutateState();
 
-	m_logger->LogInfo("Loading image %s", installName.c_str());
-
 	auto vm = GetVMMap();
-	CacheImage* targetImage = nullptr;
 
-	for (auto& cacheImage : MutableState().images)
+	struct PendingImage
 	{
-		if (cacheImage.installName == installName)
-		{
-			targetImage = &cacheImage;
-			break;
-		}
-	}
-	auto it = State().headers.find(targetImage->headerLocation);
-	if (it == State().headers.end())
-	{
-		return false;
-	}
-	const auto& header = it->second;
+		CacheImage* image;
+		std::vector<MemoryRegion*> regionsToLoad;
+		std::optional<SharedCacheMachOHeader> header;
+	};
+	std::vector<PendingImage> pendingImages;
+	bool loadedAll = true;
 
 	auto id = m_dscView->BeginUndoActions();
-	MutableState().viewState = DSCViewStateLoadedWithImages;
 
 	auto reader = VMReader(vm);
-	reader.Seek(targetImage->headerLocation);
-
-	std::vector<MemoryRegion*> regionsToLoad;
-
-	for (auto& region : targetImage->regions)
+	for (const auto& installName : installNames)
 	{
-		bool allowLoadingLinkedit = false;
-		if (settings && settings->Contains("loader.dsc.allowLoadingLinkeditSegments"))
-			allowLoadingLinkedit = settings->Get<bool>("loader.dsc.allowLoadingLinkeditSegments", m_dscView);
-		if ((region.prettyName.find("__LINKEDIT") != std::string::npos) && !allowLoadingLinkedit)
-			continue;
+		m_logger->LogInfo("Loading image %s", installName.c_str());
 
-		if (region.loaded)
+		CacheImage* targetImage = nullptr;
+		for (auto& cacheImage : MutableState().images)
+		{
+			if (cacheImage.installName == installName)
+			{
+				targetImage = &cacheImage;
+				break;
+			}
+		}
+		if (!targetImage || State().headers.find(targetImage->headerLocation) == State().headers.end())
 		{
-			m_logger->LogDebug("Skipping region %s as it is already loaded.", region.prettyName.c_str());
+			m_logger->LogError("Failed to find image %s", installName.c_str());
+			loadedAll = false;
 			continue;
 		}
 
-		auto targetFile = vm->MappingAtAddress(region.start).first.fileAccessor->lock();
-		ParseAndApplySlideInfoForFile(targetFile);
+		MutableState().viewState = DSCViewStateLoadedWithImages;
+
+		std::vector<MemoryRegion*> regionsToLoad;
+		for (auto& region : targetImage->regions)
+		{
+			if ((region.prettyName.find("__LINKEDIT") != std::string::npos) && !allowLoadingLinkedit)
+				continue;
+
+			if (region.loaded)
+			{
+				m_logger->LogDebug("Skipping region %s as it is already loaded.", region.prettyName.c_str());
+				continue;
+			}
+
+			auto targetFile = vm->MappingAtAddress(region.start).first.fileAccessor->lock();
+			ParseAndApplySlideInfoForFile(targetFile);
+
+			auto buff = reader.ReadBuffer(region.start, region.size);
 
-		auto buff = reader.ReadBuffer(region.start, region.size);
+			region.loaded = true;
 
-		region.loaded = true;
+			MutableState().regionsMappedIntoMemory.push_back(region);
+			m_dscView->GetMemoryMap()->AddDataMemoryRegion(region.prettyName, region.start, buff, region.flags);
 
-		MutableState().regionsMappedIntoMemory.push_back(region);
-		m_dscView->GetMemoryMap()->AddDataMemoryRegion(region.prettyName, region.start, buff, region.flags);
+			regionsToLoad.push_back(&region);
+		}
+
+		if (regionsToLoad.empty())
+		{
+			m_logger->LogWarn("No regions to load for image %s", installName.c_str());
+			loadedAll = false;
+			continue;
+		}
 
-		regionsToLoad.push_back(&region);
+		TypeLibraryForImage(State().headers.at(targetImage->headerLocation).installName);
+		pendingImages.push_back({targetImage, std::move(regionsToLoad), std::nullopt});
 	}
 
-	if (regionsToLoad.empty())
+	if (pendingImages.empty())
 	{
-		m_logger->LogWarn("No regions to load for image %s", installName.c_str());
+		m_dscView->CommitUndoActions(id);
 		return false;
 	}
 
-	auto typeLib = TypeLibraryForImage(header.installName);
-
 	SaveToDSCView();
 
-	auto h = SharedCache::LoadHeaderForAddress(vm, targetImage->headerLocation, installName);
-	if (!h.has_value())
-	{
-		return false;
-	}
+	// Header parsing only reads from the VM, so it can be done for all images at once.
+	ParallelFor(pendingImages.size(), [&](size_t i) {
+		auto& pending = pendingImages[i];
+		pending.header = LoadHeaderForAddress(vm, pending.image->headerLocation, pending.image->installName);
+	});
 
-	std::vector<MemoryRegion*> regions;
-	for (auto& region : regionsToLoad)
+	// Define the symbols of every image in a single bulk modification.
+	m_dscView->BeginBulkModifySymbols();
+	for (auto& pending : pendingImages)
 	{
-		regions.push_back(region);
+		if (!pending.header)
+		{
+			m_logger->LogError("Failed to load header for image %s", pending.image->installName.c_str());
+			loadedAll = false;
+			continue;
+		}
+		SharedCache::InitializeHeader(m_dscView, vm.get(), *pending.header, pending.regionsToLoad);
 	}
-
-	SharedCache::InitializeHeader(m_dscView, vm.get(), *h, regions);
+	m_dscView->EndBulkModifySymbols();
 
 	if (!skipObjC)
 	{
@@ -1866,15 +2173,24 @@ bool SharedCache::LoadImageWithInstallName(std::string installName, bool skipObj
 		bool processObjCMetadata;
 		GetObjCSettings(m_dscView, &processCFStrings, &processObjCMetadata);
 
-		ProcessObjCSectionsForImageWithName(h->identifierPrefix, vm, std::make_shared<DSCObjC::DSCObjCProcessor>(m_dscView, this, false), processCFStrings, processObjCMetadata, m_logger);
+		for (auto& pending : pendingImages)
+		{
+			if (!pending.header)
+				continue;
+			ProcessObjCSectionsForImageWithName(pending.header->identifierPrefix, vm,
+				std::make_shared<DSCObjC::DSCObjCProcessor>(m_dscView, this, false), processCFStrings, processObjCMetadata,
+				m_logger);
+		}
 	}
 
+	m_viewSpecificState->ClearResolvedExports();
+
 	m_dscView->AddAnalysisOption("linearsweep");
 	m_dscView->UpdateAnalysis();
 
 	m_dscView->CommitUndoActions(id);
 
-	return true;
+	return loadedAll;
 }
 
 std::optional<SharedCacheMachOHeader> SharedCache::LoadHeaderForAddress(std::shared_ptr<VM> vm, uint64_t address, std::string installName)
@@ -2717,93 +3033,65 @@ void SharedCache::InitializeHeader(
 }
 
 
-void SharedCache::ReadExportNode(std::vector<Ref<Symbol>>& symbolList, const SharedCacheMachOHeader& header,
-	const uint8_t* begin, const uint8_t* end, const uint8_t* current, uint64_t textBase, const std::string& currentText)
+std::vector<std::pair<uint64_t, std::pair<BNSymbolType, std::string>>> SharedCache::ParseExportTrieEntries(
+	std::shared_ptr<MMappedFileAccessor> linkeditFile, const SharedCacheMachOHeader& header)
 {
-	if (current >= end)
-		throw ReadException();
+	if (!header.exportTrie.datasize) {
+		return {};
+	}
 
-	uint64_t terminalSize = readValidULEB128(current, end);
-	const uint8_t* child = current + terminalSize;
-	if (terminalSize != 0) {
-		uint64_t imageOffset = 0;
-		uint64_t flags = readValidULEB128(current, end);
-		if (!(flags & EXPORT_SYMBOL_FLAGS_REEXPORT))
-		{
-			imageOffset = readValidULEB128(current, end);
-			if (!currentText.empty() && textBase + imageOffset)
+	try
+	{
+		std::vector<std::pair<uint64_t, std::pair<BNSymbolType, std::string>>> exportList;
+		auto [begin, end] = linkeditFile->ReadSpan(header.exportTrie.dataoff, header.exportTrie.datasize);
+		uint64_t textBase = header.textBase;
+		WalkExportTrie(begin, end, [&](std::string_view name, uint64_t, uint64_t imageOffset) {
+			uint64_t address = textBase + imageOffset;
+			if (name.empty() || !address)
+				return;
+
+			uint32_t flags = 0;
+			for (const auto& s : header.sections)
 			{
-				uint32_t flags;
-				BNSymbolType type;
-				for (auto s : header.sections)
+				if (s.addr < address && s.addr + s.size > address)
 				{
-					if (s.addr < textBase + imageOffset)
-					{
-						if (s.addr + s.size > textBase + imageOffset)
-						{
-							flags = s.flags;
-							break;
-						}
-					}
+					flags = s.flags;
+					break;
 				}
-				if ((flags & S_ATTR_PURE_INSTRUCTIONS) == S_ATTR_PURE_INSTRUCTIONS
-					|| (flags & S_ATTR_SOME_INSTRUCTIONS) == S_ATTR_SOME_INSTRUCTIONS)
-					type = FunctionSymbol;
-				else
-					type = DataSymbol;
-
-#if EXPORT_TRIE_DEBUG
-					// BNLogInfo("export: %s -> 0x%llx", n.text.c_str(), image.baseAddress + n.offset);
-#endif
-				// TODO: The usual `Symbol` constructors take a `NameSpace` and do unnecessary memory allocations
-				// to pass its fields down to the core API. Here we pass nullptr for the namespace which is treated
-				// the same, but avoids the memory allocations. Switch back to directly constructing a `Symbol`
-				// once it gains constructors without that overhead.
-				auto symbol = new Symbol(BNCreateSymbol(type, currentText.c_str(), currentText.c_str(),
-					currentText.c_str(), textBase + imageOffset, NoBinding, nullptr, 0));
-				symbolList.push_back(symbol);
 			}
-		}
+			BNSymbolType type;
+			if ((flags & S_ATTR_PURE_INSTRUCTIONS) == S_ATTR_PURE_INSTRUCTIONS
+				|| (flags & S_ATTR_SOME_INSTRUCTIONS) == S_ATTR_SOME_INSTRUCTIONS)
+				type = FunctionSymbol;
+			else
+				type = DataSymbol;
+			exportList.push_back({address, {type, std::string(name)}});
+		});
+		return exportList;
 	}
-	current = child;
-	uint8_t childCount = *current++;
-	std::string childText = currentText;
-	for (uint8_t i = 0; i < childCount; ++i)
+	catch (std::exception& e)
 	{
-		if (current >= end)
-			throw ReadException();
-		auto it = std::find(current, end, 0);
-		childText.append(current, it);
-		current = it + 1;
-		if (current >= end)
-			throw ReadException();
-		auto next = readValidULEB128(current, end);
-		if (next == 0)
-			throw ReadException();
-		ReadExportNode(symbolList, header, begin, end, begin + next, textBase, childText);
-		childText.resize(currentText.size());
+		BNLogError("Failed to load Export Trie");
+		return {};
 	}
 }
 
 
 std::vector<Ref<Symbol>> SharedCache::ParseExportTrie(std::shared_ptr<MMappedFileAccessor> linkeditFile, const SharedCacheMachOHeader& header)
 {
-	if (!header.exportTrie.datasize) {
-		return {};
-	}
-
-	try
-	{
-		std::vector<Ref<Symbol>> symbols;
-		auto [begin, end] = linkeditFile->ReadSpan(header.exportTrie.dataoff, header.exportTrie.datasize);
-		ReadExportNode(symbols, header, begin, end, begin, header.textBase, "");
-		return symbols;
-	}
-	catch (std::exception& e)
+	std::vector<Ref<Symbol>> symbols;
+	auto exportList = ParseExportTrieEntries(linkeditFile, header);
+	symbols.reserve(exportList.size());
+	for (const auto& [address, typeAndName] : exportList)
 	{
-		BNLogError("Failed to load Export Trie");
-		return {};
+		// TODO: The usual `Symbol` constructors take a `NameSpace` and do unnecessary memory allocations
+		// to pass its fields down to the core API. Here we pass nullptr for the namespace which is treated
+		// the same, but avoids the memory allocations. Switch back to directly constructing a `Symbol`
+		// once it gains constructors without that overhead.
+		const char* name = typeAndName.second.c_str();
+		symbols.push_back(new Symbol(BNCreateSymbol(typeAndName.first, name, name, name, address, NoBinding, nullptr, 0)));
 	}
+	return symbols;
 }
 
 std::vector<std::string> SharedCache::GetAvailableImages()
@@ -2817,44 +3105,112 @@ std::vector<std::string> SharedCache::GetAvailableImages()
 }
 
 
-std::vector<std::pair<std::string, Ref<Symbol>>> SharedCache::LoadAllSymbolsAndWait()
+std::vector<ImageSummary> SharedCache::GetImageSummaries()
 {
-	WillMutateState();
+	std::vector<ImageSummary> summaries;
+	summaries.reserve(State().headers.size());
+	for (const auto& [address, header] : State().headers)
+	{
+		// `segments` doesn't include __LINKEDIT, which is shared by every image in the cache.
+		uint64_t size = 0;
+		for (const auto& segment : header.segments)
+			size += segment.vmsize;
+		summaries.push_back({header.installName, address, size, header.segments.size()});
+	}
+	std::sort(summaries.begin(), summaries.end(),
+		[](const ImageSummary& a, const ImageSummary& b) { return a.headerAddress < b.headerAddress; });
+	return summaries;
+}
 
-	std::lock_guard initialLoadBlock(m_viewSpecificState->viewOperationsThatInfluenceMetadataMutex);
 
-	std::vector<std::pair<std::string, Ref<Symbol>>> symbols;
-	for (const auto& img : State().images)
+std::shared_ptr<const SymbolIndex> SharedCache::LoadSymbolIndex()
+{
 	{
-		auto header = HeaderForAddress(img.headerLocation);
-		std::shared_ptr<MMappedFileAccessor> mapping;
-		try {
-			mapping = MMappedFileAccessor::Open(m_dscView, m_dscView->GetFile()->GetSessionId(), header->exportTriePath)->lock();
-		}
-		catch (...)
+		std::lock_guard lock(m_viewSpecificState->symbolIndexMutex);
+		if (m_viewSpecificState->symbolIndex)
+			return m_viewSpecificState->symbolIndex;
+	}
+
+	WillMutateState();
+
+	std::lock_guard initialLoadBlock(m_viewSpecificState->viewOperationsThatInfluenceMetadataMutex);
+	// Held for the whole build so concurrent callers wait for this one instead of duplicating the work.
+	std::lock_guard indexLock(m_viewSpecificState->symbolIndexMutex);
+	if (m_viewSpecificState->symbolIndex)
+		return m_viewSpecificState->symbolIndex;
+
+	const auto& images = State().images;
+	std::vector<std::optional<SharedCacheMachOHeader>> headers(images.size());
+	std::vector<std::vector<std::pair<uint64_t, std::pair<BNSymbolType, std::string>>>> exportLists(images.size());
+	// Images whose exports were already known from the state and don't have to be stored again.
+	std::vector<uint8_t> fromState(images.size());
+
+	ParallelFor(images.size(), [&](size_t i) {
+		auto header = HeaderForAddress(images[i].headerLocation);
+		if (!header)
+			return;
+		if (auto it = State().exportInfos.find(header->textBase); it != State().exportInfos.end())
 		{
-			m_logger->LogWarn("Serious Error: Failed to open export trie %s for %s", header->exportTriePath.c_str(), header->installName.c_str());
-			continue;
+			exportLists[i] = it->second;
+			fromState[i] = true;
 		}
-		auto exportList = SharedCache::ParseExportTrie(mapping, *header);
-		std::vector<std::pair<uint64_t, std::pair<BNSymbolType, std::string>>> exportMapping;
-		for (const auto& sym : exportList)
+		else
 		{
-			exportMapping.push_back({sym->GetAddress(), {sym->GetType(), sym->GetRawName()}});
-			symbols.push_back({img.installName, sym});
+			std::shared_ptr<MMappedFileAccessor> mapping;
+			try {
+				mapping = MMappedFileAccessor::Open(m_dscView, m_dscView->GetFile()->GetSessionId(), header->exportTriePath)->lock();
+			}
+			catch (...)
+			{
+				m_logger->LogWarn("Serious Error: Failed to open export trie %s for %s", header->exportTriePath.c_str(), header->installName.c_str());
+				return;
+			}
+			exportLists[i] = ParseExportTrieEntries(mapping, *header);
 		}
-		MutableState().exportInfos[header->textBase] = std::move(exportMapping);
+		headers[i] = std::move(header);
+	});
+
+	SymbolIndex::Builder builder;
+	for (size_t i = 0; i < images.size(); i++)
+	{
+		builder.Reserve(exportLists[i].size());
+		for (const auto& [address, typeAndName] : exportLists[i])
+			builder.Add(images[i].installName, address, typeAndName.first, typeAndName.second);
+	}
+	auto index = std::make_shared<const SymbolIndex>(builder.Finalize());
+
+	for (size_t i = 0; i < images.size(); i++)
+	{
+		if (headers[i] && !fromState[i])
+			MutableState().exportInfos[headers[i]->textBase] = std::move(exportLists[i]);
 	}
 
 	SaveToDSCView();
 
+	m_viewSpecificState->symbolIndex = index;
+	return index;
+}
+
+
+std::vector<std::pair<std::string, Ref<Symbol>>> SharedCache::LoadAllSymbolsAndWait()
+{
+	auto index = LoadSymbolIndex();
+
+	std::vector<std::pair<std::string, Ref<Symbol>>> symbols;
+	symbols.reserve(index->Size());
+	for (const auto& entry : index->Entries())
+	{
+		std::string name(index->Name(entry));
+		symbols.push_back({std::string(index->Image(entry)),
+			new Symbol(BNCreateSymbol(entry.type, name.c_str(), name.c_str(), name.c_str(), entry.address, NoBinding, nullptr, 0))});
+	}
 	return symbols;
 }
 
 
 std::string SharedCache::SerializedImageHeaderForAddress(uint64_t address)
 {
-	auto header = HeaderForAddress(address);
+	auto header = FindHeaderForAddress(address);
 	if (header)
 	{
 		return header->AsString();
@@ -2867,7 +3223,7 @@ std::string SharedCache::SerializedImageHeaderForName(std::string name)
 {
 	if (auto it = State().imageStarts.find(name); it != State().imageStarts.end())
 	{
-		if (auto header = HeaderForAddress(it->second))
+		if (auto header = FindHeaderForAddress(it->second))
 		{
 			return header->AsString();
 		}
@@ -2897,8 +3253,6 @@ Ref<TypeLibrary> SharedCache::TypeLibraryForImage(const std::string& installName
 void SharedCache::FindSymbolAtAddrAndApplyToAddr(
 	uint64_t symbolLocation, uint64_t targetLocation, bool triggerReanalysis)
 {
-	WillMutateState();
-
 	std::string prefix = "";
 	if (symbolLocation != targetLocation)
 		prefix = "j_";
@@ -2923,58 +3277,103 @@ void SharedCache::FindSymbolAtAddrAndApplyToAddr(
 			m_dscView->DefineUserSymbol(new Symbol(sym->GetType(), prefix + sym->GetFullName(), targetLocation));
 	}
 	m_dscView->ForgetUndoActions(id);
-	auto header = HeaderForAddress(symbolLocation);
+
+	using ResolvedExport = ViewSpecificState::ResolvedExport;
+	std::optional<ResolvedExport> resolved;
+	bool haveResolved = false;
+	{
+		std::shared_lock lock(m_viewSpecificState->resolvedExportsMutex);
+		auto it = m_viewSpecificState->resolvedExports.find(symbolLocation);
+		if (it != m_viewSpecificState->resolvedExports.end())
+		{
+			resolved = it->second;
+			haveResolved = true;
+		}
+	}
+
+	std::optional<SharedCacheMachOHeader> header;
+	if (!haveResolved)
+		header = HeaderForAddress(symbolLocation);
 	if (header)
 	{
-		std::shared_ptr<MMappedFileAccessor> mapping;
-		try {
-			mapping = MMappedFileAccessor::Open(m_dscView, m_dscView->GetFile()->GetSessionId(), header->exportTriePath)->lock();
+		std::optional<std::pair<BNSymbolType, std::string>> exported;
+		std::shared_ptr<const SymbolIndex> index;
+		{
+			std::lock_guard lock(m_viewSpecificState->symbolIndexMutex);
+			index = m_viewSpecificState->symbolIndex;
 		}
-		catch (...)
+		if (index)
 		{
-			m_logger->LogWarn("Serious Error: Failed to open export trie for %s", header->installName.c_str());
-			return;
+			// The index covers every image, so there is no need to fall back to the export trie.
+			if (auto entry = index->FindByAddress(symbolLocation))
+				exported = {entry->type, std::string(index->Name(*entry))};
 		}
-		auto exportList = SharedCache::ParseExportTrie(mapping, *header);
-		std::vector<std::pair<uint64_t, std::pair<BNSymbolType, std::string>>> exportMapping;
-		auto typeLib = TypeLibraryForImage(header->installName);
-		id = m_dscView->BeginUndoActions();
-		m_dscView->BeginBulkModifySymbols();
-		for (const auto& sym : exportList)
+		else
 		{
-			exportMapping.push_back({sym->GetAddress(), {sym->GetType(), sym->GetRawName()}});
-			if (sym->GetAddress() == symbolLocation)
+			std::shared_ptr<MMappedFileAccessor> mapping;
+			try {
+				mapping = MMappedFileAccessor::Open(m_dscView, m_dscView->GetFile()->GetSessionId(), header->exportTriePath)->lock();
+			}
+			catch (...)
 			{
-				if (auto func = m_dscView->GetAnalysisFunction(m_dscView->GetDefaultPlatform(), targetLocation))
-				{
-					m_dscView->DefineUserSymbol(
-						new Symbol(FunctionSymbol, prefix + sym->GetFullName(), targetLocation));
-
-					if (typeLib)
-						if (auto type = m_dscView->ImportTypeLibraryObject(typeLib, {sym->GetFullName()}))
-							func->SetUserType(type);
-				}
-				else
-				{
-					m_dscView->DefineUserSymbol(
-						new Symbol(sym->GetType(), prefix + sym->GetFullName(), targetLocation));
-
-					if (typeLib)
-						if (auto type = m_dscView->ImportTypeLibraryObject(typeLib, {sym->GetFullName()}))
-							m_dscView->DefineUserDataVariable(targetLocation, type);
-				}
-				if (triggerReanalysis)
+				m_logger->LogWarn("Serious Error: Failed to open export trie for %s", header->installName.c_str());
+				return;
+			}
+			auto exportList = SharedCache::ParseExportTrieEntries(mapping, *header);
+			for (const auto& [address, typeAndName] : exportList)
+			{
+				if (address == symbolLocation)
 				{
-					auto func = m_dscView->GetAnalysisFunction(m_dscView->GetDefaultPlatform(), targetLocation);
-					if (func)
-						func->Reanalyze();
+					exported = typeAndName;
+					break;
 				}
-				break;
 			}
+			{
+				std::lock_guard lock(m_viewSpecificState->viewOperationsThatInfluenceMetadataMutex);
+				WillMutateState();
+				MutableState().exportInfos[header->textBase] = std::move(exportList);
+			}
+		}
+		if (exported)
+			resolved = ResolvedExport {exported->first, std::move(exported->second), header->installName};
+
+		std::unique_lock lock(m_viewSpecificState->resolvedExportsMutex);
+		m_viewSpecificState->resolvedExports[symbolLocation] = resolved;
+	}
+	else if (!haveResolved)
+	{
+		std::unique_lock lock(m_viewSpecificState->resolvedExportsMutex);
+		m_viewSpecificState->resolvedExports[symbolLocation] = std::nullopt;
+	}
+
+	if (resolved)
+	{
+		const auto& symbolType = resolved->type;
+		const auto& symbolName = resolved->name;
+		auto typeLib = TypeLibraryForImage(resolved->installName);
+		id = m_dscView->BeginUndoActions();
+		m_dscView->BeginBulkModifySymbols();
+		if (auto func = m_dscView->GetAnalysisFunction(m_dscView->GetDefaultPlatform(), targetLocation))
+		{
+			m_dscView->DefineUserSymbol(new Symbol(FunctionSymbol, prefix + symbolName, targetLocation));
+
+			if (typeLib)
+				if (auto type = m_dscView->ImportTypeLibraryObject(typeLib, {symbolName}))
+					func->SetUserType(type);
+		}
+		else
+		{
+			m_dscView->DefineUserSymbol(new Symbol(symbolType, prefix + symbolName, targetLocation));
+
+			if (typeLib)
+				if (auto type = m_dscView->ImportTypeLibraryObject(typeLib, {symbolName}))
+					m_dscView->DefineUserDataVariable(targetLocation, type);
 		}
+		if (triggerReanalysis)
 		{
-			std::lock_guard lock(m_viewSpecificState->viewOperationsThatInfluenceMetadataMutex);
-			MutableState().exportInfos[header->textBase] = std::move(exportMapping);
+			auto func = m_dscView->GetAnalysisFunction(m_dscView->GetDefaultPlatform(), targetLocation);
+			if (func)
+				func->Reanalyze();
 		}
 		m_dscView->EndBulkModifySymbols();
 		m_dscView->ForgetUndoActions(id);
@@ -2982,13 +3381,62 @@ void SharedCache::FindSymbolAtAddrAndApplyToAddr(
 }
 
 
+void SharedCache::StoreMetadataRecord(const std::string& key, Ref<Metadata> data)
+{
+	m_dscView->StoreMetadata(key, data);
+	m_dscView->GetParentView()->StoreMetadata(key, data);
+}
+
+
+void SharedCache::RemoveMetadataRecord(const std::string& key)
+{
+	m_dscView->RemoveMetadata(key);
+	m_dscView->GetParentView()->RemoveMetadata(key);
+}
+
+
+// Deltas only describe growth of the state (newly mapped regions, new symbols, the view state).
+// Anything else requires a full record.
+bool SharedCache::CanStoreDelta(const struct State& persisted) const
+{
+	return State().images.size() == persisted.images.size()
+		&& State().headers.size() == persisted.headers.size()
+		&& State().backingCaches.size() == persisted.backingCaches.size()
+		&& State().regionsMappedIntoMemory.size() >= persisted.regionsMappedIntoMemory.size()
+		&& State().baseFilePath == persisted.baseFilePath;
+}
+
+
 bool SharedCache::SaveToDSCView()
 {
 	if (m_dscView)
 	{
-		auto data = AsMetadata();
-		m_dscView->StoreMetadata(SharedCacheMetadataTag, data);
-		m_dscView->GetParentView()->StoreMetadata(SharedCacheMetadataTag, data);
+		std::shared_ptr<struct State> persistedState;
+		size_t deltaCount;
+		{
+			std::lock_guard lock(m_viewSpecificState->stateMutex);
+			persistedState = m_viewSpecificState->persistedState;
+			deltaCount = m_viewSpecificState->persistedDeltaCount;
+		}
+
+		if (persistedState && deltaCount < MaxMetadataDeltaCount && CanStoreDelta(*persistedState))
+		{
+			SerializationContext context(SerializationFormat::Binary);
+			context.writer.StartObject();
+			StoreDelta(context, *persistedState);
+			context.writer.EndObject();
+			StoreMetadataRecord(
+				SharedCacheDeltaMetadataTagPrefix + std::to_string(deltaCount), new Metadata(context.writer.Binary()));
+			deltaCount++;
+		}
+		else
+		{
+			StoreMetadataRecord(SharedCacheMetadataTag, AsMetadata());
+			for (size_t i = 0; i < deltaCount; i++)
+				RemoveMetadataRecord(SharedCacheDeltaMetadataTagPrefix + std::to_string(i));
+			deltaCount = 0;
+		}
+		StoreMetadataRecord(SharedCacheDeltaCountMetadataTag, new Metadata((uint64_t)deltaCount));
 
 		// By moving our state the to cache we can avoid creating a copy in the case
 		// that no further mutations are made to `this`. If we're not done being mutated,
@@ -2998,6 +3446,8 @@ bool SharedCache::SaveToDSCView()
 		m_stateIsShared = true;
 
 		std::lock_guard lock(m_viewSpecificState->stateMutex);
+		m_viewSpecificState->persistedState = cachedState;
+		m_viewSpecificState->persistedDeltaCount = deltaCount;
 		m_viewSpecificState->cachedState = std::move(cachedState);
 
 		m_metadataValid = true;
@@ -3062,6 +3512,19 @@ extern "C"
 		return false;
 	}
 
+	bool BNDSCViewLoadImagesWithInstallNames(BNSharedCache* cache, const char** names, size_t count, bool skipObjC)
+	{
+		std::vector<std::string> imageNames;
+		imageNames.reserve(count);
+		for (size_t i = 0; i < count; i++)
+			imageNames.emplace_back(names[i]);
+
+		if (cache->object)
+			return cache->object->LoadImagesWithInstallNames(imageNames, skipObjC);
+
+		return false;
+	}
+
 	bool BNDSCViewLoadSectionAtAddress(BNSharedCache* cache, uint64_t addr)
 	{
 		if (cache->object)
@@ -3116,19 +3579,48 @@ extern "C"
 		return nullptr;
 	}
 
-	BNDSCSymbolRep* BNDSCViewLoadAllSymbolsAndWait(BNSharedCache* cache, size_t* count)
+	BNDSCImageSummary* BNDSCViewGetImageSummaries(BNSharedCache* cache, size_t* count)
 	{
 		if (cache->object)
 		{
-			auto value = cache->object->LoadAllSymbolsAndWait();
+			auto value = cache->object->GetImageSummaries();
 			*count = value.size();
-
-			BNDSCSymbolRep* symbols = (BNDSCSymbolRep*)malloc(sizeof(BNDSCSymbolRep) * value.size());
+			BNDSCImageSummary* summaries = new BNDSCImageSummary[value.size()];
 			for (size_t i = 0; i < value.size(); i++)
 			{
-				symbols[i].address = value[i].second->GetAddress();
-				symbols[i].name = BNAllocString(value[i].second->GetRawName().c_str());
-				symbols[i].image = BNAllocString(value[i].first.c_str());
+				summaries[i].name = BNAllocString(value[i].installName.c_str());
+				summaries[i].headerAddress = value[i].headerAddress;
+				summaries[i].size = value[i].size;
+				summaries[i].segmentCount = value[i].segmentCount;
+			}
+			return summaries;
+		}
+		*count = 0;
+		return nullptr;
+	}
+
+	void BNDSCViewFreeImageSummaries(BNDSCImageSummary* summaries, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+			BNFreeString(summaries[i].name);
+		delete[] summaries;
+	}
+
+	BNDSCSymbolRep* BNDSCViewLoadAllSymbolsAndWait(BNSharedCache* cache, size_t* count)
+	{
+		if (cache->object)
+		{
+			// Read straight from the index; creating a `Symbol` for every export is far more expensive.
+			auto index = cache->object->LoadSymbolIndex();
+			*count = index->Size();
+
+			BNDSCSymbolRep* symbols = (BNDSCSymbolRep*)malloc(sizeof(BNDSCSymbolRep) * index->Size());
+			for (size_t i = 0; i < index->Size(); i++)
+			{
+				const auto& entry = index->Entries()[i];
+				symbols[i].address = entry.address;
+				symbols[i].name = BNAllocString(std::string(index->Name(entry)).c_str());
+				symbols[i].image = BNAllocString(std::string(index->Image(entry)).c_str());
 			}
 			return symbols;
 		}
@@ -3347,8 +3839,14 @@ extern "C"
 	BNDSCMemoryUsageInfo BNDSCViewGetMemoryUsageInfo()
 	{
 		BNDSCMemoryUsageInfo info;
-		info.mmapRefs = mmapCount.load();
+		auto poolStats = MMappedFileAccessor::PoolStats();
+		info.mmapRefs = poolStats.mapped;
 		info.sharedCacheRefs = sharedCacheReferences.load();
+		info.mmapLimit = poolStats.limit;
+		info.mmapHits = poolStats.hits;
+		info.mmapOpens = poolStats.opens;
+		info.mmapRemaps = poolStats.remaps;
+		info.mmapEvictions = poolStats.evictions;
 		return info;
 	}
 
@@ -3410,29 +3908,23 @@ void Deserialize(DeserializationContext& context, std::string_view name, std::ve
        }
 }
 
-void SharedCache::Store(SerializationContext& context) const
-{
-	Serialize(context, "metadataVersion", METADATA_VERSION);
+using SymbolInfoMap =
+	std::unordered_map<uint64_t, std::vector<std::pair<uint64_t, std::pair<BNSymbolType, std::string>>>>;
 
-    Serialize(context, "m_viewState", State().viewState);
-    Serialize(context, "m_cacheFormat", State().cacheFormat);
-    Serialize(context, "m_imageStarts", State().imageStarts);
-    Serialize(context, "m_baseFilePath", State().baseFilePath);
-
-	Serialize(context, "headers");
+// Entries that are identical in `persisted` are skipped, which is used to store deltas.
+static void SerializeSymbolInfos(SerializationContext& context, std::string_view name, const SymbolInfoMap& infos,
+	const SymbolInfoMap* persisted = nullptr)
+{
+	Serialize(context, name);
 	context.writer.StartArray();
-	for (auto& [k, v] : State().headers)
+	for (const auto& pair1 : infos)
 	{
-		context.writer.StartObject();
-		v.Store(context);
-		context.writer.EndObject();
-	}
-	context.writer.EndArray();
+		if (persisted)
+		{
+			if (auto it = persisted->find(pair1.first); it != persisted->end() && it->second == pair1.second)
+				continue;
+		}
 
-	Serialize(context, "exportInfos");
-	context.writer.StartArray();
-	for (const auto& pair1 : State().exportInfos)
-	{
 		context.writer.StartObject();
 		Serialize(context, "key", pair1.first);
 		Serialize(context, "value");
@@ -3449,28 +3941,46 @@ void SharedCache::Store(SerializationContext& context) const
 		context.writer.EndObject();
 	}
 	context.writer.EndArray();
+}
 
-	Serialize(context, "symbolInfos");
-	context.writer.StartArray();
-	for (const auto& pair1 : State().symbolInfos)
+static void DeserializeSymbolInfos(DeserializationContext& context, std::string_view name, SymbolInfoMap& infos)
+{
+	for (const auto& obj1 : context.doc[name.data()].GetArray())
 	{
-		context.writer.StartObject();
-		Serialize(context, "key", pair1.first);
-		Serialize(context, "value");
-		context.writer.StartArray();
-		for (const auto& pair2 : pair1.second)
+		std::vector<std::pair<uint64_t, std::pair<BNSymbolType, std::string>>> innerVec;
+		for (const auto& obj2 : obj1["value"].GetArray())
 		{
-			context.writer.StartObject();
-			Serialize(context, "key", pair2.first);
-			Serialize(context, "val1", pair2.second.first);
-			Serialize(context, "val2", pair2.second.second);
-			context.writer.EndObject();
+			std::pair<BNSymbolType, std::string> innerPair = {
+				(BNSymbolType)obj2["val1"].GetUint64(), obj2["val2"].GetString()};
+			innerVec.push_back({obj2["key"].GetUint64(), innerPair});
 		}
-		context.writer.EndArray();
+
+		infos[obj1["key"].GetUint64()] = std::move(innerVec);
+	}
+}
+
+void SharedCache::Store(SerializationContext& context) const
+{
+	Serialize(context, "metadataVersion", METADATA_VERSION);
+
+    Serialize(context, "m_viewState", State().viewState);
+    Serialize(context, "m_cacheFormat", State().cacheFormat);
+    Serialize(context, "m_imageStarts", State().imageStarts);
+    Serialize(context, "m_baseFilePath", State().baseFilePath);
+
+	Serialize(context, "headers");
+	context.writer.StartArray();
+	for (auto& [k, v] : State().headers)
+	{
+		context.writer.StartObject();
+		v.Store(context);
 		context.writer.EndObject();
 	}
 	context.writer.EndArray();
 
+	SerializeSymbolInfos(context, "exportInfos", State().exportInfos);
+	SerializeSymbolInfos(context, "symbolInfos", State().symbolInfos);
+
 	Serialize(context, "backingCaches", State().backingCaches);
 	Serialize(context, "stubIslands", State().stubIslandRegions);
 	Serialize(context, "images", State().images);
@@ -3511,30 +4021,8 @@ void SharedCache::Load(DeserializationContext& context)
 	Deserialize(context, "m_imageStarts", MutableState().imageStarts);
 	Deserialize(context, "m_baseFilePath", MutableState().baseFilePath);
 
-	for (const auto& obj1 : context.doc["exportInfos"].GetArray())
-	{
-		std::vector<std::pair<uint64_t, std::pair<BNSymbolType, std::string>>> innerVec;
-		for (const auto& obj2 : obj1["value"].GetArray())
-		{
-			std::pair<BNSymbolType, std::string> innerPair = {
-				(BNSymbolType)obj2["val1"].GetUint64(), obj2["val2"].GetString()};
-			innerVec.push_back({obj2["key"].GetUint64(), innerPair});
-		}
-
-		MutableState().exportInfos[obj1["key"].GetUint64()] = std::move(innerVec);
-	}
-
-	for (auto& symbolInfo : context.doc["symbolInfos"].GetArray())
-	{
-		std::vector<std::pair<uint64_t, std::pair<BNSymbolType, std::string>>>
-			symbolInfos;
-		for (auto& si : symbolInfo["value"].GetArray())
-		{
-			symbolInfos.push_back({si["key"].GetUint64(),
-				{static_cast<BNSymbolType>(si["val1"].GetUint64()), si["val2"].GetString()}});
-		}
-		MutableState().symbolInfos[symbolInfo["key"].GetUint64()] = std::move(symbolInfos);
-	}
+	DeserializeSymbolInfos(context, "exportInfos", MutableState().exportInfos);
+	DeserializeSymbolInfos(context, "symbolInfos", MutableState().symbolInfos);
 
 	for (auto& bcV : context.doc["backingCaches"].GetArray())
 	{
@@ -3581,6 +4069,84 @@ void SharedCache::Load(DeserializationContext& context)
 	m_metadataValid = true;
 }
 
+void SharedCache::StoreDelta(SerializationContext& context, const struct State& persisted) const
+{
+	Serialize(context, "metadataVersion", METADATA_VERSION);
+
+	Serialize(context, "m_viewState", State().viewState);
+
+	Serialize(context, "regionsMappedIntoMemory");
+	context.writer.StartArray();
+	for (size_t i = persisted.regionsMappedIntoMemory.size(); i < State().regionsMappedIntoMemory.size(); i++)
+		Serialize(context, State().regionsMappedIntoMemory[i]);
+	context.writer.EndArray();
+
+	SerializeSymbolInfos(context, "exportInfos", State().exportInfos, &persisted.exportInfos);
+	SerializeSymbolInfos(context, "symbolInfos", State().symbolInfos, &persisted.symbolInfos);
+}
+
+void SharedCache::LoadDelta(DeserializationContext& context)
+{
+	if (!context.doc.HasMember("metadataVersion") || context.doc["metadataVersion"].GetUint() != METADATA_VERSION)
+	{
+		m_logger->LogError("Shared Cache metadata delta version mismatch");
+		m_metadataValid = false;
+		return;
+	}
+
+	MutableState().viewState = static_cast<DSCViewState>(context.load<uint8_t>("m_viewState"));
+
+	// Every region appended to `regionsMappedIntoMemory` was also marked as loaded where it is owned.
+	auto markLoaded = [](std::vector<MemoryRegion>& regions, uint64_t start) {
+		for (auto& region : regions)
+		{
+			if (region.start == start)
+			{
+				region.loaded = true;
+				return true;
+			}
+		}
+		return false;
+	};
+	for (auto& rV : context.doc["regionsMappedIntoMemory"].GetArray())
+	{
+		MemoryRegion r;
+		r.LoadFromValue(rV);
+		bool found = markLoaded(MutableState().stubIslandRegions, r.start)
+			|| markLoaded(MutableState().dyldDataRegions, r.start)
+			|| markLoaded(MutableState().nonImageRegions, r.start);
+		for (auto it = MutableState().images.begin(); !found && it != MutableState().images.end(); ++it)
+			found = markLoaded(it->regions, r.start);
+		MutableState().regionsMappedIntoMemory.push_back(std::move(r));
+	}
+
+	DeserializeSymbolInfos(context, "exportInfos", MutableState().exportInfos);
+	DeserializeSymbolInfos(context, "symbolInfos", MutableState().symbolInfos);
+}
+
+std::vector<rapidjson::Document> SharedCache::LoadMetadataDocuments(Ref<BinaryView> view)
+{
+	std::vector<rapidjson::Document> documents;
+	auto base = view->QueryMetadata(SharedCacheMetadataTag);
+	if (!base)
+		return documents;
+	documents.emplace_back();
+	if (!ParseMetadataDocument(base, documents.back()))
+		return documents;
+
+	size_t deltaCount = 0;
+	if (auto count = view->QueryMetadata(SharedCacheDeltaCountMetadataTag); count && count->IsUnsignedInteger())
+		deltaCount = count->GetUnsignedInteger();
+	for (size_t i = 0; i < deltaCount; i++)
+	{
+		rapidjson::Document delta;
+		if (!ParseMetadataDocument(view->QueryMetadata(SharedCacheDeltaMetadataTagPrefix + std::to_string(i)), delta))
+			break;
+		documents.push_back(std::move(delta));
+	}
+	return documents;
+}
+
 void BackingCache::Store(SerializationContext& context) const
 {
 	MSS(path);
@@ -3680,4 +4246,77 @@ size_t SharedCache::GetObjCRelativeMethodBaseAddress(const VMReader& reader) con
 	return 0;
 }
 
+// Layout of dyld's `ObjCStringTable`: a fixed header and the 256 entry scramble table, then
+// `tab[roundedTabSize]`, `checkbytes[capacity]` and `offsets[capacity]`. Each offset is relative to
+// the start of the table, and unused slots hold `sentinelTarget`.
+static bool ReadObjCSelectorTable(VMReader& reader, uint64_t tableAddress, ObjCSelectorTable& table)
+{
+	uint32_t capacity = reader.ReadUInt32(tableAddress);
+	uint32_t occupied = reader.ReadUInt32(tableAddress + 4);
+	uint32_t mask = reader.ReadUInt32(tableAddress + 12);
+	int32_t sentinelTarget = reader.ReadInt32(tableAddress + 16);
+	uint32_t roundedTabSize = reader.ReadUInt32(tableAddress + 20);
+	if (occupied > capacity || capacity > 0x1000000 || (mask & (mask + 1)) != 0 || roundedTabSize < mask + 1)
+		return false;
+
+	uint64_t offsetsAddress = tableAddress + 32 + (256 * sizeof(uint32_t)) + roundedTabSize + capacity;
+	DataBuffer offsets = reader.ReadBuffer(offsetsAddress, capacity * sizeof(int32_t));
+	const int32_t* offsetData = (const int32_t*)offsets.GetData();
+
+	std::vector<std::pair<uint64_t, size_t>> entries;
+	entries.reserve(occupied);
+	for (uint32_t i = 0; i < capacity; i++)
+	{
+		if (offsetData[i] == sentinelTarget)
+			continue;
+		uint64_t address = tableAddress + offsetData[i];
+		entries.emplace_back(address, table.strings.size());
+		table.strings += reader.ReadCString(address);
+		table.strings.push_back('\0');
+	}
+
+	// `strings` is complete, so views into it are stable from here on.
+	table.names.reserve(entries.size());
+	for (const auto& [address, start] : entries)
+		table.names.emplace(address, std::string_view(table.strings.data() + start));
+	return true;
+}
+
+// Takes a copy of the reader for the same reason as `GetObjCOptimizationHeader`.
+std::shared_ptr<const ObjCSelectorTable> SharedCache::LoadObjCSelectorTable(VMReader reader) {
+	std::lock_guard lock(m_viewSpecificState->objcSelectorTableMutex);
+	if (m_viewSpecificState->objcSelectorTable)
+		return m_viewSpecificState->objcSelectorTable;
+
+	auto table = std::make_shared<ObjCSelectorTable>();
+	auto header = GetObjCOptimizationHeader(reader);
+	if (header && header->selectorHashTableCacheOffset)
+	{
+		uint64_t tableAddress = GetBaseAddress() + header->selectorHashTableCacheOffset;
+		bool loaded = false;
+		try
+		{
+			loaded = ReadObjCSelectorTable(reader, tableAddress, *table);
+		}
+		catch (...)
+		{
+			// Handled the same as a malformed header below
+		}
+
+		if (loaded)
+		{
+			m_logger->LogDebug("Loaded %zu selectors from the ObjC selector table at 0x%llx", table->names.size(),
+				tableAddress);
+		}
+		else
+		{
+			m_logger->LogDebug("Failed to read the ObjC selector table at 0x%llx", tableAddress);
+			table = std::make_shared<ObjCSelectorTable>();
+		}
+	}
+
+	m_viewSpecificState->objcSelectorTable = table;
+	return table;
+}
+
 }  // namespace SharedCacheCore
@@ -7,6 +7,7 @@
 #include "VM.h"
 #include "view/macho/machoview.h"
 #include "MetadataSerializable.hpp"
+#include "SymbolIndex.h"
 #include "../api/sharedcachecore.h"
 
 #ifndef SHAREDCACHE_SHAREDCACHE_H
@@ -24,6 +25,9 @@ namespace SharedCacheCore {
 	};
 
 	const std::string SharedCacheMetadataTag = "SHAREDCACHE-SharedCacheData";
+	// Incremental changes stored on top of the full state in `SharedCacheMetadataTag`, see `SharedCache::SaveToDSCView`.
+	const std::string SharedCacheDeltaCountMetadataTag = "SHAREDCACHE-SharedCacheDeltaCount";
+	const std::string SharedCacheDeltaMetadataTagPrefix = "SHAREDCACHE-SharedCacheDelta-";
 
 	struct MemoryRegion : public MetadataSerializable<MemoryRegion>
 	{
@@ -70,7 +74,7 @@ namespace SharedCacheCore {
 			context.writer.StartArray();
 			for (auto& region : regions)
 			{
-				Serialize(context, region.AsString());
+				Serialize(context, region);
 			}
 			context.writer.EndArray();
 		}
@@ -84,7 +88,7 @@ namespace SharedCacheCore {
 			for (auto& region : bArr)
 			{
 				MemoryRegion r;
-				r.LoadFromString(region.GetString());
+				r.LoadFromValue(region);
 				regions.push_back(r);
 			}
 		}
@@ -127,6 +131,15 @@ namespace SharedCacheCore {
 		dyld_cache_mapping_info mappingInfo;
 	};
 
+	// What image listings need from a header, without copying or serializing the whole header.
+	struct ImageSummary
+	{
+		std::string installName;
+		uint64_t headerAddress;
+		uint64_t size;
+		size_t segmentCount;
+	};
+
 	struct dyld_cache_slide_info
 	{
 		uint32_t    version;
@@ -389,6 +402,21 @@ namespace SharedCacheCore {
 
 	#endif
 
+	// Every selector in dyld's ObjC selector optimization table, keyed by address.
+	// Selectors are uniqued across the whole cache, so this is built once per view.
+	struct ObjCSelectorTable
+	{
+		// Views into `strings`
+		std::unordered_map<uint64_t, std::string_view> names;
+		std::string strings;
+
+		const std::string_view* Find(uint64_t address) const
+		{
+			auto it = names.find(address);
+			return it != names.end() ? &it->second : nullptr;
+		}
+	};
+
 	using namespace BinaryNinja;
 	struct SharedCacheMachOHeader : public MetadataSerializable<SharedCacheMachOHeader>
 	{
@@ -565,6 +593,13 @@ namespace SharedCacheCore {
 
 		struct State;
 
+		// Stores only what changed relative to `persisted`, in the same format as `Store`.
+		void StoreDelta(SerializationContext& context, const struct State& persisted) const;
+		void LoadDelta(DeserializationContext& context);
+
+		// The full state document followed by any delta documents, in the order they should be applied.
+		static std::vector<rapidjson::Document> LoadMetadataDocuments(BinaryNinja::Ref<BinaryNinja::BinaryView> view);
+
 		struct ViewSpecificState;
 
 	private:
@@ -599,9 +634,18 @@ namespace SharedCacheCore {
 		bool SaveToDSCView();
 
 		void ParseAndApplySlideInfoForFile(std::shared_ptr<MMappedFileAccessor> file);
+		void ApplySlideInfoForAllFiles(std::shared_ptr<VM> vm);
+		uint64_t SlideBaseAddress() const;
+		bool SlidImageCachingEnabled() const;
+		void RegisterCachedSlidImages();
+		void StoreSlidImage(std::shared_ptr<MMappedFileAccessor> file, const dyld_cache_header& header, uint64_t base);
 		std::optional<uint64_t> GetImageStart(std::string installName);
 		std::optional<SharedCacheMachOHeader> HeaderForAddress(uint64_t);
+		// Like `HeaderForAddress` but without the copy. Valid until the state is next mutated.
+		const SharedCacheMachOHeader* FindHeaderForAddress(uint64_t address);
 		bool LoadImageWithInstallName(std::string installName, bool skipObjC);
+		// Loads several images at once, sharing one symbol bulk modification and one analysis update.
+		bool LoadImagesWithInstallNames(const std::vector<std::string>& installNames, bool skipObjC);
 		bool LoadSectionAtAddress(uint64_t address);
 		bool LoadImageContainingAddress(uint64_t address, bool skipObjC);
 		void ProcessObjCSectionsForImageWithInstallName(std::string installName);
@@ -609,11 +653,15 @@ namespace SharedCacheCore {
 		std::string NameForAddress(uint64_t address);
 		std::string ImageNameForAddress(uint64_t address);
 		std::vector<std::string> GetAvailableImages();
+		// Sorted by header address.
+		std::vector<ImageSummary> GetImageSummaries();
 
 		std::vector<MemoryRegion> GetMappedRegions() const;
 		bool IsMemoryMapped(uint64_t address);
 
 		std::vector<std::pair<std::string, Ref<Symbol>>> LoadAllSymbolsAndWait();
+		// Builds the export index of every image on first use, parsing export tries in parallel.
+		std::shared_ptr<const SymbolIndex> LoadSymbolIndex();
 
 		const std::unordered_map<std::string, uint64_t>& AllImageStarts() const;
 		const std::unordered_map<uint64_t, SharedCacheMachOHeader>& AllImageHeaders() const;
@@ -631,19 +679,28 @@ namespace SharedCacheCore {
 		virtual ~SharedCache();
 
 		size_t GetObjCRelativeMethodBaseAddress(const VMReader& reader) const;
+		// Reads dyld's selector table on first use. Empty if the cache has no usable table.
+		std::shared_ptr<const ObjCSelectorTable> LoadObjCSelectorTable(VMReader reader);
 
 private:
 		std::optional<SharedCacheMachOHeader> LoadHeaderForAddress(
 			std::shared_ptr<VM> vm, uint64_t address, std::string installName);
 		void InitializeHeader(
 			Ref<BinaryView> view, VM* vm, const SharedCacheMachOHeader& header, std::vector<MemoryRegion*> regionsToLoad);
-		void ReadExportNode(std::vector<Ref<Symbol>>& symbolList, const SharedCacheMachOHeader& header, const uint8_t* begin,
-			const uint8_t *end, const uint8_t* current, uint64_t textBase, const std::string& currentText);
+		std::vector<std::pair<uint64_t, std::pair<BNSymbolType, std::string>>> ParseExportTrieEntries(
+			std::shared_ptr<MMappedFileAccessor> linkeditFile, const SharedCacheMachOHeader& header);
 		std::vector<Ref<Symbol>> ParseExportTrie(
 			std::shared_ptr<MMappedFileAccessor> linkeditFile, const SharedCacheMachOHeader& header);
 
 		Ref<TypeLibrary> TypeLibraryForImage(const std::string& installName);
 
+		struct AddressIndex;
+		std::shared_ptr<const AddressIndex> GetAddressIndex();
+
+		bool CanStoreDelta(const struct State& persisted) const;
+		void StoreMetadataRecord(const std::string& key, Ref<Metadata> data);
+		void RemoveMetadataRecord(const std::string& key);
+
 		size_t GetBaseAddress() const;
 		std::optional<ObjCOptimizationHeader> GetObjCOptimizationHeader(VMReader reader) const;
 
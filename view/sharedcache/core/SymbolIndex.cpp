@@ -0,0 +1,69 @@
+#include "SymbolIndex.h"
+#include <algorithm>
+
+namespace SharedCacheCore {
+
+uint32_t SymbolIndex::Builder::Intern(std::string_view str)
+{
+	// Append tentatively so the candidate can be looked up by offset, and drop it again if it already exists.
+	uint32_t offset = (uint32_t)m_strings.size();
+	m_strings.append(str);
+	m_strings.push_back('\0');
+	auto [it, inserted] = m_stringOffsets.insert(offset);
+	if (!inserted)
+		m_strings.resize(offset);
+	return *it;
+}
+
+void SymbolIndex::Builder::Add(std::string_view image, uint64_t address, BNSymbolType type, std::string_view name)
+{
+	m_entries.push_back({address, Intern(name), Intern(image), type});
+}
+
+SymbolIndex SymbolIndex::Builder::Finalize()
+{
+	SymbolIndex index;
+	index.m_strings = std::move(m_strings);
+	index.m_entries = std::move(m_entries);
+	std::stable_sort(index.m_entries.begin(), index.m_entries.end(),
+		[](const Entry& a, const Entry& b) { return a.address < b.address; });
+
+	index.m_byName.resize(index.m_entries.size());
+	for (uint32_t i = 0; i < index.m_byName.size(); i++)
+		index.m_byName[i] = i;
+	std::stable_sort(index.m_byName.begin(), index.m_byName.end(), [&](uint32_t a, uint32_t b) {
+		return index.Name(index.m_entries[a]) < index.Name(index.m_entries[b]);
+	});
+
+	index.m_strings.shrink_to_fit();
+	return index;
+}
+
+const SymbolIndex::Entry* SymbolIndex::FindByAddress(uint64_t address) const
+{
+	auto it = std::lower_bound(m_entries.begin(), m_entries.end(), address,
+		[](const Entry& entry, uint64_t address) { return entry.address < address; });
+	if (it == m_entries.end() || it->address != address)
+		return nullptr;
+	return &*it;
+}
+
+std::vector<const SymbolIndex::Entry*> SymbolIndex::FindByName(std::string_view name) const
+{
+	auto [first, last] = std::equal_range(m_byName.begin(), m_byName.end(), name, [this](const auto& a, const auto& b) {
+		auto nameOf = [this](const auto& value) -> std::string_view {
+			if constexpr (std::is_same_v<std::decay_t<decltype(value)>, uint32_t>)
+				return Name(m_entries[value]);
+			else
+				return value;
+		};
+		return nameOf(a) < nameOf(b);
+	});
+
+	std::vector<const Entry*> result;
+	for (auto it = first; it != last; ++it)
+		result.push_back(&m_entries[*it]);
+	return result;
+}
+
+}
@@ -0,0 +1,93 @@
+#ifndef SHAREDCACHE_SYMBOLINDEX_H
+#define SHAREDCACHE_SYMBOLINDEX_H
+
+#include <binaryninjacore.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/*
+ * Compact index over the exported symbols of every image in a shared cache.
+ *
+ * Names and image install names live once each in an interned string table, and entries refer to them by offset.
+ * Entries are sorted by address for address lookups, with a second ordering by name for name lookups.
+ *
+ * The index is immutable once built and is shared between all users of a view, see `SharedCache::GetSymbolIndex`.
+ */
+
+namespace SharedCacheCore {
+
+	class SymbolIndex
+	{
+	public:
+		struct Entry
+		{
+			uint64_t address;
+			uint32_t name;
+			uint32_t image;
+			BNSymbolType type;
+		};
+
+		class Builder
+		{
+			// Hashes and compares interned strings by their offset into `m_strings`.
+			struct OffsetHash
+			{
+				const std::string* strings;
+				size_t operator()(uint32_t offset) const
+				{
+					return std::hash<std::string_view>()(std::string_view(strings->data() + offset));
+				}
+			};
+			struct OffsetEqual
+			{
+				const std::string* strings;
+				bool operator()(uint32_t a, uint32_t b) const
+				{
+					return std::string_view(strings->data() + a) == std::string_view(strings->data() + b);
+				}
+			};
+
+			std::string m_strings;
+			std::unordered_set<uint32_t, OffsetHash, OffsetEqual> m_stringOffsets;
+			std::vector<Entry> m_entries;
+
+			uint32_t Intern(std::string_view str);
+
+		public:
+			Builder() : m_stringOffsets(0, OffsetHash {&m_strings}, OffsetEqual {&m_strings}) {}
+			Builder(const Builder&) = delete;
+			Builder& operator=(const Builder&) = delete;
+
+			void Reserve(size_t count) { m_entries.reserve(m_entries.size() + count); }
+			void Add(std::string_view image, uint64_t address, BNSymbolType type, std::string_view name);
+			SymbolIndex Finalize();
+		};
+
+		const std::vector<Entry>& Entries() const { return m_entries; }
+		size_t Size() const { return m_entries.size(); }
+
+		std::string_view Name(const Entry& entry) const { return String(entry.name); }
+		std::string_view Image(const Entry& entry) const { return String(entry.image); }
+
+		// First entry at exactly `address`, or nullptr.
+		const Entry* FindByAddress(uint64_t address) const;
+		// All entries named `name`, in address order.
+		std::vector<const Entry*> FindByName(std::string_view name) const;
+
+	private:
+		// Null separated so that `String` can hand out views ending at a terminator.
+		std::string m_strings;
+		std::vector<Entry> m_entries;
+		// Indices into `m_entries` ordered by name.
+		std::vector<uint32_t> m_byName;
+
+		std::string_view String(uint32_t offset) const { return std::string_view(m_strings.data() + offset); }
+	};
+
+}
+
+#endif //SHAREDCACHE_SYMBOLINDEX_H
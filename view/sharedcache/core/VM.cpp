@@ -15,9 +15,12 @@
  		40+ files, these are trivially reachable.
 
  		We handle this with a "SelfAllocatingWeakPtr":
- 			- Calling .lock() ALWAYS delivers a shared_ptr guaranteed to stay valid. This may block waiting for a free pointer
+ 			- Calling .lock() ALWAYS delivers a shared_ptr guaranteed to stay valid.
 			- As soon as that lock is released, that file pointer MAY be freed if another thread wants to open a new one, and we are at our limit.
-			- Calling .lock() again on this same theoretical object will then wait for another file pointer to be freeable.
+			- Calling .lock() again on this same theoretical object will then map the file again.
+
+		Recently used accessors are kept mapped by a pool (see FileAccessorPool) which evicts the least recently used
+		ones, subject to per-session fair shares, once the file pointer limit is reached.
 
 	VM Implementation:
 
@@ -25,7 +28,11 @@
  	Since the caches we're operating on are by nature page aligned, we are able to use nice optimizations under the hood to translate
  	"VM Addresses" to their actual in-memory counterparts.
 
- 	We do this with a page table, which is a map of page -> file offset.
+ 	We do this with a page table, which is a flat, sorted table of mapping -> file offset. Lookups binary search
+ 	that table, short-circuited by the last mapping hit.
+
+ 	VMReader additionally caches the mapping its cursor last resolved into, so sequential scalar reads
+ 	never touch the page table until the cursor leaves that mapping.
 
  	We also implement a "VMReader" here, which is a drop-in replacement for BinaryReader that operates on the VM.
  		see "ObjC.cpp" for where this is used.
@@ -34,6 +41,10 @@
 
 
 #include "VM.h"
+#include <algorithm>
+#include <array>
+#include <map>
+#include <set>
 #include <utility>
 #include <memory>
 #include <cstring>
@@ -50,15 +61,161 @@
 	#include <sys/resource.h>
 #endif
 
-void VMShutdown()
+// Resolved file path -> pre-slid copy of that file to map instead.
+static std::mutex slidImagesMutex;
+static std::unordered_map<std::string, std::string> slidImages;
+
+static uint64_t maxFPLimit;
+
+static std::atomic<uint64_t> mmapCount = 0;
+static std::atomic<uint64_t> accessorLockCount = 0;
+static std::atomic<uint64_t> accessorOpenCount = 0;
+static std::atomic<uint64_t> accessorRemapCount = 0;
+static std::atomic<uint64_t> accessorEvictionCount = 0;
+
+
+/*
+	Pool of mapped file accessors, shared by every session.
+
+	The pool holds the strong reference that keeps a recently used accessor mapped after its users release it.
+	It holds at most `maxFPLimit` accessors. When full, an entry is evicted to make room, chosen as the least
+	recently used accessor of, in order of preference:
+		- the inserting session, if that session already holds its fair share of the pool
+		- any session holding more than its fair share
+		- any session
+	where the fair share is the pool capacity split evenly between sessions with pooled accessors.
+
+	Evicting only drops the pool's reference. An accessor still in use elsewhere stays mapped until released.
+*/
+class FileAccessorPool
+{
+	struct Entry
+	{
+		uint64_t sessionID;
+		std::shared_ptr<MMappedFileAccessor> accessor;
+	};
+
+	std::mutex m_mutex;
+	std::vector<Entry> m_entries;
+	std::unordered_map<uint64_t, size_t> m_sessionCounts;
+	std::set<uint64_t> m_blockedSessions;
+
+	// Index of the least recently used entry satisfying `predicate`, or m_entries.size().
+	template <typename Predicate>
+	size_t LeastRecentlyUsed(Predicate&& predicate) const
+	{
+		size_t victim = m_entries.size();
+		uint64_t oldest = UINT64_MAX;
+		for (size_t i = 0; i < m_entries.size(); i++)
+		{
+			if (!predicate(m_entries[i]))
+				continue;
+			if (auto lastUsed = m_entries[i].accessor->LastUsed(); lastUsed < oldest)
+			{
+				oldest = lastUsed;
+				victim = i;
+			}
+		}
+		return victim;
+	}
+
+	void Evict(size_t index, std::vector<std::shared_ptr<MMappedFileAccessor>>& released)
+	{
+		auto& entry = m_entries[index];
+		if (--m_sessionCounts[entry.sessionID] == 0)
+			m_sessionCounts.erase(entry.sessionID);
+		released.push_back(std::move(entry.accessor));
+		m_entries[index] = std::move(m_entries.back());
+		m_entries.pop_back();
+	}
+
+public:
+	void Insert(uint64_t sessionID, std::shared_ptr<MMappedFileAccessor> accessor)
+	{
+		// Released accessors are destroyed outside the lock.
+		std::vector<std::shared_ptr<MMappedFileAccessor>> released;
+		std::unique_lock<std::mutex> lock(m_mutex);
+
+		// If some background thread has managed to try and open a file when the BV was already closed,
+		// 		we can still give them the file they want so they dont crash, but as soon as they let go it's gone.
+		if (m_blockedSessions.count(sessionID))
+			return;
+
+		while (!m_entries.empty() && m_entries.size() >= maxFPLimit)
+		{
+			size_t sessions = m_sessionCounts.size() + (m_sessionCounts.count(sessionID) ? 0 : 1);
+			size_t fairShare = std::max<size_t>(1, maxFPLimit / sessions);
+
+			size_t victim = m_entries.size();
+			if (auto it = m_sessionCounts.find(sessionID); it != m_sessionCounts.end() && it->second >= fairShare)
+				victim = LeastRecentlyUsed([&](const Entry& e) { return e.sessionID == sessionID; });
+			if (victim == m_entries.size())
+				victim = LeastRecentlyUsed([&](const Entry& e) { return m_sessionCounts.at(e.sessionID) > fairShare; });
+			if (victim == m_entries.size())
+				victim = LeastRecentlyUsed([](const Entry&) { return true; });
+
+			Evict(victim, released);
+			accessorEvictionCount++;
+		}
+
+		m_entries.push_back({sessionID, std::move(accessor)});
+		m_sessionCounts[sessionID]++;
+	}
+
+	void CloseSession(uint64_t sessionID)
+	{
+		std::vector<std::shared_ptr<MMappedFileAccessor>> released;
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_blockedSessions.insert(sessionID);
+		for (size_t i = 0; i < m_entries.size();)
+		{
+			if (m_entries[i].sessionID == sessionID)
+				Evict(i, released);
+			else
+				i++;
+		}
+	}
+
+	void Clear()
+	{
+		std::vector<Entry> released;
+		std::unique_lock<std::mutex> lock(m_mutex);
+		released.swap(m_entries);
+		m_sessionCounts.clear();
+	}
+};
+
+static FileAccessorPool fileAccessorPool;
+
+
+// Registry of lazy accessors by session and path, striped to keep concurrent sessions from contending on one lock.
+struct FileAccessorRegistryShard
+{
+	std::mutex mutex;
+	std::map<std::pair<uint64_t, std::string>, std::shared_ptr<LazyMappedFileAccessor>> accessors;
+	// Files that have been mapped at least once, to tell remaps from first opens.
+	std::set<std::pair<uint64_t, std::string>> mappedBefore;
+};
+
+static std::array<FileAccessorRegistryShard, 16> fileAccessorRegistry;
+
+static FileAccessorRegistryShard& RegistryShardFor(uint64_t sessionID, const std::string& path)
 {
-	std::unique_lock<std::mutex> lock2(fileAccessorsMutex);
-	std::unique_lock<std::mutex> lock(fileAccessorDequeMutex);
+	size_t hash = std::hash<std::string>()(path) ^ std::hash<uint64_t>()(sessionID);
+	return fileAccessorRegistry[hash % fileAccessorRegistry.size()];
+}
+
 
+void VMShutdown()
+{
 	// This will trigger the deallocation logic for these.
 	// It is background threaded to avoid a deadlock on exit.
-	fileAccessorReferenceHolder.clear();
-	fileAccessors.clear();
+	fileAccessorPool.Clear();
+	for (auto& shard : fileAccessorRegistry)
+	{
+		std::unique_lock<std::mutex> lock(shard.mutex);
+		shard.accessors.clear();
+	}
 }
 
 
@@ -205,8 +362,10 @@ void MMAP::Unmap()
 
 std::shared_ptr<LazyMappedFileAccessor> MMappedFileAccessor::Open(BinaryNinja::Ref<BinaryNinja::BinaryView> dscView, const uint64_t sessionID, const std::string &path, std::function<void(std::shared_ptr<MMappedFileAccessor>)> postAllocationRoutine)
 {
-	std::scoped_lock<std::mutex> lock(fileAccessorsMutex);
-	if (auto it = fileAccessors.find(path); it != fileAccessors.end()) {
+	auto& shard = RegistryShardFor(sessionID, path);
+	std::scoped_lock<std::mutex> lock(shard.mutex);
+	auto key = std::make_pair(sessionID, path);
+	if (auto it = shard.accessors.find(key); it != shard.accessors.end()) {
 		return it->second;
 	}
 
@@ -214,55 +373,80 @@ std::shared_ptr<LazyMappedFileAccessor> MMappedFileAccessor::Open(BinaryNinja::R
 		path,
 		// Allocator logic for the SelfAllocatingWeakPtr
 		[path=path, sessionID=sessionID, dscView](){
-			std::unique_lock<std::mutex> _lock(fileAccessorDequeMutex);
-
-			// Iterate through held references and start removing them until we can get a file pointer
-			// FIXME: This could clear all currently used file pointers and still not get one. FIX!
-			// 		We should probably use a condition variable here to wait for a file pointer to be released!!!
-			for (auto& [_, fileAccessorDeque] : fileAccessorReferenceHolder)
+			accessorOpenCount++;
 			{
-				if (fileAccessorSemaphore.try_acquire())
-					break;
-				fileAccessorDeque.pop_front();
+				auto& shard = RegistryShardFor(sessionID, path);
+				std::scoped_lock<std::mutex> lock(shard.mutex);
+				if (!shard.mappedBefore.emplace(sessionID, path).second)
+					accessorRemapCount++;
 			}
 
+			auto resolvedPath = ResolveFilePath(dscView, path);
+			std::string slidImagePath;
+			{
+				std::scoped_lock<std::mutex> slidLock(slidImagesMutex);
+				if (auto it = slidImages.find(resolvedPath); it != slidImages.end())
+					slidImagePath = it->second;
+			}
 			mmapCount++;
-			_lock.unlock();
-			auto accessor = std::shared_ptr<MMappedFileAccessor>(new MMappedFileAccessor(ResolveFilePath(dscView, path)), [](MMappedFileAccessor* accessor){
+			auto accessor = std::shared_ptr<MMappedFileAccessor>(new MMappedFileAccessor(resolvedPath, slidImagePath), [sessionID, path](MMappedFileAccessor* accessor){
 				// worker thread or we can deadlock on exit here.
-				BinaryNinja::WorkerEnqueue([accessor](){
-					fileAccessorSemaphore.release();
+				BinaryNinja::WorkerEnqueue([accessor, sessionID, path](){
 					mmapCount--;
-					if (fileAccessors.count(accessor->m_path))
 					{
-						std::scoped_lock<std::mutex> lock(fileAccessorsMutex);
-						fileAccessors.erase(accessor->m_path);
+						auto& shard = RegistryShardFor(sessionID, path);
+						std::scoped_lock<std::mutex> lock(shard.mutex);
+						shard.accessors.erase({sessionID, path});
 					}
 					delete accessor;
 				}, "MMappedFileAccessor Destructor");
 			});
-			_lock.lock();
-			// If some background thread has managed to try and open a file when the BV was already closed,
-			// 		we can still give them the file they want so they dont crash, but as soon as they let go it's gone.
-			if (!blockedSessionIDs.count(sessionID))
-				fileAccessorReferenceHolder[sessionID].push_back(accessor);
+			if (!slidImagePath.empty())
+				accessor->SetSlideInfoWasApplied(true);
+			fileAccessorPool.Insert(sessionID, accessor);
 			return accessor;
 		},
 		[postAllocationRoutine=postAllocationRoutine](std::shared_ptr<MMappedFileAccessor> accessor){
 			if (postAllocationRoutine)
 				postAllocationRoutine(std::move(accessor));
 		});
-	fileAccessors.insert_or_assign(path, fileAcccessor);
+	shard.accessors.insert_or_assign(key, fileAcccessor);
 	return fileAcccessor;
 }
 
 
+std::shared_ptr<MMappedFileAccessor> LazyMappedFileAccessor::lock()
+{
+	auto accessor = SelfAllocatingWeakPtr::lock();
+	// The lock count doubles as the clock the pool's LRU ordering is based on.
+	accessor->m_lastUsed.store(accessorLockCount++, std::memory_order_relaxed);
+	return accessor;
+}
+
+
 void MMappedFileAccessor::CloseAll(const uint64_t sessionID)
 {
-	blockedSessionIDs.insert(sessionID);
-	if (fileAccessorReferenceHolder.count(sessionID) == 0)
-		return;
-	fileAccessorReferenceHolder.erase(sessionID);
+	fileAccessorPool.CloseSession(sessionID);
+
+	// Drop the session's lazy accessors too; they hold a reference to its view.
+	for (auto& shard : fileAccessorRegistry)
+	{
+		std::scoped_lock<std::mutex> lock(shard.mutex);
+		for (auto it = shard.accessors.begin(); it != shard.accessors.end();)
+		{
+			if (it->first.first == sessionID)
+				it = shard.accessors.erase(it);
+			else
+				++it;
+		}
+		for (auto it = shard.mappedBefore.begin(); it != shard.mappedBefore.end();)
+		{
+			if (it->first == sessionID)
+				it = shard.mappedBefore.erase(it);
+			else
+				++it;
+		}
+	}
 }
 
 
@@ -304,12 +488,38 @@ void MMappedFileAccessor::InitialVMSetup()
 		}
 	}
 	BinaryNinja::LogInfo("Shared Cache processing initialized with a max file pointer limit of 0x%llx", maxFPLimit);
-	fileAccessorSemaphore.set_count(maxFPLimit);
 }
 
 
-MMappedFileAccessor::MMappedFileAccessor(const std::string& path) : m_path(path)
+uint64_t MMappedFileAccessor::MaxOpenFileCount()
+{
+	return maxFPLimit;
+}
+
+
+FileAccessorPoolStats MMappedFileAccessor::PoolStats()
 {
+	FileAccessorPoolStats stats;
+	stats.limit = maxFPLimit;
+	stats.mapped = mmapCount.load();
+	stats.opens = accessorOpenCount.load();
+	stats.hits = accessorLockCount.load() - stats.opens;
+	stats.remaps = accessorRemapCount.load();
+	stats.evictions = accessorEvictionCount.load();
+	return stats;
+}
+
+
+void MMappedFileAccessor::RegisterSlidImage(const std::string& path, const std::string& slidImagePath)
+{
+	std::scoped_lock<std::mutex> lock(slidImagesMutex);
+	slidImages.insert_or_assign(path, slidImagePath);
+}
+
+
+MMappedFileAccessor::MMappedFileAccessor(const std::string& filePath, const std::string& mappedPath) : m_path(filePath)
+{
+	const std::string& path = mappedPath.empty() ? filePath : mappedPath;
 #ifdef _MSC_VER
 	m_mmap.hFile = CreateFile(
 		path.c_str(),              // file name
@@ -380,23 +590,19 @@ void MMappedFileAccessor::WritePointer(size_t address, size_t pointer)
 }
 
 std::string MMappedFileAccessor::ReadNullTermString(size_t address)
+{
+	return std::string(ReadStringView(address));
+}
+
+std::string_view MMappedFileAccessor::ReadStringView(size_t address)
 {
 	if (address > m_mmap.len)
-		return "";
-	size_t max = m_mmap.len;
-	size_t i = address;
-	std::string str;
-	str.reserve(140);
-	while (i < max)
-	{
-		char c = ((char*)(&((uint8_t*)m_mmap._mmap)[i]))[0];
-		if (c == 0)
-			break;
-		str += c;
-		i++;
-	}
-	str.shrink_to_fit();
-	return str;
+		return {};
+	const char* str = (const char*)m_mmap._mmap + address;
+	size_t max = m_mmap.len - address;
+	if (auto terminator = (const char*)memchr(str, 0, max))
+		return {str, (size_t)(terminator - str)};
+	return {str, max};
 }
 
 uint8_t MMappedFileAccessor::ReadUChar(size_t address)
@@ -508,34 +714,67 @@ void VM::MapPages(BinaryNinja::Ref<BinaryNinja::BinaryView> dscView, uint64_t se
 	}
 
 	auto accessor = MMappedFileAccessor::Open(std::move(dscView), sessionID, filePath, postAllocationRoutine);
-	auto [it, inserted] = m_map.insert_or_assign({vm_address, vm_address + size}, PageMapping(std::move(accessor), fileoff));
-	if (m_safe && !inserted)
+	AddressRange range = {vm_address, vm_address + size};
+	auto it = std::lower_bound(m_mappings.begin(), m_mappings.end(), range,
+		[](const Mapping& a, const AddressRange& b) { return a.range < b; });
+	if (it != m_mappings.end() && it->range.start == range.start && it->range.end == range.end)
 	{
-		BNLogWarn("Remapping page 0x%zx (f: 0x%zx)", vm_address, fileoff);
-		throw MappingCollisionException();
+		if (m_safe)
+		{
+			BNLogWarn("Remapping page 0x%zx (f: 0x%zx)", vm_address, fileoff);
+			throw MappingCollisionException();
+		}
+		it->mapping = PageMapping(std::move(accessor), fileoff);
+		return;
 	}
+	m_mappings.emplace(it, range, PageMapping(std::move(accessor), fileoff));
+	m_lastHit.store(0, std::memory_order_relaxed);
 }
 
-std::pair<PageMapping, size_t> VM::MappingAtAddress(size_t address)
+const VM::Mapping* VM::FindMapping(size_t address) const
 {
-	if (auto it = m_map.find(address); it != m_map.end())
+	size_t hint = m_lastHit.load(std::memory_order_relaxed);
+	if (hint < m_mappings.size())
 	{
-		// The PageMapping object returned contains the page, and more importantly, the file pointer (there can be
-		// multiple in newer caches) This is relevant for reading out the data in the rest of this file.
-		// The second item in the returned pair is the offset of `address` within the file.
-		auto& range = it->first;
-		auto& mapping = it->second;
-		return {mapping, mapping.fileOffset + (address - range.start)};
+		const auto& mapping = m_mappings[hint];
+		if (address >= mapping.range.start && address < mapping.range.end)
+			return &mapping;
 	}
 
+	// First mapping starting after `address`; the candidate is the one before it.
+	auto it = std::upper_bound(m_mappings.begin(), m_mappings.end(), address,
+		[](size_t addr, const Mapping& mapping) { return addr < mapping.range.start; });
+	if (it == m_mappings.begin())
+		return nullptr;
+	--it;
+	if (address >= it->range.end)
+		return nullptr;
+
+	m_lastHit.store(it - m_mappings.begin(), std::memory_order_relaxed);
+	return &*it;
+}
+
+std::pair<const PageMapping*, size_t> VM::Resolve(size_t address) const
+{
+	if (auto mapping = FindMapping(address))
+		return {&mapping->mapping, mapping->mapping.fileOffset + (address - mapping->range.start)};
+
 	throw MappingReadException();
 }
 
+std::pair<PageMapping, size_t> VM::MappingAtAddress(size_t address)
+{
+	// The PageMapping object returned contains the page, and more importantly, the file pointer (there can be
+	// multiple in newer caches) This is relevant for reading out the data in the rest of this file.
+	// The second item in the returned pair is the offset of `address` within the file.
+	auto [mapping, fileOffset] = Resolve(address);
+	return {*mapping, fileOffset};
+}
+
 
 bool VM::AddressIsMapped(uint64_t address)
 {
-	auto it = m_map.find(address);
-	return it != m_map.end();
+	return FindMapping(address) != nullptr;
 }
 
 
@@ -594,74 +833,128 @@ int64_t VMReader::ReadSLEB128(size_t limit)
 
 std::string VM::ReadNullTermString(size_t address)
 {
-	auto mapping = MappingAtAddress(address);
-	return mapping.first.fileAccessor->lock()->ReadNullTermString(mapping.second);
+	auto [mapping, fileOffset] = Resolve(address);
+	return mapping->fileAccessor->lock()->ReadNullTermString(fileOffset);
 }
 
 uint8_t VM::ReadUChar(size_t address)
 {
-	auto mapping = MappingAtAddress(address);
-	return mapping.first.fileAccessor->lock()->ReadUChar(mapping.second);
+	auto [mapping, fileOffset] = Resolve(address);
+	return mapping->fileAccessor->lock()->ReadUChar(fileOffset);
 }
 
 int8_t VM::ReadChar(size_t address)
 {
-	auto mapping = MappingAtAddress(address);
-	return mapping.first.fileAccessor->lock()->ReadChar(mapping.second);
+	auto [mapping, fileOffset] = Resolve(address);
+	return mapping->fileAccessor->lock()->ReadChar(fileOffset);
 }
 
 uint16_t VM::ReadUShort(size_t address)
 {
-	auto mapping = MappingAtAddress(address);
-	return mapping.first.fileAccessor->lock()->ReadUShort(mapping.second);
+	auto [mapping, fileOffset] = Resolve(address);
+	return mapping->fileAccessor->lock()->ReadUShort(fileOffset);
 }
 
 int16_t VM::ReadShort(size_t address)
 {
-	auto mapping = MappingAtAddress(address);
-	return mapping.first.fileAccessor->lock()->ReadShort(mapping.second);
+	auto [mapping, fileOffset] = Resolve(address);
+	return mapping->fileAccessor->lock()->ReadShort(fileOffset);
 }
 
 uint32_t VM::ReadUInt32(size_t address)
 {
-	auto mapping = MappingAtAddress(address);
-	return mapping.first.fileAccessor->lock()->ReadUInt32(mapping.second);
+	auto [mapping, fileOffset] = Resolve(address);
+	return mapping->fileAccessor->lock()->ReadUInt32(fileOffset);
 }
 
 int32_t VM::ReadInt32(size_t address)
 {
-	auto mapping = MappingAtAddress(address);
-	return mapping.first.fileAccessor->lock()->ReadInt32(mapping.second);
+	auto [mapping, fileOffset] = Resolve(address);
+	return mapping->fileAccessor->lock()->ReadInt32(fileOffset);
 }
 
 uint64_t VM::ReadULong(size_t address)
 {
-	auto mapping = MappingAtAddress(address);
-	return mapping.first.fileAccessor->lock()->ReadULong(mapping.second);
+	auto [mapping, fileOffset] = Resolve(address);
+	return mapping->fileAccessor->lock()->ReadULong(fileOffset);
 }
 
 int64_t VM::ReadLong(size_t address)
 {
-	auto mapping = MappingAtAddress(address);
-	return mapping.first.fileAccessor->lock()->ReadLong(mapping.second);
+	auto [mapping, fileOffset] = Resolve(address);
+	return mapping->fileAccessor->lock()->ReadLong(fileOffset);
 }
 
 BinaryNinja::DataBuffer VM::ReadBuffer(size_t addr, size_t length)
 {
-	auto mapping = MappingAtAddress(addr);
-	return mapping.first.fileAccessor->lock()->ReadBuffer(mapping.second, length);
+	auto [mapping, fileOffset] = Resolve(addr);
+	return mapping->fileAccessor->lock()->ReadBuffer(fileOffset, length);
+}
+
+MappedSpan VM::ReadSpan(size_t addr, size_t length)
+{
+	auto [mapping, fileOffset] = Resolve(addr);
+	auto accessor = mapping->fileAccessor->lock();
+	auto span = accessor->ReadSpan(fileOffset, length);
+	return {std::move(accessor), span};
+}
+
+MappedStringView VM::ReadStringView(size_t address)
+{
+	auto [mapping, fileOffset] = Resolve(address);
+	auto accessor = mapping->fileAccessor->lock();
+	auto str = accessor->ReadStringView(fileOffset);
+	return {std::move(accessor), str};
 }
 
 
 void VM::Read(void* dest, size_t addr, size_t length)
 {
-	auto mapping = MappingAtAddress(addr);
-	mapping.first.fileAccessor->lock()->Read(dest, mapping.second, length);
+	auto [mapping, fileOffset] = Resolve(addr);
+	mapping->fileAccessor->lock()->Read(dest, fileOffset, length);
 }
 
 VMReader::VMReader(std::shared_ptr<VM> vm, size_t addressSize) : m_vm(vm), m_cursor(0), m_addressSize(addressSize) {}
 
 
+const uint8_t* VMReader::Translate(size_t address, size_t length)
+{
+	if (address >= m_cachedStart && address < m_cachedEnd && length <= m_cachedEnd - address)
+		return m_cachedBase + (address - m_cachedStart);
+
+	auto mapping = m_vm->FindMapping(address);
+	if (!mapping)
+		throw MappingReadException();
+
+	auto accessor = mapping->mapping.fileAccessor->lock();
+	size_t fileOffset = mapping->mapping.fileOffset;
+	size_t fileLength = accessor->Length();
+	if (fileOffset > fileLength)
+		throw MappingReadException();
+
+	m_cachedBase = (const uint8_t*)accessor->Data() + fileOffset;
+	m_cachedStart = mapping->range.start;
+	m_cachedEnd = m_cachedStart + std::min(mapping->range.end - m_cachedStart, fileLength - fileOffset);
+	m_cachedAccessor = std::move(accessor);
+
+	// Reads straddling the end of a mapping fall through to the backing file, as they always have.
+	size_t offset = address - m_cachedStart;
+	if (offset > fileLength - fileOffset || length > fileLength - fileOffset - offset)
+		throw MappingReadException();
+	return m_cachedBase + offset;
+}
+
+
+template <typename T>
+T VMReader::ReadAt(size_t address)
+{
+	T result;
+	memcpy(&result, Translate(address, sizeof(T)), sizeof(T));
+	m_cursor = address + sizeof(T);
+	return result;
+}
+
+
 void VMReader::Seek(size_t address)
 {
 	m_cursor = address;
@@ -674,64 +967,58 @@ void VMReader::SeekRelative(size_t offset)
 
 std::string VMReader::ReadCString(size_t address)
 {
-	auto mapping = m_vm->MappingAtAddress(address);
-	return mapping.first.fileAccessor->lock()->ReadNullTermString(mapping.second);
+	return std::string(ReadCStringView(address).data);
+}
+
+MappedStringView VMReader::ReadCStringView(size_t address)
+{
+	auto str = (const char*)Translate(address, 1);
+	// Strings may run past the end of the mapping, but never past the end of the backing file.
+	auto fileEnd = (const char*)m_cachedAccessor->Data() + m_cachedAccessor->Length();
+	size_t max = fileEnd - str;
+	if (auto terminator = (const char*)memchr(str, 0, max))
+		return {m_cachedAccessor, {str, (size_t)(terminator - str)}};
+	return {m_cachedAccessor, {str, max}};
 }
 
 uint8_t VMReader::ReadUChar(size_t address)
 {
-	auto mapping = m_vm->MappingAtAddress(address);
-	m_cursor = address + 1;
-	return mapping.first.fileAccessor->lock()->ReadUChar(mapping.second);
+	return ReadAt<uint8_t>(address);
 }
 
 int8_t VMReader::ReadChar(size_t address)
 {
-	auto mapping = m_vm->MappingAtAddress(address);
-	m_cursor = address + 1;
-	return mapping.first.fileAccessor->lock()->ReadChar(mapping.second);
+	return ReadAt<int8_t>(address);
 }
 
 uint16_t VMReader::ReadUShort(size_t address)
 {
-	auto mapping = m_vm->MappingAtAddress(address);
-	m_cursor = address + 2;
-	return mapping.first.fileAccessor->lock()->ReadUShort(mapping.second);
+	return ReadAt<uint16_t>(address);
 }
 
 int16_t VMReader::ReadShort(size_t address)
 {
-	auto mapping = m_vm->MappingAtAddress(address);
-	m_cursor = address + 2;
-	return mapping.first.fileAccessor->lock()->ReadShort(mapping.second);
+	return ReadAt<int16_t>(address);
 }
 
 uint32_t VMReader::ReadUInt32(size_t address)
 {
-	auto mapping = m_vm->MappingAtAddress(address);
-	m_cursor = address + 4;
-	return mapping.first.fileAccessor->lock()->ReadUInt32(mapping.second);
+	return ReadAt<uint32_t>(address);
 }
 
 int32_t VMReader::ReadInt32(size_t address)
 {
-	auto mapping = m_vm->MappingAtAddress(address);
-	m_cursor = address + 4;
-	return mapping.first.fileAccessor->lock()->ReadInt32(mapping.second);
+	return ReadAt<int32_t>(address);
 }
 
 uint64_t VMReader::ReadULong(size_t address)
 {
-	auto mapping = m_vm->MappingAtAddress(address);
-	m_cursor = address + 8;
-	return mapping.first.fileAccessor->lock()->ReadULong(mapping.second);
+	return ReadAt<uint64_t>(address);
 }
 
 int64_t VMReader::ReadLong(size_t address)
 {
-	auto mapping = m_vm->MappingAtAddress(address);
-	m_cursor = address + 8;
-	return mapping.first.fileAccessor->lock()->ReadLong(mapping.second);
+	return ReadAt<int64_t>(address);
 }
 
 
@@ -759,85 +1046,77 @@ size_t VMReader::ReadPointer()
 
 BinaryNinja::DataBuffer VMReader::ReadBuffer(size_t length)
 {
-	auto mapping = m_vm->MappingAtAddress(m_cursor);
-	m_cursor += length;
-	return mapping.first.fileAccessor->lock()->ReadBuffer(mapping.second, length);
+	return ReadBuffer(m_cursor, length);
 }
 
 BinaryNinja::DataBuffer VMReader::ReadBuffer(size_t addr, size_t length)
 {
-	auto mapping = m_vm->MappingAtAddress(addr);
+	auto data = Translate(addr, length);
 	m_cursor = addr + length;
-	return mapping.first.fileAccessor->lock()->ReadBuffer(mapping.second, length);
+	return BinaryNinja::DataBuffer(data, length);
+}
+
+MappedSpan VMReader::ReadSpan(size_t length)
+{
+	return ReadSpan(m_cursor, length);
+}
+
+MappedSpan VMReader::ReadSpan(size_t addr, size_t length)
+{
+	auto data = Translate(addr, length);
+	m_cursor = addr + length;
+	return {m_cachedAccessor, {data, data + length}};
 }
 
 void VMReader::Read(void* dest, size_t length)
 {
-	auto mapping = m_vm->MappingAtAddress(m_cursor);
-	m_cursor += length;
-	mapping.first.fileAccessor->lock()->Read(dest, mapping.second, length);
+	Read(dest, m_cursor, length);
 }
 
 void VMReader::Read(void* dest, size_t addr, size_t length)
 {
-	auto mapping = m_vm->MappingAtAddress(addr);
+	auto data = Translate(addr, length);
 	m_cursor = addr + length;
-	mapping.first.fileAccessor->lock()->Read(dest, mapping.second, length);
+	memcpy(dest, data, length);
 }
 
 
 uint8_t VMReader::Read8()
 {
-	auto mapping = m_vm->MappingAtAddress(m_cursor);
-	m_cursor += 1;
-	return mapping.first.fileAccessor->lock()->ReadUChar(mapping.second);
+	return ReadAt<uint8_t>(m_cursor);
 }
 
 int8_t VMReader::ReadS8()
 {
-	auto mapping = m_vm->MappingAtAddress(m_cursor);
-	m_cursor += 1;
-	return mapping.first.fileAccessor->lock()->ReadChar(mapping.second);
+	return ReadAt<int8_t>(m_cursor);
 }
 
 uint16_t VMReader::Read16()
 {
-	auto mapping = m_vm->MappingAtAddress(m_cursor);
-	m_cursor += 2;
-	return mapping.first.fileAccessor->lock()->ReadUShort(mapping.second);
+	return ReadAt<uint16_t>(m_cursor);
 }
 
 int16_t VMReader::ReadS16()
 {
-	auto mapping = m_vm->MappingAtAddress(m_cursor);
-	m_cursor += 2;
-	return mapping.first.fileAccessor->lock()->ReadShort(mapping.second);
+	return ReadAt<int16_t>(m_cursor);
 }
 
 uint32_t VMReader::Read32()
 {
-	auto mapping = m_vm->MappingAtAddress(m_cursor);
-	m_cursor += 4;
-	return mapping.first.fileAccessor->lock()->ReadUInt32(mapping.second);
+	return ReadAt<uint32_t>(m_cursor);
 }
 
 int32_t VMReader::ReadS32()
 {
-	auto mapping = m_vm->MappingAtAddress(m_cursor);
-	m_cursor += 4;
-	return mapping.first.fileAccessor->lock()->ReadInt32(mapping.second);
+	return ReadAt<int32_t>(m_cursor);
 }
 
 uint64_t VMReader::Read64()
 {
-	auto mapping = m_vm->MappingAtAddress(m_cursor);
-	m_cursor += 8;
-	return mapping.first.fileAccessor->lock()->ReadULong(mapping.second);
+	return ReadAt<uint64_t>(m_cursor);
 }
 
 int64_t VMReader::ReadS64()
 {
-	auto mapping = m_vm->MappingAtAddress(m_cursor);
-	m_cursor += 8;
-	return mapping.first.fileAccessor->lock()->ReadLong(mapping.second);
+	return ReadAt<int64_t>(m_cursor);
 }
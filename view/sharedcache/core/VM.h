@@ -5,50 +5,14 @@
 #ifndef SHAREDCACHE_VM_H
 #define SHAREDCACHE_VM_H
 #include <binaryninjaapi.h>
-#include <condition_variable>
+#include <atomic>
+#include <mutex>
+#include <string_view>
 
 void VMShutdown();
 
 std::string ResolveFilePath(BinaryNinja::Ref<BinaryNinja::BinaryView> dscView, const std::string& path);
 
-class counting_semaphore {
-public:
-	explicit counting_semaphore(int count = 0) : count_(count) {}
-
-	void release(int update = 1) {
-		std::unique_lock<std::mutex> lock(mutex_);
-		count_ += update;
-		cv_.notify_all();
-	}
-
-	void acquire() {
-		std::unique_lock<std::mutex> lock(mutex_);
-		cv_.wait(lock, [this]() { return count_ > 0; });
-		--count_;
-	}
-
-	bool try_acquire() {
-		std::unique_lock<std::mutex> lock(mutex_);
-		if (count_ > 0) {
-			--count_;
-			return true;
-		}
-		return false;
-	}
-
-	void set_count(int new_count) {
-		std::unique_lock<std::mutex> lock(mutex_);
-		count_ = new_count;
-		cv_.notify_all();
-	}
-
-private:
-	std::mutex mutex_;
-	std::condition_variable cv_;
-	int count_;
-};
-
-
 template <typename T>
 class SelfAllocatingWeakPtr {
 public:
@@ -56,6 +20,8 @@ public:
 		: allocator(allocator), postAlloc(postAlloc) {}
 
 	std::shared_ptr<T> lock() {
+		// Held across allocation so concurrent callers never see an object whose postAlloc hasn't finished.
+		std::unique_lock<std::mutex> guard(mutex);
 		std::shared_ptr<T> sharedPtr = weakPtr.lock();
 		if (!sharedPtr) {
 			sharedPtr = allocator();
@@ -66,10 +32,12 @@ public:
 	}
 
 	std::shared_ptr<T> lock_no_allocate() {
+		std::unique_lock<std::mutex> guard(mutex);
 		return weakPtr.lock();
 	}
 
 private:
+	std::mutex mutex;
 	std::weak_ptr<T> weakPtr;                       // Weak reference to the object
 	std::function<std::shared_ptr<T>()> allocator;  // Function to recreate the object
 	std::function<void(std::shared_ptr<T>)> postAlloc;  // Function to call after the object is allocated
@@ -113,27 +81,35 @@ public:
 
     std::string_view filePath() const { return m_filePath; }
 
+    // Returns the mapped file, (re)opening it through the accessor pool if it isn't currently mapped.
+    std::shared_ptr<MMappedFileAccessor> lock();
+
 private:
     std::string m_filePath;
 };
 
-static uint64_t maxFPLimit;
-static std::mutex fileAccessorDequeMutex;
-static std::unordered_map<uint64_t, std::deque<std::shared_ptr<MMappedFileAccessor>>> fileAccessorReferenceHolder;
-static std::set<uint64_t> blockedSessionIDs;
-static std::mutex fileAccessorsMutex;
-static std::unordered_map<std::string, std::shared_ptr<LazyMappedFileAccessor>> fileAccessors;
-static counting_semaphore fileAccessorSemaphore(0);
-
-static std::atomic<uint64_t> mmapCount = 0;
+// Counters for the pool of mapped file accessors shared by every session, useful for sizing
+// BN_SHAREDCACHE_FP_MAX from real workloads.
+struct FileAccessorPoolStats {
+	uint64_t limit;      // Maximum number of accessors the pool keeps mapped
+	uint64_t mapped;     // Accessors currently mapped, pooled or not
+	uint64_t hits;       // Locks satisfied by an already mapped accessor
+	uint64_t opens;      // Locks that had to map the file
+	uint64_t remaps;     // Opens of a file that had been mapped and released before
+	uint64_t evictions;  // Accessors dropped from the pool to make room for another
+};
 
 class MMappedFileAccessor {
+	friend LazyMappedFileAccessor;
+
     std::string m_path;
     MMAP m_mmap;
 	bool m_slideInfoWasApplied = false;
+	std::atomic<uint64_t> m_lastUsed = 0;
 
 public:
-	MMappedFileAccessor(const std::string &path);
+	// `path` identifies the file. If `mappedPath` is given, that file is mapped in its place.
+	MMappedFileAccessor(const std::string &path, const std::string &mappedPath = {});
 	~MMappedFileAccessor();
 
 	static std::shared_ptr<LazyMappedFileAccessor> Open(BinaryNinja::Ref<BinaryNinja::BinaryView> dscView, const uint64_t sessionID, const std::string &path, std::function<void(std::shared_ptr<MMappedFileAccessor>)> postAllocationRoutine = nullptr);
@@ -142,6 +118,17 @@ public:
 
 	static void InitialVMSetup();
 
+	// The number of file accessors that may be mapped at once before older ones start being evicted.
+	static uint64_t MaxOpenFileCount();
+
+	static FileAccessorPoolStats PoolStats();
+
+	uint64_t LastUsed() const { return m_lastUsed.load(std::memory_order_relaxed); }
+
+	// Maps `slidImagePath`, a copy of `path` with slide info already applied, whenever `path` is
+	// (re)opened from now on. Accessors opened this way report SlideInfoWasApplied() from the start.
+	static void RegisterSlidImage(const std::string& path, const std::string& slidImagePath);
+
     std::string Path() const { return m_path; };
 
     size_t Length() const { return m_mmap.len; };
@@ -195,10 +182,31 @@ public:
     // C++ version supports it.
     std::pair<const uint8_t*, const uint8_t*> ReadSpan(size_t addr, size_t length);
 
+    // Returns a view of the null terminated string at `address`, bounded by the end of the file.
+    // WARNING: The view returned by this method is only valid for the lifetime
+    // of this file accessor.
+    std::string_view ReadStringView(size_t address);
+
     void Read(void *dest, size_t addr, size_t length);
 };
 
 
+// Data read directly out of a memory mapped backing file without copying.
+// The accessor lock held here keeps the mapping alive, so `data` is valid for exactly
+// as long as this object is.
+template <typename T>
+struct ScopedMappedData {
+    std::shared_ptr<MMappedFileAccessor> accessor;
+    T data;
+
+    const T& operator*() const { return data; }
+    const T* operator->() const { return &data; }
+};
+
+using MappedSpan = ScopedMappedData<std::pair<const uint8_t*, const uint8_t*>>;
+using MappedStringView = ScopedMappedData<std::string_view>;
+
+
 struct PageMapping {
     std::shared_ptr<LazyMappedFileAccessor> fileAccessor;
     size_t fileOffset;
@@ -255,14 +263,27 @@ class VM {
         }
     };
 
-    // A map keyed by address ranges that can be looked up via any
-    // address within a range thanks to C++14's transparent comparators.
-    std::map<AddressRange, PageMapping, std::less<>> m_map;
+    struct Mapping {
+        AddressRange range;
+        PageMapping mapping;
+        Mapping(AddressRange range, PageMapping mapping) : range(range), mapping(std::move(mapping)) {}
+    };
+
+    // Flat table of mappings sorted by start address. Lookups are a binary search over
+    // contiguous memory, short-circuited by `m_lastHit` since consecutive reads almost
+    // always land in the same mapping.
+    std::vector<Mapping> m_mappings;
+    mutable std::atomic<size_t> m_lastHit = 0;
     size_t m_pageSize;
     bool m_safe;
 
     friend VMReader;
 
+    const Mapping* FindMapping(size_t address) const;
+
+    // Like `MappingAtAddress` but without copying the mapping, for internal read paths.
+    std::pair<const PageMapping*, size_t> Resolve(size_t address) const;
+
 public:
 
     VM(size_t pageSize, bool safe = true);
@@ -295,6 +316,10 @@ public:
 
     BinaryNinja::DataBuffer ReadBuffer(size_t addr, size_t length);
 
+    MappedSpan ReadSpan(size_t addr, size_t length);
+
+    MappedStringView ReadStringView(size_t address);
+
     void Read(void *dest, size_t addr, size_t length);
 };
 
@@ -306,6 +331,19 @@ class VMReader {
 
 	BNEndianness m_endianness = LittleEndian;
 
+	// The mapping the cursor last resolved into. Reads falling entirely within
+	// [m_cachedStart, m_cachedEnd) are served straight from `m_cachedBase` without
+	// consulting the VM. Holding `m_cachedAccessor` keeps the backing memory alive.
+	std::shared_ptr<MMappedFileAccessor> m_cachedAccessor;
+	const uint8_t* m_cachedBase = nullptr;
+	size_t m_cachedStart = 0;
+	size_t m_cachedEnd = 0;
+
+	const uint8_t* Translate(size_t address, size_t length);
+
+	template <typename T>
+	T ReadAt(size_t address);
+
 public:
     VMReader(std::shared_ptr<VM> vm, size_t addressSize = 8);
 
@@ -321,6 +359,8 @@ public:
 
     std::string ReadCString(size_t address);
 
+    MappedStringView ReadCStringView(size_t address);
+
     uint64_t ReadULEB128(size_t cursorLimit);
 
     int64_t ReadSLEB128(size_t cursorLimit);
@@ -365,6 +405,10 @@ public:
 
     BinaryNinja::DataBuffer ReadBuffer(size_t addr, size_t length);
 
+    MappedSpan ReadSpan(size_t length);
+
+    MappedSpan ReadSpan(size_t addr, size_t length);
+
     void Read(void *dest, size_t length);
 
     void Read(void *dest, size_t addr, size_t length);
@@ -11,6 +11,8 @@
 #include "progresstask.h"
 
 #include <cmath>
+#include <numeric>
+#include <thread>
 #include <QMessageBox>
 
 
@@ -402,7 +404,7 @@ SymbolTableModel::SymbolTableModel(SymbolTableView* parent)
 
 int SymbolTableModel::rowCount(const QModelIndex& parent) const {
 	Q_UNUSED(parent);
-	return static_cast<int>(m_symbols.size());
+	return static_cast<int>(m_rows.size());
 }
 
 int SymbolTableModel::columnCount(const QModelIndex& parent) const {
@@ -416,7 +418,7 @@ QVariant SymbolTableModel::data(const QModelIndex& index, int role) const {
 		return QVariant();
 	}
 
-	const SharedCacheAPI::DSCSymbol& symbol = m_symbols.at(index.row());
+	const SharedCacheAPI::DSCSymbol& symbol = symbolAt(index.row());
 
 	switch (index.column()) {
 	case 0: // Address column
@@ -448,40 +450,86 @@ QVariant SymbolTableModel::headerData(int section, Qt::Orientation orientation,
 }
 
 void SymbolTableModel::updateSymbols() {
-	m_symbols = m_parent->m_symbols;
-	setFilter(m_filter);
+	m_loaded = true;
+	std::string filter = m_requestedFilter;
+	setFilter("");
+	setFilter(filter);
 }
 
 const SharedCacheAPI::DSCSymbol& SymbolTableModel::symbolAt(int row) const {
-	return m_symbols.at(row);
+	return m_parent->m_symbols.at(m_rows.at(row));
 }
 
 
-void SymbolTableModel::setFilter(std::string text)
+std::vector<uint32_t> SymbolTableModel::filterRows(
+	const std::vector<uint32_t>* candidates, const std::string& text, uint64_t generation) const
 {
-	beginResetModel();
+	const auto& symbols = m_parent->m_symbols;
+	size_t count = candidates ? candidates->size() : symbols.size();
+	size_t threadCount = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), count / 0x10000));
+	size_t chunk = (count + threadCount - 1) / threadCount;
+
+	std::vector<std::vector<uint32_t>> matches(threadCount);
+	auto scan = [&](size_t part) {
+		for (size_t i = part * chunk; i < std::min(count, (part + 1) * chunk); i++)
+		{
+			if ((i & 0xffff) == 0 && m_filterGeneration != generation)
+				return;
+			uint32_t row = candidates ? (*candidates)[i] : static_cast<uint32_t>(i);
+			if (symbols[row].name.find(text) != std::string::npos)
+				matches[part].push_back(row);
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (size_t part = 1; part < threadCount; part++)
+		threads.emplace_back(scan, part);
+	scan(0);
+	for (auto& thread : threads)
+		thread.join();
+
+	std::vector<uint32_t> rows;
+	for (auto& part : matches)
+		rows.insert(rows.end(), part.begin(), part.end());
+	return rows;
+}
 
-	m_filter = text;
-	m_symbols.clear();
 
-	if (m_filter.empty())
-	{
-		m_symbols = m_parent->m_symbols;
-	}
-	else
+void SymbolTableModel::setFilter(std::string text)
+{
+	m_requestedFilter = text;
+	uint64_t generation = ++m_filterGeneration;
+	// The symbols are still being loaded; updateSymbols applies the filter once they are here
+	if (!m_loaded)
+		return;
+
+	if (text.empty())
 	{
-		m_symbols.reserve(m_parent->m_symbols.size());
-		for (const auto& symbol : m_parent->m_symbols)
-		{
-			if (symbol.name.find(m_filter) != std::string::npos)
-			{
-				m_symbols.push_back(symbol);
-			}
-		}
-		m_symbols.shrink_to_fit();
+		beginResetModel();
+		m_filter.clear();
+		m_rows.resize(m_parent->m_symbols.size());
+		std::iota(m_rows.begin(), m_rows.end(), 0);
+		endResetModel();
+		return;
 	}
 
-	endResetModel();
+	// A filter containing the current one can only remove rows, so only the current rows need checking
+	auto candidates = std::make_shared<std::vector<uint32_t>>();
+	bool narrowing = !m_filter.empty() && text.find(m_filter) != std::string::npos;
+	if (narrowing)
+		*candidates = m_rows;
+
+	auto rows = std::make_shared<std::vector<uint32_t>>();
+	BackgroundThread::create(this)->thenBackground([this, text, candidates, narrowing, rows, generation]() {
+		*rows = filterRows(narrowing ? candidates.get() : nullptr, text, generation);
+	})->thenMainThread([this, text, rows, generation]() {
+		if (m_filterGeneration != generation)
+			return;
+		beginResetModel();
+		m_filter = text;
+		m_rows = std::move(*rows);
+		endResetModel();
+	})->start();
 }
 
 
@@ -595,25 +643,24 @@ DSCTriageView::DSCTriageView(QWidget* parent, BinaryViewRef data) : QWidget(pare
 				new QStandardItem(QString("0x%1").arg(mapping.size, 0, 16))});
 		}
 
-		for (const auto& header : m_headers)
+		if (!m_images)
+			m_images = m_cache->GetImages();
+		for (const auto& image : *m_images)
 		{
-			uint64_t i = 0;
-			for (const auto& section : header.sections)
+			for (const auto& section : image.mappings)
 			{
 				for (const auto& mapping : index.mappings)
 				{
-					if (section.addr >= mapping.vmAddress && section.addr < mapping.vmAddress + mapping.size)
+					if (section.vmAddress >= mapping.vmAddress && section.vmAddress < mapping.vmAddress + mapping.size)
 					{
 						sectionModel->appendRow({
-							new QStandardItem(QString::fromStdString(header.sectionNames[i])),
-							new QStandardItem(QString("0x%1").arg(section.addr, 0, 16)),
+							new QStandardItem(QString::fromStdString(section.name)),
+							new QStandardItem(QString("0x%1").arg(section.vmAddress, 0, 16)),
 							new QStandardItem(QString("0x%1").arg(section.size, 0, 16))});
 						break;
 					}
 				}
-				i++;
 			}
-			continue;
 		}
 
 		std::string sizeStr;
@@ -647,23 +694,21 @@ DSCTriageView::DSCTriageView(QWidget* parent, BinaryViewRef data) : QWidget(pare
 
 	auto loadImageTable = new FilterableTableView;
 	{
-		auto loadImageModel = new QStandardItemModel(0, 2, loadImageTable);
+		auto loadImageModel = new QStandardItemModel(0, 3, loadImageTable);
 		{
 			connect(
 				cacheBlocksView, &DSCCacheBlocksView::loadDone, [this, loadImageModel]()
 				{
-					for (const auto& img : m_cache->GetImages())
+					// Summaries come straight from the cache's state, unlike full headers which are serialized
+					for (const auto& img : m_cache->GetImageSummaries())
 					{
-						if (auto header = m_cache->GetMachOHeaderForAddress(img.headerAddress); header)
-						{
-							m_headers.push_back(*header);
-						}
 						loadImageModel->appendRow({
 							new QStandardItem(QString::fromStdString(img.name)),
-							new QStandardItem(QString("0x%1").arg(img.headerAddress, 0, 16))});
+							new QStandardItem(QString("0x%1").arg(img.headerAddress, 0, 16)),
+							new QStandardItem(QString("0x%1").arg(img.size, 0, 16))});
 					}
 				});
-			loadImageModel->setHorizontalHeaderLabels({"Name", "VM Address"});
+			loadImageModel->setHorizontalHeaderLabels({"Name", "VM Address", "Size"});
 		} // loadImageModel
 
 		auto loadImageButton = new CustomStyleFlatPushButton();
@@ -676,8 +721,10 @@ DSCTriageView::DSCTriageView(QWidget* parent, BinaryViewRef data) : QWidget(pare
 						return;
 					}
 
-					auto name = selected[0].data().toString().toStdString();
-					WorkerPriorityEnqueue([this, name]() { m_cache->LoadImageWithInstallName(name); });
+					std::vector<std::string> names;
+					for (const auto& index : selected)
+						names.push_back(index.data().toString().toStdString());
+					WorkerPriorityEnqueue([this, names]() { m_cache->LoadImagesWithInstallNames(names); });
 				});
 			loadImageButton->setText("Load");
 
@@ -726,6 +773,7 @@ DSCTriageView::DSCTriageView(QWidget* parent, BinaryViewRef data) : QWidget(pare
 
 		loadImageTable->horizontalHeader()->setSectionResizeMode(0, QHeaderView::Stretch);
 		loadImageTable->horizontalHeader()->setSectionResizeMode(1, QHeaderView::ResizeToContents);
+		loadImageTable->horizontalHeader()->setSectionResizeMode(2, QHeaderView::ResizeToContents);
 
 		loadImageTable->setSelectionBehavior(QAbstractItemView::SelectRows);
 		loadImageTable->setSelectionMode(QAbstractItemView::SingleSelection);
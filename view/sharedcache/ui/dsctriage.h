@@ -189,8 +189,17 @@ class SymbolTableModel : public QAbstractTableModel {
 	Q_OBJECT
 
 	SymbolTableView* m_parent;
+	bool m_loaded = false;
+	// Filter that m_rows currently matches, and the one most recently asked for
 	std::string m_filter;
-	std::vector<SharedCacheAPI::DSCSymbol> m_symbols;
+	std::string m_requestedFilter;
+	// Indices into the view's symbols of the rows shown
+	std::vector<uint32_t> m_rows;
+	// Bumped for every filter so a superseded background filter stops and drops its result
+	std::atomic<uint64_t> m_filterGeneration = 0;
+
+	std::vector<uint32_t> filterRows(const std::vector<uint32_t>* candidates, const std::string& text,
+		uint64_t generation) const;
 
 public:
 	explicit SymbolTableModel(SymbolTableView* parent);
@@ -270,7 +279,8 @@ class DSCTriageView : public QWidget, public View
 	SplitTabWidget* m_bottomRegionTabs;
 	DockableTabCollection* m_bottomRegionCollection;
 
-	std::vector<SharedCacheAPI::SharedCacheMachOHeader> m_headers;
+	// Fetched the first time a backing cache's sections are shown
+	std::optional<std::vector<SharedCacheAPI::DSCImage>> m_images;
 
 public:
 	DSCTriageView(QWidget* parent, BinaryViewRef data);
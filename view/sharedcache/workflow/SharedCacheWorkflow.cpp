@@ -13,11 +13,85 @@
 #include "mediumlevelilinstruction.h"
 #include "../api/sharedcacheapi.h"
 #include "thread"
+#include <algorithm>
+#include <map>
+
+
+// Images and sections that stubs jump into, loaded one batch at a time by a single worker so that analysis
+// threads never wait on a load. Requests for the same image are merged and every function that asked for it is
+// reanalyzed once it is mapped.
+class ImageLoadQueue
+{
+	struct PendingLoad
+	{
+		uint64_t address;
+		bool image;
+		std::vector<Ref<Function>> dependents;
+	};
+
+	std::mutex m_mutex;
+	std::map<std::string, PendingLoad> m_requests;
+	bool m_loaderRunning = false;
+
+	void RunLoader(Ref<BinaryView> view)
+	{
+		while (true)
+		{
+			std::map<std::string, PendingLoad> batch;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				if (m_requests.empty())
+				{
+					m_loaderRunning = false;
+					return;
+				}
+				batch.swap(m_requests);
+			}
+
+			Ref<SharedCacheAPI::SharedCache> cache = new SharedCacheAPI::SharedCache(view);
+			for (auto& [name, request] : batch)
+			{
+				// An earlier batch may have mapped it already, the dependents still need another pass
+				if (!view->IsValidOffset(request.address))
+				{
+					if (request.image)
+						cache->LoadImageContainingAddress(request.address);
+					else
+						cache->LoadSectionAtAddress(request.address);
+				}
+				for (auto& func : request.dependents)
+					func->Reanalyze();
+			}
+		}
+	}
+
+public:
+	// Queue loading whatever contains address and reanalyzing dependent afterwards
+	void Request(Ref<BinaryView> view, uint64_t address, Ref<Function> dependent)
+	{
+		Ref<SharedCacheAPI::SharedCache> cache = new SharedCacheAPI::SharedCache(view);
+		std::string name = cache->GetImageNameForAddress(address);
+		bool image = !name.empty();
+		if (!image)
+			name = cache->GetNameForAddress(address);
+		if (name.empty())
+			return;
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		auto& request = m_requests.try_emplace(name, PendingLoad {address, image, {}}).first->second;
+		if (std::find(request.dependents.begin(), request.dependents.end(), dependent) == request.dependents.end())
+			request.dependents.push_back(dependent);
+		if (m_loaderRunning)
+			return;
+		m_loaderRunning = true;
+		WorkerPriorityEnqueue([this, view]() { RunLoader(view); });
+	}
+};
 
 
 struct GlobalWorkflowState
 {
-	std::mutex imageLoadMutex;
+	ImageLoadQueue imageLoads;
 	bool autoLoadStubsAndDyldData = true;
 	bool autoLoadObjCStubRequirements = true;
 };
@@ -27,25 +101,36 @@ std::mutex globalWorkflowStateMutex;
 
 GlobalWorkflowState* GetGlobalWorkflowState(Ref<BinaryView> view)
 {
+	// Activities call this for every function. An analysis thread usually stays on one session, and states are
+	// never freed, so the last lookup of each thread is remembered to skip the lock and the map.
+	thread_local uint64_t cachedSessionId = 0;
+	thread_local GlobalWorkflowState* cachedState = nullptr;
+	uint64_t sessionId = view->GetFile()->GetSessionId();
+	if (cachedState && cachedSessionId == sessionId)
+		return cachedState;
+
 	std::unique_lock<std::mutex> lock(globalWorkflowStateMutex);
-	if (globalWorkflowState.find(view->GetFile()->GetSessionId()) == globalWorkflowState.end())
+	GlobalWorkflowState*& state = globalWorkflowState[sessionId];
+	if (!state)
 	{
-		globalWorkflowState[view->GetFile()->GetSessionId()] = new GlobalWorkflowState();
+		state = new GlobalWorkflowState();
 		Ref<Settings> settings = view->GetLoadSettings(VIEW_NAME);
 		bool autoLoadStubsAndDyldData = true;
 		if (settings && settings->Contains("loader.dsc.autoLoadStubsAndDyldData"))
 		{
 			autoLoadStubsAndDyldData = settings->Get<bool>("loader.dsc.autoLoadStubsAndDyldData", view);
 		}
-		globalWorkflowState[view->GetFile()->GetSessionId()]->autoLoadStubsAndDyldData = autoLoadStubsAndDyldData;
+		state->autoLoadStubsAndDyldData = autoLoadStubsAndDyldData;
 		bool autoLoadObjC = true;
 		if (settings && settings->Contains("loader.dsc.autoLoadObjCStubRequirements"))
 		{
 			autoLoadObjC = settings->Get<bool>("loader.dsc.autoLoadObjCStubRequirements", view);
 		}
-		globalWorkflowState[view->GetFile()->GetSessionId()]->autoLoadObjCStubRequirements = autoLoadObjC;
+		state->autoLoadObjCStubRequirements = autoLoadObjC;
 	}
-	return globalWorkflowState[view->GetFile()->GetSessionId()];
+	cachedSessionId = sessionId;
+	cachedState = state;
+	return state;
 }
 
 
@@ -122,12 +207,13 @@ void SharedCacheWorkflow::FixupStubs(Ref<AnalysisContext> ctx)
 		auto workflowState = GetGlobalWorkflowState(bv);
 
 		auto funcStart = func->GetStart();
-		auto sectionExists = !bv->GetSectionsAt(funcStart).empty();
-		if (!sectionExists)
+		auto sections = bv->GetSectionsAt(funcStart);
+		if (sections.empty())
 			return;
-		auto section = bv->GetSectionsAt(funcStart)[0];
+		auto section = sections[0];
+		const auto sectionName = section->GetName();
 
-		auto imageName = section->GetName();
+		auto imageName = sectionName;
 		// remove everything after ::
 		auto pos = imageName.find("::");
 		if (pos != std::string::npos)
@@ -152,7 +238,7 @@ void SharedCacheWorkflow::FixupStubs(Ref<AnalysisContext> ctx)
 		}
 
 		// Processor that automatically loads the libObjC image when it encounters a stub (so we can do inlining).
-		if (workflowState->autoLoadObjCStubRequirements && section->GetName().find("__objc_stubs") != std::string::npos)
+		if (workflowState->autoLoadObjCStubRequirements && sectionName.find("__objc_stubs") != std::string::npos)
 		{
 			auto firstInstruction = mlil->GetInstruction(0);
 			if (firstInstruction.operation == MLIL_TAILCALL)
@@ -183,18 +269,6 @@ void SharedCacheWorkflow::FixupStubs(Ref<AnalysisContext> ctx)
 							auto value = mssa->GetSSAVarValue(dest.GetSourceSSAVariable());
 							if (value.state == UndeterminedValue)
 							{
-								bool otherFunctionAlreadyRunning;
-								{
-									otherFunctionAlreadyRunning = !workflowState->imageLoadMutex.try_lock();
-									if (!otherFunctionAlreadyRunning)
-										workflowState->imageLoadMutex.unlock();
-								}
-								if (otherFunctionAlreadyRunning)
-								{
-									return;
-								}
-
-								std::unique_lock<std::mutex> lock(workflowState->imageLoadMutex);
 								auto def = mssa->GetSSAVarDefinition(dest.GetSourceSSAVariable());
 								auto defInstr = mssa->GetInstruction(def);
 								auto targetOffset = defInstr.GetSourceExpr().GetSourceExpr().GetConstant();
@@ -202,67 +276,18 @@ void SharedCacheWorkflow::FixupStubs(Ref<AnalysisContext> ctx)
 								if (bv->IsValidOffset(targetOffset))
 									return;
 
-								Ref<SharedCacheAPI::SharedCache> cache = new SharedCacheAPI::SharedCache(bv);
-
-								if (!cache)
-									return;
-								if (!cache->GetImageNameForAddress(targetOffset).empty())
-								{
-									cache->LoadImageContainingAddress(targetOffset);
-								}
-								else
-								{
-									cache->LoadSectionAtAddress(targetOffset);
-								}
-								for (const auto &sectFunc : bv->GetAnalysisFunctionList())
-								{
-									if (section->GetStart() <= sectFunc->GetStart() && sectFunc->GetStart() < section->GetEnd())
-									{
-										func->Reanalyze();
-									}
-								}
+								workflowState->imageLoads.Request(bv, targetOffset, func);
 							}
 						}
 
 						else if (instr.GetDestExpr<MLIL_JUMP>().operation == MLIL_CONST_PTR)
 						{
-							bool otherFunctionAlreadyRunning;
-							{
-								otherFunctionAlreadyRunning = !workflowState->imageLoadMutex.try_lock();
-								if (!otherFunctionAlreadyRunning)
-									workflowState->imageLoadMutex.unlock();
-							}
-							if (otherFunctionAlreadyRunning)
-							{
-								return;
-							}
-
-							std::unique_lock<std::mutex> lock(workflowState->imageLoadMutex);
 							auto dest = instr.GetDestExpr<MLIL_JUMP>();
 							auto targetOffset = dest.GetConstant();
 							if (bv->IsValidOffset(targetOffset))
 								return;
 
-							Ref<SharedCacheAPI::SharedCache> cache = new SharedCacheAPI::SharedCache(bv);
-
-							if (!cache)
-								return;
-
-							if (!cache->GetImageNameForAddress(targetOffset).empty())
-							{
-								cache->LoadImageContainingAddress(targetOffset);
-							}
-							else
-							{
-								cache->LoadSectionAtAddress(targetOffset);
-							}
-							for (const auto &sectFunc : bv->GetAnalysisFunctionList())
-							{
-								if (section->GetStart() <= sectFunc->GetStart() && sectFunc->GetStart() < section->GetEnd())
-								{
-									func->Reanalyze();
-								}
-							}
+							workflowState->imageLoads.Request(bv, targetOffset, func);
 						}
 					}
 				}
@@ -271,10 +296,10 @@ void SharedCacheWorkflow::FixupStubs(Ref<AnalysisContext> ctx)
 			return;
 		}
 
-		if (section->GetName().find("::_stubs") != std::string::npos // Branch Islands (iOS 16)
-			|| section->GetName().find("dyld_shared_cache_branch_islands") != std::string::npos // Branch Islands (iOS 11-?)
-			|| section->GetName().find("::__stubs") != std::string::npos // Stubs (non arm64e)
-			|| section->GetName().find("::__auth_stubs") != std::string::npos // Stubs (arm64e)
+		if (sectionName.find("::_stubs") != std::string::npos // Branch Islands (iOS 16)
+			|| sectionName.find("dyld_shared_cache_branch_islands") != std::string::npos // Branch Islands (iOS 11-?)
+			|| sectionName.find("::__stubs") != std::string::npos // Stubs (non arm64e)
+			|| sectionName.find("::__auth_stubs") != std::string::npos // Stubs (arm64e)
 			)
 		{
 			auto firstInstruction = mlil->GetInstruction(0);
@@ -333,20 +358,6 @@ void SharedCacheWorkflow::FixupStubs(Ref<AnalysisContext> ctx)
 								auto value = mssa->GetSSAVarValue(dest.GetSourceSSAVariable());
 								if (value.state == UndeterminedValue)
 								{
-									bool otherFunctionAlreadyRunning;
-									{
-										otherFunctionAlreadyRunning =
-											!workflowState->imageLoadMutex.try_lock();
-										if (!otherFunctionAlreadyRunning)
-											workflowState->imageLoadMutex.unlock();
-									}
-									if (otherFunctionAlreadyRunning)
-									{
-										return;
-									}
-
-									std::unique_lock<std::mutex> lock(
-										workflowState->imageLoadMutex);
 									auto def = mssa->GetSSAVarDefinition(dest.GetSourceSSAVariable());
 									auto defInstr = mssa->GetInstruction(def);
 									auto targetOffset = defInstr.GetSourceExpr().GetSourceExpr().GetConstant();
@@ -354,26 +365,7 @@ void SharedCacheWorkflow::FixupStubs(Ref<AnalysisContext> ctx)
 									if (bv->IsValidOffset(targetOffset))
 										return;
 
-									Ref<SharedCacheAPI::SharedCache> cache = new SharedCacheAPI::SharedCache(bv);
-
-									if (!cache)
-										return;
-
-									if (!cache->GetImageNameForAddress(targetOffset).empty())
-									{
-										cache->LoadImageContainingAddress(targetOffset);
-									}
-									else
-									{
-										cache->LoadSectionAtAddress(targetOffset);
-									}
-									for (const auto &sectFunc : bv->GetAnalysisFunctionList())
-									{
-										if (section->GetStart() <= sectFunc->GetStart() && sectFunc->GetStart() < section->GetEnd())
-										{
-											func->Reanalyze();
-										}
-									}
+									workflowState->imageLoads.Request(bv, targetOffset, func);
 								}
 							}
 
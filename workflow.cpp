@@ -1,4 +1,5 @@
 #include "binaryninjaapi.h"
+#include "ffi.h"
 #include "json/json.h"
 #include "rapidjsonwrapper.h"
 #include <string>
@@ -268,19 +269,9 @@ Ref<Activity> Workflow::RegisterActivity(const string& configuration, const func
 
 Ref<Activity> Workflow::RegisterActivity(Ref<Activity> activity, const vector<string>& subactivities)
 {
-	char** buffer = new char*[subactivities.size()];
-	if (!buffer)
-		return nullptr;
-
 	activity->AddRefForRegistration(); // TODO
-	for (size_t i = 0; i < subactivities.size(); i++)
-		buffer[i] = BNAllocString(subactivities[i].c_str());
-
-	BNActivity* activityObject = BNWorkflowRegisterActivity(m_object, activity->GetObject(), (const char**)buffer, subactivities.size());
-
-	for (size_t i = 0; i < subactivities.size(); i++)
-		BNFreeString(buffer[i]);
-	delete[] buffer;
+	vector<const char*> buffer = BorrowApiStringList(subactivities);
+	BNActivity* activityObject = BNWorkflowRegisterActivity(m_object, activity->GetObject(), buffer.data(), subactivities.size());
 
 	if (!activityObject)
 		return nullptr;
@@ -364,19 +355,8 @@ vector<string> Workflow::GetSubactivities(const string& activity, bool immediate
 
 bool Workflow::AssignSubactivities(const string& activity, const vector<string>& subactivities)
 {
-	char** buffer = new char*[subactivities.size()];
-	if (!buffer)
-		return false;
-
-	for (size_t i = 0; i < subactivities.size(); i++)
-		buffer[i] = BNAllocString(subactivities[i].c_str());
-
-	bool result = BNWorkflowAssignSubactivities(m_object, activity.c_str(), (const char**)buffer, subactivities.size());
-
-	for (size_t i = 0; i < subactivities.size(); i++)
-		BNFreeString(buffer[i]);
-	delete[] buffer;
-	return result;
+	vector<const char*> buffer = BorrowApiStringList(subactivities);
+	return BNWorkflowAssignSubactivities(m_object, activity.c_str(), buffer.data(), subactivities.size());
 }
 
 
@@ -388,30 +368,15 @@ bool Workflow::Clear()
 
 bool Workflow::Insert(const string& activity, const string& newActivity)
 {
-	char* buffer[1];
-	buffer[0] = BNAllocString(newActivity.c_str());
-
-	bool result = BNWorkflowInsert(m_object, activity.c_str(), (const char**)buffer, 1);
-	BNFreeString(buffer[0]);
-	return result;
+	const char* buffer[1] = {newActivity.c_str()};
+	return BNWorkflowInsert(m_object, activity.c_str(), buffer, 1);
 }
 
 
 bool Workflow::Insert(const string& activity, const vector<string>& activities)
 {
-	char** buffer = new char*[activities.size()];
-	if (!buffer)
-		return false;
-
-	for (size_t i = 0; i < activities.size(); i++)
-		buffer[i] = BNAllocString(activities[i].c_str());
-
-	bool result = BNWorkflowInsert(m_object, activity.c_str(), (const char**)buffer, activities.size());
-
-	for (size_t i = 0; i < activities.size(); i++)
-		BNFreeString(buffer[i]);
-	delete[] buffer;
-	return result;
+	vector<const char*> buffer = BorrowApiStringList(activities);
+	return BNWorkflowInsert(m_object, activity.c_str(), buffer.data(), activities.size());
 }
 
 